@@ -0,0 +1,344 @@
+#!/usr/bin/env python3
+"""
+GB2312编码表生成工具
+从常用汉字表生成 Unicode 到 GB2312 的两级查找表（lcd_font/fonts_cn/gb2312_encode_*.c）
+
+查找表结构：
+    page_index[高字节]          -> 页号，0xFF表示该页没有字符
+    block_bits[页号 * 8 + 块]   -> 每块32个码点的位图
+    block_base[页号 * 8 + 块]   -> 该块第一个字符在 gb2312_codes 中的序号
+    gb2312_codes[]              -> 按Unicode排序的GB2312编码
+
+查找时 gb2312_codes[block_base + popcount(位图中低于该码点的位)]，与字符数量无关。
+
+--bench 用主机上的C编译器比较原来的二分查找和两级查找表，在汉字文本语料上统计每次查找的时间：
+    python3 gb2312_encode_gen.py -i lcd_font/fonts_cn/gb2312_encode_hz3500.c --bench
+"""
+
+import os
+import re
+import sys
+import shutil
+import argparse
+import subprocess
+import tempfile
+from typing import List, Tuple
+
+# 默认的测试语料，仓库中的中文文档
+DEFAULT_CORPUS = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                              'lcd_font', 'fonts_cn', 'gb2312_bench_corpus.txt')
+
+BLOCK_BITS = 32
+BLOCKS_PER_PAGE = 256 // BLOCK_BITS
+
+
+def read_pairs(input_file: str) -> Tuple[List[Tuple[int, int]], str]:
+    """
+    读取字符表，返回按Unicode排序的 (unicode, gb2312) 列表和源文件名
+
+    支持两种输入：
+    - 文本文件（如 hz3500.txt），其中能用GB2312编码的汉字都会加入编码表
+    - 以前生成的 gb2312_encode_*.c，用于重新生成
+    """
+    with open(input_file, 'r', encoding='utf-8') as f:
+        text = f.read()
+
+    source = os.path.basename(input_file)
+    pairs = {}
+
+    if input_file.endswith('.c'):
+        m = re.search(r'Source file:\s*(\S+)', text)
+        if m:
+            source = m.group(1)
+        # 旧格式 {0x4E00, 0xD2BB}，新格式 0xD2BB, // 一 U+4E00
+        for u, g in re.findall(r'\{0x([0-9A-Fa-f]+),\s*0x([0-9A-Fa-f]+)\}', text):
+            pairs[int(u, 16)] = int(g, 16)
+        for g, u in re.findall(r'0x([0-9A-Fa-f]{4}),\s*//\s*\S+\s+U\+([0-9A-Fa-f]{4})', text):
+            pairs[int(u, 16)] = int(g, 16)
+    else:
+        for ch in text:
+            code = ord(ch)
+            if code < 0x80 or code > 0xFFFF or ch.isspace():
+                continue
+            try:
+                gb = ch.encode('gb2312')
+            except UnicodeEncodeError:
+                continue
+            if len(gb) == 2:
+                pairs[code] = (gb[0] << 8) | gb[1]
+
+    return sorted(pairs.items()), source
+
+
+def build_tables(pairs: List[Tuple[int, int]]):
+    """生成页索引、块位图、块起始序号和编码数组"""
+    pages = sorted({u >> 8 for u, _ in pairs})
+    if len(pages) >= 0xFF:
+        raise ValueError('too many pages')
+
+    page_index = [0xFF] * 256
+    for i, p in enumerate(pages):
+        page_index[p] = i
+
+    block_bits = [0] * (len(pages) * BLOCKS_PER_PAGE)
+    block_base = [0] * (len(pages) * BLOCKS_PER_PAGE)
+    for u, _ in pairs:
+        block = page_index[u >> 8] * BLOCKS_PER_PAGE + ((u >> 5) & (BLOCKS_PER_PAGE - 1))
+        block_bits[block] |= 1 << (u & (BLOCK_BITS - 1))
+
+    base = 0
+    for i, bits in enumerate(block_bits):
+        block_base[i] = base
+        base += bin(bits).count('1')
+
+    codes = [g for _, g in pairs]
+    return pages, page_index, block_bits, block_base, codes
+
+
+def lookup(tables, unicode: int) -> int:
+    """按生成的C代码相同的方式查找，用于校验"""
+    _, page_index, block_bits, block_base, codes = tables
+    page = page_index[unicode >> 8]
+    if page == 0xFF:
+        return 0xFFFF
+    block = page * BLOCKS_PER_PAGE + ((unicode >> 5) & (BLOCKS_PER_PAGE - 1))
+    bit = 1 << (unicode & (BLOCK_BITS - 1))
+    if not block_bits[block] & bit:
+        return 0xFFFF
+    return codes[block_base[block] + bin(block_bits[block] & (bit - 1)).count('1')]
+
+
+def generate_c(pairs: List[Tuple[int, int]], source: str) -> str:
+    tables = build_tables(pairs)
+    pages, page_index, block_bits, block_base, codes = tables
+
+    # 生成前校验所有字符和不在表中的码点
+    expected = dict(pairs)
+    for u in range(0x10000):
+        if lookup(tables, u) != expected.get(u, 0xFFFF):
+            raise ValueError('table check failed at U+%04X' % u)
+
+    out = []
+    out.append('// Auto-generated code mapping table for Unicode to GB2312 conversion')
+    out.append('// Source file: %s' % source)
+    out.append('// Generated by gb2312_encode_gen.py, do not edit')
+    out.append('#include <stdint.h>')
+    out.append('#include "gb2312_encode.h"')
+    out.append('')
+    out.append('#define MAP_TABLE_SIZE %d' % len(codes))
+    out.append('#define MAP_PAGE_COUNT %d' % len(pages))
+    out.append('')
+    out.append('// Unicode高字节 -> 页号，0xFF表示该页没有字符')
+    out.append('static const uint8_t page_index[256] = {')
+    for i in range(0, 256, 16):
+        out.append('    ' + ' '.join('0x%02X,' % v for v in page_index[i:i + 16]))
+    out.append('};')
+    out.append('')
+    out.append('// 每页%d块，每块%d个码点的位图' % (BLOCKS_PER_PAGE, BLOCK_BITS))
+    out.append('static const uint32_t block_bits[MAP_PAGE_COUNT * %d] = {' % BLOCKS_PER_PAGE)
+    for i, p in enumerate(pages):
+        row = block_bits[i * BLOCKS_PER_PAGE:(i + 1) * BLOCKS_PER_PAGE]
+        out.append('    ' + ' '.join('0x%08X,' % v for v in row) + ' // U+%02Xxx' % p)
+    out.append('};')
+    out.append('')
+    out.append('// 每块第一个字符在 gb2312_codes 中的序号')
+    out.append('static const uint16_t block_base[MAP_PAGE_COUNT * %d] = {' % BLOCKS_PER_PAGE)
+    for i, p in enumerate(pages):
+        row = block_base[i * BLOCKS_PER_PAGE:(i + 1) * BLOCKS_PER_PAGE]
+        out.append('    ' + ' '.join('%d,' % v for v in row) + ' // U+%02Xxx' % p)
+    out.append('};')
+    out.append('')
+    out.append('// 按Unicode排序的GB2312编码')
+    out.append('static const uint16_t gb2312_codes[MAP_TABLE_SIZE] = {')
+    for u, g in pairs:
+        out.append('    0x%04X, // %s U+%04X' % (g, chr(u), u))
+    out.append('};')
+    out.append('')
+    out.append('// Convert Unicode code point to GB2312 encoding')
+    out.append('// Returns INVALID_GB2312 if the character is not found')
+    out.append('uint16_t unicode_to_gb2312(uint16_t unicode) {')
+    out.append('    uint8_t page = page_index[unicode >> 8];')
+    out.append('    if (page == 0xFF) {')
+    out.append('        return INVALID_GB2312;')
+    out.append('    }')
+    out.append('')
+    out.append('    uint32_t block = page * %d + ((unicode >> 5) & %d);' % (BLOCKS_PER_PAGE, BLOCKS_PER_PAGE - 1))
+    out.append('    uint32_t bit = 1u << (unicode & %d);' % (BLOCK_BITS - 1))
+    out.append('    uint32_t bits = block_bits[block];')
+    out.append('    if (!(bits & bit)) {')
+    out.append('        return INVALID_GB2312;  // Character not found')
+    out.append('    }')
+    out.append('')
+    out.append('    return gb2312_codes[block_base[block] + __builtin_popcount(bits & (bit - 1))];')
+    out.append('}')
+    out.append('')
+    return '\n'.join(out)
+
+
+def generate_bsearch_c(pairs: List[Tuple[int, int]]) -> str:
+    """生成原来的按Unicode排序的编码对和二分查找，作为测试的基准"""
+    out = []
+    out.append('#define BSEARCH_TABLE_SIZE %d' % len(pairs))
+    out.append('static const struct { uint16_t unicode; uint16_t gb2312; } bsearch_table[BSEARCH_TABLE_SIZE] = {')
+    for u, g in pairs:
+        out.append('    {0x%04X, 0x%04X},' % (u, g))
+    out.append('};')
+    out.append('')
+    out.append('static uint16_t unicode_to_gb2312_bsearch(uint16_t unicode) {')
+    out.append('    int left = 0;')
+    out.append('    int right = BSEARCH_TABLE_SIZE - 1;')
+    out.append('    while (left <= right) {')
+    out.append('        int mid = (left + right) / 2;')
+    out.append('        if (bsearch_table[mid].unicode == unicode) {')
+    out.append('            return bsearch_table[mid].gb2312;')
+    out.append('        }')
+    out.append('        if (bsearch_table[mid].unicode < unicode) {')
+    out.append('            left = mid + 1;')
+    out.append('        } else {')
+    out.append('            right = mid - 1;')
+    out.append('        }')
+    out.append('    }')
+    out.append('    return INVALID_GB2312;')
+    out.append('}')
+    out.append('')
+    return '\n'.join(out)
+
+
+BENCH_MAIN = r'''
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+int main(int argc, char **argv) {
+    for (uint32_t u = 0; u < 0x10000; u++) {
+        if (unicode_to_gb2312_bsearch(u) != unicode_to_gb2312(u)) {
+            printf("Mismatch at U+%04X\n", (unsigned)u);
+            return 1;
+        }
+    }
+
+    FILE *f = fopen(argv[1], "rb");
+    int repeat = atoi(argv[2]);
+    if (f == NULL || repeat <= 0) {
+        return 2;
+    }
+    fseek(f, 0, SEEK_END);
+    long n = ftell(f) / 2;
+    fseek(f, 0, SEEK_SET);
+    uint16_t *chars = malloc(n * 2 + 2);
+    if (chars == NULL || fread(chars, 2, n, f) != (size_t)n) {
+        return 2;
+    }
+    fclose(f);
+
+    volatile uint32_t sink = 0;
+    double t_bsearch = 0, t_table = 0;
+    for (int round = 0; round < 2; round++) {  // 第一轮预热
+        double t0 = now_ns();
+        for (int r = 0; r < repeat; r++) {
+            for (long i = 0; i < n; i++) {
+                sink += unicode_to_gb2312_bsearch(chars[i]);
+            }
+        }
+        double t1 = now_ns();
+        for (int r = 0; r < repeat; r++) {
+            for (long i = 0; i < n; i++) {
+                sink += unicode_to_gb2312(chars[i]);
+            }
+        }
+        double t2 = now_ns();
+        t_bsearch = (t1 - t0) / ((double)n * repeat);
+        t_table = (t2 - t1) / ((double)n * repeat);
+    }
+
+    printf("%ld non-ASCII chars x%d: binary search %.1f ns/lookup, two-level %.1f ns/lookup\n",
+           n, repeat, t_bsearch, t_table);
+    return 0;
+}
+'''
+
+
+def run_bench(pairs: List[Tuple[int, int]], source: str, corpus: str, repeat: int, cc: str) -> int:
+    """编译并运行查找测试，两种查找对所有码点的结果必须相同"""
+    if shutil.which(cc) is None:
+        print('Error: C compiler %s not found, set --cc or CC' % cc)
+        return 1
+
+    with open(corpus, 'r', encoding='utf-8') as f:
+        codes = [ord(ch) for ch in f.read() if 0x80 <= ord(ch) <= 0xFFFF]
+    if not codes:
+        print('Error: no non-ASCII characters in %s' % corpus)
+        return 1
+
+    # 生成的查找表代码中不包含头文件，直接定义 INVALID_GB2312
+    table = generate_c(pairs, source).replace('#include "gb2312_encode.h"', '#define INVALID_GB2312 0xFFFF')
+    code = table + '\n' + generate_bsearch_c(pairs) + BENCH_MAIN
+
+    with tempfile.TemporaryDirectory() as tmp:
+        src = os.path.join(tmp, 'gb2312_bench.c')
+        exe = os.path.join(tmp, 'gb2312_bench')
+        chars = os.path.join(tmp, 'corpus.u16')
+        with open(src, 'w', encoding='utf-8') as f:
+            f.write(code)
+        with open(chars, 'wb') as f:
+            f.write(b''.join(c.to_bytes(2, 'little') for c in codes))
+
+        build = subprocess.run([cc, '-O2', '-o', exe, src], capture_output=True, text=True)
+        if build.returncode != 0:
+            print('Error: failed to build benchmark:\n%s' % build.stderr)
+            return 1
+
+        result = subprocess.run([exe, chars, str(repeat)], capture_output=True, text=True)
+        print('%s (%d characters), corpus %s' % (source, len(pairs), os.path.basename(corpus)))
+        print('  ' + result.stdout.strip())
+        return result.returncode
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate Unicode to GB2312 lookup table')
+    parser.add_argument('--input', '-i', required=True,
+                        help='Character list (e.g. hz3500.txt) or a previously generated gb2312_encode_*.c')
+    parser.add_argument('--output', '-o', help='Output C file')
+    parser.add_argument('--bench', action='store_true',
+                        help='Compare binary search and the two-level table on a text corpus, no output')
+    parser.add_argument('--corpus', default=DEFAULT_CORPUS,
+                        help='UTF-8 text for --bench (default: lcd_font/fonts_cn/gb2312_bench_corpus.txt)')
+    parser.add_argument('--repeat', type=int, default=200, help='Passes over the corpus for --bench')
+    parser.add_argument('--cc', default=os.environ.get('CC', 'cc'), help='Host C compiler for --bench')
+    args = parser.parse_args()
+
+    if not args.bench and not args.output:
+        parser.error('--output is required unless --bench is given')
+
+    try:
+        pairs, source = read_pairs(args.input)
+        if not pairs:
+            print('Error: no GB2312 characters found in %s' % args.input)
+            return 1
+
+        if args.bench:
+            return run_bench(pairs, source, args.corpus, args.repeat, args.cc)
+
+        code = generate_c(pairs, source)
+    except (OSError, ValueError) as e:
+        print('Error: %s' % e)
+        return 1
+
+    with open(args.output, 'w', encoding='utf-8') as f:
+        f.write(code)
+
+    tables = build_tables(pairs)
+    table_size = 256 + len(tables[2]) * 4 + len(tables[3]) * 2 + len(tables[4]) * 2
+    print('Generated %s: %d characters, %d pages, %d bytes (sorted pair table: %d bytes)' %
+          (args.output, len(pairs), len(tables[0]), table_size, len(pairs) * 4))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -2,6 +2,9 @@
 """
 汉字库文件打包工具
 用于在汉字库文件头部添加hzk_header_t结构
+
+HZK1: 按GB2312的94x94编码区排列的完整字库
+HZK2: 只保存编码表中的字符，按Unicode排序，带Unicode索引（--compact 生成）
 """
 
 import os
@@ -11,12 +14,16 @@ import argparse
 import zlib
 from typing import Tuple
 
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from gb2312_encode_gen import read_pairs, build_tables, BLOCKS_PER_PAGE
+
 # hzk_header_t 结构定义
 class HzkHeader:
     """汉字库头信息结构"""
     
     # 魔数标识
     MAGIC = 0x314B5A48  # "HZK1" in little-endian
+    MAGIC2 = 0x324B5A48  # "HZK2" in little-endian
     
     def __init__(self, font_width: int, font_height: int, font_code_size: int, 
                  font_data_offset: int, font_data_size: int):
@@ -37,7 +44,13 @@ class HzkHeader:
         self.font_data_offset = font_data_offset
         self.font_data_size = font_data_size
         self.font_data_checksum = 0
-        self.reserved = [0] * 8  # 8个保留字段
+        # HZK2的索引信息，HZK1中为0
+        self.char_count = 0
+        self.page_count = 0
+        self.index_offset = 0
+        self.index_size = 0
+        self.index_checksum = 0
+        self.reserved = [0] * 3  # 3个保留字段
         self.header_checksum = 0
     
     def calculate_data_checksum(self, data: bytes) -> int:
@@ -58,6 +71,9 @@ class HzkHeader:
         # 添加font_data_checksum
         header_data += struct.pack('<I', self.font_data_checksum)
         
+        # 添加索引字段
+        header_data += self.pack_index_fields()
+        
         # 添加reserved字段
         for reserved_val in self.reserved:
             header_data += struct.pack('<I', reserved_val)
@@ -82,7 +98,10 @@ class HzkHeader:
         # 添加font_data_checksum（4字节）
         data += struct.pack('<I', self.font_data_checksum)
         
-        # 添加reserved字段（8个uint32）
+        # 添加索引字段（5个uint32）
+        data += self.pack_index_fields()
+        
+        # 添加reserved字段（3个uint32）
         for reserved_val in self.reserved:
             data += struct.pack('<I', reserved_val)
         
@@ -91,6 +110,20 @@ class HzkHeader:
         
         return data
     
+    def pack_index_fields(self) -> bytes:
+        """打包HZK2的索引字段"""
+        return struct.pack('<5I', self.char_count, self.page_count, self.index_offset,
+                           self.index_size, self.index_checksum)
+    
+    @property
+    def is_compact(self) -> bool:
+        return self.magic == self.MAGIC2
+    
+    @property
+    def file_size(self) -> int:
+        """数据和索引的结束位置"""
+        return max(self.font_data_offset + self.font_data_size, self.index_offset + self.index_size)
+    
     @classmethod
     def deserialize(cls, data: bytes) -> 'HzkHeader':
         """从字节数据反序列化"""
@@ -101,30 +134,40 @@ class HzkHeader:
         magic, font_width, font_height, font_code_size, font_data_offset, font_data_size = \
             struct.unpack('<IIIIII', data[:24])
         
-        if magic != cls.MAGIC:
+        if magic not in (cls.MAGIC, cls.MAGIC2):
             raise ValueError(f"Invalid magic number: 0x{magic:08X}")
         
         # 创建对象
         header = cls(font_width, font_height, font_code_size, font_data_offset, font_data_size)
+        header.magic = magic
         
         # 解析校验和字段
         header.font_data_checksum = struct.unpack('<I', data[24:28])[0]
-        header.reserved = list(struct.unpack('<8I', data[28:60]))
+        (header.char_count, header.page_count, header.index_offset,
+         header.index_size, header.index_checksum) = struct.unpack('<5I', data[28:48])
+        header.reserved = list(struct.unpack('<3I', data[48:60]))
         header.header_checksum = struct.unpack('<I', data[60:64])[0]
         
         return header
     
     def __str__(self) -> str:
-        return f"""HzkHeader:
-  Magic: 0x{self.magic:08X}
+        text = f"""HzkHeader:
+  Magic: 0x{self.magic:08X} ({'HZK2' if self.is_compact else 'HZK1'})
   Font Size: {self.font_width}x{self.font_height}
   Code Size: {self.font_code_size} bytes
   Data Offset: {self.font_data_offset}
   Data Size: {self.font_data_size} bytes
-  Data Checksum: 0x{self.font_data_checksum:08X}
+  Data Checksum: 0x{self.font_data_checksum:08X}"""
+        if self.is_compact:
+            text += f"""
+  Characters: {self.char_count}
+  Index: {self.page_count} pages, {self.index_size} bytes at {self.index_offset}
+  Index Checksum: 0x{self.index_checksum:08X}"""
+        return text + f"""
   Header Checksum: 0x{self.header_checksum:08X}"""
 
 
+
 def pack_hzk_file(input_file: str, output_file: str, font_width: int, font_height: int) -> bool:
     """
     打包汉字库文件，在头部添加hzk_header_t结构
@@ -189,6 +232,107 @@ def pack_hzk_file(input_file: str, output_file: str, font_width: int, font_heigh
         return False
 
 
+def read_grid_font(input_file: str, font_width: int, font_height: int) -> Tuple[bytes, int, int, int]:
+    """
+    读取GB2312顺序的字库，支持HZK1打包文件和原始字库文件
+
+    Returns:
+        (字体数据, 宽度, 高度, 单个字符编码大小)
+    """
+    with open(input_file, 'rb') as f:
+        file_data = f.read()
+
+    if len(file_data) >= 64 and struct.unpack_from('<I', file_data)[0] == HzkHeader.MAGIC:
+        header = HzkHeader.deserialize(file_data[:64])
+        font_data = file_data[header.font_data_offset:header.font_data_offset + header.font_data_size]
+        return font_data, header.font_width, header.font_height, header.font_code_size
+
+    if not font_width or not font_height:
+        raise ValueError("--width and --height are required for a raw font file")
+    return file_data, font_width, font_height, (font_width * font_height + 7) // 8
+
+
+def pack_compact_hzk_file(input_file: str, output_file: str, charset_file: str,
+                          font_width: int = 0, font_height: int = 0) -> bool:
+    """
+    生成HZK2字库，只保存字符表中的字符，按Unicode排序
+
+    Args:
+        input_file: GB2312顺序的字库（HZK1打包文件或原始字库文件）
+        output_file: 输出文件路径
+        charset_file: 字符表，如 hz3500.txt 或 gb2312_encode_hz3500.c
+        font_width: 字体宽度（原始字库文件需要）
+        font_height: 字体高度（原始字库文件需要）
+
+    Returns:
+        bool: 是否成功
+    """
+    try:
+        if not os.path.exists(input_file):
+            print(f"Error: Input file '{input_file}' not found!")
+            return False
+
+        grid, font_width, font_height, font_code_size = read_grid_font(input_file, font_width, font_height)
+        grid_count = len(grid) // font_code_size
+
+        # 与 font_hzk.c 中HZK1的偏移量计算相同，字库中没有的字符不加入
+        pairs = []
+        glyphs = []
+        missing = 0
+        for unicode, gb in read_pairs(charset_file)[0]:
+            index = ((gb >> 8) - 0xA1) * 94 + ((gb & 0xFF) - 0xA1)
+            if (gb >> 8) < 0xA1 or (gb & 0xFF) < 0xA1 or index >= grid_count:
+                missing += 1
+                continue
+            pairs.append((unicode, gb))
+            glyphs.append(grid[index * font_code_size:(index + 1) * font_code_size])
+
+        if not pairs:
+            print(f"Error: No characters of '{charset_file}' found in '{input_file}'")
+            return False
+        if missing:
+            print(f"Warning: {missing} characters not in font, skipped")
+
+        pages, page_index, block_bits, block_base, _ = build_tables(pairs)
+        index_data = bytes(page_index)
+        index_data += struct.pack(f'<{len(block_bits)}I', *block_bits)
+        index_data += struct.pack(f'<{len(block_base)}H', *block_base)
+
+        font_data = b''.join(glyphs)
+        index_offset = 64
+        font_data_offset = (index_offset + len(index_data) + 3) & ~3
+
+        header = HzkHeader(font_width, font_height, font_code_size, font_data_offset, len(font_data))
+        header.magic = HzkHeader.MAGIC2
+        header.font_data_checksum = header.calculate_data_checksum(font_data)
+        header.char_count = len(pairs)
+        header.page_count = len(pages)
+        header.index_offset = index_offset
+        header.index_size = len(index_data)
+        header.index_checksum = zlib.crc32(index_data) & 0xFFFFFFFF
+        header_data = header.serialize()
+
+        padding = bytes(font_data_offset - index_offset - len(index_data))
+        with open(output_file, 'wb') as f:
+            f.write(header_data)
+            f.write(index_data)
+            f.write(padding)
+            f.write(font_data)
+
+        total = font_data_offset + len(font_data)
+        print(f"Successfully packed compact font file:")
+        print(f"  Input: {input_file} ({len(grid)} bytes, {grid_count} slots)")
+        print(f"  Charset: {charset_file} ({len(pairs)} characters)")
+        print(f"  Output: {output_file} ({total} bytes, index {len(index_data)} bytes)")
+        print(header)
+
+        return True
+
+    except Exception as e:
+        print(f"Error packing compact font file: {e}")
+        return False
+
+
 def dump_hzk_file(input_file: str) -> bool:
     """
     解析汉字库文件头部信息并检查校验和
@@ -225,7 +369,7 @@ def dump_hzk_file(input_file: str) -> bool:
         print()
         
         # 验证文件大小
-        expected_file_size = header.font_data_offset + header.font_data_size
+        expected_file_size = header.file_size
         if len(file_data) == expected_file_size:
             print(f"✓ File size is correct: {len(file_data)} bytes")
         else:
@@ -265,6 +409,24 @@ def dump_hzk_file(input_file: str) -> bool:
             
             print()
             
+            # 验证HZK2索引
+            index_ok = True
+            if header.is_compact:
+                index_data = file_data[header.index_offset:header.index_offset + header.index_size]
+                calculated_index_checksum = zlib.crc32(index_data) & 0xFFFFFFFF
+                expected_index_size = 256 + header.page_count * BLOCKS_PER_PAGE * 6
+                index_ok = (calculated_index_checksum == header.index_checksum
+                            and header.index_size == expected_index_size
+                            and header.char_count * header.font_code_size == header.font_data_size)
+                print(f"Index Validation:")
+                print(f"  Stored:    0x{header.index_checksum:08X}")
+                print(f"  Calculated: 0x{calculated_index_checksum:08X}")
+                if index_ok:
+                    print(f"  ✓ Index is correct ({header.char_count} characters, {header.page_count} pages)")
+                else:
+                    print(f"  ✗ Index mismatch!")
+                print()
+
             # 字体信息分析
             print(f"Font Information:")
             print(f"  Font size: {header.font_width}x{header.font_height} pixels")
@@ -286,7 +448,7 @@ def dump_hzk_file(input_file: str) -> bool:
             header_ok = calculated_header_checksum == header.header_checksum
             size_ok = len(file_data) == expected_file_size
             
-            if data_ok and header_ok and size_ok:
+            if data_ok and header_ok and size_ok and index_ok:
                 print(f"=== Overall Status: ✓ VALID ===")
                 return True
             else:
@@ -351,6 +513,8 @@ def unpack_hzk_file(input_file: str, output_file: str) -> bool:
         with open(output_file, 'wb') as f:
             f.write(font_data)
         
+        if header.is_compact:
+            print(f"Note: HZK2 font data is in Unicode order, not GB2312 order")
         print(f"Successfully unpacked font file:")
         print(f"  Input: {input_file} ({len(file_data)} bytes)")
         print(f"  Output: {output_file} ({len(font_data)} bytes)")
@@ -367,19 +531,22 @@ def main():
     parser.add_argument('--pack', '-p', action='store_true', help='Pack mode: add header to font file')
     parser.add_argument('--unpack', '-u', action='store_true', help='Unpack mode: extract font data')
     parser.add_argument('--dump', '-d', action='store_true', help='Dump mode: analyze header and verify checksums')
+    parser.add_argument('--compact', '-c', action='store_true',
+                        help='Compact mode: build an HZK2 font with only the characters of --charset, in Unicode order')
+    parser.add_argument('--charset', help='Character list (e.g. hz3500.txt) or gb2312_encode_*.c (for compact mode)')
     parser.add_argument('--input', '-i', required=True, help='Input file path')
     parser.add_argument('--output', '-o', help='Output file path (not required for dump mode)')
-    parser.add_argument('--width', '-W', type=int, help='Font width (for pack mode)')
-    parser.add_argument('--height', '-H', type=int, help='Font height (for pack mode)')
+    parser.add_argument('--width', '-W', type=int, help='Font width (for pack mode, or compact mode with a raw font)')
+    parser.add_argument('--height', '-H', type=int, help='Font height (for pack mode, or compact mode with a raw font)')
     
     args = parser.parse_args()
     
     # 检查模式参数
-    modes = [args.pack, args.unpack, args.dump]
+    modes = [args.pack, args.unpack, args.dump, args.compact]
     mode_count = sum(modes)
     
     if mode_count == 0:
-        print("Error: Must specify one of --pack, --unpack, or --dump")
+        print("Error: Must specify one of --pack, --unpack, --dump or --compact")
         sys.exit(1)
     elif mode_count > 1:
         print("Error: Cannot specify multiple modes at once")
@@ -397,6 +564,10 @@ def main():
         if not args.output:
             print("Error: --output is required for unpack mode")
             sys.exit(1)
+    elif args.compact:
+        if not args.output or not args.charset:
+            print("Error: --output and --charset are required for compact mode")
+            sys.exit(1)
     # dump mode doesn't need --output
     
     # 执行相应操作
@@ -404,6 +575,8 @@ def main():
         success = pack_hzk_file(args.input, args.output, args.width, args.height)
     elif args.unpack:
         success = unpack_hzk_file(args.input, args.output)
+    elif args.compact:
+        success = pack_compact_hzk_file(args.input, args.output, args.charset, args.width, args.height)
     else:  # dump
         success = dump_hzk_file(args.input)
     
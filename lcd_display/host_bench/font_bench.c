@@ -0,0 +1,123 @@
+/**
+ * @file font_bench.c
+ * @brief 在主机上测试内置压缩字体的压缩率和解码时间
+ *
+ * 每个压缩字体的所有字形都用 get_code_data_r 解码，与原字体逐字节比较，
+ * 再重复解码统计单个字形的平均时间（不使用字体的解码缓存，相当于每次都不命中），
+ * 输出的表格与 LCD_FONT_PACKER_README.md 中的结果对应。
+ * 用法见同目录的 Makefile。
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "lcd_fonts.h"
+
+/// 每种字体所有字形解码的轮数
+#define BENCH_ROUNDS 20000
+
+/// 解码缓冲区大小，内置字体最大的字形为 32x48，192字节
+#define GLYPH_BUF_SIZE 256
+
+typedef struct
+{
+    const char *name;
+    const lcd_font_t *raw;
+    const lcd_rle_font_t *rle;
+} font_case_t;
+
+static double now_sec(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+/**
+ * @brief 比较压缩字体和原字体的所有字形
+ *
+ * @return int 不同的字形数
+ */
+static int check_font(const font_case_t *c)
+{
+    const lcd_font_t *font = &c->rle->font;
+    uint8_t buf[GLYPH_BUF_SIZE];
+    int bad = 0;
+
+    for (uint32_t i = 0; i < c->rle->glyph_count; i++)
+    {
+        uint32_t ch = c->rle->first_char + i;
+        const uint8_t *expect = c->raw->get_code_data(c->raw, ch);
+        const uint8_t *got = font->get_code_data_r(font, ch, buf);
+        if (expect == NULL || got == NULL || memcmp(expect, got, font->code_size) != 0)
+        {
+            fprintf(stderr, "%s: glyph 0x%02x differs\n", c->name, (unsigned)ch);
+            bad++;
+        }
+    }
+
+    return bad;
+}
+
+/**
+ * @brief 统计单个字形的平均解码时间
+ *
+ * @return double 微秒
+ */
+static double bench_font(const font_case_t *c)
+{
+    const lcd_font_t *font = &c->rle->font;
+    uint8_t buf[GLYPH_BUF_SIZE];
+    volatile uint8_t sink = 0;
+
+    double start = now_sec();
+    for (int n = 0; n < BENCH_ROUNDS; n++)
+    {
+        for (uint32_t i = 0; i < c->rle->glyph_count; i++)
+        {
+            const uint8_t *code = font->get_code_data_r(font, c->rle->first_char + i, buf);
+            sink ^= code[0];
+        }
+    }
+    double elapsed = now_sec() - start;
+    (void)sink;
+
+    return elapsed * 1e6 / ((double)BENCH_ROUNDS * c->rle->glyph_count);
+}
+
+int main(void)
+{
+    const font_case_t cases[] = {
+        {"ascii_8x16",           LCD_FONT(ascii_8x16),           &g_lcd_rle_font_ascii_8x16_rle},
+        {"ascii_10x18",          LCD_FONT(ascii_10x18),          &g_lcd_rle_font_ascii_10x18_rle},
+        {"sun_ascii_12x22",      LCD_FONT(sun_ascii_12x22),      &g_lcd_rle_font_sun_ascii_12x22_rle},
+        {"ter_ascii_16x32",      LCD_FONT(ter_ascii_16x32),      &g_lcd_rle_font_ter_ascii_16x32_rle},
+        {"console_number_32x48", LCD_FONT(console_number_32x48), &g_lcd_rle_font_console_number_32x48_rle},
+        {"segment_number_32x48", LCD_FONT(segment_number_32x48), &g_lcd_rle_font_segment_number_32x48_rle},
+        {"segment_number_24x32", LCD_FONT(segment_number_24x32), &g_lcd_rle_font_segment_number_24x32_rle},
+    };
+
+    int bad = 0;
+    printf("| 字体 | 字符数 | 原始 | 压缩后 | 压缩率 | 解码时间 |\n");
+    printf("|------|-------|------|--------|-------|---------|\n");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        const font_case_t *c = &cases[i];
+        uint32_t count = c->rle->glyph_count;
+        uint32_t raw_size = count * c->rle->font.code_size;
+        // 压缩后大小包括偏移表
+        uint32_t rle_size = c->rle->font.data_size + count * sizeof(uint16_t);
+
+        bad += check_font(c);
+        printf("| %s | %u | %u | %u | %.1f%% | %.2f us |\n", c->name, (unsigned)count, (unsigned)raw_size,
+               (unsigned)rle_size, rle_size * 100.0 / raw_size, bench_font(c));
+    }
+
+    if (bad)
+    {
+        fprintf(stderr, "%d glyphs differ\n", bad);
+        return 1;
+    }
+
+    return 0;
+}
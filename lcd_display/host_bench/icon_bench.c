@@ -0,0 +1,216 @@
+/**
+ * @file icon_bench.c
+ * @brief 在主机上比较天气图标RAW和RLE格式的数据大小和绘制时间
+ *
+ * qweather_icons.h 中的图标为RLE格式，先把每个图标画到显存再读回，得到对应的RAW图片。
+ * 两种格式在同样的随机位置绘制，显存必须逐字节相同，再统计绘制一个图标的平均时间，
+ * 输出的结果与 LCD_IMG_PACKER_README.md 中的数据对应。
+ * 用法见同目录的 Makefile。
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "freertos/task.h"
+#include "lcd_display.h"
+#include "qweather_icons.h"
+
+/// 最多的图标数
+#define MAX_ICONS 128
+
+/// 每轮在随机位置把所有图标各画一次
+#define BENCH_ROUNDS 2000
+
+/// 随机位置的数量
+#define POSITION_COUNT 256
+
+TickType_t xTaskGetTickCount(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (TickType_t)(t.tv_sec * 1000 + t.tv_nsec / 1000000);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    (void)ticks;
+}
+
+static void null_init(const void *data)
+{
+    (void)data;
+}
+
+static void null_write(const void *data, const uint8_t *buf, uint16_t size)
+{
+    (void)data;
+    (void)buf;
+    (void)size;
+}
+
+static void null_set_page_address(const void *data, const uint16_t page, uint16_t offset)
+{
+    (void)data;
+    (void)page;
+    (void)offset;
+}
+
+/// 不输出的驱动，只测试写显存
+static const lcd_driver_ops_t s_null_driver = {
+    .data = NULL,
+    .init = null_init,
+    .reset = null_init,
+    .write_command = null_write,
+    .write_dram_data = null_write,
+};
+
+LCD_MODEL_DEFINE(bench_128x64, 128, 64, {0}, LCD_DRAM_MODE_DEFAULT, null_set_page_address);
+
+static const lcd_mono_img_t *s_rle_icons[MAX_ICONS];
+static lcd_mono_img_t s_raw_icons[MAX_ICONS];
+static int s_icon_count;
+
+static int s_pos_x[POSITION_COUNT];
+static int s_pos_y[POSITION_COUNT];
+
+static double now_sec(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+/**
+ * @brief 收集所有图标，RLE图标画到显存左上角再读回，得到RAW图片
+ *
+ * @return int 成功返回0
+ */
+static int load_icons(lcd_handle_t disp)
+{
+    for (int code = 0; code < 10000 && s_icon_count < MAX_ICONS; code++)
+    {
+        const lcd_mono_img_t *img = get_weather_icon(code);
+        if (img == NULL)
+        {
+            continue;
+        }
+
+        uint32_t size = LCD_SAVE_AREA_SIZE(img->width, img->height);
+        uint8_t *data = malloc(size);
+        lcd_saved_area_t area;
+        lcd_clear_area(disp, 0, 0, img->width, img->height);
+        if (data == NULL || lcd_display_mono_img(disp, 0, 0, img, false) < 0
+            || lcd_save_area(disp, 0, 0, img->width, img->height, data, size, &area) != 0)
+        {
+            fprintf(stderr, "%s: unable to convert\n", img->name);
+            return -1;
+        }
+
+        lcd_mono_img_t *raw = &s_raw_icons[s_icon_count];
+        raw->name = img->name;
+        raw->width = img->width;
+        raw->height = img->height;
+        raw->data_size = size;
+        raw->format = LCD_IMG_FORMAT_RAW;
+        raw->data = data;
+        s_rle_icons[s_icon_count++] = img;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief 在同样的位置分别绘制RAW和RLE图标，比较显存
+ *
+ * @return int 不同的次数
+ */
+static int check_icons(lcd_handle_t disp)
+{
+    static uint8_t expect[128 * 64 / 8];
+    uint32_t size;
+    int bad = 0;
+
+    for (int i = 0; i < s_icon_count; i++)
+    {
+        for (int p = 0; p < POSITION_COUNT; p++)
+        {
+            srand(p);
+            lcd_fill_area_random(disp, 0, 0, 128, 64);
+            lcd_display_mono_img(disp, s_pos_x[p], s_pos_y[p], &s_raw_icons[i], p & 1);
+            memcpy(expect, lcd_get_framebuffer(disp, NULL, NULL, &size), sizeof(expect));
+
+            srand(p);
+            lcd_fill_area_random(disp, 0, 0, 128, 64);
+            lcd_display_mono_img(disp, s_pos_x[p], s_pos_y[p], s_rle_icons[i], p & 1);
+            if (memcmp(expect, lcd_get_framebuffer(disp, NULL, NULL, &size), sizeof(expect)) != 0)
+            {
+                fprintf(stderr, "%s differs at (%d, %d)\n", s_rle_icons[i]->name, s_pos_x[p], s_pos_y[p]);
+                bad++;
+            }
+        }
+    }
+
+    return bad;
+}
+
+/**
+ * @brief 统计绘制一个图标的平均时间
+ *
+ * @param raw true 绘制RAW图标，false 绘制RLE图标
+ * @return double 微秒
+ */
+static double bench_icons(lcd_handle_t disp, bool raw)
+{
+    double start = now_sec();
+    for (int n = 0; n < BENCH_ROUNDS; n++)
+    {
+        for (int i = 0; i < s_icon_count; i++)
+        {
+            int p = (n * s_icon_count + i) % POSITION_COUNT;
+            lcd_display_mono_img(disp, s_pos_x[p], s_pos_y[p], raw ? &s_raw_icons[i] : s_rle_icons[i], false);
+        }
+    }
+    double elapsed = now_sec() - start;
+
+    return elapsed * 1e6 / ((double)BENCH_ROUNDS * s_icon_count);
+}
+
+int main(void)
+{
+    lcd_handle_t disp = lcd_display_create(&s_null_driver, LCD_MODEL(bench_128x64), 0, NULL, 0);
+    if (disp == NULL || load_icons(disp) != 0)
+    {
+        return 1;
+    }
+
+    // 图标完全可见的随机位置，包括不按字节对齐的X
+    srand(1);
+    for (int p = 0; p < POSITION_COUNT; p++)
+    {
+        s_pos_x[p] = rand() % (128 - 32 + 1);
+        s_pos_y[p] = rand() % (64 - 32 + 1);
+    }
+
+    uint32_t raw_size = 0, rle_size = 0;
+    for (int i = 0; i < s_icon_count; i++)
+    {
+        raw_size += s_raw_icons[i].data_size;
+        rle_size += s_rle_icons[i]->data_size;
+    }
+
+    int bad = check_icons(disp);
+
+    printf("%d icons\n", s_icon_count);
+    printf("RAW: %6u bytes, %.2f us/icon\n", (unsigned)raw_size, bench_icons(disp, true));
+    printf("RLE: %6u bytes, %.2f us/icon (%.1f%%)\n", (unsigned)rle_size, bench_icons(disp, false),
+           rle_size * 100.0 / raw_size);
+
+    if (bad)
+    {
+        fprintf(stderr, "%d placements differ\n", bad);
+        return 1;
+    }
+
+    return 0;
+}
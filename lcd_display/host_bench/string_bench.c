@@ -0,0 +1,172 @@
+/**
+ * @file string_bench.c
+ * @brief 在主机上测试 lcd_display_string 的ASCII快速路径
+ *
+ * 同一个源文件分别以 CONFIG_LCD_DISPLAY_ASCII_FAST_PATH=1/0 编译：
+ *   string_bench --bench       每种字体每秒显示的字符串数
+ *   string_bench --dump FILE   在各种位置（包括负坐标和超出屏幕）显示字符串，保存返回值和显存，
+ *                              两种编译的输出应该逐字节相同
+ * 用法见同目录的 Makefile。
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "freertos/task.h"
+#include "lcd_display.h"
+#include "lcd_fonts.h"
+
+/// 每种字体测试的次数
+#define BENCH_COUNT 200000
+
+TickType_t xTaskGetTickCount(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (TickType_t)(t.tv_sec * 1000 + t.tv_nsec / 1000000);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    (void)ticks;
+}
+
+static void null_init(const void *data)
+{
+    (void)data;
+}
+
+static void null_write(const void *data, const uint8_t *buf, uint16_t size)
+{
+    (void)data;
+    (void)buf;
+    (void)size;
+}
+
+static void null_set_page_address(const void *data, const uint16_t page, uint16_t offset)
+{
+    (void)data;
+    (void)page;
+    (void)offset;
+}
+
+/// 不输出的驱动，只测试写显存
+static const lcd_driver_ops_t s_null_driver = {
+    .data = NULL,
+    .init = null_init,
+    .reset = null_init,
+    .write_command = null_write,
+    .write_dram_data = null_write,
+};
+
+LCD_MODEL_DEFINE(bench_128x64, 128, 64, {0}, LCD_DRAM_MODE_DEFAULT, null_set_page_address);
+
+typedef struct
+{
+    const char *name;
+    const lcd_font_t *font;
+    const char *text;
+    int x;
+    int y;
+} bench_case_t;
+
+static double now_sec(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+static void run_bench(lcd_handle_t disp)
+{
+    const bench_case_t cases[] = {
+        {"ascii_8x8",   LCD_FONT(ascii_8x8),       "Temp: 23.5 C  OK", 0, 0},
+        {"ascii_8x16",  LCD_FONT(ascii_8x16),      "Temp: 23.5 C  OK", 3, 5},
+        {"ascii_10x18", LCD_FONT(ascii_10x18),     "12:34:56 Mon",     1, 20},
+        {"ter_16x32",   LCD_FONT(ter_ascii_16x32), "12:34:56",         0, 30},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        const bench_case_t *c = &cases[i];
+        double start = now_sec();
+        for (int n = 0; n < BENCH_COUNT; n++)
+        {
+            lcd_display_string(disp, c->x, c->y, c->text, c->font, NULL, n & 1);
+        }
+        double elapsed = now_sec() - start;
+
+        printf("%-12s %2d chars: %8.0f strings/s\n", c->name, (int)strlen(c->text), BENCH_COUNT / elapsed);
+    }
+}
+
+static int run_dump(lcd_handle_t disp, const char *path)
+{
+    const char *texts[] = {"Hello, World! 0123456789", "ABC", "~`!@#$%^&*()_+{}|"};
+    const lcd_font_t *fonts[] = {
+        LCD_FONT(ascii_8x8), LCD_FONT(ascii_8x16), LCD_FONT(ascii_10x18),
+        LCD_FONT(sun_ascii_12x22), LCD_FONT(ter_ascii_16x32),
+    };
+
+    FILE *f = fopen(path, "wb");
+    if (f == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+
+    srand(1);
+    int count = 0;
+    for (size_t a = 0; a < sizeof(fonts) / sizeof(fonts[0]); a++)
+    {
+        for (size_t b = 0; b < sizeof(texts) / sizeof(texts[0]); b++)
+        {
+            for (int x = -37; x < 130; x += 7)
+            {
+                for (int y = -33; y < 66; y += 11)
+                {
+                    for (int reverse = 0; reverse < 2; reverse++)
+                    {
+                        // 随机背景，检查没有写到字符以外的位
+                        lcd_fill_area_random(disp, 0, 0, 128, 64);
+                        int ret = lcd_display_string(disp, x, y, texts[b], fonts[a], NULL, reverse);
+
+                        uint32_t size;
+                        const uint8_t *fb = lcd_get_framebuffer(disp, NULL, NULL, &size);
+                        fwrite(&ret, sizeof(ret), 1, f);
+                        fwrite(fb, 1, size, f);
+                        count++;
+                    }
+                }
+            }
+        }
+    }
+
+    fclose(f);
+    printf("%d placements written to %s\n", count, path);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    lcd_handle_t disp = lcd_display_create(&s_null_driver, LCD_MODEL(bench_128x64), 0, NULL, 0);
+    if (disp == NULL)
+    {
+        return 1;
+    }
+
+    if (argc == 2 && strcmp(argv[1], "--bench") == 0)
+    {
+        run_bench(disp);
+        return 0;
+    }
+
+    if (argc == 3 && strcmp(argv[1], "--dump") == 0)
+    {
+        return run_dump(disp, argv[2]);
+    }
+
+    fprintf(stderr, "usage: %s --bench | --dump FILE\n", argv[0]);
+    return 2;
+}
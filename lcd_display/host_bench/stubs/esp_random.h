@@ -0,0 +1,5 @@
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+// 固定的伪随机序列，两次运行的输出可以逐字节比较
+static inline uint32_t esp_random(void) { return (uint32_t)rand(); }
@@ -0,0 +1,5 @@
+// 主机测试用的ESP-IDF头文件替代，只包含 lcd_display 和 lcd_font 用到的部分
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
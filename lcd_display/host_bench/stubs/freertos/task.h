@@ -0,0 +1,4 @@
+#pragma once
+#include "FreeRTOS.h"
+TickType_t xTaskGetTickCount(void);
+void vTaskDelay(TickType_t ticks);
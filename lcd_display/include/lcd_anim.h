@@ -36,44 +36,168 @@ extern "C" {
 typedef enum 
 {
     LCD_ANIM_TYPE_MONO_IMG = 0,  ///< 单色位图类型
+    LCD_ANIM_TYPE_MONO_DELTA,    ///< 单色差值类型，首帧为关键帧 lcd_mono_img_t，之后每帧为与前一帧的差值 lcd_anim_delta_t
     LCD_ANIM_TYPE_MAX,
 } lcd_anim_type_t;
 
+/**
+ * @brief 循环方式枚举
+ */
+typedef enum
+{
+    LCD_ANIM_LOOP_REPEAT = 0,    ///< 循环播放
+    LCD_ANIM_LOOP_ONCE,          ///< 只播放一次，停在最后一帧
+    LCD_ANIM_LOOP_PINGPONG,      ///< 往返播放，最后一帧之后倒序播放到首帧
+    LCD_ANIM_LOOP_MAX,
+} lcd_anim_loop_t;
+
 /**
  * @brief 动画帧结构体
  */
-struct lcd_anim_frame
+typedef struct
 {
     const void *data;              ///< 帧数据指针
-    struct lcd_anim_frame *next;   ///< 下一帧指针
-};
+    uint16_t duration;             ///< 本帧显示时间（毫秒），0表示使用动画的 frame_period
+} lcd_anim_frame_t;
 
 /**
  * @brief 动画对象结构体
+ * 
+ * 帧保存在数组中，按索引直接访问。用 LCD_MONO_ANIM_DEFINE 定义的动画帧数组在Flash中，
+ * 用 lcd_anim_init/lcd_anim_add_frame 创建的动画帧数组在堆中，按需扩容。
  */
 typedef struct
 {
     lcd_anim_type_t type;          ///< 动画类型
     uint16_t width;                ///< 动画宽度（像素）
     uint16_t height;               ///< 动画高度（像素）
-    uint16_t frame_period;         ///< 每帧显示时间（毫秒）
+    uint16_t frame_period;         ///< 默认每帧显示时间（毫秒）
     uint16_t frame_num;            ///< 帧总数
-    struct lcd_anim_frame head_frame; ///< 帧链表头节点
+    uint8_t loop;                  ///< 循环方式 lcd_anim_loop_t
+    uint16_t capacity;             ///< 堆中帧数组的容量，静态定义的动画为0
+    const lcd_anim_frame_t *frames; ///< 帧数组，为NULL时只有首帧 first_frame
+    lcd_anim_frame_t first_frame;  ///< 首帧，只有一帧时不需要分配帧数组
 } lcd_anim_t;
 
 /**
- * @brief 动图实例结构体（前向声明）
+ * @brief 差值帧，前一帧与本帧的异或差值，只保存变化部分的边界框
+ * 
+ * 显示时把 mask 异或到显存中，异或两次即恢复前一帧，所以往返播放倒序时再次异或同一差值即可
  */
-struct lcd_anim_instance;
+typedef struct
+{
+    uint16_t x;                    ///< 边界框在动画中的位置X
+    uint16_t y;                    ///< 边界框在动画中的位置Y
+    lcd_mono_img_t mask;           ///< 边界框内的异或差值，与前一帧相同时宽高为0
+} lcd_anim_delta_t;
 
 /**
- * @brief 动图调度器结构体
+ * @brief 定义一个差值帧，数据由 lcd_img_packer.py --anim-delta 生成
+ * 
+ * @param _format 差值的数据格式 LCD_IMG_FORMAT_RAW 或 LCD_IMG_FORMAT_RLE
  */
-struct lcd_anim_schedule
+#define LCD_ANIM_DELTA_DEFINE(_name, _x, _y, _width, _height, _format, ...) \
+static const uint8_t s_lcd_anim_delta_data_##_name[] = { __VA_ARGS__ }; \
+static const lcd_anim_delta_t s_lcd_anim_delta_##_name = { \
+    .x = _x, \
+    .y = _y, \
+    .mask = { \
+        .name = #_name, \
+        .width = _width, \
+        .height = _height, \
+        .data_size = sizeof(s_lcd_anim_delta_data_##_name), \
+        .format = _format, \
+        .data = s_lcd_anim_delta_data_##_name, \
+    }, \
+}
+
+/// 定义一个差值帧的帧项，_delta 为 LCD_ANIM_DELTA_DEFINE 的名称
+#define LCD_ANIM_DELTA_FRAME(_delta, _duration) { .data = &s_lcd_anim_delta_##_delta, .duration = (_duration) }
+
+/// 定义一帧，_img 为帧图片指针（如 LCD_IMG(name)），_duration 为本帧显示时间（毫秒），0表示使用默认时间
+#define LCD_ANIM_FRAME(_img, _duration) { .data = (_img), .duration = (_duration) }
+
+/**
+ * @brief 定义一个单色位图动画，帧数组和动画对象都在Flash中，不需要初始化和释放
+ * 
+ * 例如：
+ * LCD_MONO_ANIM_DEFINE(loading, 16, 16, 100, LCD_ANIM_LOOP_REPEAT,
+ *     LCD_ANIM_FRAME(LCD_IMG(loading_0), 0),
+ *     LCD_ANIM_FRAME(LCD_IMG(loading_1), 0),
+ *     LCD_ANIM_FRAME(LCD_IMG(loading_2), 300));
+ * 
+ * 所有帧的大小必须为 _width x _height
+ */
+#define LCD_MONO_ANIM_DEFINE(_name, _width, _height, _period, _loop, ...) \
+static const lcd_anim_frame_t s_lcd_anim_frames_##_name[] = { __VA_ARGS__ }; \
+const lcd_anim_t g_lcd_anim_##_name = { \
+    .type = LCD_ANIM_TYPE_MONO_IMG, \
+    .width = _width, \
+    .height = _height, \
+    .frame_period = _period, \
+    .frame_num = sizeof(s_lcd_anim_frames_##_name) / sizeof(lcd_anim_frame_t), \
+    .loop = _loop, \
+    .capacity = 0, \
+    .frames = s_lcd_anim_frames_##_name, \
+}
+
+/**
+ * @brief 定义一个差值动画，首帧为关键帧，之后为差值帧，数据由 lcd_img_packer.py --anim-delta 生成
+ * 
+ * 例如：
+ * LCD_MONO_DELTA_ANIM_DEFINE(spinner, 16, 16, 100, LCD_ANIM_LOOP_REPEAT,
+ *     LCD_ANIM_FRAME(LCD_IMG(spinner_0), 0),
+ *     LCD_ANIM_DELTA_FRAME(spinner_1, 0),
+ *     LCD_ANIM_DELTA_FRAME(spinner_2, 0));
+ */
+#define LCD_MONO_DELTA_ANIM_DEFINE(_name, _width, _height, _period, _loop, ...) \
+static const lcd_anim_frame_t s_lcd_anim_frames_##_name[] = { __VA_ARGS__ }; \
+const lcd_anim_t g_lcd_anim_##_name = { \
+    .type = LCD_ANIM_TYPE_MONO_DELTA, \
+    .width = _width, \
+    .height = _height, \
+    .frame_period = _period, \
+    .frame_num = sizeof(s_lcd_anim_frames_##_name) / sizeof(lcd_anim_frame_t), \
+    .loop = _loop, \
+    .capacity = 0, \
+    .frames = s_lcd_anim_frames_##_name, \
+}
+
+/// 声明一个动画
+#define LCD_ANIM_DECLARE(_name) \
+extern const lcd_anim_t g_lcd_anim_##_name
+
+/// 获取动画对象指针
+#define LCD_ANIM(_name) (&g_lcd_anim_##_name)
+
+/// 调度器内置的实例池大小，需要更多实例时用 lcd_anim_schedule_init_with_pool 指定外部实例池
+#ifndef CONFIG_LCD_ANIM_SCHEDULE_POOL_SIZE
+#define CONFIG_LCD_ANIM_SCHEDULE_POOL_SIZE 8
+#endif
+
+/// 按 (x, y, anim) 查找实例的哈希桶数量，必须为2的幂
+#ifndef CONFIG_LCD_ANIM_HASH_BUCKETS
+#define CONFIG_LCD_ANIM_HASH_BUCKETS 16
+#endif
+
+/**
+ * @brief 动图实例结构体，由调度器的实例池分配，不要直接访问成员
+ */
+struct lcd_anim_instance
 {
-    uint32_t id;                         ///< 调度器标识（如页面ID）
-    lcd_handle_t disp;                   ///< LCD显示句柄
-    struct lcd_anim_instance *head;      ///< 动图实例链表头
+    struct lcd_anim_schedule *schedule;  ///< 所属调度器
+    uint16_t x;                          ///< 显示位置X坐标
+    uint16_t y;                          ///< 显示位置Y坐标
+    bool reverse;                        ///< 是否反向显示（黑底白字）
+    uint16_t frame_index;                ///< 当前帧索引
+    int8_t step;                         ///< 往返播放时的方向，1或-1
+    bool finished;                       ///< 只播放一次的动画已经播放完成
+    bool synced;                         ///< 显存中是否为 shown_index 帧的内容，差值帧在此基础上异或
+    uint16_t shown_index;                ///< 最近显示的帧索引
+    sys_tick_t next_frame_tick;          ///< 下次帧刷新时间（0表示需要立即显示）
+    const lcd_anim_t *anim;              ///< 动画对象指针，为NULL时实例空闲
+    struct lcd_anim_instance *next;      ///< 下一个实例，按下次帧刷新时间排序；空闲时为空闲链表
+    struct lcd_anim_instance *hash_next; ///< 同一哈希桶中的下一个实例
 };
 
 /**
@@ -81,6 +205,21 @@ struct lcd_anim_schedule
  */
 typedef struct lcd_anim_instance lcd_anim_instance_t;
 
+/**
+ * @brief 动图调度器结构体
+ */
+struct lcd_anim_schedule
+{
+    uint32_t id;                         ///< 调度器标识（如页面ID）
+    lcd_handle_t disp;                   ///< LCD显示句柄
+    struct lcd_anim_instance *head;      ///< 动图实例链表头，按下次帧刷新时间排序
+    struct lcd_anim_instance *free_list; ///< 空闲实例链表
+    struct lcd_anim_instance *pool;      ///< 实例池，默认为内置实例池 slots
+    uint16_t pool_size;                  ///< 实例池大小
+    struct lcd_anim_instance *buckets[CONFIG_LCD_ANIM_HASH_BUCKETS];    ///< 按 (x, y, anim) 的哈希桶
+    struct lcd_anim_instance slots[CONFIG_LCD_ANIM_SCHEDULE_POOL_SIZE]; ///< 内置实例池
+};
+
 /**
  * @brief 动图句柄类型定义（用于返回值）
  */
@@ -97,7 +236,7 @@ typedef struct lcd_anim_schedule lcd_anim_schedule_t;
  * @param anim 动画对象指针
  * @param type 动画类型
  * @param period 每帧显示时间（毫秒）
- * @param first_frame 首帧数据指针（对于单色位图类型，应传入 lcd_mono_img_t*）
+ * @param first_frame 首帧数据指针（对于单色位图和差值类型，应传入 lcd_mono_img_t*）
  * @return int 成功返回0，失败返回-1
  */
 int lcd_anim_init(lcd_anim_t *anim, lcd_anim_type_t type, uint16_t period, const void *first_frame);
@@ -106,11 +245,30 @@ int lcd_anim_init(lcd_anim_t *anim, lcd_anim_type_t type, uint16_t period, const
  * @brief 向动画对象添加一帧
  * 
  * @param anim 动画对象指针
- * @param frame 帧数据指针（对于单色位图类型，应传入 lcd_mono_img_t*）
+ * @param frame 帧数据指针（对于单色位图类型，应传入 lcd_mono_img_t*；对于差值类型，应传入 lcd_anim_delta_t*）
  * @return int 成功返回0，失败返回-1
  */
 int lcd_anim_add_frame(lcd_anim_t *anim, const void *frame);
 
+/**
+ * @brief 向动画对象添加一帧，并指定本帧的显示时间
+ * 
+ * @param anim 动画对象指针
+ * @param frame 帧数据指针（对于单色位图类型，应传入 lcd_mono_img_t*；对于差值类型，应传入 lcd_anim_delta_t*）
+ * @param duration 本帧显示时间（毫秒），0表示使用动画的 frame_period
+ * @return int 成功返回0，失败返回-1
+ */
+int lcd_anim_add_frame_with_duration(lcd_anim_t *anim, const void *frame, uint16_t duration);
+
+/**
+ * @brief 设置动画的循环方式，默认为 LCD_ANIM_LOOP_REPEAT
+ * 
+ * @param anim 动画对象指针
+ * @param loop 循环方式
+ * @return int 成功返回0，失败返回-1
+ */
+int lcd_anim_set_loop(lcd_anim_t *anim, lcd_anim_loop_t loop);
+
 /**
  * @brief 释放动画对象占用的内存
  * 
@@ -121,25 +279,42 @@ void lcd_anim_release(lcd_anim_t *anim);
 /**
  * @brief 播放动图（如果实例不存在则自动创建）
  * 
- * 在指定调度器的指定位置播放动画。如果该位置不存在动画实例，则自动创建并显示首帧；
- * 如果已存在实例，则检查是否需要切换到下一帧并更新显示。
+ * 在指定调度器的指定位置播放动画。如果该位置不存在动画实例，则从实例池分配并显示首帧；
+ * 如果已存在实例，则检查是否需要切换到下一帧并更新显示。实例按 (x, y, anim) 哈希查找，不使用堆内存。
  * 
  * @param anim_schedule 动图调度器指针
  * @param x 显示位置X坐标
  * @param y 显示位置Y坐标
  * @param anim 动画对象指针
  * @param reverse 是否反向显示（黑底白字）
- * @return lcd_anim_handle_t 动画实例句柄，失败返回NULL
+ * @return lcd_anim_handle_t 动画实例句柄，失败或实例池已满返回NULL
  */
 lcd_anim_handle_t lcd_anim_play(lcd_anim_schedule_t *anim_schedule, uint16_t x, uint16_t y, const lcd_anim_t *anim, bool reverse);
 
 /**
- * @brief 销毁动图实例
+ * @brief 销毁动图实例，实例归还到调度器的实例池
  * 
  * @param anim_instance 动图实例句柄
  */
 void lcd_anim_destroy(lcd_anim_handle_t anim_instance);
 
+/**
+ * @brief 动画区域被其他内容覆盖后调用，下一次 lcd_anim_play 立即重绘当前帧
+ * 
+ * 差值动画的差值帧是在显存中前一帧的基础上异或，显存中前一帧被覆盖后必须先重绘
+ * 
+ * @param anim_instance 动图实例句柄
+ */
+void lcd_anim_invalidate(lcd_anim_handle_t anim_instance);
+
+/**
+ * @brief 动图实例是否已经播放完成，只有 LCD_ANIM_LOOP_ONCE 的动画会播放完成
+ * 
+ * @param anim_instance 动图实例句柄
+ * @return bool 播放完成返回true
+ */
+bool lcd_anim_is_finished(lcd_anim_handle_t anim_instance);
+
 /**
  * @brief 执行动图调度一次
  * 
@@ -151,7 +326,31 @@ void lcd_anim_destroy(lcd_anim_handle_t anim_instance);
 bool lcd_anim_schedule(lcd_anim_schedule_t *anim_schedule);
 
 /**
- * @brief 初始化动图调度器
+ * @brief 获取下一帧的刷新时间，调用者可以一直休眠到这个时间再调用 lcd_anim_step
+ * 
+ * 调度器中的实例按下次帧刷新时间排序，该函数只检查第一个实例。
+ * 
+ * @param anim_schedule 动图调度器指针
+ * @param deadline 输出下一帧的刷新时间（uptime），已经到期时不晚于当前时间
+ * @return bool 没有需要刷新的动图（没有实例或全部播放完成）返回false
+ */
+bool lcd_anim_next_deadline(const lcd_anim_schedule_t *anim_schedule, sys_tick_t *deadline);
+
+/**
+ * @brief 显示所有到期实例的下一帧，并返回重绘的区域
+ * 
+ * 与 lcd_anim_play 不同，不需要重绘整个页面，调用后用 lcd_refresh_area 只刷新返回的区域，差值动画只返回变化部分的边界框。
+ * 每个实例在一次调用中最多显示一帧，超过 max_changed 的到期实例留到下一次调用。
+ * 
+ * @param anim_schedule 动图调度器指针
+ * @param changed 输出重绘的区域
+ * @param max_changed changed 的最大数量
+ * @return int 重绘的区域数量，参数错误返回-1
+ */
+int lcd_anim_step(lcd_anim_schedule_t *anim_schedule, lcd_rect_t *changed, int max_changed);
+
+/**
+ * @brief 初始化动图调度器，使用内置的 CONFIG_LCD_ANIM_SCHEDULE_POOL_SIZE 个实例
  * 
  * @param anim_schedule 动图调度器指针
  * @param id 调度器标识（如页面ID）
@@ -161,7 +360,24 @@ bool lcd_anim_schedule(lcd_anim_schedule_t *anim_schedule);
 int lcd_anim_schedule_init(lcd_anim_schedule_t *anim_schedule, uint32_t id, lcd_handle_t disp);
 
 /**
- * @brief 释放调度器中的所有动图实例
+ * @brief 初始化动图调度器，使用外部实例池，用于动图较多的页面
+ * 
+ * 例如：
+ * static lcd_anim_instance_t s_main_page_anims[32];
+ * lcd_anim_schedule_init_with_pool(&schedule, PAGE_MAIN, disp, s_main_page_anims, 32);
+ * 
+ * @param anim_schedule 动图调度器指针
+ * @param id 调度器标识（如页面ID）
+ * @param disp LCD显示句柄
+ * @param pool 实例池，调度器使用期间必须有效
+ * @param pool_size 实例池大小
+ * @return int 成功返回0，失败返回-1
+ */
+int lcd_anim_schedule_init_with_pool(lcd_anim_schedule_t *anim_schedule, uint32_t id, lcd_handle_t disp,
+    lcd_anim_instance_t *pool, uint16_t pool_size);
+
+/**
+ * @brief 释放调度器中的所有动图实例，全部归还到实例池
  * 
  * @param anim_schedule 动图调度器指针
  */
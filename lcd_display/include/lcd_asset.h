@@ -0,0 +1,148 @@
+#ifndef __LCD_ASSET_H__
+#define __LCD_ASSET_H__
+
+/**
+ * @file lcd_asset.h
+ * @author LiuChuansen (179712066@qq.com)
+ * @brief 图片资源包，存放在独立的数据分区中，通过内存映射直接访问
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @note 资源包由 lcd_img_packer.py --pack-assets 生成，文件结构：
+ *   [64字节 lcd_asset_header_t]
+ *   [按id升序排列的 lcd_asset_record_t 索引表]
+ *   [按名称升序排列的记录序号表 uint16_t]
+ *   [名称字符串表，以'\0'结尾]
+ *   [图片数据，每个图片4字节对齐]
+ *   打开后通过 esp_partition_mmap 映射整个资源包，查找返回的图片直接指向映射后的Flash，不复制数据。
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "lcd_img.h"
+#include "esp_partition.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/// 资源包分区的子类型
+#ifndef CONFIG_LCD_ASSET_PARTITION_SUBTYPE
+#define CONFIG_LCD_ASSET_PARTITION_SUBTYPE 0x41
+#endif
+
+/// 资源包魔数 "AST1"
+#define LCD_ASSET_MAGIC 0x31545341
+
+/**
+ * @brief 资源包头信息, 共64字节
+ *
+ */
+typedef struct
+{
+    uint32_t magic;              // AST1
+    uint32_t image_count;        // 图片数量
+    uint32_t index_offset;       // 按id排序的索引表偏移
+    uint32_t name_index_offset;  // 按名称排序的序号表偏移
+    uint32_t string_offset;      // 名称字符串表偏移
+    uint32_t string_size;        // 名称字符串表大小
+    uint32_t data_offset;        // 图片数据偏移
+    uint32_t data_size;          // 图片数据大小
+    uint32_t index_checksum;     // CRC32, 从index_offset到data_offset的全部内容
+    uint32_t data_checksum;      // CRC32, 图片数据
+    uint32_t reserved[5];
+    uint32_t header_checksum;    // CRC32
+}lcd_asset_header_t;
+
+/**
+ * @brief 资源包中的图片记录, 共20字节
+ *
+ */
+typedef struct
+{
+    uint32_t id;                 // 图片ID, 在资源包内唯一
+    uint32_t name_offset;        // 名称在字符串表中的偏移
+    uint16_t width;
+    uint16_t height;
+    uint8_t format;              // lcd_img_format_t
+    uint8_t reserved;
+    uint16_t data_size;          // 图片数据大小
+    uint32_t data_offset;        // 图片数据在数据区中的偏移
+}lcd_asset_record_t;
+
+/**
+ * @brief 资源包对象
+ *
+ */
+typedef struct
+{
+    /// 所在分区
+    const esp_partition_t *partition;
+    /// 映射句柄
+    esp_partition_mmap_handle_t mmap_handle;
+    /// 头信息，指向映射后的Flash
+    const lcd_asset_header_t *header;
+    /// 按id排序的索引表
+    const lcd_asset_record_t *records;
+    /// 按名称排序的序号表
+    const uint16_t *name_index;
+    /// 名称字符串表
+    const char *strings;
+    /// 图片数据
+    const uint8_t *data;
+    /// 是否已打开
+    bool valid;
+}lcd_asset_pack_t;
+
+/**
+ * @brief 打开资源包
+ *
+ * @param pack 资源包对象
+ * @param partition_label 分区名称，分区类型为data，子类型为 CONFIG_LCD_ASSET_PARTITION_SUBTYPE
+ * @param verify_data 是否校验图片数据的CRC，资源包较大时会增加打开时间
+ * @return int 成功返回0，失败返回-1
+ */
+int lcd_asset_pack_open(lcd_asset_pack_t *pack, const char *partition_label, bool verify_data);
+
+/**
+ * @brief 关闭资源包，之前查找得到的图片不能再使用
+ *
+ * @param pack 资源包对象
+ */
+void lcd_asset_pack_close(lcd_asset_pack_t *pack);
+
+/**
+ * @brief 获取资源包中的图片数量
+ *
+ * @param pack 资源包对象
+ * @return uint32_t 图片数量，未打开时返回0
+ */
+uint32_t lcd_asset_pack_count(const lcd_asset_pack_t *pack);
+
+/**
+ * @brief 按ID查找图片，二分查找
+ *
+ * @param pack 资源包对象
+ * @param id 图片ID
+ * @param img 输出图片对象，名称和数据指向映射后的Flash
+ * @return int 成功返回0，未找到返回-1
+ */
+int lcd_asset_find_by_id(const lcd_asset_pack_t *pack, uint32_t id, lcd_mono_img_t *img);
+
+/**
+ * @brief 按名称查找图片，二分查找
+ *
+ * @param pack 资源包对象
+ * @param name 图片名称
+ * @param img 输出图片对象，名称和数据指向映射后的Flash
+ * @return int 成功返回0，未找到返回-1
+ */
+int lcd_asset_find_by_name(const lcd_asset_pack_t *pack, const char *name, lcd_mono_img_t *img);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __LCD_ASSET_H__
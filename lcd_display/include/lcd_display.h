@@ -33,6 +33,42 @@ typedef enum {
 /// @brief lcd显示句柄
 typedef void * lcd_handle_t;
 
+/// 灰度图片抖动方式
+typedef enum {
+    /// 直接按亮度50%阈值二值化
+    LCD_DITHER_THRESHOLD = 0,
+    /// 8x8 Bayer有序抖动
+    LCD_DITHER_BAYER = 1,
+    /// Floyd-Steinberg误差扩散
+    LCD_DITHER_FLOYD_STEINBERG = 2,
+} lcd_dither_mode_t;
+
+/// 矩形区域，宽或高为0时表示空区域
+typedef struct {
+    int16_t x;
+    int16_t y;
+    int16_t width;
+    int16_t height;
+} lcd_rect_t;
+
+/// 保存一个宽width高height的区域需要的缓存大小
+#define LCD_SAVE_AREA_SIZE(width, height) ((((width) + 7) / 8) * (height))
+
+/// lcd_save_area 保存的区域，数据每行 (width + 7) / 8 字节，高位在左
+typedef struct {
+    /// 裁剪到屏幕范围后的区域，完全在屏幕外时宽高为0
+    int16_t x;
+    int16_t y;
+    int16_t width;
+    int16_t height;
+    /// 保存的数据
+    uint8_t *data;
+    /// 数据大小
+    uint32_t size;
+    /// 缓存从显示的缓存池中分配时指向该块的占用标志，否则为NULL
+    bool *pool_used;
+} lcd_saved_area_t;
+
 
 
 
@@ -43,7 +79,8 @@ typedef void * lcd_handle_t;
  * @param model 指向显示模型
  * @param rotation 旋转角度
  * @param static_mem 静态内存，如果为空，使用动态分配的内存
- * @param mem_size 静态内存大小
+ * @param mem_size 静态内存大小，显示句柄加显存的大小；启用 CONFIG_LCD_SAVE_AREA_POOL_SLOTS 时
+ *   需要再增加 CONFIG_LCD_SAVE_AREA_POOL_SLOTS * (CONFIG_LCD_SAVE_AREA_POOL_SLOT_SIZE + 1) 字节，按4字节向上对齐
  * @return void* 
  * 返回一个OLED的HANDLE
  */
@@ -63,6 +100,21 @@ void lcd_display_destory(lcd_handle_t disp);
  */
 void lcd_refresh(lcd_handle_t disp);
 
+/**
+ * @brief 只刷新屏幕的指定区域，用于动画等小区域更新
+ * 
+ * 页模式（LCD_DRAM_MODE_VERTICAL）的屏只写入覆盖区域的页和列，一个32x32的区域只需写入4页，每页32字节；
+ * 自定义刷新的模型退化为整屏刷新。
+ * 
+ * @param disp 
+ * @param x 区域左上角X坐标
+ * @param y 区域左上角Y坐标
+ * @param width 区域宽度
+ * @param height 区域高度
+ * @return int 成功返回0，失败返回-1
+ */
+int lcd_refresh_area(lcd_handle_t disp, int x, int y, int width, int height);
+
 /**
  * @brief 启动显示器
  * 
@@ -87,13 +139,55 @@ int lcd_display_on(lcd_handle_t disp);
 int lcd_display_off(lcd_handle_t disp);
 
 /**
- * @brief 填充指定的数据 
- * 
- * @param disp 
- * @param data 
+ * @brief 填充指定的数据，填充整个显存，不受裁剪区域限制
+ *
+ * @param disp
+ * @param data
  */
 void lcd_fill(lcd_handle_t disp, uint8_t data);
 
+/**
+ * @brief 获取显存，用于截屏、远程镜像等只读访问
+ *
+ * @param disp
+ * @param width 输出宽度（旋转后），可以为NULL
+ * @param height 输出高度，可以为NULL
+ * @param size 输出显存大小，可以为NULL
+ * @return const uint8_t* 显存，像素(x, y)在位偏移 y * width + x 处，高位在左，失败返回NULL
+ */
+const uint8_t *lcd_get_framebuffer(lcd_handle_t disp, uint16_t *width, uint16_t *height, uint32_t *size);
+
+/**
+ * @brief 压入一个裁剪区域，之后的文字、图片、线条和填充都只绘制在这个区域内，直到弹出
+ *
+ * @param disp
+ * @param x 左上角X
+ * @param y 左上角Y
+ * @param width 宽度
+ * @param height 高度
+ * @return int 成功返回0，栈满返回-1
+ *
+ * @note 新的裁剪区域为它与当前裁剪区域的交集，嵌套的窗口/列表行不会画到外层区域之外；
+ *   栈深度为 CONFIG_LCD_CLIP_STACK_DEPTH，默认4层。
+ */
+int lcd_push_clip(lcd_handle_t disp, int x, int y, int width, int height);
+
+/**
+ * @brief 弹出最近压入的裁剪区域，恢复之前的区域
+ *
+ * @param disp
+ * @return int 成功返回0，栈空返回-1
+ */
+int lcd_pop_clip(lcd_handle_t disp);
+
+/**
+ * @brief 获取当前的裁剪区域，没有压入时为整个屏幕
+ *
+ * @param disp
+ * @param rect 输出裁剪区域
+ */
+void lcd_get_clip(lcd_handle_t disp, lcd_rect_t *rect);
+
 /**
 * @brief 设置默认字体
 * 
@@ -103,8 +197,31 @@ void lcd_fill(lcd_handle_t disp, uint8_t data);
 */
 void lcd_set_default_fonts(lcd_handle_t disp, const lcd_font_t *ascii_font, const lcd_font_t *unicode_font);
 
+/// 可重入获取字形数据时栈上缓冲区的大小，字形大于该值的字体使用 get_code_data
+#ifndef CONFIG_LCD_DISPLAY_GLYPH_BUF_SIZE
+#define CONFIG_LCD_DISPLAY_GLYPH_BUF_SIZE 128
+#endif
+
+/**
+ * @brief 获取字符的字形数据，字体支持时使用可重入的 get_code_data_r
+ * 
+ * @param font 字体
+ * @param ch 字符
+ * @param buf 调用者的缓冲区，CONFIG_LCD_DISPLAY_GLYPH_BUF_SIZE 字节
+ * @return const uint8_t* 字形数据，在buf有效期间不会被其他任务修改
+ */
+static inline const uint8_t *lcd_get_font_code(const lcd_font_t *font, uint32_t ch, uint8_t *buf)
+{
+    if (font->get_code_data_r && font->code_size <= CONFIG_LCD_DISPLAY_GLYPH_BUF_SIZE)
+    {
+        return font->get_code_data_r(font, ch, buf);
+    }
+
+    return font->get_code_data(font, ch);
+}
+
 /**
- * @brief 显示单个字符，支持部分显示
+ * @brief 显示单个字符，支持部分显示。比例字体只写入字形边界框内的像素
  * 
  * @param disp LCD显示句柄
  * @param x X坐标
@@ -113,9 +230,28 @@ void lcd_set_default_fonts(lcd_handle_t disp, const lcd_font_t *ascii_font, cons
  * @param font 字体
  * @param reverse 是否反向显示(黑底白字)
  * @return int 返回实际显示的像素宽度，如果完全不可见则返回0
+ * @note 字体提供 get_code_data_r 时字形复制到栈上的缓冲区，不同任务可以同时在各自的显示上使用同一个汉字库或压缩字体
  */
 int lcd_display_char(lcd_handle_t disp, int x, int y, int ch, const lcd_font_t *font, bool reverse);
 
+/// 放大显示支持的最大倍数
+#define LCD_BLIT_MAX_SCALE 4
+
+/**
+ * @brief 放大/旋转显示单个字符，支持部分显示，可以用小字体代替大字体
+ * 
+ * @param disp LCD显示句柄
+ * @param x X坐标，旋转放大后字符的左上角
+ * @param y Y坐标
+ * @param ch 要显示的字符
+ * @param font 字体
+ * @param scale 放大倍数 1-LCD_BLIT_MAX_SCALE
+ * @param rotation 顺时针旋转角度
+ * @param reverse 是否反向显示(黑底白字)
+ * @return int 返回实际显示的像素宽度，如果完全不可见则返回0
+ */
+int lcd_display_char_ex(lcd_handle_t disp, int x, int y, int ch, const lcd_font_t *font, uint8_t scale, lcd_rotation_t rotation, bool reverse);
+
 /**
  * @brief 显示一串文本，支持部分显示。如果字符超出显示区域，会显示能显示的部分
  * 
@@ -131,6 +267,19 @@ int lcd_display_char(lcd_handle_t disp, int x, int y, int ch, const lcd_font_t *
  */
 int lcd_display_string(lcd_handle_t disp, int x, int y, const char *text, const lcd_font_t *ascii_font, const lcd_font_t *unicode_font, bool reverse);
 
+/**
+ * @brief 预取一串文本中的非ASCII字符，字体合并Flash读取后放入缓存
+ * 
+ * lcd_display_string 显示前会自动调用，最多预取 CONFIG_LCD_DISPLAY_STRING_PREFETCH 个字符。
+ * 多行文本可以先对整段文本调用一次，减少读取次数。
+ * 
+ * @param disp 
+ * @param text UTF-8编码的文本
+ * @param unicode_font UNICODE 字体，为NULL时使用默认字体
+ * @return int 预取的字符数量，字体不支持预取时返回0
+ */
+int lcd_prefetch_string(lcd_handle_t disp, const char *text, const lcd_font_t *unicode_font);
+
 
 /**
  * @brief 显示一串文本，支持部分显示。如果字符超出显示区域，会显示能显示的部分
@@ -176,6 +325,51 @@ static inline int lcd_display_ascii_string(lcd_handle_t disp, int x, int y, cons
  */
 int lcd_display_mono_img(lcd_handle_t disp, int x, int y, const lcd_mono_img_t *img, bool reverse);
 
+/**
+ * @brief 把单色位图异或到显存，图片中点亮的像素翻转显存中对应的像素，支持部分显示
+ * 
+ * 异或两次即恢复原内容，与正向/反向显示无关，用于动画的差值帧
+ * 
+ * @param disp 显示对象 
+ * @param x 显示位置X
+ * @param y 显示位置Y
+ * @param img 位图对象，原始或游程编码格式
+ * 
+ * @return int 返回实际显示的像素宽度，如果完全不可见则返回0
+ */
+int lcd_xor_mono_img(lcd_handle_t disp, int x, int y, const lcd_mono_img_t *img);
+
+/**
+ * @brief 放大/旋转显示单色位图，支持部分显示和游程编码格式
+ * 
+ * @param disp 显示对象 
+ * @param x 显示位置X，旋转放大后图片的左上角
+ * @param y 显示位置Y
+ * @param img 位图对象
+ * @param scale 放大倍数 1-LCD_BLIT_MAX_SCALE
+ * @param rotation 顺时针旋转角度
+ * @param reverse 是否反向显示(黑底白字)
+ * 
+ * @return int 返回实际显示的像素宽度，如果完全不可见则返回0
+ */
+int lcd_display_mono_img_ex(lcd_handle_t disp, int x, int y, const lcd_mono_img_t *img, uint8_t scale, lcd_rotation_t rotation, bool reverse);
+
+/**
+ * @brief 显示8位灰度图片，逐行抖动为单色写入显存，支持部分显示
+ * 
+ * @param disp 显示对象
+ * @param x 显示位置X
+ * @param y 显示位置Y
+ * @param img 灰度图片，数据可以在RAM或映射后的Flash中
+ * @param mode 抖动方式
+ * @param reverse 是否反向显示(黑底白字)
+ * 
+ * @return int 返回实际显示的像素宽度，如果完全不可见则返回0
+ * 
+ * @note Floyd-Steinberg方式使用一行误差缓存，宽度不超过 CONFIG_LCD_DITHER_STACK_WIDTH 时在栈上分配，否则动态分配
+ */
+int lcd_display_gray_img(lcd_handle_t disp, int x, int y, const lcd_gray_img_t *img, lcd_dither_mode_t mode, bool reverse);
+
 /**
  * @brief 清除指定区域的显示内容
  * 
@@ -270,6 +464,41 @@ int lcd_draw_rectangle(lcd_handle_t disp, int start_x, int start_y, int end_x, i
  */
 int lcd_draw_rectangle1(lcd_handle_t disp, int start_x, int start_y, int x_len, int y_len, int width, bool reverse);
 
+/**
+ * @brief 保存显存中一个矩形区域的内容，用于弹出框、光标和移动的图标恢复背景
+ *
+ * @param disp LCD显示句柄
+ * @param x 左上角X
+ * @param y 左上角Y
+ * @param width 宽度
+ * @param height 高度
+ * @param buf 缓存，大小至少为 LCD_SAVE_AREA_SIZE(width, height)；为NULL时从缓存池中分配，
+ *   每个显示的缓存池有 CONFIG_LCD_SAVE_AREA_POOL_SLOTS 块，每块 CONFIG_LCD_SAVE_AREA_POOL_SLOT_SIZE 字节，
+ *   缓存池默认不启用，此时必须提供buf
+ * @param buf_size 缓存大小
+ * @param area 输出保存的区域，从缓存池分配时用完后调用 lcd_release_area 释放
+ * @return int 成功返回0，缓存不足返回-1
+ *
+ * @note 区域按屏幕范围裁剪，不受裁剪区域影响
+ */
+int lcd_save_area(lcd_handle_t disp, int x, int y, int width, int height, uint8_t *buf, uint32_t buf_size, lcd_saved_area_t *area);
+
+/**
+ * @brief 把 lcd_save_area 保存的内容写回显存原来的位置
+ *
+ * @param disp LCD显示句柄
+ * @param area 保存的区域
+ * @return int 成功返回0，失败返回-1
+ */
+int lcd_restore_area(lcd_handle_t disp, const lcd_saved_area_t *area);
+
+/**
+ * @brief 释放保存区域，缓存从缓存池分配时归还缓存池
+ *
+ * @param area 保存的区域
+ */
+void lcd_release_area(lcd_saved_area_t *area);
+
 #ifdef __cplusplus
 }
 #endif
@@ -8,12 +8,22 @@ extern "C" {
 #include <stdint.h>
 
 
+/// 图片数据格式
+typedef enum {
+    /// 原始位图，按行存储，每行 (width + 7) / 8 字节，高位在左
+    LCD_IMG_FORMAT_RAW = 0,
+    /// 像素游程编码，见 LCD_MONO_RLE_IMG_DEFINE
+    LCD_IMG_FORMAT_RLE = 1,
+}lcd_img_format_t;
+
 typedef struct 
 {
     const char *name;
     uint16_t width;
     uint16_t height;
     uint16_t data_size;
+    /// 数据格式 lcd_img_format_t, 默认为 LCD_IMG_FORMAT_RAW
+    uint8_t format;
     const uint8_t *data;
 }lcd_mono_img_t;
 
@@ -22,6 +32,52 @@ typedef struct
 #define LCD_MONO_IMG_DEFINE(_name, _width, _height, ...) \
 static const uint8_t s_lcd_img_data_##_name[] = { __VA_ARGS__ }; \
 const lcd_mono_img_t g_lcd_img_##_name = { \
+    .name = #_name, \
+    .width = _width, \
+    .height = _height, \
+    .data_size = sizeof(s_lcd_img_data_##_name), \
+    .format = LCD_IMG_FORMAT_RAW, \
+    .data = s_lcd_img_data_##_name, \
+}
+
+/**
+ * @brief 定义一个游程编码的单色图片, 数据由 lcd_img_packer.py 生成
+ * 
+ * @note 编码格式：
+ *   像素按行从左到右、从上到下排列成一个连续的序列（行尾没有填充位），
+ *   序列被切分为交替的游程，第一个游程为 0（不点亮），之后 1、0、1... 交替，游程长度可以为0。
+ *   每个游程长度用若干个4位码表示，码值15表示长度加15并继续读取下一个码，码值0-14表示长度加上该值后游程结束。
+ *   4位码按字节高位在前存放，最后不足一个字节时用0填充。
+ */
+#define LCD_MONO_RLE_IMG_DEFINE(_name, _width, _height, ...) \
+static const uint8_t s_lcd_img_data_##_name[] = { __VA_ARGS__ }; \
+const lcd_mono_img_t g_lcd_img_##_name = { \
+    .name = #_name, \
+    .width = _width, \
+    .height = _height, \
+    .data_size = sizeof(s_lcd_img_data_##_name), \
+    .format = LCD_IMG_FORMAT_RLE, \
+    .data = s_lcd_img_data_##_name, \
+}
+
+/**
+ * @brief 8位灰度图片，每个像素一个字节，按行存储，0为不点亮，255为完全点亮
+ * 
+ * @note 数据可以在RAM中，也可以是映射后的Flash，显示时逐行抖动处理，不需要整图缓存
+ */
+typedef struct 
+{
+    const char *name;
+    uint16_t width;
+    uint16_t height;
+    uint32_t data_size;
+    const uint8_t *data;
+}lcd_gray_img_t;
+
+/// 定义一个灰度图片
+#define LCD_GRAY_IMG_DEFINE(_name, _width, _height, ...) \
+static const uint8_t s_lcd_img_data_##_name[] = { __VA_ARGS__ }; \
+const lcd_gray_img_t g_lcd_img_##_name = { \
     .name = #_name, \
     .width = _width, \
     .height = _height, \
@@ -33,6 +89,10 @@ const lcd_mono_img_t g_lcd_img_##_name = { \
 #define LCD_MONO_IMG_DECLARE(_name) \
 extern const lcd_mono_img_t g_lcd_img_##_name
 
+/// 声明一个灰度图片
+#define LCD_GRAY_IMG_DECLARE(_name) \
+extern const lcd_gray_img_t g_lcd_img_##_name
+
 /// 引用一个图片
 #define LCD_IMG(_name) &g_lcd_img_##_name
 
@@ -0,0 +1,114 @@
+#ifndef __LCD_NUMBER_H__
+#define __LCD_NUMBER_H__
+
+/**
+ * @file lcd_number.h
+ * @author LiuChuansen (179712066@qq.com)
+ * @brief 数字显示槽，在固定位置显示数值，只重绘变化的字符格
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @note 时钟、传感器读数每秒刷新，但通常只有最后一两位变化。显示槽记住上一次每个字符格显示的字符，
+ *   新的内容逐格比较，只重绘不同的字符格，并返回变化的区域，方便只刷新这一部分。
+ *   字符格宽度为字体宽度（比例字体为字符单元宽度），字体中没有的字符（如数字字体中的':'、'.'）显示为空白格。
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "lcd_display.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/// 显示槽最多的字符格数
+#ifndef CONFIG_LCD_NUMBER_SLOT_MAX_CELLS
+#define CONFIG_LCD_NUMBER_SLOT_MAX_CELLS 12
+#endif
+
+/// 对齐方式
+typedef enum {
+    /// 右对齐，左边填充
+    LCD_NUMBER_ALIGN_RIGHT = 0,
+    /// 左对齐，右边填空白
+    LCD_NUMBER_ALIGN_LEFT = 1,
+} lcd_number_align_t;
+
+/**
+ * @brief 数字显示槽
+ *
+ */
+typedef struct
+{
+    /// 左上角位置
+    int16_t x;
+    int16_t y;
+    /// 字符格数
+    uint8_t cells;
+    /// 对齐方式
+    uint8_t align;
+    /// 右对齐时的填充字符，' ' 或 '0'
+    char pad;
+    /// 是否反向显示
+    bool reverse;
+    /// 上一次显示的内容是否有效，无效时下一次全部重绘
+    bool valid;
+    /// 字体
+    const lcd_font_t *font;
+    /// 上一次每个字符格显示的字符
+    char text[CONFIG_LCD_NUMBER_SLOT_MAX_CELLS];
+}lcd_number_slot_t;
+
+/**
+ * @brief 初始化显示槽
+ *
+ * @param slot 显示槽
+ * @param x 左上角X
+ * @param y 左上角Y
+ * @param cells 字符格数，1 ~ CONFIG_LCD_NUMBER_SLOT_MAX_CELLS
+ * @param font 字体
+ * @param align 对齐方式
+ * @param pad 右对齐时的填充字符，' ' 或 '0'，负数补0时填在符号之后
+ * @param reverse 是否反向显示
+ * @return int 成功返回0，参数错误返回-1
+ */
+int lcd_number_slot_init(lcd_number_slot_t *slot, int x, int y, uint8_t cells, const lcd_font_t *font,
+    lcd_number_align_t align, char pad, bool reverse);
+
+/**
+ * @brief 使显示槽的内容失效，下一次显示时全部重绘，例如清屏或页面切换后
+ *
+ * @param slot 显示槽
+ */
+void lcd_number_slot_invalidate(lcd_number_slot_t *slot);
+
+/**
+ * @brief 在显示槽中显示文本，例如 "12:34"，按对齐方式填充到字符格数
+ *
+ * @param disp LCD显示句柄
+ * @param slot 显示槽
+ * @param text ASCII文本，长度不能超过字符格数
+ * @param changed 输出重绘的区域，没有变化时宽高为0，可以为NULL
+ * @return int 返回重绘的字符格数，失败返回-1
+ */
+int lcd_number_slot_show_text(lcd_handle_t disp, lcd_number_slot_t *slot, const char *text, lcd_rect_t *changed);
+
+/**
+ * @brief 在显示槽中显示整数或定点小数
+ *
+ * @param disp LCD显示句柄
+ * @param slot 显示槽
+ * @param value 数值，有小数位时为放大 10^decimals 倍后的整数，例如 235 + 1位小数显示 "23.5"
+ * @param decimals 小数位数，0 ~ 9
+ * @param changed 输出重绘的区域，没有变化时宽高为0，可以为NULL
+ * @return int 返回重绘的字符格数，失败返回-1
+ */
+int lcd_number_slot_show_int(lcd_handle_t disp, lcd_number_slot_t *slot, int32_t value, uint8_t decimals, lcd_rect_t *changed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __LCD_NUMBER_H__
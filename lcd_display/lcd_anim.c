@@ -13,26 +13,21 @@
 #include "esp_log.h"
 #include "esp_heap_caps.h"
 #include <string.h>
+#include <stddef.h>
 #include <stdlib.h>
 
 static const char *TAG = "lcd_anim";
 
-/**
- * @brief 动图实例结构体
- */
-struct lcd_anim_instance
-{
-    struct lcd_anim_schedule *schedule;  ///< 所属调度器
-    uint16_t x;                          ///< 显示位置X坐标
-    uint16_t y;                          ///< 显示位置Y坐标
-    bool reverse;                        ///< 是否反向显示（黑底白字）
-    uint16_t frame_index;                ///< 当前帧索引
-    sys_tick_t next_frame_tick;          ///< 下次帧刷新时间（0表示需要立即显示）
-    const lcd_anim_t *anim;              ///< 动画对象指针
-    struct lcd_anim_instance *next;       ///< 下一个实例指针
-};
-
-// 动图调度器结构体定义已移至头文件 lcd_anim.h
+// 动态添加帧时帧数组的初始容量，之后按2倍扩容
+#ifndef CONFIG_LCD_ANIM_FRAME_INIT_CAPACITY
+#define CONFIG_LCD_ANIM_FRAME_INIT_CAPACITY 4
+#endif
+
+// 动图实例和调度器结构体定义在头文件 lcd_anim.h 中，调度器内置实例池
+
+#if (CONFIG_LCD_ANIM_HASH_BUCKETS & (CONFIG_LCD_ANIM_HASH_BUCKETS - 1)) != 0
+#error "CONFIG_LCD_ANIM_HASH_BUCKETS must be a power of 2"
+#endif
 
 /**
  * @brief 获取单色位图的宽度和高度
@@ -67,17 +62,18 @@ int lcd_anim_init(lcd_anim_t *anim, lcd_anim_type_t type, uint16_t period, const
     anim->frame_period = period;
     anim->frame_num = 0;
 
-    // 根据类型获取首帧尺寸
-    if (type == LCD_ANIM_TYPE_MONO_IMG) {
+    // 根据类型获取首帧尺寸，差值动画的首帧为关键帧
+    if (type == LCD_ANIM_TYPE_MONO_IMG || type == LCD_ANIM_TYPE_MONO_DELTA) {
         get_mono_img_size(first_frame, &anim->width, &anim->height);
     } else {
         ESP_LOGE(TAG, "Unsupported animation type: %d", type);
         return -1;
     }
 
-    // 添加首帧
-    anim->head_frame.data = first_frame;
-    anim->head_frame.next = NULL;
+    // 首帧保存在动画对象中，添加第二帧时才分配帧数组
+    anim->first_frame.data = first_frame;
+    anim->first_frame.duration = 0;
+    anim->frames = NULL;
     anim->frame_num = 1;
 
     return 0;
@@ -88,11 +84,25 @@ int lcd_anim_init(lcd_anim_t *anim, lcd_anim_type_t type, uint16_t period, const
  */
 int lcd_anim_add_frame(lcd_anim_t *anim, const void *frame)
 {
-    if (!anim || !frame) {
+    return lcd_anim_add_frame_with_duration(anim, frame, 0);
+}
+
+/**
+ * @brief 向动画对象添加一帧，并指定本帧的显示时间
+ */
+int lcd_anim_add_frame_with_duration(lcd_anim_t *anim, const void *frame, uint16_t duration)
+{
+    if (!anim || !frame || anim->frame_num == 0) {
         ESP_LOGE(TAG, "Invalid parameters for anim add");
         return -1;
     }
 
+    // LCD_MONO_ANIM_DEFINE 定义的动画帧数组在Flash中，不能添加
+    if (anim->frames && anim->capacity == 0) {
+        ESP_LOGE(TAG, "Cannot add frame to a static animation");
+        return -1;
+    }
+
     // 验证帧尺寸是否与首帧一致
     if (anim->type == LCD_ANIM_TYPE_MONO_IMG) {
         uint16_t width, height;
@@ -102,29 +112,59 @@ int lcd_anim_add_frame(lcd_anim_t *anim, const void *frame)
                      anim->width, anim->height, width, height);
             return -1;
         }
+    } else if (anim->type == LCD_ANIM_TYPE_MONO_DELTA) {
+        // 差值的边界框必须在动画范围内
+        const lcd_anim_delta_t *delta = (const lcd_anim_delta_t *)frame;
+        if (delta->x + delta->mask.width > anim->width || delta->y + delta->mask.height > anim->height) {
+            ESP_LOGE(TAG, "Delta box (%d,%d %dx%d) exceeds %dx%d", delta->x, delta->y,
+                     delta->mask.width, delta->mask.height, anim->width, anim->height);
+            return -1;
+        }
     }
 
-    // 找到链表末尾
-    struct lcd_anim_frame *current = &anim->head_frame;
-    while (current->next != NULL) {
-        current = current->next;
-    }
+    // 帧数组已满时按2倍扩容，首次分配时把首帧复制到数组中
+    if (anim->frame_num >= anim->capacity) {
+        uint32_t capacity = anim->capacity ? anim->capacity * 2 : CONFIG_LCD_ANIM_FRAME_INIT_CAPACITY;
+        if (capacity > UINT16_MAX) {
+            ESP_LOGE(TAG, "Too many frames: %d", anim->frame_num);
+            return -1;
+        }
 
-    // 创建新帧节点
-    struct lcd_anim_frame *new_frame = (struct lcd_anim_frame *)malloc(sizeof(struct lcd_anim_frame));
-    if (!new_frame) {
-        ESP_LOGE(TAG, "Failed to allocate memory for frame");
-        return -1;
+        lcd_anim_frame_t *frames = (lcd_anim_frame_t *)realloc((void *)anim->frames, capacity * sizeof(lcd_anim_frame_t));
+        if (!frames) {
+            ESP_LOGE(TAG, "Failed to allocate memory for frame");
+            return -1;
+        }
+
+        if (anim->capacity == 0) {
+            frames[0] = anim->first_frame;
+        }
+        anim->frames = frames;
+        anim->capacity = capacity;
     }
 
-    new_frame->data = frame;
-    new_frame->next = NULL;
-    current->next = new_frame;
+    lcd_anim_frame_t *frames = (lcd_anim_frame_t *)anim->frames;
+    frames[anim->frame_num].data = frame;
+    frames[anim->frame_num].duration = duration;
     anim->frame_num++;
 
     return 0;
 }
 
+/**
+ * @brief 设置动画的循环方式
+ */
+int lcd_anim_set_loop(lcd_anim_t *anim, lcd_anim_loop_t loop)
+{
+    if (!anim || loop >= LCD_ANIM_LOOP_MAX) {
+        ESP_LOGE(TAG, "Invalid parameters for anim set loop");
+        return -1;
+    }
+
+    anim->loop = loop;
+    return 0;
+}
+
 /**
  * @brief 释放动画对象占用的内存
  */
@@ -134,19 +174,26 @@ void lcd_anim_release(lcd_anim_t *anim)
         return;
     }
 
-    // 释放除头节点外的所有帧节点
-    struct lcd_anim_frame *current = anim->head_frame.next;
-    while (current != NULL) {
-        struct lcd_anim_frame *next = current->next;
-        free(current);
-        current = next;
+    // 静态定义的动画帧数组在Flash中，不需要释放
+    if (anim->capacity > 0) {
+        free((void *)anim->frames);
+        anim->capacity = 0;
     }
 
-    // 清空头节点
-    anim->head_frame.next = NULL;
+    anim->frames = NULL;
     anim->frame_num = 0;
 }
 
+/**
+ * @brief 计算 (x, y, anim) 的哈希桶序号
+ */
+static inline uint32_t instance_hash(uint16_t x, uint16_t y, const lcd_anim_t *anim)
+{
+    uint32_t h = ((uint32_t)x << 16 | y) ^ (uint32_t)((uintptr_t)anim >> 2);
+    h *= 0x9E3779B1u;
+    return (h >> 16) & (CONFIG_LCD_ANIM_HASH_BUCKETS - 1);
+}
+
 /**
  * @brief 查找指定位置的动图实例
  */
@@ -156,38 +203,241 @@ static lcd_anim_instance_t *find_instance(lcd_anim_schedule_t *schedule, uint16_
         return NULL;
     }
 
-    lcd_anim_instance_t *current = schedule->head;
+    lcd_anim_instance_t *current = schedule->buckets[instance_hash(x, y, anim)];
     while (current != NULL) {
         if (current->x == x && current->y == y && current->anim == anim) {
             return current;
         }
-        current = current->next;
+        current = current->hash_next;
     }
 
     return NULL;
 }
 
 /**
- * @brief 获取指定索引的帧数据
+ * @brief 从实例池分配一个实例并加入哈希桶，实例池已满返回NULL
+ */
+static lcd_anim_instance_t *alloc_instance(lcd_anim_schedule_t *schedule, uint16_t x, uint16_t y, const lcd_anim_t *anim)
+{
+    lcd_anim_instance_t *instance = schedule->free_list;
+    if (!instance) {
+        return NULL;
+    }
+    schedule->free_list = instance->next;
+
+    memset(instance, 0, sizeof(lcd_anim_instance_t));
+    instance->schedule = schedule;
+    instance->x = x;
+    instance->y = y;
+    instance->anim = anim;
+
+    uint32_t bucket = instance_hash(x, y, anim);
+    instance->hash_next = schedule->buckets[bucket];
+    schedule->buckets[bucket] = instance;
+
+    return instance;
+}
+
+/**
+ * @brief 从哈希桶中移除实例并归还到实例池，调用前已从调度链表中移除
+ */
+static void free_instance(lcd_anim_schedule_t *schedule, lcd_anim_instance_t *instance)
+{
+    lcd_anim_instance_t **link = &schedule->buckets[instance_hash(instance->x, instance->y, instance->anim)];
+    while (*link && *link != instance) {
+        link = &(*link)->hash_next;
+    }
+    if (*link) {
+        *link = instance->hash_next;
+    }
+
+    instance->anim = NULL;
+    instance->hash_next = NULL;
+    instance->next = schedule->free_list;
+    schedule->free_list = instance;
+}
+
+/**
+ * @brief 获取指定索引的帧
  */
-static const void *get_frame_data(const lcd_anim_t *anim, uint16_t frame_index)
+static const lcd_anim_frame_t *get_frame(const lcd_anim_t *anim, uint16_t frame_index)
 {
     if (!anim || frame_index >= anim->frame_num) {
         return NULL;
     }
 
-    struct lcd_anim_frame *current = (struct lcd_anim_frame *)&anim->head_frame;
-    for (uint16_t i = 0; i <= frame_index; i++) {
-        if (i == frame_index) {
-            return current->data;
+    return anim->frames ? &anim->frames[frame_index] : &anim->first_frame;
+}
+
+/**
+ * @brief 按循环方式切换到下一帧
+ */
+static void advance_frame(lcd_anim_instance_t *instance)
+{
+    const lcd_anim_t *anim = instance->anim;
+    uint16_t last = anim->frame_num - 1;
+
+    switch (anim->loop) {
+    case LCD_ANIM_LOOP_ONCE:
+        if (instance->frame_index >= last) {
+            instance->finished = true;
+        } else {
+            instance->frame_index++;
         }
-        current = current->next;
-        if (!current) {
+        break;
+
+    case LCD_ANIM_LOOP_PINGPONG:
+        if (last == 0) {
             break;
         }
+        if ((instance->step > 0 && instance->frame_index >= last) ||
+            (instance->step < 0 && instance->frame_index == 0)) {
+            instance->step = -instance->step;
+        }
+        instance->frame_index += instance->step;
+        break;
+
+    default:
+        instance->frame_index = (instance->frame_index >= last) ? 0 : instance->frame_index + 1;
+        break;
     }
+}
 
-    return NULL;
+/**
+ * @brief 实例的帧是否到期，next_frame_tick == 0 表示新实例需要立即显示
+ */
+static inline bool instance_due(const lcd_anim_instance_t *instance, sys_tick_t now)
+{
+    return !instance->finished &&
+           (instance->next_frame_tick == 0 || !uptime_after(instance->next_frame_tick, now));
+}
+
+/**
+ * @brief 实例a是否应排在实例b之前：先到期的在前，播放完成的在最后
+ */
+static inline bool instance_before(const lcd_anim_instance_t *a, const lcd_anim_instance_t *b)
+{
+    if (a->finished || b->finished) {
+        return !a->finished;
+    }
+    if (a->next_frame_tick == 0 || b->next_frame_tick == 0) {
+        return a->next_frame_tick == 0;
+    }
+    return !uptime_after(a->next_frame_tick, b->next_frame_tick);
+}
+
+/**
+ * @brief 从调度器链表中移除实例
+ */
+static void schedule_unlink(lcd_anim_schedule_t *schedule, lcd_anim_instance_t *instance)
+{
+    lcd_anim_instance_t **link = &schedule->head;
+    while (*link && *link != instance) {
+        link = &(*link)->next;
+    }
+    if (*link) {
+        *link = instance->next;
+    }
+    instance->next = NULL;
+}
+
+/**
+ * @brief 按下次帧刷新时间插入调度器链表，相同时间的插在后面
+ */
+static void schedule_insert(lcd_anim_schedule_t *schedule, lcd_anim_instance_t *instance)
+{
+    lcd_anim_instance_t **link = &schedule->head;
+    while (*link && !instance_before(instance, *link)) {
+        link = &(*link)->next;
+    }
+    instance->next = *link;
+    *link = instance;
+}
+
+/**
+ * @brief 把差值帧异或到显存，输出重绘的区域
+ */
+static void apply_delta(lcd_anim_instance_t *instance, uint16_t index, lcd_rect_t *rect)
+{
+    const lcd_anim_delta_t *delta = (const lcd_anim_delta_t *)get_frame(instance->anim, index)->data;
+    int x = instance->x + delta->x;
+    int y = instance->y + delta->y;
+
+    if (delta->mask.width > 0 && delta->mask.height > 0) {
+        lcd_xor_mono_img(instance->schedule->disp, x, y, &delta->mask);
+    }
+
+    if (rect) {
+        rect->x = x;
+        rect->y = y;
+        rect->width = delta->mask.width;
+        rect->height = delta->mask.height;
+    }
+}
+
+/**
+ * @brief 显示指定帧，输出重绘的区域
+ * 
+ * 差值动画在显存中已有的相邻帧上异或差值，只重绘变化的部分；
+ * 新实例、被覆盖或循环回到首帧时，从关键帧开始依次异或差值重建
+ */
+static void draw_frame(lcd_anim_instance_t *instance, uint16_t index, lcd_rect_t *rect)
+{
+    const lcd_anim_t *anim = instance->anim;
+    lcd_handle_t disp = instance->schedule->disp;
+    lcd_rect_t full = { .x = instance->x, .y = instance->y, .width = anim->width, .height = anim->height };
+
+    if (anim->type == LCD_ANIM_TYPE_MONO_IMG) {
+        const lcd_mono_img_t *img = (const lcd_mono_img_t *)get_frame(anim, index)->data;
+        lcd_display_mono_img(disp, instance->x, instance->y, img, instance->reverse);
+    } else if (anim->type == LCD_ANIM_TYPE_MONO_DELTA) {
+        if (instance->synced && index == instance->shown_index + 1) {
+            apply_delta(instance, index, &full);
+        } else if (instance->synced && index + 1 == instance->shown_index) {
+            // 往返播放倒序时，再次异或当前帧的差值即恢复前一帧
+            apply_delta(instance, instance->shown_index, &full);
+        } else if (instance->synced && index == instance->shown_index) {
+            full.width = full.height = 0;
+        } else {
+            const lcd_mono_img_t *key = (const lcd_mono_img_t *)get_frame(anim, 0)->data;
+            lcd_display_mono_img(disp, instance->x, instance->y, key, instance->reverse);
+            for (uint16_t i = 1; i <= index; i++) {
+                apply_delta(instance, i, NULL);
+            }
+        }
+    }
+
+    instance->shown_index = index;
+    instance->synced = true;
+
+    if (rect) {
+        *rect = full;
+    }
+}
+
+/**
+ * @brief 显示实例的当前帧，并更新下次刷新时间和帧索引，输出重绘的区域
+ */
+static void show_frame(lcd_anim_instance_t *instance, sys_tick_t now, lcd_rect_t *rect)
+{
+    const lcd_anim_t *anim = instance->anim;
+
+    // 获取当前帧（新实例显示首帧，已存在的实例显示下一帧）
+    const lcd_anim_frame_t *frame = get_frame(anim, instance->frame_index);
+    if (!frame) {
+        ESP_LOGE(TAG, "Failed to get frame data for index %d", instance->frame_index);
+        instance->finished = true;
+        if (rect) {
+            memset(rect, 0, sizeof(lcd_rect_t));
+        }
+        return;
+    }
+
+    draw_frame(instance, instance->frame_index, rect);
+
+    // 更新下次刷新时间和帧索引
+    instance->next_frame_tick = now + (frame->duration ? frame->duration : anim->frame_period);
+    advance_frame(instance);
 }
 
 /**
@@ -208,51 +458,32 @@ lcd_anim_handle_t lcd_anim_play(lcd_anim_schedule_t *anim_schedule, uint16_t x,
     // 查找是否已存在相同位置的实例
     lcd_anim_instance_t *instance = find_instance(anim_schedule, x, y, anim);
     
-    // 如果不存在，创建新实例
+    // 如果不存在，从实例池分配新实例
     if (instance == NULL) {
-        instance = (lcd_anim_instance_t *)malloc(sizeof(lcd_anim_instance_t));
+        instance = alloc_instance(anim_schedule, x, y, anim);
         if (!instance) {
-            ESP_LOGE(TAG, "Failed to allocate memory for anim instance");
+            ESP_LOGW(TAG, "Anim instance pool is full (%d)", anim_schedule->pool_size);
             return NULL;
         }
 
-        memset(instance, 0, sizeof(lcd_anim_instance_t));
-        instance->schedule = anim_schedule;
-        instance->x = x;
-        instance->y = y;
         instance->frame_index = 0;
+        instance->step = 1;
         instance->next_frame_tick = 0;  // 0表示需要立即显示首帧
-        instance->anim = anim;
         instance->reverse = reverse;
 
-        // 添加到链表头部
-        instance->next = anim_schedule->head;
-        anim_schedule->head = instance;
+        // 新实例需要立即显示，插入到链表头部
+        schedule_insert(anim_schedule, instance);
     }
 
-    // 播放动画（更新当前帧）
+    // 播放动画（更新当前帧），只播放一次的动画播放完成后停在最后一帧
     sys_tick_t now = uptime();
-    
-    // 统一处理：如果 next_frame_tick == 0 或时间已到，则显示当前帧
-    if (instance->next_frame_tick == 0 || uptime_after(now, instance->next_frame_tick)) {
-        // 获取当前帧数据（新实例显示首帧，已存在的实例显示下一帧）
-        uint16_t display_index = instance->frame_index;
-        const void *frame_data = get_frame_data(anim, display_index);
-        
-        if (!frame_data) {
-            ESP_LOGE(TAG, "Failed to get frame data for index %d", display_index);
-            return instance;  // 即使显示失败，也返回实例句柄
-        }
-
-        // 显示帧
-        if (anim->type == LCD_ANIM_TYPE_MONO_IMG) {
-            const lcd_mono_img_t *img = (const lcd_mono_img_t *)frame_data;
-            lcd_display_mono_img(anim_schedule->disp, instance->x, instance->y, img, instance->reverse);
-        }
-
-        // 更新帧索引和下次刷新时间
-        instance->frame_index = (instance->frame_index + 1) % anim->frame_num;
-        instance->next_frame_tick = now + anim->frame_period;
+    if (instance_due(instance, now)) {
+        schedule_unlink(anim_schedule, instance);
+        show_frame(instance, now, NULL);
+        schedule_insert(anim_schedule, instance);
+    } else if (!instance->synced && get_frame(anim, instance->shown_index)) {
+        // 被覆盖后重绘当前帧，不切换到下一帧
+        draw_frame(instance, instance->shown_index, NULL);
     }
 
     return instance;
@@ -270,25 +501,35 @@ void lcd_anim_destroy(lcd_anim_handle_t anim_instance)
     lcd_anim_instance_t *instance = (lcd_anim_instance_t *)anim_instance;
     lcd_anim_schedule_t *schedule = instance->schedule;
 
-    if (!schedule) {
-        free(instance);
+    if (!schedule || !instance->anim) {
         return;
     }
 
-    // 从链表中移除
-    if (schedule->head == instance) {
-        schedule->head = instance->next;
-    } else {
-        lcd_anim_instance_t *current = schedule->head;
-        while (current && current->next != instance) {
-            current = current->next;
-        }
-        if (current) {
-            current->next = instance->next;
-        }
+    // 从调度链表中移除，归还到实例池
+    schedule_unlink(schedule, instance);
+    free_instance(schedule, instance);
+}
+
+/**
+ * @brief 动画区域被其他内容覆盖后调用，下一次 lcd_anim_play 立即重绘当前帧
+ */
+void lcd_anim_invalidate(lcd_anim_handle_t anim_instance)
+{
+    if (anim_instance) {
+        ((lcd_anim_instance_t *)anim_instance)->synced = false;
+    }
+}
+
+/**
+ * @brief 动图实例是否已经播放完成
+ */
+bool lcd_anim_is_finished(lcd_anim_handle_t anim_instance)
+{
+    if (!anim_instance) {
+        return false;
     }
 
-    free(instance);
+    return ((lcd_anim_instance_t *)anim_instance)->finished;
 }
 
 /**
@@ -296,24 +537,72 @@ void lcd_anim_destroy(lcd_anim_handle_t anim_instance)
  */
 bool lcd_anim_schedule(lcd_anim_schedule_t *anim_schedule)
 {
-    if (!anim_schedule) {
+    if (!anim_schedule || !anim_schedule->head) {
         return false;
     }
 
-    bool need_update = false;
+    // 链表按下次帧刷新时间排序，只需检查第一个实例
+    return instance_due(anim_schedule->head, uptime());
+}
+
+/**
+ * @brief 获取下一帧的刷新时间
+ */
+bool lcd_anim_next_deadline(const lcd_anim_schedule_t *anim_schedule, sys_tick_t *deadline)
+{
+    if (!anim_schedule || !deadline) {
+        return false;
+    }
+
+    const lcd_anim_instance_t *head = anim_schedule->head;
+    if (!head || head->finished) {
+        return false;
+    }
+
+    *deadline = head->next_frame_tick ? head->next_frame_tick : uptime();
+    return true;
+}
+
+/**
+ * @brief 显示所有到期实例的下一帧
+ */
+int lcd_anim_step(lcd_anim_schedule_t *anim_schedule, lcd_rect_t *changed, int max_changed)
+{
+    if (!anim_schedule || !anim_schedule->disp || (changed == NULL && max_changed > 0)) {
+        ESP_LOGE(TAG, "Invalid parameters for anim step");
+        return -1;
+    }
+
     sys_tick_t now = uptime();
 
-    lcd_anim_instance_t *current = anim_schedule->head;
-    while (current != NULL) {
-        // 检查是否需要更新（next_frame_tick == 0 表示新实例需要立即显示）
-        if (current->next_frame_tick == 0 || uptime_after(now, current->next_frame_tick)) {
-            need_update = true;
-            break;
+    // 先取下链表头部所有到期的实例，显示后再按新的刷新时间插回，
+    // 这样帧时间为0的实例在一次调用中也只会显示一帧
+    lcd_anim_instance_t *due = NULL, **tail = &due;
+    int count = 0;
+    while (anim_schedule->head && count < max_changed && instance_due(anim_schedule->head, now)) {
+        lcd_anim_instance_t *instance = anim_schedule->head;
+        anim_schedule->head = instance->next;
+        instance->next = NULL;
+        *tail = instance;
+        tail = &instance->next;
+        count++;
+    }
+
+    count = 0;
+    while (due) {
+        lcd_anim_instance_t *instance = due;
+        due = instance->next;
+
+        show_frame(instance, now, &changed[count]);
+        schedule_insert(anim_schedule, instance);
+
+        // 差值与前一帧相同时没有重绘
+        if (changed[count].width > 0 && changed[count].height > 0) {
+            count++;
         }
-        current = current->next;
     }
 
-    return need_update;
+    return count;
 }
 
 /**
@@ -321,15 +610,33 @@ bool lcd_anim_schedule(lcd_anim_schedule_t *anim_schedule)
  */
 int lcd_anim_schedule_init(lcd_anim_schedule_t *anim_schedule, uint32_t id, lcd_handle_t disp)
 {
-    if (!anim_schedule || !disp) {
+    if (!anim_schedule) {
         ESP_LOGE(TAG, "Invalid parameters for schedule init");
         return -1;
     }
 
-    memset(anim_schedule, 0, sizeof(lcd_anim_schedule_t));
+    return lcd_anim_schedule_init_with_pool(anim_schedule, id, disp, anim_schedule->slots, CONFIG_LCD_ANIM_SCHEDULE_POOL_SIZE);
+}
+
+/**
+ * @brief 初始化动图调度器，使用外部实例池
+ */
+int lcd_anim_schedule_init_with_pool(lcd_anim_schedule_t *anim_schedule, uint32_t id, lcd_handle_t disp,
+    lcd_anim_instance_t *pool, uint16_t pool_size)
+{
+    if (!anim_schedule || !disp || !pool || pool_size == 0) {
+        ESP_LOGE(TAG, "Invalid parameters for schedule init");
+        return -1;
+    }
+
+    memset(anim_schedule, 0, offsetof(lcd_anim_schedule_t, slots));
     anim_schedule->id = id;
     anim_schedule->disp = disp;
     anim_schedule->head = NULL;
+    anim_schedule->pool = pool;
+    anim_schedule->pool_size = pool_size;
+
+    lcd_anim_schedule_release_all(anim_schedule);
 
     return 0;
 }
@@ -339,17 +646,18 @@ int lcd_anim_schedule_init(lcd_anim_schedule_t *anim_schedule, uint32_t id, lcd_
  */
 void lcd_anim_schedule_release_all(lcd_anim_schedule_t *anim_schedule)
 {
-    if (!anim_schedule) {
+    if (!anim_schedule || !anim_schedule->pool) {
         return;
     }
 
-    lcd_anim_instance_t *current = anim_schedule->head;
-    while (current != NULL) {
-        lcd_anim_instance_t *next = current->next;
-        free(current);
-        current = next;
+    // 所有实例归还到实例池，重建空闲链表
+    memset(anim_schedule->pool, 0, anim_schedule->pool_size * sizeof(lcd_anim_instance_t));
+    memset(anim_schedule->buckets, 0, sizeof(anim_schedule->buckets));
+    anim_schedule->free_list = NULL;
+    for (int i = anim_schedule->pool_size - 1; i >= 0; i--) {
+        anim_schedule->pool[i].next = anim_schedule->free_list;
+        anim_schedule->free_list = &anim_schedule->pool[i];
     }
 
     anim_schedule->head = NULL;
 }
-
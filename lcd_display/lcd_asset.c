@@ -0,0 +1,287 @@
+/**
+ * @file lcd_asset.c
+ * @author LiuChuansen (179712066@qq.com)
+ * @brief 图片资源包实现
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @note 打开时先读取头信息并校验，然后映射整个资源包，之后的查找只访问映射后的Flash，不需要加锁。
+ */
+
+#include "lcd_asset.h"
+#include "esp_log.h"
+#include "esp_crc.h"
+#include "esp_err.h"
+#include <string.h>
+
+static const char *TAG = "lcd_asset";
+
+/**
+ * @brief 检查区间是否在资源包内
+ *
+ * @param offset 区间起始
+ * @param size 区间大小
+ * @param total 资源包大小
+ * @return true 在范围内
+ */
+static inline bool range_valid(uint32_t offset, uint32_t size, uint32_t total)
+{
+    return offset <= total && size <= total - offset;
+}
+
+/**
+ * @brief 检查头信息
+ *
+ * @param header 头信息
+ * @param label 分区名称
+ * @param partition_size 分区大小
+ * @return bool 是否有效
+ */
+static bool check_header(const lcd_asset_header_t *header, const char *label, uint32_t partition_size)
+{
+    if (header->magic != LCD_ASSET_MAGIC) {
+        ESP_LOGE(TAG, "Invalid magic number in partition '%s': 0x%08X", label, header->magic);
+        return false;
+    }
+
+    uint32_t crc = esp_crc32_le(0, (const uint8_t *)header, sizeof(lcd_asset_header_t) - sizeof(header->header_checksum));
+    if (crc != header->header_checksum) {
+        ESP_LOGE(TAG, "Header checksum mismatch in partition '%s': stored=0x%08X, calculated=0x%08X",
+                 label, header->header_checksum, crc);
+        return false;
+    }
+
+    uint32_t total = header->data_offset + header->data_size;
+    if (!range_valid(header->data_offset, header->data_size, partition_size)) {
+        ESP_LOGE(TAG, "Asset data size exceeds partition size in '%s'", label);
+        return false;
+    }
+
+    if (header->image_count > 0xFFFF
+        || (header->index_offset & 0x03) || (header->name_index_offset & 0x01)
+        || !range_valid(header->index_offset, header->image_count * sizeof(lcd_asset_record_t), total)
+        || !range_valid(header->name_index_offset, header->image_count * sizeof(uint16_t), total)
+        || !range_valid(header->string_offset, header->string_size, total)
+        || header->data_offset < header->index_offset) {
+        ESP_LOGE(TAG, "Invalid index layout in partition '%s'", label);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief 打开资源包
+ *
+ * @param pack 资源包对象
+ * @param partition_label 分区名称
+ * @param verify_data 是否校验图片数据的CRC
+ * @return int 成功返回0，失败返回-1
+ */
+int lcd_asset_pack_open(lcd_asset_pack_t *pack, const char *partition_label, bool verify_data)
+{
+    if (!pack || !partition_label) {
+        ESP_LOGE(TAG, "Invalid parameters for asset pack open");
+        return -1;
+    }
+
+    memset(pack, 0, sizeof(lcd_asset_pack_t));
+
+    const esp_partition_t *partition = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, CONFIG_LCD_ASSET_PARTITION_SUBTYPE, partition_label);
+    if (partition == NULL) {
+        ESP_LOGE(TAG, "Partition '%s' not found", partition_label);
+        return -1;
+    }
+
+    // 先读取头信息，确认映射的大小
+    lcd_asset_header_t header;
+    esp_err_t ret = esp_partition_read(partition, 0, &header, sizeof(header));
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to read header from partition '%s': %s", partition_label, esp_err_to_name(ret));
+        return -1;
+    }
+
+    if (!check_header(&header, partition_label, partition->size)) {
+        return -1;
+    }
+
+    const void *base = NULL;
+    uint32_t total = header.data_offset + header.data_size;
+    ret = esp_partition_mmap(partition, 0, total, ESP_PARTITION_MMAP_DATA, &base, &pack->mmap_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to mmap partition '%s': %s", partition_label, esp_err_to_name(ret));
+        return -1;
+    }
+
+    const uint8_t *p = (const uint8_t *)base;
+
+    // 索引表较小，打开时总是校验
+    uint32_t crc = esp_crc32_le(0, p + header.index_offset, header.data_offset - header.index_offset);
+    if (crc != header.index_checksum) {
+        ESP_LOGE(TAG, "Index checksum mismatch in partition '%s': stored=0x%08X, calculated=0x%08X",
+                 partition_label, header.index_checksum, crc);
+        esp_partition_munmap(pack->mmap_handle);
+        return -1;
+    }
+
+    if (verify_data) {
+        crc = esp_crc32_le(0, p + header.data_offset, header.data_size);
+        if (crc != header.data_checksum) {
+            ESP_LOGE(TAG, "Data checksum mismatch in partition '%s': stored=0x%08X, calculated=0x%08X",
+                     partition_label, header.data_checksum, crc);
+            esp_partition_munmap(pack->mmap_handle);
+            return -1;
+        }
+    }
+
+    pack->partition = partition;
+    pack->header = (const lcd_asset_header_t *)p;
+    pack->records = (const lcd_asset_record_t *)(p + header.index_offset);
+    pack->name_index = (const uint16_t *)(p + header.name_index_offset);
+    pack->strings = (const char *)(p + header.string_offset);
+    pack->data = p + header.data_offset;
+    pack->valid = true;
+
+    ESP_LOGI(TAG, "Asset pack '%s' opened: %u images, %u bytes", partition_label, header.image_count, total);
+
+    return 0;
+}
+
+/**
+ * @brief 关闭资源包
+ *
+ * @param pack 资源包对象
+ */
+void lcd_asset_pack_close(lcd_asset_pack_t *pack)
+{
+    if (!pack || !pack->valid) {
+        return;
+    }
+
+    esp_partition_munmap(pack->mmap_handle);
+    memset(pack, 0, sizeof(lcd_asset_pack_t));
+}
+
+/**
+ * @brief 获取资源包中的图片数量
+ *
+ * @param pack 资源包对象
+ * @return uint32_t 图片数量
+ */
+uint32_t lcd_asset_pack_count(const lcd_asset_pack_t *pack)
+{
+    return (pack && pack->valid) ? pack->header->image_count : 0;
+}
+
+/**
+ * @brief 用记录填充图片对象
+ *
+ * @param pack 资源包对象
+ * @param record 图片记录
+ * @param img 输出图片对象
+ * @return int 成功返回0，记录无效返回-1
+ */
+static int fill_img(const lcd_asset_pack_t *pack, const lcd_asset_record_t *record, lcd_mono_img_t *img)
+{
+    const lcd_asset_header_t *header = pack->header;
+
+    if (!range_valid(record->data_offset, record->data_size, header->data_size)
+        || record->name_offset >= header->string_size) {
+        ESP_LOGE(TAG, "Invalid record of image %u", record->id);
+        return -1;
+    }
+
+    img->name = pack->strings + record->name_offset;
+    img->width = record->width;
+    img->height = record->height;
+    img->data_size = record->data_size;
+    img->format = record->format;
+    img->data = pack->data + record->data_offset;
+
+    return 0;
+}
+
+/**
+ * @brief 按ID查找图片，二分查找
+ *
+ * @param pack 资源包对象
+ * @param id 图片ID
+ * @param img 输出图片对象
+ * @return int 成功返回0，未找到返回-1
+ */
+int lcd_asset_find_by_id(const lcd_asset_pack_t *pack, uint32_t id, lcd_mono_img_t *img)
+{
+    if (!pack || !pack->valid || !img) {
+        return -1;
+    }
+
+    int left = 0;
+    int right = (int)pack->header->image_count - 1;
+
+    while (left <= right) {
+        int mid = (left + right) / 2;
+        const lcd_asset_record_t *record = &pack->records[mid];
+
+        if (record->id == id) {
+            return fill_img(pack, record, img);
+        }
+
+        if (record->id < id) {
+            left = mid + 1;
+        } else {
+            right = mid - 1;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief 按名称查找图片，二分查找
+ *
+ * @param pack 资源包对象
+ * @param name 图片名称
+ * @param img 输出图片对象
+ * @return int 成功返回0，未找到返回-1
+ */
+int lcd_asset_find_by_name(const lcd_asset_pack_t *pack, const char *name, lcd_mono_img_t *img)
+{
+    if (!pack || !pack->valid || !name || !img) {
+        return -1;
+    }
+
+    const lcd_asset_header_t *header = pack->header;
+    int left = 0;
+    int right = (int)header->image_count - 1;
+
+    while (left <= right) {
+        int mid = (left + right) / 2;
+        uint16_t index = pack->name_index[mid];
+        if (index >= header->image_count) {
+            ESP_LOGE(TAG, "Invalid name index %u", index);
+            return -1;
+        }
+
+        const lcd_asset_record_t *record = &pack->records[index];
+        if (record->name_offset >= header->string_size) {
+            ESP_LOGE(TAG, "Invalid record of image %u", record->id);
+            return -1;
+        }
+
+        int cmp = strncmp(pack->strings + record->name_offset, name, header->string_size - record->name_offset);
+        if (cmp == 0) {
+            return fill_img(pack, record, img);
+        }
+
+        if (cmp < 0) {
+            left = mid + 1;
+        } else {
+            right = mid - 1;
+        }
+    }
+
+    return -1;
+}
@@ -19,6 +19,8 @@
 #include "esp_random.h"
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdlib.h>
+#include <inttypes.h>
 
 static const char *TAG = "lcd-mono";
 
@@ -35,6 +37,32 @@ MCU显存设定：
 
 
 
+/// 裁剪区域栈的深度
+#ifndef CONFIG_LCD_CLIP_STACK_DEPTH
+#define CONFIG_LCD_CLIP_STACK_DEPTH 4
+#endif
+
+/// 保存区域缓存池的块数，lcd_save_area 不指定缓存时从池中分配；默认为0不使用缓存池，
+/// 启用后每个显示句柄增加 SLOTS * (SLOT_SIZE + 1) 字节
+#ifndef CONFIG_LCD_SAVE_AREA_POOL_SLOTS
+#define CONFIG_LCD_SAVE_AREA_POOL_SLOTS 0
+#endif
+
+/// 缓存池每块的大小，默认可以保存64x32的区域
+#ifndef CONFIG_LCD_SAVE_AREA_POOL_SLOT_SIZE
+#define CONFIG_LCD_SAVE_AREA_POOL_SLOT_SIZE 256
+#endif
+
+/**
+ * @brief 裁剪区域 [x0, x1) * [y0, y1)
+ * 
+ */
+typedef struct
+{
+    int16_t x0, y0;
+    int16_t x1, y1;
+}lcd_clip_t;
+
 /**
  * @brief OLED显示适配
  * 
@@ -63,6 +91,16 @@ typedef struct
     const lcd_font_t *default_ascii_font;
     /// 指向默认UNICDOE字体
     const lcd_font_t *default_unicode_font;
+    /// 当前裁剪区域，所有绘制都限制在这个区域内，默认为整个屏幕
+    lcd_clip_t clip;
+    /// 被压入栈的裁剪区域
+    lcd_clip_t clip_stack[CONFIG_LCD_CLIP_STACK_DEPTH];
+    uint8_t clip_depth;
+#if CONFIG_LCD_SAVE_AREA_POOL_SLOTS > 0
+    /// lcd_save_area 的缓存池，每个显示各自一份
+    uint8_t save_pool[CONFIG_LCD_SAVE_AREA_POOL_SLOTS][CONFIG_LCD_SAVE_AREA_POOL_SLOT_SIZE];
+    bool save_pool_used[CONFIG_LCD_SAVE_AREA_POOL_SLOTS];
+#endif
 }lcd_display_t;
 
 
@@ -313,6 +351,8 @@ lcd_handle_t lcd_display_create(const lcd_driver_ops_t *driver, const lcd_model_
     lcd->ysize = dy;
     lcd->dram_size = dram_size;
     lcd->rotation = rotation;
+    lcd->clip.x1 = dx;
+    lcd->clip.y1 = dy;
 
     if (lcd->rotation == LCD_ROTATION_90)
     {
@@ -522,6 +562,111 @@ void lcd_refresh(lcd_handle_t disp)
     }
 }
 
+/**
+ * @brief 只刷新屏幕的指定区域
+ * 
+ * 区域按旋转方向换算到显示模型的坐标，只写入覆盖区域的页和列，
+ * 列通过 set_page_address 的 offset 参数指定起始位置。
+ * 
+ * @param disp 
+ * @param x 区域左上角X坐标（旋转后的坐标）
+ * @param y 区域左上角Y坐标（旋转后的坐标）
+ * @param width 区域宽度
+ * @param height 区域高度
+ * @return int 成功返回0，失败返回-1
+ */
+int lcd_refresh_area(lcd_handle_t disp, int x, int y, int width, int height)
+{
+    lcd_display_t *lcd = (lcd_display_t *)disp;
+    if (lcd == NULL)
+    {
+        return -1;
+    }
+
+    const lcd_model_t *model = lcd->model;
+
+    // 自定义刷新的模型（如灰度屏）数据格式不同，只能整屏刷新
+    if (model->custom_refresh)
+    {
+        lcd_refresh(disp);
+        return 0;
+    }
+
+    // 裁剪到屏幕范围
+    int x0 = x < 0 ? 0 : x;
+    int y0 = y < 0 ? 0 : y;
+    int x1 = x + width > lcd->xsize ? lcd->xsize : x + width;
+    int y1 = y + height > lcd->ysize ? lcd->ysize : y + height;
+    if (x0 >= x1 || y0 >= y1)
+    {
+        return 0;
+    }
+    x1 --;
+    y1 --;
+
+    // 换算到显示模型的像素坐标，与 dram_get_data_rXX 的旋转方式一致
+    int px0, px1, py0, py1;
+    switch (lcd->rotation)
+    {
+    case LCD_ROTATION_90:
+        px0 = y0;
+        px1 = y1;
+        py0 = model->ysize - 1 - x1;
+        py1 = model->ysize - 1 - x0;
+        break;
+    case LCD_ROTATION_180:
+        px0 = model->xsize - 1 - x1;
+        px1 = model->xsize - 1 - x0;
+        py0 = model->ysize - 1 - y1;
+        py1 = model->ysize - 1 - y0;
+        break;
+    case LCD_ROTATION_270:
+        px0 = model->xsize - 1 - y1;
+        px1 = model->xsize - 1 - y0;
+        py0 = x0;
+        py1 = x1;
+        break;
+    default:
+        px0 = x0;
+        px1 = x1;
+        py0 = y0;
+        py1 = y1;
+        break;
+    }
+
+    int col_start, col_end, row_start, row_end;
+    if (model->dram_mode == LCD_DRAM_MODE_VERTICAL)
+    {
+        // 按页写入，每页从区域的起始列开始
+        col_start = px0;
+        col_end = px1;
+        row_start = py0 / 8;
+        row_end = py1 / 8;
+    }
+    else
+    {
+        // 默认模式下 offset 的单位由控制器决定，只按行裁剪，每行从第0列开始整行写入
+        col_start = 0;
+        col_end = (model->xsize + 7) / 8 - 1;
+        row_start = py0;
+        row_end = py1;
+    }
+
+    int col_num = col_end - col_start + 1;
+    uint8_t data[col_num];
+    for (int row = row_start; row <= row_end; row ++)
+    {
+        model->set_page_address(disp, row, col_start);
+        for (int col = 0; col < col_num; col ++)
+        {
+            data[col] = lcd->dram_get_data(disp, col_start + col, row);
+        }
+        lcd_write_datas(disp, data, col_num);
+    }
+
+    return 0;
+}
+
 /**
  * @brief 启动显示器
  * 
@@ -626,6 +771,40 @@ void lcd_fill(lcd_handle_t disp, uint8_t data)
     memset(lcd->dram, data, lcd->dram_size);
 }
 
+/**
+ * @brief 获取显存
+ * 
+ * @param disp 
+ * @param width 输出宽度（旋转后）
+ * @param height 输出高度
+ * @param size 输出显存大小
+ * @return const uint8_t* 显存，像素(x, y)在位偏移 y * width + x 处，高位在左
+ */
+const uint8_t *lcd_get_framebuffer(lcd_handle_t disp, uint16_t *width, uint16_t *height, uint32_t *size)
+{
+    lcd_display_t *lcd = (lcd_display_t *)disp;
+
+    if (!lcd)
+    {
+        return NULL;
+    }
+
+    if (width)
+    {
+        *width = lcd->xsize;
+    }
+    if (height)
+    {
+        *height = lcd->ysize;
+    }
+    if (size)
+    {
+        *size = lcd->dram_size;
+    }
+
+    return lcd->dram;
+}
+
 
 /**
  * @brief 显示指定的连续位，高字节开始有效
@@ -668,10 +847,287 @@ static inline void _set_dram_bits(const lcd_display_t *disp, int x, int y, uint8
     }
 }
 
+/**
+ * @brief 设置缓存中从位偏移offs开始的连续count个位，按字节处理，中间整字节直接填充
+ *
+ * @param buf 缓存，高位在左
+ * @param offs 起始位偏移
+ * @param count 位数
+ * @param value 置1或清0
+ */
+static inline void _fill_bits(uint8_t *buf, int offs, int count, bool value)
+{
+    int left = count;
+    uint8_t *p = &buf[offs >> 3];
+    int head = offs & 0x07;
+
+    // 首字节不对齐的部分
+    if (head && left > 0)
+    {
+        int bits = 8 - head;
+        if (bits > left)
+        {
+            bits = left;
+        }
+        uint8_t mask = (uint8_t)((0xFF >> head) & (0xFF << (8 - head - bits)));
+        *p = value ? (*p | mask) : (*p & ~mask);
+        p ++;
+        left -= bits;
+    }
+
+    // 中间的整字节
+    if (left >= 8)
+    {
+        memset(p, value ? 0xFF : 0x00, left >> 3);
+        p += left >> 3;
+        left &= 0x07;
+    }
+
+    // 尾部不足一个字节的部分
+    if (left > 0)
+    {
+        uint8_t mask = (uint8_t)(0xFF << (8 - left));
+        *p = value ? (*p | mask) : (*p & ~mask);
+    }
+}
+
+/**
+ * @brief 设置一行中连续的像素 [x0, x1)
+ *
+ * @param disp
+ * @param x0 起始X（包含），调用者保证已在屏幕范围内
+ * @param x1 结束X（不包含）
+ * @param y 行坐标
+ * @param value 点亮或清除
+ */
+static inline void _fill_dram_span(const lcd_display_t *disp, int x0, int x1, int y, bool value)
+{
+    _fill_bits(disp->dram, y * disp->xsize + x0, x1 - x0, value);
+}
+
+/**
+ * @brief 计算区域与当前裁剪区域的交集，每个图元只在开始时计算一次，之后的循环不再判断边界
+ *
+ * @param disp
+ * @param x 左上角X，可以在屏幕外
+ * @param y 左上角Y
+ * @param width 宽度
+ * @param height 高度
+ * @param area 输出可见区域
+ * @return true 有可见部分
+ */
+static inline bool _clip_area(const lcd_display_t *disp, int x, int y, int width, int height, lcd_clip_t *area)
+{
+    const lcd_clip_t *clip = &disp->clip;
+
+    // 先用int比较，可见时结果一定在裁剪区域内，再存入16位的区域
+    int x0 = (x < clip->x0) ? clip->x0 : x;
+    int y0 = (y < clip->y0) ? clip->y0 : y;
+    int x1 = (x + width > clip->x1) ? clip->x1 : x + width;
+    int y1 = (y + height > clip->y1) ? clip->y1 : y + height;
+
+    if (x0 >= x1 || y0 >= y1)
+    {
+        return false;
+    }
+
+    area->x0 = x0;
+    area->y0 = y0;
+    area->x1 = x1;
+    area->y1 = y1;
+
+    return true;
+}
+
+/**
+ * @brief 设置一个矩形区域内的像素，裁剪到当前裁剪区域内
+ *
+ * @param disp
+ * @param x 左上角X，可以在屏幕外
+ * @param y 左上角Y
+ * @param width 宽度
+ * @param height 高度
+ * @param value 点亮或清除
+ */
+static void _fill_dram_rect(const lcd_display_t *disp, int x, int y, int width, int height, bool value)
+{
+    lcd_clip_t area;
+
+    if (!_clip_area(disp, x, y, width, height, &area))
+    {
+        return;
+    }
+
+    for (int py = area.y0; py < area.y1; py++)
+    {
+        _fill_dram_span(disp, area.x0, area.x1, py, value);
+    }
+}
+
+/**
+ * @brief 把value高位开始的nbits个位写到显存位偏移offs处，按字节掩码写入，最多涉及两个字节
+ *
+ * @param disp
+ * @param offs 显存位偏移，调用者保证在显存范围内
+ * @param value 数据，高位在左
+ * @param nbits 位数，1~8
+ */
+static inline void _put_dram_bits(const lcd_display_t *disp, int offs, uint8_t value, int nbits)
+{
+    uint8_t *p = &disp->dram[offs >> 3];
+    int shift = offs & 0x07;
+    uint8_t mask = (uint8_t)(0xFF << (8 - nbits));
+
+    value &= mask;
+    p[0] = (uint8_t)((p[0] & ~(mask >> shift)) | (value >> shift));
+    if (shift + nbits > 8)
+    {
+        p[1] = (uint8_t)((p[1] & ~(mask << (8 - shift))) | (value << (8 - shift)));
+    }
+}
+
+/**
+ * @brief 把value高位开始的nbits个位异或到显存位偏移offs处，最多涉及两个字节
+ *
+ * @param disp
+ * @param offs 显存位偏移，调用者保证在显存范围内
+ * @param value 数据，高位在左
+ * @param nbits 位数，1~8
+ */
+static inline void _xor_dram_bits(const lcd_display_t *disp, int offs, uint8_t value, int nbits)
+{
+    uint8_t *p = &disp->dram[offs >> 3];
+    int shift = offs & 0x07;
+
+    value &= (uint8_t)(0xFF << (8 - nbits));
+    p[0] ^= (uint8_t)(value >> shift);
+    if (shift + nbits > 8)
+    {
+        p[1] ^= (uint8_t)(value << (8 - shift));
+    }
+}
+
+/**
+ * @brief 翻转一行中连续的像素 [x0, x1)
+ *
+ * @param disp
+ * @param x0 起始X（包含），调用者保证已在屏幕范围内
+ * @param x1 结束X（不包含）
+ * @param y 行坐标
+ */
+static inline void _xor_dram_span(const lcd_display_t *disp, int x0, int x1, int y)
+{
+    int offs = y * disp->xsize + x0;
+    int left = x1 - x0;
+
+    // 首字节不对齐的部分
+    if ((offs & 0x07) && left > 0)
+    {
+        int bits = 8 - (offs & 0x07);
+        if (bits > left)
+        {
+            bits = left;
+        }
+        _xor_dram_bits(disp, offs, 0xFF, bits);
+        offs += bits;
+        left -= bits;
+    }
+
+    // 中间的整字节
+    uint8_t *p = &disp->dram[offs >> 3];
+    for (; left >= 8; left -= 8, offs += 8)
+    {
+        *p++ ^= 0xFF;
+    }
+
+    // 尾部不足一个字节的部分
+    if (left > 0)
+    {
+        _xor_dram_bits(disp, offs, 0xFF, left);
+    }
+}
+
+/**
+ * @brief 压入一个裁剪区域，新的区域为它与当前区域的交集
+ *
+ * @param disp
+ * @param x 左上角X
+ * @param y 左上角Y
+ * @param width 宽度
+ * @param height 高度
+ * @return int 成功返回0，栈满返回-1
+ */
+int lcd_push_clip(lcd_handle_t disp, int x, int y, int width, int height)
+{
+    lcd_display_t *lcd = (lcd_display_t *)disp;
+
+    if (!lcd)
+    {
+        return -1;
+    }
+
+    if (lcd->clip_depth >= CONFIG_LCD_CLIP_STACK_DEPTH)
+    {
+        ESP_LOGE(TAG, "Clip stack overflow, depth %d", CONFIG_LCD_CLIP_STACK_DEPTH);
+        return -1;
+    }
+
+    lcd->clip_stack[lcd->clip_depth++] = lcd->clip;
+
+    // 交集为空时保持空区域，之后的绘制都不会输出
+    lcd_clip_t area;
+    if (!_clip_area(lcd, x, y, width, height, &area))
+    {
+        // _clip_area 不可见时不写area，用当前区域的左上角构造空区域
+        area = lcd->clip;
+        area.x1 = area.x0;
+        area.y1 = area.y0;
+    }
+    lcd->clip = area;
+
+    return 0;
+}
+
+/**
+ * @brief 弹出最近压入的裁剪区域，恢复之前的区域
+ *
+ * @param disp
+ * @return int 成功返回0，栈空返回-1
+ */
+int lcd_pop_clip(lcd_handle_t disp)
+{
+    lcd_display_t *lcd = (lcd_display_t *)disp;
+
+    if (!lcd || lcd->clip_depth == 0)
+    {
+        ESP_LOGE(TAG, "Clip stack underflow");
+        return -1;
+    }
+
+    lcd->clip = lcd->clip_stack[--lcd->clip_depth];
+
+    return 0;
+}
+
+/**
+ * @brief 获取当前的裁剪区域
+ *
+ * @param disp
+ * @param rect 输出裁剪区域
+ */
+void lcd_get_clip(lcd_handle_t disp, lcd_rect_t *rect)
+{
+    lcd_display_t *lcd = (lcd_display_t *)disp;
+
+    rect->x = lcd->clip.x0;
+    rect->y = lcd->clip.y0;
+    rect->width = lcd->clip.x1 - lcd->clip.x0;
+    rect->height = lcd->clip.y1 - lcd->clip.y0;
+}
 
 /**
  * @brief 设置默认字体
- * 
+ *
  * @param disp 
  * @param ascii_font 
  * @param unicode_font 
@@ -756,6 +1212,10 @@ static bool is_ascii_char(uint32_t unicode)
 }
 
 
+// 比例字体的显示在缩放/旋转显示部分实现
+static int display_prop_char(lcd_display_t *lcd, int x, int y, int ch, const lcd_font_t *font,
+    int scale, lcd_rotation_t rotation, bool reverse);
+
 /**
  * @brief 查找字库并显示，较底层函数，支持部分显示。
  * 
@@ -779,24 +1239,30 @@ int lcd_display_char(lcd_handle_t disp, int x, int y, int ch, const lcd_font_t *
         return 0;
     }
 
-    const uint8_t *font_code = font->get_code_data(font, ch);
+    if (font->get_glyph)
+    {
+        return display_prop_char(lcd, x, y, ch, font, 1, LCD_ROTATION_0, reverse);
+    }
+
+    uint8_t code_buf[CONFIG_LCD_DISPLAY_GLYPH_BUF_SIZE];
+    const uint8_t *font_code = lcd_get_font_code(font, ch, code_buf);
     if (font_code == NULL)
     {
         ESP_LOGE(TAG, "Unabled to find font data of %06x", ch);
         return 0;
     }
 
-    // 检查是否完全在屏幕外
-    if (x >= lcd->xsize || y >= lcd->ysize || x + font->width <= 0 || y + font->height <= 0)
+    // 计算实际可显示的区域，完全在裁剪区域外时不显示
+    lcd_clip_t area;
+    if (!_clip_area(lcd, x, y, font->width, font->height, &area))
     {
         return 0;
     }
 
-    // 计算实际可显示的区域
-    int start_x = (x < 0) ? 0 : x;
-    int start_y = (y < 0) ? 0 : y;
-    int end_x = (x + font->width > lcd->xsize) ? lcd->xsize : x + font->width;
-    int end_y = (y + font->height > lcd->ysize) ? lcd->ysize : y + font->height;
+    int start_x = area.x0;
+    int start_y = area.y0;
+    int end_x = area.x1;
+    int end_y = area.y1;
     
     displayed_width = end_x - start_x;
 
@@ -855,172 +1321,1293 @@ int lcd_display_char(lcd_handle_t disp, int x, int y, int ch, const lcd_font_t *
     return displayed_width;
 }
 
+/// 是否启用ASCII连续字符的快速显示
+#ifndef CONFIG_LCD_DISPLAY_ASCII_FAST_PATH
+#define CONFIG_LCD_DISPLAY_ASCII_FAST_PATH 1
+#endif
+
+/// 显示文本前最多预取的非ASCII字符数量，0为不预取
+#ifndef CONFIG_LCD_DISPLAY_STRING_PREFETCH
+#define CONFIG_LCD_DISPLAY_STRING_PREFETCH 16
+#endif
 
+#if CONFIG_LCD_DISPLAY_ASCII_FAST_PATH
 /**
- * @brief 显示一串文本，支持部分显示。如果字符超出显示区域，会显示能显示的部分
- * 
- * @param disp 
- * @param x 显示位置X, 水平方向, 从左到右
- * @param y 显示位置Y, 垂直方向, 从上到下
- * @param text 需要显示的文本
- * @param ascii_font ASCII字体
- * @param unicode_font UNICODE 字体
+ * @brief 判断字体能否走ASCII快速显示：等宽、由 lcd_font_get_ascii_code 索引、数据包含全部ASCII字符
+ *
+ * @param font
+ * @return true 可以直接用 data + ch * code_size 得到字模
+ */
+static inline bool ascii_fast_font(const lcd_font_t *font)
+{
+    return font && font->get_code_data == lcd_font_get_ascii_code && !font->get_glyph
+        && font->code_size >= (uint32_t)((font->width + 7) / 8) * font->height
+        && font->data_size + 1 >= 128u * font->code_size;
+}
+
+/**
+ * @brief 显示一段连续的ASCII字符，裁剪只计算一次，字模直接按字符编码索引，逐行把各字符的字模依次写入显存
+ *
+ * @param lcd
+ * @param x 第一个字符的位置X
+ * @param y 位置Y
+ * @param text 字符，都小于0x80
+ * @param len 字符个数
+ * @param font 满足 ascii_fast_font() 的字体
  * @param reverse 是否反向显示
- * 
- * @return int 返回显示的字符数量
+ * @return int 返回显示（包括部分显示）的字符数量
  */
-int lcd_display_string(lcd_handle_t disp, int x, int y, const char *text, const lcd_font_t *ascii_font, const lcd_font_t *unicode_font, bool reverse)
+static int display_ascii_run(lcd_display_t *lcd, int x, int y, const char *text, int len,
+    const lcd_font_t *font, bool reverse)
 {
-    lcd_display_t *lcd = (lcd_display_t *)disp;       
-    const char *ch = text;     
-    int count = 0;
-    int current_x = x;
+    int width = font->width;
+    int row_bytes = (width + 7) / 8;
 
-    if (!text)
+    const lcd_clip_t *clip = &lcd->clip;
+
+    // 垂直方向裁剪
+    int row0 = (y < clip->y0) ? clip->y0 - y : 0;
+    int row1 = (y + font->height > clip->y1) ? clip->y1 - y : font->height;
+    if (row0 >= row1 || x >= clip->x1)
     {
-        return count;
+        return 0;
     }
 
-    // 如果起始位置完全在屏幕下方，直接返回
-    if (y >= lcd->ysize)
+    // 水平方向可见的字符范围 [i0, i1)
+    int i0 = (x < clip->x0) ? (clip->x0 - x) / width : 0;
+    int i1 = (clip->x1 - x + width - 1) / width;
+    if (i1 > len)
     {
-        return count;
+        i1 = len;
     }
-
-    if (ascii_font == NULL) 
+    if (i0 >= i1)
     {
-        ascii_font = lcd->default_ascii_font;
+        return 0;
     }
 
-    if (unicode_font == NULL)
+    for (int row = row0; row < row1; row++)
     {
-        unicode_font = lcd->default_unicode_font;
+        int line = (y + row) * lcd->xsize;
+
+        for (int i = i0; i < i1; i++)
+        {
+            const uint8_t *code = font->data + (uint8_t)text[i] * font->code_size + row * row_bytes;
+            int gx = x + i * width;
+            // 字符内可见的列 [c0, c1)，只有两端的字符会被裁剪
+            int c0 = (gx < clip->x0) ? clip->x0 - gx : 0;
+            int c1 = (gx + width > clip->x1) ? clip->x1 - gx : width;
+
+            for (int k = c0 >> 3; k < row_bytes && (k << 3) < c1; k++)
+            {
+                int b0 = (c0 > (k << 3)) ? c0 - (k << 3) : 0;
+                int b1 = (c1 < (k << 3) + 8) ? c1 - (k << 3) : 8;
+                uint8_t value = reverse ? ~code[k] : code[k];
+                _put_dram_bits(lcd, line + gx + (k << 3) + b0, (uint8_t)(value << b0), b1 - b0);
+            }
+        }
     }
 
-    // 显示每个字符，即使只能部分显示
-    while (*ch)
+    return i1 - i0;
+}
+#endif // CONFIG_LCD_DISPLAY_ASCII_FAST_PATH
+
+
+#if CONFIG_LCD_DISPLAY_STRING_PREFETCH > 0
+/**
+ * @brief 收集文本中的非ASCII字符，调用字体的预取函数
+ * 
+ * @param text UTF-8编码的文本
+ * @param ascii_font ASCII字体，用于估算显示宽度，可以为NULL
+ * @param unicode_font UNICODE 字体，必须支持预取
+ * @param max_width 只预取这个宽度内能显示的字符，小于0时不限制
+ * @return int 预取的字符数量
+ */
+static int prefetch_string(const char *text, const lcd_font_t *ascii_font, const lcd_font_t *unicode_font, int max_width)
+{
+    // 收集非ASCII字符，重复的字符由字体自己跳过
+    uint32_t chars[CONFIG_LCD_DISPLAY_STRING_PREFETCH];
+    int count = 0;
+    int width = 0;
+    const char *ch = text;
+    while (*ch && count < CONFIG_LCD_DISPLAY_STRING_PREFETCH && (max_width < 0 || width < max_width))
     {
+        if ((uint8_t)*ch < 0x80)
+        {
+            width += ascii_font ? ascii_font->width : 0;
+            ch++;
+            continue;
+        }
+
         uint32_t unicode;
         int bytes_consumed = parse_utf8_char(ch, &unicode);
-        
         if (bytes_consumed == 0)
         {
-            // UTF-8解析失败，跳过这个字符
-            ESP_LOGW(TAG, "Failed to parse UTF-8 character at position %d", (int)(ch - text));
             ch++;
             continue;
         }
-        
-        // 选择字体
-        const lcd_font_t *font = is_ascii_char(unicode) ? ascii_font : unicode_font;
 
-        // 显示字符
-        int width = lcd_display_char(disp, current_x, y, unicode, font, reverse);
-        if (width > 0)
-        {
-            count++;
-            current_x += font->width;  // 仍然使用完整字体宽度移动位置
-        }
-        else if (current_x >= lcd->xsize)  // 如果已经完全超出右边界
-        {
-            break;
-        }
+        chars[count++] = unicode;
+        width += unicode_font->width;
+        ch += bytes_consumed;
+    }
+
+    if (count > 0)
+    {
+        unicode_font->prefetch(unicode_font, chars, count);
+    }
+
+    return count;
+}
+#endif
+
+/**
+ * @brief 预取一串文本中的非ASCII字符
+ * 
+ * @param disp 
+ * @param text UTF-8编码的文本
+ * @param unicode_font UNICODE 字体，为NULL时使用默认字体
+ * @return int 预取的字符数量
+ */
+int lcd_prefetch_string(lcd_handle_t disp, const char *text, const lcd_font_t *unicode_font)
+{
+#if CONFIG_LCD_DISPLAY_STRING_PREFETCH > 0
+    lcd_display_t *lcd = (lcd_display_t *)disp;
+
+    if (!text || !lcd)
+    {
+        return 0;
+    }
+
+    if (unicode_font == NULL)
+    {
+        unicode_font = lcd->default_unicode_font;
+    }
+
+    if (unicode_font == NULL || unicode_font->prefetch == NULL)
+    {
+        return 0;
+    }
+
+    return prefetch_string(text, NULL, unicode_font, -1);
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief 显示一串文本，支持部分显示。如果字符超出显示区域，会显示能显示的部分
+ * 
+ * @param disp 
+ * @param x 显示位置X, 水平方向, 从左到右
+ * @param y 显示位置Y, 垂直方向, 从上到下
+ * @param text 需要显示的文本
+ * @param ascii_font ASCII字体
+ * @param unicode_font UNICODE 字体
+ * @param reverse 是否反向显示
+ * 
+ * @return int 返回显示的字符数量
+ */
+int lcd_display_string(lcd_handle_t disp, int x, int y, const char *text, const lcd_font_t *ascii_font, const lcd_font_t *unicode_font, bool reverse)
+{
+    lcd_display_t *lcd = (lcd_display_t *)disp;       
+    const char *ch = text;     
+    int count = 0;
+    int current_x = x;
+
+    if (!text)
+    {
+        return count;
+    }
+
+    // 如果起始位置完全在裁剪区域下方，直接返回
+    if (y >= lcd->clip.y1)
+    {
+        return count;
+    }
+
+    if (ascii_font == NULL) 
+    {
+        ascii_font = lcd->default_ascii_font;
+    }
+
+    if (unicode_font == NULL)
+    {
+        unicode_font = lcd->default_unicode_font;
+    }
+
+#if CONFIG_LCD_DISPLAY_ASCII_FAST_PATH
+    bool ascii_fast = ascii_fast_font(ascii_font);
+#endif
+
+#if CONFIG_LCD_DISPLAY_STRING_PREFETCH > 0
+    // 汉字库等从Flash读取的字体，先合并读取本行能显示的字符
+    if (unicode_font && unicode_font->prefetch)
+    {
+        prefetch_string(text, ascii_font, unicode_font, lcd->clip.x1 - x);
+    }
+#endif
+
+    // 显示每个字符，即使只能部分显示
+    while (*ch)
+    {
+#if CONFIG_LCD_DISPLAY_ASCII_FAST_PATH
+        // 连续的ASCII字符一次处理
+        if (ascii_fast && (uint8_t)*ch < 0x80)
+        {
+            int len = 1;
+            while (ch[len] && (uint8_t)ch[len] < 0x80)
+            {
+                len++;
+            }
+
+            count += display_ascii_run(lcd, current_x, y, ch, len, ascii_font, reverse);
+            current_x += len * ascii_font->width;
+            if (current_x >= lcd->clip.x1)
+            {
+                break;
+            }
+            ch += len;
+            continue;
+        }
+#endif
+
+        uint32_t unicode;
+        int bytes_consumed = parse_utf8_char(ch, &unicode);
+        
+        if (bytes_consumed == 0)
+        {
+            // UTF-8解析失败，跳过这个字符
+            ESP_LOGW(TAG, "Failed to parse UTF-8 character at position %d", (int)(ch - text));
+            ch++;
+            continue;
+        }
         
+        // 选择字体
+        const lcd_font_t *font = is_ascii_char(unicode) ? ascii_font : unicode_font;
+
+        // 显示字符
+        int width = lcd_display_char(disp, current_x, y, unicode, font, reverse);
+        if (width > 0)
+        {
+            count++;
+        }
+        else if (current_x >= lcd->clip.x1)  // 如果已经完全超出右边界
+        {
+            break;
+        }
+
+        // 在左边屏幕外没有显示的字符也要移动位置，否则后面的字符会叠在一起
+        if (font && font->get_glyph)
+        {
+            // 比例字体按字形的步进宽度移动位置
+            const lcd_font_glyph_t *glyph = font->get_glyph(font, unicode);
+            current_x += glyph ? glyph->advance : 0;
+        }
+        else if (font)
+        {
+            current_x += font->width;  // 仍然使用完整字体宽度移动位置
+        }
+
         ch += bytes_consumed;
     }
 
-    return count;
+    return count;
+}
+
+/**
+ * @brief 游程编码读取器
+ *
+ */
+typedef struct
+{
+    /// 编码数据
+    const uint8_t *data;
+    /// 当前4位码的位置
+    uint32_t pos;
+    /// 4位码的总数
+    uint32_t count;
+    /// 下一个游程的颜色
+    bool color;
+}rle_reader_t;
+
+/**
+ * @brief 读取下一个游程
+ *
+ * @param r 读取器
+ * @param color 输出游程的颜色
+ * @return int 游程长度，-1表示数据已结束
+ */
+static inline int rle_next_run(rle_reader_t *r, bool *color)
+{
+    int run = 0;
+
+    while (r->pos < r->count)
+    {
+        uint8_t code = r->data[r->pos >> 1];
+        code = (r->pos & 0x01) ? (code & 0x0F) : (code >> 4);
+        r->pos ++;
+        run += code;
+        if (code < 15)
+        {
+            *color = r->color;
+            r->color = !r->color;
+            return run;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief 显示游程编码的单色位图，逐行解码直接写入显存，不需要中间缓存
+ *
+ * @param lcd
+ * @param x 图片位置X
+ * @param y 图片位置Y
+ * @param img 位图对象
+ * @param start_x 可见区域
+ * @param start_y
+ * @param end_x
+ * @param end_y
+ * @param reverse 是否反向显示
+ * @param xor_mode 为true时只翻转点亮像素对应的显存位，reverse无效
+ */
+static void display_mono_img_rle(lcd_display_t *lcd, int x, int y, const lcd_mono_img_t *img,
+    int start_x, int start_y, int end_x, int end_y, bool reverse, bool xor_mode)
+{
+    rle_reader_t reader = {
+        .data = img->data,
+        .pos = 0,
+        .count = (uint32_t)img->data_size * 2,
+        .color = false,
+    };
+    int remaining = 0;
+    bool color = false;
+
+    for (int h = 0; h < img->height && y + h < end_y; h++)
+    {
+        bool visible = (y + h >= start_y);
+        int px = 0;
+
+        while (px < img->width)
+        {
+            if (remaining == 0)
+            {
+                remaining = rle_next_run(&reader, &color);
+                if (remaining < 0)
+                {
+                    ESP_LOGE(TAG, "RLE data of image '%s' is truncated", img->name ? img->name : "");
+                    return;
+                }
+                continue;
+            }
+
+            int seg = (remaining < img->width - px) ? remaining : img->width - px;
+            if (visible)
+            {
+                int sx = (x + px < start_x) ? start_x : x + px;
+                int ex = (x + px + seg > end_x) ? end_x : x + px + seg;
+                if (sx < ex && xor_mode)
+                {
+                    if (color)
+                    {
+                        _xor_dram_span(lcd, sx, ex, y + h);
+                    }
+                }
+                else if (sx < ex)
+                {
+                    _fill_dram_span(lcd, sx, ex, y + h, color != reverse);
+                }
+            }
+            px += seg;
+            remaining -= seg;
+        }
+    }
+}
+
+/**
+ * @brief 显示单色位图，支持部分显示
+ * 
+ * @param disp 显示对象 
+ * @param x 显示位置X
+ * @param y 显示位置Y
+ * @param img 位图对象
+ * @param reverse 是否反向显示
+ * 
+ * @return int 返回实际显示的像素宽度，如果完全不可见则返回0
+ */
+int lcd_display_mono_img(lcd_handle_t disp, int x, int y, const lcd_mono_img_t *img, bool reverse)
+{
+    lcd_display_t *lcd = (lcd_display_t *)disp;    
+    int displayed_width = 0;
+
+    if (!lcd || !img || !img->data)
+    {
+        ESP_LOGE(TAG, "Invalid parameters for mono image display");
+        return 0;
+    }
+
+    if (img->format != LCD_IMG_FORMAT_RAW && img->format != LCD_IMG_FORMAT_RLE)
+    {
+        ESP_LOGE(TAG, "Unsupported image format: %d", img->format);
+        return 0;
+    }
+
+    // 计算实际可显示的区域，完全在裁剪区域外时不显示
+    lcd_clip_t area;
+    if (!_clip_area(lcd, x, y, img->width, img->height, &area))
+    {
+        return 0;
+    }
+
+    int start_x = area.x0;
+    int start_y = area.y0;
+    int end_x = area.x1;
+    int end_y = area.y1;
+    
+    displayed_width = end_x - start_x;
+
+    if (img->format == LCD_IMG_FORMAT_RLE)
+    {
+        display_mono_img_rle(lcd, x, y, img, start_x, start_y, end_x, end_y, reverse, false);
+        return displayed_width;
+    }
+
+    // 遍历图像的每一行
+    for (int h = 0; h < img->height; h++)
+    {
+        // 跳过屏幕外的垂直行
+        if (y + h < start_y || y + h >= end_y)
+        {
+            continue;
+        }
+
+        // 计算当前行在图像数据中的起始位置
+        // 每行的字节数 = (图像宽度 + 7) / 8
+        int row_bytes = (img->width + 7) / 8;
+        int row_offset = h * row_bytes;
+        int x_offset = 0;  // 用于跟踪水平方向的偏移
+
+        // 处理这一行的所有字节
+        for (int byte_idx = 0; byte_idx < row_bytes; byte_idx++)
+        {
+            uint8_t img_byte = img->data[row_offset + byte_idx];
+            int bits_in_byte = (byte_idx == row_bytes - 1 && img->width % 8) ? 
+                              (img->width % 8) : 8;
+
+            // 检查当前8像素组是否在显示范围内
+            if (x + x_offset + 8 > start_x && x + x_offset < end_x)
+            {
+                // 计算需要显示的位数
+                int display_start = (x + x_offset < start_x) ? start_x - (x + x_offset) : 0;
+                int display_end = (x + x_offset + bits_in_byte > end_x) ? 
+                                end_x - (x + x_offset) : bits_in_byte;
+                
+                if (display_end > display_start)
+                {
+                    // 调整数据，只显示可见部分
+                    uint8_t adjusted_data = img_byte;
+                    if (display_start > 0)
+                    {
+                        adjusted_data &= (0xFF >> display_start);
+                    }
+                    if (display_end < 8)
+                    {
+                        adjusted_data &= (0xFF << (8 - display_end));
+                    }
+                    
+                    _set_dram_bits(lcd, x + x_offset + display_start, y + h, 
+                                 adjusted_data << display_start, display_end - display_start, reverse);
+                }
+            }
+            x_offset += 8;
+        }
+    }
+    
+    return displayed_width;
+}
+
+/**
+ * @brief 把单色位图异或到显存，图片中点亮的像素翻转显存中对应的像素，支持部分显示
+ * 
+ * @param disp 显示对象
+ * @param x 显示位置X
+ * @param y 显示位置Y
+ * @param img 位图对象，原始或游程编码格式
+ * 
+ * @return int 返回实际显示的像素宽度，如果完全不可见则返回0
+ */
+int lcd_xor_mono_img(lcd_handle_t disp, int x, int y, const lcd_mono_img_t *img)
+{
+    lcd_display_t *lcd = (lcd_display_t *)disp;
+
+    if (!lcd || !img || !img->data)
+    {
+        ESP_LOGE(TAG, "Invalid parameters for mono image xor");
+        return 0;
+    }
+
+    if (img->format != LCD_IMG_FORMAT_RAW && img->format != LCD_IMG_FORMAT_RLE)
+    {
+        ESP_LOGE(TAG, "Unsupported image format: %d", img->format);
+        return 0;
+    }
+
+    lcd_clip_t area;
+    if (!_clip_area(lcd, x, y, img->width, img->height, &area))
+    {
+        return 0;
+    }
+
+    if (img->format == LCD_IMG_FORMAT_RLE)
+    {
+        display_mono_img_rle(lcd, x, y, img, area.x0, area.y0, area.x1, area.y1, false, true);
+        return area.x1 - area.x0;
+    }
+
+    // 每次从图片行中取出8个可见像素，移位后异或到显存
+    int row_bytes = (img->width + 7) / 8;
+    for (int py = area.y0; py < area.y1; py++)
+    {
+        const uint8_t *row = &img->data[(py - y) * row_bytes];
+        int offs = py * lcd->xsize + area.x0;
+
+        for (int c = area.x0 - x; c < area.x1 - x; c += 8, offs += 8)
+        {
+            int idx = c >> 3;
+            int shift = c & 0x07;
+            uint8_t value = (uint8_t)(row[idx] << shift);
+            if (shift && idx + 1 < row_bytes)
+            {
+                value |= row[idx + 1] >> (8 - shift);
+            }
+
+            int nbits = area.x1 - x - c;
+            _xor_dram_bits(lcd, offs, value, nbits > 8 ? 8 : nbits);
+        }
+    }
+
+    return area.x1 - area.x0;
+}
+
+/// Floyd-Steinberg误差缓存在栈上分配的最大图片宽度
+#ifndef CONFIG_LCD_DITHER_STACK_WIDTH
+#define CONFIG_LCD_DITHER_STACK_WIDTH 256
+#endif
+
+/// 8x8 Bayer矩阵，值0-63
+static const uint8_t s_bayer_8x8[8][8] = {
+    { 0, 32,  8, 40,  2, 34, 10, 42},
+    {48, 16, 56, 24, 50, 18, 58, 26},
+    {12, 44,  4, 36, 14, 46,  6, 38},
+    {60, 28, 52, 20, 62, 30, 54, 22},
+    { 3, 35, 11, 43,  1, 33,  9, 41},
+    {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47,  7, 39, 13, 45,  5, 37},
+    {63, 31, 55, 23, 61, 29, 53, 21},
+};
+
+/**
+ * @brief 设置显存中的一个像素
+ * 
+ * @param disp 
+ * @param x 
+ * @param y 
+ * @param value 
+ */
+static inline void _set_dram_pixel(const lcd_display_t *disp, int x, int y, bool value)
+{
+    int offs = y * disp->xsize + x;
+    if (value) {
+        disp->dram[offs >> 3] |= (1 << (7 - (offs & 0x07)));
+    } else {
+        disp->dram[offs >> 3] &= ~(1 << (7 - (offs & 0x07)));
+    }
+}
+
+/**
+ * @brief 显示8位灰度图片，逐行抖动为单色写入显存，支持部分显示
+ * 
+ * @param disp 显示对象
+ * @param x 显示位置X
+ * @param y 显示位置Y
+ * @param img 灰度图片
+ * @param mode 抖动方式
+ * @param reverse 是否反向显示
+ * 
+ * @return int 返回实际显示的像素宽度，如果完全不可见则返回0
+ */
+int lcd_display_gray_img(lcd_handle_t disp, int x, int y, const lcd_gray_img_t *img, lcd_dither_mode_t mode, bool reverse)
+{
+    lcd_display_t *lcd = (lcd_display_t *)disp;
+
+    if (!lcd || !img || !img->data || img->data_size < (uint32_t)img->width * img->height)
+    {
+        ESP_LOGE(TAG, "Invalid parameters for gray image display");
+        return 0;
+    }
+
+    // 计算实际可显示的区域，完全在裁剪区域外时不显示
+    lcd_clip_t area;
+    if (!_clip_area(lcd, x, y, img->width, img->height, &area))
+    {
+        return 0;
+    }
+
+    int start_x = area.x0;
+    int start_y = area.y0;
+    int end_x = area.x1;
+    int end_y = area.y1;
+
+    if (mode != LCD_DITHER_FLOYD_STEINBERG)
+    {
+        // 阈值和有序抖动每个像素独立计算，只处理可见区域
+        for (int py = start_y; py < end_y; py++)
+        {
+            const uint8_t *row = &img->data[(py - y) * img->width];
+            const uint8_t *bayer = s_bayer_8x8[py & 0x07];
+            for (int px = start_x; px < end_x; px++)
+            {
+                // 阈值映射到 2-254，0始终不点亮，255始终点亮
+                int threshold = (mode == LCD_DITHER_BAYER) ? (bayer[px & 0x07] << 2) + 2 : 128;
+                _set_dram_pixel(lcd, px, py, (row[px - x] >= threshold) != reverse);
+            }
+        }
+        return end_x - start_x;
+    }
+
+    /*
+    Floyd-Steinberg 误差扩散，误差使用Q4定点数（放大16倍），只用一行误差缓存：
+    err[i + 1] 在读取前保存上一行扩散到本行像素i的误差，读取后立即改为本行扩散到下一行像素i的误差，
+    扩散到右下方的误差先保存在 below_right 中，处理下一个像素时再写入。
+    误差需要从图片第一行开始逐行传递，所以可见区域上方的行也要计算，但只写入可见的像素。
+    */
+    int16_t stack_err[CONFIG_LCD_DITHER_STACK_WIDTH + 2];
+    int16_t *err = stack_err;
+    if (img->width > CONFIG_LCD_DITHER_STACK_WIDTH)
+    {
+        err = (int16_t *)malloc((img->width + 2) * sizeof(int16_t));
+        if (err == NULL)
+        {
+            ESP_LOGE(TAG, "malloc(%zu) failed", (img->width + 2) * sizeof(int16_t));
+            return 0;
+        }
+    }
+    memset(err, 0, (img->width + 2) * sizeof(int16_t));
+
+    for (int h = 0; h < img->height && y + h < end_y; h++)
+    {
+        const uint8_t *row = &img->data[h * img->width];
+        bool visible = (y + h >= start_y);
+        int right = 0;
+        int below_right = 0;
+
+        for (int w = 0; w < img->width; w++)
+        {
+            int value = (row[w] << 4) + right + err[w + 1];
+            bool on = value >= (128 << 4);
+            int e = value - (on ? (255 << 4) : 0);
+
+            if (visible && x + w >= start_x && x + w < end_x)
+            {
+                _set_dram_pixel(lcd, x + w, y + h, on != reverse);
+            }
+
+            int e7 = (e * 7) >> 4;
+            int e3 = (e * 3) >> 4;
+            int e5 = (e * 5) >> 4;
+            err[w] += e3;
+            err[w + 1] = e5 + below_right;
+            below_right = e - e7 - e3 - e5;
+            right = e7;
+        }
+    }
+
+    if (err != stack_err)
+    {
+        free(err);
+    }
+
+    return end_x - start_x;
+}
+
+/// 缩放/旋转显示时，行缓存在栈上分配的最大源图宽度，超出时从堆上分配
+#ifndef CONFIG_LCD_BLIT_STACK_WIDTH
+#define CONFIG_LCD_BLIT_STACK_WIDTH 128
+#endif
+
+/// 2倍放大，4位扩展为8位
+static const uint8_t s_expand_2x[16] = {
+    0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F,
+    0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF,
+};
+
+/// 3倍放大，4位扩展为12位
+static const uint16_t s_expand_3x[16] = {
+    0x000, 0x007, 0x038, 0x03F, 0x1C0, 0x1C7, 0x1F8, 0x1FF,
+    0xE00, 0xE07, 0xE38, 0xE3F, 0xFC0, 0xFC7, 0xFF8, 0xFFF,
+};
+
+/// 4倍放大，4位扩展为16位
+static const uint16_t s_expand_4x[16] = {
+    0x0000, 0x000F, 0x00F0, 0x00FF, 0x0F00, 0x0F0F, 0x0FF0, 0x0FFF,
+    0xF000, 0xF00F, 0xF0F0, 0xF0FF, 0xFF00, 0xFF0F, 0xFFF0, 0xFFFF,
+};
+
+/**
+ * @brief 将一个字节的每一位重复scale次，结果高位对齐输出
+ *
+ * @param value 输入字节
+ * @param scale 放大倍数 1-4
+ * @param out 输出，scale个字节
+ */
+static inline void expand_byte(uint8_t value, int scale, uint8_t *out)
+{
+    uint32_t v;
+
+    switch (scale)
+    {
+    case 2:
+        v = ((uint32_t)s_expand_2x[value >> 4] << 24) | ((uint32_t)s_expand_2x[value & 0x0F] << 16);
+        break;
+    case 3:
+        v = ((uint32_t)s_expand_3x[value >> 4] << 20) | ((uint32_t)s_expand_3x[value & 0x0F] << 8);
+        break;
+    case 4:
+        v = ((uint32_t)s_expand_4x[value >> 4] << 16) | s_expand_4x[value & 0x0F];
+        break;
+    default:
+        v = (uint32_t)value << 24;
+        break;
+    }
+
+    out[0] = v >> 24;
+    out[1] = v >> 16;
+    out[2] = v >> 8;
+    out[3] = v;
+}
+
+/**
+ * @brief 转置8x8的位块，输入8行，输出8列，都是高位在左
+ *
+ * @param in 输入的第一行
+ * @param stride 输入的行间距
+ * @param out 输出8个字节，out[i]为第i列，高位为第0行
+ */
+static inline void transpose_8x8(const uint8_t *in, int stride, uint8_t *out)
+{
+    uint32_t x = ((uint32_t)in[0] << 24) | ((uint32_t)in[stride] << 16) | ((uint32_t)in[2 * stride] << 8) | in[3 * stride];
+    uint32_t y = ((uint32_t)in[4 * stride] << 24) | ((uint32_t)in[5 * stride] << 16) | ((uint32_t)in[6 * stride] << 8) | in[7 * stride];
+    uint32_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA; x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA; y = y ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC; x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC; y = y ^ t ^ (t << 14);
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    out[0] = x >> 24; out[1] = x >> 16; out[2] = x >> 8; out[3] = x;
+    out[4] = y >> 24; out[5] = y >> 16; out[6] = y >> 8; out[7] = y;
+}
+
+/**
+ * @brief 缩放/旋转显示的上下文
+ *
+ */
+typedef struct
+{
+    lcd_display_t *lcd;
+    /// 放大倍数
+    int scale;
+    /// 可见区域
+    int start_x;
+    int start_y;
+    int end_x;
+    int end_y;
+    /// 是否反向显示
+    bool reverse;
+}blit_ctx_t;
+
+/**
+ * @brief 缩放/旋转显示的源位图，按行顺序读取，支持原始数据和游程编码
+ *
+ */
+typedef struct
+{
+    /// 原始数据，游程编码时为NULL
+    const uint8_t *data;
+    int width;
+    int height;
+    /// 每行字节数
+    int row_bytes;
+    /// 下一行的序号
+    int row;
+    /// 游程编码读取状态
+    rle_reader_t reader;
+    int remaining;
+    bool color;
+}blit_source_t;
+
+/**
+ * @brief 读取源位图的下一行
+ *
+ * @param src 源位图
+ * @param buf 游程编码时的解码缓存，row_bytes字节
+ * @return const uint8_t* 行数据，高位在左，数据错误返回NULL
+ */
+static const uint8_t *blit_source_next_row(blit_source_t *src, uint8_t *buf)
+{
+    if (src->data)
+    {
+        return &src->data[src->row++ * src->row_bytes];
+    }
+
+    memset(buf, 0, src->row_bytes);
+    int px = 0;
+    while (px < src->width)
+    {
+        if (src->remaining == 0)
+        {
+            src->remaining = rle_next_run(&src->reader, &src->color);
+            if (src->remaining < 0)
+            {
+                return NULL;
+            }
+            continue;
+        }
+
+        int seg = (src->remaining < src->width - px) ? src->remaining : src->width - px;
+        if (src->color)
+        {
+            _fill_bits(buf, px, seg, true);
+        }
+        px += seg;
+        src->remaining -= seg;
+    }
+
+    src->row++;
+    return buf;
+}
+
+/**
+ * @brief 将最多32位写入显存的一行，裁剪到可见区域
+ *
+ * @param ctx 上下文
+ * @param x 起始X
+ * @param y 行坐标，调用者保证在可见区域内
+ * @param bits 数据，高位在左
+ * @param nbits 位数
+ */
+static inline void blit_row_bits(const blit_ctx_t *ctx, int x, int y, const uint8_t *bits, int nbits)
+{
+    for (int i = 0; nbits > 0; i++, x += 8, nbits -= 8)
+    {
+        int fbits = (nbits > 8) ? 8 : nbits;
+        if (x + fbits <= ctx->start_x)
+        {
+            continue;
+        }
+        if (x >= ctx->end_x)
+        {
+            break;
+        }
+
+        int display_start = (x < ctx->start_x) ? ctx->start_x - x : 0;
+        int display_end = (x + fbits > ctx->end_x) ? ctx->end_x - x : fbits;
+        _set_dram_bits(ctx->lcd, x + display_start, y, bits[i] << display_start, display_end - display_start, ctx->reverse);
+    }
+}
+
+/**
+ * @brief 放大后写入一段位数据，每一位写成 scale*scale 的像素块
+ *
+ * @param ctx 上下文
+ * @param x 第一位对应的显示位置X
+ * @param y 显示位置Y
+ * @param bits 数据，高位在左
+ * @param bit_offset 跳过开头的位数
+ * @param nbits 写入的位数
+ */
+static void blit_scaled_bits(const blit_ctx_t *ctx, int x, int y, const uint8_t *bits, int bit_offset, int nbits)
+{
+    int scale = ctx->scale;
+    int y0 = (y < ctx->start_y) ? ctx->start_y : y;
+    int y1 = (y + scale > ctx->end_y) ? ctx->end_y : y + scale;
+    int end = bit_offset + nbits;
+
+    if (y0 >= y1)
+    {
+        return;
+    }
+
+    for (int i = bit_offset >> 3; i < (end + 7) >> 3; i++)
+    {
+        int lo = (i * 8 < bit_offset) ? bit_offset - i * 8 : 0;
+        int hi = (i * 8 + 8 > end) ? end - i * 8 : 8;
+        int px = x + (i * 8 + lo - bit_offset) * scale;
+        int count = (hi - lo) * scale;
+
+        if (px >= ctx->end_x)
+        {
+            break;
+        }
+        if (px + count <= ctx->start_x)
+        {
+            continue;
+        }
+
+        uint8_t expanded[4];
+        expand_byte((uint8_t)(bits[i] << lo), scale, expanded);
+        for (int py = y0; py < y1; py++)
+        {
+            blit_row_bits(ctx, px, py, expanded, count);
+        }
+    }
+}
+
+/**
+ * @brief 缩放/旋转显示位图，支持部分显示
+ *
+ * @param lcd 显示对象
+ * @param x 显示位置X
+ * @param y 显示位置Y
+ * @param src 源位图
+ * @param scale 放大倍数 1-4
+ * @param rotation 顺时针旋转角度
+ * @param reverse 是否反向显示
+ * @return int 返回实际显示的像素宽度，如果完全不可见则返回0
+ *
+ * @note 0/180度按行处理，180度时行内位序反转、行从下往上写；
+ *       90/270度每次读取8行，按8x8位块转置，源图的一列变成目标的一行中的8个像素。
+ */
+static int blit_transformed(lcd_display_t *lcd, int x, int y, blit_source_t *src, int scale, lcd_rotation_t rotation, bool reverse)
+{
+    bool swap = (rotation == LCD_ROTATION_90 || rotation == LCD_ROTATION_270);
+    int out_width = (swap ? src->height : src->width) * scale;
+    int out_height = (swap ? src->width : src->height) * scale;
+
+    // 完全在裁剪区域外时不显示
+    lcd_clip_t area;
+    if (!_clip_area(lcd, x, y, out_width, out_height, &area))
+    {
+        return 0;
+    }
+
+    blit_ctx_t ctx = {
+        .lcd = lcd,
+        .scale = scale,
+        .start_x = area.x0,
+        .start_y = area.y0,
+        .end_x = area.x1,
+        .end_y = area.y1,
+        .reverse = reverse,
+    };
+
+    // 旋转90/270度时缓存8行，否则缓存1行（游程解码或180度位序反转）
+    int buf_size = (swap ? 8 : 2) * src->row_bytes;
+    uint8_t stack_buf[((CONFIG_LCD_BLIT_STACK_WIDTH + 7) / 8) * 8];
+    uint8_t *buf = stack_buf;
+    if (buf_size > (int)sizeof(stack_buf))
+    {
+        buf = (uint8_t *)malloc(buf_size);
+        if (buf == NULL)
+        {
+            ESP_LOGE(TAG, "malloc(%d) failed", buf_size);
+            return 0;
+        }
+    }
+
+    int row_bytes = src->row_bytes;
+    int pad = row_bytes * 8 - src->width;
+
+    if (!swap)
+    {
+        uint8_t *flipped = buf + row_bytes;
+        for (int h = 0; h < src->height; h++)
+        {
+            int oy = (rotation == LCD_ROTATION_180) ? src->height - 1 - h : h;
+            int dy = y + oy * scale;
+
+            // 0度时后面的行都在可见区域下方
+            if (rotation == LCD_ROTATION_0 && dy >= ctx.end_y)
+            {
+                break;
+            }
+
+            const uint8_t *row = blit_source_next_row(src, buf);
+            if (row == NULL)
+            {
+                ESP_LOGE(TAG, "RLE data is truncated");
+                break;
+            }
+
+            if (dy + scale <= ctx.start_y || dy >= ctx.end_y)
+            {
+                continue;
+            }
+
+            if (rotation == LCD_ROTATION_180)
+            {
+                // 整行位序反转后，行尾的填充位移到了开头
+                for (int i = 0; i < row_bytes; i++)
+                {
+                    flipped[i] = reverse_bits(row[row_bytes - 1 - i]);
+                }
+                blit_scaled_bits(&ctx, x, dy, flipped, pad, src->width);
+            }
+            else
+            {
+                blit_scaled_bits(&ctx, x, dy, row, 0, src->width);
+            }
+        }
+    }
+    else
+    {
+        uint8_t cols[8];
+        for (int band = 0; band < src->height; band += 8)
+        {
+            int n = (src->height - band > 8) ? 8 : src->height - band;
+
+            // 读取8行，不足8行时补0
+            for (int i = 0; i < 8; i++)
+            {
+                uint8_t *dst = &buf[i * row_bytes];
+                const uint8_t *row = (i < n) ? blit_source_next_row(src, dst) : NULL;
+                if (row == NULL)
+                {
+                    if (i < n)
+                    {
+                        ESP_LOGE(TAG, "RLE data is truncated");
+                        n = i;
+                    }
+                    memset(dst, 0, row_bytes);
+                }
+                else if (row != dst)
+                {
+                    memcpy(dst, row, row_bytes);
+                }
+            }
+
+            for (int k = 0; k < row_bytes; k++)
+            {
+                transpose_8x8(&buf[k], row_bytes, cols);
+                for (int j = 0; j < 8 && k * 8 + j < src->width; j++)
+                {
+                    int c = k * 8 + j;
+                    if (rotation == LCD_ROTATION_90)
+                    {
+                        // 目标(x', y') = 源(y', H-1-x')，源的第c列从下往上成为目标的第c行
+                        uint8_t flipped = reverse_bits(cols[j]);
+                        blit_scaled_bits(&ctx, x + (src->height - band - n) * scale, y + c * scale, &flipped, 8 - n, n);
+                    }
+                    else
+                    {
+                        // 目标(x', y') = 源(W-1-y', x')，源的第c列从上往下成为目标的第W-1-c行
+                        blit_scaled_bits(&ctx, x + band * scale, y + (src->width - 1 - c) * scale, &cols[j], 0, n);
+                    }
+                }
+            }
+        }
+    }
+
+    if (buf != stack_buf)
+    {
+        free(buf);
+    }
+
+    return ctx.end_x - ctx.start_x;
+}
+
+/**
+ * @brief 显示比例字体的字符，只写入字形边界框内的像素，反向显示时先填充整个字符单元
+ *
+ * @param lcd 显示对象
+ * @param x 显示位置X，旋转放大后字符单元的左上角
+ * @param y 显示位置Y
+ * @param ch 字符
+ * @param font 比例字体
+ * @param scale 放大倍数 1-4
+ * @param rotation 顺时针旋转角度
+ * @param reverse 是否反向显示
+ * @return int 返回字符单元实际显示的像素宽度，如果完全不可见则返回0
+ */
+static int display_prop_char(lcd_display_t *lcd, int x, int y, int ch, const lcd_font_t *font,
+    int scale, lcd_rotation_t rotation, bool reverse)
+{
+    const lcd_font_glyph_t *glyph = font->get_glyph(font, ch);
+    if (glyph == NULL)
+    {
+        ESP_LOGE(TAG, "Unabled to find font data of %06x", ch);
+        return 0;
+    }
+
+    // 字符单元为 advance * height，旋转90/270度时宽高互换
+    bool swap = (rotation == LCD_ROTATION_90 || rotation == LCD_ROTATION_270);
+    int cell_width = (swap ? font->height : glyph->advance) * scale;
+    int cell_height = (swap ? glyph->advance : font->height) * scale;
+
+    // 完全在裁剪区域外时不显示
+    lcd_clip_t area;
+    if (!_clip_area(lcd, x, y, cell_width, cell_height, &area))
+    {
+        return 0;
+    }
+
+    if (reverse)
+    {
+        _fill_dram_rect(lcd, x, y, cell_width, cell_height, true);
+    }
+
+    if (glyph->width > 0)
+    {
+        uint8_t code_buf[CONFIG_LCD_DISPLAY_GLYPH_BUF_SIZE];
+        const uint8_t *font_code = lcd_get_font_code(font, ch, code_buf);
+        if (font_code == NULL)
+        {
+            ESP_LOGE(TAG, "Unabled to find font data of %06x", ch);
+            return 0;
+        }
+
+        // 边界框在旋转后字符单元中的位置
+        int bx, by;
+        switch (rotation)
+        {
+        case LCD_ROTATION_90:
+            bx = font->height - glyph->y_offset - glyph->height;
+            by = glyph->x_offset;
+            break;
+        case LCD_ROTATION_180:
+            bx = glyph->advance - glyph->x_offset - glyph->width;
+            by = font->height - glyph->y_offset - glyph->height;
+            break;
+        case LCD_ROTATION_270:
+            bx = glyph->y_offset;
+            by = glyph->advance - glyph->x_offset - glyph->width;
+            break;
+        default:
+            bx = glyph->x_offset;
+            by = glyph->y_offset;
+            break;
+        }
+
+        blit_source_t src = {
+            .data = font_code,
+            .width = glyph->width,
+            .height = glyph->height,
+            .row_bytes = (glyph->width + 7) / 8,
+        };
+        blit_transformed(lcd, x + bx * scale, y + by * scale, &src, scale, rotation, reverse);
+    }
+
+    return area.x1 - area.x0;
 }
 
 /**
- * @brief 显示单色位图，支持部分显示
+ * @brief 放大/旋转显示单色位图，支持部分显示
  * 
- * @param disp 显示对象 
+ * @param disp 显示对象
  * @param x 显示位置X
  * @param y 显示位置Y
  * @param img 位图对象
+ * @param scale 放大倍数 1-4
+ * @param rotation 顺时针旋转角度
  * @param reverse 是否反向显示
  * 
  * @return int 返回实际显示的像素宽度，如果完全不可见则返回0
  */
-int lcd_display_mono_img(lcd_handle_t disp, int x, int y, const lcd_mono_img_t *img, bool reverse)
+int lcd_display_mono_img_ex(lcd_handle_t disp, int x, int y, const lcd_mono_img_t *img, uint8_t scale, lcd_rotation_t rotation, bool reverse)
 {
-    lcd_display_t *lcd = (lcd_display_t *)disp;    
-    int displayed_width = 0;
+    lcd_display_t *lcd = (lcd_display_t *)disp;
 
-    if (!lcd || !img || !img->data)
+    if (!lcd || !img || !img->data || scale < 1 || scale > LCD_BLIT_MAX_SCALE || rotation > LCD_ROTATION_270)
     {
         ESP_LOGE(TAG, "Invalid parameters for mono image display");
         return 0;
     }
 
-    // 检查是否完全在屏幕外
-    if (x >= lcd->xsize || y >= lcd->ysize || 
-        x + img->width <= 0 || y + img->height <= 0)
+    if (scale == 1 && rotation == LCD_ROTATION_0)
+    {
+        return lcd_display_mono_img(disp, x, y, img, reverse);
+    }
+
+    if (img->format != LCD_IMG_FORMAT_RAW && img->format != LCD_IMG_FORMAT_RLE)
     {
+        ESP_LOGE(TAG, "Unsupported image format: %d", img->format);
         return 0;
     }
 
-    // 计算实际可显示的区域
-    int start_x = (x < 0) ? 0 : x;
-    int start_y = (y < 0) ? 0 : y;
-    int end_x = (x + img->width > lcd->xsize) ? lcd->xsize : x + img->width;
-    int end_y = (y + img->height > lcd->ysize) ? lcd->ysize : y + img->height;
-    
-    displayed_width = end_x - start_x;
+    blit_source_t src = {
+        .data = (img->format == LCD_IMG_FORMAT_RAW) ? img->data : NULL,
+        .width = img->width,
+        .height = img->height,
+        .row_bytes = (img->width + 7) / 8,
+        .reader = {
+            .data = img->data,
+            .count = (uint32_t)img->data_size * 2,
+        },
+    };
+
+    return blit_transformed(lcd, x, y, &src, scale, rotation, reverse);
+}
 
-    // 遍历图像的每一行
-    for (int h = 0; h < img->height; h++)
+/**
+ * @brief 放大/旋转显示单个字符，支持部分显示
+ * 
+ * @param disp 显示对象
+ * @param x 显示位置X
+ * @param y 显示位置Y
+ * @param ch 字符，有可能是ASCII，也有可能是UNICODE
+ * @param font 字体
+ * @param scale 放大倍数 1-4
+ * @param rotation 顺时针旋转角度
+ * @param reverse 是否反向显示
+ * 
+ * @return int 返回实际显示的像素宽度，如果完全不可见则返回0
+ */
+int lcd_display_char_ex(lcd_handle_t disp, int x, int y, int ch, const lcd_font_t *font, uint8_t scale, lcd_rotation_t rotation, bool reverse)
+{
+    lcd_display_t *lcd = (lcd_display_t *)disp;
+
+    if (font == NULL)
     {
-        // 跳过屏幕外的垂直行
-        if (y + h < start_y || y + h >= end_y)
-        {
-            continue;
-        }
+        ESP_LOGE(TAG, "No font specified!!");
+        return 0;
+    }
 
-        // 计算当前行在图像数据中的起始位置
-        // 每行的字节数 = (图像宽度 + 7) / 8
-        int row_bytes = (img->width + 7) / 8;
-        int row_offset = h * row_bytes;
-        int x_offset = 0;  // 用于跟踪水平方向的偏移
+    if (scale < 1 || scale > LCD_BLIT_MAX_SCALE || rotation > LCD_ROTATION_270)
+    {
+        ESP_LOGE(TAG, "Invalid scale %d or rotation %d", scale, rotation);
+        return 0;
+    }
 
-        // 处理这一行的所有字节
-        for (int byte_idx = 0; byte_idx < row_bytes; byte_idx++)
-        {
-            uint8_t img_byte = img->data[row_offset + byte_idx];
-            int bits_in_byte = (byte_idx == row_bytes - 1 && img->width % 8) ? 
-                              (img->width % 8) : 8;
+    if (scale == 1 && rotation == LCD_ROTATION_0)
+    {
+        return lcd_display_char(disp, x, y, ch, font, reverse);
+    }
 
-            // 检查当前8像素组是否在显示范围内
-            if (x + x_offset + 8 > start_x && x + x_offset < end_x)
-            {
-                // 计算需要显示的位数
-                int display_start = (x + x_offset < start_x) ? start_x - (x + x_offset) : 0;
-                int display_end = (x + x_offset + bits_in_byte > end_x) ? 
-                                end_x - (x + x_offset) : bits_in_byte;
-                
-                if (display_end > display_start)
-                {
-                    // 调整数据，只显示可见部分
-                    uint8_t adjusted_data = img_byte;
-                    if (display_start > 0)
-                    {
-                        adjusted_data &= (0xFF >> display_start);
-                    }
-                    if (display_end < 8)
-                    {
-                        adjusted_data &= (0xFF << (8 - display_end));
-                    }
-                    
-                    _set_dram_bits(lcd, x + x_offset + display_start, y + h, 
-                                 adjusted_data << display_start, display_end - display_start, reverse);
-                }
-            }
-            x_offset += 8;
-        }
+    if (font->get_glyph)
+    {
+        return display_prop_char(lcd, x, y, ch, font, scale, rotation, reverse);
     }
-    
-    return displayed_width;
+
+    uint8_t code_buf[CONFIG_LCD_DISPLAY_GLYPH_BUF_SIZE];
+    const uint8_t *font_code = lcd_get_font_code(font, ch, code_buf);
+    if (font_code == NULL)
+    {
+        ESP_LOGE(TAG, "Unabled to find font data of %06x", ch);
+        return 0;
+    }
+
+    blit_source_t src = {
+        .data = font_code,
+        .width = font->width,
+        .height = font->height,
+        .row_bytes = (font->width + 7) / 8,
+    };
+
+    return blit_transformed(lcd, x, y, &src, scale, rotation, reverse);
 }
 
 /**
@@ -1042,38 +2629,18 @@ int lcd_draw_vertical_line(lcd_handle_t disp, int x, int y, int length, int widt
         return -1;
     }
     
-    // 检查是否完全在屏幕外
-    if (x >= lcd->xsize || y >= lcd->ysize || x + width <= 0 || y + length <= 0) {
+    // 限制在裁剪区域内，完全在区域外时不绘制
+    lcd_clip_t area;
+    if (!_clip_area(lcd, x, y, width, length, &area)) {
         return -1;
     }
     
     ESP_LOGD(TAG, "draw vertical line @(%d,%d), length=%d, width=%d", x, y, length, width);
+    ESP_LOGD(TAG, "actual width=%d, actual length=%d", area.x1 - area.x0, area.y1 - area.y0);
 
-    // 限制在屏幕范围内
-    int start_x = (x < 0) ? 0 : x;
-    int start_y = (y < 0) ? 0 : y;
-    int end_x = (x + width > lcd->xsize) ? lcd->xsize : x + width;
-    int end_y = (y + length > lcd->ysize) ? lcd->ysize : y + length;
-    
-    // 实际绘制的宽度
-    int actual_width = end_x - start_x;
-    int actual_length = end_y - start_y;
-    
-    ESP_LOGD(TAG, "actual width=%d, actual length=%d", actual_width, actual_length);
-
-    // 在垂直方向上逐像素绘制
-    for (int curr_y = start_y; curr_y < end_y; curr_y++) {
-        // 在水平方向上设置宽度
-        for (int i = 0; i < actual_width; i++) {
-            // 计算内存中的位偏移
-            int offs = (curr_y * lcd->xsize + (start_x + i));
-            // 根据reverse参数设置或清除位
-            if (reverse) {
-                lcd->dram[offs >> 3] &= ~(1 << (7 - (offs & 0x07)));
-            } else {
-                lcd->dram[offs >> 3] |= (1 << (7 - (offs & 0x07)));
-            }
-        }
+    // 逐行设置线宽范围内的像素，reverse时清除
+    for (int curr_y = area.y0; curr_y < area.y1; curr_y++) {
+        _fill_dram_span(lcd, area.x0, area.x1, curr_y, !reverse);
     }
     
     return 0;
@@ -1098,38 +2665,18 @@ int lcd_draw_horizontal_line(lcd_handle_t disp, int x, int y, int length, int wi
         return -1;
     }
     
-    // 检查是否完全在屏幕外
-    if (x >= lcd->xsize || y >= lcd->ysize || x + length <= 0 || y + width <= 0) {
+    // 限制在裁剪区域内，完全在区域外时不绘制
+    lcd_clip_t area;
+    if (!_clip_area(lcd, x, y, length, width, &area)) {
         return -1;
     }
 
     ESP_LOGD(TAG, "draw horizontal line @(%d,%d), length=%d, width=%d", x, y, length, width);
+    ESP_LOGD(TAG, "actual width=%d, actual length=%d", area.y1 - area.y0, area.x1 - area.x0);
     
-    // 限制在屏幕范围内
-    int start_x = (x < 0) ? 0 : x;
-    int start_y = (y < 0) ? 0 : y;
-    int end_x = (x + length > lcd->xsize) ? lcd->xsize : x + length;
-    int end_y = (y + width > lcd->ysize) ? lcd->ysize : y + width;
-    
-    // 实际绘制的宽度和长度
-    int actual_width = end_y - start_y;
-    int actual_length = end_x - start_x;
-
-    ESP_LOGD(TAG, "actual width=%d, actual length=%d", actual_width, actual_length);
-    
-    // 在垂直方向上设置线宽
-    for (int curr_y = start_y; curr_y < end_y; curr_y++) {
-        // 在水平方向上设置长度
-        for (int curr_x = start_x; curr_x < end_x; curr_x++) {
-            // 计算内存中的位偏移
-            int offs = (curr_y * lcd->xsize + curr_x);
-            // 根据reverse参数设置或清除位
-            if (reverse) {
-                lcd->dram[offs >> 3] &= ~(1 << (7 - (offs & 0x07)));
-            } else {
-                lcd->dram[offs >> 3] |= (1 << (7 - (offs & 0x07)));
-            }
-        }
+    // 在垂直方向上设置线宽，每行整段设置，reverse时清除
+    for (int curr_y = area.y0; curr_y < area.y1; curr_y++) {
+        _fill_dram_span(lcd, area.x0, area.x1, curr_y, !reverse);
     }
     
     return 0;
@@ -1181,17 +2728,8 @@ int lcd_draw_rectangle(lcd_handle_t disp, int start_x, int start_y, int end_x, i
     
     // 如果线宽超过矩形尺寸的一半，就填充整个矩形
     if (width * 2 >= rect_width || width * 2 >= rect_height) {
-        // 填充整个矩形区域
-        for (int y = start_y; y <= end_y; y++) {
-            for (int x = start_x; x <= end_x; x++) {
-                int offs = (y * lcd->xsize + x);
-                if (reverse) {
-                    lcd->dram[offs >> 3] &= ~(1 << (7 - (offs & 0x07)));
-                } else {
-                    lcd->dram[offs >> 3] |= (1 << (7 - (offs & 0x07)));
-                }
-            }
-        }
+        // 填充整个矩形区域，裁剪到裁剪区域内
+        _fill_dram_rect(lcd, start_x, start_y, rect_width, rect_height, !reverse);
     } else {
         // 绘制四条边
         // 上边
@@ -1236,9 +2774,9 @@ int lcd_draw_rectangle1(lcd_handle_t disp, int start_x, int start_y, int x_len,
         return -1;
     }
 
-    // 检查是否完全在屏幕外
-    if (start_x >= lcd->xsize || start_y >= lcd->ysize || 
-        start_x + x_len <= 0 || start_y + y_len <= 0) {
+    // 检查是否完全在裁剪区域外
+    lcd_clip_t area;
+    if (!_clip_area(lcd, start_x, start_y, x_len, y_len, &area)) {
         ESP_LOGW(TAG, "Rectangle out of screen. x=%d, y=%d", start_x, start_y);
         return -1;
     }
@@ -1306,33 +2844,14 @@ int lcd_fill_area(lcd_handle_t disp, int x, int y, int width, int height, uint8_
         return -1;
     }
 
-    // 检查是否超出屏幕范围
-    if (x >= lcd->xsize || y >= lcd->ysize) {
+    // 检查是否完全在裁剪区域外
+    lcd_clip_t area;
+    if (!_clip_area(lcd, x, y, width, height, &area)) {
         return -1;
     }
 
-    // 调整宽度和高度，确保不超出屏幕
-    if (x + width > lcd->xsize) {
-        width = lcd->xsize - x;
-    }
-    if (y + height > lcd->ysize) {
-        height = lcd->ysize - y;
-    }
-
-    // 根据字体的宽度和大小设置显存位
-    for (int h = 0; h < height; h++) {
-        // 算出一行有多少个字节
-        int left_bits = width;
-        int byte_index = 0;
-
-        while (left_bits > 0) {
-            // 每次处理8位
-            int fbits = (left_bits > 8) ? 8 : left_bits;
-            // 使用0来清除显示
-            _set_dram_bits(lcd, x + byte_index * 8, y + h, value ? 0xff : 0x00, fbits, false);
-            left_bits -= fbits;
-            byte_index++;
-        }
+    for (int py = area.y0; py < area.y1; py++) {
+        _fill_dram_span(lcd, area.x0, area.x1, py, value != 0);
     }
 
     return 0;
@@ -1357,27 +2876,20 @@ int lcd_fill_area_random(lcd_handle_t disp, int x, int y, int width, int height)
         return -1;
     }
 
-    // 检查是否超出屏幕范围
-    if (x >= lcd->xsize || y >= lcd->ysize) {
+    // 限制在裁剪区域内
+    lcd_clip_t area;
+    if (!_clip_area(lcd, x, y, width, height, &area)) {
         return -1;
     }
 
-    // 调整宽度和高度，确保不超出屏幕
-    if (x + width > lcd->xsize) {
-        width = lcd->xsize - x;
-    }
-    if (y + height > lcd->ysize) {
-        height = lcd->ysize - y;
-    }
-
     // 逐像素随机填充
-    for (int h = 0; h < height; h++) {
-        for (int w = 0; w < width; w++) {
+    for (int py = area.y0; py < area.y1; py++) {
+        for (int px = area.x0; px < area.x1; px++) {
             // 生成随机位值（0或1）
             bool bit_value = (esp_random() & 0x01) != 0;
             
             // 计算像素在显存中的位置
-            int offs = (y + h) * lcd->xsize + (x + w);
+            int offs = py * lcd->xsize + px;
             int byte_index = offs >> 3;
             int bit_index = 7 - (offs & 0x07);  // 高位在左
             
@@ -1392,3 +2904,235 @@ int lcd_fill_area_random(lcd_handle_t disp, int x, int y, int width, int height)
 
     return 0;
 }
+
+/**
+ * @brief 从缓存位偏移offs处读取nbits个位到dst，dst从字节边界开始，最后一个字节多余的位清0
+ *
+ * @param src 源缓存，高位在左
+ * @param offs 起始位偏移
+ * @param dst 输出
+ * @param nbits 位数
+ */
+static void _read_bits(const uint8_t *src, int offs, uint8_t *dst, int nbits)
+{
+    const uint8_t *p = &src[offs >> 3];
+    int shift = offs & 0x07;
+    int nbytes = (nbits + 7) >> 3;
+
+    // 每个输出字节由相邻两个源字节移位拼接，对齐时next右移8位为0；
+    // 最后一个源字节只在需要时读取，避免越过显存末尾
+    int src_bytes = (shift + nbits + 7) >> 3;
+    for (int i = 0; i < nbytes; i++)
+    {
+        uint8_t next = (i + 1 < src_bytes) ? p[i + 1] : 0;
+        dst[i] = (uint8_t)((p[i] << shift) | (next >> (8 - shift)));
+    }
+
+    if (nbits & 0x07)
+    {
+        dst[nbytes - 1] &= (uint8_t)(0xFF << (8 - (nbits & 0x07)));
+    }
+}
+
+/**
+ * @brief 把src开始的nbits个位写到缓存位偏移offs处，不影响范围外的位
+ *
+ * @param dst 目标缓存，高位在左
+ * @param offs 起始位偏移
+ * @param src 数据，从字节边界开始
+ * @param nbits 位数
+ */
+static void _write_bits(uint8_t *dst, int offs, const uint8_t *src, int nbits)
+{
+    uint8_t *p = &dst[offs >> 3];
+    int shift = offs & 0x07;
+
+    if (shift == 0)
+    {
+        // 对齐时整字节直接复制，只有尾部需要掩码
+        for (int k = 0; k < (nbits >> 3); k++)
+        {
+            p[k] = src[k];
+        }
+        if (nbits & 0x07)
+        {
+            uint8_t mask = (uint8_t)(0xFF << (8 - (nbits & 0x07)));
+            p[nbits >> 3] = (p[nbits >> 3] & ~mask) | (src[nbits >> 3] & mask);
+        }
+        return;
+    }
+
+    // 首字节保留左边shift位
+    int bits = 8 - shift;
+    uint8_t mask = (uint8_t)(0xFF >> shift);
+    if (bits > nbits)
+    {
+        mask &= (uint8_t)(0xFF << (bits - nbits));
+        bits = nbits;
+    }
+    *p = (*p & ~mask) | ((src[0] >> shift) & mask);
+    p++;
+
+    // 中间整字节由相邻两个源字节移位拼接
+    int left = nbits - bits;
+    int k = 0;
+    for (; left >= 8; left -= 8, k++)
+    {
+        *p++ = (uint8_t)((src[k] << (8 - shift)) | (src[k + 1] >> shift));
+    }
+
+    // 尾部不足一个字节
+    if (left > 0)
+    {
+        // src[k]剩下低shift位，不够时再取下一个字节
+        uint8_t value = (uint8_t)(src[k] << (8 - shift));
+        if (left > shift)
+        {
+            value |= src[k + 1] >> shift;
+        }
+        mask = (uint8_t)(0xFF << (8 - left));
+        *p = (*p & ~mask) | (value & mask);
+    }
+}
+
+/**
+ * @brief 保存显存中一个矩形区域的内容
+ *
+ * @param disp
+ * @param x 左上角X
+ * @param y 左上角Y
+ * @param width 宽度
+ * @param height 高度
+ * @param buf 缓存，为NULL时从缓存池中分配
+ * @param buf_size 缓存大小
+ * @param area 输出保存的区域
+ * @return int 成功返回0，失败返回-1
+ */
+int lcd_save_area(lcd_handle_t disp, int x, int y, int width, int height, uint8_t *buf, uint32_t buf_size, lcd_saved_area_t *area)
+{
+    lcd_display_t *lcd = (lcd_display_t *)disp;
+
+    if (!lcd || !area || width < 0 || height < 0)
+    {
+        return -1;
+    }
+
+    memset(area, 0, sizeof(lcd_saved_area_t));
+
+    // 按屏幕范围裁剪，不受裁剪区域影响，恢复时原样写回
+    int x0 = (x < 0) ? 0 : x;
+    int y0 = (y < 0) ? 0 : y;
+    int x1 = (x + width > lcd->xsize) ? lcd->xsize : x + width;
+    int y1 = (y + height > lcd->ysize) ? lcd->ysize : y + height;
+    if (x0 >= x1 || y0 >= y1)
+    {
+        // 完全在屏幕外，没有需要保存的内容
+        return 0;
+    }
+
+    int row_bytes = (x1 - x0 + 7) / 8;
+    uint32_t size = row_bytes * (y1 - y0);
+
+    if (buf == NULL)
+    {
+#if CONFIG_LCD_SAVE_AREA_POOL_SLOTS > 0
+        if (size > CONFIG_LCD_SAVE_AREA_POOL_SLOT_SIZE)
+        {
+            ESP_LOGE(TAG, "Area %dx%d too large for pool slot (%d bytes)", x1 - x0, y1 - y0, CONFIG_LCD_SAVE_AREA_POOL_SLOT_SIZE);
+            return -1;
+        }
+
+        for (int i = 0; i < CONFIG_LCD_SAVE_AREA_POOL_SLOTS; i++)
+        {
+            if (!lcd->save_pool_used[i])
+            {
+                lcd->save_pool_used[i] = true;
+                buf = lcd->save_pool[i];
+                area->pool_used = &lcd->save_pool_used[i];
+                break;
+            }
+        }
+#endif
+        if (buf == NULL)
+        {
+            ESP_LOGE(TAG, "No free save area buffer");
+            return -1;
+        }
+    }
+    else if (buf_size < size)
+    {
+        ESP_LOGE(TAG, "Save area buffer too small, expected:%" PRIu32 ", got:%" PRIu32, size, buf_size);
+        return -1;
+    }
+
+    area->x = x0;
+    area->y = y0;
+    area->width = x1 - x0;
+    area->height = y1 - y0;
+    area->data = buf;
+    area->size = size;
+
+    for (int py = y0; py < y1; py++, buf += row_bytes)
+    {
+        _read_bits(lcd->dram, py * lcd->xsize + x0, buf, area->width);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief 把保存的内容写回显存
+ *
+ * @param disp
+ * @param area lcd_save_area 保存的区域
+ * @return int 成功返回0，失败返回-1
+ */
+int lcd_restore_area(lcd_handle_t disp, const lcd_saved_area_t *area)
+{
+    lcd_display_t *lcd = (lcd_display_t *)disp;
+
+    if (!lcd || !area)
+    {
+        return -1;
+    }
+
+    if (area->width == 0 || area->height == 0)
+    {
+        return 0;
+    }
+
+    if (!area->data || area->x + area->width > lcd->xsize || area->y + area->height > lcd->ysize)
+    {
+        ESP_LOGE(TAG, "Invalid saved area");
+        return -1;
+    }
+
+    int row_bytes = (area->width + 7) / 8;
+    const uint8_t *buf = area->data;
+    for (int py = area->y; py < area->y + area->height; py++, buf += row_bytes)
+    {
+        _write_bits(lcd->dram, py * lcd->xsize + area->x, buf, area->width);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief 释放保存区域占用的缓存池
+ *
+ * @param area 保存的区域
+ */
+void lcd_release_area(lcd_saved_area_t *area)
+{
+    if (!area)
+    {
+        return;
+    }
+
+    if (area->pool_used)
+    {
+        *area->pool_used = false;
+    }
+
+    memset(area, 0, sizeof(lcd_saved_area_t));
+}
@@ -0,0 +1,229 @@
+/**
+ * @file lcd_number.c
+ * @author LiuChuansen (179712066@qq.com)
+ * @brief 数字显示槽实现
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "lcd_number.h"
+#include "esp_log.h"
+#include <string.h>
+
+static const char *TAG = "lcd_number";
+
+/**
+ * @brief 初始化显示槽
+ *
+ * @param slot 显示槽
+ * @param x 左上角X
+ * @param y 左上角Y
+ * @param cells 字符格数
+ * @param font 字体
+ * @param align 对齐方式
+ * @param pad 右对齐时的填充字符
+ * @param reverse 是否反向显示
+ * @return int 成功返回0，参数错误返回-1
+ */
+int lcd_number_slot_init(lcd_number_slot_t *slot, int x, int y, uint8_t cells, const lcd_font_t *font,
+    lcd_number_align_t align, char pad, bool reverse)
+{
+    if (!slot || !font || cells == 0 || cells > CONFIG_LCD_NUMBER_SLOT_MAX_CELLS)
+    {
+        ESP_LOGE(TAG, "Invalid parameters for number slot init");
+        return -1;
+    }
+
+    memset(slot, 0, sizeof(lcd_number_slot_t));
+    slot->x = x;
+    slot->y = y;
+    slot->cells = cells;
+    slot->align = align;
+    slot->pad = pad ? pad : ' ';
+    slot->reverse = reverse;
+    slot->font = font;
+
+    return 0;
+}
+
+/**
+ * @brief 使显示槽的内容失效
+ *
+ * @param slot 显示槽
+ */
+void lcd_number_slot_invalidate(lcd_number_slot_t *slot)
+{
+    if (slot)
+    {
+        slot->valid = false;
+    }
+}
+
+/**
+ * @brief 重绘一个字符格
+ *
+ * @param disp
+ * @param slot
+ * @param x 字符格的位置X
+ * @param ch 字符
+ */
+static void draw_cell(lcd_handle_t disp, const lcd_number_slot_t *slot, int x, char ch)
+{
+    const lcd_font_t *font = slot->font;
+    uint8_t code_buf[CONFIG_LCD_DISPLAY_GLYPH_BUF_SIZE];
+    bool found = lcd_get_font_code(font, (uint8_t)ch, code_buf) != NULL;
+
+    // 等宽字体的字模覆盖整个字符格，直接覆盖即可；
+    // 比例字体只画边界框，字体中没有的字符显示为空白，这两种情况都要先清除字符格
+    if (!found || font->get_glyph)
+    {
+        lcd_fill_area(disp, x, slot->y, font->width, font->height, slot->reverse ? 1 : 0);
+    }
+
+    if (found)
+    {
+        lcd_display_char(disp, x, slot->y, (uint8_t)ch, font, slot->reverse);
+    }
+}
+
+/**
+ * @brief 在显示槽中显示文本
+ *
+ * @param disp LCD显示句柄
+ * @param slot 显示槽
+ * @param text ASCII文本
+ * @param changed 输出重绘的区域
+ * @return int 返回重绘的字符格数，失败返回-1
+ */
+int lcd_number_slot_show_text(lcd_handle_t disp, lcd_number_slot_t *slot, const char *text, lcd_rect_t *changed)
+{
+    if (changed)
+    {
+        memset(changed, 0, sizeof(lcd_rect_t));
+    }
+
+    if (!disp || !slot || !slot->font || !text)
+    {
+        return -1;
+    }
+
+    int len = strlen(text);
+    if (len > slot->cells)
+    {
+        ESP_LOGW(TAG, "Text '%s' exceeds %d cells", text, slot->cells);
+        return -1;
+    }
+
+    // 按对齐方式得到每个字符格的内容
+    char cell[CONFIG_LCD_NUMBER_SLOT_MAX_CELLS];
+    int blank = slot->cells - len;
+    if (slot->align == LCD_NUMBER_ALIGN_LEFT)
+    {
+        memcpy(cell, text, len);
+        memset(cell + len, ' ', blank);
+    }
+    else
+    {
+        memset(cell, slot->pad, blank);
+        memcpy(cell + blank, text, len);
+    }
+
+    int width = slot->font->width;
+    int first = -1, last = -1;
+    int redrawn = 0;
+
+    for (int i = 0; i < slot->cells; i++)
+    {
+        if (slot->valid && slot->text[i] == cell[i])
+        {
+            continue;
+        }
+
+        draw_cell(disp, slot, slot->x + i * width, cell[i]);
+        slot->text[i] = cell[i];
+        if (first < 0)
+        {
+            first = i;
+        }
+        last = i;
+        redrawn++;
+    }
+
+    slot->valid = true;
+
+    if (changed && first >= 0)
+    {
+        changed->x = slot->x + first * width;
+        changed->y = slot->y;
+        changed->width = (last - first + 1) * width;
+        changed->height = slot->font->height;
+    }
+
+    return redrawn;
+}
+
+/**
+ * @brief 在显示槽中显示整数或定点小数
+ *
+ * @param disp LCD显示句柄
+ * @param slot 显示槽
+ * @param value 数值
+ * @param decimals 小数位数
+ * @param changed 输出重绘的区域
+ * @return int 返回重绘的字符格数，失败返回-1
+ */
+int lcd_number_slot_show_int(lcd_handle_t disp, lcd_number_slot_t *slot, int32_t value, uint8_t decimals, lcd_rect_t *changed)
+{
+    if (!slot || decimals > 9)
+    {
+        return -1;
+    }
+
+    // 从低位到高位取出数字，至少保留 decimals + 1 位，例如 5 + 1位小数为 "0.5"
+    char digits[12];
+    int n = 0;
+    uint32_t v = (value < 0) ? (uint32_t)0 - (uint32_t)value : (uint32_t)value;
+    do
+    {
+        digits[n++] = '0' + v % 10;
+        v /= 10;
+    } while (v || n <= decimals);
+
+    bool negative = value < 0;
+    int len = n + (decimals ? 1 : 0) + (negative ? 1 : 0);
+    if (len > slot->cells)
+    {
+        ESP_LOGW(TAG, "Value %ld exceeds %d cells", (long)value, slot->cells);
+        return -1;
+    }
+
+    char text[CONFIG_LCD_NUMBER_SLOT_MAX_CELLS + 1];
+    char *p = text;
+
+    if (negative)
+    {
+        *p++ = '-';
+    }
+
+    // 补0时填在符号之后
+    if (slot->align == LCD_NUMBER_ALIGN_RIGHT && slot->pad == '0')
+    {
+        memset(p, '0', slot->cells - len);
+        p += slot->cells - len;
+    }
+
+    while (n > 0)
+    {
+        if (n == decimals)
+        {
+            *p++ = '.';
+        }
+        *p++ = digits[--n];
+    }
+    *p = '\0';
+
+    return lcd_number_slot_show_text(disp, slot, text, changed);
+}
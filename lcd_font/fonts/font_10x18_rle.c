@@ -0,0 +1,659 @@
+
+#include "lcd_font_type.h"
+
+/**
+ * @brief 字体名称 ascii_10x18_rle
+ * 由 lcd_font_packer.py --rle 从 ascii_10x18 生成，请勿手工修改
+ * 
+ */
+LCD_FONT_DATA_DEFINE(ascii_10x18_rle)
+{
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,	/* 0 */
+	0xff, 0xf7, 0x72, 0x93, 0x21, 0x25, 0x21, 0x27, 0x1f, 0x21, 0x11, 0x11, 0x55, 0x63, 0x49, 0x27,
+	0xf6,	/* 1 */
+	0xff, 0xf7, 0x72, 0x17, 0x13, 0x21, 0x25, 0x21, 0x27, 0x1f, 0x21, 0x11, 0x11, 0x55, 0x63, 0x41,
+	0x71, 0x27, 0xf6,	/* 2 */
+	0xff, 0xf8, 0x13, 0x14, 0x31, 0x32, 0x92, 0x73, 0x74, 0x55, 0x56, 0x37, 0x38, 0x1f, 0xf4,	/* 3 */
+	0xff, 0xf0, 0x18, 0x37, 0x36, 0x55, 0x54, 0x74, 0x55, 0x56, 0x37, 0x38, 0x1f, 0xf4,	/* 4 */
+	0xff, 0xff, 0x42, 0x74, 0x72, 0x62, 0x32, 0x24, 0x14, 0x22, 0x11, 0x12, 0x61, 0x83, 0x65, 0xff,
+	0x20,	/* 5 */
+	0xff, 0xf0, 0x18, 0x36, 0x55, 0x54, 0x72, 0x91, 0x92, 0x21, 0x11, 0x26, 0x18, 0x36, 0x5f, 0xf2,	/* 6 */
+	0xff, 0xf9, 0x27, 0x46, 0x45, 0x64, 0x65, 0x46, 0x47, 0x2f, 0xff, 0x90,	/* 7 */
+	0x0f, 0xff, 0x92, 0x74, 0x64, 0x56, 0x46, 0x54, 0x64, 0x72, 0xff, 0xf9,	/* 8 */
+	0xff, 0xf9, 0x27, 0x4f, 0x02, 0x22, 0xe2, 0x22, 0xf0, 0x47, 0x2f, 0xfe,	/* 9 */
+	0x0a, 0xff, 0xe2, 0x74, 0xf0, 0x22, 0x2e, 0x22, 0x2f, 0x04, 0x72, 0xff, 0xe0,	/* 10 */
+	0xf9, 0x64, 0x66, 0x45, 0x21, 0x24, 0x22, 0x22, 0x45, 0x22, 0x23, 0x24, 0x22, 0x24, 0x22, 0x24,
+	0x23, 0x22, 0x25, 0x4f, 0xfe,	/* 11 */
+	0xff, 0x34, 0x52, 0x22, 0x32, 0x42, 0x22, 0x42, 0x22, 0x42, 0x32, 0x22, 0x54, 0x72, 0x82, 0x66,
+	0x62, 0x82, 0xff, 0x40,	/* 12 */
+	0xff, 0x45, 0x63, 0x73, 0x74, 0xff, 0xf8, 0x27, 0x19, 0x12, 0x17, 0x2f, 0xb0,	/* 13 */
+	0xff, 0x36, 0x54, 0x64, 0x64, 0xff, 0x82, 0x71, 0x52, 0x21, 0x21, 0x11, 0x52, 0x21, 0x21, 0x72,
+	0xfc,	/* 14 */
+	0xff, 0x51, 0x61, 0x21, 0x21, 0x41, 0x11, 0x11, 0x31, 0x11, 0x11, 0x11, 0x11, 0x27, 0x53, 0xf2,
+	0x35, 0x72, 0x11, 0x11, 0x11, 0x11, 0x13, 0x11, 0x11, 0x14, 0x12, 0x12, 0x1f, 0xf1,	/* 15 */
+	0x81, 0x82, 0x73, 0x64, 0x55, 0x46, 0x37, 0x28, 0x19, 0x28, 0x37, 0x46, 0x55, 0x64, 0x73, 0x82,
+	0x91, 0xb0,	/* 16 */
+	0x11, 0x92, 0x83, 0x74, 0x65, 0x56, 0x47, 0x38, 0x29, 0x18, 0x27, 0x36, 0x45, 0x54, 0x63, 0x72,
+	0x81, 0xf3,	/* 17 */
+	0xff, 0xe2, 0x74, 0x56, 0x38, 0x52, 0x82, 0x82, 0x58, 0x36, 0x54, 0x72, 0xff, 0x40,	/* 18 */
+	0xc2, 0x22, 0xff, 0xff, 0xff, 0x42, 0x22, 0xe2, 0x22, 0xe2, 0x22, 0xf7,	/* 19 */
+	0xd7, 0x21, 0x22, 0x21, 0x11, 0xfe, 0x1a, 0x1f, 0xff, 0xe1, 0x61, 0x23, 0x23, 0xff, 0x00,	/* 20 */
+	0xf7, 0x54, 0x23, 0x23, 0x23, 0x23, 0x28, 0x29, 0x54, 0x23, 0x23, 0x23, 0x24, 0x59, 0x28, 0x23,
+	0x23, 0x23, 0x23, 0x24, 0x5f, 0x80,	/* 21 */
+	0xff, 0xff, 0xff, 0xff, 0x18, 0xf7, 0x8f, 0x60,	/* 22 */
+	0xf9, 0x27, 0x45, 0x63, 0x85, 0x28, 0x28, 0x25, 0x83, 0x65, 0x47, 0x25, 0x82, 0x8f, 0xf1,	/* 23 */
+	0xff, 0x42, 0x74, 0x56, 0x38, 0x52, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xff, 0x40,	/* 24 */
+	0xff, 0x42, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x58, 0x36, 0x54, 0x72, 0xff, 0x40,	/* 25 */
+	0xff, 0xf0, 0x19, 0x28, 0x33, 0x82, 0x86, 0x37, 0x28, 0x1f, 0xff, 0xf4,	/* 26 */
+	0xff, 0xf9, 0x18, 0x27, 0x36, 0x82, 0x83, 0x38, 0x29, 0x1f, 0xff, 0xa0,	/* 27 */
+	0xff, 0xf6, 0x2f, 0xf0, 0x6c, 0x8f, 0xff, 0xfb,	/* 28 */
+	0xff, 0xf8, 0x12, 0x15, 0x22, 0x23, 0x32, 0x31, 0xf5, 0x13, 0x23, 0x32, 0x22, 0x51, 0x21, 0xff,
+	0xf8,	/* 29 */
+	0xff, 0xfa, 0x19, 0x18, 0x37, 0x36, 0x55, 0x54, 0x73, 0x72, 0x91, 0x9f, 0xf0,	/* 30 */
+	0xff, 0xf6, 0x91, 0x92, 0x73, 0x74, 0x55, 0x56, 0x37, 0x38, 0x19, 0x1f, 0xf4,	/* 31 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,	/* 32 */
+	0xe2, 0xff, 0xff, 0xff, 0x82, 0x82, 0xf3, 0x2f, 0xf4,	/* 33 */
+	0xb2, 0x32, 0x24, 0x14, 0x14, 0x14, 0x32, 0x32, 0x32, 0x32, 0x22, 0x32, 0x31, 0x41, 0xff, 0xff,
+	0xff, 0xd0,	/* 34 */
+	0xc2, 0x22, 0xd1, 0x22, 0x21, 0xc1, 0x22, 0x21, 0xff, 0x21, 0x22, 0x21, 0xc1, 0x22, 0x21, 0xd2,
+	0x22, 0xff, 0xc0,	/* 35 */
+	0xe2, 0x65, 0x56, 0x32, 0x15, 0x22, 0x12, 0x12, 0x22, 0x12, 0x21, 0x34, 0x84, 0x62, 0x12, 0x21,
+	0x22, 0x12, 0x22, 0x12, 0x12, 0x27, 0x45, 0x72, 0xff, 0x40,	/* 36 */
+	0xc2, 0x32, 0x24, 0x12, 0x34, 0x12, 0x42, 0x12, 0x82, 0x72, 0x82, 0x72, 0x82, 0x12, 0x42, 0x14,
+	0x32, 0x14, 0x22, 0x32, 0xff, 0xf7,	/* 37 */
+	0xf0, 0x36, 0x54, 0x22, 0x24, 0x22, 0x25, 0x54, 0x45, 0x54, 0x31, 0x24, 0x22, 0x22, 0x11, 0x23,
+	0x41, 0x23, 0x32, 0x23, 0x24, 0x74, 0x32, 0x2f, 0xf0,	/* 38 */
+	0xc2, 0x74, 0x64, 0x82, 0x82, 0x72, 0x81, 0xff, 0xff, 0xff, 0xf2,	/* 39 */
+	0xf1, 0x27, 0x27, 0x28, 0x27, 0x28, 0x28, 0x28, 0x28, 0x28, 0x29, 0x28, 0x29, 0x29, 0x2f, 0xf2,	/* 40 */
+	0xc2, 0x92, 0x92, 0x82, 0x92, 0x82, 0x82, 0x82, 0x82, 0x82, 0x72, 0x82, 0x72, 0x72, 0xff, 0x60,	/* 41 */
+	0xff, 0x42, 0x51, 0x22, 0x21, 0x22, 0x12, 0x12, 0x36, 0x38, 0x36, 0x32, 0x12, 0x12, 0x21, 0x22,
+	0x21, 0x52, 0xff, 0xff, 0x40,	/* 42 */
+	0xff, 0x42, 0xff, 0x53, 0x23, 0xc3, 0x23, 0xff, 0x52, 0xff, 0xe0,	/* 43 */
+	0xff, 0xff, 0xff, 0xc2, 0x74, 0x64, 0x82, 0x82, 0x72, 0x72, 0x81, 0x80,	/* 44 */
+	0xff, 0xff, 0xf6, 0x8c, 0x8f, 0xff, 0xfb,	/* 45 */
+	0xff, 0xff, 0xff, 0xf8, 0x27, 0x46, 0x47, 0x2f, 0xf5,	/* 46 */
+	0xf2, 0x28, 0x27, 0x28, 0x27, 0x28, 0x27, 0x28, 0x27, 0x28, 0x27, 0x28, 0x27, 0x28, 0x2f, 0xf7,	/* 47 */
+	0xe3, 0x61, 0x31, 0x44, 0x51, 0x41, 0x11, 0x71, 0x82, 0xf2, 0x2f, 0x22, 0x81, 0x41, 0x21, 0x11,
+	0xa4, 0x41, 0x31, 0x63, 0xf9,	/* 48 */
+	0xf0, 0x18, 0x18, 0x18, 0x18, 0x11, 0x17, 0x2f, 0xff, 0xff, 0x33, 0x23, 0x28, 0xf6,	/* 49 */
+	0xd4, 0x56, 0x32, 0x33, 0x21, 0x52, 0x82, 0x82, 0x72, 0x72, 0x82, 0x72, 0x72, 0x72, 0x41, 0x28,
+	0x28, 0xff, 0x10,	/* 50 */
+	0xd3, 0x65, 0x41, 0x33, 0x82, 0x73, 0x72, 0x73, 0x83, 0x82, 0x92, 0x21, 0x52, 0x22, 0x42, 0x36,
+	0x54, 0xff, 0x30,	/* 51 */
+	0xf0, 0x27, 0x18, 0x18, 0x11, 0x1f, 0x11, 0x11, 0xf1, 0x11, 0x1f, 0x43, 0x22, 0xb5, 0x22, 0xfb,
+	0x2f, 0x80,	/* 52 */
+	0xd5, 0x55, 0x42, 0x82, 0x72, 0x86, 0x42, 0x23, 0x83, 0x82, 0x82, 0x82, 0x21, 0x52, 0x22, 0x32,
+	0x45, 0xff, 0x30,	/* 53 */
+	0xf0, 0x27, 0x27, 0x27, 0x28, 0x27, 0x28, 0x21, 0x34, 0x73, 0x32, 0x32, 0x24, 0x22, 0x24, 0x22,
+	0x33, 0x14, 0x56, 0x3f, 0xf4,	/* 54 */
+	0xd6, 0x37, 0x22, 0x42, 0x82, 0x72, 0x82, 0x72, 0x82, 0x72, 0x82, 0x72, 0x82, 0x72, 0x82, 0xff,
+	0x60,	/* 55 */
+	0xd4, 0x51, 0x32, 0x32, 0x42, 0x22, 0x42, 0x32, 0x31, 0x52, 0x11, 0x72, 0x71, 0x12, 0x51, 0x32,
+	0x32, 0x42, 0x22, 0x42, 0x22, 0x42, 0x32, 0x31, 0x54, 0xff, 0x30,	/* 56 */
+	0xe3, 0x61, 0x13, 0x41, 0x33, 0x22, 0x42, 0x22, 0x42, 0x22, 0x42, 0x23, 0x23, 0x34, 0x12, 0x42,
+	0x22, 0x82, 0x72, 0x82, 0x72, 0x72, 0x72, 0xfa,	/* 57 */
+	0xff, 0xd2, 0x74, 0x64, 0x72, 0xfd, 0x27, 0x46, 0x47, 0x2f, 0xff, 0x00,	/* 58 */
+	0xff, 0xff, 0x32, 0x74, 0x64, 0x72, 0xf3, 0x27, 0x46, 0x48, 0x27, 0x27, 0x28, 0x17,	/* 59 */
+	0xfb, 0x27, 0x27, 0x27, 0x27, 0x27, 0x28, 0x29, 0x29, 0x29, 0x29, 0x29, 0x2f, 0xfc,	/* 60 */
+	0xff, 0xff, 0x18, 0xc8, 0xc8, 0xc8, 0xff, 0xf6,	/* 61 */
+	0xf7, 0x29, 0x29, 0x29, 0x29, 0x29, 0x28, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2f, 0xff, 0x10,	/* 62 */
+	0xe3, 0x65, 0x43, 0x13, 0x31, 0x42, 0x82, 0x72, 0x72, 0x82, 0x72, 0x82, 0xfd, 0x28, 0x2f, 0xf4,	/* 63 */
+	0xf9, 0x35, 0x23, 0x16, 0x31, 0x12, 0x11, 0x11, 0x18, 0x1f, 0xfb, 0x17, 0x52, 0x11, 0x13, 0x25,
+	0x35, 0x24, 0x15, 0x4f, 0x70,	/* 64 */
+	0xf0, 0x19, 0x18, 0x37, 0x36, 0x21, 0x25, 0x21, 0x25, 0x22, 0x23, 0x23, 0x23, 0x73, 0x23, 0x22,
+	0x24, 0x22, 0x25, 0x21, 0x25, 0x63, 0x3f, 0xf0,	/* 65 */
+	0xa6, 0x41, 0x24, 0xa1, 0xfc, 0x11, 0x15, 0x28, 0x31, 0x18, 0x11, 0x1f, 0xf7, 0x11, 0x11, 0x12,
+	0x31, 0x12, 0x7f, 0x80,	/* 66 */
+	0xe4, 0x54, 0x11, 0x32, 0x31, 0xa1, 0x21, 0xff, 0xfe, 0x1b, 0x14, 0x13, 0x11, 0x12, 0x24, 0x11,
+	0x36, 0x3f, 0x80,	/* 67 */
+	0xa6, 0x41, 0x22, 0x12, 0x71, 0xa1, 0x11, 0xff, 0xff, 0xf4, 0x16, 0x32, 0x12, 0x43, 0x5f, 0xa0,	/* 68 */
+	0xb8, 0x21, 0x24, 0xf5, 0x1f, 0x31, 0x63, 0x73, 0xa1, 0xff, 0x01, 0xc1, 0x24, 0x38, 0xf6,	/* 69 */
+	0xb8, 0x21, 0x24, 0xf5, 0x1f, 0x31, 0x63, 0x73, 0xa1, 0xff, 0xd1, 0x21, 0x64, 0xfa,	/* 70 */
+	0xe4, 0x54, 0x11, 0x32, 0x31, 0xa1, 0x21, 0xff, 0xd5, 0x52, 0x21, 0x11, 0xb1, 0x81, 0x11, 0x81,
+	0x14, 0x53, 0xf8,	/* 71 */
+	0xa4, 0x25, 0x21, 0x21, 0x21, 0xff, 0xd4, 0x64, 0xff, 0xf8, 0x12, 0x12, 0x12, 0x52, 0x4f, 0x50,	/* 72 */
+	0xc6, 0x42, 0x22, 0xff, 0xff, 0xff, 0xf9, 0x22, 0x24, 0x6f, 0x70,	/* 73 */
+	0xc6, 0x42, 0x22, 0xff, 0xff, 0xff, 0xfc, 0x15, 0x48, 0x17, 0x27,	/* 74 */
+	0xa4, 0x32, 0x22, 0x32, 0x32, 0x22, 0x42, 0x12, 0x54, 0x63, 0x73, 0x74, 0x64, 0x62, 0x12, 0x52,
+	0x22, 0x42, 0x32, 0x32, 0x42, 0x14, 0x42, 0xff, 0x00,	/* 75 */
+	0xb4, 0x61, 0x21, 0xff, 0xff, 0xff, 0xd1, 0xc1, 0x24, 0x38, 0xf6,	/* 76 */
+	0xa3, 0x53, 0x61, 0x11, 0x31, 0x21, 0xf1, 0x4f, 0x22, 0xff, 0xff, 0x41, 0x21, 0x21, 0x25, 0x24,
+	0xf5,	/* 77 */
+	0xa4, 0x25, 0x21, 0x21, 0x21, 0xd1, 0xa1, 0xf3, 0x11, 0x1f, 0x31, 0x11, 0xf3, 0x1a, 0x1d, 0x12,
+	0x12, 0x12, 0x52, 0x4f, 0x50,	/* 78 */
+	0xe2, 0x72, 0x12, 0x42, 0x11, 0xa1, 0x11, 0x21, 0xff, 0xfe, 0x16, 0x14, 0x18, 0x11, 0x11, 0x25,
+	0x11, 0x27, 0x2f, 0x90,	/* 79 */
+	0xa7, 0x31, 0x23, 0x11, 0x81, 0x11, 0xfc, 0x11, 0x14, 0x31, 0x15, 0x4f, 0xff, 0x81, 0x21, 0x64,
+	0xfb,	/* 80 */
+	0xe3, 0x63, 0x11, 0x42, 0xc1, 0x11, 0x21, 0xff, 0xf4, 0x11, 0x1a, 0x11, 0x11, 0x13, 0x12, 0x11,
+	0x15, 0x12, 0x16, 0x12, 0x15, 0x37, 0x12, 0x11, 0x27, 0x31,	/* 81 */
+	0xa7, 0x31, 0x23, 0x11, 0x81, 0x11, 0xfe, 0x14, 0x57, 0x26, 0x11, 0x1a, 0x17, 0x12, 0x17, 0x12,
+	0x17, 0x12, 0x22, 0x13, 0x12, 0x44, 0x2f, 0x50,	/* 82 */
+	0xd5, 0x42, 0x32, 0x22, 0x51, 0x22, 0x82, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x21, 0x52, 0x22,
+	0x32, 0x45, 0xff, 0x30,	/* 83 */
+	0xb8, 0x32, 0x22, 0x31, 0x61, 0xff, 0xff, 0xff, 0xd2, 0x22, 0x46, 0xf7,	/* 84 */
+	0xa4, 0x25, 0x21, 0x21, 0x21, 0xff, 0xff, 0xff, 0x31, 0x21, 0x11, 0x21, 0x22, 0x61, 0x41, 0x54,
+	0xf8,	/* 85 */
+	0xa3, 0x43, 0x21, 0x41, 0x21, 0x11, 0x41, 0x11, 0xf6, 0x11, 0x12, 0x11, 0x1f, 0x81, 0x41, 0x62,
+	0xf2, 0x12, 0x1f, 0xc2, 0xf9,	/* 86 */
+	0xa3, 0x43, 0x21, 0x41, 0xf9, 0x17, 0x16, 0x11, 0x14, 0x2f, 0x21, 0x21, 0x71, 0x31, 0x21, 0x31,
+	0xff, 0x62, 0x22, 0xf7,	/* 87 */
+	0xa4, 0x14, 0x22, 0x32, 0x32, 0x32, 0x42, 0x12, 0x52, 0x12, 0x52, 0x12, 0x63, 0x73, 0x62, 0x12,
+	0x52, 0x12, 0x52, 0x12, 0x42, 0x32, 0x32, 0x32, 0x24, 0x14, 0xff, 0x10,	/* 88 */
+	0xa4, 0x25, 0x21, 0x21, 0x21, 0xb1, 0x11, 0x21, 0x11, 0xd1, 0x12, 0x11, 0x51, 0x21, 0xff, 0xff,
+	0x61, 0x21, 0x64, 0xf8,	/* 89 */
+	0xc7, 0x31, 0x42, 0x82, 0x72, 0x82, 0x72, 0x82, 0x72, 0x82, 0x72, 0x82, 0x72, 0x82, 0x41, 0x37,
+	0xff, 0x10,	/* 90 */
+	0xd5, 0xf2, 0x3f, 0xff, 0xff, 0xff, 0x23, 0xf0, 0x5c,	/* 91 */
+	0xa2, 0x92, 0x82, 0x92, 0x82, 0x92, 0x82, 0x92, 0x82, 0x92, 0x82, 0x92, 0x82, 0x92, 0x82, 0x92,
+	0xa0,	/* 92 */
+	0xc5, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0x23, 0xf2, 0x5d,	/* 93 */
+	0xe2, 0x74, 0x52, 0x22, 0x32, 0x42, 0xff, 0xff, 0xff, 0xff, 0xb0,	/* 94 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x5a,	/* 95 */
+	0x51, 0x82, 0x72, 0x82, 0x84, 0x64, 0x72, 0xff, 0xff, 0xff, 0xf9,	/* 96 */
+	0xff, 0xf8, 0x54, 0x11, 0x31, 0x14, 0x18, 0x12, 0x25, 0x54, 0x11, 0x2f, 0xd1, 0x21, 0x41, 0x23,
+	0x21, 0x24, 0x13, 0xf5,	/* 97 */
+	0x21, 0x81, 0x81, 0x91, 0xf9, 0x27, 0x12, 0x15, 0x32, 0x14, 0x12, 0x1f, 0xf6, 0x1a, 0x11, 0x11,
+	0x13, 0x21, 0x11, 0x13, 0x12, 0x3f, 0x80,	/* 98 */
+	0xff, 0xf8, 0x45, 0x21, 0x34, 0x13, 0x23, 0x28, 0x28, 0x28, 0x28, 0x33, 0x14, 0x22, 0x25, 0x4f,
+	0xf3,	/* 99 */
+	0x72, 0x71, 0x91, 0xfc, 0x26, 0x31, 0x16, 0x11, 0x15, 0x14, 0x1f, 0xf6, 0x12, 0x14, 0x13, 0x25,
+	0x11, 0x23, 0x13, 0x22, 0x3f, 0x50,	/* 100 */
+	0xff, 0xf9, 0x26, 0x22, 0x23, 0x24, 0x22, 0x24, 0x22, 0x82, 0x28, 0x29, 0x29, 0x22, 0x25, 0x3f,
+	0xf3,	/* 101 */
+	0x53, 0x63, 0x11, 0xe1, 0x32, 0xff, 0x22, 0x23, 0x32, 0x23, 0xff, 0xf9, 0x12, 0x16, 0x4f, 0x90,	/* 102 */
+	0xff, 0xf8, 0x32, 0x13, 0x21, 0x42, 0x23, 0x23, 0x23, 0x24, 0x21, 0x25, 0x45, 0x28, 0x74, 0x73,
+	0x14, 0x22, 0x16, 0x12, 0x74, 0x53,	/* 103 */
+	0x31, 0x81, 0x81, 0x91, 0xf8, 0x36, 0x22, 0x15, 0x11, 0x1f, 0xff, 0xf4, 0x12, 0x11, 0x12, 0x11,
+	0x41, 0x4f, 0x50,	/* 104 */
+	0xe2, 0xf3, 0x2f, 0x14, 0x62, 0xff, 0xff, 0xf3, 0x22, 0x24, 0x6f, 0x70,	/* 105 */
+	0xf2, 0x2f, 0x32, 0xf1, 0x46, 0x2f, 0xff, 0xf4, 0x1a, 0x1a, 0x17, 0x12, 0x31, 0x13, 0x13, 0x22,	/* 106 */
+	0x12, 0x73, 0x82, 0x82, 0x82, 0x82, 0x33, 0x22, 0x22, 0x42, 0x12, 0x54, 0x63, 0x74, 0x62, 0x12,
+	0x52, 0x13, 0x42, 0x23, 0x24, 0x23, 0xff, 0x10,	/* 107 */
+	0x24, 0x62, 0xff, 0xff, 0xff, 0xff, 0x82, 0x22, 0x46, 0xf7,	/* 108 */
+	0xff, 0xf5, 0x21, 0x21, 0x31, 0x11, 0x21, 0x2f, 0xff, 0xfd, 0x18, 0x41, 0x21, 0x3f, 0x50,	/* 109 */
+	0xff, 0xf6, 0x21, 0x45, 0x11, 0x12, 0x12, 0x12, 0x11, 0x1f, 0xff, 0xf4, 0x12, 0x11, 0x12, 0x11,
+	0x41, 0x4f, 0x50,	/* 110 */
+	0xff, 0xf7, 0x45, 0x22, 0x23, 0x24, 0x22, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21, 0x34,
+	0x22, 0x32, 0x24, 0x4f, 0xf4,	/* 111 */
+	0xff, 0xf5, 0x21, 0x43, 0x11, 0x11, 0x18, 0x11, 0x11, 0x18, 0x11, 0x1f, 0xf4, 0x1a, 0x11, 0x11,
+	0x16, 0x11, 0x15, 0x4d, 0x12, 0x16,	/* 112 */
+	0xff, 0xf9, 0x31, 0x23, 0x11, 0x11, 0x11, 0x12, 0x11, 0x16, 0x11, 0x12, 0x1f, 0xf6, 0x17, 0x12,
+	0x11, 0x15, 0x12, 0x17, 0x4f, 0x41, 0x21,	/* 113 */
+	0xff, 0xf6, 0x32, 0x23, 0x13, 0x21, 0x15, 0x28, 0x12, 0x2f, 0xff, 0x71, 0x21, 0x64, 0xfa,	/* 114 */
+	0xff, 0xf7, 0x63, 0x23, 0x23, 0x24, 0x13, 0x38, 0x39, 0x38, 0x33, 0x14, 0x23, 0x23, 0x23, 0x6f,
+	0xf3,	/* 115 */
+	0xf9, 0x1f, 0x31, 0x72, 0x24, 0x22, 0x24, 0xff, 0xff, 0x61, 0x21, 0x41, 0x23, 0x54, 0xf7,	/* 116 */
+	0xff, 0xf5, 0x41, 0x41, 0x12, 0x11, 0x12, 0x1f, 0xff, 0xf4, 0x11, 0x15, 0x12, 0x11, 0x11, 0x13,
+	0x41, 0x2f, 0x60,	/* 117 */
+	0xff, 0xf5, 0x43, 0x31, 0x25, 0x22, 0x23, 0x23, 0x23, 0x24, 0x22, 0x24, 0x21, 0x26, 0x46, 0x47,
+	0x28, 0x2f, 0xf3,	/* 118 */
+	0xff, 0xf5, 0x33, 0x42, 0x13, 0x12, 0x1f, 0xf0, 0x11, 0x11, 0x11, 0x11, 0x1e, 0x11, 0x11, 0x13,
+	0x12, 0x1f, 0x22, 0x12, 0xf8,	/* 119 */
+	0xff, 0xf5, 0x41, 0x42, 0x23, 0x24, 0x21, 0x25, 0x21, 0x26, 0x37, 0x36, 0x21, 0x24, 0x22, 0x24,
+	0x23, 0x22, 0x41, 0x4f, 0xf1,	/* 120 */
+	0xff, 0xf5, 0x42, 0x41, 0x24, 0x23, 0x22, 0x25, 0x21, 0x25, 0x47, 0x37, 0x28, 0x28, 0x28, 0x27,
+	0x26, 0x46, 0x36,	/* 121 */
+	0xff, 0xf6, 0x82, 0x24, 0x22, 0x14, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x12, 0x24, 0x22, 0x8f,
+	0xf1,	/* 122 */
+	0x53, 0x62, 0x82, 0x82, 0x82, 0x82, 0x72, 0x63, 0x92, 0x92, 0x82, 0x82, 0x82, 0x82, 0x93, 0xff,
+	0x20,	/* 123 */
+	0x42, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x24,	/* 124 */
+	0x23, 0x92, 0x82, 0x82, 0x82, 0x82, 0x92, 0x93, 0x62, 0x72, 0x82, 0x82, 0x82, 0x82, 0x63, 0xff,
+	0x50,	/* 125 */
+	0xd2, 0x31, 0x34, 0x12, 0x22, 0x14, 0x31, 0x32, 0xff, 0xff, 0xff, 0xff, 0xd0,	/* 126 */
+	0xff, 0xff, 0xf9, 0x27, 0x45, 0x22, 0x23, 0x24, 0x2f, 0x86, 0x38, 0xf6,	/* 127 */
+#if CONFIG_LCD_FONT_EXTENDED_ASCII
+	0xd5, 0x45, 0x11, 0x22, 0x41, 0xa1, 0xff, 0xf8, 0x15, 0x12, 0x11, 0x13, 0x23, 0x11, 0x45, 0x11,
+	0x27, 0x29, 0x2f, 0x14, 0x30,	/* 128 */
+	0xd2, 0x12, 0xf0, 0x21, 0x2d, 0x41, 0x32, 0x12, 0x11, 0x11, 0x1f, 0xff, 0xf5, 0x11, 0x15, 0x12,
+	0x44, 0x32, 0x1f, 0x60,	/* 129 */
+	0xf2, 0x18, 0x18, 0x1f, 0x32, 0x62, 0x22, 0x32, 0x42, 0x22, 0x42, 0x28, 0x22, 0x82, 0x92, 0x92,
+	0x22, 0x53, 0xff, 0x30,	/* 130 */
+	0x51, 0x83, 0x62, 0x12, 0x42, 0x32, 0xe5, 0x42, 0x32, 0x31, 0x42, 0x64, 0x33, 0x22, 0x22, 0x42,
+	0x22, 0x42, 0x22, 0x42, 0x23, 0x23, 0x34, 0x13, 0xff, 0x00,	/* 131 */
+	0xd2, 0x12, 0x52, 0x12, 0xfa, 0x54, 0x23, 0x23, 0x14, 0x26, 0x43, 0x32, 0x22, 0x24, 0x22, 0x24,
+	0x22, 0x24, 0x22, 0x32, 0x33, 0x41, 0x3f, 0xf0,	/* 132 */
+	0xd2, 0x92, 0x92, 0xf1, 0x54, 0x23, 0x23, 0x14, 0x26, 0x43, 0x32, 0x22, 0x24, 0x22, 0x24, 0x22,
+	0x24, 0x22, 0x32, 0x33, 0x41, 0x3f, 0xf0,	/* 133 */
+	0xe3, 0x62, 0x12, 0x63, 0xf1, 0x54, 0x23, 0x23, 0x14, 0x26, 0x43, 0x32, 0x22, 0x24, 0x22, 0x24,
+	0x22, 0x24, 0x22, 0x32, 0x33, 0x41, 0x3f, 0xf0,	/* 134 */
+	0xff, 0xf8, 0x54, 0x23, 0x23, 0x15, 0x12, 0x28, 0x28, 0x28, 0x34, 0x13, 0x24, 0x14, 0x57, 0x1a,
+	0x1a, 0x16, 0x33,	/* 135 */
+	0x51, 0x83, 0x62, 0x12, 0x42, 0x32, 0xf0, 0x26, 0x22, 0x23, 0x24, 0x22, 0x24, 0x22, 0x82, 0x28,
+	0x29, 0x29, 0x22, 0x25, 0x3f, 0xf3,	/* 136 */
+	0xc2, 0x12, 0x52, 0x12, 0xfc, 0x26, 0x22, 0x23, 0x24, 0x22, 0x24, 0x22, 0x82, 0x28, 0x29, 0x29,
+	0x22, 0x25, 0x3f, 0xf3,	/* 137 */
+	0xc2, 0x92, 0x92, 0xf3, 0x26, 0x22, 0x23, 0x24, 0x22, 0x24, 0x22, 0x82, 0x28, 0x29, 0x29, 0x22,
+	0x25, 0x3f, 0xf3,	/* 138 */
+	0xc2, 0x12, 0xf0, 0x21, 0x2f, 0x04, 0x62, 0xff, 0xff, 0xf3, 0x22, 0x24, 0x6f, 0x70,	/* 139 */
+	0x41, 0x83, 0x62, 0x12, 0x42, 0x32, 0xe4, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x66,
+	0xff, 0x20,	/* 140 */
+	0xc2, 0x92, 0x92, 0xf1, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x26, 0x6f, 0xf2,	/* 141 */
+	0x22, 0x32, 0xd2, 0x11, 0x12, 0xf0, 0x11, 0x1f, 0xb1, 0x13, 0xe1, 0x22, 0x73, 0xe1, 0x11, 0x32,
+	0xb1, 0x21, 0x22, 0x15, 0x24, 0xf5,	/* 142 */
+	0x51, 0x83, 0xf2, 0x37, 0x11, 0x1f, 0xb1, 0x13, 0xe1, 0x22, 0x73, 0xe1, 0x11, 0x32, 0xb1, 0x21,
+	0x22, 0x15, 0x24, 0xf5,	/* 143 */
+	0x62, 0x71, 0x11, 0x61, 0x11, 0x43, 0x23, 0x21, 0x24, 0xf5, 0x18, 0x16, 0x37, 0x3a, 0x1f, 0x51,
+	0xc1, 0x24, 0x38, 0xf6,	/* 144 */
+	0xff, 0xf7, 0x31, 0x32, 0x21, 0x22, 0x21, 0x12, 0x22, 0x24, 0x22, 0x22, 0x81, 0x21, 0x24, 0x22,
+	0x24, 0x22, 0x24, 0x31, 0x31, 0x21, 0x41, 0x3f, 0xf1,	/* 145 */
+	0xf0, 0x54, 0x12, 0x2f, 0x51, 0x32, 0xd1, 0x81, 0x91, 0x41, 0x11, 0x31, 0x42, 0xf1, 0x26, 0x1a,
+	0x11, 0x11, 0x12, 0x21, 0x31, 0x6f, 0x50,	/* 146 */
+	0xe1, 0x83, 0x62, 0x12, 0xf0, 0x45, 0x22, 0x23, 0x24, 0x22, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21,
+	0x25, 0x21, 0x34, 0x22, 0x32, 0x24, 0x4f, 0xf4,	/* 147 */
+	0xf7, 0x22, 0x24, 0x22, 0x2e, 0x45, 0x22, 0x23, 0x24, 0x22, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21,
+	0x25, 0x21, 0x34, 0x22, 0x32, 0x24, 0x4f, 0xf4,	/* 148 */
+	0xd2, 0x92, 0x92, 0xf0, 0x45, 0x22, 0x23, 0x24, 0x22, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21, 0x25,
+	0x21, 0x34, 0x22, 0x32, 0x24, 0x4f, 0xf4,	/* 149 */
+	0x41, 0x83, 0x62, 0x12, 0x42, 0x32, 0xc4, 0x14, 0x22, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+	0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x33, 0x13, 0x44, 0x12, 0xff, 0x10,	/* 150 */
+	0xb2, 0x81, 0x11, 0x81, 0x11, 0x82, 0x54, 0x14, 0x11, 0x21, 0x11, 0x21, 0xff, 0xff, 0x41, 0x11,
+	0x51, 0x21, 0x11, 0x11, 0x34, 0x12, 0xf6,	/* 151 */
+	0xc2, 0x22, 0x42, 0x22, 0xf7, 0x42, 0x41, 0x24, 0x23, 0x22, 0x25, 0x21, 0x25, 0x47, 0x37, 0x28,
+	0x28, 0x28, 0x27, 0x26, 0x46, 0x36,	/* 152 */
+	0x12, 0x42, 0xc2, 0x12, 0x12, 0x42, 0x12, 0x42, 0x11, 0xa1, 0x11, 0x21, 0xff, 0xf4, 0x16, 0x14,
+	0x18, 0x11, 0x11, 0x25, 0x11, 0x27, 0x2f, 0x90,	/* 153 */
+	0x22, 0x22, 0xe2, 0x22, 0x24, 0x34, 0x21, 0x31, 0x11, 0xff, 0xff, 0xd1, 0x32, 0x21, 0x23, 0x51,
+	0x41, 0x54, 0xf8,	/* 154 */
+	0xff, 0x52, 0xf1, 0x22, 0x23, 0x11, 0x12, 0x15, 0x14, 0x12, 0x1f, 0xfb, 0x17, 0x16, 0x13, 0x11,
+	0x12, 0x15, 0x22, 0x2f, 0x12, 0x30,	/* 155 */
+	0xd4, 0x53, 0x12, 0x42, 0x22, 0x42, 0x82, 0x82, 0x76, 0x46, 0x52, 0x82, 0x82, 0x82, 0x75, 0x21,
+	0x28, 0x21, 0x42, 0xf7,	/* 156 */
+	0xb1, 0x61, 0x21, 0x61, 0x31, 0x41, 0x42, 0x22, 0x42, 0x22, 0x54, 0x72, 0x66, 0x62, 0x66, 0x62,
+	0x82, 0x82, 0x82, 0xff, 0x40,	/* 157 */
+	0xa1, 0x16, 0x29, 0xd7, 0x36, 0x61, 0xf3, 0x11, 0x26, 0x11, 0x2f, 0xf1, 0x15, 0x51, 0x11, 0x12,
+	0x32, 0x3f, 0xc0,	/* 158 */
+	0xf1, 0x27, 0x45, 0x22, 0x1f, 0xf8, 0x14, 0x21, 0x33, 0x31, 0x24, 0x1f, 0xff, 0x31, 0x22, 0x54,
+	0x72, 0x70,	/* 159 */
+	0xf1, 0x27, 0x27, 0x2f, 0x25, 0x42, 0x32, 0x31, 0x42, 0x64, 0x33, 0x22, 0x22, 0x42, 0x22, 0x42,
+	0x22, 0x42, 0x23, 0x23, 0x34, 0x13, 0xff, 0x00,	/* 160 */
+	0xf1, 0x27, 0x11, 0x16, 0x11, 0x17, 0x26, 0x46, 0x2f, 0xff, 0xff, 0x32, 0x22, 0x46, 0xf7,	/* 161 */
+	0xf0, 0x27, 0x27, 0x2f, 0x24, 0x52, 0x22, 0x32, 0x42, 0x22, 0x52, 0x12, 0x52, 0x12, 0x52, 0x12,
+	0x52, 0x13, 0x42, 0x23, 0x22, 0x44, 0xff, 0x40,	/* 162 */
+	0xf0, 0x27, 0x11, 0x16, 0x11, 0x17, 0x25, 0x41, 0x41, 0x12, 0x11, 0x12, 0x1f, 0xff, 0xf4, 0x11,
+	0x15, 0x12, 0x11, 0x11, 0x13, 0x41, 0x2f, 0x60,	/* 163 */
+	0xc3, 0x31, 0x21, 0x33, 0x43, 0x31, 0x21, 0x33, 0x32, 0x14, 0x51, 0x11, 0x21, 0x21, 0x21, 0x11,
+	0xff, 0xff, 0x41, 0x21, 0x11, 0x21, 0x14, 0x14, 0xf5,	/* 164 */
+	0xc3, 0x31, 0x21, 0x33, 0x43, 0x31, 0x21, 0x33, 0x23, 0x35, 0x21, 0x21, 0x21, 0x41, 0xf3, 0x11,
+	0x1f, 0x31, 0x11, 0x81, 0xa1, 0x31, 0x21, 0x31, 0x15, 0x42, 0xf5,	/* 165 */
+	0xc5, 0x42, 0x32, 0x82, 0x64, 0x42, 0x22, 0x32, 0x32, 0x32, 0x32, 0x32, 0x23, 0x43, 0x13, 0xc8,
+	0xff, 0xff, 0x10,	/* 166 */
+	0xe3, 0x54, 0x11, 0x51, 0x21, 0x11, 0x21, 0xff, 0x61, 0x21, 0x11, 0x21, 0x51, 0x14, 0x53, 0x58,
+	0x28, 0xff, 0xf6,	/* 167 */
+	0xf0, 0x28, 0x2f, 0x32, 0x82, 0x72, 0x72, 0x72, 0x72, 0x82, 0x82, 0x51, 0x23, 0x23, 0x36, 0x54,
+	0xff, 0x30,	/* 168 */
+	0xff, 0xff, 0xf6, 0x8e, 0x6f, 0x72, 0xff, 0xf2,	/* 169 */
+	0xff, 0xff, 0xf6, 0x8c, 0x6f, 0xf0, 0x2f, 0xfb,	/* 170 */
+	0xc1, 0x81, 0x91, 0xf1, 0x18, 0x27, 0x23, 0x11, 0x11, 0x24, 0x57, 0x54, 0x72, 0x21, 0x11, 0x32,
+	0x13, 0x36, 0x29, 0x45, 0x5f, 0x60,	/* 171 */
+	0xc1, 0x82, 0x91, 0x91, 0x51, 0x31, 0x41, 0x41, 0x31, 0x43, 0x11, 0x81, 0x21, 0x51, 0x22, 0x41,
+	0x21, 0x11, 0x31, 0x21, 0x21, 0x56, 0x81, 0x91, 0xff, 0x20,	/* 172 */
+	0xe2, 0xf3, 0x28, 0x2f, 0xff, 0xff, 0xff, 0x32, 0xf9,	/* 173 */
+	0xff, 0xf9, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x26, 0x21, 0x26, 0x21, 0x26,
+	0x21, 0x26, 0x21, 0x2f, 0xfb,	/* 174 */
+	0xff, 0xf6, 0x21, 0x26, 0x21, 0x26, 0x21, 0x26, 0x21, 0x26, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24,
+	0x21, 0x24, 0x21, 0x2f, 0xfe,	/* 175 */
+	0x02, 0x42, 0x31, 0x51, 0x52, 0x41, 0x31, 0x53, 0x42, 0x31, 0x51, 0x52, 0x41, 0x31, 0x53, 0x42,
+	0x31, 0x51, 0x52, 0x41, 0x31, 0x53, 0x42, 0x31, 0x51, 0x52, 0x41, 0x31, 0x53, 0x42, 0x31, 0x51,
+	0x20,	/* 176 */
+	0x11, 0x00, 0xbb, 0x80, 0x11, 0x00, 0x44, 0x40, 0xee, 0xc0, 0x44, 0x40, 0x11, 0x00, 0xbb, 0x80,
+	0x11, 0x00, 0x44, 0x40, 0xee, 0xc0, 0x44, 0x40, 0x11, 0x00, 0xbb, 0x80, 0x11, 0x00, 0x44, 0x40,
+	0xee, 0xc0, 0x44, 0x40,	/* 177 */
+	0x24, 0x23, 0x15, 0x15, 0x24, 0x13, 0x15, 0x34, 0x23, 0x15, 0x15, 0x24, 0x13, 0x15, 0x34, 0x23,
+	0x15, 0x15, 0x24, 0x13, 0x15, 0x34, 0x23, 0x15, 0x15, 0x24, 0x13, 0x15, 0x34, 0x23, 0x15, 0x12,	/* 178 */
+	0x42, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,	/* 179 */
+	0x42, 0xff, 0xff, 0xe4, 0xf1, 0x4f, 0xff, 0xff, 0x10,	/* 180 */
+	0x42, 0xff, 0xe4, 0xf1, 0x46, 0x4f, 0x14, 0xff, 0xff, 0xf1,	/* 181 */
+	0x32, 0x12, 0xff, 0xff, 0xc3, 0xf2, 0x3f, 0xff, 0xff, 0x20,	/* 182 */
+	0xff, 0xff, 0xf5, 0x8c, 0x32, 0x1f, 0xff, 0xfe,	/* 183 */
+	0xff, 0xf5, 0x6e, 0x46, 0x4f, 0x14, 0xff, 0xff, 0xf1,	/* 184 */
+	0x32, 0x12, 0xff, 0xc3, 0xf2, 0x55, 0x5f, 0x03, 0xff, 0xff, 0xf2,	/* 185 */
+	0x32, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,	/* 186 */
+	0xff, 0xf5, 0x8c, 0x64, 0x5f, 0x03, 0xff, 0xff, 0xf2,	/* 187 */
+	0x32, 0x12, 0xff, 0xc3, 0xf2, 0x55, 0x6e, 0x8f, 0xff, 0xfc,	/* 188 */
+	0x32, 0x12, 0xff, 0xff, 0xc3, 0x21, 0xe8, 0xff, 0xff, 0xc0,	/* 189 */
+	0x42, 0xff, 0xe4, 0xf1, 0x46, 0x4f, 0x16, 0xff, 0xff, 0xe0,	/* 190 */
+	0xff, 0xff, 0xf5, 0x6e, 0x4f, 0xff, 0xff, 0x10,	/* 191 */
+	0x42, 0xff, 0xff, 0xf5, 0x4e, 0x6f, 0xff, 0xfa,	/* 192 */
+	0x42, 0xff, 0xff, 0xe4, 0x24, 0xaa, 0xff, 0xff, 0xa0,	/* 193 */
+	0xff, 0xff, 0xf5, 0xaa, 0x42, 0x4f, 0xff, 0xfa,	/* 194 */
+	0x42, 0xff, 0xff, 0xf5, 0x4f, 0x14, 0xff, 0xff, 0xa0,	/* 195 */
+	0xff, 0xff, 0xf5, 0xf5, 0xff, 0xff, 0xf5,	/* 196 */
+	0x42, 0xff, 0xff, 0xe4, 0x24, 0xa4, 0x24, 0xff, 0xff, 0xa0,	/* 197 */
+	0x42, 0xff, 0xf5, 0x4f, 0x14, 0x64, 0xf1, 0x4f, 0xff, 0xfa,	/* 198 */
+	0x32, 0x12, 0xff, 0xff, 0xf5, 0x2f, 0x32, 0xff, 0xff, 0xa0,	/* 199 */
+	0x32, 0x12, 0xff, 0xf5, 0x2f, 0x14, 0x55, 0xd7, 0xff, 0xff, 0xa0,	/* 200 */
+	0xff, 0xf8, 0x7f, 0x05, 0x64, 0xf3, 0x2f, 0xff, 0xfa,	/* 201 */
+	0x32, 0x12, 0xff, 0xc3, 0x52, 0xa5, 0x1e, 0xaa, 0xff, 0xff, 0xa0,	/* 202 */
+	0xff, 0xf5, 0xaa, 0xf0, 0x14, 0xa3, 0x52, 0xff, 0xff, 0xa0,	/* 203 */
+	0x32, 0x12, 0xff, 0xf5, 0x2f, 0x14, 0x64, 0xf3, 0x2f, 0xff, 0xfa,	/* 204 */
+	0xff, 0xf5, 0xf5, 0xaf, 0x5f, 0xff, 0xff, 0x50,	/* 205 */
+	0x32, 0x12, 0xff, 0xc3, 0x52, 0xa5, 0x19, 0x14, 0xa3, 0x52, 0xff, 0xff, 0xa0,	/* 206 */
+	0x42, 0xff, 0xe4, 0x24, 0xaf, 0x5a, 0xaf, 0xff, 0xfa,	/* 207 */
+	0x32, 0x12, 0xff, 0xff, 0xc3, 0x21, 0x22, 0xaa, 0xff, 0xff, 0xa0,	/* 208 */
+	0xff, 0xf5, 0xaa, 0xf5, 0xa4, 0x24, 0xff, 0xff, 0xa0,	/* 209 */
+	0xff, 0xff, 0xf5, 0xaa, 0x32, 0x12, 0x2f, 0xff, 0xfa,	/* 210 */
+	0x32, 0x12, 0xff, 0xff, 0xf2, 0x12, 0x2d, 0x7f, 0xff, 0xfa,	/* 211 */
+	0x42, 0xff, 0xf5, 0x4f, 0x14, 0x64, 0xe6, 0xff, 0xff, 0xa0,	/* 212 */
+	0xff, 0xf9, 0x6f, 0x14, 0x64, 0xf1, 0x4f, 0xff, 0xfa,	/* 213 */
+	0xff, 0xff, 0xf8, 0x7f, 0x01, 0x22, 0xff, 0xff, 0xa0,	/* 214 */
+	0x32, 0x12, 0xff, 0xff, 0xc3, 0x21, 0x22, 0xa3, 0x21, 0x22, 0xff, 0xff, 0xa0,	/* 215 */
+	0x42, 0xff, 0xe4, 0x24, 0xa4, 0x28, 0x24, 0xa4, 0x24, 0xff, 0xff, 0xa0,	/* 216 */
+	0x42, 0xff, 0xff, 0xe4, 0xf1, 0x6f, 0xff, 0xfe,	/* 217 */
+	0xff, 0xff, 0xf9, 0x6f, 0x14, 0xff, 0xff, 0xa0,	/* 218 */
+	0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,	/* 219 */
+	0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xa0,	/* 220 */
+	0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,	/* 221 */
+	0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,	/* 222 */
+	0x0f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xfa,	/* 223 */
+	0xff, 0xf8, 0x32, 0x13, 0x11, 0x12, 0x13, 0x11, 0x11, 0x21, 0x1f, 0xff, 0x71, 0x11, 0x11, 0x21,
+	0x31, 0x11, 0x12, 0x53, 0x21, 0xf6,	/* 224 */
+	0xd4, 0x51, 0x12, 0x11, 0x31, 0x11, 0x21, 0x11, 0xfc, 0x11, 0x15, 0x28, 0x2a, 0x11, 0x1f, 0xf7,
+	0x11, 0x15, 0x21, 0x13, 0x21, 0x3f, 0x80,	/* 225 */
+	0xb8, 0x44, 0xf5, 0x2f, 0xff, 0xff, 0xfc, 0x2f, 0xc0,	/* 226 */
+	0xff, 0xff, 0x18, 0x21, 0x22, 0x21, 0xff, 0xff, 0xd2, 0x22, 0xf7,	/* 227 */
+	0xf5, 0x92, 0x29, 0x28, 0x29, 0x28, 0x29, 0x28, 0x27, 0x27, 0x28, 0x24, 0x12, 0x24, 0x21, 0x9f,
+	0xf1,	/* 228 */
+	0xff, 0xff, 0xd7, 0x22, 0x12, 0x42, 0x32, 0x32, 0x42, 0x22, 0x42, 0x22, 0x42, 0x32, 0x22, 0x45,
+	0xff, 0x30,	/* 229 */
+	0xff, 0x12, 0x42, 0xff, 0xff, 0xe1, 0x21, 0x64, 0x72, 0x12, 0xff, 0x11, 0x11, 0x70,	/* 230 */
+	0xff, 0x72, 0x32, 0x15, 0x12, 0x11, 0x43, 0x11, 0x21, 0x31, 0xff, 0xff, 0xf8, 0x2f, 0x90,	/* 231 */
+	0xf6, 0x85, 0x28, 0x27, 0x45, 0x22, 0x23, 0x24, 0x22, 0x24, 0x22, 0x24, 0x23, 0x22, 0x25, 0x47,
+	0x28, 0x25, 0x8f, 0xf1,	/* 232 */
+	0xff, 0x43, 0x65, 0x42, 0x32, 0x32, 0x32, 0x22, 0x52, 0x19, 0x19, 0x12, 0x52, 0x22, 0x32, 0x32,
+	0x32, 0x45, 0x63, 0xff, 0x30,	/* 233 */
+	0xff, 0xd4, 0x52, 0x22, 0x32, 0x42, 0x12, 0x64, 0x64, 0x62, 0x12, 0x42, 0x32, 0x22, 0x42, 0x22,
+	0x42, 0x22, 0x42, 0x22, 0x24, 0x24, 0xf5,	/* 234 */
+	0xf0, 0x35, 0x63, 0x24, 0x22, 0x29, 0x29, 0x28, 0x26, 0x54, 0x22, 0x23, 0x24, 0x22, 0x24, 0x22,
+	0x24, 0x23, 0x22, 0x25, 0x47, 0x2f, 0xa0,	/* 235 */
+	0xff, 0xf7, 0x22, 0x23, 0x11, 0x41, 0x11, 0x11, 0x14, 0x11, 0x1f, 0xf0, 0x11, 0x14, 0x11, 0x11,
+	0x11, 0x41, 0x13, 0x22, 0x2f, 0xfc,	/* 236 */
+	0xf2, 0x28, 0x27, 0x28, 0x24, 0x21, 0x33, 0x21, 0x21, 0x21, 0x22, 0x22, 0x42, 0x22, 0x42, 0x22,
+	0x42, 0x22, 0x21, 0x21, 0x21, 0x23, 0x31, 0x24, 0x28, 0x27, 0x28, 0x2f, 0x20,	/* 237 */
+	0xf1, 0x35, 0x36, 0x28, 0x27, 0x28, 0x28, 0x73, 0x73, 0x28, 0x29, 0x28, 0x29, 0x39, 0x3f, 0xf1,	/* 238 */
+	0xff, 0xd4, 0x51, 0x12, 0x11, 0x31, 0x11, 0x21, 0x11, 0xff, 0xff, 0xf7, 0x24, 0x2f, 0x60,	/* 239 */
+	0xff, 0xf6, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8f, 0x60,	/* 240 */
+	0xf9, 0x2f, 0xf5, 0x32, 0x3c, 0x32, 0x3f, 0xf5, 0x25, 0x8c, 0x8f, 0x60,	/* 241 */
+	0xff, 0xf5, 0x39, 0x39, 0x39, 0x35, 0x35, 0x35, 0x3f, 0x28, 0x28, 0xff, 0x20,	/* 242 */
+	0xff, 0xfb, 0x35, 0x35, 0x35, 0x39, 0x39, 0x39, 0x3b, 0x91, 0x9f, 0xf1,	/* 243 */
+	0xf8, 0x45, 0x11, 0x21, 0x1f, 0x32, 0xff, 0xff, 0xff, 0xf9, 0x26,	/* 244 */
+	0xf8, 0x45, 0x11, 0x21, 0x1e, 0x2f, 0xff, 0xff, 0xff, 0xf2, 0x22,	/* 245 */
+	0xff, 0xf9, 0x28, 0x2f, 0xa8, 0x28, 0xfa, 0x28, 0x2f, 0xf4,	/* 246 */
+	0xff, 0xff, 0x23, 0x62, 0x12, 0x92, 0x12, 0x63, 0x33, 0x62, 0x12, 0x92, 0x12, 0x63, 0xff, 0xb0,	/* 247 */
+	0xd4, 0x52, 0x22, 0x42, 0x22, 0x54, 0xff, 0xff, 0xff, 0xff, 0xd0,	/* 248 */
+	0xff, 0xff, 0xf9, 0x27, 0x46, 0x47, 0x2f, 0xff, 0xf4,	/* 249 */
+	0xff, 0xff, 0xff, 0x42, 0x82, 0xff, 0xff, 0xe0,	/* 250 */
+	0xf9, 0x6f, 0x14, 0xff, 0xf5, 0x28, 0x11, 0x18, 0x11, 0x18, 0x1a, 0x1a, 0x2f, 0x90,	/* 251 */
+	0xc1, 0x23, 0x34, 0x12, 0x42, 0x31, 0x42, 0x31, 0x42, 0x31, 0x34, 0x13, 0xff, 0xff, 0xff, 0xf6,	/* 252 */
+	0xd4, 0x56, 0x32, 0x32, 0x31, 0x42, 0x72, 0x72, 0x72, 0x72, 0x41, 0x28, 0x28, 0xff, 0xff, 0xb0,	/* 253 */
+	0xff, 0x26, 0xff, 0xff, 0xff, 0xf9, 0x6f, 0x70,	/* 254 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,	/* 255 */
+#endif // CONFIG_LCD_FONT_EXTENDED_ASCII
+};
+
+/// 低15位为偏移，最高位为1表示按行异或后编码
+LCD_FONT_OFFSETS_DEFINE(ascii_10x18_rle)
+{
+	0x0000,	/* 0 */
+	0x8007,	/* 1 */
+	0x8018,	/* 2 */
+	0x002b,	/* 3 */
+	0x003a,	/* 4 */
+	0x0048,	/* 5 */
+	0x0059,	/* 6 */
+	0x0069,	/* 7 */
+	0x0075,	/* 8 */
+	0x8081,	/* 9 */
+	0x808d,	/* 10 */
+	0x009a,	/* 11 */
+	0x00af,	/* 12 */
+	0x80c3,	/* 13 */
+	0x80d0,	/* 14 */
+	0x00e1,	/* 15 */
+	0x00ff,	/* 16 */
+	0x0111,	/* 17 */
+	0x0123,	/* 18 */
+	0x8131,	/* 19 */
+	0x813d,	/* 20 */
+	0x014c,	/* 21 */
+	0x8162,	/* 22 */
+	0x016a,	/* 23 */
+	0x0179,	/* 24 */
+	0x0188,	/* 25 */
+	0x0197,	/* 26 */
+	0x01a3,	/* 27 */
+	0x81af,	/* 28 */
+	0x01b7,	/* 29 */
+	0x01c8,	/* 30 */
+	0x01d5,	/* 31 */
+	0x01e2,	/* 32 */
+	0x81e9,	/* 33 */
+	0x01f2,	/* 34 */
+	0x8204,	/* 35 */
+	0x0217,	/* 36 */
+	0x0231,	/* 37 */
+	0x0247,	/* 38 */
+	0x0260,	/* 39 */
+	0x026b,	/* 40 */
+	0x027b,	/* 41 */
+	0x028b,	/* 42 */
+	0x82a0,	/* 43 */
+	0x02ab,	/* 44 */
+	0x82b7,	/* 45 */
+	0x02be,	/* 46 */
+	0x02c7,	/* 47 */
+	0x82d7,	/* 48 */
+	0x82ec,	/* 49 */
+	0x02fa,	/* 50 */
+	0x030d,	/* 51 */
+	0x8320,	/* 52 */
+	0x0332,	/* 53 */
+	0x0345,	/* 54 */
+	0x035a,	/* 55 */
+	0x036b,	/* 56 */
+	0x0386,	/* 57 */
+	0x039e,	/* 58 */
+	0x03aa,	/* 59 */
+	0x03b8,	/* 60 */
+	0x83c6,	/* 61 */
+	0x03ce,	/* 62 */
+	0x03dd,	/* 63 */
+	0x83ed,	/* 64 */
+	0x0402,	/* 65 */
+	0x841a,	/* 66 */
+	0x842e,	/* 67 */
+	0x8441,	/* 68 */
+	0x8451,	/* 69 */
+	0x8460,	/* 70 */
+	0x846e,	/* 71 */
+	0x8481,	/* 72 */
+	0x8491,	/* 73 */
+	0x849c,	/* 74 */
+	0x04a7,	/* 75 */
+	0x84c0,	/* 76 */
+	0x84cb,	/* 77 */
+	0x84dc,	/* 78 */
+	0x84f1,	/* 79 */
+	0x8505,	/* 80 */
+	0x8516,	/* 81 */
+	0x8530,	/* 82 */
+	0x0548,	/* 83 */
+	0x855c,	/* 84 */
+	0x8568,	/* 85 */
+	0x8579,	/* 86 */
+	0x858e,	/* 87 */
+	0x05a2,	/* 88 */
+	0x85be,	/* 89 */
+	0x05d2,	/* 90 */
+	0x85e4,	/* 91 */
+	0x05ed,	/* 92 */
+	0x85fe,	/* 93 */
+	0x0607,	/* 94 */
+	0x0612,	/* 95 */
+	0x0619,	/* 96 */
+	0x8624,	/* 97 */
+	0x8638,	/* 98 */
+	0x064f,	/* 99 */
+	0x8660,	/* 100 */
+	0x0676,	/* 101 */
+	0x8687,	/* 102 */
+	0x0697,	/* 103 */
+	0x86ad,	/* 104 */
+	0x86c0,	/* 105 */
+	0x86cc,	/* 106 */
+	0x06dc,	/* 107 */
+	0x86f4,	/* 108 */
+	0x86fe,	/* 109 */
+	0x870d,	/* 110 */
+	0x0720,	/* 111 */
+	0x8735,	/* 112 */
+	0x874b,	/* 113 */
+	0x8762,	/* 114 */
+	0x0771,	/* 115 */
+	0x8782,	/* 116 */
+	0x8791,	/* 117 */
+	0x07a4,	/* 118 */
+	0x87b7,	/* 119 */
+	0x07cc,	/* 120 */
+	0x07e1,	/* 121 */
+	0x07f4,	/* 122 */
+	0x0805,	/* 123 */
+	0x8816,	/* 124 */
+	0x081e,	/* 125 */
+	0x082f,	/* 126 */
+	0x883c,	/* 127 */
+#if CONFIG_LCD_FONT_EXTENDED_ASCII
+	0x8848,	/* 128 */
+	0x885d,	/* 129 */
+	0x0871,	/* 130 */
+	0x0885,	/* 131 */
+	0x089f,	/* 132 */
+	0x08b7,	/* 133 */
+	0x08ce,	/* 134 */
+	0x08e6,	/* 135 */
+	0x08f9,	/* 136 */
+	0x090f,	/* 137 */
+	0x0923,	/* 138 */
+	0x8936,	/* 139 */
+	0x0944,	/* 140 */
+	0x0956,	/* 141 */
+	0x8965,	/* 142 */
+	0x897b,	/* 143 */
+	0x898f,	/* 144 */
+	0x09a3,	/* 145 */
+	0x89bc,	/* 146 */
+	0x09d3,	/* 147 */
+	0x09eb,	/* 148 */
+	0x0a03,	/* 149 */
+	0x0a1a,	/* 150 */
+	0x8a36,	/* 151 */
+	0x0a4d,	/* 152 */
+	0x8a63,	/* 153 */
+	0x8a7b,	/* 154 */
+	0x8a8e,	/* 155 */
+	0x0aa4,	/* 156 */
+	0x0ab8,	/* 157 */
+	0x8acd,	/* 158 */
+	0x8ae0,	/* 159 */
+	0x0af2,	/* 160 */
+	0x8b0a,	/* 161 */
+	0x0b19,	/* 162 */
+	0x8b31,	/* 163 */
+	0x8b49,	/* 164 */
+	0x8b62,	/* 165 */
+	0x0b7d,	/* 166 */
+	0x8b90,	/* 167 */
+	0x0ba3,	/* 168 */
+	0x8bb5,	/* 169 */
+	0x8bbd,	/* 170 */
+	0x8bc5,	/* 171 */
+	0x0bdb,	/* 172 */
+	0x8bf5,	/* 173 */
+	0x0bfe,	/* 174 */
+	0x0c13,	/* 175 */
+	0x0c28,	/* 176 */
+	0x0c49,	/* 177 */
+	0x0c6d,	/* 178 */
+	0x8c8d,	/* 179 */
+	0x8c94,	/* 180 */
+	0x8c9d,	/* 181 */
+	0x8ca7,	/* 182 */
+	0x8cb1,	/* 183 */
+	0x8cb9,	/* 184 */
+	0x8cc2,	/* 185 */
+	0x8ccd,	/* 186 */
+	0x8cd5,	/* 187 */
+	0x8cde,	/* 188 */
+	0x8ce8,	/* 189 */
+	0x8cf2,	/* 190 */
+	0x8cfc,	/* 191 */
+	0x8d04,	/* 192 */
+	0x8d0c,	/* 193 */
+	0x8d15,	/* 194 */
+	0x8d1d,	/* 195 */
+	0x0d26,	/* 196 */
+	0x8d2d,	/* 197 */
+	0x8d37,	/* 198 */
+	0x8d41,	/* 199 */
+	0x8d4b,	/* 200 */
+	0x8d56,	/* 201 */
+	0x8d5f,	/* 202 */
+	0x8d6a,	/* 203 */
+	0x8d74,	/* 204 */
+	0x0d7f,	/* 205 */
+	0x8d87,	/* 206 */
+	0x8d94,	/* 207 */
+	0x8d9d,	/* 208 */
+	0x8da8,	/* 209 */
+	0x8db1,	/* 210 */
+	0x8dba,	/* 211 */
+	0x8dc4,	/* 212 */
+	0x8dce,	/* 213 */
+	0x8dd7,	/* 214 */
+	0x8de0,	/* 215 */
+	0x8ded,	/* 216 */
+	0x8df9,	/* 217 */
+	0x8e01,	/* 218 */
+	0x0e09,	/* 219 */
+	0x0e10,	/* 220 */
+	0x8e17,	/* 221 */
+	0x8e1e,	/* 222 */
+	0x0e25,	/* 223 */
+	0x8e2c,	/* 224 */
+	0x8e42,	/* 225 */
+	0x8e59,	/* 226 */
+	0x8e62,	/* 227 */
+	0x0e6d,	/* 228 */
+	0x0e7e,	/* 229 */
+	0x8e90,	/* 230 */
+	0x8e9e,	/* 231 */
+	0x0ead,	/* 232 */
+	0x0ec1,	/* 233 */
+	0x0ed6,	/* 234 */
+	0x0eed,	/* 235 */
+	0x8f04,	/* 236 */
+	0x0f1a,	/* 237 */
+	0x0f37,	/* 238 */
+	0x8f47,	/* 239 */
+	0x8f56,	/* 240 */
+	0x8f5f,	/* 241 */
+	0x0f6b,	/* 242 */
+	0x0f78,	/* 243 */
+	0x8f84,	/* 244 */
+	0x8f8f,	/* 245 */
+	0x0f9a,	/* 246 */
+	0x0fa4,	/* 247 */
+	0x0fb4,	/* 248 */
+	0x0fbf,	/* 249 */
+	0x0fc8,	/* 250 */
+	0x8fd0,	/* 251 */
+	0x0fde,	/* 252 */
+	0x0fee,	/* 253 */
+	0x8ffe,	/* 254 */
+	0x1006,	/* 255 */
+#endif // CONFIG_LCD_FONT_EXTENDED_ASCII
+};
+
+
+LCD_RLE_FONT_DEFINE(ascii_10x18_rle, 10, 18, 0);
@@ -0,0 +1,535 @@
+
+#include "lcd_font_type.h"
+
+/**
+ * @brief 字体名称 ascii_8x16_rle
+ * 由 lcd_font_packer.py --rle 从 ascii_8x16 生成，请勿手工修改
+ * 
+ */
+LCD_FONT_DATA_DEFINE(ascii_8x16_rle)
+{
+	0xff, 0xff, 0xff, 0xff, 0x80,	/* 0 */
+	0xf2, 0x61, 0x82, 0x12, 0x14, 0x12, 0x1c, 0x44, 0x12, 0x15, 0x2b, 0x81, 0x6f, 0xa0,	/* 1 */
+	0xf2, 0x61, 0xa1, 0x21, 0xf5, 0x45, 0x2f, 0x41, 0x6f, 0xf3,	/* 2 */
+	0xff, 0x32, 0x12, 0x27, 0x17, 0x17, 0x17, 0x25, 0x43, 0x61, 0xff, 0x60,	/* 3 */
+	0xff, 0x51, 0x63, 0x45, 0x27, 0x25, 0x43, 0x61, 0xff, 0xe0,	/* 4 */
+	0xfc, 0x25, 0x44, 0x42, 0x32, 0x62, 0x62, 0x33, 0x26, 0x25, 0x4f, 0xf4,	/* 5 */
+	0xfc, 0x25, 0x43, 0x61, 0xf1, 0x16, 0x42, 0x62, 0x54, 0xff, 0x40,	/* 6 */
+	0xff, 0xf6, 0x25, 0x44, 0x45, 0x2f, 0xff, 0x60,	/* 7 */
+	0x0f, 0xff, 0x62, 0x54, 0x44, 0x52, 0xff, 0xf6,	/* 8 */
+	0xff, 0xc4, 0x32, 0x22, 0x21, 0x41, 0x21, 0x41, 0x22, 0x22, 0x34, 0xff, 0xc0,	/* 9 */
+	0x0f, 0xfc, 0x43, 0x22, 0x22, 0x14, 0x12, 0x14, 0x12, 0x22, 0x23, 0x4f, 0xfc,	/* 10 */
+	0x00, 0x00, 0x1e, 0x0e, 0x1a, 0x32, 0x78, 0xcc, 0xcc, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0x00, 0x00,	/* 11 */
+	0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,	/* 12 */
+	0xf3, 0x64, 0x26, 0x26, 0x4f, 0xa1, 0x61, 0xa1, 0x43, 0xfe,	/* 13 */
+	0xf2, 0x73, 0x35, 0x35, 0x3f, 0xf1, 0x12, 0x1e, 0x12, 0x12, 0x21, 0x2f, 0x70,	/* 14 */
+	0xfc, 0x2b, 0x24, 0x52, 0x51, 0x21, 0x41, 0x21, 0x52, 0x54, 0x2b, 0x2f, 0xc0,	/* 15 */
+	0x81, 0x72, 0x63, 0x54, 0x45, 0x37, 0x15, 0x34, 0x43, 0x52, 0x61, 0xff, 0x90,	/* 16 */
+	0xe1, 0x62, 0x53, 0x44, 0x35, 0x17, 0x35, 0x44, 0x53, 0x62, 0x71, 0xff, 0x30,	/* 17 */
+	0xf4, 0x25, 0x43, 0x64, 0x26, 0x26, 0x24, 0x63, 0x45, 0x2f, 0xfd,	/* 18 */
+	0xf2, 0x22, 0x2f, 0xff, 0x52, 0x22, 0x22, 0x22, 0xa2, 0x22, 0xfa,	/* 19 */
+	0xf2, 0x81, 0x12, 0x1f, 0x31, 0x11, 0x62, 0xff, 0xa2, 0x12, 0xf9,	/* 20 */
+	0x00, 0x7c, 0xc6, 0x60, 0x38, 0x6c, 0xc6, 0xc6, 0x6c, 0x38, 0x0c, 0xc6, 0x7c, 0x00, 0x00, 0x00,	/* 21 */
+	0xff, 0xff, 0x47, 0xfa, 0x7f, 0xa0,	/* 22 */
+	0xf4, 0x25, 0x43, 0x64, 0x26, 0x26, 0x24, 0x63, 0x45, 0x24, 0x6f, 0xf3,	/* 23 */
+	0xf4, 0x25, 0x12, 0x13, 0x14, 0x12, 0x22, 0x2f, 0xff, 0x72, 0xfc,	/* 24 */
+	0xf4, 0x2f, 0xff, 0x72, 0x22, 0x21, 0x41, 0x31, 0x21, 0x52, 0xfc,	/* 25 */
+	0xff, 0xd2, 0x72, 0x27, 0x52, 0x52, 0xff, 0xf6,	/* 26 */
+	0xff, 0xc2, 0x52, 0x57, 0x22, 0x72, 0xff, 0xf7,	/* 27 */
+	0xff, 0xf3, 0x2f, 0x95, 0x17, 0xff, 0xb0,	/* 28 */
+	0xff, 0xc1, 0x11, 0x42, 0x12, 0x27, 0x22, 0x12, 0x41, 0x11, 0xff, 0xf6,	/* 29 */
+	0xff, 0x51, 0x63, 0x53, 0x45, 0x35, 0x27, 0x17, 0xff, 0xb0,	/* 30 */
+	0xff, 0x27, 0x17, 0x25, 0x35, 0x43, 0x53, 0x61, 0xff, 0xe0,	/* 31 */
+	0xff, 0xff, 0xff, 0xff, 0x80,	/* 32 */
+	0xf4, 0x25, 0x44, 0x44, 0x45, 0x26, 0x26, 0x2e, 0x26, 0x2f, 0xf5,	/* 33 */
+	0x92, 0x22, 0xf3, 0x14, 0x13, 0x12, 0x1f, 0xff, 0xff, 0x70,	/* 34 */
+	0x00, 0x00, 0x00, 0x6c, 0x6c, 0xfe, 0x6c, 0x6c, 0x6c, 0xfe, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00,	/* 35 */
+	0x18, 0x18, 0x7c, 0xc6, 0xc2, 0xc0, 0x7c, 0x06, 0x06, 0x86, 0xc6, 0x7c, 0x18, 0x18, 0x00, 0x00,	/* 36 */
+	0xff, 0x22, 0x41, 0x12, 0x32, 0x52, 0x52, 0x52, 0x52, 0x52, 0x32, 0x11, 0x42, 0xff, 0x30,	/* 37 */
+	0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x76, 0xdc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,	/* 38 */
+	0xa2, 0x62, 0x62, 0x52, 0xff, 0xff, 0xff, 0x30,	/* 39 */
+	0xf5, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x27, 0x2f, 0xf4,	/* 40 */
+	0xf3, 0x27, 0x27, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x2f, 0xf6,	/* 41 */
+	0xff, 0xb2, 0x22, 0x34, 0x28, 0x24, 0x32, 0x22, 0xff, 0xf4,	/* 42 */
+	0xff, 0xd2, 0x62, 0x46, 0x42, 0x62, 0xff, 0xf6,	/* 43 */
+	0xff, 0xff, 0xf0, 0x26, 0x26, 0x25, 0x2f, 0xd0,	/* 44 */
+	0xff, 0xfb, 0x7f, 0xff, 0xf5,	/* 45 */
+	0xff, 0xff, 0xf8, 0x26, 0x2f, 0xf5,	/* 46 */
+	0xff, 0x81, 0x62, 0x52, 0x52, 0x52, 0x52, 0x52, 0x61, 0xff, 0x90,	/* 47 */
+	0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xd6, 0xd6, 0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00,	/* 48 */
+	0xf4, 0x25, 0x16, 0x17, 0x2f, 0xff, 0x12, 0x22, 0x26, 0xfa,	/* 49 */
+	0xf2, 0x52, 0x23, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x23, 0x21, 0x7f, 0xf3,	/* 50 */
+	0xf2, 0x52, 0x23, 0x26, 0x26, 0x23, 0x47, 0x26, 0x26, 0x21, 0x23, 0x22, 0x5f, 0xf4,	/* 51 */
+	0xf5, 0x25, 0x34, 0x43, 0x21, 0x22, 0x22, 0x22, 0x75, 0x26, 0x26, 0x25, 0x4f, 0xf3,	/* 52 */
+	0xf1, 0x71, 0x26, 0x26, 0x26, 0x67, 0x26, 0x26, 0x21, 0x23, 0x22, 0x5f, 0xf4,	/* 53 */
+	0xf3, 0x34, 0x11, 0x23, 0x11, 0x1f, 0x04, 0x43, 0x11, 0xfa, 0x11, 0x31, 0x12, 0x5f, 0xb0,	/* 54 */
+	0xf1, 0x71, 0x23, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x2f, 0xf6,	/* 55 */
+	0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,	/* 56 */
+	0xf2, 0x52, 0x23, 0x21, 0x23, 0x21, 0x23, 0x22, 0x66, 0x26, 0x26, 0x25, 0x23, 0x4f, 0xf5,	/* 57 */
+	0xff, 0x52, 0xe2, 0xf7, 0x2e, 0x2f, 0xf5,	/* 58 */
+	0xff, 0x52, 0x62, 0xff, 0x02, 0x62, 0x52, 0xff, 0x60,	/* 59 */
+	0xfe, 0x25, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x2f, 0xf3,	/* 60 */
+	0xff, 0xb6, 0xf3, 0x6f, 0xff, 0xc0,	/* 61 */
+	0xfa, 0x27, 0x27, 0x27, 0x27, 0x25, 0x25, 0x25, 0x25, 0x2f, 0xf7,	/* 62 */
+	0xf2, 0x52, 0x23, 0x21, 0x23, 0x25, 0x25, 0x26, 0x26, 0x2e, 0x26, 0x2f, 0xf5,	/* 63 */
+	0xfa, 0x52, 0x11, 0x31, 0x1c, 0x2f, 0xa1, 0x43, 0x21, 0x14, 0x35, 0xfb,	/* 64 */
+	0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00,	/* 65 */
+	0xf1, 0x62, 0x12, 0x21, 0x1f, 0x52, 0x11, 0x42, 0x11, 0xfa, 0x12, 0x21, 0x11, 0x6f, 0xb0,	/* 66 */
+	0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00,	/* 67 */
+	0xf1, 0x53, 0x12, 0x11, 0x16, 0x11, 0x1f, 0xff, 0x01, 0x11, 0x11, 0x21, 0x11, 0x25, 0xfc,	/* 68 */
+	0x00, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00,	/* 69 */
+	0xf1, 0x71, 0x12, 0x28, 0x16, 0x11, 0x14, 0x17, 0x18, 0x1f, 0x41, 0x21, 0x44, 0xfd,	/* 70 */
+	0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xde, 0xc6, 0xc6, 0x66, 0x3a, 0x00, 0x00, 0x00, 0x00,	/* 71 */
+	0xf1, 0x23, 0x2f, 0xc3, 0x53, 0xff, 0x52, 0x32, 0xfa,	/* 72 */
+	0xf3, 0x44, 0x12, 0x1f, 0xff, 0xf0, 0x12, 0x14, 0x4f, 0xb0,	/* 73 */
+	0xf4, 0x44, 0x12, 0x1f, 0xf3, 0x2f, 0x71, 0x12, 0x11, 0x34, 0xfc,	/* 74 */
+	0x00, 0x00, 0xe6, 0x66, 0x66, 0x6c, 0x78, 0x78, 0x6c, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00,	/* 75 */
+	0xf1, 0x44, 0x12, 0x1f, 0xff, 0x51, 0x61, 0x21, 0x22, 0x37, 0xfa,	/* 76 */
+	0xf1, 0x23, 0x23, 0x11, 0x16, 0x1e, 0x11, 0x16, 0x1f, 0xf6, 0x23, 0x2f, 0xa0,	/* 77 */
+	0xf1, 0x23, 0x23, 0x18, 0x18, 0x15, 0x18, 0x18, 0x1f, 0xc2, 0x32, 0xfa,	/* 78 */
+	0xf2, 0x52, 0x11, 0x31, 0x1f, 0xff, 0xc1, 0x13, 0x11, 0x25, 0xfb,	/* 79 */
+	0xf1, 0x62, 0x12, 0x21, 0x1f, 0x52, 0x11, 0x43, 0xfb, 0x12, 0x14, 0x4f, 0xd0,	/* 80 */
+	0xf2, 0x52, 0x11, 0x31, 0x1f, 0xfe, 0x18, 0x13, 0x11, 0x13, 0x12, 0x3a, 0x15, 0x39,	/* 81 */
+	0xf1, 0x62, 0x12, 0x21, 0x1f, 0x52, 0x11, 0x41, 0x81, 0x11, 0xf2, 0x17, 0x32, 0x2f, 0xa0,	/* 82 */
+	0x00, 0x00, 0x7c, 0xc6, 0xc6, 0x60, 0x38, 0x0c, 0x06, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,	/* 83 */
+	0xf2, 0x6b, 0x12, 0x13, 0x14, 0x1f, 0xfd, 0x12, 0x14, 0x4f, 0xb0,	/* 84 */
+	0xf1, 0x23, 0x2f, 0xff, 0xf5, 0x11, 0x31, 0x12, 0x5f, 0xb0,	/* 85 */
+	0xf1, 0x23, 0x2f, 0xff, 0x41, 0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x41, 0x11, 0x61, 0xfd,	/* 86 */
+	0xf1, 0x23, 0x2f, 0xd1, 0xf7, 0x11, 0x16, 0x14, 0x15, 0x12, 0x21, 0x2f, 0xb0,	/* 87 */
+	0x00, 0x00, 0xc6, 0xc6, 0x6c, 0x7c, 0x38, 0x38, 0x7c, 0x6c, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00,	/* 88 */
+	0xf2, 0x22, 0x2f, 0xb1, 0x12, 0x11, 0x31, 0x21, 0xfd, 0x12, 0x14, 0x4f, 0xb0,	/* 89 */
+	0x00, 0x00, 0xfe, 0xc6, 0x86, 0x0c, 0x18, 0x30, 0x60, 0xc2, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00,	/* 90 */
+	0xf3, 0x46, 0x2f, 0xff, 0xf2, 0x24, 0x4f, 0xb0,	/* 91 */
+	0xf9, 0x17, 0x26, 0x36, 0x36, 0x36, 0x36, 0x36, 0x27, 0x1f, 0xf3,	/* 92 */
+	0xf3, 0x44, 0x2f, 0xff, 0xf2, 0x26, 0x4f, 0xb0,	/* 93 */
+	0x31, 0x63, 0x42, 0x12, 0x22, 0x32, 0xff, 0xff, 0xff, 0x70,	/* 94 */
+	0xff, 0xff, 0xff, 0xe8, 0xf1,	/* 95 */
+	0xa2, 0x72, 0x72, 0xff, 0xff, 0xff, 0x80,	/* 96 */
+	0xff, 0xb4, 0x72, 0x35, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x33, 0x12, 0xff, 0x30,	/* 97 */
+	0xf1, 0x35, 0x1f, 0x32, 0x61, 0x11, 0x61, 0x11, 0xfd, 0x21, 0x12, 0x5f, 0xb0,	/* 98 */
+	0xff, 0xb5, 0x22, 0x32, 0x12, 0x62, 0x62, 0x62, 0x32, 0x25, 0xff, 0x40,	/* 99 */
+	0xf4, 0x35, 0x1e, 0x25, 0x11, 0x14, 0x11, 0x1f, 0xe1, 0x13, 0x11, 0x23, 0x12, 0xfa,	/* 100 */
+	0xff, 0xb5, 0x22, 0x32, 0x17, 0x12, 0x62, 0x62, 0x32, 0x25, 0xff, 0x40,	/* 101 */
+	0xf4, 0x34, 0x21, 0x23, 0x22, 0x13, 0x25, 0x45, 0x26, 0x26, 0x26, 0x25, 0x4f, 0xf5,	/* 102 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x7c, 0x0c, 0xcc, 0x78, 0x00,	/* 103 */
+	0xf1, 0x35, 0x1f, 0x42, 0x52, 0x11, 0x41, 0xfd, 0x17, 0x32, 0x2f, 0xa0,	/* 104 */
+	0xf4, 0x2e, 0x25, 0x35, 0x1f, 0xf9, 0x12, 0x14, 0x4f, 0xb0,	/* 105 */
+	0xf6, 0x2e, 0x25, 0x35, 0x1f, 0xfe, 0x2e, 0x11, 0x21, 0x13, 0x42,	/* 106 */
+	0x00, 0x00, 0xe0, 0x60, 0x60, 0x66, 0x6c, 0x78, 0x78, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00,	/* 107 */
+	0xf3, 0x35, 0x1f, 0xff, 0xf3, 0x12, 0x14, 0x4f, 0xb0,	/* 108 */
+	0xff, 0xa3, 0x12, 0x51, 0x21, 0x31, 0x11, 0xff, 0x01, 0x42, 0x32, 0xfa,	/* 109 */
+	0xff, 0xa2, 0x13, 0x21, 0x13, 0x11, 0xff, 0xc2, 0x22, 0xfa,	/* 110 */
+	0xff, 0xb5, 0x21, 0x13, 0x11, 0xff, 0x31, 0x13, 0x11, 0x25, 0xfb,	/* 111 */
+	0xff, 0xa2, 0x13, 0x21, 0x13, 0x11, 0xff, 0x62, 0x11, 0x43, 0xa1, 0x21, 0x44, 0x40,	/* 112 */
+	0xff, 0xb3, 0x12, 0x11, 0x13, 0x11, 0xff, 0x31, 0x12, 0x53, 0xf0, 0x12, 0x14, 0x41,	/* 113 */
+	0xff, 0xa2, 0x13, 0x33, 0x12, 0x22, 0x22, 0x22, 0x62, 0x62, 0x54, 0xff, 0x60,	/* 114 */
+	0xff, 0xb5, 0x22, 0x32, 0x22, 0x73, 0x72, 0x22, 0x32, 0x25, 0xff, 0x40,	/* 115 */
+	0xf4, 0x16, 0x26, 0x24, 0x64, 0x26, 0x26, 0x26, 0x26, 0x21, 0x24, 0x3f, 0xf4,	/* 116 */
+	0xff, 0xa2, 0x22, 0xff, 0xc1, 0x13, 0x11, 0x23, 0x12, 0xfa,	/* 117 */
+	0xff, 0xa2, 0x32, 0xff, 0x31, 0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x43, 0xfc,	/* 118 */
+	0xff, 0xa2, 0x32, 0xc1, 0xf7, 0x11, 0x13, 0x12, 0x12, 0x12, 0x21, 0x2f, 0xb0,	/* 119 */
+	0xff, 0xa2, 0x32, 0x22, 0x12, 0x43, 0x53, 0x53, 0x42, 0x12, 0x22, 0x32, 0xff, 0x30,	/* 120 */
+	0xff, 0xa2, 0x32, 0xff, 0xb1, 0x13, 0x44, 0x71, 0x11, 0x14, 0x11, 0x25, 0x30,	/* 121 */
+	0xff, 0xa7, 0x12, 0x22, 0x52, 0x52, 0x52, 0x52, 0x32, 0x17, 0xff, 0x30,	/* 122 */
+	0xf5, 0x34, 0x26, 0x26, 0x24, 0x37, 0x26, 0x26, 0x26, 0x27, 0x3f, 0xf3,	/* 123 */
+	0xf4, 0x2f, 0xff, 0xff, 0x32, 0xfc,	/* 124 */
+	0xf2, 0x37, 0x26, 0x26, 0x27, 0x34, 0x26, 0x26, 0x26, 0x24, 0x3f, 0xf6,	/* 125 */
+	0x93, 0x12, 0x12, 0x13, 0xff, 0xff, 0xff, 0xf1,	/* 126 */
+	0xff, 0x51, 0x63, 0x42, 0x12, 0x22, 0x32, 0x12, 0x32, 0x12, 0x32, 0x17, 0xff, 0xb0,	/* 127 */
+#if CONFIG_LCD_FONT_EXTENDED_ASCII
+	0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0xc2, 0x66, 0x3c, 0x18, 0x70, 0x00, 0x00,	/* 128 */
+	0xf1, 0x22, 0x22, 0x22, 0x2a, 0x22, 0x2f, 0xfc, 0x11, 0x31, 0x12, 0x31, 0x2f, 0xa0,	/* 129 */
+	0xc2, 0x52, 0x52, 0xd5, 0x22, 0x32, 0x17, 0x12, 0x62, 0x62, 0x32, 0x25, 0xff, 0x40,	/* 130 */
+	0x00, 0x10, 0x38, 0x6c, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,	/* 131 */
+	0x00, 0x00, 0xcc, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,	/* 132 */
+	0x00, 0x60, 0x30, 0x18, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,	/* 133 */
+	0x00, 0x38, 0x6c, 0x38, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,	/* 134 */
+	0xff, 0xb5, 0x22, 0x32, 0x12, 0x62, 0x62, 0x62, 0x32, 0x25, 0x52, 0x43, 0xf5,	/* 135 */
+	0xb1, 0x63, 0x42, 0x12, 0xb5, 0x22, 0x32, 0x17, 0x12, 0x62, 0x62, 0x32, 0x25, 0xff, 0x40,	/* 136 */
+	0xf1, 0x23, 0x2f, 0x35, 0x22, 0x32, 0x17, 0x12, 0x62, 0x62, 0x32, 0x25, 0xff, 0x40,	/* 137 */
+	0x92, 0x72, 0x72, 0xc5, 0x22, 0x32, 0x17, 0x12, 0x62, 0x62, 0x32, 0x25, 0xff, 0x40,	/* 138 */
+	0xf2, 0x22, 0x2f, 0x43, 0x62, 0x62, 0x62, 0x62, 0x62, 0x54, 0xff, 0x40,	/* 139 */
+	0xb2, 0x54, 0x32, 0x22, 0xb3, 0x62, 0x62, 0x62, 0x62, 0x62, 0x54, 0xff, 0x40,	/* 140 */
+	0x92, 0x72, 0x72, 0xd3, 0x62, 0x62, 0x62, 0x62, 0x62, 0x54, 0xff, 0x40,	/* 141 */
+	0x00, 0xc6, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00,	/* 142 */
+	0x38, 0x6c, 0x38, 0x10, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00,	/* 143 */
+	0x0c, 0x18, 0x00, 0xfe, 0x66, 0x62, 0x68, 0x78, 0x68, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00,	/* 144 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x36, 0x36, 0x7e, 0xd8, 0xd8, 0x6e, 0x00, 0x00, 0x00, 0x00,	/* 145 */
+	0x00, 0x00, 0x3e, 0x6c, 0xcc, 0xcc, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0x00, 0x00, 0x00, 0x00,	/* 146 */
+	0x00, 0x10, 0x38, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,	/* 147 */
+	0xf1, 0x23, 0x21, 0x23, 0x2a, 0x52, 0x11, 0x31, 0x1f, 0xf3, 0x11, 0x31, 0x12, 0x5f, 0xb0,	/* 148 */
+	0x00, 0x60, 0x30, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,	/* 149 */
+	0x00, 0x30, 0x78, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,	/* 150 */
+	0x92, 0x61, 0x11, 0x61, 0x11, 0x62, 0x32, 0x22, 0xff, 0xc1, 0x13, 0x11, 0x23, 0x12, 0xfa,	/* 151 */
+	0x00, 0x00, 0xc6, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0x78, 0x00,	/* 152 */
+	0x82, 0x32, 0x12, 0x32, 0x25, 0x21, 0x13, 0x11, 0xff, 0xf4, 0x11, 0x31, 0x12, 0x5f, 0xb0,	/* 153 */
+	0x82, 0x32, 0x12, 0x32, 0x12, 0x32, 0xff, 0xfc, 0x11, 0x31, 0x12, 0x5f, 0xb0,	/* 154 */
+	0xb2, 0x62, 0x45, 0x22, 0x32, 0x12, 0x62, 0x62, 0x62, 0x32, 0x25, 0x52, 0x62, 0xff, 0x50,	/* 155 */
+	0x00, 0x38, 0x6c, 0x64, 0x60, 0xf0, 0x60, 0x60, 0x60, 0x60, 0xe6, 0xfc, 0x00, 0x00, 0x00, 0x00,	/* 156 */
+	0xf2, 0x22, 0x22, 0x22, 0x23, 0x45, 0x24, 0x64, 0x24, 0x64, 0x26, 0x26, 0x2f, 0xf5,	/* 157 */
+	0x00, 0xf8, 0xcc, 0xcc, 0xf8, 0xc4, 0xcc, 0xde, 0xcc, 0xcc, 0xcc, 0xc6, 0x00, 0x00, 0x00, 0x00,	/* 158 */
+	0xc3, 0x42, 0x12, 0x32, 0x62, 0x62, 0x46, 0x42, 0x62, 0x62, 0x32, 0x12, 0x43, 0xff, 0x60,	/* 159 */
+	0x00, 0x18, 0x30, 0x60, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00,	/* 160 */
+	0xc2, 0x52, 0x52, 0xe3, 0x62, 0x62, 0x62, 0x62, 0x62, 0x54, 0xff, 0x40,	/* 161 */
+	0x00, 0x18, 0x30, 0x60, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00,	/* 162 */
+	0xb2, 0x51, 0x11, 0x41, 0x11, 0x52, 0x52, 0x22, 0xff, 0xc1, 0x13, 0x11, 0x23, 0x12, 0xfa,	/* 163 */
+	0x00, 0x00, 0x76, 0xdc, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00,	/* 164 */
+	0x76, 0xdc, 0x00, 0xc6, 0xe6, 0xf6, 0xfe, 0xde, 0xce, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00,	/* 165 */
+	0xf3, 0x43, 0x21, 0x23, 0x21, 0x24, 0x5a, 0x6f, 0xff, 0xf5,	/* 166 */
+	0xf3, 0x34, 0x21, 0x23, 0x21, 0x24, 0x3c, 0x5f, 0xff, 0xf6,	/* 167 */
+	0xf3, 0x26, 0x2e, 0x26, 0x25, 0x25, 0x26, 0x23, 0x21, 0x23, 0x22, 0x5f, 0xf4,	/* 168 */
+	0xff, 0xf3, 0x73, 0x5f, 0xa2, 0xff, 0x80,	/* 169 */
+	0xff, 0xf3, 0x71, 0x5f, 0xf2, 0x2f, 0xf3,	/* 170 */
+	0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x60, 0xdc, 0x86, 0x0c, 0x18, 0x3e, 0x00, 0x00,	/* 171 */
+	0x00, 0x60, 0xe0, 0x62, 0x66, 0x6c, 0x18, 0x30, 0x66, 0xce, 0x9a, 0x3f, 0x06, 0x06, 0x00, 0x00,	/* 172 */
+	0xf4, 0x26, 0x2e, 0x26, 0x26, 0x25, 0x44, 0x44, 0x45, 0x2f, 0xf5,	/* 173 */
+	0xff, 0xc2, 0x12, 0x22, 0x12, 0x22, 0x12, 0x42, 0x12, 0x42, 0x12, 0xff, 0xf4,	/* 174 */
+	0xff, 0xa2, 0x12, 0x42, 0x12, 0x42, 0x12, 0x22, 0x12, 0x22, 0x12, 0xff, 0xf6,	/* 175 */
+	0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44,	/* 176 */
+	0x11, 0x11, 0x11, 0x1f, 0xff, 0xff, 0xff, 0xf1,	/* 177 */
+	0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77,	/* 178 */
+	0x32, 0xff, 0xff, 0xff, 0xff, 0x30,	/* 179 */
+	0x32, 0xff, 0xf6, 0x35, 0x3f, 0xff, 0xf1,	/* 180 */
+	0x32, 0xff, 0x53, 0x53, 0x53, 0x53, 0xff, 0xff, 0x10,	/* 181 */
+	0x22, 0x12, 0xff, 0xf4, 0x26, 0x2f, 0xff, 0xf2,	/* 182 */
+	0xff, 0xfb, 0x71, 0x22, 0x1f, 0xff, 0xe0,	/* 183 */
+	0xff, 0xa5, 0x33, 0x53, 0x53, 0xff, 0xff, 0x10,	/* 184 */
+	0x22, 0x12, 0xff, 0x32, 0x64, 0x44, 0x42, 0xff, 0xff, 0x20,	/* 185 */
+	0x22, 0x12, 0xff, 0xff, 0xff, 0xff, 0x10,	/* 186 */
+	0xff, 0xa7, 0x15, 0x34, 0x42, 0xff, 0xff, 0x20,	/* 187 */
+	0x22, 0x12, 0xff, 0x32, 0x64, 0x45, 0x37, 0xff, 0xfc,	/* 188 */
+	0x22, 0x12, 0xff, 0xf4, 0x22, 0x13, 0x7f, 0xff, 0xc0,	/* 189 */
+	0x32, 0xff, 0x53, 0x53, 0x53, 0x55, 0xff, 0xfe,	/* 190 */
+	0xff, 0xfb, 0x53, 0x3f, 0xff, 0xf1,	/* 191 */
+	0x32, 0xff, 0xfb, 0x33, 0x5f, 0xff, 0xb0,	/* 192 */
+	0x32, 0xff, 0xf6, 0x32, 0xbf, 0xff, 0xb0,	/* 193 */
+	0xff, 0xfb, 0xb2, 0x3f, 0xff, 0xb0,	/* 194 */
+	0x32, 0xff, 0xfb, 0x35, 0x3f, 0xff, 0xb0,	/* 195 */
+	0xff, 0xfb, 0x8f, 0xff, 0xf4,	/* 196 */
+	0x32, 0xff, 0xf6, 0x32, 0x62, 0x3f, 0xff, 0xb0,	/* 197 */
+	0x32, 0xff, 0xa3, 0x53, 0x53, 0x53, 0xff, 0xfb,	/* 198 */
+	0x22, 0x12, 0xff, 0xfb, 0x17, 0x1f, 0xff, 0xb0,	/* 199 */
+	0x22, 0x12, 0xff, 0xa1, 0x53, 0x44, 0x26, 0xff, 0xfb,	/* 200 */
+	0xff, 0xc6, 0x44, 0x53, 0x71, 0xff, 0xfb,	/* 201 */
+	0x22, 0x12, 0xff, 0x32, 0x55, 0x1f, 0x4f, 0xff, 0xb0,	/* 202 */
+	0xff, 0xaf, 0x51, 0x55, 0x1f, 0xff, 0xb0,	/* 203 */
+	0x22, 0x12, 0xff, 0xa1, 0x53, 0x53, 0x71, 0xff, 0xfb,	/* 204 */
+	0xff, 0xaf, 0xf2, 0xff, 0xfb,	/* 205 */
+	0x22, 0x12, 0xff, 0x32, 0x55, 0x17, 0x15, 0x51, 0xff, 0xfb,	/* 206 */
+	0x32, 0xff, 0x53, 0x2f, 0xcf, 0xff, 0xb0,	/* 207 */
+	0x22, 0x12, 0xff, 0xf4, 0x22, 0x12, 0x9f, 0xff, 0xb0,	/* 208 */
+	0xff, 0xaf, 0xc2, 0x3f, 0xff, 0xb0,	/* 209 */
+	0xff, 0xfb, 0xa2, 0x12, 0x1f, 0xff, 0xb0,	/* 210 */
+	0x22, 0x12, 0xff, 0xf8, 0x12, 0x12, 0x6f, 0xff, 0xb0,	/* 211 */
+	0x32, 0xff, 0xa3, 0x53, 0x53, 0x35, 0xff, 0xfb,	/* 212 */
+	0xff, 0xd5, 0x53, 0x53, 0x53, 0xff, 0xfb,	/* 213 */
+	0xff, 0xfd, 0x64, 0x12, 0x1f, 0xff, 0xb0,	/* 214 */
+	0x22, 0x12, 0xff, 0xf4, 0x22, 0x12, 0x32, 0x12, 0x1f, 0xff, 0xb0,	/* 215 */
+	0x32, 0xff, 0x53, 0x26, 0x26, 0x26, 0x23, 0xff, 0xfb,	/* 216 */
+	0x32, 0xff, 0xf6, 0x35, 0x5f, 0xff, 0xe0,	/* 217 */
+	0xff, 0xfe, 0x55, 0x3f, 0xff, 0xb0,	/* 218 */
+	0x0f, 0xff, 0xff, 0xff, 0xf8,	/* 219 */
+	0xff, 0xfb, 0xff, 0xff, 0xc0,	/* 220 */
+	0x04, 0xff, 0xff, 0xff, 0xff, 0x40,	/* 221 */
+	0x44, 0xff, 0xff, 0xff, 0xff, 0x00,	/* 222 */
+	0x0f, 0xff, 0xbf, 0xff, 0xfc,	/* 223 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xdc, 0xd8, 0xd8, 0xd8, 0xdc, 0x76, 0x00, 0x00, 0x00, 0x00,	/* 224 */
+	0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xc6, 0xc6, 0xcc, 0x00, 0x00, 0x00, 0x00,	/* 225 */
+	0xf1, 0x73, 0x3f, 0x12, 0xff, 0xf4, 0x2f, 0xf0,	/* 226 */
+	0xff, 0xa7, 0x11, 0x21, 0x21, 0xff, 0xc2, 0x12, 0xfb,	/* 227 */
+	0xf1, 0x71, 0x23, 0x22, 0x27, 0x27, 0x26, 0x25, 0x25, 0x25, 0x23, 0x21, 0x7f, 0xf3,	/* 228 */
+	0xff, 0xb6, 0x11, 0x11, 0x22, 0xff, 0x31, 0x11, 0x11, 0x43, 0xfd,	/* 229 */
+	0xff, 0xb2, 0x22, 0xff, 0xe2, 0x11, 0x43, 0xa1, 0x11, 0x52, 0x60,	/* 230 */
+	0xff, 0x33, 0x12, 0x12, 0x13, 0x52, 0x62, 0x62, 0x62, 0x62, 0x62, 0xff, 0x50,	/* 231 */
+	0x00, 0x00, 0x7e, 0x18, 0x3c, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00,	/* 232 */
+	0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00,	/* 233 */
+	0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0x6c, 0x6c, 0x6c, 0x6c, 0xee, 0x00, 0x00, 0x00, 0x00,	/* 234 */
+	0x00, 0x00, 0x1e, 0x30, 0x18, 0x0c, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00,	/* 235 */
+	0xff, 0xb6, 0x12, 0x12, 0x14, 0x12, 0x14, 0x12, 0x12, 0x16, 0xff, 0xf4,	/* 236 */
+	0xff, 0x02, 0x52, 0x26, 0x12, 0x12, 0x14, 0x12, 0x16, 0x22, 0x16, 0x22, 0x52, 0xff, 0x80,	/* 237 */
+	0xf4, 0x34, 0x25, 0x26, 0x26, 0x53, 0x26, 0x26, 0x27, 0x27, 0x3f, 0xf4,	/* 238 */
+	0xfa, 0x52, 0x11, 0x31, 0x1f, 0xff, 0xc2, 0x32, 0xfa,	/* 239 */
+	0xff, 0x27, 0xf2, 0x7f, 0x27, 0xff, 0xb0,	/* 240 */
+	0xff, 0x52, 0x62, 0x46, 0x42, 0x62, 0xf5, 0x6f, 0xf3,	/* 241 */
+	0xfb, 0x27, 0x27, 0x27, 0x25, 0x25, 0x25, 0x2d, 0x6f, 0xf3,	/* 242 */
+	0xfd, 0x25, 0x25, 0x25, 0x27, 0x27, 0x27, 0x2b, 0x6f, 0xf3,	/* 243 */
+	0xf5, 0x34, 0x11, 0x11, 0x1e, 0x2f, 0xff, 0xff, 0x50,	/* 244 */
+	0x32, 0xff, 0xff, 0x72, 0xf7, 0x11, 0x11, 0x14, 0x3f, 0x50,	/* 245 */
+	0xff, 0xd2, 0xc6, 0xc2, 0xff, 0xf6,	/* 246 */
+	0xff, 0xb3, 0x12, 0x12, 0x13, 0xb3, 0x12, 0x12, 0x13, 0xff, 0xf5,	/* 247 */
+	0xa3, 0x42, 0x12, 0x32, 0x12, 0x43, 0xff, 0xff, 0xff, 0x10,	/* 248 */
+	0xff, 0xfe, 0x26, 0x2f, 0xff, 0xe0,	/* 249 */
+	0xff, 0xfe, 0x2f, 0xff, 0xf7,	/* 250 */
+	0xc4, 0x62, 0xff, 0x23, 0x51, 0xf1, 0x11, 0x16, 0x18, 0x3f, 0xb0,	/* 251 */
+	0x92, 0x12, 0x31, 0x12, 0x11, 0xff, 0x52, 0x12, 0xff, 0xff, 0x50,	/* 252 */
+	0xa4, 0x32, 0x22, 0x52, 0x52, 0x52, 0x21, 0x26, 0xff, 0xff, 0xd0,	/* 253 */
+	0xff, 0x36, 0xff, 0xf5, 0x6f, 0xf3,	/* 254 */
+	0xff, 0xff, 0xff, 0xff, 0x80,	/* 255 */
+#endif // CONFIG_LCD_FONT_EXTENDED_ASCII
+};
+
+/// 低15位为偏移，最高位为1表示按行异或后编码
+LCD_FONT_OFFSETS_DEFINE(ascii_8x16_rle)
+{
+	0x0000,	/* 0 */
+	0x8005,	/* 1 */
+	0x0013,	/* 2 */
+	0x001d,	/* 3 */
+	0x0029,	/* 4 */
+	0x0033,	/* 5 */
+	0x003f,	/* 6 */
+	0x004a,	/* 7 */
+	0x0052,	/* 8 */
+	0x005a,	/* 9 */
+	0x0067,	/* 10 */
+	0x0074,	/* 11 */
+	0x0084,	/* 12 */
+	0x8094,	/* 13 */
+	0x809e,	/* 14 */
+	0x80ab,	/* 15 */
+	0x00b8,	/* 16 */
+	0x00c5,	/* 17 */
+	0x00d2,	/* 18 */
+	0x80dd,	/* 19 */
+	0x80e8,	/* 20 */
+	0x00f3,	/* 21 */
+	0x8103,	/* 22 */
+	0x0109,	/* 23 */
+	0x8115,	/* 24 */
+	0x8120,	/* 25 */
+	0x012b,	/* 26 */
+	0x0133,	/* 27 */
+	0x813b,	/* 28 */
+	0x0142,	/* 29 */
+	0x014e,	/* 30 */
+	0x0158,	/* 31 */
+	0x0162,	/* 32 */
+	0x0167,	/* 33 */
+	0x8172,	/* 34 */
+	0x017c,	/* 35 */
+	0x018c,	/* 36 */
+	0x019c,	/* 37 */
+	0x01ab,	/* 38 */
+	0x01bb,	/* 39 */
+	0x01c3,	/* 40 */
+	0x01cf,	/* 41 */
+	0x01db,	/* 42 */
+	0x01e5,	/* 43 */
+	0x01ed,	/* 44 */
+	0x01f5,	/* 45 */
+	0x01fa,	/* 46 */
+	0x0200,	/* 47 */
+	0x020b,	/* 48 */
+	0x821b,	/* 49 */
+	0x0225,	/* 50 */
+	0x0233,	/* 51 */
+	0x0241,	/* 52 */
+	0x024f,	/* 53 */
+	0x825c,	/* 54 */
+	0x026b,	/* 55 */
+	0x0278,	/* 56 */
+	0x0288,	/* 57 */
+	0x8297,	/* 58 */
+	0x029e,	/* 59 */
+	0x02a7,	/* 60 */
+	0x02b2,	/* 61 */
+	0x02b8,	/* 62 */
+	0x02c3,	/* 63 */
+	0x82d0,	/* 64 */
+	0x02dc,	/* 65 */
+	0x82ec,	/* 66 */
+	0x02fb,	/* 67 */
+	0x830b,	/* 68 */
+	0x031a,	/* 69 */
+	0x832a,	/* 70 */
+	0x0338,	/* 71 */
+	0x8348,	/* 72 */
+	0x8351,	/* 73 */
+	0x835b,	/* 74 */
+	0x0366,	/* 75 */
+	0x8376,	/* 76 */
+	0x8381,	/* 77 */
+	0x838e,	/* 78 */
+	0x839a,	/* 79 */
+	0x83a5,	/* 80 */
+	0x83b2,	/* 81 */
+	0x83c0,	/* 82 */
+	0x03cf,	/* 83 */
+	0x83df,	/* 84 */
+	0x83ea,	/* 85 */
+	0x83f4,	/* 86 */
+	0x8403,	/* 87 */
+	0x0410,	/* 88 */
+	0x8420,	/* 89 */
+	0x042d,	/* 90 */
+	0x843d,	/* 91 */
+	0x0445,	/* 92 */
+	0x8450,	/* 93 */
+	0x0458,	/* 94 */
+	0x0462,	/* 95 */
+	0x0467,	/* 96 */
+	0x046e,	/* 97 */
+	0x847c,	/* 98 */
+	0x0489,	/* 99 */
+	0x8495,	/* 100 */
+	0x04a3,	/* 101 */
+	0x04af,	/* 102 */
+	0x04bd,	/* 103 */
+	0x84cd,	/* 104 */
+	0x84d9,	/* 105 */
+	0x84e3,	/* 106 */
+	0x04ee,	/* 107 */
+	0x84fe,	/* 108 */
+	0x8507,	/* 109 */
+	0x8513,	/* 110 */
+	0x851d,	/* 111 */
+	0x8528,	/* 112 */
+	0x8536,	/* 113 */
+	0x0544,	/* 114 */
+	0x0551,	/* 115 */
+	0x055d,	/* 116 */
+	0x856a,	/* 117 */
+	0x8574,	/* 118 */
+	0x8581,	/* 119 */
+	0x058e,	/* 120 */
+	0x859c,	/* 121 */
+	0x05a9,	/* 122 */
+	0x05b5,	/* 123 */
+	0x85c1,	/* 124 */
+	0x05c7,	/* 125 */
+	0x05d3,	/* 126 */
+	0x05db,	/* 127 */
+#if CONFIG_LCD_FONT_EXTENDED_ASCII
+	0x05e9,	/* 128 */
+	0x85f9,	/* 129 */
+	0x0607,	/* 130 */
+	0x0615,	/* 131 */
+	0x0625,	/* 132 */
+	0x0635,	/* 133 */
+	0x0645,	/* 134 */
+	0x0655,	/* 135 */
+	0x0662,	/* 136 */
+	0x0671,	/* 137 */
+	0x067f,	/* 138 */
+	0x068d,	/* 139 */
+	0x0699,	/* 140 */
+	0x06a6,	/* 141 */
+	0x06b2,	/* 142 */
+	0x06c2,	/* 143 */
+	0x06d2,	/* 144 */
+	0x06e2,	/* 145 */
+	0x06f2,	/* 146 */
+	0x0702,	/* 147 */
+	0x8712,	/* 148 */
+	0x0721,	/* 149 */
+	0x0731,	/* 150 */
+	0x8741,	/* 151 */
+	0x0750,	/* 152 */
+	0x8760,	/* 153 */
+	0x876f,	/* 154 */
+	0x077c,	/* 155 */
+	0x078b,	/* 156 */
+	0x079b,	/* 157 */
+	0x07a9,	/* 158 */
+	0x07b9,	/* 159 */
+	0x07c8,	/* 160 */
+	0x07d8,	/* 161 */
+	0x07e4,	/* 162 */
+	0x87f4,	/* 163 */
+	0x0803,	/* 164 */
+	0x0813,	/* 165 */
+	0x0823,	/* 166 */
+	0x082d,	/* 167 */
+	0x0837,	/* 168 */
+	0x8844,	/* 169 */
+	0x884b,	/* 170 */
+	0x0852,	/* 171 */
+	0x0862,	/* 172 */
+	0x0872,	/* 173 */
+	0x087d,	/* 174 */
+	0x088a,	/* 175 */
+	0x0897,	/* 176 */
+	0x88a7,	/* 177 */
+	0x08af,	/* 178 */
+	0x88bf,	/* 179 */
+	0x88c5,	/* 180 */
+	0x88cc,	/* 181 */
+	0x88d5,	/* 182 */
+	0x88dd,	/* 183 */
+	0x88e4,	/* 184 */
+	0x88ec,	/* 185 */
+	0x88f6,	/* 186 */
+	0x88fd,	/* 187 */
+	0x8905,	/* 188 */
+	0x890e,	/* 189 */
+	0x8917,	/* 190 */
+	0x891f,	/* 191 */
+	0x8925,	/* 192 */
+	0x892c,	/* 193 */
+	0x8933,	/* 194 */
+	0x8939,	/* 195 */
+	0x0940,	/* 196 */
+	0x8945,	/* 197 */
+	0x894d,	/* 198 */
+	0x8955,	/* 199 */
+	0x895d,	/* 200 */
+	0x8966,	/* 201 */
+	0x896d,	/* 202 */
+	0x8976,	/* 203 */
+	0x897d,	/* 204 */
+	0x8986,	/* 205 */
+	0x898b,	/* 206 */
+	0x8995,	/* 207 */
+	0x899c,	/* 208 */
+	0x89a5,	/* 209 */
+	0x89ab,	/* 210 */
+	0x89b2,	/* 211 */
+	0x89bb,	/* 212 */
+	0x89c3,	/* 213 */
+	0x89ca,	/* 214 */
+	0x89d1,	/* 215 */
+	0x89dc,	/* 216 */
+	0x89e5,	/* 217 */
+	0x89ec,	/* 218 */
+	0x09f2,	/* 219 */
+	0x09f7,	/* 220 */
+	0x89fc,	/* 221 */
+	0x8a02,	/* 222 */
+	0x0a08,	/* 223 */
+	0x0a0d,	/* 224 */
+	0x0a1d,	/* 225 */
+	0x8a2d,	/* 226 */
+	0x8a35,	/* 227 */
+	0x0a3e,	/* 228 */
+	0x8a4c,	/* 229 */
+	0x8a57,	/* 230 */
+	0x0a62,	/* 231 */
+	0x0a6f,	/* 232 */
+	0x0a7f,	/* 233 */
+	0x0a8f,	/* 234 */
+	0x0a9f,	/* 235 */
+	0x0aaf,	/* 236 */
+	0x0abb,	/* 237 */
+	0x0aca,	/* 238 */
+	0x8ad6,	/* 239 */
+	0x0adf,	/* 240 */
+	0x0ae6,	/* 241 */
+	0x0aef,	/* 242 */
+	0x0af9,	/* 243 */
+	0x8b03,	/* 244 */
+	0x8b0c,	/* 245 */
+	0x0b16,	/* 246 */
+	0x0b1c,	/* 247 */
+	0x0b27,	/* 248 */
+	0x0b31,	/* 249 */
+	0x0b37,	/* 250 */
+	0x8b3c,	/* 251 */
+	0x8b47,	/* 252 */
+	0x0b52,	/* 253 */
+	0x8b5d,	/* 254 */
+	0x0b63,	/* 255 */
+#endif // CONFIG_LCD_FONT_EXTENDED_ASCII
+};
+
+
+LCD_RLE_FONT_DEFINE(ascii_8x16_rle, 8, 16, 0);
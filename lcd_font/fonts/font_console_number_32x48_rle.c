@@ -0,0 +1,80 @@
+
+#include "lcd_font_type.h"
+
+/**
+ * @brief 字体名称 console_number_32x48_rle
+ * 由 lcd_font_packer.py --rle 从 console_number_32x48 生成，请勿手工修改
+ * 
+ */
+LCD_FONT_DATA_DEFINE(console_number_32x48_rle)
+{
+	0xff, 0xff, 0xe9, 0xf6, 0xdf, 0x3f, 0x0f, 0x18, 0x27, 0xe7, 0x57, 0xd6, 0x76, 0xc6, 0x96, 0xb6,
+	0x96, 0xa6, 0xb6, 0x96, 0xb6, 0x96, 0xb6, 0x96, 0xb7, 0x77, 0xb7, 0x77, 0xc6, 0x76, 0xd6, 0x76,
+	0xd6, 0x76, 0xd6, 0x76, 0xd6, 0x76, 0xd6, 0x76, 0xd6, 0x76, 0xd6, 0x76, 0xd6, 0x76, 0xd6, 0x77,
+	0xc6, 0x77, 0xb7, 0x86, 0xb7, 0x86, 0xb6, 0x96, 0xb6, 0x96, 0xb6, 0xa6, 0x96, 0xb6, 0x96, 0xc6,
+	0x76, 0xd7, 0x57, 0xe8, 0x27, 0xf1, 0xf0, 0xf3, 0xdf, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x10,	/* 48 */
+	0xff, 0xff, 0xf4, 0x4f, 0xa3, 0xfb, 0x3f, 0xb3, 0xfc, 0x2f, 0xff, 0xf7, 0x4f, 0x85, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x96, 0x9f, 0xff, 0xfc, 0xf9, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,	/* 49 */
+	0xff, 0xff, 0xbb, 0xf3, 0xf1, 0xf1, 0xf3, 0xe8, 0x29, 0xd4, 0x87, 0xd2, 0xb7, 0xfb, 0x6f, 0xb6,
+	0xfb, 0x7f, 0xa7, 0xfa, 0x7f, 0xa6, 0xfb, 0x6f, 0xa7, 0xfa, 0x7f, 0x97, 0xfa, 0x6f, 0xa7, 0xf9,
+	0x7f, 0x97, 0xf9, 0x7f, 0x97, 0xf9, 0x7f, 0xa6, 0xfa, 0x6f, 0xa6, 0xfa, 0x6f, 0xa7, 0xfa, 0x6f,
+	0xa7, 0xfa, 0x6f, 0xa7, 0xf9, 0x7f, 0xaf, 0x6b, 0xf6, 0xbf, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,	/* 50 */
+	0xff, 0xff, 0xbc, 0xf3, 0xf1, 0xf1, 0xf2, 0xf0, 0x73, 0x8e, 0x39, 0x7f, 0xa7, 0xfb, 0x6f, 0xb6,
+	0xfb, 0x6f, 0xb6, 0xfb, 0x6f, 0xb6, 0xfa, 0x6f, 0xb6, 0xfa, 0x6f, 0x88, 0xf4, 0xcf, 0x5b, 0xf6,
+	0xdf, 0x9a, 0xfa, 0x7f, 0xb7, 0xfb, 0x7f, 0xb6, 0xfb, 0x6f, 0xb6, 0xfb, 0x6f, 0xb6, 0xfb, 0x6f,
+	0xb6, 0xfa, 0x7f, 0xa6, 0xd2, 0x98, 0xd6, 0x39, 0xef, 0x2f, 0x0f, 0x1f, 0x1d, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,	/* 51 */
+	0xff, 0xff, 0xff, 0xf7, 0x6f, 0xa1, 0xff, 0xff, 0x21, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0x01,
+	0xff, 0xff, 0x21, 0xff, 0x01, 0x51, 0xff, 0xfb, 0x15, 0x1f, 0xf0, 0x1f, 0xa1, 0xff, 0x01, 0x51,
+	0xff, 0x01, 0xfa, 0x1f, 0xf0, 0x15, 0x1f, 0xff, 0xb1, 0x51, 0xf9, 0x15, 0x1f, 0xff, 0xf3, 0x86,
+	0x5f, 0xff, 0xfb, 0xe6, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x6f, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,	/* 52 */
+	0xff, 0xff, 0xff, 0xcf, 0x3e, 0xf3, 0xef, 0x3e, 0xf3, 0xe6, 0xfb, 0x6f, 0xb6, 0xfb, 0x6f, 0xb6,
+	0xfb, 0x6f, 0xb6, 0xfb, 0x6f, 0xb6, 0xfb, 0xbf, 0x6d, 0xf4, 0xf0, 0xf7, 0xbf, 0xa8, 0xfa, 0x7f,
+	0xb7, 0xfb, 0x6f, 0xb7, 0xfa, 0x7f, 0xb6, 0xfb, 0x6f, 0xb6, 0xfa, 0x7f, 0xa7, 0xfa, 0x6f, 0xa7,
+	0xfa, 0x7e, 0x28, 0x7f, 0x05, 0x38, 0xf1, 0xf0, 0xf2, 0xef, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x20,	/* 53 */
+	0xff, 0xff, 0xf2, 0xbf, 0x4e, 0xf1, 0xf1, 0xf0, 0x92, 0x6e, 0x79, 0x2e, 0x6f, 0xa6, 0xfa, 0x7f,
+	0xa6, 0xfb, 0x6f, 0xa6, 0xfb, 0x6f, 0xb6, 0xfb, 0x6f, 0xa7, 0x29, 0xef, 0x5c, 0xf6, 0xbb, 0x38,
+	0xa9, 0x77, 0x98, 0x87, 0x98, 0x97, 0x88, 0xa6, 0x87, 0xb6, 0x87, 0xb6, 0x87, 0xb6, 0x96, 0xb6,
+	0x96, 0xb6, 0x96, 0xb6, 0x96, 0xb6, 0xa6, 0xa6, 0xa6, 0x96, 0xc6, 0x86, 0xc7, 0x66, 0xe8, 0x27,
+	0xf1, 0xf0, 0xf3, 0xdf, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,	/* 54 */
+	0xff, 0xff, 0xff, 0xaf, 0x7a, 0xf7, 0xaf, 0x7a, 0xf7, 0xfb, 0x6f, 0xb5, 0xfb, 0x6f, 0xb5, 0xfb,
+	0x5f, 0xb6, 0xfb, 0x5f, 0xb6, 0xfb, 0x5f, 0xb6, 0xfb, 0x5f, 0xb6, 0xfb, 0x5f, 0xb6, 0xfa, 0x6f,
+	0xb6, 0xfa, 0x6f, 0xb6, 0xfa, 0x6f, 0xb6, 0xfa, 0x6f, 0xb6, 0xfa, 0x7f, 0xa6, 0xfa, 0x7f, 0xa7,
+	0xfa, 0x6f, 0xa7, 0xfa, 0x7f, 0xa7, 0xfa, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xfa,	/* 55 */
+	0xff, 0xff, 0xeb, 0xf4, 0xef, 0x2f, 0x1f, 0x08, 0x28, 0xe6, 0x67, 0xc6, 0x86, 0xc6, 0x86, 0xc6,
+	0x95, 0xc6, 0x95, 0xc6, 0x86, 0xc6, 0x86, 0xc7, 0x75, 0xe7, 0x56, 0xe8, 0x36, 0xf1, 0xf0, 0xf3,
+	0xdf, 0x5b, 0xf5, 0xdf, 0x3f, 0x0f, 0x1f, 0x2e, 0x72, 0xad, 0x65, 0x9b, 0x67, 0x9a, 0x69, 0x79,
+	0x79, 0x79, 0x6b, 0x78, 0x6b, 0x78, 0x6b, 0x78, 0x6b, 0x78, 0x7a, 0x6a, 0x6a, 0x6a, 0x78, 0x7a,
+	0x86, 0x7c, 0x92, 0x8e, 0xf2, 0xf1, 0xf0, 0xf4, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xf0,	/* 56 */
+	0xff, 0xff, 0xe9, 0xf6, 0xdf, 0x3f, 0x0f, 0x17, 0x28, 0xe6, 0x67, 0xc6, 0x86, 0xc6, 0x96, 0xa6,
+	0xa6, 0xa6, 0xa7, 0x96, 0xb6, 0x96, 0xb6, 0x96, 0xb6, 0x96, 0xb6, 0x96, 0xb7, 0x86, 0xb7, 0x86,
+	0xa8, 0x96, 0x98, 0x96, 0x89, 0xa6, 0x6a, 0xa8, 0x2c, 0xbf, 0x6c, 0xc1, 0x7e, 0x92, 0x7f, 0xa6,
+	0xfb, 0x6f, 0xb6, 0xfb, 0x6f, 0xa6, 0xfb, 0x6f, 0xa6, 0xfb, 0x6f, 0xa6, 0xe2, 0x97, 0xe6, 0x29,
+	0xf0, 0xf1, 0xf1, 0xef, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,	/* 57 */
+};
+
+/// 低15位为偏移，最高位为1表示按行异或后编码
+LCD_FONT_OFFSETS_DEFINE(console_number_32x48_rle)
+{
+	0x0000,	/* 48 */
+	0x8055,	/* 49 */
+	0x008e,	/* 50 */
+	0x00d4,	/* 51 */
+	0x811c,	/* 52 */
+	0x0165,	/* 53 */
+	0x01ab,	/* 54 */
+	0x01fb,	/* 55 */
+	0x023e,	/* 56 */
+	0x0291,	/* 57 */
+};
+
+
+LCD_RLE_FONT_DEFINE(console_number_32x48_rle, 32, 48, 48);
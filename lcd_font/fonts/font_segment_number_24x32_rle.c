@@ -0,0 +1,53 @@
+
+#include "lcd_font_type.h"
+
+/**
+ * @brief 字体名称 segment_number_24x32_rle
+ * 由 lcd_font_packer.py --rle 从 segment_number_24x32 生成，请勿手工修改
+ * 
+ */
+LCD_FONT_DATA_DEFINE(segment_number_24x32_rle)
+{
+	0xff, 0xff, 0xf2, 0xe9, 0x1e, 0x1f, 0xf5, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xff, 0x51, 0xe1, 0x9e, 0xff, 0xff, 0xf2,	/* 48 */
+	0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xf1,	/* 49 */
+	0xff, 0xff, 0xf2, 0xe9, 0x1e, 0x1f, 0xf2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xcb, 0x1f,
+	0xf8, 0x1b, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xdf, 0xf2, 0x1e, 0x19, 0xef, 0xff, 0xff,
+	0x20,	/* 50 */
+	0xff, 0xff, 0xf2, 0xe9, 0x1e, 0x1f, 0xf2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xcb, 0x1f,
+	0xf8, 0x18, 0xd2, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x51, 0xe1, 0x9e, 0xff, 0xff,
+	0xf2,	/* 51 */
+	0xff, 0xff, 0xf1, 0x3a, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xaf, 0xff, 0x51,
+	0x8d, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff, 0x10,	/* 52 */
+	0xff, 0xff, 0xf2, 0xe9, 0x1e, 0x1f, 0xf5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xf9, 0x1f,
+	0xf2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0x51, 0xe1, 0x9e, 0xff, 0xff, 0xf2,	/* 53 */
+	0xff, 0xff, 0xf2, 0xe9, 0x1e, 0x1f, 0xf5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xf9, 0x1f,
+	0xf5, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xaf, 0xf5, 0x1e, 0x19, 0xef, 0xff, 0xff, 0x20,	/* 54 */
+	0xff, 0xff, 0xf2, 0xe9, 0x1e, 0x1f, 0xf2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xf1,	/* 55 */
+	0xff, 0xff, 0xf2, 0xe9, 0x1e, 0x1f, 0xf5, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xaf, 0xff,
+	0x51, 0xba, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xaf, 0xf5, 0x1e, 0x19, 0xef, 0xff, 0xff,
+	0x20,	/* 56 */
+	0xff, 0xff, 0xf2, 0xe9, 0x1e, 0x1f, 0xf5, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xaf, 0xff,
+	0x51, 0x8d, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xdf, 0xf5, 0x1e, 0x19, 0xef, 0xff, 0xff,
+	0x20,	/* 57 */
+};
+
+/// 低15位为偏移，最高位为1表示按行异或后编码
+LCD_FONT_OFFSETS_DEFINE(segment_number_24x32_rle)
+{
+	0x8000,	/* 48 */
+	0x801e,	/* 49 */
+	0x8039,	/* 50 */
+	0x805a,	/* 51 */
+	0x807b,	/* 52 */
+	0x809a,	/* 53 */
+	0x80b9,	/* 54 */
+	0x80d9,	/* 55 */
+	0x80f6,	/* 56 */
+	0x8117,	/* 57 */
+};
+
+
+LCD_RLE_FONT_DEFINE(segment_number_24x32_rle, 24, 32, 48);
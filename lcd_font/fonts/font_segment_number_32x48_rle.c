@@ -0,0 +1,71 @@
+
+#include "lcd_font_type.h"
+
+/**
+ * @brief 字体名称 segment_number_32x48_rle
+ * 由 lcd_font_packer.py --rle 从 segment_number_32x48 生成，请勿手工修改
+ * 
+ */
+LCD_FONT_DATA_DEFINE(segment_number_32x48_rle)
+{
+	0xff, 0xff, 0xff, 0xdf, 0x2e, 0x1f, 0x21, 0xc1, 0xf4, 0x1f, 0xff, 0x2d, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xdf, 0xff,
+	0x21, 0xf4, 0x1c, 0x1f, 0x21, 0xef, 0x2f, 0xff, 0xff, 0xff, 0xff, 0x10,	/* 48 */
+	0xff, 0xff, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14,
+	0xff, 0xff, 0xff, 0xff, 0xe0,	/* 49 */
+	0xff, 0xff, 0xff, 0xdf, 0x2e, 0x1f, 0x21, 0xc1, 0xf4, 0x1f, 0xfd, 0xf2, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x0f, 0x11, 0xf3, 0x1b, 0x1f, 0x31,
+	0xff, 0xf3, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xf0, 0xf2, 0xff, 0xd1, 0xf4, 0x1c, 0x1f, 0x21, 0xef, 0x2f, 0xff, 0xff, 0xff, 0xff,
+	0x10,	/* 50 */
+	0xff, 0xff, 0xff, 0xdf, 0x2e, 0x1f, 0x21, 0xc1, 0xf4, 0x1f, 0xfd, 0xf2, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x0f, 0x11, 0xf3, 0x1b, 0x1f, 0x31,
+	0xff, 0xef, 0x22, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xf9, 0xf2, 0xff, 0xf2, 0x1f, 0x41, 0xc1, 0xf2, 0x1e, 0xf2, 0xff, 0xff, 0xff, 0xff,
+	0xf1,	/* 51 */
+	0xff, 0xff, 0xff, 0xb4, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xdf, 0xf5, 0x1f, 0xf0, 0x1f, 0xfe, 0xf2, 0x22, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0xe0,	/* 52 */
+	0xff, 0xff, 0xff, 0xdf, 0x2e, 0x1f, 0x21, 0xc1, 0xf4, 0x1f, 0xff, 0x2f, 0x2f, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf0, 0xff, 0x21, 0xff, 0x21, 0xff,
+	0xdf, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfd, 0xf2, 0xff, 0xf2, 0x1f, 0x41, 0xc1, 0xf2, 0x1e, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xf1,	/* 53 */
+	0xff, 0xff, 0xff, 0xdf, 0x2e, 0x1f, 0x21, 0xc1, 0xf4, 0x1f, 0xff, 0x2f, 0x2f, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf0, 0xff, 0x21, 0xff, 0x21, 0xff,
+	0xf2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x2d, 0xff, 0xf2, 0x1f, 0x41, 0xc1, 0xf2, 0x1e, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xf1,	/* 54 */
+	0xff, 0xff, 0xff, 0xdf, 0x2e, 0x1f, 0x21, 0xc1, 0xf4, 0x1f, 0xfd, 0xf2, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xe0,	/* 55 */
+	0xff, 0xff, 0xff, 0xdf, 0x2e, 0x1f, 0x21, 0xc1, 0xf4, 0x1f, 0xff, 0x2d, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0x51, 0xff, 0x01, 0xff, 0xf3,
+	0xd2, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfd, 0xdf, 0xff, 0x21, 0xf4, 0x1c, 0x1f, 0x21, 0xef, 0x2f, 0xff, 0xff, 0xff, 0xff, 0x10,	/* 56 */
+	0xff, 0xff, 0xff, 0xdf, 0x2e, 0x1f, 0x21, 0xc1, 0xf4, 0x1f, 0xff, 0x2d, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0x51, 0xff, 0x01, 0xff, 0xef,
+	0x22, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xf9, 0xf2, 0xff, 0xf2, 0x1f, 0x41, 0xc1, 0xf2, 0x1e, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xf1,	/* 57 */
+};
+
+/// 低15位为偏移，最高位为1表示按行异或后编码
+LCD_FONT_OFFSETS_DEFINE(segment_number_32x48_rle)
+{
+	0x8000,	/* 48 */
+	0x803c,	/* 49 */
+	0x8071,	/* 50 */
+	0x80b2,	/* 51 */
+	0x80f3,	/* 52 */
+	0x812c,	/* 53 */
+	0x816b,	/* 54 */
+	0x81aa,	/* 55 */
+	0x81e2,	/* 56 */
+	0x8221,	/* 57 */
+};
+
+
+LCD_RLE_FONT_DEFINE(segment_number_32x48_rle, 32, 48, 48);
@@ -0,0 +1,275 @@
+
+#include "lcd_font_type.h"
+
+/**
+ * @brief 字体名称 sun_ascii_12x22_prop
+ * 由 lcd_font_packer.py --trim 从 sun_ascii_12x22 生成，请勿手工修改
+ * 
+ */
+LCD_FONT_DATA_DEFINE(sun_ascii_12x22_prop)
+{
+	0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0,	/* '!' */
+	0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,	/* '"' */
+	0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x0c, 0xc0, 0x3f, 0xe0, 0x3f, 0xe0, 0x19, 0x80, 0x19, 0x80,
+	0x33, 0x00, 0x33, 0x00, 0xff, 0x80, 0xff, 0x80, 0x66, 0x00, 0xcc, 0x00, 0xcc, 0x00,	/* '#' */
+	0x0c, 0x00, 0x3f, 0x00, 0x7f, 0x80, 0xcd, 0xc0, 0xcc, 0xc0, 0xcc, 0x00, 0x7c, 0x00, 0x3f, 0x00,
+	0x0f, 0x80, 0x0c, 0xc0, 0x0c, 0xc0, 0xcc, 0xc0, 0xff, 0x80, 0x7f, 0x00, 0x0c, 0x00,	/* '$' */
+	0x71, 0x80, 0x99, 0x80, 0x8b, 0x00, 0xcb, 0x00, 0x76, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+	0x18, 0x00, 0x1b, 0x80, 0x34, 0xc0, 0x34, 0x40, 0x66, 0x40, 0x63, 0x80,	/* '%' */
+	0x0e, 0x00, 0x1f, 0x00, 0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x1f, 0x00, 0x3c, 0x00, 0x7c, 0x00,
+	0xee, 0x00, 0xc6, 0xc0, 0xc3, 0xc0, 0xc3, 0x80, 0xc3, 0x00, 0x7f, 0xc0, 0x3c, 0xc0,	/* '&' */
+	0x60, 0xf0, 0xf0, 0x30, 0x30, 0x60, 0xc0, 0x80,	/* 0x27 */
+	0x18, 0x30, 0x60, 0x60, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x60, 0x60, 0x30, 0x18,	/* '(' */
+	0xc0, 0x60, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x60, 0xc0,	/* ')' */
+	0x1e, 0x00, 0x0c, 0x00, 0xcc, 0xc0, 0xed, 0xc0, 0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0xed, 0xc0,
+	0xcc, 0xc0, 0x0c, 0x00, 0x1e, 0x00,	/* 0x2A */
+	0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0x0c, 0x00, 0x0c, 0x00,
+	0x0c, 0x00, 0x0c, 0x00,	/* '+' */
+	0x60, 0xf0, 0xf0, 0x30, 0x30, 0x60, 0xc0, 0x80,	/* ',' */
+	0xff, 0xc0, 0xff, 0xc0,	/* '-' */
+	0x60, 0xf0, 0xf0, 0x60,	/* '.' */
+	0x00, 0xc0, 0x01, 0x80, 0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0c, 0x00,
+	0x0c, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60, 0x00, 0xc0, 0x00,	/* 0x2F */
+	0x1c, 0x3e, 0x46, 0x43, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc2, 0x62, 0x7c, 0x38,	/* '0' */
+	0x08, 0x18, 0x38, 0x78, 0xd8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff,	/* '1' */
+	0x3e, 0x00, 0x7f, 0x00, 0xc3, 0x80, 0x81, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x03, 0x00,
+	0x06, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x40, 0xff, 0xc0, 0xff, 0xc0,	/* '2' */
+	0x1f, 0x00, 0x3f, 0x80, 0x41, 0xc0, 0x80, 0xc0, 0x00, 0xc0, 0x01, 0xc0, 0x0f, 0x80, 0x1f, 0x80,
+	0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x80, 0xc0, 0xc0, 0x80, 0x7f, 0x00, 0x3e, 0x00,	/* '3' */
+	0x03, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x13, 0x00, 0x23, 0x00,
+	0x23, 0x00, 0x43, 0x00, 0x7f, 0xc0, 0xff, 0xc0, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,	/* '4' */
+	0x1f, 0x80, 0x1f, 0x80, 0x20, 0x00, 0x20, 0x00, 0x40, 0x00, 0x7f, 0x00, 0x63, 0x80, 0x01, 0xc0,
+	0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x80, 0xc0, 0xc0, 0xc0, 0x61, 0x80, 0x3f, 0x00,	/* '5' */
+	0x0e, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60, 0x00, 0xc0, 0x00, 0xcf, 0x00, 0xdf, 0x80,
+	0xe1, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0x80, 0x7f, 0x00, 0x3e, 0x00,	/* '6' */
+	0x3f, 0xc0, 0x7f, 0xc0, 0xc0, 0x80, 0x00, 0x80, 0x01, 0x80, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00,
+	0x02, 0x00, 0x02, 0x00, 0x06, 0x00, 0x04, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x08, 0x00,	/* '7' */
+	0x3c, 0x46, 0xc3, 0xc3, 0xc3, 0x62, 0x34, 0x18, 0x2c, 0x46, 0xc3, 0xc3, 0xc3, 0x62, 0x3c,	/* '8' */
+	0x1f, 0x00, 0x23, 0x80, 0x41, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe1, 0xc0, 0x7e, 0xc0,
+	0x3c, 0xc0, 0x00, 0xc0, 0x01, 0x80, 0x01, 0x80, 0x03, 0x00, 0x0e, 0x00, 0x78, 0x00,	/* '9' */
+	0x60, 0xf0, 0xf0, 0x60, 0x00, 0x00, 0x60, 0xf0, 0xf0, 0x60,	/* ':' */
+	0x60, 0xf0, 0xf0, 0x60, 0x00, 0x00, 0x60, 0xf0, 0xf0, 0x30, 0x30, 0x60, 0xc0, 0x80,	/* ';' */
+	0x00, 0xc0, 0x03, 0x80, 0x0e, 0x00, 0x38, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x38, 0x00, 0x0e, 0x00,
+	0x03, 0x80, 0x00, 0xc0,	/* '<' */
+	0xff, 0xc0, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 0xff, 0xc0,	/* '=' */
+	0xc0, 0x00, 0x70, 0x00, 0x1c, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x01, 0xc0, 0x07, 0x00, 0x1c, 0x00,
+	0x70, 0x00, 0xc0, 0x00,	/* '>' */
+	0x3c, 0x7e, 0xe7, 0x83, 0x03, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x30, 0x00, 0x00, 0x30, 0x30,	/* '?' */
+	0x1f, 0x00, 0x7f, 0x80, 0x60, 0xc0, 0xc0, 0xc0, 0xce, 0x40, 0xdf, 0x40, 0xd9, 0x40, 0xd9, 0x40,
+	0xcf, 0xc0, 0xc0, 0x00, 0x60, 0x00, 0x7f, 0xc0, 0x1f, 0xc0,	/* '@' */
+	0x06, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x09, 0x00, 0x11, 0x80, 0x11, 0x80, 0x10, 0x80,
+	0x3f, 0xc0, 0x20, 0xc0, 0x20, 0x40, 0x40, 0x60, 0x40, 0x60, 0xe0, 0xf0,	/* 'A' */
+	0xff, 0x00, 0x60, 0x80, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x61, 0x80, 0x7f, 0x80, 0x60, 0xc0,
+	0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xc0, 0xff, 0x80,	/* 'B' */
+	0x1f, 0x80, 0x20, 0xc0, 0x40, 0x40, 0x40, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
+	0xc0, 0x00, 0xc0, 0x00, 0x40, 0x00, 0x60, 0x40, 0x30, 0x80, 0x1f, 0x00,	/* 'C' */
+	0xff, 0x00, 0x61, 0xc0, 0x60, 0xc0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+	0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x61, 0x80, 0xfe, 0x00,	/* 'D' */
+	0xff, 0x80, 0x60, 0x80, 0x60, 0x80, 0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x7f, 0x00, 0x61, 0x00,
+	0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x40, 0x60, 0x40, 0xff, 0xc0,	/* 'E' */
+	0xff, 0x80, 0x60, 0x80, 0x60, 0x80, 0x60, 0x00, 0x60, 0x00, 0x61, 0x00, 0x7f, 0x00, 0x61, 0x00,
+	0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xf0, 0x00,	/* 'F' */
+	0x1f, 0x80, 0x20, 0xc0, 0x40, 0x40, 0x40, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
+	0xc3, 0xe0, 0xc0, 0xc0, 0x40, 0xc0, 0x60, 0xc0, 0x30, 0xc0, 0x1f, 0x00,	/* 'G' */
+	0xf0, 0xf0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x7f, 0xe0, 0x60, 0x60,
+	0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xf0, 0xf0,	/* 'H' */
+	0xfc, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xfc,	/* 'I' */
+	0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x10, 0xe0, 0xc0,	/* 'J' */
+	0xf0, 0xe0, 0x61, 0x80, 0x63, 0x00, 0x66, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x78, 0x00, 0x7c, 0x00,
+	0x6e, 0x00, 0x67, 0x00, 0x63, 0x80, 0x61, 0xc0, 0x60, 0xe0, 0xf0, 0x70,	/* 'K' */
+	0xf0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
+	0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x40, 0x60, 0x40, 0xff, 0xc0,	/* 'L' */
+	0xe0, 0x70, 0x60, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x59, 0x60, 0x59, 0x60, 0x59, 0x60,
+	0x4d, 0x60, 0x4e, 0x60, 0x4e, 0x60, 0x44, 0x60, 0x44, 0x60, 0xe4, 0xf0,	/* 'M' */
+	0xc0, 0x70, 0x60, 0x20, 0x70, 0x20, 0x78, 0x20, 0x58, 0x20, 0x4c, 0x20, 0x46, 0x20, 0x47, 0x20,
+	0x43, 0x20, 0x41, 0xa0, 0x40, 0xe0, 0x40, 0xe0, 0x40, 0x60, 0xe0, 0x30,	/* 'N' */
+	0x1e, 0x00, 0x23, 0x80, 0x41, 0x80, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x80, 0x60, 0x80, 0x31, 0x00, 0x1e, 0x00,	/* 'O' */
+	0xff, 0x00, 0x61, 0x80, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x61, 0x80, 0x6f, 0x00, 0x60, 0x00,
+	0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xf0, 0x00,	/* 'P' */
+	0x1e, 0x00, 0x23, 0x80, 0x41, 0x80, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+	0xc0, 0xc0, 0xc0, 0xc0, 0x60, 0x80, 0x70, 0x80, 0x3f, 0x00, 0x1c, 0x00, 0x3e, 0x00, 0x47, 0x20,
+	0x03, 0xc0,	/* 'Q' */
+	0xff, 0x00, 0x61, 0x80, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0x80, 0x7f, 0x00, 0x7c, 0x00,
+	0x6e, 0x00, 0x67, 0x00, 0x63, 0x80, 0x61, 0xc0, 0x60, 0xe0, 0xf0, 0x70,	/* 'R' */
+	0x3f, 0xc0, 0x60, 0xc0, 0xc0, 0x40, 0xc0, 0x40, 0xe0, 0x00, 0x78, 0x00, 0x3c, 0x00, 0x0f, 0x00,
+	0x03, 0x80, 0x01, 0xc0, 0x80, 0xc0, 0x80, 0xc0, 0xc1, 0x80, 0xff, 0x00,	/* 'S' */
+	0xff, 0xc0, 0x8c, 0x40, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+	0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x3f, 0x00,	/* 'T' */
+	0xf0, 0x70, 0x60, 0x20, 0x60, 0x20, 0x60, 0x20, 0x60, 0x20, 0x60, 0x20, 0x60, 0x20, 0x60, 0x20,
+	0x60, 0x20, 0x60, 0x20, 0x60, 0x20, 0x70, 0x40, 0x3f, 0xc0, 0x1f, 0x80,	/* 'U' */
+	0xe0, 0xe0, 0x60, 0x40, 0x30, 0x80, 0x30, 0x80, 0x30, 0x80, 0x19, 0x00, 0x19, 0x00, 0x19, 0x00,
+	0x0a, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,	/* 'V' */
+	0xfe, 0xf0, 0x66, 0x20, 0x66, 0x20, 0x66, 0x20, 0x76, 0x20, 0x77, 0x40, 0x33, 0x40, 0x37, 0x40,
+	0x3b, 0xc0, 0x3b, 0x80, 0x19, 0x80, 0x19, 0x80, 0x19, 0x80, 0x19, 0x80,	/* 'W' */
+	0xf0, 0x70, 0x60, 0x20, 0x30, 0x40, 0x38, 0x80, 0x18, 0x80, 0x0d, 0x00, 0x06, 0x00, 0x06, 0x00,
+	0x0b, 0x00, 0x11, 0x80, 0x11, 0xc0, 0x20, 0xc0, 0x40, 0x60, 0xe0, 0xf0,	/* 'X' */
+	0xf0, 0x70, 0x60, 0x20, 0x30, 0x40, 0x18, 0x80, 0x18, 0x80, 0x0d, 0x00, 0x06, 0x00, 0x06, 0x00,
+	0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0f, 0x00,	/* 'Y' */
+	0xff, 0x80, 0x83, 0x00, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x18, 0x00,
+	0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60, 0x80, 0xff, 0x80,	/* 'Z' */
+	0xf8, 0xf8, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xf8, 0xf8,	/* '[' */
+	0xc0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x18, 0x00, 0x0c, 0x00,
+	0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x80, 0x01, 0x80, 0x00, 0xc0,	/* 0x5C */
+	0xf8, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0xf8,	/* ']' */
+	0x08, 0x00, 0x1c, 0x00, 0x36, 0x00, 0x63, 0x00, 0xc1, 0x80,	/* '^' */
+	0xff, 0xf0, 0xff, 0xf0,	/* '_' */
+	0x20, 0x60, 0xc0, 0xc0, 0xf0, 0xf0, 0x60,	/* '`' */
+	0x3e, 0x00, 0x63, 0x00, 0x43, 0x00, 0x0f, 0x00, 0x73, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x00,
+	0xe7, 0x00, 0x7b, 0x80,	/* 'a' */
+	0x20, 0x00, 0x60, 0x00, 0xe0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x67, 0x80, 0x6f, 0xc0, 0x70, 0xe0,
+	0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x70, 0x60, 0x78, 0xc0, 0x4f, 0x80,	/* 'b' */
+	0x3f, 0x00, 0x63, 0x80, 0x41, 0x80, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xe0, 0x80,
+	0x61, 0x80, 0x3f, 0x00,	/* 'c' */
+	0x00, 0xc0, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x1e, 0xc0, 0x63, 0xc0, 0x41, 0xc0,
+	0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe1, 0xc0, 0x72, 0xc0, 0x3c, 0xe0,	/* 'd' */
+	0x1e, 0x00, 0x61, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0x00, 0xc0, 0x00, 0x60, 0x00,
+	0x30, 0xc0, 0x1f, 0x00,	/* 'e' */
+	0x0e, 0x13, 0x13, 0x30, 0x30, 0x30, 0x30, 0xfe, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x78,	/* 'f' */
+	0x3e, 0x40, 0x63, 0xc0, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0x63, 0x00, 0x7e, 0x00, 0xc0, 0x00,
+	0xff, 0x80, 0x7f, 0xc0, 0x40, 0xc0, 0x80, 0x40, 0x80, 0x40, 0xff, 0x80, 0x7f, 0x00,	/* 'g' */
+	0x20, 0x00, 0x60, 0x00, 0xe0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x73, 0x80, 0x61, 0x80,
+	0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0xf3, 0xc0,	/* 'h' */
+	0x30, 0x30, 0x00, 0x00, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xfc,	/* 'i' */
+	0x03, 0x03, 0x00, 0x00, 0x0f, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0xc3,
+	0xe2, 0x7c, 0x38,	/* 'j' */
+	0x60, 0x00, 0xe0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x61, 0xc0, 0x63, 0x00, 0x66, 0x00,
+	0x7c, 0x00, 0x78, 0x00, 0x7c, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x63, 0x80, 0xf1, 0xe0,	/* 'k' */
+	0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xfc,	/* 'l' */
+	0xdd, 0xc0, 0x6e, 0xe0, 0x66, 0x60, 0x66, 0x60, 0x66, 0x60, 0x66, 0x60, 0x66, 0x60, 0x66, 0x60,
+	0x66, 0x60, 0xef, 0x70,	/* 'm' */
+	0x4f, 0x00, 0xf3, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80,
+	0x61, 0x80, 0xf3, 0xc0,	/* 'n' */
+	0x1f, 0x00, 0x23, 0x80, 0x41, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0x80,
+	0x71, 0x00, 0x3e, 0x00,	/* 'o' */
+	0xef, 0x80, 0x71, 0xc0, 0x60, 0xe0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40,
+	0x70, 0x80, 0x7f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xf0, 0x00,	/* 'p' */
+	0x1e, 0x40, 0x23, 0xc0, 0x41, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0xc0,
+	0x71, 0xc0, 0x3f, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x01, 0xe0,	/* 'q' */
+	0xe7, 0x00, 0x69, 0x80, 0x71, 0x80, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
+	0x60, 0x00, 0xf0, 0x00,	/* 'r' */
+	0x7f, 0xc3, 0xc1, 0xe0, 0x78, 0x1e, 0x07, 0x83, 0xc3, 0xfe,	/* 's' */
+	0x08, 0x00, 0x08, 0x00, 0x18, 0x00, 0xff, 0x80, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
+	0x18, 0x00, 0x18, 0x00, 0x18, 0x40, 0x1c, 0x80, 0x0f, 0x00,	/* 't' */
+	0xf3, 0xc0, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80,
+	0x73, 0x80, 0x3c, 0xc0,	/* 'u' */
+	0xf0, 0x70, 0x60, 0x20, 0x30, 0x40, 0x30, 0x40, 0x18, 0x80, 0x18, 0x80, 0x0d, 0x00, 0x0d, 0x00,
+	0x06, 0x00, 0x06, 0x00,	/* 'v' */
+	0xff, 0x70, 0x66, 0x20, 0x66, 0x20, 0x66, 0x20, 0x37, 0x40, 0x3b, 0x40, 0x3b, 0x40, 0x19, 0x80,
+	0x19, 0x80, 0x19, 0x80,	/* 'w' */
+	0xf8, 0xf0, 0x70, 0x40, 0x38, 0x80, 0x1d, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x0b, 0x80, 0x11, 0xc0,
+	0x20, 0xe0, 0xf1, 0xf0,	/* 'x' */
+	0xf0, 0xf0, 0x60, 0x20, 0x30, 0x40, 0x30, 0x40, 0x18, 0x80, 0x18, 0x80, 0x0d, 0x00, 0x0d, 0x00,
+	0x06, 0x00, 0x06, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x78, 0x00, 0x70, 0x00,	/* 'y' */
+	0xff, 0xc0, 0xc1, 0xc0, 0x83, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x40,
+	0xe0, 0xc0, 0xff, 0xc0,	/* 'z' */
+	0x0e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0xe0, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0e,	/* '{' */
+	0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+	0xc0, 0xc0, 0xc0, 0xc0,	/* '|' */
+	0xe0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x0e, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0xe0,	/* '}' */
+	0x38, 0x40, 0x7c, 0xc0, 0xcf, 0x80, 0x87, 0x00,	/* '~' */
+};
+
+/// offset, width, height, x_offset, y_offset, advance, reserved
+LCD_FONT_GLYPHS_DEFINE(sun_ascii_12x22_prop)
+{
+	{0, 0, 0, 0, 0, 6, 0},	/* 0x20 */
+	{0, 2, 15, 0, 1, 3, 0},	/* '!' */
+	{15, 6, 6, 0, 1, 7, 0},	/* '"' */
+	{21, 11, 15, 0, 1, 12, 0},	/* '#' */
+	{51, 10, 15, 0, 1, 11, 0},	/* '$' */
+	{81, 10, 14, 0, 2, 11, 0},	/* '%' */
+	{109, 10, 15, 0, 1, 11, 0},	/* '&' */
+	{139, 4, 8, 0, 1, 5, 0},	/* 0x27 */
+	{147, 5, 15, 0, 1, 6, 0},	/* '(' */
+	{162, 5, 15, 0, 1, 6, 0},	/* ')' */
+	{177, 10, 11, 0, 5, 11, 0},	/* 0x2A */
+	{199, 10, 10, 0, 6, 11, 0},	/* '+' */
+	{219, 4, 8, 0, 13, 5, 0},	/* ',' */
+	{227, 10, 2, 0, 10, 11, 0},	/* '-' */
+	{231, 4, 4, 0, 12, 5, 0},	/* '.' */
+	{235, 10, 16, 0, 1, 11, 0},	/* 0x2F */
+	{267, 8, 15, 0, 1, 9, 0},	/* '0' */
+	{282, 8, 15, 0, 1, 9, 0},	/* '1' */
+	{297, 10, 15, 0, 1, 11, 0},	/* '2' */
+	{327, 10, 15, 0, 1, 11, 0},	/* '3' */
+	{357, 10, 15, 0, 1, 11, 0},	/* '4' */
+	{387, 10, 15, 0, 1, 11, 0},	/* '5' */
+	{417, 10, 15, 0, 1, 11, 0},	/* '6' */
+	{447, 10, 15, 0, 1, 11, 0},	/* '7' */
+	{477, 8, 15, 0, 1, 9, 0},	/* '8' */
+	{492, 10, 15, 0, 1, 11, 0},	/* '9' */
+	{522, 4, 10, 0, 6, 5, 0},	/* ':' */
+	{532, 4, 14, 0, 7, 5, 0},	/* ';' */
+	{546, 10, 10, 0, 6, 11, 0},	/* '<' */
+	{566, 10, 6, 0, 8, 11, 0},	/* '=' */
+	{578, 10, 10, 0, 6, 11, 0},	/* '>' */
+	{598, 8, 15, 0, 1, 9, 0},	/* '?' */
+	{613, 10, 13, 0, 4, 11, 0},	/* '@' */
+	{639, 12, 14, 0, 2, 13, 0},	/* 'A' */
+	{667, 11, 14, 0, 2, 12, 0},	/* 'B' */
+	{695, 10, 14, 0, 2, 11, 0},	/* 'C' */
+	{723, 11, 14, 0, 2, 12, 0},	/* 'D' */
+	{751, 10, 14, 0, 2, 11, 0},	/* 'E' */
+	{779, 9, 14, 0, 2, 10, 0},	/* 'F' */
+	{807, 11, 14, 0, 2, 12, 0},	/* 'G' */
+	{835, 12, 14, 0, 2, 13, 0},	/* 'H' */
+	{863, 6, 14, 0, 2, 7, 0},	/* 'I' */
+	{877, 7, 19, 0, 2, 8, 0},	/* 'J' */
+	{896, 12, 14, 0, 2, 13, 0},	/* 'K' */
+	{924, 10, 14, 0, 2, 11, 0},	/* 'L' */
+	{952, 12, 14, 0, 2, 13, 0},	/* 'M' */
+	{980, 12, 14, 0, 2, 13, 0},	/* 'N' */
+	{1008, 10, 14, 0, 2, 11, 0},	/* 'O' */
+	{1036, 10, 14, 0, 2, 11, 0},	/* 'P' */
+	{1064, 11, 17, 0, 2, 12, 0},	/* 'Q' */
+	{1098, 12, 14, 0, 2, 13, 0},	/* 'R' */
+	{1126, 10, 14, 0, 2, 11, 0},	/* 'S' */
+	{1154, 10, 14, 0, 2, 11, 0},	/* 'T' */
+	{1182, 12, 14, 0, 2, 13, 0},	/* 'U' */
+	{1210, 11, 14, 0, 2, 12, 0},	/* 'V' */
+	{1238, 12, 14, 0, 2, 13, 0},	/* 'W' */
+	{1266, 12, 14, 0, 2, 13, 0},	/* 'X' */
+	{1294, 12, 14, 0, 2, 13, 0},	/* 'Y' */
+	{1322, 9, 14, 0, 2, 10, 0},	/* 'Z' */
+	{1350, 5, 15, 0, 1, 6, 0},	/* '[' */
+	{1365, 10, 16, 0, 1, 11, 0},	/* 0x5C */
+	{1397, 5, 15, 0, 1, 6, 0},	/* ']' */
+	{1412, 9, 5, 0, 1, 10, 0},	/* '^' */
+	{1422, 12, 2, 0, 17, 13, 0},	/* '_' */
+	{1426, 4, 7, 0, 1, 5, 0},	/* '`' */
+	{1433, 9, 10, 0, 6, 10, 0},	/* 'a' */
+	{1453, 11, 15, 0, 1, 12, 0},	/* 'b' */
+	{1483, 9, 10, 0, 6, 10, 0},	/* 'c' */
+	{1503, 11, 15, 0, 1, 12, 0},	/* 'd' */
+	{1533, 10, 10, 0, 6, 11, 0},	/* 'e' */
+	{1553, 8, 15, 0, 1, 9, 0},	/* 'f' */
+	{1568, 10, 15, 0, 6, 11, 0},	/* 'g' */
+	{1598, 10, 15, 0, 1, 11, 0},	/* 'h' */
+	{1628, 6, 14, 0, 2, 7, 0},	/* 'i' */
+	{1642, 8, 19, 0, 2, 9, 0},	/* 'j' */
+	{1661, 11, 15, 0, 1, 12, 0},	/* 'k' */
+	{1691, 6, 15, 0, 1, 7, 0},	/* 'l' */
+	{1706, 12, 10, 0, 6, 13, 0},	/* 'm' */
+	{1726, 10, 10, 0, 6, 11, 0},	/* 'n' */
+	{1746, 10, 10, 0, 6, 11, 0},	/* 'o' */
+	{1766, 11, 15, 0, 6, 12, 0},	/* 'p' */
+	{1796, 11, 15, 0, 6, 12, 0},	/* 'q' */
+	{1826, 9, 10, 0, 6, 10, 0},	/* 'r' */
+	{1846, 8, 10, 0, 6, 9, 0},	/* 's' */
+	{1856, 10, 13, 0, 3, 11, 0},	/* 't' */
+	{1882, 10, 10, 0, 6, 11, 0},	/* 'u' */
+	{1902, 12, 10, 0, 6, 13, 0},	/* 'v' */
+	{1922, 12, 10, 0, 6, 13, 0},	/* 'w' */
+	{1942, 12, 10, 0, 6, 13, 0},	/* 'x' */
+	{1962, 12, 15, 0, 6, 13, 0},	/* 'y' */
+	{1992, 10, 10, 0, 6, 11, 0},	/* 'z' */
+	{2012, 7, 15, 0, 1, 8, 0},	/* '{' */
+	{2027, 2, 20, 0, 1, 3, 0},	/* '|' */
+	{2047, 7, 15, 0, 1, 8, 0},	/* '}' */
+	{2062, 10, 4, 0, 3, 11, 0},	/* '~' */
+};
+
+
+LCD_PROP_FONT_DEFINE(sun_ascii_12x22_prop, 13, 22, 0x20);
@@ -0,0 +1,699 @@
+
+#include "lcd_font_type.h"
+
+/**
+ * @brief 字体名称 sun_ascii_12x22_rle
+ * 由 lcd_font_packer.py --rle 从 sun_ascii_12x22 生成，请勿手工修改
+ * 
+ */
+LCD_FONT_DATA_DEFINE(sun_ascii_12x22_rle)
+{
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,	/* 0 */
+	0xff, 0xf6, 0x74, 0x11, 0x51, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x13, 0x17, 0x21, 0x29,
+	0x1f, 0x81, 0x95, 0x71, 0x31, 0x41, 0x11, 0x13, 0x11, 0x11, 0x21, 0x15, 0x11, 0x47, 0xff, 0xff,
+	0x20,	/* 1 */
+	0xff, 0xf6, 0x74, 0x92, 0x41, 0x11, 0x41, 0x32, 0x12, 0x31, 0xb1, 0x51, 0x51, 0x51, 0x51, 0xb1,
+	0x35, 0x31, 0x43, 0x42, 0x94, 0x7f, 0xff, 0xfe,	/* 2 */
+	0xff, 0xff, 0xf0, 0x22, 0x25, 0x83, 0xa3, 0x84, 0x85, 0x66, 0x67, 0x48, 0x49, 0x2f, 0xff, 0xff,
+	0x20,	/* 3 */
+	0xff, 0xc1, 0xa3, 0x85, 0x75, 0x67, 0x57, 0x49, 0x47, 0x57, 0x65, 0x75, 0x83, 0xa1, 0xff, 0xff,
+	0xf2,	/* 4 */
+	0xff, 0xf9, 0x1a, 0x39, 0x3a, 0x18, 0x23, 0x24, 0x41, 0x43, 0x41, 0x44, 0x21, 0x11, 0x28, 0x1a,
+	0x38, 0x56, 0x7f, 0xff, 0xfe,	/* 5 */
+	0xff, 0xf8, 0x29, 0x47, 0x66, 0x65, 0x83, 0xa2, 0xa3, 0x21, 0x21, 0x27, 0x2a, 0x29, 0x47, 0x65,
+	0x8f, 0xff, 0xf2,	/* 6 */
+	0xff, 0xf8, 0x29, 0x48, 0x47, 0x66, 0x65, 0x84, 0x85, 0x66, 0x67, 0x48, 0x49, 0x2f, 0xff, 0xff,
+	0x20,	/* 7 */
+	0x0f, 0xff, 0x82, 0x94, 0x84, 0x76, 0x66, 0x58, 0x48, 0x56, 0x66, 0x74, 0x84, 0x92, 0xff, 0xff,
+	0xf2,	/* 8 */
+	0xff, 0xf8, 0x29, 0x48, 0x47, 0x22, 0x26, 0x22, 0x25, 0x24, 0x24, 0x24, 0x25, 0x22, 0x26, 0x22,
+	0x27, 0x48, 0x49, 0x2f, 0xff, 0xff, 0x20,	/* 9 */
+	0x0f, 0xff, 0x82, 0x94, 0x84, 0x72, 0x22, 0x62, 0x22, 0x52, 0x42, 0x42, 0x42, 0x52, 0x22, 0x62,
+	0x22, 0x74, 0x84, 0x92, 0xff, 0xff, 0xf2,	/* 10 */
+	0xfd, 0x75, 0x78, 0x47, 0x21, 0x26, 0x22, 0x24, 0x47, 0x22, 0x26, 0x22, 0x25, 0x24, 0x24, 0x24,
+	0x25, 0x22, 0x26, 0x22, 0x27, 0x49, 0x2f, 0xff, 0xff, 0x30,	/* 11 */
+	0xfe, 0x29, 0x47, 0x22, 0x25, 0x24, 0x24, 0x24, 0x25, 0x22, 0x27, 0x49, 0x2a, 0x2a, 0x27, 0x84,
+	0x87, 0x2a, 0x2f, 0xff, 0xff, 0x20,	/* 12 */
+	0xfd, 0x77, 0x3f, 0x63, 0x95, 0xff, 0xff, 0xff, 0x92, 0x91, 0xf0, 0x17, 0x12, 0x19, 0x2f, 0xf2,	/* 13 */
+	0xfc, 0x86, 0x4f, 0x54, 0x84, 0xff, 0xff, 0xa2, 0x91, 0xf0, 0x12, 0x23, 0x12, 0x12, 0x16, 0x27,
+	0x17, 0x12, 0x19, 0x2f, 0xf3,	/* 14 */
+	0xff, 0xff, 0xfc, 0x23, 0x26, 0x21, 0x24, 0x21, 0x21, 0x21, 0x22, 0x41, 0x4f, 0x04, 0x14, 0x22,
+	0x12, 0x12, 0x12, 0x42, 0x12, 0x62, 0x32, 0xff, 0xff, 0xe0,	/* 15 */
+	0xf7, 0x1a, 0x29, 0x38, 0x47, 0x56, 0x65, 0x74, 0x83, 0x92, 0xa3, 0x94, 0x85, 0x76, 0x67, 0x58,
+	0x49, 0x3a, 0x2b, 0x1f, 0xa0,	/* 16 */
+	0xd1, 0xb2, 0xa3, 0x94, 0x85, 0x76, 0x67, 0x58, 0x49, 0x3a, 0x29, 0x38, 0x47, 0x56, 0x65, 0x74,
+	0x83, 0x92, 0xa1, 0xff, 0x40,	/* 17 */
+	0xff, 0xf8, 0x1a, 0x38, 0x56, 0x74, 0x96, 0x39, 0x36, 0x94, 0x76, 0x58, 0x3a, 0x1f, 0xff, 0xff,
+	0x30,	/* 18 */
+	0xe2, 0x32, 0xff, 0xff, 0xff, 0xff, 0x52, 0x32, 0xf2, 0x23, 0x2f, 0x22, 0x32, 0xff, 0xff, 0x30,	/* 19 */
+	0xfc, 0x92, 0x13, 0x22, 0x21, 0x1f, 0xf5, 0x1c, 0x1c, 0x1f, 0xff, 0xfb, 0x16, 0x14, 0x32, 0x3f,
+	0xff, 0xf1,	/* 20 */
+	0xfc, 0x56, 0x23, 0x25, 0x23, 0x25, 0x2a, 0x2b, 0x56, 0x23, 0x25, 0x23, 0x26, 0x5b, 0x2a, 0x25,
+	0x23, 0x25, 0x23, 0x26, 0x5f, 0xff, 0xff, 0x10,	/* 21 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xfb, 0xaf, 0xff, 0xf1,	/* 22 */
+	0xfe, 0x1a, 0x38, 0x56, 0x74, 0x96, 0x39, 0x36, 0x94, 0x76, 0x58, 0x3a, 0x1f, 0x4a, 0x2a, 0xff,
+	0xff, 0x10,	/* 23 */
+	0xfe, 0x1a, 0x38, 0x56, 0x74, 0x96, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3f, 0xff,
+	0xff, 0x20,	/* 24 */
+	0xfd, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x36, 0x94, 0x76, 0x58, 0x3a, 0x1f,
+	0xff, 0xf6,	/* 25 */
+	0xff, 0xff, 0xf1, 0x1a, 0x29, 0x38, 0xa1, 0xb2, 0xa3, 0x3a, 0x2b, 0x1f, 0xff, 0xff, 0xf1,	/* 26 */
+	0xff, 0xff, 0xf4, 0x1b, 0x2a, 0x33, 0xa2, 0xb1, 0xa8, 0x39, 0x2a, 0x1f, 0xff, 0xff, 0xd0,	/* 27 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0xf9, 0x7f, 0x09, 0xff, 0xf4,	/* 28 */
+	0xff, 0xff, 0xf1, 0x12, 0x17, 0x22, 0x25, 0x32, 0x33, 0xa1, 0xc1, 0xa3, 0x32, 0x35, 0x22, 0x27,
+	0x12, 0x1f, 0xff, 0xff, 0xd0,	/* 29 */
+	0xff, 0xff, 0xf2, 0x1b, 0x1a, 0x39, 0x38, 0x57, 0x56, 0x75, 0x74, 0x93, 0x9f, 0xff, 0xfe,	/* 30 */
+	0xff, 0xff, 0xd9, 0x39, 0x47, 0x57, 0x65, 0x75, 0x83, 0x93, 0xa1, 0xb1, 0xff, 0xff, 0xf3,	/* 31 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,	/* 32 */
+	0xf2, 0x2f, 0xff, 0xff, 0xff, 0xfa, 0x2f, 0x72, 0xf7, 0x2f, 0xff, 0xf5,	/* 33 */
+	0xf0, 0x22, 0x2f, 0xff, 0xf6, 0x22, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,	/* 34 */
+	0xf3, 0x22, 0x26, 0x22, 0x26, 0x22, 0x25, 0x22, 0x24, 0x93, 0x94, 0x22, 0x26, 0x22, 0x25, 0x22,
+	0x26, 0x22, 0x24, 0x93, 0x94, 0x22, 0x25, 0x22, 0x26, 0x22, 0x2f, 0xff, 0xff, 0x20,	/* 35 */
+	0xf2, 0x28, 0x65, 0x83, 0x22, 0x21, 0x32, 0x22, 0x22, 0x22, 0x22, 0x27, 0x58, 0x68, 0x57, 0x22,
+	0x26, 0x22, 0x22, 0x22, 0x22, 0x22, 0x94, 0x78, 0x2f, 0xff, 0xff, 0x20,	/* 36 */
+	0xfb, 0x33, 0x23, 0x31, 0x1a, 0x12, 0x11, 0x14, 0x1a, 0x11, 0x41, 0x15, 0x3c, 0x11, 0x1f, 0x51,
+	0x11, 0xc3, 0x51, 0x14, 0x11, 0xa1, 0x41, 0x11, 0x21, 0xa1, 0x13, 0x32, 0x33, 0xff, 0xff, 0x20,	/* 37 */
+	0xf2, 0x38, 0x56, 0x23, 0x25, 0x23, 0x25, 0x23, 0x26, 0x56, 0x47, 0x56, 0x31, 0x35, 0x23, 0x21,
+	0x22, 0x24, 0x42, 0x24, 0x33, 0x24, 0x25, 0x94, 0x42, 0x2f, 0xff, 0xfd,	/* 38 */
+	0xf1, 0x29, 0x48, 0x4a, 0x2a, 0x29, 0x29, 0x2a, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe,	/* 39 */
+	0xf4, 0x29, 0x29, 0x2a, 0x29, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2a, 0x2b, 0x2b, 0x2f,
+	0xff, 0xff, 0x00,	/* 40 */
+	0xf0, 0x2b, 0x2b, 0x2a, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x29, 0x2a, 0x29, 0x29, 0x2f,
+	0xff, 0xff, 0x40,	/* 41 */
+	0xff, 0xff, 0x44, 0x92, 0x62, 0x22, 0x22, 0x23, 0x12, 0x13, 0x42, 0x22, 0xf3, 0x22, 0x24, 0x31,
+	0x21, 0x32, 0x22, 0x22, 0x26, 0x29, 0x4f, 0xff, 0xff, 0x10,	/* 42 */
+	0xff, 0xff, 0xf2, 0x2f, 0xfc, 0x42, 0x4e, 0x42, 0x4f, 0xfc, 0x2f, 0xff, 0xf5,	/* 43 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x94, 0x84, 0xa2, 0xa2, 0x92, 0x92, 0xa1, 0xf5,	/* 44 */
+	0xff, 0xff, 0xff, 0xff, 0x1a, 0xea, 0xff, 0xff, 0xff, 0xf4,	/* 45 */
+	0xff, 0xff, 0xff, 0xff, 0xfd, 0x29, 0x48, 0x49, 0x2f, 0xff, 0xff, 0x30,	/* 46 */
+	0xf6, 0x29, 0x2a, 0x29, 0x2a, 0x29, 0x2a, 0x29, 0x2a, 0x29, 0x2a, 0x29, 0x2a, 0x29, 0x2a, 0x29,
+	0x2f, 0xff, 0xf9,	/* 47 */
+	0xf2, 0x38, 0x13, 0x16, 0x4c, 0x11, 0x14, 0x1f, 0xff, 0xff, 0xf0, 0x14, 0x11, 0x1c, 0x46, 0x13,
+	0x18, 0x3f, 0xff, 0xf5,	/* 48 */
+	0xf3, 0x1a, 0x1a, 0x1a, 0x1a, 0x11, 0x19, 0x2f, 0xff, 0xff, 0xff, 0x13, 0x23, 0x48, 0xff, 0xff,
+	0x20,	/* 49 */
+	0xf0, 0x56, 0x74, 0x24, 0x33, 0x16, 0x2a, 0x2a, 0x2a, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x26,
+	0x12, 0xa2, 0xaf, 0xff, 0xfd,	/* 50 */
+	0xf1, 0x56, 0x74, 0x15, 0x32, 0x17, 0x2a, 0x29, 0x36, 0x56, 0x6a, 0x3a, 0x2a, 0x22, 0x17, 0x22,
+	0x26, 0x14, 0x76, 0x5f, 0xff, 0xff, 0x10,	/* 51 */
+	0xf4, 0x29, 0x1f, 0x72, 0xf6, 0x2f, 0x62, 0xf6, 0x2b, 0x42, 0x22, 0x1b, 0x62, 0x2f, 0xf2, 0x2f,
+	0xff, 0xf3,	/* 52 */
+	0xf1, 0x66, 0x65, 0x1b, 0x1a, 0x1b, 0x75, 0x23, 0x3a, 0x3a, 0x2a, 0x2a, 0x22, 0x17, 0x22, 0x26,
+	0x23, 0x24, 0x25, 0x6f, 0xff, 0xff, 0x00,	/* 53 */
+	0xf2, 0x38, 0x29, 0x29, 0x2a, 0x29, 0x2a, 0x22, 0x44, 0x21, 0x63, 0x34, 0x32, 0x26, 0x22, 0x26,
+	0x22, 0x26, 0x22, 0x35, 0x14, 0x76, 0x5f, 0xff, 0xff, 0x10,	/* 54 */
+	0xf0, 0x83, 0x92, 0x26, 0x1b, 0x1a, 0x2a, 0x1b, 0x1a, 0x2a, 0x1b, 0x1a, 0x2a, 0x1b, 0x1a, 0x2a,
+	0x1f, 0xff, 0xff, 0x30,	/* 55 */
+	0xf1, 0x47, 0x13, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x23, 0x17, 0x21, 0x19, 0x29, 0x11,
+	0x27, 0x13, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x23, 0x17, 0x4f, 0xff, 0xff, 0x10,	/* 56 */
+	0xf1, 0x56, 0x13, 0x34, 0x15, 0x32, 0x26, 0x22, 0x26, 0x22, 0x26, 0x22, 0x34, 0x33, 0x61, 0x24,
+	0x42, 0x2a, 0x29, 0x2a, 0x29, 0x28, 0x36, 0x4f, 0xff, 0xff, 0x30,	/* 57 */
+	0xff, 0xff, 0xf1, 0x29, 0x48, 0x49, 0x2f, 0xf4, 0x29, 0x48, 0x49, 0x2f, 0xff, 0xff, 0x30,	/* 58 */
+	0xff, 0xff, 0xfd, 0x29, 0x48, 0x49, 0x2f, 0xf4, 0x29, 0x48, 0x4a, 0x2a, 0x29, 0x29, 0x2a, 0x1f,
+	0x50,	/* 59 */
+	0xff, 0xff, 0xf6, 0x28, 0x37, 0x37, 0x37, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x2f, 0xff, 0xfd,	/* 60 */
+	0xff, 0xff, 0xff, 0x7a, 0xea, 0xea, 0xea, 0xff, 0xff, 0xfa,	/* 61 */
+	0xff, 0xff, 0xd2, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x73, 0x73, 0x73, 0x82, 0xff, 0xff, 0xf6,	/* 62 */
+	0xf1, 0x47, 0x65, 0x32, 0x34, 0x15, 0x2a, 0x2a, 0x29, 0x29, 0x29, 0x29, 0x2a, 0x2f, 0xf4, 0x2a,
+	0x2f, 0xff, 0xff, 0x30,	/* 63 */
+	0xff, 0xf7, 0x55, 0x25, 0x16, 0x51, 0x12, 0x11, 0x1d, 0x31, 0x16, 0x13, 0x19, 0x2f, 0x51, 0x12,
+	0x11, 0x76, 0x21, 0x11, 0xc7, 0x32, 0xc7, 0xff, 0xf4,	/* 64 */
+	0xfe, 0x2f, 0x62, 0x11, 0xf7, 0x18, 0x23, 0x1f, 0x71, 0x61, 0x14, 0x11, 0x55, 0xc1, 0x42, 0x71,
+	0xd1, 0x11, 0x51, 0x24, 0x54, 0xff, 0xff, 0x00,	/* 65 */
+	0xf9, 0x84, 0x12, 0x6c, 0x1f, 0xf3, 0x11, 0x15, 0x48, 0x51, 0x1a, 0x11, 0x1f, 0xff, 0x01, 0x11,
+	0x11, 0x25, 0x11, 0x29, 0xff, 0xff, 0x30,	/* 66 */
+	0xfd, 0x65, 0x61, 0x13, 0x25, 0x1c, 0x12, 0x1f, 0xff, 0xfb, 0x1d, 0x16, 0x13, 0x11, 0x14, 0x24,
+	0x11, 0x56, 0x5f, 0xff, 0xf3,	/* 67 */
+	0xf9, 0x84, 0x12, 0x41, 0x29, 0x1c, 0x11, 0x1f, 0xff, 0xff, 0xf5, 0x18, 0x32, 0x12, 0x63, 0x7f,
+	0xff, 0xf5,	/* 68 */
+	0xfa, 0x93, 0x12, 0x5f, 0x91, 0xf7, 0x17, 0x48, 0x4c, 0x1f, 0xf7, 0x1e, 0x12, 0x63, 0xaf, 0xff,
+	0xf1,	/* 69 */
+	0xfa, 0x93, 0x12, 0x5f, 0x91, 0xf7, 0x17, 0x48, 0x4c, 0x1f, 0xff, 0x71, 0x21, 0x84, 0xff, 0xff,
+	0x70,	/* 70 */
+	0xfd, 0x65, 0x61, 0x13, 0x25, 0x1c, 0x12, 0x1f, 0xff, 0x85, 0x72, 0x21, 0x11, 0xd1, 0xa1, 0x11,
+	0xa1, 0x16, 0x55, 0xff, 0xff, 0x30,	/* 71 */
+	0xf9, 0x44, 0x52, 0x14, 0x12, 0x1f, 0xff, 0x66, 0x66, 0xff, 0xff, 0x31, 0x21, 0x41, 0x25, 0x44,
+	0xff, 0xff, 0x00,	/* 72 */
+	0xfc, 0x66, 0x22, 0x2f, 0xff, 0xff, 0xff, 0xff, 0x32, 0x22, 0x66, 0xff, 0xff, 0x30,	/* 73 */
+	0xfc, 0x66, 0x22, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x74, 0xa1, 0x92, 0x80,	/* 74 */
+	0xf9, 0x44, 0x32, 0x24, 0x24, 0x23, 0x25, 0x22, 0x26, 0x21, 0x27, 0x48, 0x48, 0x57, 0x21, 0x36,
+	0x22, 0x35, 0x23, 0x34, 0x24, 0x33, 0x25, 0x31, 0x45, 0x3f, 0xff, 0xfc,	/* 75 */
+	0xfa, 0x48, 0x12, 0x1f, 0xff, 0xff, 0xff, 0xf5, 0x1e, 0x12, 0x63, 0xaf, 0xff, 0xf1,	/* 76 */
+	0xf9, 0x36, 0x47, 0x12, 0x13, 0x1f, 0xf4, 0x11, 0x12, 0x2f, 0xf0, 0x11, 0x1c, 0x2f, 0x51, 0x11,
+	0xf2, 0x11, 0x15, 0x12, 0x42, 0x12, 0x4f, 0xff, 0xf0,	/* 77 */
+	0xf9, 0x27, 0x41, 0x16, 0x11, 0x13, 0x1c, 0x19, 0x1c, 0x11, 0x1a, 0x11, 0x1c, 0x19, 0x1c, 0x11,
+	0x1a, 0x11, 0x1f, 0x71, 0x31, 0x11, 0x61, 0x14, 0x72, 0xff, 0xff, 0x00,	/* 78 */
+	0xfd, 0x47, 0x41, 0x24, 0x23, 0x1c, 0x11, 0x12, 0x1f, 0xff, 0xfb, 0x18, 0x14, 0x1a, 0x11, 0x13,
+	0x25, 0x11, 0x47, 0x4f, 0xff, 0xf4,	/* 79 */
+	0xfa, 0x84, 0x12, 0x41, 0x1a, 0x11, 0x1f, 0xf3, 0x11, 0x16, 0x31, 0x17, 0x4f, 0xff, 0xf4, 0x12,
+	0x18, 0x4f, 0xff, 0xf7,	/* 80 */
+	0xfd, 0x47, 0x41, 0x24, 0x23, 0x1c, 0x11, 0x12, 0x1f, 0xff, 0xfb, 0x11, 0x16, 0x15, 0x19, 0x12,
+	0x55, 0x13, 0x26, 0x13, 0x16, 0x42, 0x12, 0x12, 0x13, 0x12, 0x37, 0x4f, 0xa0,	/* 81 */
+	0xf9, 0x85, 0x24, 0x24, 0x25, 0x23, 0x25, 0x23, 0x25, 0x23, 0x25, 0x14, 0x75, 0x57, 0x21, 0x36,
+	0x22, 0x35, 0x23, 0x34, 0x24, 0x33, 0x25, 0x31, 0x45, 0x3f, 0xff, 0xfc,	/* 82 */
+	0xfc, 0x83, 0x25, 0x22, 0x27, 0x12, 0x27, 0x12, 0x3a, 0x49, 0x4a, 0x4a, 0x3a, 0x32, 0x17, 0x22,
+	0x17, 0x22, 0x25, 0x23, 0x8f, 0xff, 0xff, 0x00,	/* 83 */
+	0xfa, 0xa3, 0x32, 0x33, 0x18, 0x1f, 0xff, 0xff, 0xff, 0xf4, 0x22, 0x26, 0x6f, 0xff, 0xf3,	/* 84 */
+	0xf9, 0x45, 0x42, 0x15, 0x11, 0x1f, 0xff, 0xff, 0xff, 0x61, 0x52, 0x21, 0x25, 0x51, 0x61, 0x56,
+	0xff, 0xff, 0x30,	/* 85 */
+	0xf9, 0x35, 0x31, 0x17, 0x11, 0x12, 0x11, 0x14, 0x2f, 0xd1, 0x11, 0x22, 0xff, 0x01, 0x22, 0x91,
+	0xf7, 0x11, 0x1f, 0xf4, 0x1f, 0xff, 0xf6,	/* 86 */
+	0xf9, 0x71, 0x52, 0x23, 0x21, 0x1f, 0xc1, 0xf0, 0x11, 0x22, 0x13, 0x1b, 0x1a, 0x22, 0x1c, 0x14,
+	0x13, 0x1f, 0xfe, 0x22, 0x2f, 0xff, 0xf3,	/* 87 */
+	0xf9, 0x45, 0x31, 0x27, 0x13, 0x25, 0x14, 0x33, 0x16, 0x23, 0x17, 0x21, 0x19, 0x2a, 0x29, 0x11,
+	0x27, 0x13, 0x26, 0x13, 0x34, 0x15, 0x23, 0x17, 0x21, 0x35, 0x4f, 0xff, 0xfc,	/* 88 */
+	0xf9, 0x45, 0x31, 0x27, 0x13, 0x25, 0x15, 0x23, 0x16, 0x23, 0x17, 0x21, 0x19, 0x2a, 0x2a, 0x2a,
+	0x2a, 0x2a, 0x2a, 0x29, 0x4f, 0xff, 0xff, 0x10,	/* 89 */
+	0xfb, 0x93, 0x15, 0x2a, 0x29, 0x2a, 0x29, 0x2a, 0x29, 0x2a, 0x29, 0x2a, 0x29, 0x2a, 0x25, 0x13,
+	0x9f, 0xff, 0xfd,	/* 90 */
+	0xf1, 0x5f, 0x63, 0xff, 0xff, 0xff, 0xff, 0x93, 0xf4, 0x5f, 0xff, 0xf3,	/* 91 */
+	0xd2, 0xb2, 0xa2, 0xb2, 0xa2, 0xb2, 0xa2, 0xb2, 0xa2, 0xb2, 0xa2, 0xb2, 0xa2, 0xb2, 0xa2, 0xb2,
+	0xff, 0xff, 0x10,	/* 92 */
+	0xf0, 0x5f, 0x43, 0xff, 0xff, 0xff, 0xff, 0x93, 0xf6, 0x5f, 0xff, 0xf4,	/* 93 */
+	0xf2, 0x1a, 0x38, 0x21, 0x26, 0x23, 0x24, 0x25, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,	/* 94 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0x60,	/* 95 */
+	0xf4, 0x1a, 0x29, 0x2a, 0x2a, 0x48, 0x49, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,	/* 96 */
+	0xff, 0xff, 0xf1, 0x56, 0x23, 0x25, 0x14, 0x28, 0x45, 0x32, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+	0x24, 0x32, 0x35, 0x41, 0x3f, 0xff, 0xfd,	/* 97 */
+	0xe1, 0xa1, 0xa1, 0xb1, 0xfd, 0x47, 0x14, 0x15, 0x52, 0x14, 0x14, 0x1f, 0xfc, 0x1c, 0x13, 0x11,
+	0x13, 0x21, 0x31, 0x13, 0x12, 0x5f, 0xff, 0xf3,	/* 98 */
+	0xff, 0xff, 0xf0, 0x65, 0x23, 0x34, 0x15, 0x23, 0x2a, 0x2a, 0x2a, 0x2a, 0x35, 0x14, 0x24, 0x25,
+	0x6f, 0xff, 0xff, 0x00,	/* 99 */
+	0xf6, 0x29, 0x1b, 0x1f, 0xf1, 0x46, 0x51, 0x16, 0x13, 0x15, 0x16, 0x1f, 0xfc, 0x14, 0x14, 0x12,
+	0x12, 0x25, 0x12, 0x33, 0x13, 0x42, 0x3f, 0xff, 0xf0,	/* 100 */
+	0xff, 0xff, 0xf1, 0x46, 0x24, 0x23, 0x26, 0x22, 0x26, 0x22, 0xa2, 0x2a, 0x2b, 0x2b, 0x24, 0x25,
+	0x5f, 0xff, 0xff, 0x00,	/* 101 */
+	0xf3, 0x38, 0x31, 0x1f, 0x31, 0x32, 0xff, 0xa2, 0x23, 0x52, 0x23, 0xff, 0xff, 0x61, 0x21, 0x84,
+	0xff, 0xff, 0x50,	/* 102 */
+	0xff, 0xff, 0xf0, 0x52, 0x13, 0x23, 0x42, 0x25, 0x23, 0x25, 0x23, 0x25, 0x24, 0x23, 0x25, 0x65,
+	0x2a, 0x94, 0x93, 0x16, 0x22, 0x18, 0x12, 0x18, 0x12, 0x94, 0x7f, 0x00,	/* 103 */
+	0xf0, 0x1a, 0x1a, 0x1b, 0x1f, 0xc4, 0x73, 0x21, 0x61, 0x21, 0xff, 0xff, 0xf2, 0x12, 0x12, 0x12,
+	0x12, 0x42, 0x4f, 0xff, 0xf1,	/* 104 */
+	0xfe, 0x2f, 0x72, 0xf5, 0x48, 0x2f, 0xff, 0xff, 0xf4, 0x22, 0x26, 0x6f, 0xff, 0xf3,	/* 105 */
+	0xff, 0x22, 0xf7, 0x2f, 0x54, 0x82, 0xff, 0xff, 0xff, 0xc1, 0xc1, 0xc1, 0x41, 0x41, 0x24, 0x61,
+	0x31, 0x83, 0x50,	/* 106 */
+	0xd2, 0x93, 0xa2, 0xa2, 0xa2, 0xa2, 0x43, 0x32, 0x32, 0x52, 0x22, 0x65, 0x74, 0x85, 0x72, 0x13,
+	0x62, 0x23, 0x52, 0x33, 0x34, 0x34, 0xff, 0xff, 0xd0,	/* 107 */
+	0xf0, 0x48, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x22, 0x26, 0x6f, 0xff, 0xf3,	/* 108 */
+	0xff, 0xff, 0xc2, 0x13, 0x13, 0x21, 0x12, 0x22, 0x21, 0x51, 0x31, 0xff, 0xff, 0xf0, 0x13, 0x12,
+	0x13, 0x41, 0x41, 0x3f, 0xff, 0xf0,	/* 109 */
+	0xff, 0xff, 0xe1, 0x24, 0x41, 0x14, 0x21, 0x31, 0x21, 0x21, 0xff, 0xff, 0xf2, 0x12, 0x12, 0x12,
+	0x12, 0x42, 0x4f, 0xff, 0xf1,	/* 110 */
+	0xff, 0xff, 0xf1, 0x56, 0x42, 0x14, 0x23, 0x12, 0x12, 0x16, 0x1f, 0xfc, 0x16, 0x12, 0x12, 0x13,
+	0x24, 0x12, 0x46, 0x5f, 0xff, 0xf4,	/* 111 */
+	0xff, 0xff, 0xc3, 0x15, 0x31, 0x24, 0x21, 0x51, 0x31, 0x21, 0x91, 0xff, 0xf4, 0x14, 0x14, 0x26,
+	0x56, 0x5f, 0xfa, 0x12, 0x18, 0x48,	/* 112 */
+	0xff, 0xff, 0xf1, 0x42, 0x14, 0x41, 0x24, 0x23, 0x15, 0x16, 0x1f, 0xfc, 0x19, 0x12, 0x13, 0x15,
+	0x12, 0x37, 0x6f, 0xff, 0x21, 0x21, 0x84,	/* 113 */
+	0xff, 0xff, 0xd3, 0x23, 0x41, 0x33, 0x11, 0x62, 0xa1, 0x32, 0xff, 0xff, 0x31, 0x21, 0x84, 0xff,
+	0xff, 0x70,	/* 114 */
+	0xff, 0xff, 0xf0, 0x74, 0x24, 0x24, 0x25, 0x14, 0x3a, 0x4a, 0x4a, 0x34, 0x15, 0x24, 0x24, 0x24,
+	0x7f, 0xff, 0xff, 0x00,	/* 115 */
+	0xff, 0xb1, 0xf7, 0x18, 0x32, 0x43, 0x32, 0x4f, 0xff, 0xfc, 0x17, 0x12, 0x25, 0x12, 0x37, 0x4f,
+	0xff, 0xf3,	/* 116 */
+	0xff, 0xff, 0xd4, 0x24, 0x21, 0x21, 0x21, 0x21, 0xff, 0xff, 0xf2, 0x12, 0x16, 0x12, 0x41, 0x14,
+	0x42, 0x2f, 0xff, 0xf1,	/* 117 */
+	0xff, 0xff, 0xc4, 0x53, 0x12, 0x71, 0x32, 0x51, 0x42, 0x51, 0x52, 0x31, 0x62, 0x31, 0x72, 0x11,
+	0x82, 0x11, 0x92, 0xa2, 0xff, 0xff, 0xf2,	/* 118 */
+	0xff, 0xff, 0xc8, 0x14, 0x22, 0x21, 0x11, 0x11, 0xfa, 0x11, 0x13, 0x11, 0x25, 0x2f, 0x51, 0x31,
+	0x12, 0xfe, 0x22, 0x2f, 0xff, 0xf3,	/* 119 */
+	0xff, 0xff, 0xc5, 0x34, 0x13, 0x51, 0x43, 0x31, 0x63, 0x11, 0x83, 0xa3, 0x81, 0x13, 0x61, 0x33,
+	0x41, 0x53, 0x14, 0x35, 0xff, 0xff, 0xc0,	/* 120 */
+	0xff, 0xff, 0xc4, 0x44, 0x12, 0x71, 0x32, 0x51, 0x42, 0x51, 0x52, 0x31, 0x62, 0x31, 0x72, 0x11,
+	0x82, 0x11, 0x92, 0xa2, 0xa1, 0xa2, 0xa1, 0x84, 0x83, 0xf5,	/* 121 */
+	0xff, 0xff, 0xda, 0x22, 0x53, 0x21, 0x53, 0x83, 0x83, 0x83, 0x83, 0x83, 0x51, 0x23, 0x52, 0x2a,
+	0xff, 0xff, 0xd0,	/* 122 */
+	0xf3, 0x38, 0x2a, 0x2a, 0x2a, 0x2a, 0x29, 0x28, 0x3b, 0x2b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x3f,
+	0xff, 0xff, 0x00,	/* 123 */
+	0xf2, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x50,	/* 124 */
+	0xf0, 0x3b, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x2b, 0x38, 0x29, 0x2a, 0x2a, 0x2a, 0x2a, 0x28, 0x3f,
+	0xff, 0xff, 0x30,	/* 125 */
+	0xff, 0x93, 0x41, 0x35, 0x22, 0x22, 0x25, 0x31, 0x43, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,	/* 126 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf9, 0xc0,	/* 127 */
+#if CONFIG_LCD_FONT_EXTENDED_ASCII
+	0xfd, 0x65, 0x15, 0x23, 0x17, 0x13, 0x1a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2b, 0x1b, 0x26, 0x14,
+	0x24, 0x16, 0x58, 0x2b, 0x2b, 0x27, 0x4f, 0xd0,	/* 128 */
+	0xfc, 0x22, 0x2f, 0x32, 0x22, 0xf1, 0x42, 0x42, 0x12, 0x12, 0x12, 0x1f, 0xff, 0xff, 0x21, 0x21,
+	0x61, 0x24, 0x11, 0x44, 0x22, 0xff, 0xff, 0x10,	/* 129 */
+	0xff, 0x12, 0x92, 0x92, 0xf6, 0x46, 0x24, 0x23, 0x26, 0x22, 0x26, 0x22, 0xa2, 0x2a, 0x2b, 0x2b,
+	0x24, 0x25, 0x5f, 0xff, 0xff, 0x00,	/* 130 */
+	0xf3, 0x1a, 0x38, 0x21, 0x26, 0x23, 0x2f, 0x35, 0x62, 0x32, 0x51, 0x42, 0x84, 0x53, 0x22, 0x42,
+	0x42, 0x42, 0x42, 0x42, 0x42, 0x43, 0x23, 0x54, 0x13, 0xff, 0xff, 0xd0,	/* 131 */
+	0xfc, 0x22, 0x26, 0x22, 0x2f, 0xf1, 0x56, 0x23, 0x25, 0x14, 0x28, 0x45, 0x32, 0x24, 0x24, 0x24,
+	0x24, 0x24, 0x24, 0x24, 0x32, 0x35, 0x41, 0x3f, 0xff, 0xfd,	/* 132 */
+	0xfd, 0x2b, 0x2b, 0x2f, 0x55, 0x62, 0x32, 0x51, 0x42, 0x84, 0x53, 0x22, 0x42, 0x42, 0x42, 0x42,
+	0x42, 0x42, 0x43, 0x23, 0x54, 0x13, 0xff, 0xff, 0xd0,	/* 133 */
+	0xf2, 0x38, 0x21, 0x27, 0x21, 0x28, 0x3f, 0x55, 0x62, 0x32, 0x51, 0x42, 0x84, 0x53, 0x22, 0x42,
+	0x42, 0x42, 0x42, 0x42, 0x42, 0x43, 0x23, 0x54, 0x13, 0xff, 0xff, 0xd0,	/* 134 */
+	0xff, 0xff, 0xf0, 0x65, 0x23, 0x34, 0x15, 0x23, 0x2a, 0x2a, 0x2a, 0x2a, 0x35, 0x14, 0x24, 0x25,
+	0x68, 0x2b, 0x2b, 0x27, 0x4f, 0xd0,	/* 135 */
+	0xf3, 0x1a, 0x38, 0x21, 0x26, 0x23, 0x2f, 0x34, 0x62, 0x42, 0x32, 0x62, 0x22, 0x62, 0x2a, 0x22,
+	0xa2, 0xb2, 0xb2, 0x42, 0x55, 0xff, 0xff, 0xf0,	/* 136 */
+	0xfc, 0x22, 0x26, 0x22, 0x2f, 0xf1, 0x46, 0x24, 0x23, 0x26, 0x22, 0x26, 0x22, 0xa2, 0x2a, 0x2b,
+	0x2b, 0x24, 0x25, 0x5f, 0xff, 0xff, 0x00,	/* 137 */
+	0xfd, 0x2b, 0x2b, 0x2f, 0x54, 0x62, 0x42, 0x32, 0x62, 0x22, 0x62, 0x2a, 0x22, 0xa2, 0xb2, 0xb2,
+	0x42, 0x55, 0xff, 0xff, 0xf0,	/* 138 */
+	0xfc, 0x22, 0x2f, 0x32, 0x22, 0xf3, 0x48, 0x2f, 0xff, 0xff, 0xf4, 0x22, 0x26, 0x6f, 0xff, 0xf3,	/* 139 */
+	0xf2, 0x1a, 0x38, 0x21, 0x26, 0x23, 0x2f, 0x34, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2,
+	0x86, 0xff, 0xff, 0xf0,	/* 140 */
+	0xfc, 0x2b, 0x2b, 0x2f, 0x54, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0x86, 0xff, 0xff,
+	0xf0,	/* 141 */
+	0xf0, 0x22, 0x26, 0x22, 0x2f, 0x51, 0xb2, 0xa2, 0x91, 0x12, 0x81, 0x12, 0x72, 0x22, 0x61, 0x32,
+	0x58, 0x41, 0x52, 0x32, 0x62, 0x21, 0x72, 0x13, 0x54, 0xff, 0xff, 0xc0,	/* 142 */
+	0xf1, 0x47, 0x22, 0x27, 0x49, 0x1b, 0x2a, 0x29, 0x11, 0x28, 0x11, 0x27, 0x22, 0x26, 0x13, 0x25,
+	0x84, 0x15, 0x23, 0x26, 0x22, 0x17, 0x21, 0x35, 0x4f, 0xff, 0xfc,	/* 143 */
+	0xf3, 0x29, 0x11, 0x18, 0x36, 0x31, 0x62, 0x12, 0x6c, 0x1f, 0x61, 0x74, 0x84, 0xc1, 0xfa, 0x1e,
+	0x12, 0x63, 0xaf, 0xff, 0xf1,	/* 144 */
+	0xff, 0xff, 0xe4, 0x14, 0x22, 0x22, 0x32, 0x11, 0x32, 0x32, 0x52, 0x32, 0x2a, 0x12, 0x22, 0x52,
+	0x32, 0x52, 0x32, 0x53, 0x23, 0x22, 0x15, 0x14, 0xff, 0xff, 0xd0,	/* 145 */
+	0xff, 0x06, 0x51, 0x23, 0xf2, 0x25, 0x1f, 0x71, 0x42, 0x32, 0xa2, 0x41, 0x12, 0x41, 0x43, 0xf4,
+	0x28, 0x1c, 0x11, 0x12, 0x12, 0x31, 0x32, 0x7f, 0xff, 0xf0,	/* 146 */
+	0xf3, 0x1a, 0x38, 0x21, 0x26, 0x23, 0x2f, 0x35, 0x61, 0x33, 0x41, 0x53, 0x22, 0x62, 0x22, 0x62,
+	0x22, 0x62, 0x22, 0x62, 0x23, 0x51, 0x43, 0x31, 0x65, 0xff, 0xff, 0xf1,	/* 147 */
+	0xfc, 0x22, 0x2f, 0x32, 0x22, 0xf4, 0x56, 0x42, 0x14, 0x23, 0x12, 0x12, 0x16, 0x1f, 0xfc, 0x16,
+	0x12, 0x12, 0x13, 0x24, 0x12, 0x46, 0x5f, 0xff, 0xf4,	/* 148 */
+	0xfd, 0x2b, 0x2b, 0x2f, 0x55, 0x61, 0x33, 0x41, 0x53, 0x22, 0x62, 0x22, 0x62, 0x22, 0x62, 0x22,
+	0x62, 0x23, 0x51, 0x43, 0x31, 0x65, 0xff, 0xff, 0xf1,	/* 149 */
+	0xf3, 0x1a, 0x38, 0x21, 0x26, 0x23, 0x2f, 0x04, 0x24, 0x32, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+	0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x43, 0x23, 0x54, 0x22, 0xff, 0xff, 0xd0,	/* 150 */
+	0xfc, 0x2a, 0x11, 0x1a, 0x11, 0x1a, 0x26, 0x42, 0x42, 0x12, 0x12, 0x12, 0x1f, 0xff, 0xff, 0x21,
+	0x21, 0x61, 0x24, 0x11, 0x44, 0x22, 0xff, 0xff, 0x10,	/* 151 */
+	0xfc, 0x22, 0x26, 0x22, 0x2f, 0xc4, 0x44, 0x12, 0x71, 0x32, 0x51, 0x42, 0x51, 0x52, 0x31, 0x62,
+	0x31, 0x72, 0x11, 0x82, 0x11, 0x92, 0xa2, 0xa1, 0xa2, 0xa1, 0x84, 0x83, 0xf5,	/* 152 */
+	0xf0, 0x22, 0x2f, 0x32, 0x22, 0x75, 0x64, 0x21, 0x42, 0x31, 0xc1, 0x11, 0x21, 0xff, 0xf2, 0x18,
+	0x14, 0x1a, 0x11, 0x13, 0x25, 0x11, 0x47, 0x4f, 0xff, 0xf4,	/* 153 */
+	0xf0, 0x22, 0x2f, 0x05, 0x22, 0x13, 0xa1, 0xff, 0xff, 0xff, 0x91, 0x52, 0x21, 0x25, 0x51, 0x61,
+	0x56, 0xff, 0xff, 0x30,	/* 154 */
+	0xff, 0xf8, 0x2f, 0x52, 0x22, 0x51, 0x11, 0x21, 0x11, 0x51, 0x91, 0x62, 0xff, 0xb1, 0x51, 0x31,
+	0x61, 0x51, 0x11, 0x21, 0x11, 0x52, 0x22, 0xf5, 0x2f, 0xfb,	/* 155 */
+	0xfd, 0x56, 0x32, 0x25, 0x23, 0x25, 0x2a, 0x2a, 0x28, 0x66, 0x68, 0x2a, 0x2a, 0x2a, 0x29, 0x53,
+	0x12, 0xa2, 0x24, 0x3f, 0xff, 0xf2,	/* 156 */
+	0xfa, 0x26, 0x22, 0x26, 0x23, 0x24, 0x25, 0x22, 0x26, 0x22, 0x27, 0x49, 0x28, 0x68, 0x28, 0x68,
+	0x2a, 0x2a, 0x2a, 0x2f, 0xff, 0xff, 0x20,	/* 157 */
+	0xd8, 0x41, 0x24, 0x11, 0xa1, 0x11, 0xff, 0x31, 0x11, 0x63, 0x11, 0x74, 0x92, 0x91, 0x21, 0x81,
+	0x21, 0xfa, 0x26, 0x11, 0x21, 0x11, 0x12, 0x12, 0x12, 0x12, 0x43, 0x2f, 0xff, 0xf2,	/* 158 */
+	0xf5, 0x29, 0x47, 0x22, 0x25, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x27, 0x92, 0x97, 0x2a, 0x2a, 0x2a,
+	0x2a, 0x2a, 0x25, 0x22, 0x27, 0x49, 0x2f, 0x50,	/* 159 */
+	0xff, 0x12, 0x92, 0x92, 0xf6, 0x56, 0x23, 0x25, 0x14, 0x28, 0x45, 0x32, 0x24, 0x24, 0x24, 0x24,
+	0x24, 0x24, 0x24, 0x32, 0x35, 0x41, 0x3f, 0xff, 0xfd,	/* 160 */
+	0xff, 0x12, 0x92, 0x92, 0xf5, 0x4a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x28, 0x6f, 0xff,
+	0xff, 0x00,	/* 161 */
+	0xff, 0x12, 0x92, 0x92, 0xf6, 0x56, 0x13, 0x34, 0x15, 0x32, 0x26, 0x22, 0x26, 0x22, 0x26, 0x22,
+	0x26, 0x22, 0x35, 0x14, 0x33, 0x16, 0x5f, 0xff, 0xff, 0x10,	/* 162 */
+	0xff, 0x12, 0x91, 0x11, 0x81, 0x11, 0x92, 0x64, 0x24, 0x21, 0x21, 0x21, 0x21, 0xff, 0xff, 0xf2,
+	0x12, 0x16, 0x12, 0x41, 0x14, 0x42, 0x2f, 0xff, 0xf1,	/* 163 */
+	0xf0, 0x33, 0x14, 0x13, 0x36, 0x33, 0x14, 0x13, 0x3f, 0x21, 0x24, 0x41, 0x14, 0x21, 0x31, 0x21,
+	0x21, 0xff, 0xff, 0xf2, 0x12, 0x12, 0x12, 0x12, 0x42, 0x4f, 0xff, 0xf1,	/* 164 */
+	0xf0, 0x33, 0x14, 0x13, 0x36, 0x33, 0x12, 0x33, 0x71, 0x16, 0x11, 0x13, 0x1c, 0x19, 0x12, 0x19,
+	0x12, 0x19, 0x12, 0x19, 0x12, 0x19, 0x12, 0x19, 0x1c, 0x13, 0x11, 0x16, 0x11, 0x47, 0x2f, 0xff,
+	0xf0,	/* 165 */
+	0xfc, 0x56, 0x23, 0x2a, 0x28, 0x46, 0x22, 0x25, 0x23, 0x25, 0x23, 0x25, 0x22, 0x36, 0x31, 0x3f,
+	0x18, 0xff, 0xff, 0xff, 0xf5,	/* 166 */
+	0xfe, 0x37, 0x41, 0x17, 0x12, 0x11, 0x14, 0x1f, 0xfc, 0x14, 0x11, 0x12, 0x17, 0x11, 0x47, 0x37,
+	0x84, 0x8f, 0xff, 0xff, 0xf8,	/* 167 */
+	0xf3, 0x2a, 0x2f, 0xf4, 0x2a, 0x29, 0x29, 0x29, 0x29, 0x2a, 0x2a, 0x25, 0x14, 0x32, 0x35, 0x67,
+	0x4f, 0xff, 0xff, 0x10,	/* 168 */
+	0xff, 0xf5, 0x8f, 0x36, 0xfd, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf2,	/* 169 */
+	0xff, 0xf5, 0x8f, 0x16, 0xff, 0x62, 0xff, 0xff, 0xff, 0xff, 0xfb,	/* 170 */
+	0xfc, 0x1a, 0x1b, 0x1f, 0x31, 0xa2, 0x92, 0x51, 0x11, 0x12, 0x68, 0x67, 0x42, 0x11, 0x72, 0x43,
+	0x22, 0x43, 0x31, 0x42, 0xb4, 0x75, 0xff, 0xff, 0x10,	/* 171 */
+	0xfc, 0x1a, 0x1b, 0x1f, 0x31, 0xa2, 0x92, 0x51, 0x11, 0x12, 0x11, 0x45, 0x11, 0x72, 0x12, 0x62,
+	0x12, 0x62, 0x12, 0x62, 0x33, 0x11, 0x21, 0x34, 0x11, 0xf7, 0x1f, 0xff, 0xf2,	/* 172 */
+	0xf2, 0x2f, 0x72, 0xf7, 0x2f, 0xff, 0xff, 0xff, 0xfa, 0x2f, 0xff, 0xf5,	/* 173 */
+	0xff, 0xff, 0xfe, 0x22, 0x25, 0x22, 0x25, 0x22, 0x25, 0x22, 0x25, 0x22, 0x27, 0x22, 0x27, 0x22,
+	0x27, 0x22, 0x27, 0x22, 0x2f, 0xff, 0xfd,	/* 174 */
+	0xff, 0xff, 0xfa, 0x22, 0x27, 0x22, 0x27, 0x22, 0x27, 0x22, 0x27, 0x22, 0x25, 0x22, 0x25, 0x22,
+	0x25, 0x22, 0x25, 0x22, 0x2f, 0xff, 0xff, 0x20,	/* 175 */
+	0x0c, 0x30, 0x08, 0x20, 0x61, 0x80, 0x20, 0x80, 0x0c, 0x30, 0x08, 0x20, 0x61, 0x80, 0x20, 0x80,
+	0x0c, 0x30, 0x08, 0x20, 0x61, 0x80, 0x20, 0x80, 0x0c, 0x30, 0x08, 0x20, 0x61, 0x80, 0x20, 0x80,
+	0x0c, 0x30, 0x08, 0x20, 0x61, 0x80, 0x20, 0x80, 0x0c, 0x30, 0x08, 0x20,	/* 176 */
+	0x77, 0x70, 0x22, 0x20, 0x88, 0x80, 0xdd, 0xd0, 0x88, 0x80, 0x22, 0x20, 0x77, 0x70, 0x22, 0x20,
+	0x88, 0x80, 0xdd, 0xd0, 0x88, 0x80, 0x22, 0x20, 0x77, 0x70, 0x22, 0x20, 0x88, 0x80, 0xdd, 0xd0,
+	0x88, 0x80, 0x22, 0x20, 0x77, 0x70, 0x22, 0x20, 0x88, 0x80, 0xdd, 0xd0,	/* 177 */
+	0xf3, 0xc0, 0xf7, 0xd0, 0x9e, 0x70, 0xdf, 0x70, 0xf3, 0xc0, 0xf7, 0xd0, 0x9e, 0x70, 0xdf, 0x70,
+	0xf3, 0xc0, 0xf7, 0xd0, 0x9e, 0x70, 0xdf, 0x70, 0xf3, 0xc0, 0xf7, 0xd0, 0x9e, 0x70, 0xdf, 0x70,
+	0xf3, 0xc0, 0xf7, 0xd0, 0x9e, 0x70, 0xdf, 0x70, 0xf3, 0xc0, 0xf7, 0xd0,	/* 178 */
+	0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,	/* 179 */
+	0x52, 0xff, 0xff, 0xff, 0xf8, 0x5f, 0x45, 0xff, 0xff, 0xff, 0xfa,	/* 180 */
+	0x52, 0xff, 0xff, 0xf2, 0x5f, 0x45, 0x75, 0xf4, 0x5f, 0xff, 0xff, 0xff, 0xa0,	/* 181 */
+	0x42, 0x12, 0xff, 0xff, 0xff, 0xf6, 0x4f, 0x54, 0xff, 0xff, 0xff, 0xfb,	/* 182 */
+	0xff, 0xff, 0xff, 0xff, 0x09, 0xf0, 0x42, 0x1f, 0xff, 0xff, 0xff, 0x80,	/* 183 */
+	0xff, 0xff, 0xf9, 0x7f, 0x25, 0x75, 0xf4, 0x5f, 0xff, 0xff, 0xff, 0xa0,	/* 184 */
+	0x42, 0x12, 0xff, 0xff, 0xf0, 0x4f, 0x56, 0x66, 0xf3, 0x4f, 0xff, 0xff, 0xff, 0xb0,	/* 185 */
+	0x42, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,	/* 186 */
+	0xff, 0xff, 0xf9, 0x9f, 0x07, 0x56, 0xf3, 0x4f, 0xff, 0xff, 0xff, 0xb0,	/* 187 */
+	0x42, 0x12, 0xff, 0xff, 0xf0, 0x4f, 0x56, 0x67, 0xf2, 0x9f, 0xff, 0xff, 0xff, 0x60,	/* 188 */
+	0x42, 0x12, 0xff, 0xff, 0xff, 0xf6, 0x42, 0x1f, 0x29, 0xff, 0xff, 0xff, 0xf6,	/* 189 */
+	0x52, 0xff, 0xff, 0xf2, 0x5f, 0x45, 0x75, 0xf4, 0x7f, 0xff, 0xff, 0xff, 0x80,	/* 190 */
+	0xff, 0xff, 0xff, 0xff, 0x07, 0xf2, 0x5f, 0xff, 0xff, 0xff, 0xa0,	/* 191 */
+	0x52, 0xff, 0xff, 0xff, 0xff, 0x05, 0xf2, 0x7f, 0xff, 0xff, 0xff, 0x30,	/* 192 */
+	0x52, 0xff, 0xff, 0xff, 0xf8, 0x52, 0x5c, 0xcf, 0xff, 0xff, 0xff, 0x30,	/* 193 */
+	0xff, 0xff, 0xff, 0xff, 0x0c, 0xc5, 0x25, 0xff, 0xff, 0xff, 0xf3,	/* 194 */
+	0x52, 0xff, 0xff, 0xff, 0xff, 0x05, 0xf4, 0x5f, 0xff, 0xff, 0xff, 0x30,	/* 195 */
+	0xff, 0xff, 0xff, 0xff, 0x0f, 0x9f, 0xff, 0xff, 0xff, 0xf0,	/* 196 */
+	0x52, 0xff, 0xff, 0xff, 0xf8, 0x52, 0x5c, 0x52, 0x5f, 0xff, 0xff, 0xff, 0x30,	/* 197 */
+	0x52, 0xff, 0xff, 0xf9, 0x5f, 0x45, 0x75, 0xf4, 0x5f, 0xff, 0xff, 0xff, 0x30,	/* 198 */
+	0x42, 0x12, 0xff, 0xff, 0xff, 0xff, 0x03, 0xf6, 0x3f, 0xff, 0xff, 0xff, 0x30,	/* 199 */
+	0x42, 0x12, 0xff, 0xff, 0xf9, 0x3f, 0x45, 0x66, 0xf1, 0x8f, 0xff, 0xff, 0xff, 0x30,	/* 200 */
+	0xff, 0xff, 0xfd, 0x8f, 0x36, 0x75, 0xf6, 0x3f, 0xff, 0xff, 0xff, 0x30,	/* 201 */
+	0x42, 0x12, 0xff, 0xff, 0xf0, 0x45, 0x3c, 0x61, 0xf2, 0xcc, 0xff, 0xff, 0xff, 0xf3,	/* 202 */
+	0xff, 0xff, 0xf9, 0xcc, 0xf3, 0x15, 0xc4, 0x53, 0xff, 0xff, 0xff, 0xf3,	/* 203 */
+	0x42, 0x12, 0xff, 0xff, 0xf9, 0x3f, 0x45, 0x75, 0xf6, 0x3f, 0xff, 0xff, 0xff, 0x30,	/* 204 */
+	0xff, 0xff, 0xf9, 0xf9, 0xcf, 0x9f, 0xff, 0xff, 0xff, 0xf0,	/* 205 */
+	0x42, 0x12, 0xff, 0xff, 0xf0, 0x45, 0x3c, 0x61, 0xb1, 0x5c, 0x45, 0x3f, 0xff, 0xff, 0xff, 0x30,	/* 206 */
+	0x52, 0xff, 0xff, 0xf2, 0x52, 0x5c, 0xf9, 0xcc, 0xff, 0xff, 0xff, 0xf3,	/* 207 */
+	0x42, 0x12, 0xff, 0xff, 0xff, 0xf6, 0x42, 0x12, 0x3c, 0xcf, 0xff, 0xff, 0xff, 0x30,	/* 208 */
+	0xff, 0xff, 0xf9, 0xcc, 0xf9, 0xc5, 0x25, 0xff, 0xff, 0xff, 0xf3,	/* 209 */
+	0xff, 0xff, 0xff, 0xff, 0x0c, 0xc4, 0x21, 0x23, 0xff, 0xff, 0xff, 0xf3,	/* 210 */
+	0x42, 0x12, 0xff, 0xff, 0xff, 0xfc, 0x12, 0x3f, 0x18, 0xff, 0xff, 0xff, 0xf3,	/* 211 */
+	0x52, 0xff, 0xff, 0xf9, 0x5f, 0x45, 0x75, 0xf2, 0x7f, 0xff, 0xff, 0xff, 0x30,	/* 212 */
+	0xff, 0xff, 0xfe, 0x7f, 0x45, 0x75, 0xf4, 0x5f, 0xff, 0xff, 0xff, 0x30,	/* 213 */
+	0xff, 0xff, 0xff, 0xff, 0x48, 0xf3, 0x12, 0x3f, 0xff, 0xff, 0xff, 0x30,	/* 214 */
+	0x42, 0x12, 0xff, 0xff, 0xff, 0xf6, 0x42, 0x12, 0x3c, 0x42, 0x12, 0x3f, 0xff, 0xff, 0xff, 0x30,	/* 215 */
+	0x52, 0xff, 0xff, 0xf2, 0x52, 0x5c, 0x52, 0xa2, 0x5c, 0x52, 0x5f, 0xff, 0xff, 0xff, 0x30,	/* 216 */
+	0x52, 0xff, 0xff, 0xff, 0xf8, 0x5f, 0x47, 0xff, 0xff, 0xff, 0xf8,	/* 217 */
+	0xff, 0xff, 0xff, 0xff, 0x57, 0xf4, 0x5f, 0xff, 0xff, 0xff, 0x30,	/* 218 */
+	0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,	/* 219 */
+	0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x90,	/* 220 */
+	0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,	/* 221 */
+	0x66, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,	/* 222 */
+	0x0f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf9,	/* 223 */
+	0xff, 0xff, 0xf1, 0x41, 0x24, 0x12, 0x53, 0x14, 0x33, 0x25, 0x23, 0x25, 0x23, 0x25, 0x23, 0x25,
+	0x23, 0x34, 0x15, 0x32, 0x35, 0x51, 0x2f, 0xff, 0xfd,	/* 224 */
+	0xfd, 0x47, 0x11, 0x21, 0x15, 0x11, 0x12, 0x11, 0x1f, 0xf3, 0x11, 0x17, 0x2a, 0x2c, 0x11, 0x1f,
+	0xff, 0x01, 0x11, 0x31, 0x32, 0x11, 0x43, 0x13, 0xff, 0xff, 0x40,	/* 225 */
+	0xfb, 0x9f, 0x25, 0xf9, 0x2f, 0xff, 0xff, 0xff, 0x62, 0xff, 0xff, 0x80,	/* 226 */
+	0xff, 0xff, 0xda, 0xe2, 0x22, 0x22, 0xff, 0xff, 0xfd, 0x22, 0x2f, 0xff, 0xf3,	/* 227 */
+	0xda, 0x2a, 0x22, 0x62, 0x32, 0x52, 0x32, 0xb2, 0xa2, 0xb2, 0x92, 0xa2, 0x92, 0xa2, 0x52, 0x22,
+	0x62, 0x2a, 0x2a, 0xff, 0xff, 0xd0,	/* 228 */
+	0xff, 0xff, 0x56, 0x51, 0xa3, 0x32, 0x32, 0x21, 0x21, 0x31, 0x51, 0xff, 0xd1, 0x51, 0x31, 0x21,
+	0x22, 0x51, 0x23, 0x74, 0xff, 0xff, 0x50,	/* 229 */
+	0xff, 0xff, 0xe2, 0x42, 0xff, 0xff, 0xff, 0x01, 0x21, 0x84, 0x21, 0x62, 0x13, 0xe1, 0x11, 0x92,
+	0xff, 0x30,	/* 230 */
+	0xf0, 0x22, 0x25, 0x12, 0x22, 0x13, 0x11, 0x22, 0x21, 0x1e, 0x26, 0x2f, 0xff, 0xff, 0xff, 0xf6,
+	0x2f, 0xff, 0xf5,	/* 231 */
+	0xfa, 0xa2, 0xa6, 0x2a, 0x29, 0x47, 0x22, 0x25, 0x24, 0x24, 0x24, 0x25, 0x22, 0x27, 0x49, 0x2a,
+	0x26, 0xa2, 0xaf, 0xff, 0xfd,	/* 232 */
+	0xff, 0xf7, 0x47, 0x65, 0x24, 0x23, 0x26, 0x22, 0x26, 0x22, 0xa2, 0xa2, 0x26, 0x22, 0x26, 0x23,
+	0x24, 0x25, 0x67, 0x4f, 0xff, 0xff, 0x10,	/* 233 */
+	0xff, 0xf6, 0x56, 0x23, 0x25, 0x24, 0x24, 0x24, 0x23, 0x26, 0x22, 0x26, 0x23, 0x24, 0x24, 0x24,
+	0x25, 0x22, 0x26, 0x22, 0x23, 0x21, 0x22, 0x21, 0x21, 0x42, 0x4f, 0xff, 0xfd,	/* 234 */
+	0xf2, 0x47, 0x22, 0x25, 0x24, 0x24, 0x2b, 0x2b, 0x2b, 0x28, 0x56, 0x13, 0x34, 0x15, 0x32, 0x26,
+	0x22, 0x26, 0x22, 0x35, 0x14, 0x33, 0x16, 0x5f, 0xff, 0xff, 0x10,	/* 235 */
+	0xff, 0xff, 0xff, 0x83, 0x23, 0x32, 0x14, 0x12, 0x22, 0x22, 0x22, 0x12, 0x32, 0x34, 0x32, 0x32,
+	0x12, 0x22, 0x22, 0x22, 0x14, 0x12, 0x33, 0x23, 0xff, 0xff, 0xe0,	/* 236 */
+	0xff, 0xfb, 0x2a, 0x29, 0x2a, 0x25, 0x31, 0x43, 0x21, 0x41, 0x22, 0x22, 0x22, 0x21, 0x23, 0x23,
+	0x43, 0x23, 0x21, 0x22, 0x22, 0x22, 0x21, 0x41, 0x23, 0x41, 0x35, 0x2a, 0x29, 0x2a, 0x2f, 0xf2,	/* 237 */
+	0xf4, 0x38, 0x29, 0x2a, 0x29, 0x2a, 0x29, 0x2a, 0x75, 0x2b, 0x2a, 0x2b, 0x2a, 0x2b, 0x2b, 0x3f,
+	0xff, 0xfe,	/* 238 */
+	0xff, 0xff, 0x44, 0x71, 0x41, 0x51, 0x22, 0x21, 0x61, 0x21, 0xff, 0xff, 0xff, 0xc2, 0x42, 0xff,
+	0xf5,	/* 239 */
+	0xff, 0xff, 0x1a, 0xea, 0xfb, 0xae, 0xaf, 0xba, 0xea, 0xff, 0xf4,	/* 240 */
+	0xff, 0xf8, 0x2f, 0xfc, 0x42, 0x4e, 0x42, 0x4f, 0xfc, 0x26, 0xae, 0xaf, 0xff, 0x40,	/* 241 */
+	0xff, 0xf4, 0x2b, 0x3b, 0x3b, 0x3b, 0x39, 0x37, 0x37, 0x37, 0x38, 0x2f, 0x7a, 0x2a, 0xff, 0xff,
+	0x10,	/* 242 */
+	0xff, 0xf0, 0x28, 0x37, 0x37, 0x37, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x2e, 0xa2, 0xaf, 0xff, 0xfd,	/* 243 */
+	0xf3, 0x38, 0x13, 0x16, 0x11, 0x31, 0x1f, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,	/* 244 */
+	0xf0, 0x38, 0x13, 0x16, 0x11, 0x31, 0x1f, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,	/* 245 */
+	0xff, 0xff, 0xf2, 0x2f, 0x72, 0xf3, 0xae, 0xaf, 0x32, 0xf7, 0x2f, 0xff, 0xf5,	/* 246 */
+	0xff, 0xff, 0xfb, 0x38, 0x21, 0x2b, 0x23, 0x26, 0x21, 0x23, 0x32, 0x33, 0x21, 0x2b, 0x23, 0x26,
+	0x21, 0x28, 0x3f, 0xff, 0xfe,	/* 247 */
+	0xf1, 0x47, 0x22, 0x26, 0x22, 0x26, 0x22, 0x27, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,	/* 248 */
+	0xff, 0xff, 0xff, 0xff, 0xf0, 0x38, 0x57, 0x57, 0x58, 0x3f, 0xff, 0xff, 0x30,	/* 249 */
+	0xff, 0xff, 0xff, 0xff, 0xfc, 0x29, 0x48, 0x49, 0x2f, 0xff, 0xff, 0x40,	/* 250 */
+	0xf2, 0x68, 0x4f, 0xff, 0xff, 0xff, 0xfd, 0x2a, 0x11, 0x1a, 0x11, 0x1a, 0x11, 0x1a, 0x1c, 0x1c,
+	0x1c, 0x15,	/* 251 */
+	0xfc, 0x12, 0x35, 0x41, 0x35, 0x23, 0x25, 0x23, 0x25, 0x23, 0x25, 0x23, 0x24, 0x41, 0x4f, 0xff,
+	0xff, 0xff, 0xff, 0xf7,	/* 252 */
+	0xf1, 0x47, 0x65, 0x23, 0x25, 0x14, 0x29, 0x29, 0x29, 0x29, 0x24, 0x14, 0x84, 0x8f, 0xff, 0xff,
+	0xff, 0xfe,	/* 253 */
+	0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x8f, 0xff, 0x50,	/* 254 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,	/* 255 */
+#endif // CONFIG_LCD_FONT_EXTENDED_ASCII
+};
+
+/// 低15位为偏移，最高位为1表示按行异或后编码
+LCD_FONT_OFFSETS_DEFINE(sun_ascii_12x22_rle)
+{
+	0x0000,	/* 0 */
+	0x8009,	/* 1 */
+	0x002a,	/* 2 */
+	0x0042,	/* 3 */
+	0x0053,	/* 4 */
+	0x0064,	/* 5 */
+	0x0079,	/* 6 */
+	0x008c,	/* 7 */
+	0x009d,	/* 8 */
+	0x00ae,	/* 9 */
+	0x00c5,	/* 10 */
+	0x00dc,	/* 11 */
+	0x00f6,	/* 12 */
+	0x810c,	/* 13 */
+	0x811c,	/* 14 */
+	0x0131,	/* 15 */
+	0x014b,	/* 16 */
+	0x0160,	/* 17 */
+	0x0175,	/* 18 */
+	0x8186,	/* 19 */
+	0x8196,	/* 20 */
+	0x01a8,	/* 21 */
+	0x81c0,	/* 22 */
+	0x01ca,	/* 23 */
+	0x01dc,	/* 24 */
+	0x01ee,	/* 25 */
+	0x0200,	/* 26 */
+	0x020f,	/* 27 */
+	0x821e,	/* 28 */
+	0x0229,	/* 29 */
+	0x023e,	/* 30 */
+	0x024d,	/* 31 */
+	0x025c,	/* 32 */
+	0x8265,	/* 33 */
+	0x8271,	/* 34 */
+	0x027e,	/* 35 */
+	0x029c,	/* 36 */
+	0x82b8,	/* 37 */
+	0x02d8,	/* 38 */
+	0x02f4,	/* 39 */
+	0x0302,	/* 40 */
+	0x0315,	/* 41 */
+	0x0328,	/* 42 */
+	0x8342,	/* 43 */
+	0x034f,	/* 44 */
+	0x835d,	/* 45 */
+	0x0367,	/* 46 */
+	0x0373,	/* 47 */
+	0x8386,	/* 48 */
+	0x839a,	/* 49 */
+	0x03ab,	/* 50 */
+	0x03c0,	/* 51 */
+	0x83d7,	/* 52 */
+	0x03e9,	/* 53 */
+	0x0400,	/* 54 */
+	0x041a,	/* 55 */
+	0x042e,	/* 56 */
+	0x044d,	/* 57 */
+	0x0468,	/* 58 */
+	0x0477,	/* 59 */
+	0x0488,	/* 60 */
+	0x8497,	/* 61 */
+	0x04a1,	/* 62 */
+	0x04b0,	/* 63 */
+	0x84c4,	/* 64 */
+	0x84dd,	/* 65 */
+	0x84f5,	/* 66 */
+	0x850c,	/* 67 */
+	0x8521,	/* 68 */
+	0x8533,	/* 69 */
+	0x8544,	/* 70 */
+	0x8555,	/* 71 */
+	0x856b,	/* 72 */
+	0x857e,	/* 73 */
+	0x858c,	/* 74 */
+	0x059a,	/* 75 */
+	0x85b6,	/* 76 */
+	0x85c4,	/* 77 */
+	0x85dd,	/* 78 */
+	0x85f9,	/* 79 */
+	0x860f,	/* 80 */
+	0x8623,	/* 81 */
+	0x0640,	/* 82 */
+	0x065c,	/* 83 */
+	0x8674,	/* 84 */
+	0x8683,	/* 85 */
+	0x8696,	/* 86 */
+	0x86ad,	/* 87 */
+	0x06c4,	/* 88 */
+	0x06e1,	/* 89 */
+	0x06f9,	/* 90 */
+	0x870c,	/* 91 */
+	0x0718,	/* 92 */
+	0x872b,	/* 93 */
+	0x0737,	/* 94 */
+	0x0746,	/* 95 */
+	0x0750,	/* 96 */
+	0x075e,	/* 97 */
+	0x8775,	/* 98 */
+	0x078d,	/* 99 */
+	0x87a1,	/* 100 */
+	0x07ba,	/* 101 */
+	0x87ce,	/* 102 */
+	0x07e1,	/* 103 */
+	0x87fd,	/* 104 */
+	0x8812,	/* 105 */
+	0x8820,	/* 106 */
+	0x0833,	/* 107 */
+	0x884c,	/* 108 */
+	0x8859,	/* 109 */
+	0x886f,	/* 110 */
+	0x8884,	/* 111 */
+	0x889a,	/* 112 */
+	0x88b0,	/* 113 */
+	0x88c7,	/* 114 */
+	0x08d9,	/* 115 */
+	0x88ed,	/* 116 */
+	0x88ff,	/* 117 */
+	0x0913,	/* 118 */
+	0x892a,	/* 119 */
+	0x0940,	/* 120 */
+	0x0957,	/* 121 */
+	0x0971,	/* 122 */
+	0x0984,	/* 123 */
+	0x8997,	/* 124 */
+	0x09a2,	/* 125 */
+	0x09b5,	/* 126 */
+	0x09c5,	/* 127 */
+#if CONFIG_LCD_FONT_EXTENDED_ASCII
+	0x09cf,	/* 128 */
+	0x89e7,	/* 129 */
+	0x09ff,	/* 130 */
+	0x0a15,	/* 131 */
+	0x0a31,	/* 132 */
+	0x0a4b,	/* 133 */
+	0x0a64,	/* 134 */
+	0x0a80,	/* 135 */
+	0x0a96,	/* 136 */
+	0x0aae,	/* 137 */
+	0x0ac5,	/* 138 */
+	0x8ada,	/* 139 */
+	0x0aea,	/* 140 */
+	0x0afe,	/* 141 */
+	0x0b0f,	/* 142 */
+	0x0b2b,	/* 143 */
+	0x8b46,	/* 144 */
+	0x0b5b,	/* 145 */
+	0x8b76,	/* 146 */
+	0x0b90,	/* 147 */
+	0x8bac,	/* 148 */
+	0x0bc5,	/* 149 */
+	0x0bde,	/* 150 */
+	0x8bfc,	/* 151 */
+	0x0c15,	/* 152 */
+	0x8c32,	/* 153 */
+	0x8c4c,	/* 154 */
+	0x8c60,	/* 155 */
+	0x0c7a,	/* 156 */
+	0x0c90,	/* 157 */
+	0x8ca7,	/* 158 */
+	0x0cc5,	/* 159 */
+	0x0cdd,	/* 160 */
+	0x0cf6,	/* 161 */
+	0x0d08,	/* 162 */
+	0x8d22,	/* 163 */
+	0x8d3b,	/* 164 */
+	0x8d57,	/* 165 */
+	0x0d78,	/* 166 */
+	0x8d8d,	/* 167 */
+	0x0da2,	/* 168 */
+	0x8db6,	/* 169 */
+	0x8dc1,	/* 170 */
+	0x8dcc,	/* 171 */
+	0x8de5,	/* 172 */
+	0x8e02,	/* 173 */
+	0x0e0e,	/* 174 */
+	0x0e25,	/* 175 */
+	0x0e3d,	/* 176 */
+	0x0e69,	/* 177 */
+	0x0e95,	/* 178 */
+	0x8ec1,	/* 179 */
+	0x8ecb,	/* 180 */
+	0x8ed6,	/* 181 */
+	0x8ee3,	/* 182 */
+	0x8eef,	/* 183 */
+	0x8efb,	/* 184 */
+	0x8f07,	/* 185 */
+	0x8f15,	/* 186 */
+	0x8f20,	/* 187 */
+	0x8f2c,	/* 188 */
+	0x8f3a,	/* 189 */
+	0x8f47,	/* 190 */
+	0x8f54,	/* 191 */
+	0x8f5f,	/* 192 */
+	0x8f6b,	/* 193 */
+	0x8f77,	/* 194 */
+	0x8f82,	/* 195 */
+	0x0f8e,	/* 196 */
+	0x8f98,	/* 197 */
+	0x8fa5,	/* 198 */
+	0x8fb2,	/* 199 */
+	0x8fbf,	/* 200 */
+	0x8fcd,	/* 201 */
+	0x8fd9,	/* 202 */
+	0x8fe7,	/* 203 */
+	0x8ff3,	/* 204 */
+	0x1001,	/* 205 */
+	0x900b,	/* 206 */
+	0x901b,	/* 207 */
+	0x9027,	/* 208 */
+	0x9035,	/* 209 */
+	0x9040,	/* 210 */
+	0x904c,	/* 211 */
+	0x9059,	/* 212 */
+	0x9066,	/* 213 */
+	0x9072,	/* 214 */
+	0x907e,	/* 215 */
+	0x908e,	/* 216 */
+	0x909d,	/* 217 */
+	0x90a8,	/* 218 */
+	0x10b3,	/* 219 */
+	0x10bd,	/* 220 */
+	0x90c7,	/* 221 */
+	0x90d1,	/* 222 */
+	0x10db,	/* 223 */
+	0x10e5,	/* 224 */
+	0x90fe,	/* 225 */
+	0x9119,	/* 226 */
+	0x9125,	/* 227 */
+	0x1132,	/* 228 */
+	0x9148,	/* 229 */
+	0x915f,	/* 230 */
+	0x9171,	/* 231 */
+	0x1184,	/* 232 */
+	0x1199,	/* 233 */
+	0x11b0,	/* 234 */
+	0x11cd,	/* 235 */
+	0x11e8,	/* 236 */
+	0x1203,	/* 237 */
+	0x1223,	/* 238 */
+	0x9235,	/* 239 */
+	0x9246,	/* 240 */
+	0x9251,	/* 241 */
+	0x125f,	/* 242 */
+	0x1270,	/* 243 */
+	0x9280,	/* 244 */
+	0x928f,	/* 245 */
+	0x929e,	/* 246 */
+	0x12ab,	/* 247 */
+	0x12c0,	/* 248 */
+	0x12d0,	/* 249 */
+	0x12dd,	/* 250 */
+	0x92e9,	/* 251 */
+	0x12fb,	/* 252 */
+	0x130f,	/* 253 */
+	0x9321,	/* 254 */
+	0x132c,	/* 255 */
+#endif // CONFIG_LCD_FONT_EXTENDED_ASCII
+};
+
+
+LCD_RLE_FONT_DEFINE(sun_ascii_12x22_rle, 12, 22, 0);
@@ -0,0 +1,349 @@
+
+#include "lcd_font_type.h"
+
+/**
+ * @brief 字体名称 ter_ascii_16x32_prop
+ * 由 lcd_font_packer.py --trim 从 ter_ascii_16x32 生成，请勿手工修改
+ * 
+ */
+LCD_FONT_DATA_DEFINE(ter_ascii_16x32_prop)
+{
+	0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x00,
+	0xe0, 0xe0, 0xe0, 0xe0,	/* '!' */
+	0xe3, 0x80, 0xe3, 0x80, 0xe3, 0x80, 0xe3, 0x80, 0xe3, 0x80, 0xe3, 0x80,	/* '"' */
+	0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0xff, 0xf8, 0xff, 0xf8, 0x38, 0xe0,
+	0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0xff, 0xf8, 0xff, 0xf8, 0x38, 0xe0,
+	0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0,	/* '#' */
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x3f, 0xe0, 0x7f, 0xf0, 0xf7, 0x78, 0xe7, 0x38, 0xe7, 0x00,
+	0xe7, 0x00, 0xe7, 0x00, 0xf7, 0x00, 0x7f, 0xe0, 0x3f, 0xf0, 0x07, 0x78, 0x07, 0x38, 0x07, 0x38,
+	0x07, 0x38, 0xe7, 0x38, 0xf7, 0x78, 0x7f, 0xf0, 0x3f, 0xe0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,	/* '$' */
+	0x7c, 0x70, 0xfe, 0x70, 0xee, 0xe0, 0xee, 0xe0, 0xff, 0xc0, 0x7d, 0xc0, 0x03, 0x80, 0x03, 0x80,
+	0x07, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x3b, 0xe0, 0x3f, 0xf0,
+	0x77, 0x70, 0x77, 0x70, 0xe7, 0xf0, 0xe3, 0xe0,	/* '%' */
+	0x1f, 0x80, 0x3f, 0xc0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x39, 0xc0,
+	0x1f, 0x80, 0x1f, 0x00, 0x3f, 0x9c, 0x71, 0xdc, 0xe0, 0xf8, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70,
+	0xe0, 0x70, 0xf0, 0xf8, 0x7f, 0xdc, 0x3f, 0x9c,	/* '&' */
+	0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,	/* 0x27 */
+	0x0e, 0x1c, 0x38, 0x70, 0x70, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x70,
+	0x70, 0x38, 0x1c, 0x0e,	/* '(' */
+	0xe0, 0x70, 0x38, 0x1c, 0x1c, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x1c,
+	0x1c, 0x38, 0x70, 0xe0,	/* ')' */
+	0x70, 0x70, 0x38, 0xe0, 0x1d, 0xc0, 0x0f, 0x80, 0x07, 0x00, 0xff, 0xf8, 0xff, 0xf8, 0x07, 0x00,
+	0x0f, 0x80, 0x1d, 0xc0, 0x38, 0xe0, 0x70, 0x70,	/* 0x2A */
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xff, 0xf8, 0xff, 0xf8, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,	/* '+' */
+	0x38, 0x38, 0x38, 0x38, 0x70, 0xe0,	/* ',' */
+	0xff, 0xf8, 0xff, 0xf8,	/* '-' */
+	0xe0, 0xe0, 0xe0, 0xe0,	/* '.' */
+	0x00, 0x70, 0x00, 0x70, 0x00, 0xe0, 0x00, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x03, 0x80, 0x03, 0x80,
+	0x07, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x38, 0x00,
+	0x70, 0x00, 0x70, 0x00, 0xe0, 0x00, 0xe0, 0x00,	/* 0x2F */
+	0x3f, 0xe0, 0x7f, 0xf0, 0xf0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x78, 0xe0, 0xf8, 0xe1, 0xf8,
+	0xe3, 0xb8, 0xe7, 0x38, 0xee, 0x38, 0xfc, 0x38, 0xf8, 0x38, 0xf0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xf0, 0x78, 0x7f, 0xf0, 0x3f, 0xe0,	/* '0' */
+	0x1c, 0x00, 0x3c, 0x00, 0x7c, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+	0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+	0x1c, 0x00, 0x1c, 0x00, 0xff, 0x80, 0xff, 0x80,	/* '1' */
+	0x3f, 0xe0, 0x7f, 0xf0, 0xf0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0x00, 0x38,
+	0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00,
+	0x70, 0x00, 0xe0, 0x00, 0xff, 0xf8, 0xff, 0xf8,	/* '2' */
+	0x3f, 0xe0, 0x7f, 0xf0, 0xf0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
+	0x00, 0x78, 0x1f, 0xf0, 0x1f, 0xf0, 0x00, 0x78, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xf0, 0x78, 0x7f, 0xf0, 0x3f, 0xe0,	/* '3' */
+	0x00, 0x38, 0x00, 0x78, 0x00, 0xf8, 0x01, 0xf8, 0x03, 0xb8, 0x07, 0x38, 0x0e, 0x38, 0x1c, 0x38,
+	0x38, 0x38, 0x70, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xff, 0xf8, 0xff, 0xf8, 0x00, 0x38,
+	0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,	/* '4' */
+	0xff, 0xf8, 0xff, 0xf8, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+	0xff, 0xe0, 0xff, 0xf0, 0x00, 0x78, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
+	0xe0, 0x38, 0xf0, 0x38, 0x7f, 0xf0, 0x3f, 0xe0,	/* '5' */
+	0x3f, 0xf0, 0x7f, 0xf0, 0xf0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+	0xff, 0xe0, 0xff, 0xf0, 0xe0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xf0, 0x78, 0x7f, 0xf0, 0x3f, 0xe0,	/* '6' */
+	0xff, 0xf8, 0xff, 0xf8, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x70, 0x00, 0x70, 0x00, 0xe0,
+	0x00, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,	/* '7' */
+	0x3f, 0xe0, 0x7f, 0xf0, 0xf0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xf0, 0x78, 0x7f, 0xf0, 0x7f, 0xf0, 0xf0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xf0, 0x78, 0x7f, 0xf0, 0x3f, 0xe0,	/* '8' */
+	0x3f, 0xe0, 0x7f, 0xf0, 0xf0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xf0, 0x38, 0x7f, 0xf8, 0x3f, 0xf8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
+	0x00, 0x38, 0x00, 0x78, 0x7f, 0xf0, 0x7f, 0xe0,	/* '9' */
+	0xe0, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0xe0,	/* ':' */
+	0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x70, 0xe0,	/* ';' */
+	0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00,
+	0x70, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00,
+	0x03, 0x80, 0x01, 0xc0, 0x00, 0xe0, 0x00, 0x70,	/* '<' */
+	0xff, 0xf8, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0xff, 0xf8,	/* '=' */
+	0xe0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xc0,
+	0x00, 0xe0, 0x00, 0x70, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00,
+	0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x00,	/* '>' */
+	0x3f, 0xe0, 0x7f, 0xf0, 0xf0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0x00, 0x70,
+	0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,	/* '?' */
+	0x3f, 0xf0, 0x7f, 0xf8, 0xf0, 0x1c, 0xe0, 0x0c, 0xe3, 0xfc, 0xe7, 0xfc, 0xef, 0x1c, 0xee, 0x1c,
+	0xee, 0x1c, 0xee, 0x1c, 0xee, 0x1c, 0xee, 0x1c, 0xee, 0x1c, 0xef, 0x3c, 0xe7, 0xfc, 0xe3, 0xec,
+	0xe0, 0x00, 0xf0, 0x00, 0x7f, 0xfc, 0x3f, 0xfc,	/* '@' */
+	0x3f, 0xe0, 0x7f, 0xf0, 0xf0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x38, 0xff, 0xf8, 0xff, 0xf8, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,	/* 'A' */
+	0xff, 0xe0, 0xff, 0xf0, 0xe0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x70,
+	0xff, 0xe0, 0xff, 0xe0, 0xe0, 0x70, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x78, 0xff, 0xf0, 0xff, 0xe0,	/* 'B' */
+	0x3f, 0xe0, 0x7f, 0xf0, 0xf0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+	0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x38,
+	0xe0, 0x38, 0xf0, 0x78, 0x7f, 0xf0, 0x3f, 0xe0,	/* 'C' */
+	0xff, 0x80, 0xff, 0xe0, 0xe0, 0xf0, 0xe0, 0x70, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x70, 0xe0, 0xf0, 0xff, 0xe0, 0xff, 0x80,	/* 'D' */
+	0xff, 0xf8, 0xff, 0xf8, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+	0xe0, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+	0xe0, 0x00, 0xe0, 0x00, 0xff, 0xf8, 0xff, 0xf8,	/* 'E' */
+	0xff, 0xf8, 0xff, 0xf8, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+	0xe0, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+	0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,	/* 'F' */
+	0x3f, 0xe0, 0x7f, 0xf0, 0xf0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+	0xe0, 0x00, 0xe3, 0xf8, 0xe3, 0xf8, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xf0, 0x78, 0x7f, 0xf0, 0x3f, 0xe0,	/* 'G' */
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xff, 0xf8, 0xff, 0xf8, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,	/* 'H' */
+	0xfe, 0xfe, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0xfe, 0xfe,	/* 'I' */
+	0x01, 0xfc, 0x01, 0xfc, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70,
+	0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0xe0, 0x70, 0xe0, 0x70,
+	0xe0, 0x70, 0xf0, 0xf0, 0x7f, 0xe0, 0x3f, 0xc0,	/* 'J' */
+	0xe0, 0x18, 0xe0, 0x38, 0xe0, 0x70, 0xe0, 0xe0, 0xe1, 0xc0, 0xe3, 0x80, 0xe7, 0x00, 0xee, 0x00,
+	0xfc, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xfc, 0x00, 0xee, 0x00, 0xe7, 0x00, 0xe3, 0x80, 0xe1, 0xc0,
+	0xe0, 0xe0, 0xe0, 0x70, 0xe0, 0x38, 0xe0, 0x18,	/* 'K' */
+	0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+	0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+	0xe0, 0x00, 0xe0, 0x00, 0xff, 0xf8, 0xff, 0xf8,	/* 'L' */
+	0xe0, 0x1c, 0xe0, 0x1c, 0xf0, 0x3c, 0xf8, 0x7c, 0xfc, 0xfc, 0xfc, 0xfc, 0xef, 0xdc, 0xe7, 0x9c,
+	0xe7, 0x9c, 0xe3, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c,
+	0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c,	/* 'M' */
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xf0, 0x38, 0xf8, 0x38, 0xfc, 0x38,
+	0xee, 0x38, 0xe7, 0x38, 0xe3, 0xb8, 0xe1, 0xf8, 0xe0, 0xf8, 0xe0, 0x78, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,	/* 'N' */
+	0x3f, 0xe0, 0x7f, 0xf0, 0xf0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xf0, 0x78, 0x7f, 0xf0, 0x3f, 0xe0,	/* 'O' */
+	0xff, 0xe0, 0xff, 0xf0, 0xe0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x78, 0xff, 0xf0, 0xff, 0xe0, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+	0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,	/* 'P' */
+	0x3f, 0xe0, 0x7f, 0xf0, 0xf0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe7, 0x38, 0xf3, 0xf8, 0x7f, 0xf0, 0x3f, 0xe0, 0x00, 0x70, 0x00, 0x38,	/* 'Q' */
+	0xff, 0xe0, 0xff, 0xf0, 0xe0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x78, 0xff, 0xf0, 0xff, 0xe0, 0xfc, 0x00, 0xee, 0x00, 0xe7, 0x00, 0xe3, 0x80,
+	0xe1, 0xc0, 0xe0, 0xe0, 0xe0, 0x70, 0xe0, 0x38,	/* 'R' */
+	0x3f, 0xe0, 0x7f, 0xf0, 0xf0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+	0xf0, 0x00, 0x7f, 0xe0, 0x3f, 0xf0, 0x00, 0x78, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xf0, 0x78, 0x7f, 0xf0, 0x3f, 0xe0,	/* 'S' */
+	0xff, 0xf8, 0xff, 0xf8, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,	/* 'T' */
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xf0, 0x78, 0x7f, 0xf0, 0x3f, 0xe0,	/* 'U' */
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+	0x70, 0x70, 0x70, 0x70, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x1d, 0xc0, 0x1d, 0xc0,
+	0x1d, 0xc0, 0x0f, 0x80, 0x0f, 0x80, 0x0f, 0x80,	/* 'V' */
+	0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c,
+	0xe0, 0x1c, 0xe0, 0x1c, 0xe3, 0x1c, 0xe7, 0x9c, 0xe7, 0x9c, 0xef, 0xdc, 0xfc, 0xfc, 0xfc, 0xfc,
+	0xf8, 0x7c, 0xf0, 0x3c, 0xe0, 0x1c, 0xe0, 0x1c,	/* 'W' */
+	0xe0, 0x38, 0xe0, 0x38, 0x70, 0x70, 0x70, 0x70, 0x38, 0xe0, 0x38, 0xe0, 0x1d, 0xc0, 0x1d, 0xc0,
+	0x0f, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x1d, 0xc0, 0x1d, 0xc0, 0x38, 0xe0, 0x38, 0xe0,
+	0x70, 0x70, 0x70, 0x70, 0xe0, 0x38, 0xe0, 0x38,	/* 'X' */
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0x70, 0x70, 0x70, 0x70, 0x38, 0xe0, 0x38, 0xe0, 0x1d, 0xc0,
+	0x1d, 0xc0, 0x0f, 0x80, 0x0f, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,	/* 'Y' */
+	0xff, 0xf8, 0xff, 0xf8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0,
+	0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+	0xe0, 0x00, 0xe0, 0x00, 0xff, 0xf8, 0xff, 0xf8,	/* 'Z' */
+	0xff, 0xff, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
+	0xe0, 0xe0, 0xff, 0xff,	/* '[' */
+	0xe0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x38, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+	0x0e, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x07, 0x00, 0x03, 0x80, 0x03, 0x80, 0x01, 0xc0, 0x01, 0xc0,
+	0x00, 0xe0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x70,	/* 0x5C */
+	0xff, 0xff, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0xff, 0xff,	/* ']' */
+	0x07, 0x00, 0x0f, 0x80, 0x1d, 0xc0, 0x38, 0xe0, 0x70, 0x70, 0xe0, 0x38,	/* '^' */
+	0xff, 0xf8, 0xff, 0xf8,	/* '_' */
+	0xe0, 0x70, 0x38, 0x1c,	/* '`' */
+	0x7f, 0xe0, 0x7f, 0xf0, 0x00, 0x78, 0x00, 0x38, 0x00, 0x38, 0x3f, 0xf8, 0x7f, 0xf8, 0xf0, 0x38,
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xf0, 0x38, 0x7f, 0xf8, 0x3f, 0xf8,	/* 'a' */
+	0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xff, 0xe0, 0xff, 0xf0,
+	0xe0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x78, 0xff, 0xf0, 0xff, 0xe0,	/* 'b' */
+	0x3f, 0xe0, 0x7f, 0xf0, 0xf0, 0x78, 0xe0, 0x38, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+	0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x38, 0xf0, 0x78, 0x7f, 0xf0, 0x3f, 0xe0,	/* 'c' */
+	0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x3f, 0xf8, 0x7f, 0xf8,
+	0xf0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xf0, 0x38, 0x7f, 0xf8, 0x3f, 0xf8,	/* 'd' */
+	0x3f, 0xe0, 0x7f, 0xf0, 0xf0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xff, 0xf8, 0xff, 0xf8,
+	0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xf0, 0x38, 0x7f, 0xf8, 0x3f, 0xf0,	/* 'e' */
+	0x03, 0xf8, 0x07, 0xf8, 0x0f, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0xff, 0xe0, 0xff, 0xe0,
+	0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00,
+	0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00,	/* 'f' */
+	0x3f, 0xf8, 0x7f, 0xf8, 0xf0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xf0, 0x38, 0x7f, 0xf8, 0x3f, 0xf8, 0x00, 0x38, 0x00, 0x38,
+	0x00, 0x78, 0x7f, 0xf0, 0x7f, 0xe0,	/* 'g' */
+	0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xff, 0xe0, 0xff, 0xf0,
+	0xe0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,	/* 'h' */
+	0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0xf8, 0xf8, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0xfe, 0xfe,	/* 'i' */
+	0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x03, 0xe0,
+	0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+	0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xf1, 0xe0, 0x7f, 0xc0,
+	0x3f, 0x80,	/* 'j' */
+	0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x70, 0xe0, 0xe0,
+	0xe1, 0xc0, 0xe3, 0x80, 0xe7, 0x00, 0xee, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xee, 0x00, 0xe7, 0x00,
+	0xe3, 0x80, 0xe1, 0xc0, 0xe0, 0xe0, 0xe0, 0x70,	/* 'k' */
+	0xf8, 0xf8, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0xfe, 0xfe,	/* 'l' */
+	0xff, 0xe0, 0xff, 0xf0, 0xe7, 0x78, 0xe7, 0x38, 0xe7, 0x38, 0xe7, 0x38, 0xe7, 0x38, 0xe7, 0x38,
+	0xe7, 0x38, 0xe7, 0x38, 0xe7, 0x38, 0xe7, 0x38, 0xe7, 0x38, 0xe7, 0x38,	/* 'm' */
+	0xff, 0xe0, 0xff, 0xf0, 0xe0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,	/* 'n' */
+	0x3f, 0xe0, 0x7f, 0xf0, 0xf0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xf0, 0x78, 0x7f, 0xf0, 0x3f, 0xe0,	/* 'o' */
+	0xff, 0xe0, 0xff, 0xf0, 0xe0, 0x78, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x78, 0xff, 0xf0, 0xff, 0xe0, 0xe0, 0x00, 0xe0, 0x00,
+	0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,	/* 'p' */
+	0x3f, 0xf8, 0x7f, 0xf8, 0xf0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xf0, 0x38, 0x7f, 0xf8, 0x3f, 0xf8, 0x00, 0x38, 0x00, 0x38,
+	0x00, 0x38, 0x00, 0x38, 0x00, 0x38,	/* 'q' */
+	0xe7, 0xf8, 0xef, 0xf8, 0xfc, 0x00, 0xf8, 0x00, 0xf0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+	0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,	/* 'r' */
+	0x3f, 0xe0, 0x7f, 0xf0, 0xf0, 0x78, 0xe0, 0x00, 0xe0, 0x00, 0xf0, 0x00, 0x7f, 0xe0, 0x3f, 0xf0,
+	0x00, 0x78, 0x00, 0x38, 0x00, 0x38, 0xf0, 0x78, 0x7f, 0xf0, 0x3f, 0xe0,	/* 's' */
+	0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0xff, 0xe0, 0xff, 0xe0,
+	0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00,
+	0x0e, 0x00, 0x0f, 0x00, 0x07, 0xf8, 0x03, 0xf8,	/* 't' */
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xf0, 0x38, 0x7f, 0xf8, 0x3f, 0xf8,	/* 'u' */
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x38, 0xe0, 0x38, 0xe0,
+	0x38, 0xe0, 0x1d, 0xc0, 0x1d, 0xc0, 0x0f, 0x80, 0x0f, 0x80, 0x0f, 0x80,	/* 'v' */
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe7, 0x38, 0xe7, 0x38, 0xe7, 0x38, 0xe7, 0x38,
+	0xe7, 0x38, 0xe7, 0x38, 0xe7, 0x38, 0xf7, 0x78, 0x7f, 0xf0, 0x3f, 0xe0,	/* 'w' */
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0x70, 0x70, 0x38, 0xe0, 0x1d, 0xc0, 0x0f, 0x80, 0x0f, 0x80,
+	0x1d, 0xc0, 0x38, 0xe0, 0x70, 0x70, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,	/* 'x' */
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+	0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xf0, 0x38, 0x7f, 0xf8, 0x3f, 0xf8, 0x00, 0x38, 0x00, 0x38,
+	0x00, 0x78, 0x7f, 0xf0, 0x7f, 0xe0,	/* 'y' */
+	0xff, 0xf8, 0xff, 0xf8, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00,
+	0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x00, 0xff, 0xf8, 0xff, 0xf8,	/* 'z' */
+	0x07, 0xc0, 0x0f, 0xc0, 0x1e, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+	0x1c, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00,
+	0x1c, 0x00, 0x1e, 0x00, 0x0f, 0xc0, 0x07, 0xc0,	/* '{' */
+	0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
+	0xe0, 0xe0, 0xe0, 0xe0,	/* '|' */
+	0xf8, 0x00, 0xfc, 0x00, 0x1e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00,
+	0x0e, 0x00, 0x07, 0xc0, 0x07, 0xc0, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00,
+	0x0e, 0x00, 0x1e, 0x00, 0xfc, 0x00, 0xf8, 0x00,	/* '}' */
+	0x3c, 0x38, 0x7e, 0x38, 0xef, 0x38, 0xe7, 0xb8, 0xe3, 0xf0, 0xe1, 0xe0,	/* '~' */
+};
+
+/// offset, width, height, x_offset, y_offset, advance, reserved
+LCD_FONT_GLYPHS_DEFINE(ter_ascii_16x32_prop)
+{
+	{0, 0, 0, 0, 0, 8, 0},	/* 0x20 */
+	{0, 3, 20, 1, 6, 5, 0},	/* '!' */
+	{20, 9, 6, 1, 4, 11, 0},	/* '"' */
+	{32, 13, 20, 1, 6, 15, 0},	/* '#' */
+	{72, 13, 24, 1, 4, 15, 0},	/* '$' */
+	{120, 12, 20, 1, 6, 14, 0},	/* '%' */
+	{160, 14, 20, 1, 6, 16, 0},	/* '&' */
+	{200, 3, 6, 1, 4, 5, 0},	/* 0x27 */
+	{206, 7, 20, 1, 6, 9, 0},	/* '(' */
+	{226, 7, 20, 1, 6, 9, 0},	/* ')' */
+	{246, 13, 12, 1, 10, 15, 0},	/* 0x2A */
+	{270, 13, 12, 1, 10, 15, 0},	/* '+' */
+	{294, 5, 6, 1, 22, 7, 0},	/* ',' */
+	{300, 13, 2, 1, 15, 15, 0},	/* '-' */
+	{304, 3, 4, 1, 22, 5, 0},	/* '.' */
+	{308, 12, 20, 1, 6, 14, 0},	/* 0x2F */
+	{348, 13, 20, 1, 6, 15, 0},	/* '0' */
+	{388, 9, 20, 1, 6, 11, 0},	/* '1' */
+	{428, 13, 20, 1, 6, 15, 0},	/* '2' */
+	{468, 13, 20, 1, 6, 15, 0},	/* '3' */
+	{508, 13, 20, 1, 6, 15, 0},	/* '4' */
+	{548, 13, 20, 1, 6, 15, 0},	/* '5' */
+	{588, 13, 20, 1, 6, 15, 0},	/* '6' */
+	{628, 13, 20, 1, 6, 15, 0},	/* '7' */
+	{668, 13, 20, 1, 6, 15, 0},	/* '8' */
+	{708, 13, 20, 1, 6, 15, 0},	/* '9' */
+	{748, 3, 14, 1, 12, 5, 0},	/* ':' */
+	{762, 5, 16, 1, 12, 7, 0},	/* ';' */
+	{778, 12, 20, 1, 6, 14, 0},	/* '<' */
+	{818, 13, 8, 1, 12, 15, 0},	/* '=' */
+	{834, 12, 20, 1, 6, 14, 0},	/* '>' */
+	{874, 13, 20, 1, 6, 15, 0},	/* '?' */
+	{914, 14, 20, 1, 6, 16, 0},	/* '@' */
+	{954, 13, 20, 1, 6, 15, 0},	/* 'A' */
+	{994, 13, 20, 1, 6, 15, 0},	/* 'B' */
+	{1034, 13, 20, 1, 6, 15, 0},	/* 'C' */
+	{1074, 13, 20, 1, 6, 15, 0},	/* 'D' */
+	{1114, 13, 20, 1, 6, 15, 0},	/* 'E' */
+	{1154, 13, 20, 1, 6, 15, 0},	/* 'F' */
+	{1194, 13, 20, 1, 6, 15, 0},	/* 'G' */
+	{1234, 13, 20, 1, 6, 15, 0},	/* 'H' */
+	{1274, 7, 20, 1, 6, 9, 0},	/* 'I' */
+	{1294, 14, 20, 1, 6, 16, 0},	/* 'J' */
+	{1334, 13, 20, 1, 6, 15, 0},	/* 'K' */
+	{1374, 13, 20, 1, 6, 15, 0},	/* 'L' */
+	{1414, 14, 20, 1, 6, 16, 0},	/* 'M' */
+	{1454, 13, 20, 1, 6, 15, 0},	/* 'N' */
+	{1494, 13, 20, 1, 6, 15, 0},	/* 'O' */
+	{1534, 13, 20, 1, 6, 15, 0},	/* 'P' */
+	{1574, 13, 22, 1, 6, 15, 0},	/* 'Q' */
+	{1618, 13, 20, 1, 6, 15, 0},	/* 'R' */
+	{1658, 13, 20, 1, 6, 15, 0},	/* 'S' */
+	{1698, 13, 20, 1, 6, 15, 0},	/* 'T' */
+	{1738, 13, 20, 1, 6, 15, 0},	/* 'U' */
+	{1778, 13, 20, 1, 6, 15, 0},	/* 'V' */
+	{1818, 14, 20, 1, 6, 16, 0},	/* 'W' */
+	{1858, 13, 20, 1, 6, 15, 0},	/* 'X' */
+	{1898, 13, 20, 1, 6, 15, 0},	/* 'Y' */
+	{1938, 13, 20, 1, 6, 15, 0},	/* 'Z' */
+	{1978, 8, 20, 1, 6, 10, 0},	/* '[' */
+	{1998, 12, 20, 1, 6, 14, 0},	/* 0x5C */
+	{2038, 8, 20, 1, 6, 10, 0},	/* ']' */
+	{2058, 13, 6, 1, 4, 15, 0},	/* '^' */
+	{2070, 13, 2, 1, 27, 15, 0},	/* '_' */
+	{2074, 6, 4, 1, 2, 8, 0},	/* '`' */
+	{2078, 13, 14, 1, 12, 15, 0},	/* 'a' */
+	{2106, 13, 20, 1, 6, 15, 0},	/* 'b' */
+	{2146, 13, 14, 1, 12, 15, 0},	/* 'c' */
+	{2174, 13, 20, 1, 6, 15, 0},	/* 'd' */
+	{2214, 13, 14, 1, 12, 15, 0},	/* 'e' */
+	{2242, 13, 20, 1, 6, 15, 0},	/* 'f' */
+	{2282, 13, 19, 1, 12, 15, 0},	/* 'g' */
+	{2320, 13, 20, 1, 6, 15, 0},	/* 'h' */
+	{2360, 7, 20, 1, 6, 9, 0},	/* 'i' */
+	{2380, 11, 25, 1, 6, 13, 0},	/* 'j' */
+	{2430, 12, 20, 1, 6, 14, 0},	/* 'k' */
+	{2470, 7, 20, 1, 6, 9, 0},	/* 'l' */
+	{2490, 13, 14, 1, 12, 15, 0},	/* 'm' */
+	{2518, 13, 14, 1, 12, 15, 0},	/* 'n' */
+	{2546, 13, 14, 1, 12, 15, 0},	/* 'o' */
+	{2574, 13, 19, 1, 12, 15, 0},	/* 'p' */
+	{2612, 13, 19, 1, 12, 15, 0},	/* 'q' */
+	{2650, 13, 14, 1, 12, 15, 0},	/* 'r' */
+	{2678, 13, 14, 1, 12, 15, 0},	/* 's' */
+	{2706, 13, 20, 1, 6, 15, 0},	/* 't' */
+	{2746, 13, 14, 1, 12, 15, 0},	/* 'u' */
+	{2774, 13, 14, 1, 12, 15, 0},	/* 'v' */
+	{2802, 13, 14, 1, 12, 15, 0},	/* 'w' */
+	{2830, 13, 14, 1, 12, 15, 0},	/* 'x' */
+	{2858, 13, 19, 1, 12, 15, 0},	/* 'y' */
+	{2896, 13, 14, 1, 12, 15, 0},	/* 'z' */
+	{2924, 10, 20, 1, 6, 12, 0},	/* '{' */
+	{2964, 3, 20, 1, 6, 5, 0},	/* '|' */
+	{2984, 10, 20, 1, 6, 12, 0},	/* '}' */
+	{3024, 13, 6, 1, 4, 15, 0},	/* '~' */
+};
+
+
+LCD_PROP_FONT_DEFINE(ter_ascii_16x32_prop, 16, 32, 0x20);
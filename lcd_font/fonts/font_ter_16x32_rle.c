@@ -0,0 +1,843 @@
+
+#include "lcd_font_type.h"
+
+/**
+ * @brief 字体名称 ter_ascii_16x32_rle
+ * 由 lcd_font_packer.py --rle 从 ter_ascii_16x32 生成，请勿手工修改
+ * 
+ */
+LCD_FONT_DATA_DEFINE(ter_ascii_16x32_rle)
+{
+	0xff, 0xff, 0xff, 0x7d, 0xf7, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x7f, 0x7d,
+	0xff, 0xff, 0xf7,	/* 0 */
+	0xff, 0xff, 0xff, 0x8b, 0x41, 0xb1, 0x21, 0x37, 0x31, 0x41, 0x71, 0xff, 0xa3, 0x13, 0xfa, 0x31,
+	0x3f, 0xff, 0xc7, 0x91, 0x51, 0xa5, 0xff, 0xb1, 0x71, 0x41, 0x37, 0x31, 0x21, 0xb1, 0x4b, 0xff,
+	0xff, 0xf8,	/* 1 */
+	0xff, 0xff, 0xff, 0x8b, 0x41, 0xb1, 0x21, 0xd1, 0xff, 0xf7, 0x33, 0x3f, 0x83, 0x33, 0xff, 0xfa,
+	0x97, 0x17, 0x18, 0x15, 0x1a, 0x5f, 0xf8, 0x1d, 0x12, 0x1b, 0x14, 0xbf, 0xff, 0xff, 0x80,	/* 2 */
+	0xff, 0xff, 0xff, 0xff, 0x94, 0x54, 0x26, 0x36, 0x17, 0x17, 0x1f, 0x01, 0xf0, 0x1f, 0x01, 0xf0,
+	0x1f, 0x02, 0xd3, 0xd4, 0xb6, 0x98, 0x7a, 0x5c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf1,	/* 3 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xc5, 0xa7, 0x89, 0x6b, 0x4d, 0x2f, 0x01, 0xf0, 0x2d, 0x4b,
+	0x69, 0x87, 0xa5, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,	/* 4 */
+	0xff, 0xff, 0xff, 0xb5, 0xa7, 0x97, 0x97, 0x97, 0x97, 0xa5, 0xc3, 0x93, 0x13, 0x13, 0x4d, 0x2f,
+	0x01, 0xf0, 0x1f, 0x01, 0xf0, 0x2d, 0x43, 0x13, 0x13, 0x93, 0xd3, 0xb7, 0x97, 0xff, 0xff, 0xff,
+	0xb0,	/* 5 */
+	0xff, 0xff, 0xff, 0xc3, 0xd3, 0xc5, 0xa7, 0x89, 0x6b, 0x4d, 0x3d, 0x2f, 0x01, 0xf0, 0x1f, 0x01,
+	0xf0, 0x1f, 0x02, 0x41, 0x31, 0x44, 0x31, 0x31, 0x39, 0x3d, 0x3d, 0x3b, 0x79, 0x7f, 0xff, 0xff,
+	0xfb,	/* 6 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x4b, 0x69, 0x88, 0x88, 0x88, 0x89, 0x6b, 0x4f, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x30,	/* 7 */
+	0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xb6, 0x98, 0x88, 0x88, 0x88, 0x96, 0xb4, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,	/* 8 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x4b, 0x69, 0x32, 0x38, 0x24, 0x28, 0x24, 0x28, 0x32,
+	0x39, 0x6b, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,	/* 9 */
+	0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xb6, 0x93, 0x23, 0x82, 0x42, 0x82, 0x42, 0x83,
+	0x23, 0x96, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,	/* 10 */
+	0xff, 0xff, 0xff, 0xc9, 0x79, 0xc4, 0xb5, 0xa3, 0x12, 0x93, 0x22, 0x83, 0x32, 0x73, 0x42, 0x39,
+	0x6b, 0x44, 0x54, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x34,
+	0x54, 0x4b, 0x69, 0xff, 0xff, 0xff, 0xb0,	/* 11 */
+	0xff, 0xff, 0xff, 0x99, 0x61, 0x91, 0x41, 0x35, 0x31, 0x61, 0x51, 0xff, 0xff, 0xd1, 0x51, 0x61,
+	0x35, 0x31, 0x41, 0x91, 0x63, 0x33, 0xff, 0x75, 0x35, 0xf4, 0x53, 0x5f, 0xff, 0xb3, 0xff, 0xff,
+	0xfc,	/* 12 */
+	0xff, 0xff, 0xff, 0x8c, 0xf8, 0x6f, 0xff, 0xd6, 0xfb, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xf3,
+	0x1b, 0x4f, 0xff, 0xff, 0xf2,	/* 13 */
+	0xff, 0xff, 0xff, 0x7e, 0xf6, 0x8f, 0xff, 0xb8, 0xf9, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x72, 0x41,
+	0xd1, 0x41, 0x64, 0x23, 0xff, 0xff, 0xff, 0x30,	/* 14 */
+	0xff, 0xff, 0xff, 0xfd, 0x3d, 0x3d, 0x38, 0x32, 0x32, 0x33, 0x32, 0x32, 0x34, 0x31, 0x31, 0x36,
+	0x98, 0x76, 0x53, 0x53, 0x53, 0x56, 0x78, 0x96, 0x31, 0x31, 0x34, 0x32, 0x32, 0x33, 0x32, 0x32,
+	0x38, 0x3d, 0x3d, 0x3f, 0xff, 0xff, 0xff, 0xe0,	/* 15 */
+	0xff, 0xff, 0xff, 0xff, 0x82, 0xe4, 0xc6, 0xa8, 0x8a, 0x6c, 0x4e, 0x2f, 0xff, 0x12, 0xc4, 0xa6,
+	0x88, 0x6a, 0x4c, 0x2f, 0xff, 0xff, 0xff, 0xff, 0x70,	/* 16 */
+	0xff, 0xff, 0xff, 0xff, 0xf7, 0x2c, 0x4a, 0x68, 0x86, 0xa4, 0xc2, 0xff, 0xf1, 0x2e, 0x4c, 0x6a,
+	0x88, 0xa6, 0xc4, 0xe2, 0xff, 0xff, 0xff, 0xff, 0x80,	/* 17 */
+	0xff, 0xff, 0xff, 0xc3, 0xc5, 0xa7, 0x89, 0x63, 0x13, 0x13, 0x43, 0x23, 0x23, 0x32, 0x33, 0x32,
+	0x83, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0x82, 0x33, 0x32, 0x33, 0x23, 0x23, 0x43, 0x13, 0x13, 0x69,
+	0x87, 0xa5, 0xc3, 0xff, 0xff, 0xff, 0xd0,	/* 18 */
+	0xff, 0xff, 0xff, 0x93, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x33, 0x3f, 0xf9, 0x33,
+	0x3f, 0xff, 0xa3, 0x33, 0xff, 0xff, 0xf9,	/* 19 */
+	0xff, 0xff, 0xff, 0x9c, 0x31, 0xe1, 0x32, 0x32, 0x81, 0xff, 0xff, 0xf4, 0x1c, 0x13, 0x2b, 0x1f,
+	0x14, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x32, 0x3f, 0xff, 0xff, 0x60,	/* 20 */
+	0xff, 0xff, 0x96, 0x98, 0x74, 0x24, 0x63, 0x43, 0x63, 0xd4, 0xd6, 0xa7, 0x83, 0x24, 0x73, 0x34,
+	0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x64, 0x33, 0x74, 0x23, 0x87, 0xa6, 0xd4, 0xd3, 0x63, 0x43,
+	0x64, 0x24, 0x78, 0x96, 0xff, 0xff, 0xfa,	/* 21 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xef, 0xff, 0xff, 0xff, 0x9e, 0xff,
+	0xff, 0xf6,	/* 22 */
+	0xff, 0xff, 0xff, 0xc3, 0xc5, 0xa7, 0x89, 0x63, 0x13, 0x13, 0x43, 0x23, 0x23, 0x32, 0x33, 0x32,
+	0x83, 0xd3, 0xd3, 0xd3, 0x82, 0x33, 0x32, 0x33, 0x23, 0x23, 0x43, 0x13, 0x13, 0x69, 0x87, 0xa5,
+	0xc3, 0x8d, 0x3d, 0xff, 0xff, 0xff, 0x80,	/* 23 */
+	0xff, 0xff, 0xff, 0xc3, 0xc5, 0xa7, 0x89, 0x63, 0x13, 0x13, 0x43, 0x23, 0x23, 0x32, 0x33, 0x32,
+	0x83, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xff, 0xff, 0xff,
+	0xd0,	/* 24 */
+	0xff, 0xff, 0xff, 0xc3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
+	0x82, 0x33, 0x32, 0x33, 0x23, 0x23, 0x43, 0x13, 0x13, 0x69, 0x87, 0xa5, 0xc3, 0xff, 0xff, 0xff,
+	0xd0,	/* 25 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xe3, 0xe3, 0xe3, 0xe3, 0x3e, 0x2e, 0x2e, 0xc3, 0xc3, 0xc3,
+	0xc3, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,	/* 26 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0xd3, 0xc3, 0xc3, 0xc3, 0xce, 0x2e, 0x2e, 0x33, 0xe3, 0xe3,
+	0xe3, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,	/* 27 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xf4, 0xdf, 0xff, 0xff,
+	0xff, 0xff, 0xb0,	/* 28 */
+	0xff, 0xff, 0xff, 0xff, 0xfe, 0x22, 0x29, 0x32, 0x37, 0x34, 0x35, 0x36, 0x33, 0x38, 0x31, 0xff,
+	0xf3, 0x13, 0x83, 0x33, 0x63, 0x53, 0x43, 0x73, 0x23, 0x92, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xf0,	/* 29 */
+	0xff, 0xff, 0xff, 0xff, 0xf0, 0x2e, 0x2d, 0x4c, 0x4b, 0x6a, 0x69, 0x88, 0x87, 0xa6, 0xa5, 0xc4,
+	0xc3, 0xe2, 0xe1, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xf8,	/* 30 */
+	0xff, 0xff, 0xff, 0xff, 0x8f, 0xf2, 0x1e, 0x2e, 0x3c, 0x4c, 0x5a, 0x6a, 0x78, 0x88, 0x96, 0xa6,
+	0xb4, 0xc4, 0xd2, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xf0,	/* 31 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x20,	/* 32 */
+	0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x3f, 0xff, 0x03, 0xff, 0xff,
+	0x13, 0xff, 0xff, 0xfc,	/* 33 */
+	0xff, 0xff, 0x73, 0x33, 0xff, 0xff, 0xfc, 0x33, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xfa,	/* 34 */
+	0xff, 0xff, 0xff, 0x93, 0x33, 0xff, 0xff, 0x92, 0x33, 0x32, 0xf4, 0x23, 0x33, 0x2f, 0xff, 0xff,
+	0x82, 0x33, 0x32, 0xf4, 0x23, 0x33, 0x2f, 0xff, 0xf9, 0x33, 0x3f, 0xff, 0xff, 0x90,	/* 35 */
+	0xff, 0xff, 0xa3, 0xff, 0xc3, 0x33, 0x61, 0x91, 0x41, 0x31, 0x31, 0x31, 0x61, 0x51, 0xf1, 0x3f,
+	0xf8, 0x1c, 0x13, 0x13, 0x36, 0x19, 0x16, 0x33, 0x13, 0x1c, 0x1f, 0xf8, 0x3f, 0x11, 0x51, 0x61,
+	0x31, 0x31, 0x31, 0x41, 0x91, 0x63, 0x33, 0xff, 0xc3, 0xff, 0xfa,	/* 36 */
+	0xff, 0xff, 0xff, 0x95, 0x33, 0x47, 0x23, 0x43, 0x13, 0x13, 0x53, 0x13, 0x13, 0x5a, 0x75, 0x13,
+	0xc3, 0xd3, 0xc3, 0xd3, 0xc3, 0xd3, 0xc3, 0xd3, 0xc3, 0x15, 0x7a, 0x53, 0x13, 0x13, 0x53, 0x13,
+	0x13, 0x43, 0x27, 0x43, 0x35, 0xff, 0xff, 0xff, 0x90,	/* 37 */
+	0xff, 0xff, 0xff, 0xa6, 0x98, 0x73, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x73,
+	0x23, 0x96, 0xa5, 0xa7, 0x23, 0x33, 0x33, 0x13, 0x23, 0x55, 0x33, 0x63, 0x43, 0x63, 0x43, 0x63,
+	0x43, 0x63, 0x44, 0x45, 0x49, 0x13, 0x47, 0x23, 0xff, 0xff, 0xff, 0x70,	/* 38 */
+	0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xd0,	/* 39 */
+	0xff, 0xff, 0xff, 0xe3, 0xc3, 0xc3, 0xc3, 0xd3, 0xc3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
+	0xd3, 0xd3, 0xe3, 0xd3, 0xe3, 0xe3, 0xe3, 0xff, 0xff, 0xff, 0xb0,	/* 40 */
+	0xff, 0xff, 0xff, 0xa3, 0xe3, 0xe3, 0xe3, 0xd3, 0xe3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
+	0xd3, 0xd3, 0xc3, 0xd3, 0xc3, 0xc3, 0xc3, 0xff, 0xff, 0xff, 0xf0,	/* 41 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x53, 0x63, 0x33, 0x83, 0x13, 0xa5, 0xc3, 0x8d, 0x3d, 0x83,
+	0xc5, 0xa3, 0x13, 0x83, 0x33, 0x63, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,	/* 42 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0xfc, 0x53, 0x5f, 0x45, 0x35, 0xff, 0xff, 0xc3,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x10,	/* 43 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x3d, 0x3d, 0x3d, 0x3c,
+	0x3c, 0x3f, 0xff, 0xfd,	/* 44 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x20,	/* 45 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x3d, 0x3d, 0x3d, 0x3f,
+	0xff, 0xff, 0xfd,	/* 46 */
+	0xff, 0xff, 0xff, 0xf2, 0x3d, 0x3c, 0x3d, 0x3c, 0x3d, 0x3c, 0x3d, 0x3c, 0x3d, 0x3c, 0x3d, 0x3c,
+	0x3d, 0x3c, 0x3d, 0x3c, 0x3d, 0x3c, 0x3d, 0x3f, 0xff, 0xff, 0xff, 0x20,	/* 47 */
+	0xff, 0xff, 0xff, 0x99, 0x61, 0x91, 0x41, 0x35, 0x31, 0x61, 0x51, 0xff, 0x11, 0xe1, 0xe1, 0xe1,
+	0x21, 0xb1, 0x21, 0xb1, 0x21, 0xb1, 0x21, 0xe1, 0xe1, 0xe1, 0xff, 0xf2, 0x15, 0x16, 0x13, 0x53,
+	0x14, 0x19, 0x16, 0x9f, 0xff, 0xff, 0x90,	/* 48 */
+	0xff, 0xff, 0xff, 0xc3, 0xc1, 0xe1, 0xe1, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+	0x33, 0x3f, 0x89, 0xff, 0xff, 0xf9,	/* 49 */
+	0xff, 0xff, 0xff, 0x99, 0x6b, 0x44, 0x54, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0xd3,
+	0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xdd, 0x3d, 0xff, 0xff, 0xff, 0x80,	/* 50 */
+	0xff, 0xff, 0xff, 0x99, 0x6b, 0x44, 0x54, 0x33, 0x73, 0x33, 0x73, 0xd3, 0xd3, 0xd3, 0xc4, 0x69,
+	0x79, 0xd4, 0xd3, 0xd3, 0xd3, 0x33, 0x73, 0x33, 0x73, 0x34, 0x54, 0x4b, 0x69, 0xff, 0xff, 0xff,
+	0xa0,	/* 51 */
+	0xff, 0xff, 0xff, 0xf2, 0x3c, 0x1e, 0x1e, 0x1e, 0x12, 0x1b, 0x12, 0x1b, 0x12, 0x1b, 0x12, 0x1b,
+	0x12, 0x1b, 0x12, 0x1b, 0x12, 0x1f, 0xff, 0x27, 0xf7, 0xaf, 0xff, 0xff, 0x53, 0xff, 0xff, 0xf7,	/* 52 */
+	0xff, 0xff, 0xff, 0x7d, 0xf7, 0xaf, 0xff, 0xff, 0xb8, 0xf1, 0x14, 0x93, 0x1c, 0x1f, 0xff, 0xfa,
+	0x3f, 0x11, 0xc1, 0x36, 0x21, 0x41, 0x91, 0x69, 0xff, 0xff, 0xf9,	/* 53 */
+	0xff, 0xff, 0xff, 0x9a, 0x51, 0xe1, 0x38, 0x71, 0xff, 0xff, 0xf4, 0x8f, 0x11, 0x76, 0x31, 0xc1,
+	0xff, 0xff, 0xfe, 0x15, 0x16, 0x13, 0x53, 0x14, 0x19, 0x16, 0x9f, 0xff, 0xff, 0x90,	/* 54 */
+	0xff, 0xff, 0xff, 0x7d, 0xf7, 0x7f, 0xff, 0x21, 0x21, 0x33, 0xf6, 0x12, 0x1f, 0xc1, 0x21, 0xfc,
+	0x12, 0x1f, 0xc1, 0x21, 0xff, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0xff, 0xc0,	/* 55 */
+	0xff, 0xff, 0xff, 0x99, 0x61, 0x91, 0x41, 0x35, 0x31, 0x61, 0x51, 0xff, 0xff, 0xd1, 0x51, 0x61,
+	0x35, 0x31, 0xf4, 0x13, 0x53, 0x16, 0x15, 0x1f, 0xff, 0xfd, 0x15, 0x16, 0x13, 0x53, 0x14, 0x19,
+	0x16, 0x9f, 0xff, 0xff, 0x90,	/* 56 */
+	0xff, 0xff, 0xff, 0x99, 0x61, 0x91, 0x41, 0x35, 0x31, 0x61, 0x51, 0xff, 0xff, 0xfe, 0x1c, 0x13,
+	0x67, 0x1f, 0x18, 0xff, 0xff, 0xf4, 0x17, 0x83, 0x1e, 0x15, 0xaf, 0xff, 0xff, 0x90,	/* 57 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0xf1, 0x3f, 0xff, 0xff, 0xf3, 0x3f, 0xff,
+	0xf1, 0x3f, 0xff, 0xff, 0xc0,	/* 58 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3d, 0x3d, 0x3d, 0x3f, 0xff, 0xff, 0xff, 0x43, 0xd3,
+	0xd3, 0xd3, 0xc3, 0xc3, 0xff, 0xff, 0xd0,	/* 59 */
+	0xff, 0xff, 0xff, 0xf2, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3d, 0x3e, 0x3e,
+	0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3f, 0xff, 0xff, 0xf8,	/* 60 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x3d, 0xff, 0xff, 0x7d, 0x3d, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xe0,	/* 61 */
+	0xff, 0xff, 0xff, 0x83, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xd3, 0xc3, 0xc3,
+	0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0xff, 0xff, 0xf2,	/* 62 */
+	0xff, 0xff, 0xff, 0x99, 0x6b, 0x44, 0x54, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0xc3,
+	0xc3, 0xc3, 0xc3, 0xc3, 0xd3, 0xd3, 0xff, 0xf0, 0x3d, 0x3d, 0x3d, 0x3f, 0xff, 0xff, 0xfd,	/* 63 */
+	0xff, 0xff, 0xff, 0x9a, 0x51, 0xa1, 0x31, 0x37, 0x21, 0x51, 0x71, 0xa6, 0x91, 0xe1, 0x33, 0xc1,
+	0xff, 0xff, 0xff, 0x51, 0x21, 0x91, 0x32, 0xb1, 0x51, 0xa5, 0x12, 0x51, 0xc1, 0x3a, 0x31, 0xf1,
+	0xcf, 0xff, 0xff, 0x60,	/* 64 */
+	0xff, 0xff, 0xff, 0x99, 0x61, 0x91, 0x41, 0x35, 0x31, 0x61, 0x51, 0xff, 0xff, 0xff, 0xf0, 0x7f,
+	0xa7, 0xff, 0xff, 0xff, 0xfd, 0x37, 0x3f, 0xff, 0xff, 0x70,	/* 65 */
+	0xff, 0xff, 0xff, 0x7b, 0xf1, 0x17, 0x63, 0x1c, 0x1f, 0xff, 0xf3, 0x12, 0x16, 0x62, 0x1f, 0x86,
+	0x21, 0xd1, 0x21, 0xff, 0xff, 0xff, 0x21, 0x96, 0x31, 0xe1, 0x4b, 0xff, 0xff, 0xf9,	/* 66 */
+	0xff, 0xff, 0xff, 0x99, 0x61, 0x91, 0x41, 0x35, 0x31, 0x61, 0x51, 0xff, 0x23, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x73, 0xf7, 0x15, 0x16, 0x13, 0x53, 0x14, 0x19, 0x16, 0x9f, 0xff, 0xff, 0x90,	/* 67 */
+	0xff, 0xff, 0xff, 0x79, 0xf1, 0x28, 0x53, 0x1c, 0x1f, 0x11, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x81, 0x21, 0xb1, 0xa5, 0x31, 0xd2, 0x59, 0xff, 0xff, 0xfb,	/* 68 */
+	0xff, 0xff, 0xff, 0x7d, 0xf7, 0xaf, 0xff, 0xff, 0xfc, 0x7f, 0xa7, 0xff, 0xff, 0xff, 0xf0, 0xaf,
+	0x4d, 0xff, 0xff, 0xf7,	/* 69 */
+	0xff, 0xff, 0xff, 0x7d, 0xf7, 0xaf, 0xff, 0xff, 0xfc, 0x7f, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xe3,
+	0xff, 0xff, 0xff, 0x20,	/* 70 */
+	0xff, 0xff, 0xff, 0x99, 0x61, 0x91, 0x41, 0x35, 0x31, 0x61, 0x51, 0xff, 0x23, 0xff, 0xfc, 0x7f,
+	0xa4, 0xff, 0xff, 0xfe, 0x15, 0x16, 0x13, 0x53, 0x14, 0x19, 0x16, 0x9f, 0xff, 0xff, 0x90,	/* 71 */
+	0xff, 0xff, 0xff, 0x73, 0x73, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xfe,
+	0x37, 0x3f, 0xff, 0xff, 0x70,	/* 72 */
+	0xff, 0xff, 0xff, 0xa7, 0xfa, 0x23, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x23,
+	0x2f, 0xa7, 0xff, 0xff, 0xfa,	/* 73 */
+	0xff, 0xff, 0xff, 0xe7, 0xfa, 0x23, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xf3, 0x14,
+	0x17, 0x13, 0x43, 0x15, 0x18, 0x17, 0x8f, 0xff, 0xff, 0xa0,	/* 74 */
+	0xff, 0xff, 0xff, 0x73, 0x82, 0x33, 0x73, 0x33, 0x63, 0x43, 0x53, 0x53, 0x43, 0x63, 0x33, 0x73,
+	0x23, 0x83, 0x13, 0x96, 0xa5, 0xb5, 0xb6, 0xa3, 0x13, 0x93, 0x23, 0x83, 0x33, 0x73, 0x43, 0x63,
+	0x53, 0x53, 0x63, 0x43, 0x73, 0x33, 0x82, 0xff, 0xff, 0xff, 0x80,	/* 75 */
+	0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xaf, 0x4d,
+	0xff, 0xff, 0xf7,	/* 76 */
+	0xff, 0xff, 0xff, 0x73, 0x83, 0xf6, 0x16, 0x19, 0x14, 0x1b, 0x12, 0x1f, 0xb1, 0x22, 0x21, 0x91,
+	0x41, 0xfc, 0x12, 0x1d, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x38, 0x3f, 0xff, 0xff, 0x60,	/* 77 */
+	0xff, 0xff, 0xff, 0x73, 0x73, 0xff, 0xff, 0xa1, 0xf1, 0x1f, 0x11, 0xd1, 0x21, 0xd1, 0x21, 0xd1,
+	0x21, 0xd1, 0x21, 0xd1, 0xf1, 0x1f, 0x11, 0xff, 0xff, 0xfb, 0x37, 0x3f, 0xff, 0xff, 0x70,	/* 78 */
+	0xff, 0xff, 0xff, 0x99, 0x61, 0x91, 0x41, 0x35, 0x31, 0x61, 0x51, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x71, 0x51, 0x61, 0x35, 0x31, 0x41, 0x91, 0x69, 0xff, 0xff, 0xf9,	/* 79 */
+	0xff, 0xff, 0xff, 0x7b, 0xf1, 0x17, 0x63, 0x1c, 0x1f, 0xff, 0xff, 0xf5, 0x19, 0x63, 0x1e, 0x17,
+	0x8f, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0x20,	/* 80 */
+	0xff, 0xff, 0xff, 0x99, 0x61, 0x91, 0x41, 0x35, 0x31, 0x61, 0x51, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xf8, 0x3b, 0x11, 0x12, 0x26, 0x13, 0x26, 0x14, 0x19, 0x16, 0x72, 0x1d, 0x12, 0x1d, 0x3f,
+	0xff, 0x50,	/* 81 */
+	0xff, 0xff, 0xff, 0x7b, 0xf1, 0x17, 0x63, 0x1c, 0x1f, 0xff, 0xff, 0xf5, 0x19, 0x63, 0x1e, 0x1a,
+	0x58, 0x12, 0x1d, 0x12, 0x1d, 0x12, 0x1d, 0x12, 0x1d, 0x12, 0x1d, 0x12, 0x1d, 0x12, 0x13, 0x37,
+	0x3f, 0xff, 0xff, 0x70,	/* 82 */
+	0xff, 0xff, 0xff, 0x99, 0x6b, 0x44, 0x54, 0x33, 0x73, 0x33, 0x73, 0x33, 0xd3, 0xd3, 0xd4, 0xda,
+	0x7a, 0xd4, 0xd3, 0xd3, 0xd3, 0x33, 0x73, 0x33, 0x73, 0x34, 0x54, 0x4b, 0x69, 0xff, 0xff, 0xff,
+	0xa0,	/* 83 */
+	0xff, 0xff, 0xff, 0x7d, 0xf4, 0x53, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+	0x3f, 0xff, 0xff, 0xc0,	/* 84 */
+	0xff, 0xff, 0xff, 0x73, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x15, 0x16,
+	0x13, 0x53, 0x14, 0x19, 0x16, 0x9f, 0xff, 0xff, 0x90,	/* 85 */
+	0xff, 0xff, 0xff, 0x73, 0x73, 0xff, 0xff, 0x71, 0x21, 0x51, 0x21, 0xff, 0xff, 0x81, 0x21, 0x31,
+	0x21, 0xff, 0xf9, 0x12, 0x11, 0x12, 0x1f, 0xfa, 0x12, 0x12, 0x1f, 0xfc, 0x5f, 0xff, 0xff, 0xb0,	/* 86 */
+	0xff, 0xff, 0xff, 0x73, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xd1, 0x21, 0xfc, 0x14, 0x19,
+	0x12, 0x22, 0x1f, 0xb1, 0x21, 0xb1, 0x41, 0x91, 0x61, 0xf6, 0x38, 0x3f, 0xff, 0xff, 0x60,	/* 87 */
+	0xff, 0xff, 0xff, 0x73, 0x73, 0x33, 0x73, 0x43, 0x53, 0x53, 0x53, 0x63, 0x33, 0x73, 0x33, 0x83,
+	0x13, 0x93, 0x13, 0xa5, 0xb5, 0xb5, 0xb5, 0xa3, 0x13, 0x93, 0x13, 0x83, 0x33, 0x73, 0x33, 0x63,
+	0x53, 0x53, 0x53, 0x43, 0x73, 0x33, 0x73, 0xff, 0xff, 0xff, 0x80,	/* 88 */
+	0xff, 0xff, 0xff, 0x73, 0x73, 0xff, 0x51, 0x21, 0x51, 0x21, 0xf5, 0x12, 0x13, 0x12, 0x1f, 0x71,
+	0x21, 0x11, 0x21, 0xf9, 0x12, 0x12, 0x1f, 0xb1, 0x31, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x3f, 0xff,
+	0xff, 0xc0,	/* 89 */
+	0xff, 0xff, 0xff, 0x7d, 0x3d, 0xd3, 0xd3, 0xd3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+	0xc3, 0xc3, 0xd3, 0xd3, 0xd3, 0xdd, 0x3d, 0xff, 0xff, 0xff, 0x80,	/* 90 */
+	0xff, 0xff, 0xff, 0xa8, 0xfc, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x5f, 0x98,
+	0xff, 0xff, 0xf9,	/* 91 */
+	0xff, 0xff, 0xff, 0x83, 0xd3, 0xe3, 0xd3, 0xe3, 0xd3, 0xe3, 0xd3, 0xe3, 0xd3, 0xe3, 0xd3, 0xe3,
+	0xd3, 0xe3, 0xd3, 0xe3, 0xd3, 0xe3, 0xd3, 0xff, 0xff, 0xff, 0x80,	/* 92 */
+	0xff, 0xff, 0xff, 0xa8, 0xf9, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x5f, 0xc8,
+	0xff, 0xff, 0xf9,	/* 93 */
+	0xff, 0xff, 0xa3, 0xc5, 0xa3, 0x13, 0x83, 0x33, 0x63, 0x53, 0x43, 0x73, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,	/* 94 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x3d,
+	0xff, 0xf5,	/* 95 */
+	0xff, 0x53, 0xe3, 0xe3, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0x30,	/* 96 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xf1, 0x15, 0x83, 0x1c, 0x1f, 0x98, 0x71, 0xe1, 0x36,
+	0x91, 0xff, 0xf2, 0x1c, 0x13, 0x67, 0x1f, 0x1b, 0xff, 0xff, 0xf7,	/* 97 */
+	0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0x68, 0xf1, 0x17, 0x63, 0x1c, 0x1f, 0xff, 0xff, 0xff,
+	0xf7, 0x19, 0x63, 0x1e, 0x14, 0xbf, 0xff, 0xff, 0x90,	/* 98 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x96, 0xb4, 0x45, 0x43, 0x37, 0x33, 0x3d, 0x3d, 0x3d,
+	0x3d, 0x3d, 0x3d, 0x37, 0x33, 0x45, 0x44, 0xb6, 0x9f, 0xff, 0xff, 0xfa,	/* 99 */
+	0xff, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0xa8, 0x71, 0xe1, 0x36, 0x91, 0xff, 0xff, 0xff, 0xff,
+	0x71, 0xc1, 0x36, 0x71, 0xf1, 0xbf, 0xff, 0xff, 0x70,	/* 100 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x96, 0xb4, 0x45, 0x43, 0x37, 0x33, 0x37, 0x33, 0x37,
+	0x33, 0xd3, 0xd3, 0x3d, 0x3d, 0x3d, 0x46, 0x34, 0xc5, 0xaf, 0xff, 0xff, 0xf9,	/* 101 */
+	0xff, 0xff, 0xff, 0xe7, 0x81, 0xe1, 0x35, 0xa1, 0xff, 0xa4, 0x34, 0xf6, 0x43, 0x4f, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xf5, 0x3f, 0xff, 0xff, 0xc0,	/* 102 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xb4, 0x1e, 0x13, 0x69, 0x1f, 0xff, 0xff, 0xff, 0xf7,
+	0x1c, 0x13, 0x67, 0x1f, 0x18, 0xff, 0x11, 0x78, 0x31, 0xe1, 0x5a, 0x40,	/* 103 */
+	0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0x68, 0xf1, 0x17, 0x63, 0x1c, 0x1f, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x13, 0x73, 0xff, 0xff, 0xf7,	/* 104 */
+	0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0x13, 0xfc, 0x5f, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82,
+	0x32, 0xfa, 0x7f, 0xff, 0xff, 0xa0,	/* 105 */
+	0xff, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0xf1, 0x3f, 0xc5, 0xfc, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xf4, 0x3f, 0xf2, 0x13, 0x18, 0x13, 0x33, 0x16, 0x17, 0x18, 0x75,	/* 106 */
+	0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xc3, 0xc1, 0x21, 0xb1, 0x21, 0xb1, 0x21, 0xb1, 0x21,
+	0xb1, 0x21, 0xb1, 0x21, 0xfd, 0x12, 0x1d, 0x12, 0x1d, 0x12, 0x1d, 0x12, 0x1d, 0x12, 0x1d, 0x12,
+	0x14, 0x36, 0x3f, 0xff, 0xff, 0x70,	/* 107 */
+	0xff, 0xff, 0xff, 0xa5, 0xfc, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x23, 0x2f,
+	0xa7, 0xff, 0xff, 0xfa,	/* 108 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xf1, 0x17, 0x23, 0x13, 0x1c, 0x1f, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x13, 0x23, 0x23, 0xff, 0xff, 0xf7,	/* 109 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xf1, 0x17, 0x63, 0x1c, 0x1f, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x13, 0x73, 0xff, 0xff, 0xf7,	/* 110 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x96, 0x19, 0x14, 0x13, 0x53, 0x16, 0x15, 0x1f, 0xff,
+	0xff, 0xff, 0xf1, 0x15, 0x16, 0x13, 0x53, 0x14, 0x19, 0x16, 0x9f, 0xff, 0xff, 0x90,	/* 111 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xf1, 0x17, 0x63, 0x1c, 0x1f, 0xff, 0xff, 0xff, 0xf7,
+	0x19, 0x63, 0x1e, 0x17, 0x8f, 0xff, 0xf9, 0x3c,	/* 112 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xb4, 0x1e, 0x13, 0x69, 0x1f, 0xff, 0xff, 0xff, 0xf7,
+	0x1c, 0x13, 0x67, 0x1f, 0x18, 0xff, 0xff, 0xf5, 0x32,	/* 113 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x28, 0x71, 0xe1, 0x27, 0x81, 0xe1, 0xe1, 0xff, 0xff,
+	0xff, 0xff, 0xf5, 0x3f, 0xff, 0xff, 0xf2,	/* 114 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x96, 0xb4, 0x45, 0x43, 0x3d, 0x3d, 0x4d, 0xa7, 0xad,
+	0x4d, 0x3d, 0x33, 0x45, 0x44, 0xb6, 0x9f, 0xff, 0xff, 0xfa,	/* 115 */
+	0xff, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xfe, 0x43, 0x4f, 0x64, 0x34, 0xff, 0xff, 0xff, 0xff, 0xf5,
+	0x1c, 0x13, 0x58, 0x1f, 0x17, 0xff, 0xff, 0xf7,	/* 116 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x1c, 0x13,
+	0x67, 0x1f, 0x1b, 0xff, 0xff, 0xf7,	/* 117 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x73, 0xff, 0x51, 0x21, 0x51, 0x21, 0xff, 0x61, 0x21,
+	0x31, 0x21, 0xff, 0x81, 0x21, 0x11, 0x21, 0xf9, 0x12, 0x12, 0x1f, 0xfc, 0x5f, 0xff, 0xff, 0xb0,	/* 118 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x73, 0xff, 0xfb, 0x3f, 0xff, 0xff, 0xff, 0x21, 0x51,
+	0x61, 0x31, 0x31, 0x31, 0x41, 0x91, 0x69, 0xff, 0xff, 0xf9,	/* 119 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x73, 0x33, 0x73, 0x33, 0x73, 0x43, 0x53, 0x63, 0x33,
+	0x83, 0x13, 0xa5, 0xb5, 0xa3, 0x13, 0x83, 0x33, 0x63, 0x53, 0x43, 0x73, 0x33, 0x73, 0x33, 0x73,
+	0xff, 0xff, 0xff, 0x80,	/* 120 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x1c, 0x13,
+	0x67, 0x1f, 0x18, 0xff, 0x11, 0x78, 0x31, 0xe1, 0x5a, 0x40,	/* 121 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x3d, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+	0xc3, 0xc3, 0xdd, 0x3d, 0xff, 0xff, 0xff, 0x80,	/* 122 */
+	0xff, 0xff, 0xff, 0xd5, 0xa6, 0x94, 0xc3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xa5, 0xb5, 0xe3, 0xd3,
+	0xd3, 0xd3, 0xd3, 0xd3, 0xd4, 0xd6, 0xb5, 0xff, 0xff, 0xff, 0xa0,	/* 123 */
+	0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x3f,
+	0xff, 0xff, 0xc0,	/* 124 */
+	0xff, 0xff, 0xff, 0x85, 0xb6, 0xd4, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xe5, 0xb5, 0xa3, 0xd3,
+	0xd3, 0xd3, 0xd3, 0xd3, 0xc4, 0x96, 0xa5, 0xff, 0xff, 0xff, 0xf0,	/* 125 */
+	0xff, 0xff, 0x74, 0x43, 0x46, 0x33, 0x33, 0x14, 0x23, 0x33, 0x24, 0x13, 0x33, 0x36, 0x43, 0x44,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,	/* 126 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x3c, 0x5a, 0x78, 0x41, 0x46, 0x43, 0x44, 0x45, 0x42, 0x47,
+	0x41, 0x39, 0x31, 0x39, 0x31, 0x39, 0x31, 0x39, 0x31, 0x39, 0x31, 0x39, 0x31, 0x39, 0x31, 0xf0,
+	0x1f, 0x0f, 0xff, 0xff, 0xf7,	/* 127 */
+#if CONFIG_LCD_FONT_EXTENDED_ASCII
+	0xff, 0xff, 0xff, 0x99, 0x6b, 0x44, 0x54, 0x33, 0x73, 0x33, 0x73, 0x33, 0xd3, 0xd3, 0xd3, 0xd3,
+	0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0x73, 0x33, 0x73, 0x34, 0x54, 0x4b, 0x69, 0xa3, 0xd3, 0xd3,
+	0xc3, 0xc3, 0xfa,	/* 128 */
+	0xff, 0xff, 0xff, 0x93, 0x33, 0xff, 0xfa, 0x33, 0x3f, 0x63, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xf1, 0x1c, 0x13, 0x67, 0x1f, 0x1b, 0xff, 0xff, 0xf7,	/* 129 */
+	0xff, 0xff, 0xff, 0xf0, 0x3c, 0x3c, 0x3c, 0x3f, 0xfc, 0x96, 0xb4, 0x45, 0x43, 0x37, 0x33, 0x37,
+	0x33, 0x37, 0x33, 0xd3, 0xd3, 0x3d, 0x3d, 0x3d, 0x46, 0x34, 0xc5, 0xaf, 0xff, 0xff, 0xf9,	/* 130 */
+	0xff, 0xff, 0xff, 0xc3, 0xc5, 0xa3, 0x13, 0x83, 0x33, 0xff, 0x8a, 0x6b, 0xd4, 0xd3, 0xd3, 0x5b,
+	0x4c, 0x34, 0x63, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x34, 0x63, 0x4c, 0x5b, 0xff, 0xff, 0xff,
+	0x80,	/* 131 */
+	0xff, 0xff, 0xff, 0x93, 0x33, 0xff, 0xfa, 0x33, 0x3f, 0x7a, 0xf1, 0x15, 0x83, 0x1c, 0x1f, 0x98,
+	0x71, 0xe1, 0x36, 0x91, 0xff, 0xf2, 0x1c, 0x13, 0x67, 0x1f, 0x1b, 0xff, 0xff, 0xf7,	/* 132 */
+	0xff, 0xff, 0xff, 0x93, 0xe3, 0xe3, 0xe3, 0xff, 0xba, 0x6b, 0xd4, 0xd3, 0xd3, 0x5b, 0x4c, 0x34,
+	0x63, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x34, 0x63, 0x4c, 0x5b, 0xff, 0xff, 0xff, 0x80,	/* 133 */
+	0xff, 0xff, 0xff, 0xb5, 0xa1, 0x21, 0x21, 0xff, 0xb1, 0x21, 0x21, 0xa5, 0x8a, 0xf1, 0x15, 0x83,
+	0x1c, 0x1f, 0x98, 0x71, 0xe1, 0x36, 0x91, 0xff, 0xf2, 0x1c, 0x13, 0x67, 0x1f, 0x1b, 0xff, 0xff,
+	0xf7,	/* 134 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x96, 0xb4, 0x45, 0x43, 0x37, 0x33, 0x3d, 0x3d, 0x3d,
+	0x3d, 0x3d, 0x3d, 0x37, 0x33, 0x45, 0x44, 0xb6, 0x9a, 0x3d, 0x3d, 0x3c, 0x3c, 0x3f, 0xa0,	/* 135 */
+	0xff, 0xff, 0xff, 0xc3, 0xc5, 0xa3, 0x13, 0x83, 0x33, 0xff, 0x99, 0x6b, 0x44, 0x54, 0x33, 0x73,
+	0x33, 0x73, 0x33, 0x73, 0x3d, 0x3d, 0x33, 0xd3, 0xd3, 0xd4, 0x63, 0x4c, 0x5a, 0xff, 0xff, 0xff,
+	0x90,	/* 136 */
+	0xff, 0xff, 0xff, 0x93, 0x33, 0xff, 0xfa, 0x33, 0x3f, 0x89, 0x61, 0x91, 0x41, 0x35, 0x31, 0x61,
+	0x51, 0xff, 0xb7, 0xfa, 0xaf, 0xf8, 0x16, 0x33, 0x13, 0x67, 0x1a, 0x15, 0xaf, 0xff, 0xff, 0x80,	/* 137 */
+	0xff, 0xff, 0xff, 0x93, 0xe3, 0xe3, 0xe3, 0xff, 0xc9, 0x6b, 0x44, 0x54, 0x33, 0x73, 0x33, 0x73,
+	0x33, 0x73, 0x3d, 0x3d, 0x33, 0xd3, 0xd3, 0xd4, 0x63, 0x4c, 0x5a, 0xff, 0xff, 0xff, 0x90,	/* 138 */
+	0xff, 0xff, 0xff, 0x93, 0x33, 0xff, 0xfa, 0x33, 0x3f, 0x95, 0xfc, 0x2f, 0xff, 0xff, 0xff, 0xff,
+	0xf8, 0x23, 0x2f, 0xa7, 0xff, 0xff, 0xfa,	/* 139 */
+	0xff, 0xff, 0xff, 0xc3, 0xc5, 0xa3, 0x13, 0x83, 0x33, 0xff, 0xa5, 0xb5, 0xd3, 0xd3, 0xd3, 0xd3,
+	0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xb7, 0x97, 0xff, 0xff, 0xff, 0xb0,	/* 140 */
+	0xff, 0xff, 0xff, 0x93, 0xe3, 0xe3, 0xe3, 0xff, 0xd5, 0xb5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
+	0xd3, 0xd3, 0xd3, 0xd3, 0xb7, 0x97, 0xff, 0xff, 0xff, 0xb0,	/* 141 */
+	0xf4, 0x33, 0x3f, 0xff, 0xa3, 0x33, 0x79, 0x61, 0x91, 0x41, 0x35, 0x31, 0x61, 0x51, 0xff, 0xff,
+	0xff, 0xf0, 0x7f, 0xa7, 0xff, 0xff, 0xff, 0xfd, 0x37, 0x3f, 0xff, 0xff, 0x70,	/* 142 */
+	0xf6, 0x5a, 0x12, 0x12, 0x1f, 0xfb, 0x12, 0x12, 0x18, 0x25, 0x26, 0x19, 0x14, 0x13, 0x53, 0x16,
+	0x15, 0x1f, 0xff, 0xff, 0xff, 0x07, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xd3, 0x73, 0xff, 0xff, 0xf7,	/* 143 */
+	0xfa, 0x3c, 0x12, 0x1b, 0x12, 0x1b, 0x12, 0x1c, 0x38, 0xdf, 0x7a, 0xff, 0xff, 0xff, 0xc7, 0xfa,
+	0x7f, 0xff, 0xff, 0xff, 0x0a, 0xf4, 0xdf, 0xff, 0xff, 0x70,	/* 144 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x15, 0x4d, 0x83, 0x24, 0x73, 0x33, 0x73, 0x33, 0x37,
+	0x33, 0x2e, 0x14, 0x29, 0x13, 0x33, 0x73, 0x33, 0x73, 0x33, 0x74, 0x24, 0x23, 0x2e, 0x35, 0x16,
+	0xff, 0xff, 0xff, 0x80,	/* 145 */
+	0xff, 0xff, 0xff, 0x8d, 0x21, 0xe1, 0x33, 0x35, 0x41, 0xff, 0xff, 0xff, 0x54, 0x35, 0xf5, 0x43,
+	0x5f, 0xff, 0xff, 0xff, 0x25, 0xf2, 0x34, 0x8f, 0xff, 0xff, 0x60,	/* 146 */
+	0xff, 0xff, 0xff, 0xc3, 0xc5, 0xa3, 0x13, 0x83, 0x33, 0xff, 0x99, 0x6b, 0x44, 0x54, 0x33, 0x73,
+	0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x34, 0x54,
+	0x4b, 0x69, 0xff, 0xff, 0xff, 0xa0,	/* 147 */
+	0xff, 0xff, 0xff, 0x93, 0x33, 0xff, 0xfa, 0x33, 0x3f, 0x89, 0x61, 0x91, 0x41, 0x35, 0x31, 0x61,
+	0x51, 0xff, 0xff, 0xff, 0xff, 0x11, 0x51, 0x61, 0x35, 0x31, 0x41, 0x91, 0x69, 0xff, 0xff, 0xf9,	/* 148 */
+	0xff, 0xff, 0xff, 0x93, 0xd1, 0x21, 0xd1, 0x21, 0xd1, 0x21, 0xd3, 0xfb, 0x96, 0x19, 0x14, 0x13,
+	0x53, 0x16, 0x15, 0x1f, 0xff, 0xff, 0xff, 0xf1, 0x15, 0x16, 0x13, 0x53, 0x14, 0x19, 0x16, 0x9f,
+	0xff, 0xff, 0x90,	/* 149 */
+	0xff, 0xff, 0xff, 0xc3, 0xc1, 0x31, 0xa1, 0x21, 0x21, 0x81, 0x21, 0x11, 0x21, 0x73, 0x33, 0xf6,
+	0x37, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0xc1, 0x36, 0x71, 0xf1, 0xbf, 0xff, 0xff, 0x70,	/* 150 */
+	0xff, 0xff, 0xff, 0x93, 0xd1, 0x21, 0xd1, 0x21, 0xd1, 0x21, 0xd3, 0xf9, 0x37, 0x3f, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0x11, 0xc1, 0x36, 0x71, 0xf1, 0xbf, 0xff, 0xff, 0x70,	/* 151 */
+	0xff, 0xff, 0xff, 0x93, 0x33, 0xff, 0xfa, 0x33, 0x3f, 0x63, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xf1, 0x1c, 0x13, 0x67, 0x1f, 0x18, 0xff, 0x11, 0x78, 0x31, 0xe1, 0x5a, 0x40,	/* 152 */
+	0xf4, 0x33, 0x3f, 0xff, 0xa3, 0x33, 0x79, 0x61, 0x91, 0x41, 0x35, 0x31, 0x61, 0x51, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0x51, 0x61, 0x35, 0x31, 0x41, 0x91, 0x69, 0xff, 0xff, 0xf9,	/* 153 */
+	0xf4, 0x33, 0x3f, 0xff, 0xa3, 0x33, 0x53, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xf7, 0x15, 0x16, 0x13, 0x53, 0x14, 0x19, 0x16, 0x9f, 0xff, 0xff, 0x90,	/* 154 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xc3, 0x33, 0x61, 0x91, 0x41, 0x31, 0x31, 0x31, 0x61,
+	0x51, 0xf1, 0x3f, 0xff, 0xff, 0xf3, 0x36, 0x15, 0x16, 0x13, 0x13, 0x13, 0x14, 0x19, 0x16, 0x33,
+	0x3f, 0xfc, 0x3f, 0xf9,	/* 155 */
+	0xff, 0xff, 0xff, 0xb6, 0x91, 0x61, 0x71, 0x32, 0x31, 0x91, 0x21, 0xf1, 0x3f, 0xff, 0xf8, 0x23,
+	0x5f, 0x72, 0x35, 0xff, 0xff, 0xf5, 0x3f, 0x42, 0x35, 0xf7, 0xdf, 0xff, 0xff, 0x70,	/* 156 */
+	0xff, 0xff, 0xff, 0x73, 0x73, 0x33, 0x73, 0x43, 0x53, 0x53, 0x53, 0x63, 0x33, 0x73, 0x33, 0x83,
+	0x13, 0x93, 0x13, 0xa5, 0xb5, 0xc3, 0xd3, 0x9b, 0x5b, 0x93, 0xd3, 0x9b, 0x5b, 0x93, 0xd3, 0xff,
+	0xff, 0xff, 0xd0,	/* 157 */
+	0xff, 0xff, 0xff, 0x68, 0xf1, 0x1a, 0x33, 0x1c, 0x1f, 0xff, 0xff, 0x41, 0xc3, 0x42, 0xc1, 0xa5,
+	0xe3, 0x33, 0xf8, 0x33, 0x3f, 0xff, 0xf1, 0x3a, 0x16, 0x37, 0x5f, 0xff, 0xff, 0x60,	/* 158 */
+	0xff, 0xff, 0xff, 0xd6, 0x91, 0x61, 0xb2, 0xff, 0x23, 0xff, 0xf8, 0x33, 0x3f, 0x83, 0x33, 0xff,
+	0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf2, 0x2b, 0x16, 0x19, 0x6f, 0x90,	/* 159 */
+	0xff, 0xff, 0xff, 0xf0, 0x3c, 0x3c, 0x3c, 0x3f, 0xfb, 0xa6, 0xbd, 0x4d, 0x3d, 0x35, 0xb4, 0xc3,
+	0x46, 0x33, 0x37, 0x33, 0x37, 0x33, 0x37, 0x33, 0x46, 0x34, 0xc5, 0xbf, 0xff, 0xff, 0xf8,	/* 160 */
+	0xff, 0xff, 0xff, 0xf0, 0x3c, 0x3c, 0x3c, 0x3f, 0xfd, 0x5b, 0x5d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+	0x3d, 0x3d, 0x3d, 0x3d, 0x3b, 0x79, 0x7f, 0xff, 0xff, 0xfb,	/* 161 */
+	0xff, 0xff, 0xff, 0xf0, 0x3c, 0x12, 0x1b, 0x12, 0x1b, 0x12, 0x1c, 0x3f, 0xb9, 0x61, 0x91, 0x41,
+	0x35, 0x31, 0x61, 0x51, 0xff, 0xff, 0xff, 0xff, 0x11, 0x51, 0x61, 0x35, 0x31, 0x41, 0x91, 0x69,
+	0xff, 0xff, 0xf9,	/* 162 */
+	0xff, 0xff, 0xff, 0xf0, 0x3c, 0x12, 0x1b, 0x12, 0x1b, 0x12, 0x1c, 0x3f, 0x93, 0x73, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xf1, 0x1c, 0x13, 0x67, 0x1f, 0x1b, 0xff, 0xff, 0xf7,	/* 163 */
+	0xff, 0xff, 0xff, 0x95, 0x23, 0x51, 0x21, 0x21, 0xfe, 0x12, 0x12, 0x15, 0x32, 0x5f, 0x6b, 0xf1,
+	0x17, 0x63, 0x1c, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0x73, 0xff, 0xff, 0xf7,	/* 164 */
+	0xf4, 0x52, 0x35, 0x12, 0x12, 0x1f, 0xe1, 0x21, 0x21, 0x53, 0x25, 0x53, 0x73, 0xff, 0xff, 0xa1,
+	0xf1, 0x1f, 0x11, 0xd1, 0x21, 0xd1, 0x21, 0xd1, 0x21, 0xd1, 0x21, 0xd1, 0xf1, 0x1f, 0x11, 0xff,
+	0xff, 0xfb, 0x37, 0x3f, 0xff, 0xff, 0x70,	/* 165 */
+	0xff, 0x58, 0x89, 0xe3, 0xd3, 0x79, 0x6a, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x6a, 0x79, 0xff,
+	0x7b, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,	/* 166 */
+	0xff, 0x67, 0x81, 0x71, 0x61, 0x25, 0x21, 0xff, 0xff, 0xff, 0xb1, 0x25, 0x21, 0x61, 0x71, 0x87,
+	0xf8, 0xbf, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,	/* 167 */
+	0xff, 0xff, 0xff, 0xc3, 0xd3, 0xd3, 0xd3, 0xff, 0xf0, 0x3d, 0x3d, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+	0x37, 0x33, 0x37, 0x33, 0x37, 0x33, 0x37, 0x33, 0x45, 0x44, 0xb6, 0x9f, 0xff, 0xff, 0xfa,	/* 168 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xf7, 0xaf, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x80,	/* 169 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xf4, 0xaf, 0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xd0,	/* 170 */
+	0xff, 0xff, 0xff, 0x93, 0xc4, 0xb5, 0x72, 0x43, 0x63, 0x43, 0x53, 0x53, 0x43, 0x63, 0x33, 0x73,
+	0x23, 0x83, 0x13, 0xc3, 0xc3, 0xc3, 0x16, 0x53, 0x18, 0x33, 0x23, 0x23, 0x23, 0x33, 0x23, 0x22,
+	0x83, 0xc3, 0xc3, 0xc7, 0x88, 0xff, 0xff, 0xff, 0x70,	/* 171 */
+	0xff, 0xff, 0xff, 0xa3, 0xc4, 0xb5, 0xd3, 0xd3, 0x62, 0x53, 0x53, 0x53, 0x43, 0x63, 0x33, 0x73,
+	0x23, 0xc3, 0xc3, 0x23, 0x73, 0x24, 0x63, 0x25, 0x53, 0x26, 0x43, 0x23, 0x13, 0x33, 0x23, 0x23,
+	0x23, 0x29, 0x22, 0x39, 0xd3, 0xd3, 0xff, 0xff, 0xff, 0x70,	/* 172 */
+	0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0x13, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+	0x3f, 0xff, 0xff, 0xc0,	/* 173 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x32, 0x37, 0x32, 0x37, 0x32, 0x37, 0x32, 0x37, 0x32,
+	0x37, 0x32, 0x37, 0x32, 0x38, 0x32, 0x39, 0x32, 0x39, 0x32, 0x39, 0x32, 0x39, 0x32, 0x39, 0x32,
+	0x39, 0x32, 0x3f, 0xff, 0xff, 0xf7,	/* 174 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x23, 0x93, 0x23, 0x93, 0x23, 0x93, 0x23, 0x93, 0x23,
+	0x93, 0x23, 0x93, 0x23, 0x83, 0x23, 0x73, 0x23, 0x73, 0x23, 0x73, 0x23, 0x73, 0x23, 0x73, 0x23,
+	0x73, 0x23, 0xff, 0xff, 0xff, 0xd0,	/* 175 */
+	0xaa, 0xaa, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00,
+	0xaa, 0xaa, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00,
+	0xaa, 0xaa, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00,
+	0xaa, 0xaa, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00,	/* 176 */
+	0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,	/* 177 */
+	0xff, 0xff, 0xaa, 0xaa, 0xff, 0xff, 0xaa, 0xaa, 0xff, 0xff, 0xaa, 0xaa, 0xff, 0xff, 0xaa, 0xaa,
+	0xff, 0xff, 0xaa, 0xaa, 0xff, 0xff, 0xaa, 0xaa, 0xff, 0xff, 0xaa, 0xaa, 0xff, 0xff, 0xaa, 0xaa,
+	0xff, 0xff, 0xaa, 0xaa, 0xff, 0xff, 0xaa, 0xaa, 0xff, 0xff, 0xaa, 0xaa, 0xff, 0xff, 0xaa, 0xaa,
+	0xff, 0xff, 0xaa, 0xaa, 0xff, 0xff, 0xaa, 0xaa, 0xff, 0xff, 0xaa, 0xaa, 0xff, 0xff, 0xaa, 0xaa,	/* 178 */
+	0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xf8,	/* 179 */
+	0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x56, 0xff, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xf9,	/* 180 */
+	0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0xff, 0xc6, 0xfb, 0x6f, 0xfc, 0x6f, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xf6,	/* 181 */
+	0x43, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xfb,	/* 182 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0x64, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xf6,	/* 183 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xff, 0x96, 0xfb, 0x6f, 0xfc, 0x6f, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xf6,	/* 184 */
+	0x43, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0xff, 0xe7, 0xfa, 0x7f, 0xfb, 0x4f, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xf8,	/* 185 */
+	0x43, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xf5,	/* 186 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xff, 0x69, 0xf8, 0x7f, 0xfb, 0x4f, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xf8,	/* 187 */
+	0x43, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0xff, 0xe7, 0xfa, 0x9f, 0xf9, 0xcf, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xf0,	/* 188 */
+	0x43, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x32, 0xff, 0x9c, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xf3,	/* 189 */
+	0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0xff, 0xc6, 0xfb, 0x6f, 0xfc, 0x9f, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xf3,	/* 190 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xf9,	/* 191 */
+	0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xe0,	/* 192 */
+	0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x56, 0x37, 0xff, 0x2f, 0x1f, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xfe,	/* 193 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x1f, 0xf2, 0x63, 0x7f, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xfe,	/* 194 */
+	0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xe0,	/* 195 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xf0,	/* 196 */
+	0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x56, 0x37, 0xff, 0x26, 0x37, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xe0,	/* 197 */
+	0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xb7, 0xfa, 0x7f, 0xfb, 0x7f, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xb0,	/* 198 */
+	0x43, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xe0,	/* 199 */
+	0x43, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xb7, 0xf8, 0x9f, 0xf6, 0xcf, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xb0,	/* 200 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf, 0xf9, 0x9f, 0xa7, 0xff, 0xe4, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xfb,	/* 201 */
+	0x43, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x84, 0xff, 0x27, 0x27, 0xf1, 0xf1, 0xff,
+	0x2f, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,	/* 202 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x1f, 0xf2, 0xf1, 0xf1, 0x72, 0x7f, 0xf2, 0x48, 0x4f,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,	/* 203 */
+	0x43, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xb7, 0xfa, 0x7f, 0xfe, 0x4f, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xb0,	/* 204 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x3f, 0xf2, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xc0,	/* 205 */
+	0x43, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x84, 0xff, 0x27, 0x27, 0xf1, 0x72, 0x7f,
+	0xf2, 0x48, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,	/* 206 */
+	0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0x37, 0xff, 0x2f, 0x1f, 0x1f, 0x1f, 0xf2, 0xf1,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,	/* 207 */
+	0x43, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x32, 0x34, 0xff, 0x2f, 0x1f, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,	/* 208 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x1f, 0xf2, 0xf1, 0xf1, 0xf1, 0xff, 0x26, 0x37, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xfb,	/* 209 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x1f, 0xf2, 0x43, 0x23, 0x4f, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xfe,	/* 210 */
+	0x43, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x34, 0xff, 0x6c, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xe0,	/* 211 */
+	0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xb7, 0xfa, 0x7f, 0xf8, 0xaf, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xb0,	/* 212 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xaf, 0xfb, 0x7f, 0xa7, 0xff, 0xb7, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xfb,	/* 213 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xf9, 0x23, 0x4f, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xfe,	/* 214 */
+	0x43, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x32, 0x34, 0xff, 0x24, 0x32, 0x34,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,	/* 215 */
+	0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0x37, 0xff, 0x26, 0x37, 0xf1, 0x63, 0x7f, 0xf2,
+	0x63, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,	/* 216 */
+	0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x56, 0xff, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xf6,	/* 217 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xaf, 0xfb, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xfe,	/* 218 */
+	0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xf2,	/* 219 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xf1,	/* 220 */
+	0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xf9,	/* 221 */
+	0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xf1,	/* 222 */
+	0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x10,	/* 223 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x81, 0x33, 0x18, 0x15, 0x13, 0x54, 0x15, 0x18, 0x1f,
+	0xff, 0xff, 0xff, 0xd1, 0x81, 0x31, 0x35, 0x41, 0x31, 0x81, 0x78, 0x13, 0xff, 0xff, 0xf6,	/* 224 */
+	0xff, 0xff, 0xff, 0x89, 0x61, 0x91, 0x85, 0x31, 0xc1, 0xff, 0xff, 0x31, 0x21, 0x75, 0xfc, 0x62,
+	0x1d, 0x12, 0x1f, 0xff, 0xff, 0xf2, 0x19, 0x63, 0x1e, 0x17, 0x8f, 0xff, 0xf9, 0x3c,	/* 225 */
+	0xff, 0xff, 0xff, 0x7d, 0xf7, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x3f,
+	0xff, 0xff, 0xf2,	/* 226 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xf7, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x37,
+	0x3f, 0xff, 0xff, 0x70,	/* 227 */
+	0xff, 0xff, 0xff, 0x7d, 0x3d, 0x33, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xd3, 0xc3, 0xc3,
+	0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xdd, 0x3d, 0xff, 0xff, 0xff, 0x80,	/* 228 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc3, 0x1e, 0x13, 0x34, 0x35, 0x13, 0x13, 0x1c, 0x13,
+	0x1c, 0x1f, 0xff, 0xff, 0xe1, 0x51, 0x61, 0x35, 0x31, 0x41, 0x91, 0x69, 0xff, 0xff, 0xf9,	/* 229 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x73, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x1e, 0x1e, 0x1b,
+	0x42, 0x1e, 0x1a, 0x52, 0x3f, 0xff, 0xf7, 0x3c,	/* 230 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xf4, 0x53, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x41, 0xc1,
+	0x33, 0xa1, 0xf1, 0x5f, 0xff, 0xff, 0x80,	/* 231 */
+	0xff, 0xff, 0xff, 0xc3, 0xfb, 0x33, 0x36, 0x19, 0x14, 0x13, 0x13, 0x13, 0x16, 0x15, 0x1f, 0xff,
+	0xff, 0xff, 0xff, 0xf3, 0x15, 0x16, 0x13, 0x13, 0x13, 0x14, 0x19, 0x16, 0x33, 0x3f, 0xb3, 0xff,
+	0xff, 0xfc,	/* 232 */
+	0xff, 0xff, 0xff, 0x99, 0x61, 0x91, 0x41, 0x35, 0x31, 0x61, 0x51, 0xff, 0xff, 0xff, 0x05, 0xfc,
+	0x5f, 0xff, 0xff, 0xf0, 0x15, 0x16, 0x13, 0x53, 0x14, 0x19, 0x16, 0x9f, 0xff, 0xff, 0x90,	/* 233 */
+	0xff, 0xff, 0xff, 0x99, 0x61, 0x91, 0x41, 0x35, 0x31, 0x61, 0x51, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xf1, 0x12, 0x15, 0x12, 0x14, 0x12, 0x13, 0x12, 0x1f, 0xf6, 0x29, 0x2f, 0x45, 0x35, 0xff, 0xff,
+	0xf7,	/* 234 */
+	0xff, 0xff, 0xff, 0x99, 0x79, 0x83, 0xe3, 0xe3, 0xe3, 0xa7, 0x89, 0x63, 0x53, 0x43, 0x73, 0x33,
+	0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x34, 0x54, 0x4b,
+	0x69, 0xff, 0xff, 0xff, 0xa0,	/* 235 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x51, 0x54, 0x15, 0x15, 0x12, 0x12, 0x25, 0x22, 0x16, 0x13,
+	0x1f, 0xff, 0xe1, 0x31, 0x61, 0x22, 0x52, 0x21, 0x21, 0x51, 0x51, 0x45, 0x15, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xd0,	/* 236 */
+	0xff, 0xff, 0xff, 0xf2, 0x3f, 0xd1, 0x21, 0xf7, 0x62, 0x16, 0x18, 0x15, 0x12, 0x35, 0x1f, 0xa1,
+	0x21, 0xfc, 0x12, 0x1f, 0xc1, 0x21, 0xfa, 0x15, 0x32, 0x15, 0x18, 0x16, 0x12, 0x6f, 0x71, 0x21,
+	0xfd, 0x3f, 0xff, 0xff, 0xf1,	/* 237 */
+	0xff, 0xff, 0xff, 0xff, 0xfe, 0x95, 0xb4, 0x4c, 0x3c, 0x3d, 0x3d, 0xd3, 0xd3, 0x3d, 0x3e, 0x3d,
+	0x4d, 0xb7, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xb0,	/* 238 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x59, 0x25, 0x26, 0x13, 0x33, 0x18, 0x13, 0x17, 0x12, 0x15,
+	0x12, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x73, 0xff, 0xff, 0xf7,	/* 239 */
+	0xff, 0xff, 0xff, 0xff, 0xfa, 0xd3, 0xdf, 0xff, 0xf7, 0xd3, 0xdf, 0xff, 0xf7, 0xd3, 0xdf, 0xff,
+	0xff, 0xff, 0xff, 0xb0,	/* 240 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0xfc, 0x53, 0x5f, 0x45, 0x35, 0xff, 0xff, 0xc3,
+	0xf9, 0xdf, 0x4d, 0xff, 0xff, 0xf7,	/* 241 */
+	0xff, 0xff, 0xff, 0x93, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xd3, 0xc3, 0xc3, 0xc3, 0xc3,
+	0xc3, 0xc3, 0xc3, 0xff, 0xec, 0x4c, 0xff, 0xff, 0xff, 0x80,	/* 242 */
+	0xff, 0xff, 0xff, 0xf1, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3d, 0x3e, 0x3e, 0x3e, 0x3e,
+	0x3e, 0x3e, 0x3e, 0x3f, 0xf7, 0xc4, 0xcf, 0xff, 0xff, 0xf8,	/* 243 */
+	0xff, 0xff, 0xff, 0xd6, 0x91, 0x61, 0xb2, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x80,	/* 244 */
+	0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0x22, 0xb1,
+	0x61, 0x96, 0xff, 0xff, 0xfd,	/* 245 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0x13, 0xf9, 0xdf, 0x4d, 0xf9, 0x3f, 0xff, 0xf1,
+	0x3f, 0xff, 0xff, 0xff, 0xff, 0x00,	/* 246 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x54, 0x33, 0x81, 0x43, 0x41, 0x83, 0x34, 0x5f, 0xf7, 0x54,
+	0x33, 0x81, 0x43, 0x41, 0x83, 0x34, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,	/* 247 */
+	0xff, 0xff, 0x87, 0x81, 0x71, 0xa3, 0xff, 0xff, 0x13, 0xa1, 0x71, 0x87, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,	/* 248 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0xb6, 0xa6, 0xa6, 0xa6, 0xb4, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x40,	/* 249 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x3f, 0xff, 0xf1, 0x3f, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xf5,	/* 250 */
+	0xff, 0xfd, 0x5f, 0xf0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xf3, 0x1c, 0x13, 0x1c, 0x13,
+	0x1c, 0x13, 0x1c, 0x13, 0x1c, 0x13, 0x1c, 0x1f, 0x11, 0xf1, 0x5f, 0xff, 0xff, 0x80,	/* 251 */
+	0xff, 0xff, 0x78, 0xf1, 0x1a, 0x42, 0x1f, 0xff, 0xff, 0xff, 0xd3, 0x43, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x50,	/* 252 */
+	0xff, 0xf7, 0x78, 0x97, 0x33, 0x37, 0x33, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x97, 0x9f, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,	/* 253 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff,
+	0xff, 0xfc,	/* 254 */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x20,	/* 255 */
+#endif // CONFIG_LCD_FONT_EXTENDED_ASCII
+};
+
+/// 低15位为偏移，最高位为1表示按行异或后编码
+LCD_FONT_OFFSETS_DEFINE(ter_ascii_16x32_rle)
+{
+	0x8000,	/* 0 */
+	0x8013,	/* 1 */
+	0x8035,	/* 2 */
+	0x0054,	/* 3 */
+	0x0072,	/* 4 */
+	0x008c,	/* 5 */
+	0x00ad,	/* 6 */
+	0x00ce,	/* 7 */
+	0x00e4,	/* 8 */
+	0x00fa,	/* 9 */
+	0x0114,	/* 10 */
+	0x012e,	/* 11 */
+	0x8155,	/* 12 */
+	0x8176,	/* 13 */
+	0x818b,	/* 14 */
+	0x01a3,	/* 15 */
+	0x01cb,	/* 16 */
+	0x01e4,	/* 17 */
+	0x01fd,	/* 18 */
+	0x8224,	/* 19 */
+	0x823b,	/* 20 */
+	0x0256,	/* 21 */
+	0x827d,	/* 22 */
+	0x028f,	/* 23 */
+	0x02b6,	/* 24 */
+	0x02d7,	/* 25 */
+	0x02f8,	/* 26 */
+	0x0310,	/* 27 */
+	0x8328,	/* 28 */
+	0x033b,	/* 29 */
+	0x035c,	/* 30 */
+	0x0375,	/* 31 */
+	0x038e,	/* 32 */
+	0x83a0,	/* 33 */
+	0x83b4,	/* 34 */
+	0x83c8,	/* 35 */
+	0x83e6,	/* 36 */
+	0x0411,	/* 37 */
+	0x043a,	/* 38 */
+	0x8466,	/* 39 */
+	0x0479,	/* 40 */
+	0x0494,	/* 41 */
+	0x04af,	/* 42 */
+	0x84cc,	/* 43 */
+	0x04e2,	/* 44 */
+	0x04f6,	/* 45 */
+	0x0509,	/* 46 */
+	0x051c,	/* 47 */
+	0x8538,	/* 48 */
+	0x855f,	/* 49 */
+	0x0575,	/* 50 */
+	0x0595,	/* 51 */
+	0x85b6,	/* 52 */
+	0x85d6,	/* 53 */
+	0x85f1,	/* 54 */
+	0x860f,	/* 55 */
+	0x862b,	/* 56 */
+	0x8650,	/* 57 */
+	0x866e,	/* 58 */
+	0x0683,	/* 59 */
+	0x069a,	/* 60 */
+	0x06b5,	/* 61 */
+	0x06c8,	/* 62 */
+	0x06e3,	/* 63 */
+	0x8702,	/* 64 */
+	0x8726,	/* 65 */
+	0x8740,	/* 66 */
+	0x875e,	/* 67 */
+	0x877d,	/* 68 */
+	0x8798,	/* 69 */
+	0x87ac,	/* 70 */
+	0x87c0,	/* 71 */
+	0x87df,	/* 72 */
+	0x87f4,	/* 73 */
+	0x8809,	/* 74 */
+	0x0823,	/* 75 */
+	0x884e,	/* 76 */
+	0x8861,	/* 77 */
+	0x8880,	/* 78 */
+	0x889f,	/* 79 */
+	0x88bc,	/* 80 */
+	0x88d5,	/* 81 */
+	0x88f7,	/* 82 */
+	0x091b,	/* 83 */
+	0x893c,	/* 84 */
+	0x8950,	/* 85 */
+	0x8969,	/* 86 */
+	0x8989,	/* 87 */
+	0x09a8,	/* 88 */
+	0x89d3,	/* 89 */
+	0x09f5,	/* 90 */
+	0x8a10,	/* 91 */
+	0x0a23,	/* 92 */
+	0x8a3e,	/* 93 */
+	0x0a51,	/* 94 */
+	0x0a69,	/* 95 */
+	0x0a7b,	/* 96 */
+	0x8a8f,	/* 97 */
+	0x8aaa,	/* 98 */
+	0x0ac3,	/* 99 */
+	0x8adf,	/* 100 */
+	0x0af8,	/* 101 */
+	0x8b15,	/* 102 */
+	0x8b2d,	/* 103 */
+	0x8b49,	/* 104 */
+	0x8b60,	/* 105 */
+	0x8b76,	/* 106 */
+	0x8b91,	/* 107 */
+	0x8bb7,	/* 108 */
+	0x8bcb,	/* 109 */
+	0x8be3,	/* 110 */
+	0x8bf9,	/* 111 */
+	0x8c17,	/* 112 */
+	0x8c2f,	/* 113 */
+	0x8c48,	/* 114 */
+	0x0c5f,	/* 115 */
+	0x8c79,	/* 116 */
+	0x8c91,	/* 117 */
+	0x8ca7,	/* 118 */
+	0x8cc7,	/* 119 */
+	0x0ce1,	/* 120 */
+	0x8d05,	/* 121 */
+	0x0d1f,	/* 122 */
+	0x0d37,	/* 123 */
+	0x8d52,	/* 124 */
+	0x0d65,	/* 125 */
+	0x0d80,	/* 126 */
+	0x0d9c,	/* 127 */
+#if CONFIG_LCD_FONT_EXTENDED_ASCII
+	0x0dc1,	/* 128 */
+	0x8de4,	/* 129 */
+	0x0dfd,	/* 130 */
+	0x0e1c,	/* 131 */
+	0x8e3d,	/* 132 */
+	0x0e5b,	/* 133 */
+	0x8e7a,	/* 134 */
+	0x0e9b,	/* 135 */
+	0x0eba,	/* 136 */
+	0x8edb,	/* 137 */
+	0x0efb,	/* 138 */
+	0x8f1a,	/* 139 */
+	0x0f31,	/* 140 */
+	0x0f4d,	/* 141 */
+	0x8f67,	/* 142 */
+	0x8f84,	/* 143 */
+	0x8fa4,	/* 144 */
+	0x0fbe,	/* 145 */
+	0x8fe2,	/* 146 */
+	0x0ffd,	/* 147 */
+	0x9023,	/* 148 */
+	0x9043,	/* 149 */
+	0x9066,	/* 150 */
+	0x9086,	/* 151 */
+	0x90a2,	/* 152 */
+	0x90bf,	/* 153 */
+	0x90df,	/* 154 */
+	0x90fb,	/* 155 */
+	0x911f,	/* 156 */
+	0x113d,	/* 157 */
+	0x9160,	/* 158 */
+	0x917e,	/* 159 */
+	0x1199,	/* 160 */
+	0x11b8,	/* 161 */
+	0x91d2,	/* 162 */
+	0x91f5,	/* 163 */
+	0x9211,	/* 164 */
+	0x922f,	/* 165 */
+	0x1256,	/* 166 */
+	0x9271,	/* 167 */
+	0x128c,	/* 168 */
+	0x92ab,	/* 169 */
+	0x92be,	/* 170 */
+	0x12d1,	/* 171 */
+	0x12fa,	/* 172 */
+	0x9324,	/* 173 */
+	0x1338,	/* 174 */
+	0x135e,	/* 175 */
+	0x1384,	/* 176 */
+	0x93c4,	/* 177 */
+	0x13de,	/* 178 */
+	0x941e,	/* 179 */
+	0x9430,	/* 180 */
+	0x9443,	/* 181 */
+	0x9457,	/* 182 */
+	0x946b,	/* 183 */
+	0x947e,	/* 184 */
+	0x9491,	/* 185 */
+	0x94a6,	/* 186 */
+	0x94b9,	/* 187 */
+	0x94cc,	/* 188 */
+	0x94e1,	/* 189 */
+	0x94f6,	/* 190 */
+	0x950a,	/* 191 */
+	0x951c,	/* 192 */
+	0x952f,	/* 193 */
+	0x9543,	/* 194 */
+	0x9556,	/* 195 */
+	0x1569,	/* 196 */
+	0x957b,	/* 197 */
+	0x9590,	/* 198 */
+	0x95a4,	/* 199 */
+	0x95b8,	/* 200 */
+	0x95cd,	/* 201 */
+	0x95e0,	/* 202 */
+	0x95f8,	/* 203 */
+	0x960e,	/* 204 */
+	0x1623,	/* 205 */
+	0x9636,	/* 206 */
+	0x964f,	/* 207 */
+	0x9665,	/* 208 */
+	0x967b,	/* 209 */
+	0x9690,	/* 210 */
+	0x96a4,	/* 211 */
+	0x96b9,	/* 212 */
+	0x96cd,	/* 213 */
+	0x96e0,	/* 214 */
+	0x96f3,	/* 215 */
+	0x970b,	/* 216 */
+	0x9723,	/* 217 */
+	0x9736,	/* 218 */
+	0x1748,	/* 219 */
+	0x175a,	/* 220 */
+	0x976c,	/* 221 */
+	0x977e,	/* 222 */
+	0x1790,	/* 223 */
+	0x97a3,	/* 224 */
+	0x97c2,	/* 225 */
+	0x97e0,	/* 226 */
+	0x97f3,	/* 227 */
+	0x1807,	/* 228 */
+	0x9822,	/* 229 */
+	0x9841,	/* 230 */
+	0x9859,	/* 231 */
+	0x9870,	/* 232 */
+	0x9892,	/* 233 */
+	0x98b1,	/* 234 */
+	0x18d2,	/* 235 */
+	0x98f7,	/* 236 */
+	0x991a,	/* 237 */
+	0x193f,	/* 238 */
+	0x9957,	/* 239 */
+	0x1973,	/* 240 */
+	0x9987,	/* 241 */
+	0x199d,	/* 242 */
+	0x19b7,	/* 243 */
+	0x99d1,	/* 244 */
+	0x99e6,	/* 245 */
+	0x99fb,	/* 246 */
+	0x1a11,	/* 247 */
+	0x9a2e,	/* 248 */
+	0x1a45,	/* 249 */
+	0x9a5a,	/* 250 */
+	0x9a6d,	/* 251 */
+	0x9a8b,	/* 252 */
+	0x1aa1,	/* 253 */
+	0x9aba,	/* 254 */
+	0x1acc,	/* 255 */
+#endif // CONFIG_LCD_FONT_EXTENDED_ASCII
+};
+
+
+LCD_RLE_FONT_DEFINE(ter_ascii_16x32_rle, 16, 32, 0);
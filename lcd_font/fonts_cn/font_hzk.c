@@ -9,9 +9,19 @@
  * @note 实现逻辑，每个汉字库分区对应一种字体，所以需要根据字体大小和编码大小来计算数据偏移量
  * 汉字库的名称是 hzk16， 对应数据就存在hzk16的分区中，这个分区的header格式为hzk_header_t。
  * 所以需要先读取hzk_header_t，然后根据font_data_offset和font_data_size来读取数据。
+ * 字体数据默认通过 esp_partition_mmap 映射，获取字形直接返回映射后的Flash地址，不加锁也不复制；
+ * 映射失败或关闭 CONFIG_LCD_FONT_HZK_USE_MMAP 时从分区读取，每个字体有一个 CONFIG_LCD_FONT_HZK_CACHE_SIZE 项的
+ * LRU字形缓存，重绘相同的汉字不需要读Flash。
+ * 分区支持两种格式：HZK1按GB2312的94x94编码区排列，先将Unicode转换为GB2312再计算偏移量；
+ * HZK2只保存编码表中的字符，按Unicode排序，用分区中的Unicode索引直接得到字符序号，分区约为HZK1的一半。
+ * 加载时只校验头部和索引的CRC32，字体数据的CRC32由低优先级任务分块校验（CONFIG_LCD_FONT_HZK_VERIFY），
+ * 不影响启动时间，校验完成后发送 LCD_FONT_EVENTS 事件。
  */
 
 #include "lcd_font_type.h"
+#include "lcd_fonts.h"
+#include "lcd_font_event.h"
+#include "app_event_loop.h"
 #include "hzk_header.h"
 #include "gb2312_encode.h"
 #include "esp_log.h"
@@ -20,6 +30,7 @@
 #include "esp_err.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
+#include "freertos/task.h"
 #include <string.h>
 #include <stdlib.h>
 
@@ -33,33 +44,86 @@ static const char *TAG = "font_hzk";
 #endif // CONFIG_GB2312_ENCODE_HZ3500
 
 
+#if CONFIG_LCD_FONT_HZK_CACHE_SIZE < 1 || CONFIG_LCD_FONT_HZK_CACHE_SIZE > 0xFFFE
+#error "CONFIG_LCD_FONT_HZK_CACHE_SIZE must be in 1..65534"
+#endif
+
+/// LRU链表的空索引
+#define HZK_CACHE_NONE 0xFFFF
+
+#if CONFIG_LCD_FONT_HZK_PREFETCH_BATCH < 1
+#error "CONFIG_LCD_FONT_HZK_PREFETCH_BATCH must be at least 1"
+#endif
+
+/// 预取时每批的字符数，不超过缓存项数，同一批的字符不会互相替换
+#define HZK_PREFETCH_BATCH \
+    (CONFIG_LCD_FONT_HZK_PREFETCH_BATCH < CONFIG_LCD_FONT_HZK_CACHE_SIZE ? CONFIG_LCD_FONT_HZK_PREFETCH_BATCH : CONFIG_LCD_FONT_HZK_CACHE_SIZE)
+
+/// 预取缓冲区大小，至少能放下一个字符
+#define HZK_PREFETCH_BUF_SIZE(_font) \
+    (CONFIG_LCD_FONT_HZK_PREFETCH_BUF_SIZE > (_font)->code_size ? CONFIG_LCD_FONT_HZK_PREFETCH_BUF_SIZE : (_font)->code_size)
+
 // 创建一个字体管理对象，在初始时从HZK分区中读取HEADER信息，并校验数据的有效性
-// 提供一个数据缓存，字库获取数据的返回值，并引入RTOS的锁，保证数据访问的线程安全
+// 提供一个LRU字形缓存，每项的数据地址固定，并引入RTOS的锁，保证数据访问的线程安全
 typedef struct {
     const char *name;
     bool valid;
-    uint8_t *data_cache;
     SemaphoreHandle_t mutex;
     const esp_partition_t *partition;
     uint32_t data_offset;
     uint32_t font_data_size;
     uint32_t font_code_size;
+    // HZK2的Unicode索引，page_index为NULL表示HZK1，需要先转换为GB2312
+    const uint8_t *page_index;
+    const uint32_t *block_bits;
+    const uint16_t *block_base;
+    uint8_t *index_buf; // 没有映射时从分区读取的索引
+    uint32_t char_count;
+    // 映射后的分区地址（从分区起始位置映射），NULL表示使用分区读取和字形缓存
+    const uint8_t *mapped;
+    esp_partition_mmap_handle_t mmap_handle;
+    // LRU字形缓存，cache_data 中每项 font_code_size 字节
+    uint8_t *cache_data;
+    uint32_t cache_codes[CONFIG_LCD_FONT_HZK_CACHE_SIZE]; // 每项缓存的Unicode编码，0为空
+    uint16_t cache_prev[CONFIG_LCD_FONT_HZK_CACHE_SIZE];
+    uint16_t cache_next[CONFIG_LCD_FONT_HZK_CACHE_SIZE];
+    uint16_t cache_head; // 最近使用的项
+    uint16_t cache_tail; // 最久未使用的项，缓存满时被替换
+    uint16_t cache_used;
+    uint32_t cache_hits;
+    uint32_t cache_misses;
+    uint32_t flash_reads;
+    // 预取时合并读取的缓冲区
+    uint8_t *prefetch_buf;
+    // 后台校验字体数据，由校验任务更新，加锁读取
+    uint32_t data_checksum; // 头部中的字体数据CRC32
+    lcd_font_hzk_verify_state_t verify_state;
+    uint32_t verify_offset; // 已校验的字节数
+    uint32_t verify_crc;
 }hzk_font_manager_t;
 
+/// 预取时待读取的字符
+typedef struct {
+    uint32_t offset;
+    uint32_t code;
+}hzk_prefetch_item_t;
+
 // 声明函数
 static bool load_and_check(const lcd_font_t *font, hzk_font_manager_t *manager);
 const uint8_t *lcd_font_get_hzk_code(const void *self, uint32_t ch);
+const uint8_t *lcd_font_get_hzk_code_r(const void *self, uint32_t ch, uint8_t *buf);
+void lcd_font_prefetch_hzk(const void *self, const uint32_t *chars, int count);
 
 #if CONFIG_LCD_FONT_HZK_16
 
 static hzk_font_manager_t s_hzk16_manager = { 0 };
-LCD_FONT_DEFINE_NO_DATA(hzk16, 16, 16, lcd_font_get_hzk_code);
+LCD_FONT_DEFINE_NO_DATA_WITH_PREFETCH(hzk16, 16, 16, lcd_font_get_hzk_code, lcd_font_get_hzk_code_r, lcd_font_prefetch_hzk);
 #endif // CONFIG_LCD_FONT_HZK_16
 
 #if CONFIG_LCD_FONT_HZK_24
 
 static hzk_font_manager_t s_hzk24_manager = { 0 };
-LCD_FONT_DEFINE_NO_DATA(hzk24, 24, 24, lcd_font_get_hzk_code);
+LCD_FONT_DEFINE_NO_DATA_WITH_PREFETCH(hzk24, 24, 24, lcd_font_get_hzk_code, lcd_font_get_hzk_code_r, lcd_font_prefetch_hzk);
 #endif // CONFIG_LCD_FONT_HZK_24
 
 /**
@@ -74,6 +138,293 @@ static uint32_t calculate_crc32(const uint8_t *data, size_t len)
     return esp_crc32_le(0, data, len);
 }
 
+/**
+ * @brief 初始化LRU字形缓存，所有项为空，按索引顺序链接
+ * 
+ * @param manager 字体管理对象
+ */
+static void cache_reset(hzk_font_manager_t *manager)
+{
+    for (uint16_t i = 0; i < CONFIG_LCD_FONT_HZK_CACHE_SIZE; i++) {
+        manager->cache_codes[i] = 0;
+        manager->cache_prev[i] = (i == 0) ? HZK_CACHE_NONE : i - 1;
+        manager->cache_next[i] = (i == CONFIG_LCD_FONT_HZK_CACHE_SIZE - 1) ? HZK_CACHE_NONE : i + 1;
+    }
+    manager->cache_head = 0;
+    manager->cache_tail = CONFIG_LCD_FONT_HZK_CACHE_SIZE - 1;
+    manager->cache_used = 0;
+    manager->cache_hits = 0;
+    manager->cache_misses = 0;
+    manager->flash_reads = 0;
+}
+
+/**
+ * @brief 将缓存项移动到LRU链表头部（最近使用）
+ * 
+ * @param manager 字体管理对象
+ * @param index 缓存项索引
+ */
+static void cache_touch(hzk_font_manager_t *manager, uint16_t index)
+{
+    if (manager->cache_head == index) {
+        return;
+    }
+
+    // 从链表中移除
+    uint16_t prev = manager->cache_prev[index];
+    uint16_t next = manager->cache_next[index];
+    manager->cache_next[prev] = next;
+    if (next != HZK_CACHE_NONE) {
+        manager->cache_prev[next] = prev;
+    } else {
+        manager->cache_tail = prev;
+    }
+
+    // 插入到头部
+    manager->cache_prev[index] = HZK_CACHE_NONE;
+    manager->cache_next[index] = manager->cache_head;
+    manager->cache_prev[manager->cache_head] = index;
+    manager->cache_head = index;
+}
+
+/**
+ * @brief 在缓存中查找字符
+ * 
+ * @param manager 字体管理对象
+ * @param code Unicode编码
+ * @return uint16_t 缓存项索引，未找到返回HZK_CACHE_NONE
+ */
+static uint16_t cache_find(const hzk_font_manager_t *manager, uint32_t code)
+{
+    // 按最近使用的顺序查找，重绘的页面中相同的汉字通常就在链表前部
+    for (uint16_t i = manager->cache_head; i != HZK_CACHE_NONE; i = manager->cache_next[i]) {
+        if (manager->cache_codes[i] == code) {
+            return i;
+        }
+        if (manager->cache_codes[i] == 0) {
+            break; // 空项都在链表尾部
+        }
+    }
+
+    return HZK_CACHE_NONE;
+}
+
+/**
+ * @brief 释放加载过程中映射的分区和分配的内存
+ * 
+ * @param manager 字体管理对象
+ */
+static void release_manager(hzk_font_manager_t *manager)
+{
+    if (manager->mapped) {
+        esp_partition_munmap(manager->mmap_handle);
+        manager->mapped = NULL;
+    }
+    free(manager->index_buf);
+    free(manager->cache_data);
+    free(manager->prefetch_buf);
+    manager->index_buf = NULL;
+    manager->cache_data = NULL;
+    manager->prefetch_buf = NULL;
+    manager->page_index = NULL;
+    manager->block_bits = NULL;
+    manager->block_base = NULL;
+}
+
+/**
+ * @brief 校验HZK2头部中的索引信息
+ * 
+ * @param header 头部信息
+ * @param partition 字库分区
+ * @param name 字体名称
+ * @return bool 索引信息有效返回true
+ */
+static bool check_index_header(const hzk_header_t *header, const esp_partition_t *partition, const char *name)
+{
+    uint32_t blocks = header->page_count * HZK_INDEX_BLOCKS_PER_PAGE;
+    uint32_t expected_index_size = 256 + blocks * (sizeof(uint32_t) + sizeof(uint16_t));
+
+    if (header->page_count == 0 || header->page_count >= 0xFF || header->index_size != expected_index_size) {
+        ESP_LOGE(TAG, "Invalid index in partition '%s': %u pages, %u bytes", name, header->page_count, header->index_size);
+        return false;
+    }
+
+    if ((header->index_offset % sizeof(uint32_t)) != 0 || header->index_offset + header->index_size > partition->size) {
+        ESP_LOGE(TAG, "Index offset out of range in partition '%s': 0x%08X", name, header->index_offset);
+        return false;
+    }
+
+    if (header->char_count == 0 || header->char_count > 0xFFFF
+        || header->char_count * header->font_code_size != header->font_data_size) {
+        ESP_LOGE(TAG, "Character count mismatch in partition '%s': %u characters, %u bytes", 
+                 name, header->char_count, header->font_data_size);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief 加载HZK2的Unicode索引，已映射时直接指向映射地址，否则读取到堆中
+ * 
+ * @param manager 字体管理对象
+ * @param header 头部信息
+ * @param partition 字库分区
+ * @param name 字体名称
+ * @return bool 是否成功
+ */
+static bool load_index(hzk_font_manager_t *manager, const hzk_header_t *header, const esp_partition_t *partition, const char *name)
+{
+    const uint8_t *index;
+
+    if (manager->mapped) {
+        index = manager->mapped + header->index_offset;
+    } else {
+        manager->index_buf = malloc(header->index_size);
+        if (manager->index_buf == NULL) {
+            ESP_LOGE(TAG, "Failed to allocate %u bytes for index in '%s'", header->index_size, name);
+            return false;
+        }
+
+        esp_err_t ret = esp_partition_read(partition, header->index_offset, manager->index_buf, header->index_size);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to read index from partition '%s': %s", name, esp_err_to_name(ret));
+            return false;
+        }
+        index = manager->index_buf;
+    }
+
+    uint32_t calculated_index_crc = calculate_crc32(index, header->index_size);
+    if (calculated_index_crc != header->index_checksum) {
+        ESP_LOGE(TAG, "Index checksum mismatch in partition '%s': stored=0x%08X, calculated=0x%08X", 
+                 name, header->index_checksum, calculated_index_crc);
+        return false;
+    }
+
+    uint32_t blocks = header->page_count * HZK_INDEX_BLOCKS_PER_PAGE;
+    manager->page_index = index;
+    manager->block_bits = (const uint32_t *)(index + 256);
+    manager->block_base = (const uint16_t *)(index + 256 + blocks * sizeof(uint32_t));
+    manager->char_count = header->char_count;
+    return true;
+}
+
+#if CONFIG_LCD_FONT_HZK_VERIFY
+/**
+ * @brief 发送校验结果事件
+ * 
+ * @param manager 字体管理对象
+ */
+static void post_verify_event(const hzk_font_manager_t *manager)
+{
+    lcd_font_hzk_verify_event_data_t event_data = {
+        .font_name = manager->name,
+        .state = manager->verify_state,
+        .expected = manager->data_checksum,
+        .calculated = manager->verify_crc,
+    };
+
+    lcd_font_event_t event = (manager->verify_state == LCD_FONT_HZK_VERIFY_OK) 
+        ? LCD_FONT_EVENT_HZK_VERIFIED : LCD_FONT_EVENT_HZK_VERIFY_FAILED;
+    app_event_post(LCD_FONT_EVENTS, event, &event_data, sizeof(event_data), pdMS_TO_TICKS(100));
+}
+
+/**
+ * @brief 后台校验任务，分块计算字体数据的CRC32
+ * 
+ * 已映射时直接对映射地址计算，否则每块读取到临时缓冲区。每块之间延时 CONFIG_LCD_FONT_HZK_VERIFY_INTERVAL_MS，
+ * 不占用显示任务的CPU和Flash带宽。校验不通过时字体仍然可用，由应用处理 LCD_FONT_EVENT_HZK_VERIFY_FAILED 事件。
+ * 
+ * @param arg 字体管理对象
+ */
+static void verify_task(void *arg)
+{
+    hzk_font_manager_t *manager = (hzk_font_manager_t *)arg;
+    lcd_font_hzk_verify_state_t state = LCD_FONT_HZK_VERIFY_OK;
+    uint8_t *buf = NULL;
+    uint32_t crc = 0;
+    uint32_t offset = 0;
+
+    if (manager->mapped == NULL) {
+        buf = malloc(CONFIG_LCD_FONT_HZK_VERIFY_CHUNK_SIZE);
+        if (buf == NULL) {
+            ESP_LOGE(TAG, "Failed to allocate verify buffer for '%s'", manager->name);
+            state = LCD_FONT_HZK_VERIFY_ERROR;
+        }
+    }
+
+    while (state == LCD_FONT_HZK_VERIFY_OK && offset < manager->font_data_size) {
+        uint32_t size = manager->font_data_size - offset;
+        if (size > CONFIG_LCD_FONT_HZK_VERIFY_CHUNK_SIZE) {
+            size = CONFIG_LCD_FONT_HZK_VERIFY_CHUNK_SIZE;
+        }
+
+        const uint8_t *data;
+        if (manager->mapped) {
+            data = manager->mapped + manager->data_offset + offset;
+        } else {
+            esp_err_t ret = esp_partition_read(manager->partition, manager->data_offset + offset, buf, size);
+            if (ret != ESP_OK) {
+                ESP_LOGE(TAG, "Failed to read '%s' at 0x%08X for verify: %s", 
+                         manager->name, manager->data_offset + offset, esp_err_to_name(ret));
+                state = LCD_FONT_HZK_VERIFY_ERROR;
+                break;
+            }
+            data = buf;
+        }
+
+        crc = esp_crc32_le(crc, data, size);
+        offset += size;
+
+        xSemaphoreTake(manager->mutex, portMAX_DELAY);
+        manager->verify_offset = offset;
+        xSemaphoreGive(manager->mutex);
+
+        vTaskDelay(pdMS_TO_TICKS(CONFIG_LCD_FONT_HZK_VERIFY_INTERVAL_MS));
+    }
+
+    if (state == LCD_FONT_HZK_VERIFY_OK && crc != manager->data_checksum) {
+        state = LCD_FONT_HZK_VERIFY_MISMATCH;
+    }
+
+    xSemaphoreTake(manager->mutex, portMAX_DELAY);
+    manager->verify_crc = crc;
+    manager->verify_state = state;
+    xSemaphoreGive(manager->mutex);
+
+    if (state == LCD_FONT_HZK_VERIFY_OK) {
+        ESP_LOGI(TAG, "HZK font '%s' data verified: %u bytes, crc=0x%08X", manager->name, offset, crc);
+    } else if (state == LCD_FONT_HZK_VERIFY_MISMATCH) {
+        ESP_LOGE(TAG, "Data checksum mismatch in partition '%s': stored=0x%08X, calculated=0x%08X", 
+                 manager->name, manager->data_checksum, crc);
+    }
+
+    post_verify_event(manager);
+    free(buf);
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief 启动后台校验任务
+ * 
+ * @param manager 字体管理对象，已加载
+ */
+static void start_verify(hzk_font_manager_t *manager)
+{
+    manager->verify_state = LCD_FONT_HZK_VERIFY_RUNNING;
+    manager->verify_offset = 0;
+    manager->verify_crc = 0;
+
+    BaseType_t ret = xTaskCreate(verify_task, "hzk_verify", CONFIG_LCD_FONT_HZK_VERIFY_TASK_STACK_SIZE, 
+                                 manager, CONFIG_LCD_FONT_HZK_VERIFY_TASK_PRIORITY, NULL);
+    if (ret != pdPASS) {
+        ESP_LOGW(TAG, "Failed to create verify task for '%s'", manager->name);
+        manager->verify_state = LCD_FONT_HZK_VERIFY_NONE;
+    }
+}
+
+#endif // CONFIG_LCD_FONT_HZK_VERIFY
+
 /**
  * @brief 从分区加载并校验汉字库
  * 
@@ -108,7 +459,7 @@ static bool load_and_check(const lcd_font_t *font, hzk_font_manager_t *manager)
     }
     
     // 验证魔数
-    if (header.magic != 0x314B5A48) { // "HZK1"
+    if (header.magic != HZK_MAGIC_V1 && header.magic != HZK_MAGIC_V2) {
         ESP_LOGE(TAG, "Invalid magic number in partition '%s': 0x%08X", font->name, header.magic);
         return false;
     }
@@ -140,11 +491,50 @@ static bool load_and_check(const lcd_font_t *font, hzk_font_manager_t *manager)
     if (header.font_data_size % header.font_code_size != 0) {
         ESP_LOGW(TAG, "Font data size not aligned to code size in partition '%s'", font->name);
     }
+
+    // 映射范围包括字体数据和HZK2的索引
+    uint32_t map_size = header.font_data_offset + header.font_data_size;
+    if (header.magic == HZK_MAGIC_V2) {
+        if (!check_index_header(&header, partition, font->name)) {
+            return false;
+        }
+        if (header.index_offset + header.index_size > map_size) {
+            map_size = header.index_offset + header.index_size;
+        }
+    }
     
-    // 分配数据缓存
-    manager->data_cache = malloc(font->code_size);
-    if (manager->data_cache == NULL) {
-        ESP_LOGE(TAG, "Failed to allocate memory for data cache in '%s'", font->name);
+    // 映射字体数据，之后获取字形直接返回Flash地址
+    manager->mapped = NULL;
+    manager->page_index = NULL;
+    manager->index_buf = NULL;
+    manager->char_count = 0;
+#if CONFIG_LCD_FONT_HZK_USE_MMAP
+    const void *base = NULL;
+    ret = esp_partition_mmap(partition, 0, map_size,
+                             ESP_PARTITION_MMAP_DATA, &base, &manager->mmap_handle);
+    if (ret == ESP_OK) {
+        manager->mapped = (const uint8_t *)base;
+    } else {
+        ESP_LOGW(TAG, "Failed to mmap partition '%s': %s, use partition read", font->name, esp_err_to_name(ret));
+    }
+#endif
+
+    // 没有映射时分配字形缓存和预取缓冲区
+    manager->cache_data = NULL;
+    manager->prefetch_buf = NULL;
+    if (manager->mapped == NULL) {
+        manager->cache_data = malloc(font->code_size * CONFIG_LCD_FONT_HZK_CACHE_SIZE);
+        manager->prefetch_buf = malloc(HZK_PREFETCH_BUF_SIZE(font));
+        if (manager->cache_data == NULL || manager->prefetch_buf == NULL) {
+            ESP_LOGE(TAG, "Failed to allocate memory for glyph cache in '%s'", font->name);
+            release_manager(manager);
+            return false;
+        }
+    }
+    cache_reset(manager);
+
+    if (header.magic == HZK_MAGIC_V2 && !load_index(manager, &header, partition, font->name)) {
+        release_manager(manager);
         return false;
     }
     
@@ -152,8 +542,7 @@ static bool load_and_check(const lcd_font_t *font, hzk_font_manager_t *manager)
     manager->mutex = xSemaphoreCreateMutex();
     if (manager->mutex == NULL) {
         ESP_LOGE(TAG, "Failed to create mutex for '%s'", font->name);
-        free(manager->data_cache);
-        manager->data_cache = NULL;
+        release_manager(manager);
         return false;
     }
     
@@ -163,11 +552,18 @@ static bool load_and_check(const lcd_font_t *font, hzk_font_manager_t *manager)
     manager->data_offset = header.font_data_offset;
     manager->font_data_size = header.font_data_size;
     manager->font_code_size = header.font_code_size;
+    manager->data_checksum = header.font_data_checksum;
+    manager->verify_state = LCD_FONT_HZK_VERIFY_NONE;
     manager->valid = true;
     
     uint32_t char_count = header.font_data_size / header.font_code_size;
-    ESP_LOGI(TAG, "HZK font '%s' loaded successfully: %dx%d, %u characters, %u bytes", 
-             font->name, header.font_width, header.font_height, char_count, header.font_data_size);
+    ESP_LOGI(TAG, "HZK font '%s' loaded successfully: %dx%d, %u characters, %u bytes%s%s", 
+             font->name, header.font_width, header.font_height, char_count, header.font_data_size,
+             manager->page_index ? ", unicode index" : "", manager->mapped ? ", mapped" : "");
+
+#if CONFIG_LCD_FONT_HZK_VERIFY
+    start_verify(manager);
+#endif
     
     return true;
 }
@@ -184,14 +580,15 @@ static hzk_font_manager_t *get_manager_by_font(const lcd_font_t *font)
         return NULL;
     }
     
+    // 按字体对象区分，hzk16_x15 等放大字体与hzk24大小相同
 #if CONFIG_LCD_FONT_HZK_16
-    if (font->width == 16 && font->height == 16) {
+    if (font == LCD_FONT(hzk16)) {
         return &s_hzk16_manager;
     }
 #endif
 
 #if CONFIG_LCD_FONT_HZK_24
-    if (font->width == 24 && font->height == 24) {
+    if (font == LCD_FONT(hzk24)) {
         return &s_hzk24_manager;
     }
 #endif
@@ -200,43 +597,90 @@ static hzk_font_manager_t *get_manager_by_font(const lcd_font_t *font)
 }
 
 /**
- * @brief 获取HZK字体编码数据
+ * @brief 获取字体对应的manager，未加载时先加载
  * 
- * @param self 字体对象
- * @param ch 字符编码，Unicode编码
- * @return const uint8_t* 返回编码数据地址，使用f->code_size长度的数据即可
- * @note self* 是 lcd_font_t 类型， 所以需要强制转换为 lcd_font_t 类型
- * @note 使用manager的data_cache来存储读取的数据，加锁保护
+ * @param f 字体对象
+ * @return hzk_font_manager_t* 已加载的manager，不支持或加载失败返回NULL
  */
-const uint8_t *lcd_font_get_hzk_code(const void *self, uint32_t ch)
+static hzk_font_manager_t *get_loaded_manager(const lcd_font_t *f)
 {
-    const lcd_font_t *f = (const lcd_font_t *)self;
-    
-    // 检查字体对象是否有效
-    if (f == NULL) {
-        return NULL;
-    }
-    
-    // 获取对应的manager
     hzk_font_manager_t *manager = get_manager_by_font(f);
     if (manager == NULL) {
-        ESP_LOGW(TAG, "Unsupported font: %s", f->name);
+        ESP_LOGW(TAG, "Unsupported font: %s", f ? f->name : "null");
         return NULL;
     }
-    
+
     // 如果manager未初始化，则进行初始化
-    if (!manager->valid) {
-        if (!load_and_check(f, manager)) {
-            ESP_LOGE(TAG, "Failed to load font: %s", f->name);
-            return NULL;
+    if (!manager->valid && !load_and_check(f, manager)) {
+        ESP_LOGE(TAG, "Failed to load font: %s", f->name);
+        return NULL;
+    }
+
+    return manager;
+}
+
+/**
+ * @brief 在HZK2的Unicode索引中查找字符序号
+ * 
+ * @param manager 字体管理对象
+ * @param ch 字符编码，Unicode编码
+ * @param char_index 输出字符序号
+ * @return bool 字符在字库中返回true
+ */
+static bool lookup_unicode_index(const hzk_font_manager_t *manager, uint32_t ch, uint32_t *char_index)
+{
+    if (ch > 0xFFFF) {
+        return false;
+    }
+
+    uint8_t page = manager->page_index[ch >> 8];
+    if (page == 0xFF) {
+        return false;
+    }
+
+    uint32_t block = page * HZK_INDEX_BLOCKS_PER_PAGE + ((ch >> 5) & (HZK_INDEX_BLOCKS_PER_PAGE - 1));
+    uint32_t bit = 1u << (ch & 31);
+    uint32_t bits = manager->block_bits[block];
+    if (!(bits & bit)) {
+        return false;
+    }
+
+    *char_index = manager->block_base[block] + __builtin_popcount(bits & (bit - 1));
+    return true;
+}
+
+/**
+ * @brief 计算字符数据在分区中的偏移量
+ * 
+ * @param manager 字体管理对象
+ * @param f 字体对象
+ * @param ch 字符编码，Unicode编码
+ * @param offset 输出字符数据在分区中的偏移量
+ * @return bool 字符在字库中返回true
+ */
+static bool get_char_offset(const hzk_font_manager_t *manager, const lcd_font_t *f, uint32_t ch, uint32_t *offset)
+{
+    uint32_t char_index;
+
+    // HZK2按Unicode索引直接得到字符序号
+    if (manager->page_index) {
+        if (!lookup_unicode_index(manager, ch, &char_index)) {
+            ESP_LOGW(TAG, "Character 0x%04X not in font", ch);
+            return false;
         }
+        if (char_index >= manager->char_count) {
+            ESP_LOGW(TAG, "Character index out of range: %u >= %u", char_index, manager->char_count);
+            return false;
+        }
+        *offset = manager->data_offset + (char_index * f->code_size);
+        return true;
     }
-    
+
     // 将Unicode转换为GB2312编码
     uint16_t gb2312_code = unicode_to_gb2312((uint16_t)ch);
     if (gb2312_code == INVALID_GB2312) {
         ESP_LOGW(TAG, "Invalid GB2312 code for character 0x%04X", ch);
-        return NULL;
+        return false;
     }
     
     // 计算字符在字体数据中的索引
@@ -248,23 +692,17 @@ const uint8_t *lcd_font_get_hzk_code(const void *self, uint32_t ch)
     // 检查GB2312编码范围
     if (high_byte < 0xA1 || high_byte > 0xFE || low_byte < 0xA1 || low_byte > 0xFE) {
         ESP_LOGW(TAG, "GB2312 code out of range: 0x%04X", gb2312_code);
-        return NULL;
+        return false;
     }
     
     // 计算字符索引：GB2312编码转换为线性索引
-    uint32_t char_index = ((high_byte - 0xA1) * 94) + (low_byte - 0xA1);
+    char_index = ((high_byte - 0xA1) * 94) + (low_byte - 0xA1);
     
     // 检查字符索引是否在字体数据范围内
     uint32_t max_chars = manager->font_data_size / f->code_size;
     if (char_index >= max_chars) {
         ESP_LOGW(TAG, "Character index out of range: %u >= %u", char_index, max_chars);
-        return NULL;
-    }
-    
-    // 加锁保护data_cache
-    if (xSemaphoreTake(manager->mutex, portMAX_DELAY) != pdTRUE) {
-        ESP_LOGE(TAG, "Failed to take mutex for font: %s", f->name);
-        return NULL;
+        return false;
     }
     
     // 计算字符在分区中的偏移量
@@ -273,23 +711,351 @@ const uint8_t *lcd_font_get_hzk_code(const void *self, uint32_t ch)
     // 检查是否超出分区范围
     if (char_offset + f->code_size > manager->partition->size) {
         ESP_LOGE(TAG, "Character offset out of partition range");
+        return false;
+    }
+    
+    *offset = char_offset;
+    return true;
+}
+
+/**
+ * @brief 获取HZK字体编码数据
+ * 
+ * @param self 字体对象
+ * @param ch 字符编码，Unicode编码
+ * @return const uint8_t* 返回编码数据地址，使用f->code_size长度的数据即可
+ * @note self* 是 lcd_font_t 类型， 所以需要强制转换为 lcd_font_t 类型
+ * @note 已映射时返回映射后的Flash地址，一直有效；否则数据在manager的LRU字形缓存中，加锁保护，
+ * 返回的地址在该字符被替换出缓存之前有效，即之后至少还可以再获取 CONFIG_LCD_FONT_HZK_CACHE_SIZE - 1 个其他字符
+ */
+const uint8_t *lcd_font_get_hzk_code(const void *self, uint32_t ch)
+{
+    const lcd_font_t *f = (const lcd_font_t *)self;
+    
+    // 获取对应的manager，未加载时先加载
+    hzk_font_manager_t *manager = get_loaded_manager(f);
+    if (manager == NULL) {
+        return NULL;
+    }
+
+    // 汉字库只有BMP中的字符，超出16位的编码不能截断后查找缓存和编码表
+    if (ch > 0xFFFF) {
+        return NULL;
+    }
+    
+    uint32_t char_offset;
+
+    // 已映射时直接返回Flash地址，不需要加锁和复制
+    if (manager->mapped) {
+        if (!get_char_offset(manager, f, ch, &char_offset)) {
+            return NULL;
+        }
+        return manager->mapped + char_offset;
+    }
+
+    // 加锁保护字形缓存
+    if (xSemaphoreTake(manager->mutex, portMAX_DELAY) != pdTRUE) {
+        ESP_LOGE(TAG, "Failed to take mutex for font: %s", f->name);
+        return NULL;
+    }
+
+    // 命中缓存时不需要编码转换和读Flash
+    uint16_t index = cache_find(manager, ch);
+    if (index != HZK_CACHE_NONE) {
+        cache_touch(manager, index);
+        manager->cache_hits++;
+        xSemaphoreGive(manager->mutex);
+        return &manager->cache_data[index * f->code_size];
+    }
+    manager->cache_misses++;
+
+    if (!get_char_offset(manager, f, ch, &char_offset)) {
         xSemaphoreGive(manager->mutex);
         return NULL;
     }
     
-    // 从分区读取字符数据到data_cache
-    esp_err_t ret = esp_partition_read(manager->partition, char_offset, manager->data_cache, f->code_size);
+    // 替换最久未使用的项，读取失败时该项保持为空
+    index = manager->cache_tail;
+    uint8_t *data = &manager->cache_data[index * f->code_size];
+    if (manager->cache_codes[index] == 0) {
+        manager->cache_used++;
+    }
+    manager->cache_codes[index] = 0;
+
+    // 从分区读取字符数据到缓存项
+    manager->flash_reads++;
+    esp_err_t ret = esp_partition_read(manager->partition, char_offset, data, f->code_size);
     if (ret != ESP_OK) {
-        ESP_LOGW(TAG, "Failed to read character data for GB2312: 0x%04X, error: %s", 
-                 gb2312_code, esp_err_to_name(ret));
+        ESP_LOGW(TAG, "Failed to read character data for 0x%04X, error: %s", 
+                 ch, esp_err_to_name(ret));
+        manager->cache_used--;
         xSemaphoreGive(manager->mutex);
         return NULL;
     }
+
+    manager->cache_codes[index] = ch;
+    cache_touch(manager, index);
     
     // 释放锁
     xSemaphoreGive(manager->mutex);
     
-    return manager->data_cache;
+    return data;
+}
+
+/**
+ * @brief 可重入地获取HZK字体编码数据
+ * 
+ * @param self 字体对象
+ * @param ch 字符编码，Unicode编码
+ * @param buf 调用者的缓冲区，至少 f->code_size 字节
+ * @return const uint8_t* 已映射时返回映射后的Flash地址，否则返回复制了字形数据的buf，失败返回NULL
+ * @note 没有映射时只在查找和更新字形缓存时加锁，读分区在锁外进行，多个任务同时显示汉字不会互相等待读Flash；
+ * 返回的数据不会被其他任务替换
+ */
+const uint8_t *lcd_font_get_hzk_code_r(const void *self, uint32_t ch, uint8_t *buf)
+{
+    const lcd_font_t *f = (const lcd_font_t *)self;
+
+    hzk_font_manager_t *manager = get_loaded_manager(f);
+    if (manager == NULL || buf == NULL || ch > 0xFFFF) {
+        return NULL;
+    }
+
+    uint32_t char_offset;
+
+    // 已映射时直接返回Flash地址，一直有效
+    if (manager->mapped) {
+        if (!get_char_offset(manager, f, ch, &char_offset)) {
+            return NULL;
+        }
+        return manager->mapped + char_offset;
+    }
+
+    // 命中缓存时在锁内复制到buf
+    if (xSemaphoreTake(manager->mutex, portMAX_DELAY) != pdTRUE) {
+        return NULL;
+    }
+
+    uint16_t index = cache_find(manager, ch);
+    if (index != HZK_CACHE_NONE) {
+        cache_touch(manager, index);
+        manager->cache_hits++;
+        memcpy(buf, &manager->cache_data[index * f->code_size], f->code_size);
+        xSemaphoreGive(manager->mutex);
+        return buf;
+    }
+    manager->cache_misses++;
+    xSemaphoreGive(manager->mutex);
+
+    // 未命中时在锁外读取到buf
+    if (!get_char_offset(manager, f, ch, &char_offset)) {
+        return NULL;
+    }
+
+    esp_err_t ret = esp_partition_read(manager->partition, char_offset, buf, f->code_size);
+
+    xSemaphoreTake(manager->mutex, portMAX_DELAY);
+    manager->flash_reads++;
+    if (ret == ESP_OK && cache_find(manager, ch) == HZK_CACHE_NONE) {
+        // 放入缓存，其他任务可能已经读取了同一个字符
+        index = manager->cache_tail;
+        if (manager->cache_codes[index] == 0) {
+            manager->cache_used++;
+        }
+        manager->cache_codes[index] = ch;
+        memcpy(&manager->cache_data[index * f->code_size], buf, f->code_size);
+        cache_touch(manager, index);
+    }
+    xSemaphoreGive(manager->mutex);
+
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Failed to read character data for 0x%04X, error: %s", 
+                 ch, esp_err_to_name(ret));
+        return NULL;
+    }
+
+    return buf;
+}
+
+/**
+ * @brief 读取一批按偏移量排序的字符到字形缓存，调用时持有manager->mutex
+ * 
+ * @param manager 字体管理对象
+ * @param f 字体对象
+ * @param items 待读取的字符，按偏移量升序
+ * @param num 字符数量
+ */
+static void prefetch_items(hzk_font_manager_t *manager, const lcd_font_t *f, const hzk_prefetch_item_t *items, int num)
+{
+    uint32_t buf_size = HZK_PREFETCH_BUF_SIZE(f);
+    for (int i = 0; i < num; ) {
+        // 合并间隔较小的相邻字符
+        int last = i;
+        while (last + 1 < num
+            && items[last + 1].offset - (items[last].offset + f->code_size) <= CONFIG_LCD_FONT_HZK_PREFETCH_GAP
+            && items[last + 1].offset + f->code_size - items[i].offset <= buf_size) {
+            last++;
+        }
+
+        uint32_t start = items[i].offset;
+        uint32_t size = items[last].offset + f->code_size - start;
+        manager->flash_reads++;
+        esp_err_t ret = esp_partition_read(manager->partition, start, manager->prefetch_buf, size);
+        if (ret != ESP_OK) {
+            ESP_LOGW(TAG, "Failed to prefetch %u bytes at 0x%08X, error: %s", size, start, esp_err_to_name(ret));
+            i = last + 1;
+            continue;
+        }
+
+        for (int k = i; k <= last; k++) {
+            uint16_t index = manager->cache_tail;
+            if (manager->cache_codes[index] == 0) {
+                manager->cache_used++;
+            }
+            manager->cache_codes[index] = items[k].code;
+            memcpy(&manager->cache_data[index * f->code_size], &manager->prefetch_buf[items[k].offset - start], f->code_size);
+            cache_touch(manager, index);
+        }
+
+        i = last + 1;
+    }
+}
+
+/**
+ * @brief 预取一组字符到字形缓存
+ * 
+ * 跳过已缓存的字符，其余字符每 HZK_PREFETCH_BATCH 个一批，按在分区中的偏移量排序，
+ * 间隔不超过 CONFIG_LCD_FONT_HZK_PREFETCH_GAP 的相邻字符合并为一次读取，读到预取缓冲区后复制到缓存项。
+ * 一次最多预取 CONFIG_LCD_FONT_HZK_CACHE_SIZE 个字符，保证预取的字符不会互相替换。
+ * 
+ * @param self 字体对象
+ * @param chars 字符编码数组，Unicode编码
+ * @param count 字符数量
+ * @note 已映射的字体不需要预取
+ */
+void lcd_font_prefetch_hzk(const void *self, const uint32_t *chars, int count)
+{
+    const lcd_font_t *f = (const lcd_font_t *)self;
+    if (f == NULL || chars == NULL || count <= 0) {
+        return;
+    }
+
+    hzk_font_manager_t *manager = get_manager_by_font(f);
+    if (manager == NULL) {
+        return;
+    }
+
+    if (!manager->valid && !load_and_check(f, manager)) {
+        return;
+    }
+
+    if (manager->mapped) {
+        return;
+    }
+
+    if (xSemaphoreTake(manager->mutex, portMAX_DELAY) != pdTRUE) {
+        return;
+    }
+
+    // 收集需要读取的字符，已缓存的字符移动到LRU链表头部，避免被本次预取替换；
+    // 前面批次读取的字符已经在缓存中，不会重复读取
+    hzk_prefetch_item_t items[HZK_PREFETCH_BATCH];
+    int total = 0;
+    int i = 0;
+    while (i < count && total < CONFIG_LCD_FONT_HZK_CACHE_SIZE) {
+        int num = 0;
+        for (; i < count && num < HZK_PREFETCH_BATCH && total + num < CONFIG_LCD_FONT_HZK_CACHE_SIZE; i++) {
+            uint32_t code = chars[i];
+            if (code > 0xFFFF) {
+                continue;
+            }
+
+            uint16_t index = cache_find(manager, code);
+            if (index != HZK_CACHE_NONE) {
+                cache_touch(manager, index);
+                continue;
+            }
+
+            bool duplicate = false;
+            for (int j = 0; j < num; j++) {
+                if (items[j].code == code) {
+                    duplicate = true;
+                    break;
+                }
+            }
+
+            uint32_t offset;
+            if (duplicate || !get_char_offset(manager, f, code, &offset)) {
+                continue;
+            }
+
+            // 按偏移量插入排序，每批字符数量较少
+            int pos = num++;
+            while (pos > 0 && items[pos - 1].offset > offset) {
+                items[pos] = items[pos - 1];
+                pos--;
+            }
+            items[pos].offset = offset;
+            items[pos].code = code;
+        }
+
+        prefetch_items(manager, f, items, num);
+        total += num;
+    }
+
+    xSemaphoreGive(manager->mutex);
+}
+
+/**
+ * @brief 获取汉字库字形缓存的统计信息
+ * 
+ * @param font 汉字库字体，LCD_FONT(hzk16) 或 LCD_FONT(hzk24)
+ * @param stats 输出统计信息
+ * @return int 成功返回0，字体不是汉字库或未加载返回-1
+ * @note 已映射的字体不使用字形缓存，命中和未命中次数都为0
+ */
+int lcd_font_hzk_get_cache_stats(const lcd_font_t *font, lcd_font_hzk_cache_stats_t *stats)
+{
+    hzk_font_manager_t *manager = get_manager_by_font(font);
+    if (manager == NULL || !manager->valid || stats == NULL) {
+        return -1;
+    }
+
+    xSemaphoreTake(manager->mutex, portMAX_DELAY);
+    stats->hits = manager->cache_hits;
+    stats->misses = manager->cache_misses;
+    stats->capacity = CONFIG_LCD_FONT_HZK_CACHE_SIZE;
+    stats->used = manager->cache_used;
+    stats->mapped = (manager->mapped != NULL);
+    stats->flash_reads = manager->flash_reads;
+    xSemaphoreGive(manager->mutex);
+
+    return 0;
+}
+
+/**
+ * @brief 获取汉字库字体数据的校验状态
+ * 
+ * @param font 汉字库字体，LCD_FONT(hzk16) 或 LCD_FONT(hzk24)
+ * @param status 输出校验状态
+ * @return int 成功返回0，字体不是汉字库或未加载返回-1
+ */
+int lcd_font_hzk_get_verify_status(const lcd_font_t *font, lcd_font_hzk_verify_status_t *status)
+{
+    hzk_font_manager_t *manager = get_manager_by_font(font);
+    if (manager == NULL || !manager->valid || status == NULL) {
+        return -1;
+    }
+
+    xSemaphoreTake(manager->mutex, portMAX_DELAY);
+    status->state = manager->verify_state;
+    status->verified = manager->verify_offset;
+    status->total = manager->font_data_size;
+    status->expected = manager->data_checksum;
+    status->calculated = manager->verify_crc;
+    xSemaphoreGive(manager->mutex);
+
+    return 0;
 }
 
 
@@ -1,2036 +1,2218 @@
 // Auto-generated code mapping table for Unicode to GB2312 conversion
 // Source file: hz2000.txt
+// Generated by gb2312_encode_gen.py, do not edit
 #include <stdint.h>
 #include "gb2312_encode.h"
 
 #define MAP_TABLE_SIZE 2000
+#define MAP_PAGE_COUNT 80
 
-typedef struct {
-    uint16_t unicode;  // Unicode code point
-    uint16_t gb2312;   // GB2312 encoding
-} code_map_t;
+// Unicode高字节 -> 页号，0xFF表示该页没有字符
+static const uint8_t page_index[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11,
+    0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21,
+    0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31,
+    0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41,
+    0x42, 0x43, 0x44, 0xFF, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0xFF, 0x4E, 0x4F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+// 每页8块，每块32个码点的位图
+static const uint32_t block_bits[MAP_PAGE_COUNT * 8] = {
+    0x3D5A6F8B, 0x6F1124B0, 0xA2111B28, 0x00010043, 0x0C365A40, 0x840473B6, 0x03686C83, 0x28841438, // U+4Exx
+    0x8782A002, 0x10418051, 0x1229E048, 0x80080201, 0x28002800, 0x80208081, 0x60008410, 0x0400E002, // U+4Fxx
+    0x03142000, 0x50000440, 0x14008000, 0x80000020, 0x00000121, 0x00000108, 0x00000000, 0x00000000, // U+50xx
+    0x00040000, 0x80000000, 0x04002B6A, 0x38FB3920, 0x1A043220, 0x088D9001, 0x00009050, 0xAE418013, // U+51xx
+    0x2F8404C3, 0x08410A10, 0x00022404, 0x00048080, 0xE8000000, 0x800C0703, 0x00040880, 0x00000010, // U+52xx
+    0x00C00061, 0x0C000403, 0x54A8C78A, 0x80BB0817, 0x85001A74, 0x88000000, 0x03D23D04, 0x01CD9C58, // U+53xx
+    0x08A27318, 0x033098C0, 0x11000141, 0x30080104, 0x00409000, 0x01029000, 0x80006182, 0x00040420, // U+54xx
+    0x00010002, 0x00008000, 0x00000440, 0x10000040, 0x10000414, 0x08800080, 0x10000000, 0x00000000, // U+55xx
+    0x08000200, 0x00000000, 0x00000000, 0x00000100, 0x00004000, 0x00000000, 0x48000000, 0x60110015, // U+56xx
+    0x80000140, 0x44010108, 0x8480A080, 0x00000010, 0x00000804, 0x0000000C, 0x80004008, 0x06000000, // U+57xx
+    0x00000004, 0x00000000, 0x40100000, 0x00000000, 0x40000000, 0x00000000, 0x00200000, 0x00014800, // U+58xx
+    0x9460A090, 0x06924E80, 0x00804A80, 0x23480001, 0x004001C4, 0x0A000120, 0x14120840, 0x00001100, // U+59xx
+    0x90000092, 0x00000020, 0x04000200, 0x00000000, 0x04000000, 0x00080000, 0x00001200, 0x00000000, // U+5Axx
+    0x00000000, 0x00000000, 0xA3910000, 0x04000658, 0x7F809B8A, 0x62780C5E, 0x80011074, 0x9F000100, // U+5Bxx
+    0x24528052, 0x77020090, 0x40200725, 0x00028023, 0x08000004, 0x01082200, 0x00000000, 0x00012000, // U+5Cxx
+    0x00100080, 0x00002000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x60002000, 0x001E4BE6, // U+5Dxx
+    0x2800110C, 0x21006040, 0x00000004, 0x995C0000, 0x56308450, 0x00C020C0, 0x00400000, 0x04C00000, // U+5Exx
+    0x8828840D, 0x06020001, 0x002C0000, 0x08023654, 0x00810D33, 0x00804000, 0x02800068, 0x00220881, // U+5Fxx
+    0x20644003, 0x080004A1, 0x00040000, 0x00002300, 0x80100010, 0x00041048, 0x80000020, 0x00086801, // U+60xx
+    0x80008300, 0x00000000, 0x00004100, 0x00000184, 0x00000800, 0x00000100, 0x00000104, 0x00000000, // U+61xx
+    0x0547C100, 0x80100400, 0x00186801, 0xC2003A88, 0x09280401, 0xB0000034, 0x10480264, 0x80101120, // U+62xx
+    0x48400282, 0x04008020, 0x8000E000, 0x00804006, 0x00441000, 0x000007A4, 0x00058200, 0x00000202, // U+63xx
+    0x40010004, 0x04001000, 0x000000C0, 0x00000000, 0x00000000, 0x00013000, 0x00042020, 0x00000000, // U+64xx
+    0x00000001, 0xCA408000, 0x22009120, 0x0011104C, 0x92821080, 0x2201A210, 0x00008802, 0x044233A5, // U+65xx
+    0x80085040, 0x4000A121, 0x04280808, 0x0450C150, 0x00800080, 0x00104000, 0x02000000, 0xD21D0000, // U+66xx
+    0xA8002B01, 0x04229D00, 0x9003C04D, 0xC001A122, 0x30810012, 0x00408C00, 0x000B8000, 0x001A9020, // U+67xx
+    0x00020980, 0x13800402, 0x000A012C, 0x00000028, 0x00000022, 0x00090100, 0x00202A01, 0x00204001, // U+68xx
+    0x00002000, 0x80010000, 0x00000000, 0x10800000, 0x00000000, 0x00000000, 0x00010000, 0x20000000, // U+69xx
+    0x00000400, 0x00000002, 0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, // U+6Axx
+    0x00000000, 0x0004008F, 0x00001000, 0x080000FC, 0x00400800, 0x80A00000, 0x0874A022, 0x00000800, // U+6Bxx
+    0x08128000, 0x01100080, 0xA8200284, 0x20000411, 0x8A000102, 0x8B080802, 0x00200600, 0x20210124, // U+6Cxx
+    0x00040802, 0x58040420, 0x00004C02, 0x01804240, 0x08000104, 0x01040140, 0x00020010, 0x00824012, // U+6Dxx
+    0x00910020, 0x01000213, 0x01000000, 0x80000000, 0x00010000, 0x00400400, 0x040A0082, 0x00000102, // U+6Exx
+    0x00100000, 0x00020000, 0x01000000, 0x00004040, 0x00004000, 0x00080002, 0x00000001, 0x00004000, // U+6Fxx
+    0x00000000, 0x00000000, 0x00001000, 0xC061A800, 0x02344000, 0x23084000, 0x88000108, 0x20002010, // U+70xx
+    0x00200400, 0x00400040, 0x00005000, 0x00000090, 0x82000400, 0x00000000, 0x00200008, 0x00000000, // U+71xx
+    0x00000000, 0x01420000, 0x8A000180, 0x02000284, 0x00000000, 0x00401000, 0x02000110, 0x00031001, // U+72xx
+    0x08000000, 0x00004400, 0x00000000, 0x00000000, 0x00000A80, 0x08058800, 0x00002400, 0x00002001, // U+73xx
+    0x00000048, 0x10180000, 0xC4000000, 0x00400000, 0x00000008, 0x00000000, 0x00000000, 0x00400048, // U+74xx
+    0x85000010, 0x09AF0B00, 0x02009020, 0x00000020, 0x00800000, 0x52000010, 0x08000420, 0x00000400, // U+75xx
+    0x00000000, 0x00000A10, 0x00000000, 0x69000000, 0x00420050, 0x80004000, 0x09414444, 0x4110C000, // U+76xx
+    0x80000A02, 0x10008200, 0x08000003, 0x00001042, 0x00044000, 0x00080280, 0x08800000, 0x8008222C, // U+77xx
+    0x04102006, 0x01100000, 0x00000001, 0x00005000, 0x81022000, 0x000A0080, 0x00000402, 0x00800100, // U+78xx
+    0x00000002, 0x54000000, 0x60400002, 0x00002020, 0x00008010, 0x48000000, 0x01062A03, 0x08018240, // U+79xx
+    0x00800800, 0x08080000, 0x00800040, 0x04400000, 0x80000002, 0x00000000, 0x02000800, 0x02008021, // U+7Axx
+    0x08100040, 0x14001040, 0x00500200, 0x00000000, 0x00A00001, 0x00020202, 0x00080000, 0x00000002, // U+7Bxx
+    0x00000000, 0x00000000, 0x00000000, 0x28080000, 0x01840200, 0x420A4030, 0x10000000, 0x08000000, // U+7Cxx
+    0x00000000, 0x00008081, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, // U+7Dxx
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x870684C4, 0xA20CA1F8, 0x90312480, // U+7Exx
+    0x01400000, 0x05000200, 0x04820000, 0x00004000, 0x04004000, 0x22000010, 0x80101022, 0x08000001, // U+7Fxx
+    0x0100102B, 0x89080400, 0x00101004, 0x00000000, 0x28401848, 0x80048625, 0x50005048, 0x21400002, // U+80xx
+    0x04020604, 0x01020000, 0x00010C00, 0x00000000, 0x08000000, 0x00000000, 0x00000004, 0x10100408, // U+81xx
+    0x10142020, 0x00201400, 0x00000000, 0x040D8000, 0x20000804, 0x220A3040, 0x08808000, 0x00028060, // U+82xx
+    0x0000002C, 0x03000000, 0x00000240, 0x0000801A, 0x00000200, 0x22840800, 0x10009400, 0x00060200, // U+83xx
+    0x00003010, 0x200000A0, 0x08800000, 0x00001808, 0x00000800, 0x01000000, 0x00000200, 0x00000000, // U+84xx
+    0x04000000, 0x00000002, 0x00000400, 0x40100000, 0x08000000, 0x00000000, 0x00008000, 0x00000200, // U+85xx
+    0x00000000, 0x00000000, 0x44004000, 0x22000800, 0x10200001, 0x00000000, 0x00000480, 0x00000010, // U+86xx
+    0x00800004, 0x00000002, 0x00804080, 0x00100000, 0x00000000, 0x04000000, 0x00000000, 0x00000000, // U+87xx
+    0x00000000, 0x00000000, 0x02001001, 0x00010128, 0x00000812, 0x00000800, 0x00300024, 0x01100010, // U+88xx
+    0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000042, 0x00000000, 0x00040256, 0x00000048, // U+89xx
+    0x00000001, 0x00000000, 0x00000000, 0x02000000, 0x00080000, 0x00000000, 0x00000000, 0x00000000, // U+8Axx
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xC5056316, 0x2C200252, 0x0990B062, // U+8Bxx
+    0x00010108, 0x00922144, 0x00000002, 0x04000402, 0x00001000, 0x00000000, 0x00000000, 0x00000000, // U+8Cxx
+    0xE0000000, 0x4720BB9E, 0x00001010, 0x00F10059, 0x00000420, 0x40080008, 0xA0020808, 0x00208000, // U+8Dxx
+    0x00000000, 0x00000000, 0x00000000, 0x00001000, 0x00000002, 0x04000800, 0x00000000, 0x00000000, // U+8Exx
+    0x00000000, 0x00000000, 0x00000000, 0x2811D340, 0xC80A0708, 0x62010300, 0x7B0340A4, 0x02810C00, // U+8Fxx
+    0x8C058247, 0x00000001, 0x00082082, 0x80200020, 0x00080000, 0x0A22404C, 0x20024002, 0x20002102, // U+90xx
+    0x00000000, 0x00000000, 0x00042800, 0x81000008, 0x00000000, 0x00000000, 0x0002B280, 0x00000000, // U+91xx
+    0x00000000, 0x00000000, 0x00000000, 0x00100000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, // U+92xx
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80004300, 0x080241C6, 0x10000002, 0x00402008, // U+94xx
+    0x02811902, 0x08002042, 0x10000080, 0x80402000, 0x00000000, 0x00000000, 0x00000000, 0x2B15C500, // U+95xx
+    0x90004001, 0x807C4000, 0x08012170, 0x00600414, 0x03000800, 0x40400000, 0x00002073, 0x00C00500, // U+96xx
+    0x50082081, 0x01040000, 0x4A440000, 0x00080207, 0x00002000, 0x00000001, 0x00000000, 0x00002240, // U+97xx
+    0x00000000, 0x00000000, 0x00000000, 0x4EE00000, 0x11400110, 0x00000000, 0xC1004000, 0x00000000, // U+98xx
+    0x00010000, 0x00000000, 0x00000000, 0x10004020, 0x02400000, 0x00000000, 0x00000000, 0x00000000, // U+99xx
+    0x00000000, 0x00000000, 0x00000000, 0x18019000, 0x040090C0, 0x00000110, 0x01000000, 0x00000000, // U+9Axx
+    0x00000000, 0x00000000, 0x00008002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, // U+9Bxx
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10002002, 0x00000000, 0x00000000, 0x00000000, // U+9Cxx
+    0x80000000, 0x80002008, 0x00008000, 0x00000010, 0x00000000, 0x00000040, 0x01024010, 0x00000000, // U+9Exx
+    0x00084000, 0x08000001, 0x00010000, 0x80000000, 0x06000010, 0x00000000, 0x00000000, 0x00000000, // U+9Fxx
+};
+
+// 每块第一个字符在 gb2312_codes 中的序号
+static const uint16_t block_base[MAP_PAGE_COUNT * 8] = {
+    0, 19, 32, 43, 47, 58, 71, 83, // U+4Exx
+    92, 101, 108, 118, 122, 126, 131, 136, // U+4Fxx
+    141, 146, 150, 153, 155, 158, 160, 160, // U+50xx
+    160, 161, 162, 171, 186, 194, 202, 206, // U+51xx
+    217, 229, 235, 239, 242, 246, 254, 257, // U+52xx
+    258, 263, 268, 282, 294, 304, 306, 318, // U+53xx
+    331, 342, 351, 356, 361, 364, 368, 374, // U+54xx
+    377, 379, 380, 382, 384, 388, 391, 392, // U+55xx
+    392, 394, 394, 394, 395, 396, 396, 398, // U+56xx
+    405, 408, 413, 419, 420, 422, 424, 427, // U+57xx
+    429, 430, 430, 432, 432, 433, 433, 434, // U+58xx
+    437, 446, 456, 461, 467, 472, 476, 482, // U+59xx
+    484, 489, 490, 492, 492, 493, 494, 496, // U+5Axx
+    496, 496, 496, 503, 509, 525, 539, 546, // U+5Bxx
+    553, 562, 571, 579, 584, 586, 590, 590, // U+5Cxx
+    592, 594, 595, 595, 595, 595, 595, 598, // U+5Dxx
+    611, 617, 622, 623, 631, 641, 646, 647, // U+5Exx
+    650, 659, 663, 666, 675, 684, 686, 691, // U+5Fxx
+    696, 703, 708, 709, 712, 715, 719, 721, // U+60xx
+    726, 730, 730, 732, 735, 736, 737, 739, // U+61xx
+    739, 748, 751, 757, 766, 772, 778, 785, // U+62xx
+    790, 796, 799, 803, 807, 810, 816, 820, // U+63xx
+    822, 825, 827, 829, 829, 829, 832, 835, // U+64xx
+    835, 836, 842, 848, 854, 861, 868, 871, // U+65xx
+    882, 887, 893, 898, 906, 908, 910, 911, // U+66xx
+    919, 927, 935, 945, 953, 959, 963, 967, // U+67xx
+    973, 977, 983, 989, 991, 993, 996, 1001, // U+68xx
+    1004, 1005, 1007, 1007, 1009, 1009, 1009, 1010, // U+69xx
+    1011, 1012, 1013, 1013, 1014, 1014, 1014, 1014, // U+6Axx
+    1014, 1014, 1020, 1021, 1028, 1030, 1033, 1042, // U+6Bxx
+    1043, 1047, 1050, 1057, 1061, 1066, 1073, 1076, // U+6Cxx
+    1082, 1085, 1091, 1095, 1100, 1103, 1107, 1109, // U+6Dxx
+    1114, 1118, 1123, 1124, 1125, 1126, 1128, 1133, // U+6Exx
+    1135, 1136, 1137, 1138, 1140, 1141, 1143, 1144, // U+6Fxx
+    1145, 1145, 1145, 1146, 1154, 1159, 1164, 1168, // U+70xx
+    1171, 1173, 1175, 1177, 1179, 1182, 1182, 1184, // U+71xx
+    1184, 1184, 1187, 1192, 1196, 1196, 1198, 1201, // U+72xx
+    1205, 1206, 1208, 1208, 1208, 1211, 1216, 1218, // U+73xx
+    1220, 1222, 1225, 1228, 1229, 1230, 1230, 1230, // U+74xx
+    1233, 1237, 1248, 1252, 1253, 1254, 1258, 1261, // U+75xx
+    1262, 1262, 1265, 1265, 1269, 1273, 1275, 1283, // U+76xx
+    1288, 1292, 1295, 1298, 1301, 1303, 1306, 1308, // U+77xx
+    1315, 1320, 1322, 1323, 1325, 1329, 1332, 1334, // U+78xx
+    1336, 1337, 1340, 1344, 1346, 1348, 1350, 1358, // U+79xx
+    1363, 1365, 1367, 1369, 1371, 1373, 1373, 1375, // U+7Axx
+    1379, 1382, 1386, 1389, 1389, 1392, 1395, 1396, // U+7Bxx
+    1397, 1397, 1397, 1397, 1400, 1404, 1411, 1412, // U+7Cxx
+    1413, 1413, 1416, 1416, 1416, 1416, 1416, 1416, // U+7Dxx
+    1416, 1416, 1416, 1416, 1416, 1416, 1427, 1440, // U+7Exx
+    1448, 1450, 1453, 1456, 1457, 1459, 1462, 1467, // U+7Fxx
+    1469, 1475, 1480, 1483, 1483, 1490, 1498, 1504, // U+80xx
+    1508, 1513, 1515, 1518, 1518, 1519, 1519, 1520, // U+81xx
+    1524, 1529, 1532, 1532, 1537, 1540, 1547, 1550, // U+82xx
+    1554, 1557, 1559, 1561, 1565, 1566, 1571, 1575, // U+83xx
+    1578, 1581, 1584, 1586, 1589, 1590, 1591, 1592, // U+84xx
+    1592, 1593, 1594, 1595, 1597, 1598, 1598, 1599, // U+85xx
+    1600, 1600, 1600, 1603, 1606, 1609, 1609, 1611, // U+86xx
+    1612, 1614, 1615, 1618, 1619, 1619, 1620, 1620, // U+87xx
+    1620, 1620, 1620, 1623, 1627, 1630, 1631, 1635, // U+88xx
+    1638, 1638, 1638, 1638, 1639, 1641, 1641, 1647, // U+89xx
+    1649, 1650, 1650, 1650, 1651, 1652, 1652, 1652, // U+8Axx
+    1652, 1652, 1652, 1652, 1652, 1652, 1665, 1673, // U+8Bxx
+    1683, 1686, 1693, 1694, 1697, 1698, 1698, 1698, // U+8Cxx
+    1698, 1701, 1717, 1719, 1728, 1730, 1733, 1738, // U+8Dxx
+    1740, 1740, 1740, 1740, 1741, 1742, 1744, 1744, // U+8Exx
+    1744, 1744, 1744, 1744, 1754, 1763, 1769, 1781, // U+8Fxx
+    1786, 1797, 1798, 1802, 1805, 1806, 1814, 1818, // U+90xx
+    1822, 1822, 1822, 1825, 1828, 1828, 1828, 1834, // U+91xx
+    1834, 1834, 1834, 1834, 1835, 1835, 1835, 1835, // U+92xx
+    1835, 1835, 1835, 1835, 1835, 1839, 1847, 1849, // U+94xx
+    1852, 1859, 1863, 1865, 1868, 1868, 1868, 1868, // U+95xx
+    1879, 1883, 1890, 1897, 1902, 1905, 1907, 1913, // U+96xx
+    1917, 1923, 1925, 1930, 1935, 1936, 1937, 1937, // U+97xx
+    1940, 1940, 1940, 1940, 1947, 1952, 1952, 1956, // U+98xx
+    1956, 1957, 1957, 1957, 1960, 1962, 1962, 1962, // U+99xx
+    1962, 1962, 1962, 1962, 1967, 1972, 1974, 1975, // U+9Axx
+    1975, 1975, 1975, 1977, 1977, 1977, 1977, 1977, // U+9Bxx
+    1977, 1977, 1977, 1977, 1977, 1980, 1980, 1980, // U+9Cxx
+    1980, 1981, 1984, 1985, 1986, 1986, 1987, 1991, // U+9Exx
+    1991, 1993, 1995, 1996, 1997, 2000, 2000, 2000, // U+9Fxx
+};
 
-static const code_map_t map_table[] = {
-    {0x4E00, 0xD2BB}, // 一
-    {0x4E01, 0xB6A1}, // 丁
-    {0x4E03, 0xC6DF}, // 七
-    {0x4E07, 0xCDF2}, // 万
-    {0x4E08, 0xD5C9}, // 丈
-    {0x4E09, 0xC8FD}, // 三
-    {0x4E0A, 0xC9CF}, // 上
-    {0x4E0B, 0xCFC2}, // 下
-    {0x4E0D, 0xB2BB}, // 不
-    {0x4E0E, 0xD3EB}, // 与
-    {0x4E11, 0xB3F3}, // 丑
-    {0x4E13, 0xD7A8}, // 专
-    {0x4E14, 0xC7D2}, // 且
-    {0x4E16, 0xCAC0}, // 世
-    {0x4E18, 0xC7F0}, // 丘
-    {0x4E1A, 0xD2B5}, // 业
-    {0x4E1B, 0xB4D4}, // 丛
-    {0x4E1C, 0xB6AB}, // 东
-    {0x4E1D, 0xCBBF}, // 丝
-    {0x4E24, 0xC1BD}, // 两
-    {0x4E25, 0xD1CF}, // 严
-    {0x4E27, 0xC9A5}, // 丧
-    {0x4E2A, 0xB8F6}, // 个
-    {0x4E2D, 0xD6D0}, // 中
-    {0x4E30, 0xB7E1}, // 丰
-    {0x4E34, 0xC1D9}, // 临
-    {0x4E38, 0xCDE8}, // 丸
-    {0x4E39, 0xB5A4}, // 丹
-    {0x4E3A, 0xCEAA}, // 为
-    {0x4E3B, 0xD6F7}, // 主
-    {0x4E3D, 0xC0F6}, // 丽
-    {0x4E3E, 0xBED9}, // 举
-    {0x4E43, 0xC4CB}, // 乃
-    {0x4E45, 0xBEC3}, // 久
-    {0x4E48, 0xC3B4}, // 么
-    {0x4E49, 0xD2E5}, // 义
-    {0x4E4B, 0xD6AE}, // 之
-    {0x4E4C, 0xCEDA}, // 乌
-    {0x4E50, 0xC0D6}, // 乐
-    {0x4E54, 0xC7C7}, // 乔
-    {0x4E59, 0xD2D2}, // 乙
-    {0x4E5D, 0xBEC5}, // 九
-    {0x4E5F, 0xD2B2}, // 也
-    {0x4E60, 0xCFB0}, // 习
-    {0x4E61, 0xCFE7}, // 乡
-    {0x4E66, 0xCAE9}, // 书
-    {0x4E70, 0xC2F2}, // 买
-    {0x4E86, 0xC1CB}, // 了
-    {0x4E89, 0xD5F9}, // 争
-    {0x4E8B, 0xCAC2}, // 事
-    {0x4E8C, 0xB6FE}, // 二
-    {0x4E8E, 0xD3DA}, // 于
-    {0x4E91, 0xD4C6}, // 云
-    {0x4E92, 0xBBA5}, // 互
-    {0x4E94, 0xCEE5}, // 五
-    {0x4E95, 0xBEAE}, // 井
-    {0x4E9A, 0xD1C7}, // 亚
-    {0x4E9B, 0xD0A9}, // 些
-    {0x4EA1, 0xCDF6}, // 亡
-    {0x4EA2, 0xBFBA}, // 亢
-    {0x4EA4, 0xBDBB}, // 交
-    {0x4EA5, 0xBAA5}, // 亥
-    {0x4EA7, 0xB2FA}, // 产
-    {0x4EA8, 0xBAE0}, // 亨
-    {0x4EA9, 0xC4B6}, // 亩
-    {0x4EAC, 0xBEA9}, // 京
-    {0x4EAD, 0xCDA4}, // 亭
-    {0x4EAE, 0xC1C1}, // 亮
-    {0x4EB2, 0xC7D7}, // 亲
-    {0x4EBA, 0xC8CB}, // 人
-    {0x4EBF, 0xD2DA}, // 亿
-    {0x4EC0, 0xCAB2}, // 什
-    {0x4EC1, 0xC8CA}, // 仁
-    {0x4EC7, 0xB3F0}, // 仇
-    {0x4ECA, 0xBDF1}, // 今
-    {0x4ECB, 0xBDE9}, // 介
-    {0x4ECD, 0xC8D4}, // 仍
-    {0x4ECE, 0xB4D3}, // 从
-    {0x4ED3, 0xB2D6}, // 仓
-    {0x4ED5, 0xCACB}, // 仕
-    {0x4ED6, 0xCBFB}, // 他
-    {0x4ED8, 0xB8B6}, // 付
-    {0x4ED9, 0xCFC9}, // 仙
-    {0x4EE3, 0xB4FA}, // 代
-    {0x4EE4, 0xC1EE}, // 令
-    {0x4EE5, 0xD2D4}, // 以
-    {0x4EEA, 0xD2C7}, // 仪
-    {0x4EEC, 0xC3C7}, // 们
-    {0x4EF2, 0xD6D9}, // 仲
-    {0x4EF7, 0xBCDB}, // 价
-    {0x4EFB, 0xC8CE}, // 任
-    {0x4EFD, 0xB7DD}, // 份
-    {0x4F01, 0xC6F3}, // 企
-    {0x4F0D, 0xCEE9}, // 伍
-    {0x4F0F, 0xB7FC}, // 伏
-    {0x4F11, 0xD0DD}, // 休
-    {0x4F17, 0xD6DA}, // 众
-    {0x4F18, 0xD3C5}, // 优
-    {0x4F19, 0xBBEF}, // 伙
-    {0x4F1A, 0xBBE1}, // 会
-    {0x4F1F, 0xCEB0}, // 伟
-    {0x4F20, 0xB4AB}, // 传
-    {0x4F24, 0xC9CB}, // 伤
-    {0x4F26, 0xC2D7}, // 伦
-    {0x4F2F, 0xB2AE}, // 伯
-    {0x4F30, 0xB9C0}, // 估
-    {0x4F36, 0xC1E6}, // 伶
-    {0x4F3C, 0xCBC6}, // 似
-    {0x4F43, 0xB5E8}, // 佃
-    {0x4F46, 0xB5AB}, // 但
-    {0x4F4D, 0xCEBB}, // 位
-    {0x4F4E, 0xB5CD}, // 低
-    {0x4F4F, 0xD7A1}, // 住
-    {0x4F50, 0xD7F4}, // 佐
-    {0x4F53, 0xCCE5}, // 体
-    {0x4F55, 0xBACE}, // 何
-    {0x4F59, 0xD3E0}, // 余
-    {0x4F5C, 0xD7F7}, // 作
-    {0x4F60, 0xC4E3}, // 你
-    {0x4F69, 0xC5E5}, // 佩
-    {0x4F73, 0xBCD1}, // 佳
-    {0x4F7F, 0xCAB9}, // 使
-    {0x4F8B, 0xC0FD}, // 例
-    {0x4F8D, 0xCACC}, // 侍
-    {0x4F9B, 0xB9A9}, // 供
-    {0x4F9D, 0xD2C0}, // 依
-    {0x4FA0, 0xCFC0}, // 侠
-    {0x4FA7, 0xB2E0}, // 侧
-    {0x4FAF, 0xBAEE}, // 侯
-    {0x4FB5, 0xC7D6}, // 侵
-    {0x4FBF, 0xB1E3}, // 便
-    {0x4FC4, 0xB6ED}, // 俄
-    {0x4FCA, 0xBFA1}, // 俊
-    {0x4FCF, 0xC7CE}, // 俏
-    {0x4FDD, 0xB1A3}, // 保
-    {0x4FDE, 0xD3E1}, // 俞
-    {0x4FE1, 0xD0C5}, // 信
-    {0x4FED, 0xBCF3}, // 俭
-    {0x4FEE, 0xD0DE}, // 修
-    {0x4FEF, 0xB8A9}, // 俯
-    {0x4FFA, 0xB0B3}, // 俺
-    {0x500D, 0xB1B6}, // 倍
-    {0x5012, 0xB5B9}, // 倒
-    {0x5014, 0xBEF3}, // 倔
-    {0x5018, 0xCCC8}, // 倘
-    {0x5019, 0xBAF2}, // 候
-    {0x5026, 0xBEEB}, // 倦
-    {0x502A, 0xC4DF}, // 倪
-    {0x503C, 0xD6B5}, // 值
-    {0x503E, 0xC7E3}, // 倾
-    {0x504F, 0xC6AB}, // 偏
-    {0x505A, 0xD7F6}, // 做
-    {0x505C, 0xCDA3}, // 停
-    {0x5065, 0xBDA1}, // 健
-    {0x507F, 0xB3A5}, // 偿
-    {0x5080, 0xBFFE}, // 傀
-    {0x5085, 0xB8B5}, // 傅
-    {0x5088, 0xC0FC}, // 傈
-    {0x50A3, 0xB4F6}, // 傣
-    {0x50A8, 0xB4A2}, // 储
-    {0x5112, 0xC8E5}, // 儒
-    {0x513F, 0xB6F9}, // 儿
-    {0x5141, 0xD4CA}, // 允
-    {0x5143, 0xD4AA}, // 元
-    {0x5145, 0xB3E4}, // 充
-    {0x5146, 0xD5D7}, // 兆
-    {0x5148, 0xCFC8}, // 先
-    {0x5149, 0xB9E2}, // 光
-    {0x514B, 0xBFCB}, // 克
-    {0x514D, 0xC3E2}, // 免
-    {0x515A, 0xB5B3}, // 党
-    {0x5165, 0xC8EB}, // 入
-    {0x5168, 0xC8AB}, // 全
-    {0x516B, 0xB0CB}, // 八
-    {0x516C, 0xB9AB}, // 公
-    {0x516D, 0xC1F9}, // 六
-    {0x5170, 0xC0BC}, // 兰
-    {0x5171, 0xB9B2}, // 共
-    {0x5173, 0xB9D8}, // 关
-    {0x5174, 0xD0CB}, // 兴
-    {0x5175, 0xB1F8}, // 兵
-    {0x5176, 0xC6E4}, // 其
-    {0x5177, 0xBEDF}, // 具
-    {0x517B, 0xD1F8}, // 养
-    {0x517C, 0xBCE6}, // 兼
-    {0x517D, 0xCADE}, // 兽
-    {0x5185, 0xC4DA}, // 内
-    {0x5189, 0xC8BD}, // 冉
-    {0x518C, 0xB2E1}, // 册
-    {0x518D, 0xD4D9}, // 再
-    {0x5192, 0xC3B0}, // 冒
-    {0x5199, 0xD0B4}, // 写
-    {0x519B, 0xBEFC}, // 军
-    {0x519C, 0xC5A9}, // 农
-    {0x51A0, 0xB9DA}, // 冠
-    {0x51AC, 0xB6AC}, // 冬
-    {0x51AF, 0xB7EB}, // 冯
-    {0x51B0, 0xB1F9}, // 冰
-    {0x51B2, 0xB3E5}, // 冲
-    {0x51B3, 0xBEF6}, // 决
-    {0x51B7, 0xC0E4}, // 冷
-    {0x51BB, 0xB6B3}, // 冻
-    {0x51C4, 0xC6E0}, // 凄
-    {0x51C6, 0xD7BC}, // 准
-    {0x51CC, 0xC1E8}, // 凌
-    {0x51CF, 0xBCF5}, // 减
-    {0x51E0, 0xBCB8}, // 几
-    {0x51E1, 0xB7B2}, // 凡
-    {0x51E4, 0xB7EF}, // 凤
-    {0x51EF, 0xBFAD}, // 凯
-    {0x51F0, 0xBBCB}, // 凰
-    {0x51F6, 0xD0D7}, // 凶
-    {0x51F9, 0xB0BC}, // 凹
-    {0x51FA, 0xB3F6}, // 出
-    {0x51FB, 0xBBF7}, // 击
-    {0x51FD, 0xBAAF}, // 函
-    {0x51FF, 0xD4E4}, // 凿
-    {0x5200, 0xB5B6}, // 刀
-    {0x5201, 0xB5F3}, // 刁
-    {0x5206, 0xB7D6}, // 分
-    {0x5207, 0xC7D0}, // 切
-    {0x520A, 0xBFAF}, // 刊
-    {0x5212, 0xBBAE}, // 划
-    {0x5217, 0xC1D0}, // 列
-    {0x5218, 0xC1F5}, // 刘
-    {0x5219, 0xD4F2}, // 则
-    {0x521A, 0xB8D5}, // 刚
-    {0x521B, 0xB4B4}, // 创
-    {0x521D, 0xB3F5}, // 初
-    {0x5224, 0xC5D0}, // 判
-    {0x5229, 0xC0FB}, // 利
-    {0x522B, 0xB1F0}, // 别
-    {0x5230, 0xB5BD}, // 到
-    {0x5236, 0xD6C6}, // 制
-    {0x523B, 0xBFCC}, // 刻
-    {0x5242, 0xBCC1}, // 剂
-    {0x524A, 0xCFF7}, // 削
-    {0x524D, 0xC7B0}, // 前
-    {0x5251, 0xBDA3}, // 剑
-    {0x5267, 0xBEE7}, // 剧
-    {0x526F, 0xB8B1}, // 副
-    {0x5272, 0xB8EE}, // 割
-    {0x529B, 0xC1A6}, // 力
-    {0x529D, 0xC8B0}, // 劝
-    {0x529E, 0xB0EC}, // 办
-    {0x529F, 0xB9A6}, // 功
-    {0x52A0, 0xBCD3}, // 加
-    {0x52A1, 0xCEF1}, // 务
-    {0x52A8, 0xB6AF}, // 动
-    {0x52A9, 0xD6FA}, // 助
-    {0x52AA, 0xC5AC}, // 努
-    {0x52B2, 0xBEA2}, // 劲
-    {0x52B3, 0xC0CD}, // 劳
-    {0x52BF, 0xCAC6}, // 势
-    {0x52C7, 0xD3C2}, // 勇
-    {0x52CB, 0xD1AB}, // 勋
-    {0x52D2, 0xC0D5}, // 勒
-    {0x52E4, 0xC7DA}, // 勤
-    {0x5300, 0xD4C8}, // 匀
-    {0x5305, 0xB0FC}, // 包
-    {0x5306, 0xB4D2}, // 匆
-    {0x5316, 0xBBAF}, // 化
-    {0x5317, 0xB1B1}, // 北
-    {0x5320, 0xBDB3}, // 匠
-    {0x5321, 0xBFEF}, // 匡
-    {0x532A, 0xB7CB}, // 匪
-    {0x533A, 0xC7F8}, // 区
-    {0x533B, 0xD2BD}, // 医
-    {0x5341, 0xCAAE}, // 十
-    {0x5343, 0xC7A7}, // 千
-    {0x5347, 0xC9FD}, // 升
-    {0x5348, 0xCEE7}, // 午
-    {0x5349, 0xBBDC}, // 卉
-    {0x534A, 0xB0EB}, // 半
-    {0x534E, 0xBBAA}, // 华
-    {0x534F, 0xD0AD}, // 协
-    {0x5353, 0xD7BF}, // 卓
-    {0x5355, 0xB5A5}, // 单
-    {0x5357, 0xC4CF}, // 南
-    {0x535A, 0xB2A9}, // 博
-    {0x535C, 0xB2B7}, // 卜
-    {0x535E, 0xB1E5}, // 卞
-    {0x5360, 0xD5BC}, // 占
-    {0x5361, 0xBFA8}, // 卡
-    {0x5362, 0xC2AC}, // 卢
-    {0x5364, 0xC2B1}, // 卤
-    {0x536B, 0xCEC0}, // 卫
-    {0x5370, 0xD3A1}, // 印
-    {0x5371, 0xCEA3}, // 危
-    {0x5373, 0xBCB4}, // 即
-    {0x5374, 0xC8B4}, // 却
-    {0x5375, 0xC2D1}, // 卵
-    {0x5377, 0xBEED}, // 卷
-    {0x537F, 0xC7E4}, // 卿
-    {0x5382, 0xB3A7}, // 厂
-    {0x5384, 0xB6F2}, // 厄
-    {0x5385, 0xCCFC}, // 厅
-    {0x5386, 0xC0FA}, // 历
-    {0x5389, 0xC0F7}, // 厉
-    {0x538B, 0xD1B9}, // 压
-    {0x538C, 0xD1E1}, // 厌
-    {0x5398, 0xC0E5}, // 厘
-    {0x539A, 0xBAF1}, // 厚
-    {0x539F, 0xD4AD}, // 原
-    {0x53BB, 0xC8A5}, // 去
-    {0x53BF, 0xCFD8}, // 县
-    {0x53C2, 0xB2CE}, // 参
-    {0x53C8, 0xD3D6}, // 又
-    {0x53CA, 0xBCB0}, // 及
-    {0x53CB, 0xD3D1}, // 友
-    {0x53CC, 0xCBAB}, // 双
-    {0x53CD, 0xB7B4}, // 反
-    {0x53D1, 0xB7A2}, // 发
-    {0x53D4, 0xCAE5}, // 叔
-    {0x53D6, 0xC8A1}, // 取
-    {0x53D7, 0xCADC}, // 受
-    {0x53D8, 0xB1E4}, // 变
-    {0x53D9, 0xD0F0}, // 叙
-    {0x53E3, 0xBFDA}, // 口
-    {0x53E4, 0xB9C5}, // 古
-    {0x53E6, 0xC1ED}, // 另
-    {0x53EA, 0xD6BB}, // 只
-    {0x53EB, 0xBDD0}, // 叫
-    {0x53EC, 0xD5D9}, // 召
-    {0x53EF, 0xBFC9}, // 可
-    {0x53F0, 0xCCA8}, // 台
-    {0x53F2, 0xCAB7}, // 史
-    {0x53F3, 0xD3D2}, // 右
-    {0x53F6, 0xD2B6}, // 叶
-    {0x53F7, 0xBAC5}, // 号
-    {0x53F8, 0xCBBE}, // 司
-    {0x5403, 0xB3D4}, // 吃
-    {0x5404, 0xB8F7}, // 各
-    {0x5408, 0xBACF}, // 合
-    {0x5409, 0xBCAA}, // 吉
-    {0x540C, 0xCDAC}, // 同
-    {0x540D, 0xC3FB}, // 名
-    {0x540E, 0xBAF3}, // 后
-    {0x5411, 0xCFF2}, // 向
-    {0x5415, 0xC2C0}, // 吕
-    {0x5417, 0xC2F0}, // 吗
-    {0x541B, 0xBEFD}, // 君
-    {0x5426, 0xB7F1}, // 否
-    {0x5427, 0xB0C9}, // 吧
-    {0x542B, 0xBAAC}, // 含
-    {0x542C, 0xCCFD}, // 听
-    {0x542F, 0xC6F4}, // 启
-    {0x5434, 0xCEE2}, // 吴
-    {0x5435, 0xB3B3}, // 吵
-    {0x5438, 0xCEFC}, // 吸
-    {0x5439, 0xB4B5}, // 吹
-    {0x5440, 0xD1BD}, // 呀
-    {0x5446, 0xB4F4}, // 呆
-    {0x5448, 0xB3CA}, // 呈
-    {0x5458, 0xD4B1}, // 员
-    {0x545C, 0xCED8}, // 呜
-    {0x5462, 0xC4D8}, // 呢
-    {0x5468, 0xD6DC}, // 周
-    {0x5473, 0xCEB6}, // 味
-    {0x547C, 0xBAF4}, // 呼
-    {0x547D, 0xC3FC}, // 命
-    {0x548C, 0xBACD}, // 和
-    {0x548F, 0xD3BD}, // 咏
-    {0x5496, 0xBFA7}, // 咖
-    {0x54AC, 0xD2A7}, // 咬
-    {0x54AF, 0xBFA9}, // 咯
-    {0x54B1, 0xD4DB}, // 咱
-    {0x54B8, 0xCFCC}, // 咸
-    {0x54C1, 0xC6B7}, // 品
-    {0x54C7, 0xCDDB}, // 哇
-    {0x54C8, 0xB9FE}, // 哈
-    {0x54CD, 0xCFEC}, // 响
-    {0x54CE, 0xB0A5}, // 哎
-    {0x54DF, 0xD3B4}, // 哟
-    {0x54E5, 0xB8E7}, // 哥
-    {0x54EA, 0xC4C4}, // 哪
-    {0x54F2, 0xD5DC}, // 哲
-    {0x5501, 0xD1E4}, // 唁
-    {0x5510, 0xCCC6}, // 唐
-    {0x552F, 0xCEA8}, // 唯
-    {0x5546, 0xC9CC}, // 商
-    {0x554A, 0xB0A1}, // 啊
-    {0x5566, 0xC0B2}, // 啦
-    {0x557C, 0xCCE4}, // 啼
-    {0x5582, 0xCEB9}, // 喂
-    {0x5584, 0xC9C6}, // 善
-    {0x558A, 0xBAB0}, // 喊
-    {0x559C, 0xCFB2}, // 喜
-    {0x55A7, 0xD0FA}, // 喧
-    {0x55B7, 0xC5E7}, // 喷
-    {0x55BB, 0xD3F7}, // 喻
-    {0x55DC, 0xCAC8}, // 嗜
-    {0x5609, 0xBCCE}, // 嘉
-    {0x561B, 0xC2EF}, // 嘛
-    {0x5668, 0xC6F7}, // 器
-    {0x568E, 0xBABF}, // 嚎
-    {0x56DB, 0xCBC4}, // 四
-    {0x56DE, 0xBBD8}, // 回
-    {0x56E0, 0xD2F2}, // 因
-    {0x56E2, 0xCDC5}, // 团
-    {0x56E4, 0xB6DA}, // 囤
-    {0x56F0, 0xC0A7}, // 困
-    {0x56F4, 0xCEA7}, // 围
-    {0x56FD, 0xB9FA}, // 国
-    {0x56FE, 0xCDBC}, // 图
-    {0x5706, 0xD4B2}, // 圆
-    {0x5708, 0xC8A6}, // 圈
-    {0x571F, 0xCDC1}, // 土
-    {0x5723, 0xCAA5}, // 圣
-    {0x5728, 0xD4DA}, // 在
-    {0x5730, 0xB5D8}, // 地
-    {0x573A, 0xB3A1}, // 场
-    {0x573E, 0xBBF8}, // 圾
-    {0x5747, 0xBEF9}, // 均
-    {0x574D, 0xCCAE}, // 坍
-    {0x574F, 0xBBB5}, // 坏
-    {0x5757, 0xBFE9}, // 块
-    {0x575A, 0xBCE1}, // 坚
-    {0x575F, 0xB7D8}, // 坟
-    {0x5764, 0xC0A4}, // 坤
-    {0x5782, 0xB4B9}, // 垂
-    {0x578B, 0xD0CD}, // 型
-    {0x57A2, 0xB9B8}, // 垢
-    {0x57A3, 0xD4AB}, // 垣
-    {0x57C3, 0xB0A3}, // 埃
-    {0x57CE, 0xB3C7}, // 城
-    {0x57DF, 0xD3F2}, // 域
-    {0x57F9, 0xC5E0}, // 培
-    {0x57FA, 0xBBF9}, // 基
-    {0x5802, 0xCCC3}, // 堂
-    {0x5854, 0xCBFE}, // 塔
-    {0x585E, 0xC8FB}, // 塞
-    {0x589E, 0xD4F6}, // 增
-    {0x58D5, 0xBABE}, // 壕
-    {0x58EB, 0xCABF}, // 士
-    {0x58EE, 0xD7B3}, // 壮
-    {0x58F0, 0xC9F9}, // 声
-    {0x5904, 0xB4A6}, // 处
-    {0x5907, 0xB1B8}, // 备
-    {0x590D, 0xB8B4}, // 复
-    {0x590F, 0xCFC4}, // 夏
-    {0x5915, 0xCFA6}, // 夕
-    {0x5916, 0xCDE2}, // 外
-    {0x591A, 0xB6E0}, // 多
-    {0x591C, 0xD2B9}, // 夜
-    {0x591F, 0xB9BB}, // 够
-    {0x5927, 0xB4F3}, // 大
-    {0x5929, 0xCCEC}, // 天
-    {0x592A, 0xCCAB}, // 太
-    {0x592B, 0xB7F2}, // 夫
-    {0x592E, 0xD1EB}, // 央
-    {0x5931, 0xCAA7}, // 失
-    {0x5934, 0xCDB7}, // 头
-    {0x5937, 0xD2C4}, // 夷
-    {0x5939, 0xBCD0}, // 夹
-    {0x593A, 0xB6E1}, // 夺
-    {0x5947, 0xC6E6}, // 奇
-    {0x5949, 0xB7EE}, // 奉
-    {0x594B, 0xB7DC}, // 奋
-    {0x594E, 0xBFFC}, // 奎
-    {0x5957, 0xCCD7}, // 套
-    {0x5960, 0xB5EC}, // 奠
-    {0x5973, 0xC5AE}, // 女
-    {0x5976, 0xC4CC}, // 奶
-    {0x5978, 0xBCE9}, // 奸
-    {0x5979, 0xCBFD}, // 她
-    {0x597D, 0xBAC3}, // 好
-    {0x5982, 0xC8E7}, // 如
-    {0x5986, 0xD7B1}, // 妆
-    {0x5987, 0xB8BE}, // 妇
-    {0x5988, 0xC2E8}, // 妈
-    {0x5996, 0xD1FD}, // 妖
-    {0x59A5, 0xCDD7}, // 妥
-    {0x59A8, 0xB7C1}, // 妨
-    {0x59B9, 0xC3C3}, // 妹
-    {0x59BB, 0xC6DE}, // 妻
-    {0x59C6, 0xC4B7}, // 姆
-    {0x59CB, 0xCABC}, // 始
-    {0x59D1, 0xB9C3}, // 姑
-    {0x59D4, 0xCEAF}, // 委
-    {0x59DA, 0xD2A6}, // 姚
-    {0x59DC, 0xBDAA}, // 姜
-    {0x59E8, 0xD2CC}, // 姨
-    {0x59EC, 0xBCA7}, // 姬
-    {0x5A01, 0xCDFE}, // 威
-    {0x5A04, 0xC2A6}, // 娄
-    {0x5A07, 0xBDBF}, // 娇
-    {0x5A1C, 0xC4C8}, // 娜
-    {0x5A1F, 0xBEEA}, // 娟
-    {0x5A25, 0xB6F0}, // 娥
-    {0x5A49, 0xCDF1}, // 婉
-    {0x5A5A, 0xBBE9}, // 婚
-    {0x5A9A, 0xC3C4}, // 媚
-    {0x5AB3, 0xCFB1}, // 媳
-    {0x5AC9, 0xBCB5}, // 嫉
-    {0x5ACC, 0xCFD3}, // 嫌
-    {0x5B50, 0xD7D3}, // 子
-    {0x5B54, 0xBFD7}, // 孔
-    {0x5B57, 0xD7D6}, // 字
-    {0x5B58, 0xB4E6}, // 存
-    {0x5B59, 0xCBEF}, // 孙
-    {0x5B5D, 0xD0A2}, // 孝
-    {0x5B5F, 0xC3CF}, // 孟
-    {0x5B63, 0xBCBE}, // 季
-    {0x5B64, 0xB9C2}, // 孤
-    {0x5B66, 0xD1A7}, // 学
-    {0x5B69, 0xBAA2}, // 孩
-    {0x5B6A, 0xC2CF}, // 孪
-    {0x5B7A, 0xC8E6}, // 孺
-    {0x5B81, 0xC4FE}, // 宁
-    {0x5B83, 0xCBFC}, // 它
-    {0x5B87, 0xD3EE}, // 宇
-    {0x5B88, 0xCAD8}, // 守
-    {0x5B89, 0xB0B2}, // 安
-    {0x5B8B, 0xCBCE}, // 宋
-    {0x5B8C, 0xCDEA}, // 完
-    {0x5B8F, 0xBAEA}, // 宏
-    {0x5B97, 0xD7DA}, // 宗
-    {0x5B98, 0xB9D9}, // 官
-    {0x5B99, 0xD6E6}, // 宙
-    {0x5B9A, 0xB6A8}, // 定
-    {0x5B9B, 0xCDF0}, // 宛
-    {0x5B9C, 0xD2CB}, // 宜
-    {0x5B9D, 0xB1A6}, // 宝
-    {0x5B9E, 0xCAB5}, // 实
-    {0x5BA1, 0xC9F3}, // 审
-    {0x5BA2, 0xBFCD}, // 客
-    {0x5BA3, 0xD0FB}, // 宣
-    {0x5BA4, 0xCAD2}, // 室
-    {0x5BA6, 0xBBC2}, // 宦
-    {0x5BAA, 0xCFDC}, // 宪
-    {0x5BAB, 0xB9AC}, // 宫
-    {0x5BB3, 0xBAA6}, // 害
-    {0x5BB4, 0xD1E7}, // 宴
-    {0x5BB5, 0xCFFC}, // 宵
-    {0x5BB6, 0xBCD2}, // 家
-    {0x5BB9, 0xC8DD}, // 容
-    {0x5BBD, 0xBFED}, // 宽
-    {0x5BBE, 0xB1F6}, // 宾
-    {0x5BC2, 0xBCC5}, // 寂
-    {0x5BC4, 0xBCC4}, // 寄
-    {0x5BC5, 0xD2FA}, // 寅
-    {0x5BC6, 0xC3DC}, // 密
-    {0x5BCC, 0xB8BB}, // 富
-    {0x5BD0, 0xC3C2}, // 寐
-    {0x5BDF, 0xB2EC}, // 察
-    {0x5BE8, 0xD5AF}, // 寨
-    {0x5BF8, 0xB4E7}, // 寸
-    {0x5BF9, 0xB6D4}, // 对
-    {0x5BFA, 0xCBC2}, // 寺
-    {0x5BFB, 0xD1B0}, // 寻
-    {0x5BFC, 0xB5BC}, // 导
-    {0x5BFF, 0xCAD9}, // 寿
-    {0x5C01, 0xB7E2}, // 封
-    {0x5C04, 0xC9E4}, // 射
-    {0x5C06, 0xBDAB}, // 将
-    {0x5C0F, 0xD0A1}, // 小
-    {0x5C11, 0xC9D9}, // 少
-    {0x5C14, 0xB6FB}, // 尔
-    {0x5C16, 0xBCE2}, // 尖
-    {0x5C1A, 0xC9D0}, // 尚
-    {0x5C1D, 0xB3A2}, // 尝
-    {0x5C24, 0xD3C8}, // 尤
-    {0x5C27, 0xD2A2}, // 尧
-    {0x5C31, 0xBECD}, // 就
-    {0x5C38, 0xCAAC}, // 尸
-    {0x5C39, 0xD2FC}, // 尹
-    {0x5C3A, 0xB3DF}, // 尺
-    {0x5C3C, 0xC4E1}, // 尼
-    {0x5C3D, 0xBEA1}, // 尽
-    {0x5C3E, 0xCEB2}, // 尾
-    {0x5C40, 0xBED6}, // 局
-    {0x5C42, 0xB2E3}, // 层
-    {0x5C45, 0xBED3}, // 居
-    {0x5C48, 0xC7FC}, // 屈
-    {0x5C49, 0xCCEB}, // 屉
-    {0x5C4A, 0xBDEC}, // 届
-    {0x5C55, 0xD5B9}, // 展
-    {0x5C5E, 0xCAF4}, // 属
-    {0x5C60, 0xCDC0}, // 屠
-    {0x5C61, 0xC2C5}, // 屡
-    {0x5C65, 0xC2C4}, // 履
-    {0x5C6F, 0xCDCD}, // 屯
-    {0x5C71, 0xC9BD}, // 山
-    {0x5C82, 0xC6F1}, // 岂
-    {0x5C9B, 0xB5BA}, // 岛
-    {0x5CA9, 0xD1D2}, // 岩
-    {0x5CAD, 0xC1EB}, // 岭
-    {0x5CB3, 0xD4C0}, // 岳
-    {0x5CB8, 0xB0B6}, // 岸
-    {0x5CED, 0xC7CD}, // 峭
-    {0x5CF0, 0xB7E5}, // 峰
-    {0x5D07, 0xB3E7}, // 崇
-    {0x5D14, 0xB4DE}, // 崔
-    {0x5D2D, 0xD5B8}, // 崭
-    {0x5DCD, 0xCEA1}, // 巍
-    {0x5DDD, 0xB4A8}, // 川
-    {0x5DDE, 0xD6DD}, // 州
-    {0x5DE1, 0xD1B2}, // 巡
-    {0x5DE2, 0xB3B2}, // 巢
-    {0x5DE5, 0xB9A4}, // 工
-    {0x5DE6, 0xD7F3}, // 左
-    {0x5DE7, 0xC7C9}, // 巧
-    {0x5DE8, 0xBEDE}, // 巨
-    {0x5DE9, 0xB9AE}, // 巩
-    {0x5DEB, 0xCED7}, // 巫
-    {0x5DEE, 0xB2EE}, // 差
-    {0x5DF1, 0xBCBA}, // 己
-    {0x5DF2, 0xD2D1}, // 已
-    {0x5DF3, 0xCBC8}, // 巳
-    {0x5DF4, 0xB0CD}, // 巴
-    {0x5E02, 0xCAD0}, // 市
-    {0x5E03, 0xB2BC}, // 布
-    {0x5E08, 0xCAA6}, // 师
-    {0x5E0C, 0xCFA3}, // 希
-    {0x5E1B, 0xB2AF}, // 帛
-    {0x5E1D, 0xB5DB}, // 帝
-    {0x5E26, 0xB4F8}, // 带
-    {0x5E2D, 0xCFAF}, // 席
-    {0x5E2E, 0xB0EF}, // 帮
-    {0x5E38, 0xB3A3}, // 常
-    {0x5E3D, 0xC3B1}, // 帽
-    {0x5E42, 0xC3DD}, // 幂
-    {0x5E72, 0xB8C9}, // 干
-    {0x5E73, 0xC6BD}, // 平
-    {0x5E74, 0xC4EA}, // 年
-    {0x5E76, 0xB2A2}, // 并
-    {0x5E78, 0xD0D2}, // 幸
-    {0x5E7B, 0xBBC3}, // 幻
-    {0x5E7C, 0xD3D7}, // 幼
-    {0x5E7F, 0xB9E3}, // 广
-    {0x5E84, 0xD7AF}, // 庄
-    {0x5E86, 0xC7EC}, // 庆
-    {0x5E8A, 0xB4B2}, // 床
-    {0x5E8F, 0xD0F2}, // 序
-    {0x5E94, 0xD3A6}, // 应
-    {0x5E95, 0xB5D7}, // 底
-    {0x5E99, 0xC3ED}, // 庙
-    {0x5E9A, 0xB8FD}, // 庚
-    {0x5E9C, 0xB8AE}, // 府
-    {0x5E9E, 0xC5D3}, // 庞
-    {0x5EA6, 0xB6C8}, // 度
-    {0x5EA7, 0xD7F9}, // 座
-    {0x5EAD, 0xCDA5}, // 庭
-    {0x5EB6, 0xCAFC}, // 庶
-    {0x5EB7, 0xBFB5}, // 康
-    {0x5ED6, 0xC1CE}, // 廖
-    {0x5EF6, 0xD1D3}, // 延
-    {0x5EF7, 0xCDA2}, // 廷
-    {0x5EFA, 0xBDA8}, // 建
-    {0x5F00, 0xBFAA}, // 开
-    {0x5F02, 0xD2EC}, // 异
-    {0x5F03, 0xC6FA}, // 弃
-    {0x5F0A, 0xB1D7}, // 弊
-    {0x5F0F, 0xCABD}, // 式
-    {0x5F13, 0xB9AD}, // 弓
-    {0x5F15, 0xD2FD}, // 引
-    {0x5F1B, 0xB3DA}, // 弛
-    {0x5F1F, 0xB5DC}, // 弟
-    {0x5F20, 0xD5C5}, // 张
-    {0x5F31, 0xC8F5}, // 弱
-    {0x5F39, 0xB5AF}, // 弹
-    {0x5F3A, 0xC7BF}, // 强
-    {0x5F52, 0xB9E9}, // 归
-    {0x5F53, 0xB5B1}, // 当
-    {0x5F55, 0xC2BC}, // 录
-    {0x5F62, 0xD0CE}, // 形
-    {0x5F64, 0xCDAE}, // 彤
-    {0x5F66, 0xD1E5}, // 彦
-    {0x5F69, 0xB2CA}, // 彩
-    {0x5F6A, 0xB1EB}, // 彪
-    {0x5F6C, 0xB1F2}, // 彬
-    {0x5F6D, 0xC5ED}, // 彭
-    {0x5F71, 0xD3B0}, // 影
-    {0x5F7B, 0xB3B9}, // 彻
-    {0x5F80, 0xCDF9}, // 往
-    {0x5F81, 0xD5F7}, // 征
-    {0x5F84, 0xBEB6}, // 径
-    {0x5F85, 0xB4FD}, // 待
-    {0x5F88, 0xBADC}, // 很
-    {0x5F8A, 0xBBB2}, // 徊
-    {0x5F8B, 0xC2C9}, // 律
-    {0x5F90, 0xD0EC}, // 徐
-    {0x5F97, 0xB5C3}, // 得
-    {0x5FAE, 0xCEA2}, // 微
-    {0x5FB7, 0xB5C2}, // 德
-    {0x5FC3, 0xD0C4}, // 心
-    {0x5FC5, 0xB1D8}, // 必
-    {0x5FC6, 0xD2E4}, // 忆
-    {0x5FD7, 0xD6BE}, // 志
-    {0x5FD9, 0xC3A6}, // 忙
-    {0x5FE0, 0xD6D2}, // 忠
-    {0x5FE7, 0xD3C7}, // 忧
-    {0x5FEB, 0xBFEC}, // 快
-    {0x5FF1, 0xB3C0}, // 忱
-    {0x5FF5, 0xC4EE}, // 念
-    {0x6000, 0xBBB3}, // 怀
-    {0x6001, 0xCCAC}, // 态
-    {0x600E, 0xD4F5}, // 怎
-    {0x6012, 0xC5AD}, // 怒
-    {0x6015, 0xC5C2}, // 怕
-    {0x6016, 0xB2C0}, // 怖
-    {0x601D, 0xCBBC}, // 思
-    {0x6020, 0xB5A1}, // 怠
-    {0x6025, 0xBCB1}, // 急
-    {0x6027, 0xD0D4}, // 性
-    {0x602A, 0xB9D6}, // 怪
-    {0x603B, 0xD7DC}, // 总
-    {0x6052, 0xBAE3}, // 恒
-    {0x6068, 0xBADE}, // 恨
-    {0x6069, 0xB6F7}, // 恩
-    {0x606D, 0xB9A7}, // 恭
-    {0x6084, 0xC7C4}, // 悄
-    {0x6094, 0xBBDA}, // 悔
-    {0x609F, 0xCEF2}, // 悟
-    {0x60A3, 0xBBBC}, // 患
-    {0x60A6, 0xD4C3}, // 悦
-    {0x60AC, 0xD0FC}, // 悬
-    {0x60B2, 0xB1AF}, // 悲
-    {0x60C5, 0xC7E9}, // 情
-    {0x60DF, 0xCEA9}, // 惟
-    {0x60E0, 0xBBDD}, // 惠
-    {0x60EB, 0xB1B9}, // 惫
-    {0x60ED, 0xB2D1}, // 惭
-    {0x60EE, 0xB5AC}, // 惮
-    {0x60F3, 0xCFEB}, // 想
-    {0x6108, 0xD3FA}, // 愈
-    {0x6109, 0xD3E4}, // 愉
-    {0x610F, 0xD2E2}, // 意
-    {0x611F, 0xB8D0}, // 感
-    {0x6148, 0xB4C8}, // 慈
-    {0x614E, 0xC9F7}, // 慎
-    {0x6162, 0xC2FD}, // 慢
-    {0x6167, 0xBBDB}, // 慧
-    {0x6168, 0xBFAE}, // 慨
-    {0x618B, 0xB1EF}, // 憋
-    {0x61A8, 0xBAA9}, // 憨
-    {0x61C2, 0xB6AE}, // 懂
-    {0x61C8, 0xD0B8}, // 懈
-    {0x6208, 0xB8EA}, // 戈
-    {0x620E, 0xC8D6}, // 戎
-    {0x620F, 0xCFB7}, // 戏
-    {0x6210, 0xB3C9}, // 成
-    {0x6211, 0xCED2}, // 我
-    {0x6212, 0xBDE4}, // 戒
-    {0x6216, 0xBBF2}, // 或
-    {0x6218, 0xD5BD}, // 战
-    {0x621A, 0xC6DD}, // 戚
-    {0x622A, 0xBDD8}, // 截
-    {0x6234, 0xB4F7}, // 戴
-    {0x623F, 0xB7BF}, // 房
-    {0x6240, 0xCBF9}, // 所
-    {0x624B, 0xCAD6}, // 手
-    {0x624D, 0xB2C5}, // 才
-    {0x624E, 0xD4FA}, // 扎
-    {0x6253, 0xB4F2}, // 打
-    {0x6254, 0xC8D3}, // 扔
-    {0x6263, 0xBFDB}, // 扣
-    {0x6267, 0xD6B4}, // 执
-    {0x6269, 0xC0A9}, // 扩
-    {0x626B, 0xC9A8}, // 扫
-    {0x626C, 0xD1EF}, // 扬
-    {0x626D, 0xC5A4}, // 扭
-    {0x6279, 0xC5FA}, // 批
-    {0x627E, 0xD5D2}, // 找
-    {0x627F, 0xB3D0}, // 承
-    {0x6280, 0xBCBC}, // 技
-    {0x628A, 0xB0D1}, // 把
-    {0x6293, 0xD7A5}, // 抓
-    {0x6295, 0xCDB6}, // 投
-    {0x6298, 0xD5DB}, // 折
-    {0x629B, 0xC5D7}, // 抛
-    {0x62A2, 0xC7C0}, // 抢
-    {0x62A4, 0xBBA4}, // 护
-    {0x62A5, 0xB1A8}, // 报
-    {0x62BC, 0xD1BA}, // 押
-    {0x62BD, 0xB3E9}, // 抽
-    {0x62BF, 0xC3F2}, // 抿
-    {0x62C2, 0xB7F7}, // 拂
-    {0x62C5, 0xB5A3}, // 担
-    {0x62C6, 0xB2F0}, // 拆
-    {0x62C9, 0xC0AD}, // 拉
-    {0x62D3, 0xCDD8}, // 拓
-    {0x62D6, 0xCDCF}, // 拖
-    {0x62DC, 0xB0DD}, // 拜
-    {0x62E5, 0xD3B5}, // 拥
-    {0x62E8, 0xB2A6}, // 拨
-    {0x62EC, 0xC0A8}, // 括
-    {0x62F4, 0xCBA9}, // 拴
-    {0x62FF, 0xC4C3}, // 拿
-    {0x6301, 0xB3D6}, // 持
-    {0x6307, 0xD6B8}, // 指
-    {0x6309, 0xB0B4}, // 按
-    {0x6316, 0xCDDA}, // 挖
-    {0x631B, 0xC2CE}, // 挛
-    {0x631E, 0xCCA2}, // 挞
-    {0x6325, 0xBBD3}, // 挥
-    {0x632F, 0xD5F1}, // 振
-    {0x633A, 0xCDA6}, // 挺
-    {0x634D, 0xBAB4}, // 捍
-    {0x634E, 0xC9D3}, // 捎
-    {0x634F, 0xC4F3}, // 捏
-    {0x635F, 0xCBF0}, // 损
-    {0x6361, 0xBCF1}, // 捡
-    {0x6362, 0xBBBB}, // 换
-    {0x636E, 0xBEDD}, // 据
-    {0x6377, 0xBDDD}, // 捷
-    {0x638C, 0xD5C6}, // 掌
-    {0x6392, 0xC5C5}, // 排
-    {0x6396, 0xD2B4}, // 掖
-    {0x63A2, 0xCCBD}, // 探
-    {0x63A5, 0xBDD3}, // 接
-    {0x63A7, 0xBFD8}, // 控
-    {0x63A8, 0xCDC6}, // 推
-    {0x63A9, 0xD1DA}, // 掩
-    {0x63AA, 0xB4EB}, // 措
-    {0x63C9, 0xC8E0}, // 揉
-    {0x63CF, 0xC3E8}, // 描
-    {0x63D0, 0xCCE1}, // 提
-    {0x63D2, 0xB2E5}, // 插
-    {0x63E1, 0xCED5}, // 握
-    {0x63E9, 0xBFAB}, // 揩
-    {0x6402, 0xC2A7}, // 搂
-    {0x6410, 0xB4A4}, // 搐
-    {0x641E, 0xB8E3}, // 搞
-    {0x642C, 0xB0E1}, // 搬
-    {0x643A, 0xD0AF}, // 携
-    {0x6446, 0xB0DA}, // 摆
-    {0x6447, 0xD2A1}, // 摇
-    {0x64AC, 0xC7CB}, // 撬
-    {0x64AD, 0xB2A5}, // 播
-    {0x64B0, 0xD7AB}, // 撰
-    {0x64C5, 0xC9C3}, // 擅
-    {0x64CD, 0xB2D9}, // 操
-    {0x64D2, 0xC7DC}, // 擒
-    {0x6500, 0xC5CA}, // 攀
-    {0x652F, 0xD6A7}, // 支
-    {0x6536, 0xCAD5}, // 收
-    {0x6539, 0xB8C4}, // 改
-    {0x653B, 0xB9A5}, // 攻
-    {0x653E, 0xB7C5}, // 放
-    {0x653F, 0xD5FE}, // 政
-    {0x6545, 0xB9CA}, // 故
-    {0x6548, 0xD0A7}, // 效
-    {0x654C, 0xB5D0}, // 敌
-    {0x654F, 0xC3F4}, // 敏
-    {0x6559, 0xBDCC}, // 教
-    {0x655D, 0xB1D6}, // 敝
-    {0x6562, 0xB8D2}, // 敢
-    {0x6563, 0xC9A2}, // 散
-    {0x6566, 0xB6D8}, // 敦
-    {0x656C, 0xBEB4}, // 敬
-    {0x6570, 0xCAFD}, // 数
-    {0x6574, 0xD5FB}, // 整
-    {0x6587, 0xCEC4}, // 文
-    {0x658C, 0xB1F3}, // 斌
-    {0x6591, 0xB0DF}, // 斑
-    {0x6597, 0xB6B7}, // 斗
-    {0x6599, 0xC1CF}, // 料
-    {0x659C, 0xD0B1}, // 斜
-    {0x659F, 0xD5E5}, // 斟
-    {0x65A4, 0xBDEF}, // 斤
-    {0x65A9, 0xD5B6}, // 斩
-    {0x65AD, 0xB6CF}, // 断
-    {0x65AF, 0xCBB9}, // 斯
-    {0x65B0, 0xD0C2}, // 新
-    {0x65B9, 0xB7BD}, // 方
-    {0x65BD, 0xCAA9}, // 施
-    {0x65C1, 0xC5D4}, // 旁
-    {0x65CB, 0xD0FD}, // 旋
-    {0x65CF, 0xD7E5}, // 族
-    {0x65E0, 0xCEDE}, // 无
-    {0x65E2, 0xBCC8}, // 既
-    {0x65E5, 0xC8D5}, // 日
-    {0x65E7, 0xBEC9}, // 旧
-    {0x65E8, 0xD6BC}, // 旨
-    {0x65E9, 0xD4E7}, // 早
-    {0x65EC, 0xD1AE}, // 旬
-    {0x65ED, 0xD0F1}, // 旭
-    {0x65F1, 0xBAB5}, // 旱
-    {0x65F6, 0xCAB1}, // 时
-    {0x65FA, 0xCDFA}, // 旺
-    {0x6606, 0xC0A5}, // 昆
-    {0x660C, 0xB2FD}, // 昌
-    {0x660E, 0xC3F7}, // 明
-    {0x6613, 0xD2D7}, // 易
-    {0x661F, 0xD0C7}, // 星
-    {0x6620, 0xD3B3}, // 映
-    {0x6625, 0xB4BA}, // 春
-    {0x6628, 0xD7F2}, // 昨
-    {0x662D, 0xD5D1}, // 昭
-    {0x662F, 0xCAC7}, // 是
-    {0x663E, 0xCFD4}, // 显
-    {0x6643, 0xBBCE}, // 晃
-    {0x664B, 0xBDFA}, // 晋
-    {0x6653, 0xCFFE}, // 晓
-    {0x6655, 0xD4CE}, // 晕
-    {0x665A, 0xCDED}, // 晚
-    {0x6664, 0xCEEE}, // 晤
-    {0x6666, 0xBBDE}, // 晦
-    {0x6668, 0xB3BF}, // 晨
-    {0x666E, 0xC6D5}, // 普
-    {0x666F, 0xBEB0}, // 景
-    {0x6674, 0xC7E7}, // 晴
-    {0x6676, 0xBEA7}, // 晶
-    {0x667A, 0xD6C7}, // 智
-    {0x6687, 0xCFBE}, // 暇
-    {0x6697, 0xB0B5}, // 暗
-    {0x66AE, 0xC4BA}, // 暮
-    {0x66B4, 0xB1A9}, // 暴
-    {0x66D9, 0xCAEF}, // 曙
-    {0x66F0, 0xD4BB}, // 曰
-    {0x66F2, 0xC7FA}, // 曲
-    {0x66F3, 0xD2B7}, // 曳
-    {0x66F4, 0xB8FC}, // 更
-    {0x66F9, 0xB2DC}, // 曹
-    {0x66FC, 0xC2FC}, // 曼
-    {0x66FE, 0xD4F8}, // 曾
-    {0x66FF, 0xCCE6}, // 替
-    {0x6700, 0xD7EE}, // 最
-    {0x6708, 0xD4C2}, // 月
-    {0x6709, 0xD3D0}, // 有
-    {0x670B, 0xC5F3}, // 朋
-    {0x670D, 0xB7FE}, // 服
-    {0x671B, 0xCDFB}, // 望
-    {0x671D, 0xB3AF}, // 朝
-    {0x671F, 0xC6DA}, // 期
-    {0x6728, 0xC4BE}, // 木
-    {0x672A, 0xCEB4}, // 未
-    {0x672B, 0xC4A9}, // 末
-    {0x672C, 0xB1BE}, // 本
-    {0x672F, 0xCAF5}, // 术
-    {0x6731, 0xD6EC}, // 朱
-    {0x6735, 0xB6E4}, // 朵
-    {0x673A, 0xBBFA}, // 机
-    {0x6740, 0xC9B1}, // 杀
-    {0x6742, 0xD4D3}, // 杂
-    {0x6743, 0xC8A8}, // 权
-    {0x6746, 0xB8CB}, // 杆
-    {0x674E, 0xC0EE}, // 李
-    {0x674F, 0xD0D3}, // 杏
-    {0x6750, 0xB2C4}, // 材
-    {0x6751, 0xB4E5}, // 村
-    {0x675C, 0xB6C5}, // 杜
-    {0x675F, 0xCAF8}, // 束
-    {0x6761, 0xCCF5}, // 条
-    {0x6765, 0xC0B4}, // 来
-    {0x6768, 0xD1EE}, // 杨
-    {0x676D, 0xBABC}, // 杭
-    {0x676F, 0xB1AD}, // 杯
-    {0x6770, 0xBDDC}, // 杰
-    {0x677E, 0xCBC9}, // 松
-    {0x677F, 0xB0E5}, // 板
-    {0x6781, 0xBCAB}, // 极
-    {0x6784, 0xB9B9}, // 构
-    {0x6790, 0xCEF6}, // 析
-    {0x6797, 0xC1D6}, // 林
-    {0x679C, 0xB9FB}, // 果
-    {0x679D, 0xD6A6}, // 枝
-    {0x67AA, 0xC7B9}, // 枪
-    {0x67AB, 0xB7E3}, // 枫
-    {0x67AF, 0xBFDD}, // 枯
-    {0x67B6, 0xBCDC}, // 架
-    {0x67CF, 0xB0D8}, // 柏
-    {0x67D0, 0xC4B3}, // 某
-    {0x67D1, 0xB8CC}, // 柑
-    {0x67D3, 0xC8BE}, // 染
-    {0x67E5, 0xB2E9}, // 查
-    {0x67EC, 0xBCED}, // 柬
-    {0x67EF, 0xBFC2}, // 柯
-    {0x67F1, 0xD6F9}, // 柱
-    {0x67F3, 0xC1F8}, // 柳
-    {0x67F4, 0xB2F1}, // 柴
-    {0x6807, 0xB1EA}, // 标
-    {0x6808, 0xD5BB}, // 栈
-    {0x680B, 0xB6B0}, // 栋
-    {0x6811, 0xCAF7}, // 树
-    {0x6821, 0xD0A3}, // 校
-    {0x682A, 0xD6EA}, // 株
-    {0x6837, 0xD1F9}, // 样
-    {0x6838, 0xBACB}, // 核
-    {0x6839, 0xB8F9}, // 根
-    {0x683C, 0xB8F1}, // 格
-    {0x6842, 0xB9F0}, // 桂
-    {0x6843, 0xCCD2}, // 桃
-    {0x6845, 0xCEA6}, // 桅
-    {0x6848, 0xB0B8}, // 案
-    {0x6851, 0xC9A3}, // 桑
-    {0x6853, 0xBBB8}, // 桓
-    {0x6863, 0xB5B5}, // 档
-    {0x6865, 0xC7C5}, // 桥
-    {0x6881, 0xC1BA}, // 梁
-    {0x6885, 0xC3B7}, // 梅
-    {0x68A8, 0xC0E6}, // 梨
-    {0x68B0, 0xD0B5}, // 械
-    {0x68B3, 0xCAE1}, // 梳
-    {0x68C0, 0xBCEC}, // 检
-    {0x68C9, 0xC3DE}, // 棉
-    {0x68CB, 0xC6E5}, // 棋
-    {0x68CD, 0xB9F7}, // 棍
-    {0x68D5, 0xD7D8}, // 棕
-    {0x68E0, 0xCCC4}, // 棠
-    {0x68EE, 0xC9AD}, // 森
-    {0x68F5, 0xBFC3}, // 棵
-    {0x690D, 0xD6B2}, // 植
-    {0x6930, 0xD2AC}, // 椰
-    {0x693F, 0xB4BB}, // 椿
-    {0x6977, 0xBFAC}, // 楷
-    {0x697C, 0xC2A5}, // 楼
-    {0x69D0, 0xBBB1}, // 槐
-    {0x69FD, 0xB2DB}, // 槽
-    {0x6A0A, 0xB7AE}, // 樊
-    {0x6A21, 0xC4A3}, // 模
-    {0x6A61, 0xCFF0}, // 橡
-    {0x6B20, 0xC7B7}, // 欠
-    {0x6B21, 0xB4CE}, // 次
-    {0x6B22, 0xBBB6}, // 欢
-    {0x6B23, 0xD0C0}, // 欣
-    {0x6B27, 0xC5B7}, // 欧
-    {0x6B32, 0xD3FB}, // 欲
-    {0x6B4C, 0xB8E8}, // 歌
-    {0x6B62, 0xD6B9}, // 止
-    {0x6B63, 0xD5FD}, // 正
-    {0x6B64, 0xB4CB}, // 此
-    {0x6B65, 0xB2BD}, // 步
-    {0x6B66, 0xCEE4}, // 武
-    {0x6B67, 0xC6E7}, // 歧
-    {0x6B7B, 0xCBC0}, // 死
-    {0x6B8B, 0xB2D0}, // 残
-    {0x6B96, 0xD6B3}, // 殖
-    {0x6BB5, 0xB6CE}, // 段
-    {0x6BB7, 0xD2F3}, // 殷
-    {0x6BBF, 0xB5EE}, // 殿
-    {0x6BC1, 0xBBD9}, // 毁
-    {0x6BC5, 0xD2E3}, // 毅
-    {0x6BCD, 0xC4B8}, // 母
-    {0x6BCF, 0xC3BF}, // 每
-    {0x6BD2, 0xB6BE}, // 毒
-    {0x6BD4, 0xB1C8}, // 比
-    {0x6BD5, 0xB1CF}, // 毕
-    {0x6BD6, 0xB1D1}, // 毖
-    {0x6BDB, 0xC3AB}, // 毛
-    {0x6BEB, 0xBAC1}, // 毫
-    {0x6C0F, 0xCACF}, // 氏
-    {0x6C11, 0xC3F1}, // 民
-    {0x6C14, 0xC6F8}, // 气
-    {0x6C1B, 0xB7D5}, // 氛
-    {0x6C27, 0xD1F5}, // 氧
-    {0x6C34, 0xCBAE}, // 水
-    {0x6C38, 0xD3C0}, // 永
-    {0x6C42, 0xC7F3}, // 求
-    {0x6C47, 0xBBE3}, // 汇
-    {0x6C49, 0xBABA}, // 汉
-    {0x6C55, 0xC9C7}, // 汕
-    {0x6C5B, 0xD1B4}, // 汛
-    {0x6C5D, 0xC8EA}, // 汝
-    {0x6C5F, 0xBDAD}, // 江
-    {0x6C60, 0xB3D8}, // 池
-    {0x6C64, 0xCCC0}, // 汤
-    {0x6C6A, 0xCDF4}, // 汪
-    {0x6C7D, 0xC6FB}, // 汽
-    {0x6C81, 0xC7DF}, // 沁
-    {0x6C88, 0xC9F2}, // 沈
-    {0x6C99, 0xC9B3}, // 沙
-    {0x6C9B, 0xC5E6}, // 沛
-    {0x6C9F, 0xB9B5}, // 沟
-    {0x6CA1, 0xC3BB}, // 没
-    {0x6CAB, 0xC4AD}, // 沫
-    {0x6CB3, 0xBAD3}, // 河
-    {0x6CB8, 0xB7D0}, // 沸
-    {0x6CB9, 0xD3CD}, // 油
-    {0x6CBB, 0xD6CE}, // 治
-    {0x6CBF, 0xD1D8}, // 沿
-    {0x6CC9, 0xC8AA}, // 泉
-    {0x6CCA, 0xB2B4}, // 泊
-    {0x6CD5, 0xB7A8}, // 法
-    {0x6CE2, 0xB2A8}, // 波
-    {0x6CE5, 0xC4E0}, // 泥
-    {0x6CE8, 0xD7A2}, // 注
-    {0x6CF0, 0xCCA9}, // 泰
-    {0x6CF5, 0xB1C3}, // 泵
-    {0x6CFD, 0xD4F3}, // 泽
-    {0x6D01, 0xBDE0}, // 洁
-    {0x6D0B, 0xD1F3}, // 洋
-    {0x6D12, 0xC8F7}, // 洒
-    {0x6D25, 0xBDF2}, // 津
-    {0x6D2A, 0xBAE9}, // 洪
-    {0x6D32, 0xD6DE}, // 洲
-    {0x6D3B, 0xBBEE}, // 活
-    {0x6D3C, 0xCDDD}, // 洼
-    {0x6D3E, 0xC5C9}, // 派
-    {0x6D41, 0xC1F7}, // 流
-    {0x6D4A, 0xD7C7}, // 浊
-    {0x6D4B, 0xB2E2}, // 测
-    {0x6D4E, 0xBCC3}, // 济
-    {0x6D66, 0xC6D6}, // 浦
-    {0x6D69, 0xBAC6}, // 浩
-    {0x6D6E, 0xB8A1}, // 浮
-    {0x6D77, 0xBAA3}, // 海
-    {0x6D78, 0xBDFE}, // 浸
-    {0x6D82, 0xCDBF}, // 涂
-    {0x6D88, 0xCFFB}, // 消
-    {0x6D9B, 0xCCCE}, // 涛
-    {0x6DA6, 0xC8F3}, // 润
-    {0x6DA8, 0xD5C7}, // 涨
-    {0x6DB2, 0xD2BA}, // 液
-    {0x6DB8, 0xBAD4}, // 涸
-    {0x6DC4, 0xD7CD}, // 淄
-    {0x6DD1, 0xCAE7}, // 淑
-    {0x6DE1, 0xB5AD}, // 淡
-    {0x6DE4, 0xD3D9}, // 淤
-    {0x6DEE, 0xBBB4}, // 淮
-    {0x6DF1, 0xC9EE}, // 深
-    {0x6DF7, 0xBBEC}, // 混
-    {0x6E05, 0xC7E5}, // 清
-    {0x6E10, 0xBDA5}, // 渐
-    {0x6E14, 0xD3E6}, // 渔
-    {0x6E17, 0xC9F8}, // 渗
-    {0x6E20, 0xC7FE}, // 渠
-    {0x6E21, 0xB6C9}, // 渡
-    {0x6E24, 0xB2B3}, // 渤
-    {0x6E29, 0xCEC2}, // 温
-    {0x6E38, 0xD3CE}, // 游
-    {0x6E58, 0xCFE6}, // 湘
-    {0x6E7F, 0xCAAA}, // 湿
-    {0x6E90, 0xD4B4}, // 源
-    {0x6EAA, 0xCFAA}, // 溪
-    {0x6EB6, 0xC8DC}, // 溶
-    {0x6EC1, 0xB3FC}, // 滁
-    {0x6EC7, 0xB5E1}, // 滇
-    {0x6ED1, 0xBBAC}, // 滑
-    {0x6ED3, 0xD7D2}, // 滓
-    {0x6EDA, 0xB9F6}, // 滚
-    {0x6EE1, 0xC2FA}, // 满
-    {0x6EE8, 0xB1F5}, // 滨
-    {0x6F14, 0xD1DD}, // 演
-    {0x6F31, 0xCAFE}, // 漱
-    {0x6F58, 0xC5CB}, // 潘
-    {0x6F66, 0xC1CA}, // 潦
-    {0x6F6E, 0xB3B1}, // 潮
-    {0x6F8E, 0xC5EC}, // 澎
-    {0x6FA1, 0xD4E8}, // 澡
-    {0x6FB3, 0xB0C4}, // 澳
-    {0x6FC0, 0xBCA4}, // 激
-    {0x6FEE, 0xE5A7}, // 濮
-    {0x704C, 0xB9E0}, // 灌
-    {0x706B, 0xBBF0}, // 火
-    {0x706D, 0xC3F0}, // 灭
-    {0x706F, 0xB5C6}, // 灯
-    {0x7070, 0xBBD2}, // 灰
-    {0x7075, 0xC1E9}, // 灵
-    {0x7076, 0xD4EE}, // 灶
-    {0x707E, 0xD4D6}, // 灾
-    {0x707F, 0xB2D3}, // 灿
-    {0x708E, 0xD1D7}, // 炎
-    {0x7092, 0xB3B4}, // 炒
-    {0x7094, 0xC8B2}, // 炔
-    {0x7095, 0xBFBB}, // 炕
-    {0x7099, 0xD6CB}, // 炙
-    {0x70AE, 0xC5DA}, // 炮
-    {0x70B3, 0xB1FE}, // 炳
-    {0x70B8, 0xD5A8}, // 炸
-    {0x70B9, 0xB5E3}, // 点
-    {0x70BD, 0xB3E3}, // 炽
-    {0x70C3, 0xCCFE}, // 烃
-    {0x70C8, 0xC1D2}, // 烈
-    {0x70DB, 0xD6F2}, // 烛
-    {0x70DF, 0xD1CC}, // 烟
-    {0x70E4, 0xBFBE}, // 烤
-    {0x70ED, 0xC8C8}, // 热
-    {0x70FD, 0xB7E9}, // 烽
-    {0x710A, 0xBAB8}, // 焊
-    {0x7115, 0xBBC0}, // 焕
-    {0x7126, 0xBDB9}, // 焦
-    {0x7136, 0xC8BB}, // 然
-    {0x714C, 0xBBCD}, // 煌
-    {0x714E, 0xBCE5}, // 煎
-    {0x7164, 0xC3BA}, // 煤
-    {0x7167, 0xD5D5}, // 照
-    {0x718A, 0xD0DC}, // 熊
-    {0x7199, 0xCEF5}, // 熙
-    {0x719F, 0xCAEC}, // 熟
-    {0x71C3, 0xC8BC}, // 燃
-    {0x71D5, 0xD1E0}, // 燕
-    {0x7231, 0xB0AE}, // 爱
-    {0x7236, 0xB8B8}, // 父
-    {0x7238, 0xB0D6}, // 爸
-    {0x7247, 0xC6AC}, // 片
-    {0x7248, 0xB0E6}, // 版
-    {0x7259, 0xD1C0}, // 牙
-    {0x725B, 0xC5A3}, // 牛
-    {0x725F, 0xC4B2}, // 牟
-    {0x7262, 0xC0CE}, // 牢
-    {0x7267, 0xC4C1}, // 牧
-    {0x7269, 0xCEEF}, // 物
-    {0x7279, 0xCCD8}, // 特
-    {0x72AC, 0xC8AE}, // 犬
-    {0x72B6, 0xD7B4}, // 状
-    {0x72C4, 0xB5D2}, // 狄
-    {0x72C8, 0xB1B7}, // 狈
-    {0x72D9, 0xBED1}, // 狙
-    {0x72E0, 0xBADD}, // 狠
-    {0x72EC, 0xB6C0}, // 独
-    {0x72F0, 0xD5F8}, // 狰
-    {0x72F1, 0xD3FC}, // 狱
-    {0x731B, 0xC3CD}, // 猛
-    {0x732A, 0xD6ED}, // 猪
-    {0x732E, 0xCFD7}, // 献
-    {0x7387, 0xC2CA}, // 率
-    {0x7389, 0xD3F1}, // 玉
-    {0x738B, 0xCDF5}, // 王
-    {0x73AB, 0xC3B5}, // 玫
-    {0x73AF, 0xBBB7}, // 环
-    {0x73B0, 0xCFD6}, // 现
-    {0x73B2, 0xC1E1}, // 玲
-    {0x73BB, 0xB2A3}, // 玻
-    {0x73CA, 0xC9BA}, // 珊
-    {0x73CD, 0xD5E4}, // 珍
-    {0x73E0, 0xD6E9}, // 珠
-    {0x73ED, 0xB0E0}, // 班
-    {0x7403, 0xC7F2}, // 球
-    {0x7406, 0xC0ED}, // 理
-    {0x7433, 0xC1D5}, // 琳
-    {0x7434, 0xC7D9}, // 琴
-    {0x743C, 0xC7ED}, // 琼
-    {0x745A, 0xBAF7}, // 瑚
-    {0x745E, 0xC8F0}, // 瑞
-    {0x745F, 0xC9AA}, // 瑟
-    {0x7476, 0xD1FE}, // 瑶
-    {0x7483, 0xC1A7}, // 璃
-    {0x74E3, 0xB0EA}, // 瓣
-    {0x74E6, 0xCDDF}, // 瓦
-    {0x74F6, 0xC6BF}, // 瓶
-    {0x7504, 0xD5E7}, // 甄
-    {0x7518, 0xB8CA}, // 甘
-    {0x751A, 0xC9F5}, // 甚
-    {0x751F, 0xC9FA}, // 生
-    {0x7528, 0xD3C3}, // 用
-    {0x7529, 0xCBA6}, // 甩
-    {0x752B, 0xB8A6}, // 甫
-    {0x7530, 0xCCEF}, // 田
-    {0x7531, 0xD3C9}, // 由
-    {0x7532, 0xBCD7}, // 甲
-    {0x7533, 0xC9EA}, // 申
-    {0x7535, 0xB5E7}, // 电
-    {0x7537, 0xC4D0}, // 男
-    {0x7538, 0xB5E9}, // 甸
-    {0x753B, 0xBBAD}, // 画
-    {0x7545, 0xB3A9}, // 畅
-    {0x754C, 0xBDE7}, // 界
-    {0x754F, 0xCEB7}, // 畏
-    {0x7559, 0xC1F4}, // 留
-    {0x7565, 0xC2D4}, // 略
-    {0x7597, 0xC1C6}, // 疗
-    {0x75A4, 0xB0CC}, // 疤
-    {0x75B9, 0xD5EE}, // 疹
-    {0x75BC, 0xCCDB}, // 疼
-    {0x75BE, 0xBCB2}, // 疾
-    {0x75C5, 0xB2A1}, // 病
-    {0x75CA, 0xC8AC}, // 痊
-    {0x75DB, 0xCDB4}, // 痛
-    {0x75EA, 0xBBBE}, // 痪
-    {0x7624, 0xC1F6}, // 瘤
-    {0x7629, 0xB4F1}, // 瘩
-    {0x762B, 0xCCB1}, // 瘫
-    {0x7678, 0xB9EF}, // 癸
-    {0x767B, 0xB5C7}, // 登
-    {0x767D, 0xB0D7}, // 白
-    {0x767E, 0xB0D9}, // 百
-    {0x7684, 0xB5C4}, // 的
-    {0x7686, 0xBDD4}, // 皆
-    {0x7691, 0xB0A8}, // 皑
-    {0x7696, 0xCDEE}, // 皖
-    {0x76AE, 0xC6A4}, // 皮
-    {0x76BF, 0xC3F3}, // 皿
-    {0x76C2, 0xD3DB}, // 盂
-    {0x76C6, 0xC5E8}, // 盆
-    {0x76CA, 0xD2E6}, // 益
-    {0x76CE, 0xB0BB}, // 盎
-    {0x76D0, 0xD1CE}, // 盐
-    {0x76D6, 0xB8C7}, // 盖
-    {0x76D8, 0xC5CC}, // 盘
-    {0x76DB, 0xCAA2}, // 盛
-    {0x76EE, 0xC4BF}, // 目
-    {0x76EF, 0xB6A2}, // 盯
-    {0x76F4, 0xD6B1}, // 直
-    {0x76F8, 0xCFE0}, // 相
-    {0x76FE, 0xB6DC}, // 盾
-    {0x7701, 0xCAA1}, // 省
-    {0x7709, 0xC3BC}, // 眉
-    {0x770B, 0xBFB4}, // 看
-    {0x771F, 0xD5E6}, // 真
-    {0x7729, 0xD1A3}, // 眩
-    {0x772F, 0xC3D0}, // 眯
-    {0x773C, 0xD1DB}, // 眼
-    {0x7740, 0xD7C5}, // 着
-    {0x7741, 0xD5F6}, // 睁
-    {0x775B, 0xBEA6}, // 睛
-    {0x7761, 0xCBAF}, // 睡
-    {0x7766, 0xC4C0}, // 睦
-    {0x776C, 0xB2C7}, // 睬
-    {0x778E, 0xCFB9}, // 瞎
-    {0x7792, 0xC2F7}, // 瞒
-    {0x77A7, 0xC7C6}, // 瞧
-    {0x77A9, 0xD6F5}, // 瞩
-    {0x77B3, 0xCDAB}, // 瞳
-    {0x77D7, 0xB4A3}, // 矗
-    {0x77DB, 0xC3AC}, // 矛
-    {0x77E2, 0xCAB8}, // 矢
-    {0x77E3, 0xD2D3}, // 矣
-    {0x77E5, 0xD6AA}, // 知
-    {0x77E9, 0xBED8}, // 矩
-    {0x77ED, 0xB6CC}, // 短
-    {0x77F3, 0xCAAF}, // 石
-    {0x77FF, 0xBFF3}, // 矿
-    {0x7801, 0xC2EB}, // 码
-    {0x7802, 0xC9B0}, // 砂
-    {0x780D, 0xBFB3}, // 砍
-    {0x7814, 0xD1D0}, // 研
-    {0x781A, 0xD1E2}, // 砚
-    {0x7834, 0xC6C6}, // 破
-    {0x7838, 0xD4D2}, // 砸
-    {0x7840, 0xB4A1}, // 础
-    {0x786C, 0xD3B2}, // 硬
-    {0x786E, 0xC8B7}, // 确
-    {0x788D, 0xB0AD}, // 碍
-    {0x7891, 0xB1AE}, // 碑
-    {0x7898, 0xB5E2}, // 碘
-    {0x789F, 0xB5FA}, // 碟
-    {0x78A7, 0xB1CC}, // 碧
-    {0x78B1, 0xBCEE}, // 碱
-    {0x78B3, 0xCCBC}, // 碳
-    {0x78C1, 0xB4C5}, // 磁
-    {0x78CA, 0xC0DA}, // 磊
-    {0x78E8, 0xC4A5}, // 磨
-    {0x78F7, 0xC1D7}, // 磷
-    {0x7901, 0xBDB8}, // 礁
-    {0x793A, 0xCABE}, // 示
-    {0x793C, 0xC0F1}, // 礼
-    {0x793E, 0xC9E7}, // 社
-    {0x7941, 0xC6EE}, // 祁
-    {0x7956, 0xD7E6}, // 祖
-    {0x795D, 0xD7A3}, // 祝
-    {0x795E, 0xC9F1}, // 神
-    {0x7965, 0xCFE9}, // 祥
-    {0x796D, 0xBCC0}, // 祭
-    {0x7984, 0xC2BB}, // 禄
-    {0x798F, 0xB8A3}, // 福
-    {0x79BB, 0xC0EB}, // 离
-    {0x79BE, 0xBACC}, // 禾
-    {0x79C0, 0xD0E3}, // 秀
-    {0x79C1, 0xCBBD}, // 私
-    {0x79C9, 0xB1FC}, // 秉
-    {0x79CB, 0xC7EF}, // 秋
-    {0x79CD, 0xD6D6}, // 种
-    {0x79D1, 0xBFC6}, // 科
-    {0x79D2, 0xC3EB}, // 秒
-    {0x79D8, 0xC3D8}, // 秘
-    {0x79E6, 0xC7D8}, // 秦
-    {0x79E9, 0xD6C8}, // 秩
-    {0x79EF, 0xBBFD}, // 积
-    {0x79F0, 0xB3C6}, // 称
-    {0x79FB, 0xD2C6}, // 移
-    {0x7A0B, 0xB3CC}, // 程
-    {0x7A17, 0xB0DE}, // 稗
-    {0x7A33, 0xCEC8}, // 稳
-    {0x7A3B, 0xB5BE}, // 稻
-    {0x7A46, 0xC4C2}, // 穆
-    {0x7A57, 0xCBEB}, // 穗
-    {0x7A76, 0xBEBF}, // 究
-    {0x7A7A, 0xBFD5}, // 空
-    {0x7A81, 0xCDBB}, // 突
-    {0x7A9F, 0xBFDF}, // 窟
-    {0x7ACB, 0xC1A2}, // 立
-    {0x7AD9, 0xD5BE}, // 站
-    {0x7AE0, 0xD5C2}, // 章
-    {0x7AE5, 0xCDAF}, // 童
-    {0x7AEF, 0xB6CB}, // 端
-    {0x7AF9, 0xD6F1}, // 竹
-    {0x7B06, 0xB0CA}, // 笆
-    {0x7B14, 0xB1CA}, // 笔
-    {0x7B1B, 0xB5D1}, // 笛
-    {0x7B26, 0xB7FB}, // 符
-    {0x7B2C, 0xB5DA}, // 第
-    {0x7B3A, 0xBCE3}, // 笺
-    {0x7B3C, 0xC1FD}, // 笼
-    {0x7B49, 0xB5C8}, // 等
-    {0x7B54, 0xB4F0}, // 答
-    {0x7B56, 0xB2DF}, // 策
-    {0x7B80, 0xBCF2}, // 简
-    {0x7B95, 0xBBFE}, // 箕
-    {0x7B97, 0xCBE3}, // 算
-    {0x7BA1, 0xB9DC}, // 管
-    {0x7BA9, 0xC2E1}, // 箩
-    {0x7BB1, 0xCFE4}, // 箱
-    {0x7BD3, 0xC2A8}, // 篓
-    {0x7BE1, 0xB4DB}, // 篡
-    {0x7C73, 0xC3D7}, // 米
-    {0x7C7B, 0xC0E0}, // 类
-    {0x7C7D, 0xD7D1}, // 籽
-    {0x7C89, 0xB7DB}, // 粉
-    {0x7C92, 0xC1A3}, // 粒
-    {0x7C97, 0xB4D6}, // 粗
-    {0x7C98, 0xD5B3}, // 粘
-    {0x7CA4, 0xD4C1}, // 粤
-    {0x7CA5, 0xD6E0}, // 粥
-    {0x7CAE, 0xC1B8}, // 粮
-    {0x7CB1, 0xC1BB}, // 粱
-    {0x7CB3, 0xBEAC}, // 粳
-    {0x7CB9, 0xB4E2}, // 粹
-    {0x7CBE, 0xBEAB}, // 精
-    {0x7CDC, 0xC3D3}, // 糜
-    {0x7CFB, 0xCFB5}, // 系
-    {0x7D20, 0xCBD8}, // 素
-    {0x7D27, 0xBDF4}, // 紧
-    {0x7D2F, 0xC0DB}, // 累
-    {0x7EA2, 0xBAEC}, // 红
-    {0x7EA6, 0xD4BC}, // 约
-    {0x7EA7, 0xBCB6}, // 级
-    {0x7EAA, 0xBCCD}, // 纪
-    {0x7EAF, 0xB4BF}, // 纯
-    {0x7EB1, 0xC9B4}, // 纱
-    {0x7EB2, 0xB8D9}, // 纲
-    {0x7EB8, 0xD6BD}, // 纸
-    {0x7EB9, 0xCEC6}, // 纹
-    {0x7EBA, 0xB7C4}, // 纺
-    {0x7EBF, 0xCFDF}, // 线
-    {0x7EC3, 0xC1B7}, // 练
-    {0x7EC4, 0xD7E9}, // 组
-    {0x7EC5, 0xC9F0}, // 绅
-    {0x7EC6, 0xCFB8}, // 细
-    {0x7EC7, 0xD6AF}, // 织
-    {0x7EC8, 0xD6D5}, // 终
-    {0x7ECD, 0xC9DC}, // 绍
-    {0x7ECF, 0xBEAD}, // 经
-    {0x7ED2, 0xC8DE}, // 绒
-    {0x7ED3, 0xBDE1}, // 结
-    {0x7ED9, 0xB8F8}, // 给
-    {0x7EDD, 0xBEF8}, // 绝
-    {0x7EDF, 0xCDB3}, // 统
-    {0x7EE7, 0xBCCC}, // 继
-    {0x7EEA, 0xD0F7}, // 绪
-    {0x7EED, 0xD0F8}, // 续
-    {0x7EF0, 0xB4C2}, // 绰
-    {0x7EF4, 0xCEAC}, // 维
-    {0x7EF5, 0xC3E0}, // 绵
-    {0x7EFC, 0xD7DB}, // 综
-    {0x7EFF, 0xC2CC}, // 绿
-    {0x7F16, 0xB1E0}, // 编
-    {0x7F18, 0xD4B5}, // 缘
-    {0x7F29, 0xCBF5}, // 缩
-    {0x7F38, 0xB8D7}, // 缸
-    {0x7F3A, 0xC8B1}, // 缺
-    {0x7F51, 0xCDF8}, // 网
-    {0x7F57, 0xC2DE}, // 罗
-    {0x7F5A, 0xB7A3}, // 罚
-    {0x7F6E, 0xD6C3}, // 置
-    {0x7F8E, 0xC3C0}, // 美
-    {0x7F9A, 0xC1E7}, // 羚
-    {0x7FA4, 0xC8BA}, // 群
-    {0x7FB9, 0xB8FE}, // 羹
-    {0x7FBD, 0xD3F0}, // 羽
-    {0x7FC1, 0xCECC}, // 翁
-    {0x7FC5, 0xB3E1}, // 翅
-    {0x7FCC, 0xD2EE}, // 翌
-    {0x7FD4, 0xCFE8}, // 翔
-    {0x7FDF, 0xB5D4}, // 翟
-    {0x7FE0, 0xB4E4}, // 翠
-    {0x7FFB, 0xB7AD}, // 翻
-    {0x8000, 0xD2AB}, // 耀
-    {0x8001, 0xC0CF}, // 老
-    {0x8003, 0xBFBC}, // 考
-    {0x8005, 0xD5DF}, // 者
-    {0x800C, 0xB6F8}, // 而
-    {0x8018, 0xD4C5}, // 耘
-    {0x802A, 0xC5D5}, // 耪
-    {0x8033, 0xB6FA}, // 耳
-    {0x8038, 0xCBCA}, // 耸
-    {0x803B, 0xB3DC}, // 耻
-    {0x803F, 0xB9A2}, // 耿
-    {0x8042, 0xC4F4}, // 聂
-    {0x804C, 0xD6B0}, // 职
-    {0x8054, 0xC1AA}, // 联
-    {0x8083, 0xCBE0}, // 肃
-    {0x8086, 0xCBC1}, // 肆
-    {0x808B, 0xC0DF}, // 肋
-    {0x808C, 0xBCA1}, // 肌
-    {0x8096, 0xD0A4}, // 肖
-    {0x809B, 0xB8D8}, // 肛
-    {0x809D, 0xB8CE}, // 肝
-    {0x80A0, 0xB3A6}, // 肠
-    {0x80A2, 0xD6AB}, // 肢
-    {0x80A5, 0xB7CA}, // 肥
-    {0x80A9, 0xBCE7}, // 肩
-    {0x80AA, 0xB7BE}, // 肪
-    {0x80AF, 0xBFCF}, // 肯
-    {0x80B2, 0xD3FD}, // 育
-    {0x80BF, 0xD6D7}, // 肿
-    {0x80C3, 0xCEB8}, // 胃
-    {0x80C6, 0xB5A8}, // 胆
-    {0x80CC, 0xB1B3}, // 背
-    {0x80CE, 0xCCA5}, // 胎
-    {0x80DC, 0xCAA4}, // 胜
-    {0x80DE, 0xB0FB}, // 胞
-    {0x80E1, 0xBAFA}, // 胡
-    {0x80F6, 0xBDBA}, // 胶
-    {0x80F8, 0xD0D8}, // 胸
-    {0x80FD, 0xC4DC}, // 能
-    {0x8102, 0xD6AC}, // 脂
-    {0x8109, 0xC2F6}, // 脉
-    {0x810A, 0xBCB9}, // 脊
-    {0x8111, 0xC4D4}, // 脑
-    {0x811A, 0xBDC5}, // 脚
-    {0x8131, 0xCDD1}, // 脱
-    {0x8138, 0xC1B3}, // 脸
-    {0x814A, 0xC0B0}, // 腊
-    {0x814B, 0xD2B8}, // 腋
-    {0x8150, 0xB8AF}, // 腐
-    {0x819B, 0xCCC5}, // 膛
-    {0x81C2, 0xB1DB}, // 臂
-    {0x81E3, 0xB3BC}, // 臣
-    {0x81EA, 0xD7D4}, // 自
-    {0x81F4, 0xD6C2}, // 致
-    {0x81FC, 0xBECA}, // 臼
-    {0x8205, 0xBECB}, // 舅
-    {0x820D, 0xC9E1}, // 舍
-    {0x8212, 0xCAE6}, // 舒
-    {0x8214, 0xCCF2}, // 舔
-    {0x821C, 0xCBB4}, // 舜
-    {0x822A, 0xBABD}, // 航
-    {0x822C, 0xB0E3}, // 般
-    {0x8235, 0xB6E6}, // 舵
-    {0x826F, 0xC1BC}, // 良
-    {0x8270, 0xBCE8}, // 艰
-    {0x8272, 0xC9AB}, // 色
-    {0x8273, 0xD1DE}, // 艳
-    {0x827A, 0xD2D5}, // 艺
-    {0x8282, 0xBDDA}, // 节
-    {0x828B, 0xD3F3}, // 芋
-    {0x829D, 0xD6A5}, // 芝
-    {0x82A6, 0xC2AB}, // 芦
-    {0x82AC, 0xB7D2}, // 芬
-    {0x82AD, 0xB0C5}, // 芭
-    {0x82B1, 0xBBA8}, // 花
-    {0x82B3, 0xB7BC}, // 芳
-    {0x82B9, 0xC7DB}, // 芹
-    {0x82BD, 0xD1BF}, // 芽
-    {0x82CF, 0xCBD5}, // 苏
-    {0x82D7, 0xC3E7}, // 苗
-    {0x82DB, 0xBFC1}, // 苛
-    {0x82E5, 0xC8F4}, // 若
-    {0x82E6, 0xBFE0}, // 苦
-    {0x82EF, 0xB1BD}, // 苯
-    {0x82F1, 0xD3A2}, // 英
-    {0x8302, 0xC3AF}, // 茂
-    {0x8303, 0xB7B6}, // 范
-    {0x8305, 0xC3A9}, // 茅
-    {0x8338, 0xC8D7}, // 茸
-    {0x8339, 0xC8E3}, // 茹
-    {0x8346, 0xBEA3}, // 荆
-    {0x8349, 0xB2DD}, // 草
-    {0x8361, 0xB5B4}, // 荡
-    {0x8363, 0xC8D9}, // 荣
-    {0x8364, 0xBBE7}, // 荤
-    {0x836F, 0xD2A9}, // 药
-    {0x8389, 0xC0F2}, // 莉
-    {0x83AB, 0xC4AA}, // 莫
-    {0x83B2, 0xC1AB}, // 莲
-    {0x83B7, 0xBBF1}, // 获
-    {0x83B9, 0xD3A8}, // 莹
-    {0x83BD, 0xC3A7}, // 莽
-    {0x83CA, 0xBED5}, // 菊
-    {0x83CC, 0xBEFA}, // 菌
-    {0x83CF, 0xBACA}, // 菏
-    {0x83DC, 0xB2CB}, // 菜
-    {0x83E9, 0xC6D0}, // 菩
-    {0x83F1, 0xC1E2}, // 菱
-    {0x83F2, 0xB7C6}, // 菲
-    {0x8404, 0xCCD1}, // 萄
-    {0x840C, 0xC3C8}, // 萌
-    {0x840D, 0xC6BC}, // 萍
-    {0x8425, 0xD3AA}, // 营
-    {0x8427, 0xCFF4}, // 萧
-    {0x843D, 0xC2E4}, // 落
-    {0x8457, 0xD6F8}, // 著
-    {0x845B, 0xB8F0}, // 葛
-    {0x8463, 0xB6AD}, // 董
-    {0x846B, 0xBAF9}, // 葫
-    {0x846C, 0xD4E1}, // 葬
-    {0x848B, 0xBDAF}, // 蒋
-    {0x84B8, 0xD5F4}, // 蒸
-    {0x84C9, 0xC8D8}, // 蓉
-    {0x851A, 0xCEB5}, // 蔚
-    {0x8521, 0xB2CC}, // 蔡
-    {0x854A, 0xC8EF}, // 蕊
-    {0x8574, 0xD4CC}, // 蕴
-    {0x857E, 0xC0D9}, // 蕾
-    {0x859B, 0xD1A6}, // 薛
-    {0x85CF, 0xB2D8}, // 藏
-    {0x85E9, 0xB7AA}, // 藩
-    {0x864E, 0xBBA2}, // 虎
-    {0x865A, 0xD0E9}, // 虚
-    {0x865E, 0xD3DD}, // 虞
-    {0x866B, 0xB3E6}, // 虫
-    {0x8679, 0xBAE7}, // 虹
-    {0x867D, 0xCBE4}, // 虽
-    {0x8680, 0xCAB4}, // 蚀
-    {0x8695, 0xB2CF}, // 蚕
-    {0x869C, 0xD1C1}, // 蚜
-    {0x86C7, 0xC9DF}, // 蛇
-    {0x86CA, 0xB9C6}, // 蛊
-    {0x86E4, 0xB8F2}, // 蛤
-    {0x8702, 0xB7E4}, // 蜂
-    {0x8717, 0xCECF}, // 蜗
-    {0x8721, 0xC0AF}, // 蜡
-    {0x8747, 0xD3AC}, // 蝇
-    {0x874E, 0xD0AB}, // 蝎
-    {0x8757, 0xBBC8}, // 蝗
-    {0x8774, 0xBAFB}, // 蝴
-    {0x87BA, 0xC2DD}, // 螺
-    {0x8840, 0xD1AA}, // 血
-    {0x884C, 0xD0D0}, // 行
-    {0x8859, 0xD1C3}, // 衙
-    {0x8863, 0xD2C2}, // 衣
-    {0x8865, 0xB2B9}, // 补
-    {0x8868, 0xB1ED}, // 表
-    {0x8870, 0xCBA5}, // 衰
-    {0x8881, 0xD4AC}, // 袁
-    {0x8884, 0xB0C0}, // 袄
-    {0x888B, 0xB4FC}, // 袋
-    {0x88AB, 0xB1BB}, // 被
-    {0x88C2, 0xC1D1}, // 裂
-    {0x88C5, 0xD7B0}, // 装
-    {0x88D4, 0xD2E1}, // 裔
-    {0x88D5, 0xD4A3}, // 裕
-    {0x88E4, 0xBFE3}, // 裤
-    {0x88F4, 0xC5E1}, // 裴
-    {0x88F8, 0xC2E3}, // 裸
-    {0x897F, 0xCEF7}, // 西
-    {0x8981, 0xD2AA}, // 要
-    {0x8986, 0xB8B2}, // 覆
-    {0x89C1, 0xBCFB}, // 见
-    {0x89C2, 0xB9DB}, // 观
-    {0x89C4, 0xB9E6}, // 规
-    {0x89C6, 0xCAD3}, // 视
-    {0x89C9, 0xBEF5}, // 觉
-    {0x89D2, 0xBDC7}, // 角
-    {0x89E3, 0xBDE2}, // 解
-    {0x89E6, 0xB4A5}, // 触
-    {0x8A00, 0xD1D4}, // 言
-    {0x8A79, 0xD5B2}, // 詹
-    {0x8A93, 0xCAC4}, // 誓
-    {0x8BA1, 0xBCC6}, // 计
-    {0x8BA2, 0xB6A9}, // 订
-    {0x8BA4, 0xC8CF}, // 认
-    {0x8BA8, 0xCCD6}, // 讨
-    {0x8BA9, 0xC8C3}, // 让
-    {0x8BAD, 0xD1B5}, // 训
-    {0x8BAE, 0xD2E9}, // 议
-    {0x8BB0, 0xBCC7}, // 记
-    {0x8BB2, 0xBDB2}, // 讲
-    {0x8BB8, 0xD0ED}, // 许
-    {0x8BBA, 0xC2DB}, // 论
-    {0x8BBE, 0xC9E8}, // 设
-    {0x8BBF, 0xB7C3}, // 访
-    {0x8BC1, 0xD6A4}, // 证
-    {0x8BC4, 0xC6C0}, // 评
-    {0x8BC6, 0xCAB6}, // 识
-    {0x8BC9, 0xCBDF}, // 诉
-    {0x8BD5, 0xCAD4}, // 试
-    {0x8BDA, 0xB3CF}, // 诚
-    {0x8BDB, 0xD6EF}, // 诛
-    {0x8BDD, 0xBBB0}, // 话
-    {0x8BE1, 0xB9EE}, // 诡
-    {0x8BE5, 0xB8C3}, // 该
-    {0x8BE6, 0xCFEA}, // 详
-    {0x8BEC, 0xCEDC}, // 诬
-    {0x8BED, 0xD3EF}, // 语
-    {0x8BEF, 0xCEF3}, // 误
-    {0x8BF4, 0xCBB5}, // 说
-    {0x8BF7, 0xC7EB}, // 请
-    {0x8BF8, 0xD6EE}, // 诸
-    {0x8BFB, 0xB6C1}, // 读
-    {0x8C03, 0xB5F7}, // 调
-    {0x8C08, 0xCCB8}, // 谈
-    {0x8C10, 0xD0B3}, // 谐
-    {0x8C22, 0xD0BB}, // 谢
-    {0x8C26, 0xC7AB}, // 谦
-    {0x8C28, 0xBDF7}, // 谨
-    {0x8C2D, 0xCCB7}, // 谭
-    {0x8C31, 0xC6D7}, // 谱
-    {0x8C34, 0xC7B4}, // 谴
-    {0x8C37, 0xB9C8}, // 谷
-    {0x8C41, 0xBBED}, // 豁
-    {0x8C61, 0xCFF3}, // 象
-    {0x8C6A, 0xBAC0}, // 豪
-    {0x8C7A, 0xB2F2}, // 豺
-    {0x8C8C, 0xC3B2}, // 貌
-    {0x8D1D, 0xB1B4}, // 贝
-    {0x8D1E, 0xD5EA}, // 贞
-    {0x8D1F, 0xB8BA}, // 负
-    {0x8D21, 0xB9B1}, // 贡
-    {0x8D22, 0xB2C6}, // 财
-    {0x8D23, 0xD4F0}, // 责
-    {0x8D24, 0xCFCD}, // 贤
-    {0x8D27, 0xBBF5}, // 货
-    {0x8D28, 0xD6CA}, // 质
-    {0x8D29, 0xB7B7}, // 贩
-    {0x8D2B, 0xC6B6}, // 贫
-    {0x8D2C, 0xB1E1}, // 贬
-    {0x8D2D, 0xB9BA}, // 购
-    {0x8D2F, 0xB9E1}, // 贯
-    {0x8D35, 0xB9F3}, // 贵
-    {0x8D38, 0xC3B3}, // 贸
-    {0x8D39, 0xB7D1}, // 费
-    {0x8D3A, 0xBAD8}, // 贺
-    {0x8D3E, 0xBCD6}, // 贾
-    {0x8D44, 0xD7CA}, // 资
-    {0x8D4C, 0xB6C4}, // 赌
-    {0x8D60, 0xD4F9}, // 赠
-    {0x8D63, 0xB8D3}, // 赣
-    {0x8D64, 0xB3E0}, // 赤
-    {0x8D66, 0xC9E2}, // 赦
-    {0x8D70, 0xD7DF}, // 走
-    {0x8D74, 0xB8B0}, // 赴
-    {0x8D75, 0xD5D4}, // 赵
-    {0x8D76, 0xB8CF}, // 赶
-    {0x8D77, 0xC6F0}, // 起
-    {0x8D85, 0xB3AC}, // 超
-    {0x8D8A, 0xD4BD}, // 越
-    {0x8DA3, 0xC8A4}, // 趣
-    {0x8DB3, 0xD7E3}, // 足
-    {0x8DBE, 0xD6BA}, // 趾
-    {0x8DC3, 0xD4BE}, // 跃
-    {0x8DCB, 0xB0CF}, // 跋
-    {0x8DD1, 0xC5DC}, // 跑
-    {0x8DDD, 0xBEE0}, // 距
-    {0x8DDF, 0xB8FA}, // 跟
-    {0x8DEF, 0xC2B7}, // 路
-    {0x8DF5, 0xBCF9}, // 践
-    {0x8E6C, 0xB5C5}, // 蹬
-    {0x8E81, 0xD4EA}, // 躁
-    {0x8EAB, 0xC9ED}, // 身
-    {0x8EBA, 0xCCC9}, // 躺
-    {0x8F66, 0xB3B5}, // 车
-    {0x8F68, 0xB9EC}, // 轨
-    {0x8F69, 0xD0F9}, // 轩
-    {0x8F6C, 0xD7AA}, // 转
-    {0x8F6E, 0xC2D6}, // 轮
-    {0x8F6F, 0xC8ED}, // 软
-    {0x8F70, 0xBAE4}, // 轰
-    {0x8F74, 0xD6E1}, // 轴
-    {0x8F7B, 0xC7E1}, // 轻
-    {0x8F7D, 0xD4D8}, // 载
-    {0x8F83, 0xBDCF}, // 较
-    {0x8F88, 0xB1B2}, // 辈
-    {0x8F89, 0xBBD4}, // 辉
-    {0x8F8A, 0xB9F5}, // 辊
-    {0x8F91, 0xBCAD}, // 辑
-    {0x8F93, 0xCAE4}, // 输
-    {0x8F9B, 0xD0C1}, // 辛
-    {0x8F9E, 0xB4C7}, // 辞
-    {0x8F9F, 0xB1D9}, // 辟
-    {0x8FA8, 0xB1E6}, // 辨
-    {0x8FA9, 0xB1E7}, // 辩
-    {0x8FB0, 0xB3BD}, // 辰
-    {0x8FB9, 0xB1DF}, // 边
-    {0x8FBD, 0xC1C9}, // 辽
-    {0x8FBE, 0xB4EF}, // 达
-    {0x8FC2, 0xD3D8}, // 迂
-    {0x8FC5, 0xD1B8}, // 迅
-    {0x8FC7, 0xB9FD}, // 过
-    {0x8FCE, 0xD3AD}, // 迎
-    {0x8FD0, 0xD4CB}, // 运
-    {0x8FD1, 0xBDFC}, // 近
-    {0x8FD8, 0xBBB9}, // 还
-    {0x8FD9, 0xD5E2}, // 这
-    {0x8FDB, 0xBDF8}, // 进
-    {0x8FDC, 0xD4B6}, // 远
-    {0x8FDD, 0xCEA5}, // 违
-    {0x8FDE, 0xC1AC}, // 连
-    {0x8FEA, 0xB5CF}, // 迪
-    {0x8FEB, 0xC6C8}, // 迫
-    {0x8FF0, 0xCAF6}, // 述
-    {0x8FF7, 0xC3D4}, // 迷
-    {0x8FF9, 0xBCA3}, // 迹
-    {0x9000, 0xCDCB}, // 退
-    {0x9001, 0xCBCD}, // 送
-    {0x9002, 0xCACA}, // 适
-    {0x9006, 0xC4E6}, // 逆
-    {0x9009, 0xD1A1}, // 选
-    {0x900F, 0xCDB8}, // 透
-    {0x9010, 0xD6F0}, // 逐
-    {0x9012, 0xB5DD}, // 递
-    {0x901A, 0xCDA8}, // 通
-    {0x901B, 0xB9E4}, // 逛
-    {0x901F, 0xCBD9}, // 速
-    {0x9020, 0xD4EC}, // 造
-    {0x9041, 0xB6DD}, // 遁
-    {0x9047, 0xD3F6}, // 遇
-    {0x904D, 0xB1E9}, // 遍
-    {0x9053, 0xB5C0}, // 道
-    {0x9065, 0xD2A3}, // 遥
-    {0x9075, 0xD7F1}, // 遵
-    {0x907F, 0xB1DC}, // 避
-    {0x9093, 0xB5CB}, // 邓
-    {0x90A2, 0xD0CF}, // 邢
-    {0x90A3, 0xC4C7}, // 那
-    {0x90A6, 0xB0EE}, // 邦
-    {0x90AE, 0xD3CA}, // 邮
-    {0x90B1, 0xC7F1}, // 邱
-    {0x90B5, 0xC9DB}, // 邵
-    {0x90B9, 0xD7DE}, // 邹
-    {0x90BB, 0xC1DA}, // 邻
-    {0x90C1, 0xD3F4}, // 郁
-    {0x90CE, 0xC0C9}, // 郎
-    {0x90D1, 0xD6A3}, // 郑
-    {0x90DD, 0xBAC2}, // 郝
-    {0x90E1, 0xBFA4}, // 郡
-    {0x90E8, 0xB2BF}, // 部
-    {0x90ED, 0xB9F9}, // 郭
-    {0x90FD, 0xB6BC}, // 都
-    {0x914B, 0xC7F5}, // 酋
-    {0x914D, 0xC5E4}, // 配
-    {0x9152, 0xBEC6}, // 酒
-    {0x9163, 0xBAA8}, // 酣
-    {0x9178, 0xCBE1}, // 酸
-    {0x917F, 0xC4F0}, // 酿
-    {0x91C7, 0xB2C9}, // 采
-    {0x91C9, 0xD3D4}, // 釉
-    {0x91CC, 0xC0EF}, // 里
-    {0x91CD, 0xD6D8}, // 重
-    {0x91CF, 0xC1BF}, // 量
-    {0x91D1, 0xBDF0}, // 金
-    {0x9274, 0xBCF8}, // 鉴
-    {0x9488, 0xD5EB}, // 针
-    {0x9489, 0xB6A4}, // 钉
-    {0x948E, 0xC7A5}, // 钎
-    {0x949F, 0xD6D3}, // 钟
-    {0x94A1, 0xB1B5}, // 钡
-    {0x94A2, 0xB8D6}, // 钢
-    {0x94A6, 0xC7D5}, // 钦
-    {0x94A7, 0xBEFB}, // 钧
-    {0x94A8, 0xCED9}, // 钨
-    {0x94AE, 0xC5A5}, // 钮
-    {0x94B1, 0xC7AE}, // 钱
-    {0x94BB, 0xD7EA}, // 钻
-    {0x94C1, 0xCCFA}, // 铁
-    {0x94DC, 0xCDAD}, // 铜
-    {0x94E3, 0xCFB3}, // 铣
-    {0x94ED, 0xC3FA}, // 铭
-    {0x94F6, 0xD2F8}, // 银
-    {0x9501, 0xCBF8}, // 锁
-    {0x9508, 0xD0E2}, // 锈
-    {0x950B, 0xB7E6}, // 锋
-    {0x950C, 0xD0BF}, // 锌
-    {0x9510, 0xC8F1}, // 锐
-    {0x9517, 0xD5E0}, // 锗
-    {0x9519, 0xB4ED}, // 错
-    {0x9521, 0xCEFD}, // 锡
-    {0x9526, 0xBDF5}, // 锦
-    {0x952D, 0xB6A7}, // 锭
-    {0x953B, 0xB6CD}, // 锻
-    {0x9547, 0xD5F2}, // 镇
-    {0x955C, 0xBEB5}, // 镜
-    {0x956D, 0xC0D8}, // 镭
-    {0x9576, 0xCFE2}, // 镶
-    {0x957F, 0xB3A4}, // 长
-    {0x95E8, 0xC3C5}, // 门
-    {0x95EA, 0xC9C1}, // 闪
-    {0x95EE, 0xCECA}, // 问
-    {0x95EF, 0xB4B3}, // 闯
-    {0x95F0, 0xC8F2}, // 闰
-    {0x95F2, 0xCFD0}, // 闲
-    {0x95F4, 0xBCE4}, // 间
-    {0x95F8, 0xD5A2}, // 闸
-    {0x95F9, 0xC4D6}, // 闹
-    {0x95FB, 0xCEC5}, // 闻
-    {0x95FD, 0xC3F6}, // 闽
-    {0x9600, 0xB7A7}, // 阀
-    {0x960E, 0xD1D6}, // 阎
-    {0x961C, 0xB8B7}, // 阜
-    {0x961F, 0xB6D3}, // 队
-    {0x962E, 0xC8EE}, // 阮
-    {0x9632, 0xB7C0}, // 防
-    {0x9633, 0xD1F4}, // 阳
-    {0x9634, 0xD2F5}, // 阴
-    {0x9635, 0xD5F3}, // 阵
-    {0x9636, 0xBDD7}, // 阶
-    {0x963F, 0xB0A2}, // 阿
-    {0x9644, 0xB8BD}, // 附
-    {0x9645, 0xBCCA}, // 际
-    {0x9646, 0xC2BD}, // 陆
-    {0x9648, 0xB3C2}, // 陈
-    {0x964D, 0xBDB5}, // 降
-    {0x9650, 0xCFDE}, // 限
-    {0x965B, 0xB1DD}, // 陛
-    {0x9662, 0xD4BA}, // 院
-    {0x9664, 0xB3FD}, // 除
-    {0x966A, 0xC5E3}, // 陪
-    {0x9675, 0xC1EA}, // 陵
-    {0x9676, 0xCCD5}, // 陶
-    {0x968B, 0xCBE5}, // 隋
-    {0x9698, 0xB0AF}, // 隘
-    {0x9699, 0xCFB6}, // 隙
-    {0x96B6, 0xC1A5}, // 隶
-    {0x96BE, 0xC4D1}, // 难
-    {0x96C0, 0xC8B8}, // 雀
-    {0x96C1, 0xD1E3}, // 雁
-    {0x96C4, 0xD0DB}, // 雄
-    {0x96C5, 0xD1C5}, // 雅
-    {0x96C6, 0xBCAF}, // 集
-    {0x96CD, 0xD3BA}, // 雍
-    {0x96E8, 0xD3EA}, // 雨
-    {0x96EA, 0xD1A9}, // 雪
-    {0x96F6, 0xC1E3}, // 零
-    {0x96F7, 0xC0D7}, // 雷
-    {0x9700, 0xD0E8}, // 需
-    {0x9707, 0xD5F0}, // 震
-    {0x970D, 0xBBF4}, // 霍
-    {0x9713, 0xC4DE}, // 霓
-    {0x971C, 0xCBAA}, // 霜
-    {0x971E, 0xCFBC}, // 霞
-    {0x9732, 0xC2B6}, // 露
-    {0x9738, 0xB0D4}, // 霸
-    {0x9752, 0xC7E0}, // 青
-    {0x9756, 0xBEB8}, // 靖
-    {0x9759, 0xBEB2}, // 静
-    {0x975B, 0xB5E5}, // 靛
-    {0x975E, 0xB7C7}, // 非
-    {0x9760, 0xBFBF}, // 靠
-    {0x9761, 0xC3D2}, // 靡
-    {0x9762, 0xC3E6}, // 面
-    {0x9769, 0xB8EF}, // 革
-    {0x9773, 0xBDF9}, // 靳
-    {0x978D, 0xB0B0}, // 鞍
-    {0x97A0, 0xBECF}, // 鞠
-    {0x97E6, 0xCEA4}, // 韦
-    {0x97E9, 0xBAAB}, // 韩
-    {0x97ED, 0xBEC2}, // 韭
-    {0x9875, 0xD2B3}, // 页
-    {0x9876, 0xB6A5}, // 顶
-    {0x9877, 0xC7EA}, // 顷
-    {0x9879, 0xCFEE}, // 项
-    {0x987A, 0xCBB3}, // 顺
-    {0x987B, 0xD0EB}, // 须
-    {0x987E, 0xB9CB}, // 顾
-    {0x9884, 0xD4A4}, // 预
-    {0x9888, 0xBEB1}, // 颈
-    {0x9896, 0xD3B1}, // 颖
-    {0x9898, 0xCCE2}, // 题
-    {0x989C, 0xD1D5}, // 颜
-    {0x98CE, 0xB7E7}, // 风
-    {0x98D8, 0xC6AE}, // 飘
-    {0x98DE, 0xB7C9}, // 飞
-    {0x98DF, 0xCAB3}, // 食
-    {0x9910, 0xB2CD}, // 餐
-    {0x9965, 0xBCA2}, // 饥
-    {0x996E, 0xD2FB}, // 饮
-    {0x997C, 0xB1FD}, // 饼
-    {0x9996, 0xCAD7}, // 首
-    {0x9999, 0xCFE3}, // 香
-    {0x9A6C, 0xC2ED}, // 马
-    {0x9A6F, 0xD1B1}, // 驯
-    {0x9A70, 0xB3DB}, // 驰
-    {0x9A7B, 0xD7A4}, // 驻
-    {0x9A7C, 0xCDD5}, // 驼
-    {0x9A86, 0xC2E6}, // 骆
-    {0x9A87, 0xBAA7}, // 骇
-    {0x9A8C, 0xD1E9}, // 验
-    {0x9A8F, 0xBFA5}, // 骏
-    {0x9A9A, 0xC9A7}, // 骚
-    {0x9AA4, 0xD6E8}, // 骤
-    {0x9AA8, 0xB9C7}, // 骨
-    {0x9AD8, 0xB8DF}, // 高
-    {0x9B41, 0xBFFD}, // 魁
-    {0x9B4F, 0xCEBA}, // 魏
-    {0x9C81, 0xC2B3}, // 鲁
-    {0x9C8D, 0xB1AB}, // 鲍
-    {0x9C9C, 0xCFCA}, // 鲜
-    {0x9E1F, 0xC4F1}, // 鸟
-    {0x9E23, 0xC3F9}, // 鸣
-    {0x9E2D, 0xD1BC}, // 鸭
-    {0x9E3F, 0xBAE8}, // 鸿
-    {0x9E4F, 0xC5F4}, // 鹏
-    {0x9E64, 0xBAD7}, // 鹤
-    {0x9EA6, 0xC2F3}, // 麦
-    {0x9EC4, 0xBBC6}, // 黄
-    {0x9ECE, 0xC0E8}, // 黎
-    {0x9ED1, 0xBADA}, // 黑
-    {0x9ED8, 0xC4AC}, // 默
-    {0x9F0E, 0xB6A6}, // 鼎
-    {0x9F13, 0xB9C4}, // 鼓
-    {0x9F20, 0xCAF3}, // 鼠
-    {0x9F3B, 0xB1C7}, // 鼻
-    {0x9F50, 0xC6EB}, // 齐
-    {0x9F7F, 0xB3DD}, // 齿
-    {0x9F84, 0xC1E4}, // 龄
-    {0x9F99, 0xC1FA}, // 龙
-    {0x9F9A, 0xB9A8}, // 龚
+// 按Unicode排序的GB2312编码
+static const uint16_t gb2312_codes[MAP_TABLE_SIZE] = {
+    0xD2BB, // 一 U+4E00
+    0xB6A1, // 丁 U+4E01
+    0xC6DF, // 七 U+4E03
+    0xCDF2, // 万 U+4E07
+    0xD5C9, // 丈 U+4E08
+    0xC8FD, // 三 U+4E09
+    0xC9CF, // 上 U+4E0A
+    0xCFC2, // 下 U+4E0B
+    0xB2BB, // 不 U+4E0D
+    0xD3EB, // 与 U+4E0E
+    0xB3F3, // 丑 U+4E11
+    0xD7A8, // 专 U+4E13
+    0xC7D2, // 且 U+4E14
+    0xCAC0, // 世 U+4E16
+    0xC7F0, // 丘 U+4E18
+    0xD2B5, // 业 U+4E1A
+    0xB4D4, // 丛 U+4E1B
+    0xB6AB, // 东 U+4E1C
+    0xCBBF, // 丝 U+4E1D
+    0xC1BD, // 两 U+4E24
+    0xD1CF, // 严 U+4E25
+    0xC9A5, // 丧 U+4E27
+    0xB8F6, // 个 U+4E2A
+    0xD6D0, // 中 U+4E2D
+    0xB7E1, // 丰 U+4E30
+    0xC1D9, // 临 U+4E34
+    0xCDE8, // 丸 U+4E38
+    0xB5A4, // 丹 U+4E39
+    0xCEAA, // 为 U+4E3A
+    0xD6F7, // 主 U+4E3B
+    0xC0F6, // 丽 U+4E3D
+    0xBED9, // 举 U+4E3E
+    0xC4CB, // 乃 U+4E43
+    0xBEC3, // 久 U+4E45
+    0xC3B4, // 么 U+4E48
+    0xD2E5, // 义 U+4E49
+    0xD6AE, // 之 U+4E4B
+    0xCEDA, // 乌 U+4E4C
+    0xC0D6, // 乐 U+4E50
+    0xC7C7, // 乔 U+4E54
+    0xD2D2, // 乙 U+4E59
+    0xBEC5, // 九 U+4E5D
+    0xD2B2, // 也 U+4E5F
+    0xCFB0, // 习 U+4E60
+    0xCFE7, // 乡 U+4E61
+    0xCAE9, // 书 U+4E66
+    0xC2F2, // 买 U+4E70
+    0xC1CB, // 了 U+4E86
+    0xD5F9, // 争 U+4E89
+    0xCAC2, // 事 U+4E8B
+    0xB6FE, // 二 U+4E8C
+    0xD3DA, // 于 U+4E8E
+    0xD4C6, // 云 U+4E91
+    0xBBA5, // 互 U+4E92
+    0xCEE5, // 五 U+4E94
+    0xBEAE, // 井 U+4E95
+    0xD1C7, // 亚 U+4E9A
+    0xD0A9, // 些 U+4E9B
+    0xCDF6, // 亡 U+4EA1
+    0xBFBA, // 亢 U+4EA2
+    0xBDBB, // 交 U+4EA4
+    0xBAA5, // 亥 U+4EA5
+    0xB2FA, // 产 U+4EA7
+    0xBAE0, // 亨 U+4EA8
+    0xC4B6, // 亩 U+4EA9
+    0xBEA9, // 京 U+4EAC
+    0xCDA4, // 亭 U+4EAD
+    0xC1C1, // 亮 U+4EAE
+    0xC7D7, // 亲 U+4EB2
+    0xC8CB, // 人 U+4EBA
+    0xD2DA, // 亿 U+4EBF
+    0xCAB2, // 什 U+4EC0
+    0xC8CA, // 仁 U+4EC1
+    0xB3F0, // 仇 U+4EC7
+    0xBDF1, // 今 U+4ECA
+    0xBDE9, // 介 U+4ECB
+    0xC8D4, // 仍 U+4ECD
+    0xB4D3, // 从 U+4ECE
+    0xB2D6, // 仓 U+4ED3
+    0xCACB, // 仕 U+4ED5
+    0xCBFB, // 他 U+4ED6
+    0xB8B6, // 付 U+4ED8
+    0xCFC9, // 仙 U+4ED9
+    0xB4FA, // 代 U+4EE3
+    0xC1EE, // 令 U+4EE4
+    0xD2D4, // 以 U+4EE5
+    0xD2C7, // 仪 U+4EEA
+    0xC3C7, // 们 U+4EEC
+    0xD6D9, // 仲 U+4EF2
+    0xBCDB, // 价 U+4EF7
+    0xC8CE, // 任 U+4EFB
+    0xB7DD, // 份 U+4EFD
+    0xC6F3, // 企 U+4F01
+    0xCEE9, // 伍 U+4F0D
+    0xB7FC, // 伏 U+4F0F
+    0xD0DD, // 休 U+4F11
+    0xD6DA, // 众 U+4F17
+    0xD3C5, // 优 U+4F18
+    0xBBEF, // 伙 U+4F19
+    0xBBE1, // 会 U+4F1A
+    0xCEB0, // 伟 U+4F1F
+    0xB4AB, // 传 U+4F20
+    0xC9CB, // 伤 U+4F24
+    0xC2D7, // 伦 U+4F26
+    0xB2AE, // 伯 U+4F2F
+    0xB9C0, // 估 U+4F30
+    0xC1E6, // 伶 U+4F36
+    0xCBC6, // 似 U+4F3C
+    0xB5E8, // 佃 U+4F43
+    0xB5AB, // 但 U+4F46
+    0xCEBB, // 位 U+4F4D
+    0xB5CD, // 低 U+4F4E
+    0xD7A1, // 住 U+4F4F
+    0xD7F4, // 佐 U+4F50
+    0xCCE5, // 体 U+4F53
+    0xBACE, // 何 U+4F55
+    0xD3E0, // 余 U+4F59
+    0xD7F7, // 作 U+4F5C
+    0xC4E3, // 你 U+4F60
+    0xC5E5, // 佩 U+4F69
+    0xBCD1, // 佳 U+4F73
+    0xCAB9, // 使 U+4F7F
+    0xC0FD, // 例 U+4F8B
+    0xCACC, // 侍 U+4F8D
+    0xB9A9, // 供 U+4F9B
+    0xD2C0, // 依 U+4F9D
+    0xCFC0, // 侠 U+4FA0
+    0xB2E0, // 侧 U+4FA7
+    0xBAEE, // 侯 U+4FAF
+    0xC7D6, // 侵 U+4FB5
+    0xB1E3, // 便 U+4FBF
+    0xB6ED, // 俄 U+4FC4
+    0xBFA1, // 俊 U+4FCA
+    0xC7CE, // 俏 U+4FCF
+    0xB1A3, // 保 U+4FDD
+    0xD3E1, // 俞 U+4FDE
+    0xD0C5, // 信 U+4FE1
+    0xBCF3, // 俭 U+4FED
+    0xD0DE, // 修 U+4FEE
+    0xB8A9, // 俯 U+4FEF
+    0xB0B3, // 俺 U+4FFA
+    0xB1B6, // 倍 U+500D
+    0xB5B9, // 倒 U+5012
+    0xBEF3, // 倔 U+5014
+    0xCCC8, // 倘 U+5018
+    0xBAF2, // 候 U+5019
+    0xBEEB, // 倦 U+5026
+    0xC4DF, // 倪 U+502A
+    0xD6B5, // 值 U+503C
+    0xC7E3, // 倾 U+503E
+    0xC6AB, // 偏 U+504F
+    0xD7F6, // 做 U+505A
+    0xCDA3, // 停 U+505C
+    0xBDA1, // 健 U+5065
+    0xB3A5, // 偿 U+507F
+    0xBFFE, // 傀 U+5080
+    0xB8B5, // 傅 U+5085
+    0xC0FC, // 傈 U+5088
+    0xB4F6, // 傣 U+50A3
+    0xB4A2, // 储 U+50A8
+    0xC8E5, // 儒 U+5112
+    0xB6F9, // 儿 U+513F
+    0xD4CA, // 允 U+5141
+    0xD4AA, // 元 U+5143
+    0xB3E4, // 充 U+5145
+    0xD5D7, // 兆 U+5146
+    0xCFC8, // 先 U+5148
+    0xB9E2, // 光 U+5149
+    0xBFCB, // 克 U+514B
+    0xC3E2, // 免 U+514D
+    0xB5B3, // 党 U+515A
+    0xC8EB, // 入 U+5165
+    0xC8AB, // 全 U+5168
+    0xB0CB, // 八 U+516B
+    0xB9AB, // 公 U+516C
+    0xC1F9, // 六 U+516D
+    0xC0BC, // 兰 U+5170
+    0xB9B2, // 共 U+5171
+    0xB9D8, // 关 U+5173
+    0xD0CB, // 兴 U+5174
+    0xB1F8, // 兵 U+5175
+    0xC6E4, // 其 U+5176
+    0xBEDF, // 具 U+5177
+    0xD1F8, // 养 U+517B
+    0xBCE6, // 兼 U+517C
+    0xCADE, // 兽 U+517D
+    0xC4DA, // 内 U+5185
+    0xC8BD, // 冉 U+5189
+    0xB2E1, // 册 U+518C
+    0xD4D9, // 再 U+518D
+    0xC3B0, // 冒 U+5192
+    0xD0B4, // 写 U+5199
+    0xBEFC, // 军 U+519B
+    0xC5A9, // 农 U+519C
+    0xB9DA, // 冠 U+51A0
+    0xB6AC, // 冬 U+51AC
+    0xB7EB, // 冯 U+51AF
+    0xB1F9, // 冰 U+51B0
+    0xB3E5, // 冲 U+51B2
+    0xBEF6, // 决 U+51B3
+    0xC0E4, // 冷 U+51B7
+    0xB6B3, // 冻 U+51BB
+    0xC6E0, // 凄 U+51C4
+    0xD7BC, // 准 U+51C6
+    0xC1E8, // 凌 U+51CC
+    0xBCF5, // 减 U+51CF
+    0xBCB8, // 几 U+51E0
+    0xB7B2, // 凡 U+51E1
+    0xB7EF, // 凤 U+51E4
+    0xBFAD, // 凯 U+51EF
+    0xBBCB, // 凰 U+51F0
+    0xD0D7, // 凶 U+51F6
+    0xB0BC, // 凹 U+51F9
+    0xB3F6, // 出 U+51FA
+    0xBBF7, // 击 U+51FB
+    0xBAAF, // 函 U+51FD
+    0xD4E4, // 凿 U+51FF
+    0xB5B6, // 刀 U+5200
+    0xB5F3, // 刁 U+5201
+    0xB7D6, // 分 U+5206
+    0xC7D0, // 切 U+5207
+    0xBFAF, // 刊 U+520A
+    0xBBAE, // 划 U+5212
+    0xC1D0, // 列 U+5217
+    0xC1F5, // 刘 U+5218
+    0xD4F2, // 则 U+5219
+    0xB8D5, // 刚 U+521A
+    0xB4B4, // 创 U+521B
+    0xB3F5, // 初 U+521D
+    0xC5D0, // 判 U+5224
+    0xC0FB, // 利 U+5229
+    0xB1F0, // 别 U+522B
+    0xB5BD, // 到 U+5230
+    0xD6C6, // 制 U+5236
+    0xBFCC, // 刻 U+523B
+    0xBCC1, // 剂 U+5242
+    0xCFF7, // 削 U+524A
+    0xC7B0, // 前 U+524D
+    0xBDA3, // 剑 U+5251
+    0xBEE7, // 剧 U+5267
+    0xB8B1, // 副 U+526F
+    0xB8EE, // 割 U+5272
+    0xC1A6, // 力 U+529B
+    0xC8B0, // 劝 U+529D
+    0xB0EC, // 办 U+529E
+    0xB9A6, // 功 U+529F
+    0xBCD3, // 加 U+52A0
+    0xCEF1, // 务 U+52A1
+    0xB6AF, // 动 U+52A8
+    0xD6FA, // 助 U+52A9
+    0xC5AC, // 努 U+52AA
+    0xBEA2, // 劲 U+52B2
+    0xC0CD, // 劳 U+52B3
+    0xCAC6, // 势 U+52BF
+    0xD3C2, // 勇 U+52C7
+    0xD1AB, // 勋 U+52CB
+    0xC0D5, // 勒 U+52D2
+    0xC7DA, // 勤 U+52E4
+    0xD4C8, // 匀 U+5300
+    0xB0FC, // 包 U+5305
+    0xB4D2, // 匆 U+5306
+    0xBBAF, // 化 U+5316
+    0xB1B1, // 北 U+5317
+    0xBDB3, // 匠 U+5320
+    0xBFEF, // 匡 U+5321
+    0xB7CB, // 匪 U+532A
+    0xC7F8, // 区 U+533A
+    0xD2BD, // 医 U+533B
+    0xCAAE, // 十 U+5341
+    0xC7A7, // 千 U+5343
+    0xC9FD, // 升 U+5347
+    0xCEE7, // 午 U+5348
+    0xBBDC, // 卉 U+5349
+    0xB0EB, // 半 U+534A
+    0xBBAA, // 华 U+534E
+    0xD0AD, // 协 U+534F
+    0xD7BF, // 卓 U+5353
+    0xB5A5, // 单 U+5355
+    0xC4CF, // 南 U+5357
+    0xB2A9, // 博 U+535A
+    0xB2B7, // 卜 U+535C
+    0xB1E5, // 卞 U+535E
+    0xD5BC, // 占 U+5360
+    0xBFA8, // 卡 U+5361
+    0xC2AC, // 卢 U+5362
+    0xC2B1, // 卤 U+5364
+    0xCEC0, // 卫 U+536B
+    0xD3A1, // 印 U+5370
+    0xCEA3, // 危 U+5371
+    0xBCB4, // 即 U+5373
+    0xC8B4, // 却 U+5374
+    0xC2D1, // 卵 U+5375
+    0xBEED, // 卷 U+5377
+    0xC7E4, // 卿 U+537F
+    0xB3A7, // 厂 U+5382
+    0xB6F2, // 厄 U+5384
+    0xCCFC, // 厅 U+5385
+    0xC0FA, // 历 U+5386
+    0xC0F7, // 厉 U+5389
+    0xD1B9, // 压 U+538B
+    0xD1E1, // 厌 U+538C
+    0xC0E5, // 厘 U+5398
+    0xBAF1, // 厚 U+539A
+    0xD4AD, // 原 U+539F
+    0xC8A5, // 去 U+53BB
+    0xCFD8, // 县 U+53BF
+    0xB2CE, // 参 U+53C2
+    0xD3D6, // 又 U+53C8
+    0xBCB0, // 及 U+53CA
+    0xD3D1, // 友 U+53CB
+    0xCBAB, // 双 U+53CC
+    0xB7B4, // 反 U+53CD
+    0xB7A2, // 发 U+53D1
+    0xCAE5, // 叔 U+53D4
+    0xC8A1, // 取 U+53D6
+    0xCADC, // 受 U+53D7
+    0xB1E4, // 变 U+53D8
+    0xD0F0, // 叙 U+53D9
+    0xBFDA, // 口 U+53E3
+    0xB9C5, // 古 U+53E4
+    0xC1ED, // 另 U+53E6
+    0xD6BB, // 只 U+53EA
+    0xBDD0, // 叫 U+53EB
+    0xD5D9, // 召 U+53EC
+    0xBFC9, // 可 U+53EF
+    0xCCA8, // 台 U+53F0
+    0xCAB7, // 史 U+53F2
+    0xD3D2, // 右 U+53F3
+    0xD2B6, // 叶 U+53F6
+    0xBAC5, // 号 U+53F7
+    0xCBBE, // 司 U+53F8
+    0xB3D4, // 吃 U+5403
+    0xB8F7, // 各 U+5404
+    0xBACF, // 合 U+5408
+    0xBCAA, // 吉 U+5409
+    0xCDAC, // 同 U+540C
+    0xC3FB, // 名 U+540D
+    0xBAF3, // 后 U+540E
+    0xCFF2, // 向 U+5411
+    0xC2C0, // 吕 U+5415
+    0xC2F0, // 吗 U+5417
+    0xBEFD, // 君 U+541B
+    0xB7F1, // 否 U+5426
+    0xB0C9, // 吧 U+5427
+    0xBAAC, // 含 U+542B
+    0xCCFD, // 听 U+542C
+    0xC6F4, // 启 U+542F
+    0xCEE2, // 吴 U+5434
+    0xB3B3, // 吵 U+5435
+    0xCEFC, // 吸 U+5438
+    0xB4B5, // 吹 U+5439
+    0xD1BD, // 呀 U+5440
+    0xB4F4, // 呆 U+5446
+    0xB3CA, // 呈 U+5448
+    0xD4B1, // 员 U+5458
+    0xCED8, // 呜 U+545C
+    0xC4D8, // 呢 U+5462
+    0xD6DC, // 周 U+5468
+    0xCEB6, // 味 U+5473
+    0xBAF4, // 呼 U+547C
+    0xC3FC, // 命 U+547D
+    0xBACD, // 和 U+548C
+    0xD3BD, // 咏 U+548F
+    0xBFA7, // 咖 U+5496
+    0xD2A7, // 咬 U+54AC
+    0xBFA9, // 咯 U+54AF
+    0xD4DB, // 咱 U+54B1
+    0xCFCC, // 咸 U+54B8
+    0xC6B7, // 品 U+54C1
+    0xCDDB, // 哇 U+54C7
+    0xB9FE, // 哈 U+54C8
+    0xCFEC, // 响 U+54CD
+    0xB0A5, // 哎 U+54CE
+    0xD3B4, // 哟 U+54DF
+    0xB8E7, // 哥 U+54E5
+    0xC4C4, // 哪 U+54EA
+    0xD5DC, // 哲 U+54F2
+    0xD1E4, // 唁 U+5501
+    0xCCC6, // 唐 U+5510
+    0xCEA8, // 唯 U+552F
+    0xC9CC, // 商 U+5546
+    0xB0A1, // 啊 U+554A
+    0xC0B2, // 啦 U+5566
+    0xCCE4, // 啼 U+557C
+    0xCEB9, // 喂 U+5582
+    0xC9C6, // 善 U+5584
+    0xBAB0, // 喊 U+558A
+    0xCFB2, // 喜 U+559C
+    0xD0FA, // 喧 U+55A7
+    0xC5E7, // 喷 U+55B7
+    0xD3F7, // 喻 U+55BB
+    0xCAC8, // 嗜 U+55DC
+    0xBCCE, // 嘉 U+5609
+    0xC2EF, // 嘛 U+561B
+    0xC6F7, // 器 U+5668
+    0xBABF, // 嚎 U+568E
+    0xCBC4, // 四 U+56DB
+    0xBBD8, // 回 U+56DE
+    0xD2F2, // 因 U+56E0
+    0xCDC5, // 团 U+56E2
+    0xB6DA, // 囤 U+56E4
+    0xC0A7, // 困 U+56F0
+    0xCEA7, // 围 U+56F4
+    0xB9FA, // 国 U+56FD
+    0xCDBC, // 图 U+56FE
+    0xD4B2, // 圆 U+5706
+    0xC8A6, // 圈 U+5708
+    0xCDC1, // 土 U+571F
+    0xCAA5, // 圣 U+5723
+    0xD4DA, // 在 U+5728
+    0xB5D8, // 地 U+5730
+    0xB3A1, // 场 U+573A
+    0xBBF8, // 圾 U+573E
+    0xBEF9, // 均 U+5747
+    0xCCAE, // 坍 U+574D
+    0xBBB5, // 坏 U+574F
+    0xBFE9, // 块 U+5757
+    0xBCE1, // 坚 U+575A
+    0xB7D8, // 坟 U+575F
+    0xC0A4, // 坤 U+5764
+    0xB4B9, // 垂 U+5782
+    0xD0CD, // 型 U+578B
+    0xB9B8, // 垢 U+57A2
+    0xD4AB, // 垣 U+57A3
+    0xB0A3, // 埃 U+57C3
+    0xB3C7, // 城 U+57CE
+    0xD3F2, // 域 U+57DF
+    0xC5E0, // 培 U+57F9
+    0xBBF9, // 基 U+57FA
+    0xCCC3, // 堂 U+5802
+    0xCBFE, // 塔 U+5854
+    0xC8FB, // 塞 U+585E
+    0xD4F6, // 增 U+589E
+    0xBABE, // 壕 U+58D5
+    0xCABF, // 士 U+58EB
+    0xD7B3, // 壮 U+58EE
+    0xC9F9, // 声 U+58F0
+    0xB4A6, // 处 U+5904
+    0xB1B8, // 备 U+5907
+    0xB8B4, // 复 U+590D
+    0xCFC4, // 夏 U+590F
+    0xCFA6, // 夕 U+5915
+    0xCDE2, // 外 U+5916
+    0xB6E0, // 多 U+591A
+    0xD2B9, // 夜 U+591C
+    0xB9BB, // 够 U+591F
+    0xB4F3, // 大 U+5927
+    0xCCEC, // 天 U+5929
+    0xCCAB, // 太 U+592A
+    0xB7F2, // 夫 U+592B
+    0xD1EB, // 央 U+592E
+    0xCAA7, // 失 U+5931
+    0xCDB7, // 头 U+5934
+    0xD2C4, // 夷 U+5937
+    0xBCD0, // 夹 U+5939
+    0xB6E1, // 夺 U+593A
+    0xC6E6, // 奇 U+5947
+    0xB7EE, // 奉 U+5949
+    0xB7DC, // 奋 U+594B
+    0xBFFC, // 奎 U+594E
+    0xCCD7, // 套 U+5957
+    0xB5EC, // 奠 U+5960
+    0xC5AE, // 女 U+5973
+    0xC4CC, // 奶 U+5976
+    0xBCE9, // 奸 U+5978
+    0xCBFD, // 她 U+5979
+    0xBAC3, // 好 U+597D
+    0xC8E7, // 如 U+5982
+    0xD7B1, // 妆 U+5986
+    0xB8BE, // 妇 U+5987
+    0xC2E8, // 妈 U+5988
+    0xD1FD, // 妖 U+5996
+    0xCDD7, // 妥 U+59A5
+    0xB7C1, // 妨 U+59A8
+    0xC3C3, // 妹 U+59B9
+    0xC6DE, // 妻 U+59BB
+    0xC4B7, // 姆 U+59C6
+    0xCABC, // 始 U+59CB
+    0xB9C3, // 姑 U+59D1
+    0xCEAF, // 委 U+59D4
+    0xD2A6, // 姚 U+59DA
+    0xBDAA, // 姜 U+59DC
+    0xD2CC, // 姨 U+59E8
+    0xBCA7, // 姬 U+59EC
+    0xCDFE, // 威 U+5A01
+    0xC2A6, // 娄 U+5A04
+    0xBDBF, // 娇 U+5A07
+    0xC4C8, // 娜 U+5A1C
+    0xBEEA, // 娟 U+5A1F
+    0xB6F0, // 娥 U+5A25
+    0xCDF1, // 婉 U+5A49
+    0xBBE9, // 婚 U+5A5A
+    0xC3C4, // 媚 U+5A9A
+    0xCFB1, // 媳 U+5AB3
+    0xBCB5, // 嫉 U+5AC9
+    0xCFD3, // 嫌 U+5ACC
+    0xD7D3, // 子 U+5B50
+    0xBFD7, // 孔 U+5B54
+    0xD7D6, // 字 U+5B57
+    0xB4E6, // 存 U+5B58
+    0xCBEF, // 孙 U+5B59
+    0xD0A2, // 孝 U+5B5D
+    0xC3CF, // 孟 U+5B5F
+    0xBCBE, // 季 U+5B63
+    0xB9C2, // 孤 U+5B64
+    0xD1A7, // 学 U+5B66
+    0xBAA2, // 孩 U+5B69
+    0xC2CF, // 孪 U+5B6A
+    0xC8E6, // 孺 U+5B7A
+    0xC4FE, // 宁 U+5B81
+    0xCBFC, // 它 U+5B83
+    0xD3EE, // 宇 U+5B87
+    0xCAD8, // 守 U+5B88
+    0xB0B2, // 安 U+5B89
+    0xCBCE, // 宋 U+5B8B
+    0xCDEA, // 完 U+5B8C
+    0xBAEA, // 宏 U+5B8F
+    0xD7DA, // 宗 U+5B97
+    0xB9D9, // 官 U+5B98
+    0xD6E6, // 宙 U+5B99
+    0xB6A8, // 定 U+5B9A
+    0xCDF0, // 宛 U+5B9B
+    0xD2CB, // 宜 U+5B9C
+    0xB1A6, // 宝 U+5B9D
+    0xCAB5, // 实 U+5B9E
+    0xC9F3, // 审 U+5BA1
+    0xBFCD, // 客 U+5BA2
+    0xD0FB, // 宣 U+5BA3
+    0xCAD2, // 室 U+5BA4
+    0xBBC2, // 宦 U+5BA6
+    0xCFDC, // 宪 U+5BAA
+    0xB9AC, // 宫 U+5BAB
+    0xBAA6, // 害 U+5BB3
+    0xD1E7, // 宴 U+5BB4
+    0xCFFC, // 宵 U+5BB5
+    0xBCD2, // 家 U+5BB6
+    0xC8DD, // 容 U+5BB9
+    0xBFED, // 宽 U+5BBD
+    0xB1F6, // 宾 U+5BBE
+    0xBCC5, // 寂 U+5BC2
+    0xBCC4, // 寄 U+5BC4
+    0xD2FA, // 寅 U+5BC5
+    0xC3DC, // 密 U+5BC6
+    0xB8BB, // 富 U+5BCC
+    0xC3C2, // 寐 U+5BD0
+    0xB2EC, // 察 U+5BDF
+    0xD5AF, // 寨 U+5BE8
+    0xB4E7, // 寸 U+5BF8
+    0xB6D4, // 对 U+5BF9
+    0xCBC2, // 寺 U+5BFA
+    0xD1B0, // 寻 U+5BFB
+    0xB5BC, // 导 U+5BFC
+    0xCAD9, // 寿 U+5BFF
+    0xB7E2, // 封 U+5C01
+    0xC9E4, // 射 U+5C04
+    0xBDAB, // 将 U+5C06
+    0xD0A1, // 小 U+5C0F
+    0xC9D9, // 少 U+5C11
+    0xB6FB, // 尔 U+5C14
+    0xBCE2, // 尖 U+5C16
+    0xC9D0, // 尚 U+5C1A
+    0xB3A2, // 尝 U+5C1D
+    0xD3C8, // 尤 U+5C24
+    0xD2A2, // 尧 U+5C27
+    0xBECD, // 就 U+5C31
+    0xCAAC, // 尸 U+5C38
+    0xD2FC, // 尹 U+5C39
+    0xB3DF, // 尺 U+5C3A
+    0xC4E1, // 尼 U+5C3C
+    0xBEA1, // 尽 U+5C3D
+    0xCEB2, // 尾 U+5C3E
+    0xBED6, // 局 U+5C40
+    0xB2E3, // 层 U+5C42
+    0xBED3, // 居 U+5C45
+    0xC7FC, // 屈 U+5C48
+    0xCCEB, // 屉 U+5C49
+    0xBDEC, // 届 U+5C4A
+    0xD5B9, // 展 U+5C55
+    0xCAF4, // 属 U+5C5E
+    0xCDC0, // 屠 U+5C60
+    0xC2C5, // 屡 U+5C61
+    0xC2C4, // 履 U+5C65
+    0xCDCD, // 屯 U+5C6F
+    0xC9BD, // 山 U+5C71
+    0xC6F1, // 岂 U+5C82
+    0xB5BA, // 岛 U+5C9B
+    0xD1D2, // 岩 U+5CA9
+    0xC1EB, // 岭 U+5CAD
+    0xD4C0, // 岳 U+5CB3
+    0xB0B6, // 岸 U+5CB8
+    0xC7CD, // 峭 U+5CED
+    0xB7E5, // 峰 U+5CF0
+    0xB3E7, // 崇 U+5D07
+    0xB4DE, // 崔 U+5D14
+    0xD5B8, // 崭 U+5D2D
+    0xCEA1, // 巍 U+5DCD
+    0xB4A8, // 川 U+5DDD
+    0xD6DD, // 州 U+5DDE
+    0xD1B2, // 巡 U+5DE1
+    0xB3B2, // 巢 U+5DE2
+    0xB9A4, // 工 U+5DE5
+    0xD7F3, // 左 U+5DE6
+    0xC7C9, // 巧 U+5DE7
+    0xBEDE, // 巨 U+5DE8
+    0xB9AE, // 巩 U+5DE9
+    0xCED7, // 巫 U+5DEB
+    0xB2EE, // 差 U+5DEE
+    0xBCBA, // 己 U+5DF1
+    0xD2D1, // 已 U+5DF2
+    0xCBC8, // 巳 U+5DF3
+    0xB0CD, // 巴 U+5DF4
+    0xCAD0, // 市 U+5E02
+    0xB2BC, // 布 U+5E03
+    0xCAA6, // 师 U+5E08
+    0xCFA3, // 希 U+5E0C
+    0xB2AF, // 帛 U+5E1B
+    0xB5DB, // 帝 U+5E1D
+    0xB4F8, // 带 U+5E26
+    0xCFAF, // 席 U+5E2D
+    0xB0EF, // 帮 U+5E2E
+    0xB3A3, // 常 U+5E38
+    0xC3B1, // 帽 U+5E3D
+    0xC3DD, // 幂 U+5E42
+    0xB8C9, // 干 U+5E72
+    0xC6BD, // 平 U+5E73
+    0xC4EA, // 年 U+5E74
+    0xB2A2, // 并 U+5E76
+    0xD0D2, // 幸 U+5E78
+    0xBBC3, // 幻 U+5E7B
+    0xD3D7, // 幼 U+5E7C
+    0xB9E3, // 广 U+5E7F
+    0xD7AF, // 庄 U+5E84
+    0xC7EC, // 庆 U+5E86
+    0xB4B2, // 床 U+5E8A
+    0xD0F2, // 序 U+5E8F
+    0xD3A6, // 应 U+5E94
+    0xB5D7, // 底 U+5E95
+    0xC3ED, // 庙 U+5E99
+    0xB8FD, // 庚 U+5E9A
+    0xB8AE, // 府 U+5E9C
+    0xC5D3, // 庞 U+5E9E
+    0xB6C8, // 度 U+5EA6
+    0xD7F9, // 座 U+5EA7
+    0xCDA5, // 庭 U+5EAD
+    0xCAFC, // 庶 U+5EB6
+    0xBFB5, // 康 U+5EB7
+    0xC1CE, // 廖 U+5ED6
+    0xD1D3, // 延 U+5EF6
+    0xCDA2, // 廷 U+5EF7
+    0xBDA8, // 建 U+5EFA
+    0xBFAA, // 开 U+5F00
+    0xD2EC, // 异 U+5F02
+    0xC6FA, // 弃 U+5F03
+    0xB1D7, // 弊 U+5F0A
+    0xCABD, // 式 U+5F0F
+    0xB9AD, // 弓 U+5F13
+    0xD2FD, // 引 U+5F15
+    0xB3DA, // 弛 U+5F1B
+    0xB5DC, // 弟 U+5F1F
+    0xD5C5, // 张 U+5F20
+    0xC8F5, // 弱 U+5F31
+    0xB5AF, // 弹 U+5F39
+    0xC7BF, // 强 U+5F3A
+    0xB9E9, // 归 U+5F52
+    0xB5B1, // 当 U+5F53
+    0xC2BC, // 录 U+5F55
+    0xD0CE, // 形 U+5F62
+    0xCDAE, // 彤 U+5F64
+    0xD1E5, // 彦 U+5F66
+    0xB2CA, // 彩 U+5F69
+    0xB1EB, // 彪 U+5F6A
+    0xB1F2, // 彬 U+5F6C
+    0xC5ED, // 彭 U+5F6D
+    0xD3B0, // 影 U+5F71
+    0xB3B9, // 彻 U+5F7B
+    0xCDF9, // 往 U+5F80
+    0xD5F7, // 征 U+5F81
+    0xBEB6, // 径 U+5F84
+    0xB4FD, // 待 U+5F85
+    0xBADC, // 很 U+5F88
+    0xBBB2, // 徊 U+5F8A
+    0xC2C9, // 律 U+5F8B
+    0xD0EC, // 徐 U+5F90
+    0xB5C3, // 得 U+5F97
+    0xCEA2, // 微 U+5FAE
+    0xB5C2, // 德 U+5FB7
+    0xD0C4, // 心 U+5FC3
+    0xB1D8, // 必 U+5FC5
+    0xD2E4, // 忆 U+5FC6
+    0xD6BE, // 志 U+5FD7
+    0xC3A6, // 忙 U+5FD9
+    0xD6D2, // 忠 U+5FE0
+    0xD3C7, // 忧 U+5FE7
+    0xBFEC, // 快 U+5FEB
+    0xB3C0, // 忱 U+5FF1
+    0xC4EE, // 念 U+5FF5
+    0xBBB3, // 怀 U+6000
+    0xCCAC, // 态 U+6001
+    0xD4F5, // 怎 U+600E
+    0xC5AD, // 怒 U+6012
+    0xC5C2, // 怕 U+6015
+    0xB2C0, // 怖 U+6016
+    0xCBBC, // 思 U+601D
+    0xB5A1, // 怠 U+6020
+    0xBCB1, // 急 U+6025
+    0xD0D4, // 性 U+6027
+    0xB9D6, // 怪 U+602A
+    0xD7DC, // 总 U+603B
+    0xBAE3, // 恒 U+6052
+    0xBADE, // 恨 U+6068
+    0xB6F7, // 恩 U+6069
+    0xB9A7, // 恭 U+606D
+    0xC7C4, // 悄 U+6084
+    0xBBDA, // 悔 U+6094
+    0xCEF2, // 悟 U+609F
+    0xBBBC, // 患 U+60A3
+    0xD4C3, // 悦 U+60A6
+    0xD0FC, // 悬 U+60AC
+    0xB1AF, // 悲 U+60B2
+    0xC7E9, // 情 U+60C5
+    0xCEA9, // 惟 U+60DF
+    0xBBDD, // 惠 U+60E0
+    0xB1B9, // 惫 U+60EB
+    0xB2D1, // 惭 U+60ED
+    0xB5AC, // 惮 U+60EE
+    0xCFEB, // 想 U+60F3
+    0xD3FA, // 愈 U+6108
+    0xD3E4, // 愉 U+6109
+    0xD2E2, // 意 U+610F
+    0xB8D0, // 感 U+611F
+    0xB4C8, // 慈 U+6148
+    0xC9F7, // 慎 U+614E
+    0xC2FD, // 慢 U+6162
+    0xBBDB, // 慧 U+6167
+    0xBFAE, // 慨 U+6168
+    0xB1EF, // 憋 U+618B
+    0xBAA9, // 憨 U+61A8
+    0xB6AE, // 懂 U+61C2
+    0xD0B8, // 懈 U+61C8
+    0xB8EA, // 戈 U+6208
+    0xC8D6, // 戎 U+620E
+    0xCFB7, // 戏 U+620F
+    0xB3C9, // 成 U+6210
+    0xCED2, // 我 U+6211
+    0xBDE4, // 戒 U+6212
+    0xBBF2, // 或 U+6216
+    0xD5BD, // 战 U+6218
+    0xC6DD, // 戚 U+621A
+    0xBDD8, // 截 U+622A
+    0xB4F7, // 戴 U+6234
+    0xB7BF, // 房 U+623F
+    0xCBF9, // 所 U+6240
+    0xCAD6, // 手 U+624B
+    0xB2C5, // 才 U+624D
+    0xD4FA, // 扎 U+624E
+    0xB4F2, // 打 U+6253
+    0xC8D3, // 扔 U+6254
+    0xBFDB, // 扣 U+6263
+    0xD6B4, // 执 U+6267
+    0xC0A9, // 扩 U+6269
+    0xC9A8, // 扫 U+626B
+    0xD1EF, // 扬 U+626C
+    0xC5A4, // 扭 U+626D
+    0xC5FA, // 批 U+6279
+    0xD5D2, // 找 U+627E
+    0xB3D0, // 承 U+627F
+    0xBCBC, // 技 U+6280
+    0xB0D1, // 把 U+628A
+    0xD7A5, // 抓 U+6293
+    0xCDB6, // 投 U+6295
+    0xD5DB, // 折 U+6298
+    0xC5D7, // 抛 U+629B
+    0xC7C0, // 抢 U+62A2
+    0xBBA4, // 护 U+62A4
+    0xB1A8, // 报 U+62A5
+    0xD1BA, // 押 U+62BC
+    0xB3E9, // 抽 U+62BD
+    0xC3F2, // 抿 U+62BF
+    0xB7F7, // 拂 U+62C2
+    0xB5A3, // 担 U+62C5
+    0xB2F0, // 拆 U+62C6
+    0xC0AD, // 拉 U+62C9
+    0xCDD8, // 拓 U+62D3
+    0xCDCF, // 拖 U+62D6
+    0xB0DD, // 拜 U+62DC
+    0xD3B5, // 拥 U+62E5
+    0xB2A6, // 拨 U+62E8
+    0xC0A8, // 括 U+62EC
+    0xCBA9, // 拴 U+62F4
+    0xC4C3, // 拿 U+62FF
+    0xB3D6, // 持 U+6301
+    0xD6B8, // 指 U+6307
+    0xB0B4, // 按 U+6309
+    0xCDDA, // 挖 U+6316
+    0xC2CE, // 挛 U+631B
+    0xCCA2, // 挞 U+631E
+    0xBBD3, // 挥 U+6325
+    0xD5F1, // 振 U+632F
+    0xCDA6, // 挺 U+633A
+    0xBAB4, // 捍 U+634D
+    0xC9D3, // 捎 U+634E
+    0xC4F3, // 捏 U+634F
+    0xCBF0, // 损 U+635F
+    0xBCF1, // 捡 U+6361
+    0xBBBB, // 换 U+6362
+    0xBEDD, // 据 U+636E
+    0xBDDD, // 捷 U+6377
+    0xD5C6, // 掌 U+638C
+    0xC5C5, // 排 U+6392
+    0xD2B4, // 掖 U+6396
+    0xCCBD, // 探 U+63A2
+    0xBDD3, // 接 U+63A5
+    0xBFD8, // 控 U+63A7
+    0xCDC6, // 推 U+63A8
+    0xD1DA, // 掩 U+63A9
+    0xB4EB, // 措 U+63AA
+    0xC8E0, // 揉 U+63C9
+    0xC3E8, // 描 U+63CF
+    0xCCE1, // 提 U+63D0
+    0xB2E5, // 插 U+63D2
+    0xCED5, // 握 U+63E1
+    0xBFAB, // 揩 U+63E9
+    0xC2A7, // 搂 U+6402
+    0xB4A4, // 搐 U+6410
+    0xB8E3, // 搞 U+641E
+    0xB0E1, // 搬 U+642C
+    0xD0AF, // 携 U+643A
+    0xB0DA, // 摆 U+6446
+    0xD2A1, // 摇 U+6447
+    0xC7CB, // 撬 U+64AC
+    0xB2A5, // 播 U+64AD
+    0xD7AB, // 撰 U+64B0
+    0xC9C3, // 擅 U+64C5
+    0xB2D9, // 操 U+64CD
+    0xC7DC, // 擒 U+64D2
+    0xC5CA, // 攀 U+6500
+    0xD6A7, // 支 U+652F
+    0xCAD5, // 收 U+6536
+    0xB8C4, // 改 U+6539
+    0xB9A5, // 攻 U+653B
+    0xB7C5, // 放 U+653E
+    0xD5FE, // 政 U+653F
+    0xB9CA, // 故 U+6545
+    0xD0A7, // 效 U+6548
+    0xB5D0, // 敌 U+654C
+    0xC3F4, // 敏 U+654F
+    0xBDCC, // 教 U+6559
+    0xB1D6, // 敝 U+655D
+    0xB8D2, // 敢 U+6562
+    0xC9A2, // 散 U+6563
+    0xB6D8, // 敦 U+6566
+    0xBEB4, // 敬 U+656C
+    0xCAFD, // 数 U+6570
+    0xD5FB, // 整 U+6574
+    0xCEC4, // 文 U+6587
+    0xB1F3, // 斌 U+658C
+    0xB0DF, // 斑 U+6591
+    0xB6B7, // 斗 U+6597
+    0xC1CF, // 料 U+6599
+    0xD0B1, // 斜 U+659C
+    0xD5E5, // 斟 U+659F
+    0xBDEF, // 斤 U+65A4
+    0xD5B6, // 斩 U+65A9
+    0xB6CF, // 断 U+65AD
+    0xCBB9, // 斯 U+65AF
+    0xD0C2, // 新 U+65B0
+    0xB7BD, // 方 U+65B9
+    0xCAA9, // 施 U+65BD
+    0xC5D4, // 旁 U+65C1
+    0xD0FD, // 旋 U+65CB
+    0xD7E5, // 族 U+65CF
+    0xCEDE, // 无 U+65E0
+    0xBCC8, // 既 U+65E2
+    0xC8D5, // 日 U+65E5
+    0xBEC9, // 旧 U+65E7
+    0xD6BC, // 旨 U+65E8
+    0xD4E7, // 早 U+65E9
+    0xD1AE, // 旬 U+65EC
+    0xD0F1, // 旭 U+65ED
+    0xBAB5, // 旱 U+65F1
+    0xCAB1, // 时 U+65F6
+    0xCDFA, // 旺 U+65FA
+    0xC0A5, // 昆 U+6606
+    0xB2FD, // 昌 U+660C
+    0xC3F7, // 明 U+660E
+    0xD2D7, // 易 U+6613
+    0xD0C7, // 星 U+661F
+    0xD3B3, // 映 U+6620
+    0xB4BA, // 春 U+6625
+    0xD7F2, // 昨 U+6628
+    0xD5D1, // 昭 U+662D
+    0xCAC7, // 是 U+662F
+    0xCFD4, // 显 U+663E
+    0xBBCE, // 晃 U+6643
+    0xBDFA, // 晋 U+664B
+    0xCFFE, // 晓 U+6653
+    0xD4CE, // 晕 U+6655
+    0xCDED, // 晚 U+665A
+    0xCEEE, // 晤 U+6664
+    0xBBDE, // 晦 U+6666
+    0xB3BF, // 晨 U+6668
+    0xC6D5, // 普 U+666E
+    0xBEB0, // 景 U+666F
+    0xC7E7, // 晴 U+6674
+    0xBEA7, // 晶 U+6676
+    0xD6C7, // 智 U+667A
+    0xCFBE, // 暇 U+6687
+    0xB0B5, // 暗 U+6697
+    0xC4BA, // 暮 U+66AE
+    0xB1A9, // 暴 U+66B4
+    0xCAEF, // 曙 U+66D9
+    0xD4BB, // 曰 U+66F0
+    0xC7FA, // 曲 U+66F2
+    0xD2B7, // 曳 U+66F3
+    0xB8FC, // 更 U+66F4
+    0xB2DC, // 曹 U+66F9
+    0xC2FC, // 曼 U+66FC
+    0xD4F8, // 曾 U+66FE
+    0xCCE6, // 替 U+66FF
+    0xD7EE, // 最 U+6700
+    0xD4C2, // 月 U+6708
+    0xD3D0, // 有 U+6709
+    0xC5F3, // 朋 U+670B
+    0xB7FE, // 服 U+670D
+    0xCDFB, // 望 U+671B
+    0xB3AF, // 朝 U+671D
+    0xC6DA, // 期 U+671F
+    0xC4BE, // 木 U+6728
+    0xCEB4, // 未 U+672A
+    0xC4A9, // 末 U+672B
+    0xB1BE, // 本 U+672C
+    0xCAF5, // 术 U+672F
+    0xD6EC, // 朱 U+6731
+    0xB6E4, // 朵 U+6735
+    0xBBFA, // 机 U+673A
+    0xC9B1, // 杀 U+6740
+    0xD4D3, // 杂 U+6742
+    0xC8A8, // 权 U+6743
+    0xB8CB, // 杆 U+6746
+    0xC0EE, // 李 U+674E
+    0xD0D3, // 杏 U+674F
+    0xB2C4, // 材 U+6750
+    0xB4E5, // 村 U+6751
+    0xB6C5, // 杜 U+675C
+    0xCAF8, // 束 U+675F
+    0xCCF5, // 条 U+6761
+    0xC0B4, // 来 U+6765
+    0xD1EE, // 杨 U+6768
+    0xBABC, // 杭 U+676D
+    0xB1AD, // 杯 U+676F
+    0xBDDC, // 杰 U+6770
+    0xCBC9, // 松 U+677E
+    0xB0E5, // 板 U+677F
+    0xBCAB, // 极 U+6781
+    0xB9B9, // 构 U+6784
+    0xCEF6, // 析 U+6790
+    0xC1D6, // 林 U+6797
+    0xB9FB, // 果 U+679C
+    0xD6A6, // 枝 U+679D
+    0xC7B9, // 枪 U+67AA
+    0xB7E3, // 枫 U+67AB
+    0xBFDD, // 枯 U+67AF
+    0xBCDC, // 架 U+67B6
+    0xB0D8, // 柏 U+67CF
+    0xC4B3, // 某 U+67D0
+    0xB8CC, // 柑 U+67D1
+    0xC8BE, // 染 U+67D3
+    0xB2E9, // 查 U+67E5
+    0xBCED, // 柬 U+67EC
+    0xBFC2, // 柯 U+67EF
+    0xD6F9, // 柱 U+67F1
+    0xC1F8, // 柳 U+67F3
+    0xB2F1, // 柴 U+67F4
+    0xB1EA, // 标 U+6807
+    0xD5BB, // 栈 U+6808
+    0xB6B0, // 栋 U+680B
+    0xCAF7, // 树 U+6811
+    0xD0A3, // 校 U+6821
+    0xD6EA, // 株 U+682A
+    0xD1F9, // 样 U+6837
+    0xBACB, // 核 U+6838
+    0xB8F9, // 根 U+6839
+    0xB8F1, // 格 U+683C
+    0xB9F0, // 桂 U+6842
+    0xCCD2, // 桃 U+6843
+    0xCEA6, // 桅 U+6845
+    0xB0B8, // 案 U+6848
+    0xC9A3, // 桑 U+6851
+    0xBBB8, // 桓 U+6853
+    0xB5B5, // 档 U+6863
+    0xC7C5, // 桥 U+6865
+    0xC1BA, // 梁 U+6881
+    0xC3B7, // 梅 U+6885
+    0xC0E6, // 梨 U+68A8
+    0xD0B5, // 械 U+68B0
+    0xCAE1, // 梳 U+68B3
+    0xBCEC, // 检 U+68C0
+    0xC3DE, // 棉 U+68C9
+    0xC6E5, // 棋 U+68CB
+    0xB9F7, // 棍 U+68CD
+    0xD7D8, // 棕 U+68D5
+    0xCCC4, // 棠 U+68E0
+    0xC9AD, // 森 U+68EE
+    0xBFC3, // 棵 U+68F5
+    0xD6B2, // 植 U+690D
+    0xD2AC, // 椰 U+6930
+    0xB4BB, // 椿 U+693F
+    0xBFAC, // 楷 U+6977
+    0xC2A5, // 楼 U+697C
+    0xBBB1, // 槐 U+69D0
+    0xB2DB, // 槽 U+69FD
+    0xB7AE, // 樊 U+6A0A
+    0xC4A3, // 模 U+6A21
+    0xCFF0, // 橡 U+6A61
+    0xC7B7, // 欠 U+6B20
+    0xB4CE, // 次 U+6B21
+    0xBBB6, // 欢 U+6B22
+    0xD0C0, // 欣 U+6B23
+    0xC5B7, // 欧 U+6B27
+    0xD3FB, // 欲 U+6B32
+    0xB8E8, // 歌 U+6B4C
+    0xD6B9, // 止 U+6B62
+    0xD5FD, // 正 U+6B63
+    0xB4CB, // 此 U+6B64
+    0xB2BD, // 步 U+6B65
+    0xCEE4, // 武 U+6B66
+    0xC6E7, // 歧 U+6B67
+    0xCBC0, // 死 U+6B7B
+    0xB2D0, // 残 U+6B8B
+    0xD6B3, // 殖 U+6B96
+    0xB6CE, // 段 U+6BB5
+    0xD2F3, // 殷 U+6BB7
+    0xB5EE, // 殿 U+6BBF
+    0xBBD9, // 毁 U+6BC1
+    0xD2E3, // 毅 U+6BC5
+    0xC4B8, // 母 U+6BCD
+    0xC3BF, // 每 U+6BCF
+    0xB6BE, // 毒 U+6BD2
+    0xB1C8, // 比 U+6BD4
+    0xB1CF, // 毕 U+6BD5
+    0xB1D1, // 毖 U+6BD6
+    0xC3AB, // 毛 U+6BDB
+    0xBAC1, // 毫 U+6BEB
+    0xCACF, // 氏 U+6C0F
+    0xC3F1, // 民 U+6C11
+    0xC6F8, // 气 U+6C14
+    0xB7D5, // 氛 U+6C1B
+    0xD1F5, // 氧 U+6C27
+    0xCBAE, // 水 U+6C34
+    0xD3C0, // 永 U+6C38
+    0xC7F3, // 求 U+6C42
+    0xBBE3, // 汇 U+6C47
+    0xBABA, // 汉 U+6C49
+    0xC9C7, // 汕 U+6C55
+    0xD1B4, // 汛 U+6C5B
+    0xC8EA, // 汝 U+6C5D
+    0xBDAD, // 江 U+6C5F
+    0xB3D8, // 池 U+6C60
+    0xCCC0, // 汤 U+6C64
+    0xCDF4, // 汪 U+6C6A
+    0xC6FB, // 汽 U+6C7D
+    0xC7DF, // 沁 U+6C81
+    0xC9F2, // 沈 U+6C88
+    0xC9B3, // 沙 U+6C99
+    0xC5E6, // 沛 U+6C9B
+    0xB9B5, // 沟 U+6C9F
+    0xC3BB, // 没 U+6CA1
+    0xC4AD, // 沫 U+6CAB
+    0xBAD3, // 河 U+6CB3
+    0xB7D0, // 沸 U+6CB8
+    0xD3CD, // 油 U+6CB9
+    0xD6CE, // 治 U+6CBB
+    0xD1D8, // 沿 U+6CBF
+    0xC8AA, // 泉 U+6CC9
+    0xB2B4, // 泊 U+6CCA
+    0xB7A8, // 法 U+6CD5
+    0xB2A8, // 波 U+6CE2
+    0xC4E0, // 泥 U+6CE5
+    0xD7A2, // 注 U+6CE8
+    0xCCA9, // 泰 U+6CF0
+    0xB1C3, // 泵 U+6CF5
+    0xD4F3, // 泽 U+6CFD
+    0xBDE0, // 洁 U+6D01
+    0xD1F3, // 洋 U+6D0B
+    0xC8F7, // 洒 U+6D12
+    0xBDF2, // 津 U+6D25
+    0xBAE9, // 洪 U+6D2A
+    0xD6DE, // 洲 U+6D32
+    0xBBEE, // 活 U+6D3B
+    0xCDDD, // 洼 U+6D3C
+    0xC5C9, // 派 U+6D3E
+    0xC1F7, // 流 U+6D41
+    0xD7C7, // 浊 U+6D4A
+    0xB2E2, // 测 U+6D4B
+    0xBCC3, // 济 U+6D4E
+    0xC6D6, // 浦 U+6D66
+    0xBAC6, // 浩 U+6D69
+    0xB8A1, // 浮 U+6D6E
+    0xBAA3, // 海 U+6D77
+    0xBDFE, // 浸 U+6D78
+    0xCDBF, // 涂 U+6D82
+    0xCFFB, // 消 U+6D88
+    0xCCCE, // 涛 U+6D9B
+    0xC8F3, // 润 U+6DA6
+    0xD5C7, // 涨 U+6DA8
+    0xD2BA, // 液 U+6DB2
+    0xBAD4, // 涸 U+6DB8
+    0xD7CD, // 淄 U+6DC4
+    0xCAE7, // 淑 U+6DD1
+    0xB5AD, // 淡 U+6DE1
+    0xD3D9, // 淤 U+6DE4
+    0xBBB4, // 淮 U+6DEE
+    0xC9EE, // 深 U+6DF1
+    0xBBEC, // 混 U+6DF7
+    0xC7E5, // 清 U+6E05
+    0xBDA5, // 渐 U+6E10
+    0xD3E6, // 渔 U+6E14
+    0xC9F8, // 渗 U+6E17
+    0xC7FE, // 渠 U+6E20
+    0xB6C9, // 渡 U+6E21
+    0xB2B3, // 渤 U+6E24
+    0xCEC2, // 温 U+6E29
+    0xD3CE, // 游 U+6E38
+    0xCFE6, // 湘 U+6E58
+    0xCAAA, // 湿 U+6E7F
+    0xD4B4, // 源 U+6E90
+    0xCFAA, // 溪 U+6EAA
+    0xC8DC, // 溶 U+6EB6
+    0xB3FC, // 滁 U+6EC1
+    0xB5E1, // 滇 U+6EC7
+    0xBBAC, // 滑 U+6ED1
+    0xD7D2, // 滓 U+6ED3
+    0xB9F6, // 滚 U+6EDA
+    0xC2FA, // 满 U+6EE1
+    0xB1F5, // 滨 U+6EE8
+    0xD1DD, // 演 U+6F14
+    0xCAFE, // 漱 U+6F31
+    0xC5CB, // 潘 U+6F58
+    0xC1CA, // 潦 U+6F66
+    0xB3B1, // 潮 U+6F6E
+    0xC5EC, // 澎 U+6F8E
+    0xD4E8, // 澡 U+6FA1
+    0xB0C4, // 澳 U+6FB3
+    0xBCA4, // 激 U+6FC0
+    0xE5A7, // 濮 U+6FEE
+    0xB9E0, // 灌 U+704C
+    0xBBF0, // 火 U+706B
+    0xC3F0, // 灭 U+706D
+    0xB5C6, // 灯 U+706F
+    0xBBD2, // 灰 U+7070
+    0xC1E9, // 灵 U+7075
+    0xD4EE, // 灶 U+7076
+    0xD4D6, // 灾 U+707E
+    0xB2D3, // 灿 U+707F
+    0xD1D7, // 炎 U+708E
+    0xB3B4, // 炒 U+7092
+    0xC8B2, // 炔 U+7094
+    0xBFBB, // 炕 U+7095
+    0xD6CB, // 炙 U+7099
+    0xC5DA, // 炮 U+70AE
+    0xB1FE, // 炳 U+70B3
+    0xD5A8, // 炸 U+70B8
+    0xB5E3, // 点 U+70B9
+    0xB3E3, // 炽 U+70BD
+    0xCCFE, // 烃 U+70C3
+    0xC1D2, // 烈 U+70C8
+    0xD6F2, // 烛 U+70DB
+    0xD1CC, // 烟 U+70DF
+    0xBFBE, // 烤 U+70E4
+    0xC8C8, // 热 U+70ED
+    0xB7E9, // 烽 U+70FD
+    0xBAB8, // 焊 U+710A
+    0xBBC0, // 焕 U+7115
+    0xBDB9, // 焦 U+7126
+    0xC8BB, // 然 U+7136
+    0xBBCD, // 煌 U+714C
+    0xBCE5, // 煎 U+714E
+    0xC3BA, // 煤 U+7164
+    0xD5D5, // 照 U+7167
+    0xD0DC, // 熊 U+718A
+    0xCEF5, // 熙 U+7199
+    0xCAEC, // 熟 U+719F
+    0xC8BC, // 燃 U+71C3
+    0xD1E0, // 燕 U+71D5
+    0xB0AE, // 爱 U+7231
+    0xB8B8, // 父 U+7236
+    0xB0D6, // 爸 U+7238
+    0xC6AC, // 片 U+7247
+    0xB0E6, // 版 U+7248
+    0xD1C0, // 牙 U+7259
+    0xC5A3, // 牛 U+725B
+    0xC4B2, // 牟 U+725F
+    0xC0CE, // 牢 U+7262
+    0xC4C1, // 牧 U+7267
+    0xCEEF, // 物 U+7269
+    0xCCD8, // 特 U+7279
+    0xC8AE, // 犬 U+72AC
+    0xD7B4, // 状 U+72B6
+    0xB5D2, // 狄 U+72C4
+    0xB1B7, // 狈 U+72C8
+    0xBED1, // 狙 U+72D9
+    0xBADD, // 狠 U+72E0
+    0xB6C0, // 独 U+72EC
+    0xD5F8, // 狰 U+72F0
+    0xD3FC, // 狱 U+72F1
+    0xC3CD, // 猛 U+731B
+    0xD6ED, // 猪 U+732A
+    0xCFD7, // 献 U+732E
+    0xC2CA, // 率 U+7387
+    0xD3F1, // 玉 U+7389
+    0xCDF5, // 王 U+738B
+    0xC3B5, // 玫 U+73AB
+    0xBBB7, // 环 U+73AF
+    0xCFD6, // 现 U+73B0
+    0xC1E1, // 玲 U+73B2
+    0xB2A3, // 玻 U+73BB
+    0xC9BA, // 珊 U+73CA
+    0xD5E4, // 珍 U+73CD
+    0xD6E9, // 珠 U+73E0
+    0xB0E0, // 班 U+73ED
+    0xC7F2, // 球 U+7403
+    0xC0ED, // 理 U+7406
+    0xC1D5, // 琳 U+7433
+    0xC7D9, // 琴 U+7434
+    0xC7ED, // 琼 U+743C
+    0xBAF7, // 瑚 U+745A
+    0xC8F0, // 瑞 U+745E
+    0xC9AA, // 瑟 U+745F
+    0xD1FE, // 瑶 U+7476
+    0xC1A7, // 璃 U+7483
+    0xB0EA, // 瓣 U+74E3
+    0xCDDF, // 瓦 U+74E6
+    0xC6BF, // 瓶 U+74F6
+    0xD5E7, // 甄 U+7504
+    0xB8CA, // 甘 U+7518
+    0xC9F5, // 甚 U+751A
+    0xC9FA, // 生 U+751F
+    0xD3C3, // 用 U+7528
+    0xCBA6, // 甩 U+7529
+    0xB8A6, // 甫 U+752B
+    0xCCEF, // 田 U+7530
+    0xD3C9, // 由 U+7531
+    0xBCD7, // 甲 U+7532
+    0xC9EA, // 申 U+7533
+    0xB5E7, // 电 U+7535
+    0xC4D0, // 男 U+7537
+    0xB5E9, // 甸 U+7538
+    0xBBAD, // 画 U+753B
+    0xB3A9, // 畅 U+7545
+    0xBDE7, // 界 U+754C
+    0xCEB7, // 畏 U+754F
+    0xC1F4, // 留 U+7559
+    0xC2D4, // 略 U+7565
+    0xC1C6, // 疗 U+7597
+    0xB0CC, // 疤 U+75A4
+    0xD5EE, // 疹 U+75B9
+    0xCCDB, // 疼 U+75BC
+    0xBCB2, // 疾 U+75BE
+    0xB2A1, // 病 U+75C5
+    0xC8AC, // 痊 U+75CA
+    0xCDB4, // 痛 U+75DB
+    0xBBBE, // 痪 U+75EA
+    0xC1F6, // 瘤 U+7624
+    0xB4F1, // 瘩 U+7629
+    0xCCB1, // 瘫 U+762B
+    0xB9EF, // 癸 U+7678
+    0xB5C7, // 登 U+767B
+    0xB0D7, // 白 U+767D
+    0xB0D9, // 百 U+767E
+    0xB5C4, // 的 U+7684
+    0xBDD4, // 皆 U+7686
+    0xB0A8, // 皑 U+7691
+    0xCDEE, // 皖 U+7696
+    0xC6A4, // 皮 U+76AE
+    0xC3F3, // 皿 U+76BF
+    0xD3DB, // 盂 U+76C2
+    0xC5E8, // 盆 U+76C6
+    0xD2E6, // 益 U+76CA
+    0xB0BB, // 盎 U+76CE
+    0xD1CE, // 盐 U+76D0
+    0xB8C7, // 盖 U+76D6
+    0xC5CC, // 盘 U+76D8
+    0xCAA2, // 盛 U+76DB
+    0xC4BF, // 目 U+76EE
+    0xB6A2, // 盯 U+76EF
+    0xD6B1, // 直 U+76F4
+    0xCFE0, // 相 U+76F8
+    0xB6DC, // 盾 U+76FE
+    0xCAA1, // 省 U+7701
+    0xC3BC, // 眉 U+7709
+    0xBFB4, // 看 U+770B
+    0xD5E6, // 真 U+771F
+    0xD1A3, // 眩 U+7729
+    0xC3D0, // 眯 U+772F
+    0xD1DB, // 眼 U+773C
+    0xD7C5, // 着 U+7740
+    0xD5F6, // 睁 U+7741
+    0xBEA6, // 睛 U+775B
+    0xCBAF, // 睡 U+7761
+    0xC4C0, // 睦 U+7766
+    0xB2C7, // 睬 U+776C
+    0xCFB9, // 瞎 U+778E
+    0xC2F7, // 瞒 U+7792
+    0xC7C6, // 瞧 U+77A7
+    0xD6F5, // 瞩 U+77A9
+    0xCDAB, // 瞳 U+77B3
+    0xB4A3, // 矗 U+77D7
+    0xC3AC, // 矛 U+77DB
+    0xCAB8, // 矢 U+77E2
+    0xD2D3, // 矣 U+77E3
+    0xD6AA, // 知 U+77E5
+    0xBED8, // 矩 U+77E9
+    0xB6CC, // 短 U+77ED
+    0xCAAF, // 石 U+77F3
+    0xBFF3, // 矿 U+77FF
+    0xC2EB, // 码 U+7801
+    0xC9B0, // 砂 U+7802
+    0xBFB3, // 砍 U+780D
+    0xD1D0, // 研 U+7814
+    0xD1E2, // 砚 U+781A
+    0xC6C6, // 破 U+7834
+    0xD4D2, // 砸 U+7838
+    0xB4A1, // 础 U+7840
+    0xD3B2, // 硬 U+786C
+    0xC8B7, // 确 U+786E
+    0xB0AD, // 碍 U+788D
+    0xB1AE, // 碑 U+7891
+    0xB5E2, // 碘 U+7898
+    0xB5FA, // 碟 U+789F
+    0xB1CC, // 碧 U+78A7
+    0xBCEE, // 碱 U+78B1
+    0xCCBC, // 碳 U+78B3
+    0xB4C5, // 磁 U+78C1
+    0xC0DA, // 磊 U+78CA
+    0xC4A5, // 磨 U+78E8
+    0xC1D7, // 磷 U+78F7
+    0xBDB8, // 礁 U+7901
+    0xCABE, // 示 U+793A
+    0xC0F1, // 礼 U+793C
+    0xC9E7, // 社 U+793E
+    0xC6EE, // 祁 U+7941
+    0xD7E6, // 祖 U+7956
+    0xD7A3, // 祝 U+795D
+    0xC9F1, // 神 U+795E
+    0xCFE9, // 祥 U+7965
+    0xBCC0, // 祭 U+796D
+    0xC2BB, // 禄 U+7984
+    0xB8A3, // 福 U+798F
+    0xC0EB, // 离 U+79BB
+    0xBACC, // 禾 U+79BE
+    0xD0E3, // 秀 U+79C0
+    0xCBBD, // 私 U+79C1
+    0xB1FC, // 秉 U+79C9
+    0xC7EF, // 秋 U+79CB
+    0xD6D6, // 种 U+79CD
+    0xBFC6, // 科 U+79D1
+    0xC3EB, // 秒 U+79D2
+    0xC3D8, // 秘 U+79D8
+    0xC7D8, // 秦 U+79E6
+    0xD6C8, // 秩 U+79E9
+    0xBBFD, // 积 U+79EF
+    0xB3C6, // 称 U+79F0
+    0xD2C6, // 移 U+79FB
+    0xB3CC, // 程 U+7A0B
+    0xB0DE, // 稗 U+7A17
+    0xCEC8, // 稳 U+7A33
+    0xB5BE, // 稻 U+7A3B
+    0xC4C2, // 穆 U+7A46
+    0xCBEB, // 穗 U+7A57
+    0xBEBF, // 究 U+7A76
+    0xBFD5, // 空 U+7A7A
+    0xCDBB, // 突 U+7A81
+    0xBFDF, // 窟 U+7A9F
+    0xC1A2, // 立 U+7ACB
+    0xD5BE, // 站 U+7AD9
+    0xD5C2, // 章 U+7AE0
+    0xCDAF, // 童 U+7AE5
+    0xB6CB, // 端 U+7AEF
+    0xD6F1, // 竹 U+7AF9
+    0xB0CA, // 笆 U+7B06
+    0xB1CA, // 笔 U+7B14
+    0xB5D1, // 笛 U+7B1B
+    0xB7FB, // 符 U+7B26
+    0xB5DA, // 第 U+7B2C
+    0xBCE3, // 笺 U+7B3A
+    0xC1FD, // 笼 U+7B3C
+    0xB5C8, // 等 U+7B49
+    0xB4F0, // 答 U+7B54
+    0xB2DF, // 策 U+7B56
+    0xBCF2, // 简 U+7B80
+    0xBBFE, // 箕 U+7B95
+    0xCBE3, // 算 U+7B97
+    0xB9DC, // 管 U+7BA1
+    0xC2E1, // 箩 U+7BA9
+    0xCFE4, // 箱 U+7BB1
+    0xC2A8, // 篓 U+7BD3
+    0xB4DB, // 篡 U+7BE1
+    0xC3D7, // 米 U+7C73
+    0xC0E0, // 类 U+7C7B
+    0xD7D1, // 籽 U+7C7D
+    0xB7DB, // 粉 U+7C89
+    0xC1A3, // 粒 U+7C92
+    0xB4D6, // 粗 U+7C97
+    0xD5B3, // 粘 U+7C98
+    0xD4C1, // 粤 U+7CA4
+    0xD6E0, // 粥 U+7CA5
+    0xC1B8, // 粮 U+7CAE
+    0xC1BB, // 粱 U+7CB1
+    0xBEAC, // 粳 U+7CB3
+    0xB4E2, // 粹 U+7CB9
+    0xBEAB, // 精 U+7CBE
+    0xC3D3, // 糜 U+7CDC
+    0xCFB5, // 系 U+7CFB
+    0xCBD8, // 素 U+7D20
+    0xBDF4, // 紧 U+7D27
+    0xC0DB, // 累 U+7D2F
+    0xBAEC, // 红 U+7EA2
+    0xD4BC, // 约 U+7EA6
+    0xBCB6, // 级 U+7EA7
+    0xBCCD, // 纪 U+7EAA
+    0xB4BF, // 纯 U+7EAF
+    0xC9B4, // 纱 U+7EB1
+    0xB8D9, // 纲 U+7EB2
+    0xD6BD, // 纸 U+7EB8
+    0xCEC6, // 纹 U+7EB9
+    0xB7C4, // 纺 U+7EBA
+    0xCFDF, // 线 U+7EBF
+    0xC1B7, // 练 U+7EC3
+    0xD7E9, // 组 U+7EC4
+    0xC9F0, // 绅 U+7EC5
+    0xCFB8, // 细 U+7EC6
+    0xD6AF, // 织 U+7EC7
+    0xD6D5, // 终 U+7EC8
+    0xC9DC, // 绍 U+7ECD
+    0xBEAD, // 经 U+7ECF
+    0xC8DE, // 绒 U+7ED2
+    0xBDE1, // 结 U+7ED3
+    0xB8F8, // 给 U+7ED9
+    0xBEF8, // 绝 U+7EDD
+    0xCDB3, // 统 U+7EDF
+    0xBCCC, // 继 U+7EE7
+    0xD0F7, // 绪 U+7EEA
+    0xD0F8, // 续 U+7EED
+    0xB4C2, // 绰 U+7EF0
+    0xCEAC, // 维 U+7EF4
+    0xC3E0, // 绵 U+7EF5
+    0xD7DB, // 综 U+7EFC
+    0xC2CC, // 绿 U+7EFF
+    0xB1E0, // 编 U+7F16
+    0xD4B5, // 缘 U+7F18
+    0xCBF5, // 缩 U+7F29
+    0xB8D7, // 缸 U+7F38
+    0xC8B1, // 缺 U+7F3A
+    0xCDF8, // 网 U+7F51
+    0xC2DE, // 罗 U+7F57
+    0xB7A3, // 罚 U+7F5A
+    0xD6C3, // 置 U+7F6E
+    0xC3C0, // 美 U+7F8E
+    0xC1E7, // 羚 U+7F9A
+    0xC8BA, // 群 U+7FA4
+    0xB8FE, // 羹 U+7FB9
+    0xD3F0, // 羽 U+7FBD
+    0xCECC, // 翁 U+7FC1
+    0xB3E1, // 翅 U+7FC5
+    0xD2EE, // 翌 U+7FCC
+    0xCFE8, // 翔 U+7FD4
+    0xB5D4, // 翟 U+7FDF
+    0xB4E4, // 翠 U+7FE0
+    0xB7AD, // 翻 U+7FFB
+    0xD2AB, // 耀 U+8000
+    0xC0CF, // 老 U+8001
+    0xBFBC, // 考 U+8003
+    0xD5DF, // 者 U+8005
+    0xB6F8, // 而 U+800C
+    0xD4C5, // 耘 U+8018
+    0xC5D5, // 耪 U+802A
+    0xB6FA, // 耳 U+8033
+    0xCBCA, // 耸 U+8038
+    0xB3DC, // 耻 U+803B
+    0xB9A2, // 耿 U+803F
+    0xC4F4, // 聂 U+8042
+    0xD6B0, // 职 U+804C
+    0xC1AA, // 联 U+8054
+    0xCBE0, // 肃 U+8083
+    0xCBC1, // 肆 U+8086
+    0xC0DF, // 肋 U+808B
+    0xBCA1, // 肌 U+808C
+    0xD0A4, // 肖 U+8096
+    0xB8D8, // 肛 U+809B
+    0xB8CE, // 肝 U+809D
+    0xB3A6, // 肠 U+80A0
+    0xD6AB, // 肢 U+80A2
+    0xB7CA, // 肥 U+80A5
+    0xBCE7, // 肩 U+80A9
+    0xB7BE, // 肪 U+80AA
+    0xBFCF, // 肯 U+80AF
+    0xD3FD, // 育 U+80B2
+    0xD6D7, // 肿 U+80BF
+    0xCEB8, // 胃 U+80C3
+    0xB5A8, // 胆 U+80C6
+    0xB1B3, // 背 U+80CC
+    0xCCA5, // 胎 U+80CE
+    0xCAA4, // 胜 U+80DC
+    0xB0FB, // 胞 U+80DE
+    0xBAFA, // 胡 U+80E1
+    0xBDBA, // 胶 U+80F6
+    0xD0D8, // 胸 U+80F8
+    0xC4DC, // 能 U+80FD
+    0xD6AC, // 脂 U+8102
+    0xC2F6, // 脉 U+8109
+    0xBCB9, // 脊 U+810A
+    0xC4D4, // 脑 U+8111
+    0xBDC5, // 脚 U+811A
+    0xCDD1, // 脱 U+8131
+    0xC1B3, // 脸 U+8138
+    0xC0B0, // 腊 U+814A
+    0xD2B8, // 腋 U+814B
+    0xB8AF, // 腐 U+8150
+    0xCCC5, // 膛 U+819B
+    0xB1DB, // 臂 U+81C2
+    0xB3BC, // 臣 U+81E3
+    0xD7D4, // 自 U+81EA
+    0xD6C2, // 致 U+81F4
+    0xBECA, // 臼 U+81FC
+    0xBECB, // 舅 U+8205
+    0xC9E1, // 舍 U+820D
+    0xCAE6, // 舒 U+8212
+    0xCCF2, // 舔 U+8214
+    0xCBB4, // 舜 U+821C
+    0xBABD, // 航 U+822A
+    0xB0E3, // 般 U+822C
+    0xB6E6, // 舵 U+8235
+    0xC1BC, // 良 U+826F
+    0xBCE8, // 艰 U+8270
+    0xC9AB, // 色 U+8272
+    0xD1DE, // 艳 U+8273
+    0xD2D5, // 艺 U+827A
+    0xBDDA, // 节 U+8282
+    0xD3F3, // 芋 U+828B
+    0xD6A5, // 芝 U+829D
+    0xC2AB, // 芦 U+82A6
+    0xB7D2, // 芬 U+82AC
+    0xB0C5, // 芭 U+82AD
+    0xBBA8, // 花 U+82B1
+    0xB7BC, // 芳 U+82B3
+    0xC7DB, // 芹 U+82B9
+    0xD1BF, // 芽 U+82BD
+    0xCBD5, // 苏 U+82CF
+    0xC3E7, // 苗 U+82D7
+    0xBFC1, // 苛 U+82DB
+    0xC8F4, // 若 U+82E5
+    0xBFE0, // 苦 U+82E6
+    0xB1BD, // 苯 U+82EF
+    0xD3A2, // 英 U+82F1
+    0xC3AF, // 茂 U+8302
+    0xB7B6, // 范 U+8303
+    0xC3A9, // 茅 U+8305
+    0xC8D7, // 茸 U+8338
+    0xC8E3, // 茹 U+8339
+    0xBEA3, // 荆 U+8346
+    0xB2DD, // 草 U+8349
+    0xB5B4, // 荡 U+8361
+    0xC8D9, // 荣 U+8363
+    0xBBE7, // 荤 U+8364
+    0xD2A9, // 药 U+836F
+    0xC0F2, // 莉 U+8389
+    0xC4AA, // 莫 U+83AB
+    0xC1AB, // 莲 U+83B2
+    0xBBF1, // 获 U+83B7
+    0xD3A8, // 莹 U+83B9
+    0xC3A7, // 莽 U+83BD
+    0xBED5, // 菊 U+83CA
+    0xBEFA, // 菌 U+83CC
+    0xBACA, // 菏 U+83CF
+    0xB2CB, // 菜 U+83DC
+    0xC6D0, // 菩 U+83E9
+    0xC1E2, // 菱 U+83F1
+    0xB7C6, // 菲 U+83F2
+    0xCCD1, // 萄 U+8404
+    0xC3C8, // 萌 U+840C
+    0xC6BC, // 萍 U+840D
+    0xD3AA, // 营 U+8425
+    0xCFF4, // 萧 U+8427
+    0xC2E4, // 落 U+843D
+    0xD6F8, // 著 U+8457
+    0xB8F0, // 葛 U+845B
+    0xB6AD, // 董 U+8463
+    0xBAF9, // 葫 U+846B
+    0xD4E1, // 葬 U+846C
+    0xBDAF, // 蒋 U+848B
+    0xD5F4, // 蒸 U+84B8
+    0xC8D8, // 蓉 U+84C9
+    0xCEB5, // 蔚 U+851A
+    0xB2CC, // 蔡 U+8521
+    0xC8EF, // 蕊 U+854A
+    0xD4CC, // 蕴 U+8574
+    0xC0D9, // 蕾 U+857E
+    0xD1A6, // 薛 U+859B
+    0xB2D8, // 藏 U+85CF
+    0xB7AA, // 藩 U+85E9
+    0xBBA2, // 虎 U+864E
+    0xD0E9, // 虚 U+865A
+    0xD3DD, // 虞 U+865E
+    0xB3E6, // 虫 U+866B
+    0xBAE7, // 虹 U+8679
+    0xCBE4, // 虽 U+867D
+    0xCAB4, // 蚀 U+8680
+    0xB2CF, // 蚕 U+8695
+    0xD1C1, // 蚜 U+869C
+    0xC9DF, // 蛇 U+86C7
+    0xB9C6, // 蛊 U+86CA
+    0xB8F2, // 蛤 U+86E4
+    0xB7E4, // 蜂 U+8702
+    0xCECF, // 蜗 U+8717
+    0xC0AF, // 蜡 U+8721
+    0xD3AC, // 蝇 U+8747
+    0xD0AB, // 蝎 U+874E
+    0xBBC8, // 蝗 U+8757
+    0xBAFB, // 蝴 U+8774
+    0xC2DD, // 螺 U+87BA
+    0xD1AA, // 血 U+8840
+    0xD0D0, // 行 U+884C
+    0xD1C3, // 衙 U+8859
+    0xD2C2, // 衣 U+8863
+    0xB2B9, // 补 U+8865
+    0xB1ED, // 表 U+8868
+    0xCBA5, // 衰 U+8870
+    0xD4AC, // 袁 U+8881
+    0xB0C0, // 袄 U+8884
+    0xB4FC, // 袋 U+888B
+    0xB1BB, // 被 U+88AB
+    0xC1D1, // 裂 U+88C2
+    0xD7B0, // 装 U+88C5
+    0xD2E1, // 裔 U+88D4
+    0xD4A3, // 裕 U+88D5
+    0xBFE3, // 裤 U+88E4
+    0xC5E1, // 裴 U+88F4
+    0xC2E3, // 裸 U+88F8
+    0xCEF7, // 西 U+897F
+    0xD2AA, // 要 U+8981
+    0xB8B2, // 覆 U+8986
+    0xBCFB, // 见 U+89C1
+    0xB9DB, // 观 U+89C2
+    0xB9E6, // 规 U+89C4
+    0xCAD3, // 视 U+89C6
+    0xBEF5, // 觉 U+89C9
+    0xBDC7, // 角 U+89D2
+    0xBDE2, // 解 U+89E3
+    0xB4A5, // 触 U+89E6
+    0xD1D4, // 言 U+8A00
+    0xD5B2, // 詹 U+8A79
+    0xCAC4, // 誓 U+8A93
+    0xBCC6, // 计 U+8BA1
+    0xB6A9, // 订 U+8BA2
+    0xC8CF, // 认 U+8BA4
+    0xCCD6, // 讨 U+8BA8
+    0xC8C3, // 让 U+8BA9
+    0xD1B5, // 训 U+8BAD
+    0xD2E9, // 议 U+8BAE
+    0xBCC7, // 记 U+8BB0
+    0xBDB2, // 讲 U+8BB2
+    0xD0ED, // 许 U+8BB8
+    0xC2DB, // 论 U+8BBA
+    0xC9E8, // 设 U+8BBE
+    0xB7C3, // 访 U+8BBF
+    0xD6A4, // 证 U+8BC1
+    0xC6C0, // 评 U+8BC4
+    0xCAB6, // 识 U+8BC6
+    0xCBDF, // 诉 U+8BC9
+    0xCAD4, // 试 U+8BD5
+    0xB3CF, // 诚 U+8BDA
+    0xD6EF, // 诛 U+8BDB
+    0xBBB0, // 话 U+8BDD
+    0xB9EE, // 诡 U+8BE1
+    0xB8C3, // 该 U+8BE5
+    0xCFEA, // 详 U+8BE6
+    0xCEDC, // 诬 U+8BEC
+    0xD3EF, // 语 U+8BED
+    0xCEF3, // 误 U+8BEF
+    0xCBB5, // 说 U+8BF4
+    0xC7EB, // 请 U+8BF7
+    0xD6EE, // 诸 U+8BF8
+    0xB6C1, // 读 U+8BFB
+    0xB5F7, // 调 U+8C03
+    0xCCB8, // 谈 U+8C08
+    0xD0B3, // 谐 U+8C10
+    0xD0BB, // 谢 U+8C22
+    0xC7AB, // 谦 U+8C26
+    0xBDF7, // 谨 U+8C28
+    0xCCB7, // 谭 U+8C2D
+    0xC6D7, // 谱 U+8C31
+    0xC7B4, // 谴 U+8C34
+    0xB9C8, // 谷 U+8C37
+    0xBBED, // 豁 U+8C41
+    0xCFF3, // 象 U+8C61
+    0xBAC0, // 豪 U+8C6A
+    0xB2F2, // 豺 U+8C7A
+    0xC3B2, // 貌 U+8C8C
+    0xB1B4, // 贝 U+8D1D
+    0xD5EA, // 贞 U+8D1E
+    0xB8BA, // 负 U+8D1F
+    0xB9B1, // 贡 U+8D21
+    0xB2C6, // 财 U+8D22
+    0xD4F0, // 责 U+8D23
+    0xCFCD, // 贤 U+8D24
+    0xBBF5, // 货 U+8D27
+    0xD6CA, // 质 U+8D28
+    0xB7B7, // 贩 U+8D29
+    0xC6B6, // 贫 U+8D2B
+    0xB1E1, // 贬 U+8D2C
+    0xB9BA, // 购 U+8D2D
+    0xB9E1, // 贯 U+8D2F
+    0xB9F3, // 贵 U+8D35
+    0xC3B3, // 贸 U+8D38
+    0xB7D1, // 费 U+8D39
+    0xBAD8, // 贺 U+8D3A
+    0xBCD6, // 贾 U+8D3E
+    0xD7CA, // 资 U+8D44
+    0xB6C4, // 赌 U+8D4C
+    0xD4F9, // 赠 U+8D60
+    0xB8D3, // 赣 U+8D63
+    0xB3E0, // 赤 U+8D64
+    0xC9E2, // 赦 U+8D66
+    0xD7DF, // 走 U+8D70
+    0xB8B0, // 赴 U+8D74
+    0xD5D4, // 赵 U+8D75
+    0xB8CF, // 赶 U+8D76
+    0xC6F0, // 起 U+8D77
+    0xB3AC, // 超 U+8D85
+    0xD4BD, // 越 U+8D8A
+    0xC8A4, // 趣 U+8DA3
+    0xD7E3, // 足 U+8DB3
+    0xD6BA, // 趾 U+8DBE
+    0xD4BE, // 跃 U+8DC3
+    0xB0CF, // 跋 U+8DCB
+    0xC5DC, // 跑 U+8DD1
+    0xBEE0, // 距 U+8DDD
+    0xB8FA, // 跟 U+8DDF
+    0xC2B7, // 路 U+8DEF
+    0xBCF9, // 践 U+8DF5
+    0xB5C5, // 蹬 U+8E6C
+    0xD4EA, // 躁 U+8E81
+    0xC9ED, // 身 U+8EAB
+    0xCCC9, // 躺 U+8EBA
+    0xB3B5, // 车 U+8F66
+    0xB9EC, // 轨 U+8F68
+    0xD0F9, // 轩 U+8F69
+    0xD7AA, // 转 U+8F6C
+    0xC2D6, // 轮 U+8F6E
+    0xC8ED, // 软 U+8F6F
+    0xBAE4, // 轰 U+8F70
+    0xD6E1, // 轴 U+8F74
+    0xC7E1, // 轻 U+8F7B
+    0xD4D8, // 载 U+8F7D
+    0xBDCF, // 较 U+8F83
+    0xB1B2, // 辈 U+8F88
+    0xBBD4, // 辉 U+8F89
+    0xB9F5, // 辊 U+8F8A
+    0xBCAD, // 辑 U+8F91
+    0xCAE4, // 输 U+8F93
+    0xD0C1, // 辛 U+8F9B
+    0xB4C7, // 辞 U+8F9E
+    0xB1D9, // 辟 U+8F9F
+    0xB1E6, // 辨 U+8FA8
+    0xB1E7, // 辩 U+8FA9
+    0xB3BD, // 辰 U+8FB0
+    0xB1DF, // 边 U+8FB9
+    0xC1C9, // 辽 U+8FBD
+    0xB4EF, // 达 U+8FBE
+    0xD3D8, // 迂 U+8FC2
+    0xD1B8, // 迅 U+8FC5
+    0xB9FD, // 过 U+8FC7
+    0xD3AD, // 迎 U+8FCE
+    0xD4CB, // 运 U+8FD0
+    0xBDFC, // 近 U+8FD1
+    0xBBB9, // 还 U+8FD8
+    0xD5E2, // 这 U+8FD9
+    0xBDF8, // 进 U+8FDB
+    0xD4B6, // 远 U+8FDC
+    0xCEA5, // 违 U+8FDD
+    0xC1AC, // 连 U+8FDE
+    0xB5CF, // 迪 U+8FEA
+    0xC6C8, // 迫 U+8FEB
+    0xCAF6, // 述 U+8FF0
+    0xC3D4, // 迷 U+8FF7
+    0xBCA3, // 迹 U+8FF9
+    0xCDCB, // 退 U+9000
+    0xCBCD, // 送 U+9001
+    0xCACA, // 适 U+9002
+    0xC4E6, // 逆 U+9006
+    0xD1A1, // 选 U+9009
+    0xCDB8, // 透 U+900F
+    0xD6F0, // 逐 U+9010
+    0xB5DD, // 递 U+9012
+    0xCDA8, // 通 U+901A
+    0xB9E4, // 逛 U+901B
+    0xCBD9, // 速 U+901F
+    0xD4EC, // 造 U+9020
+    0xB6DD, // 遁 U+9041
+    0xD3F6, // 遇 U+9047
+    0xB1E9, // 遍 U+904D
+    0xB5C0, // 道 U+9053
+    0xD2A3, // 遥 U+9065
+    0xD7F1, // 遵 U+9075
+    0xB1DC, // 避 U+907F
+    0xB5CB, // 邓 U+9093
+    0xD0CF, // 邢 U+90A2
+    0xC4C7, // 那 U+90A3
+    0xB0EE, // 邦 U+90A6
+    0xD3CA, // 邮 U+90AE
+    0xC7F1, // 邱 U+90B1
+    0xC9DB, // 邵 U+90B5
+    0xD7DE, // 邹 U+90B9
+    0xC1DA, // 邻 U+90BB
+    0xD3F4, // 郁 U+90C1
+    0xC0C9, // 郎 U+90CE
+    0xD6A3, // 郑 U+90D1
+    0xBAC2, // 郝 U+90DD
+    0xBFA4, // 郡 U+90E1
+    0xB2BF, // 部 U+90E8
+    0xB9F9, // 郭 U+90ED
+    0xB6BC, // 都 U+90FD
+    0xC7F5, // 酋 U+914B
+    0xC5E4, // 配 U+914D
+    0xBEC6, // 酒 U+9152
+    0xBAA8, // 酣 U+9163
+    0xCBE1, // 酸 U+9178
+    0xC4F0, // 酿 U+917F
+    0xB2C9, // 采 U+91C7
+    0xD3D4, // 釉 U+91C9
+    0xC0EF, // 里 U+91CC
+    0xD6D8, // 重 U+91CD
+    0xC1BF, // 量 U+91CF
+    0xBDF0, // 金 U+91D1
+    0xBCF8, // 鉴 U+9274
+    0xD5EB, // 针 U+9488
+    0xB6A4, // 钉 U+9489
+    0xC7A5, // 钎 U+948E
+    0xD6D3, // 钟 U+949F
+    0xB1B5, // 钡 U+94A1
+    0xB8D6, // 钢 U+94A2
+    0xC7D5, // 钦 U+94A6
+    0xBEFB, // 钧 U+94A7
+    0xCED9, // 钨 U+94A8
+    0xC5A5, // 钮 U+94AE
+    0xC7AE, // 钱 U+94B1
+    0xD7EA, // 钻 U+94BB
+    0xCCFA, // 铁 U+94C1
+    0xCDAD, // 铜 U+94DC
+    0xCFB3, // 铣 U+94E3
+    0xC3FA, // 铭 U+94ED
+    0xD2F8, // 银 U+94F6
+    0xCBF8, // 锁 U+9501
+    0xD0E2, // 锈 U+9508
+    0xB7E6, // 锋 U+950B
+    0xD0BF, // 锌 U+950C
+    0xC8F1, // 锐 U+9510
+    0xD5E0, // 锗 U+9517
+    0xB4ED, // 错 U+9519
+    0xCEFD, // 锡 U+9521
+    0xBDF5, // 锦 U+9526
+    0xB6A7, // 锭 U+952D
+    0xB6CD, // 锻 U+953B
+    0xD5F2, // 镇 U+9547
+    0xBEB5, // 镜 U+955C
+    0xC0D8, // 镭 U+956D
+    0xCFE2, // 镶 U+9576
+    0xB3A4, // 长 U+957F
+    0xC3C5, // 门 U+95E8
+    0xC9C1, // 闪 U+95EA
+    0xCECA, // 问 U+95EE
+    0xB4B3, // 闯 U+95EF
+    0xC8F2, // 闰 U+95F0
+    0xCFD0, // 闲 U+95F2
+    0xBCE4, // 间 U+95F4
+    0xD5A2, // 闸 U+95F8
+    0xC4D6, // 闹 U+95F9
+    0xCEC5, // 闻 U+95FB
+    0xC3F6, // 闽 U+95FD
+    0xB7A7, // 阀 U+9600
+    0xD1D6, // 阎 U+960E
+    0xB8B7, // 阜 U+961C
+    0xB6D3, // 队 U+961F
+    0xC8EE, // 阮 U+962E
+    0xB7C0, // 防 U+9632
+    0xD1F4, // 阳 U+9633
+    0xD2F5, // 阴 U+9634
+    0xD5F3, // 阵 U+9635
+    0xBDD7, // 阶 U+9636
+    0xB0A2, // 阿 U+963F
+    0xB8BD, // 附 U+9644
+    0xBCCA, // 际 U+9645
+    0xC2BD, // 陆 U+9646
+    0xB3C2, // 陈 U+9648
+    0xBDB5, // 降 U+964D
+    0xCFDE, // 限 U+9650
+    0xB1DD, // 陛 U+965B
+    0xD4BA, // 院 U+9662
+    0xB3FD, // 除 U+9664
+    0xC5E3, // 陪 U+966A
+    0xC1EA, // 陵 U+9675
+    0xCCD5, // 陶 U+9676
+    0xCBE5, // 隋 U+968B
+    0xB0AF, // 隘 U+9698
+    0xCFB6, // 隙 U+9699
+    0xC1A5, // 隶 U+96B6
+    0xC4D1, // 难 U+96BE
+    0xC8B8, // 雀 U+96C0
+    0xD1E3, // 雁 U+96C1
+    0xD0DB, // 雄 U+96C4
+    0xD1C5, // 雅 U+96C5
+    0xBCAF, // 集 U+96C6
+    0xD3BA, // 雍 U+96CD
+    0xD3EA, // 雨 U+96E8
+    0xD1A9, // 雪 U+96EA
+    0xC1E3, // 零 U+96F6
+    0xC0D7, // 雷 U+96F7
+    0xD0E8, // 需 U+9700
+    0xD5F0, // 震 U+9707
+    0xBBF4, // 霍 U+970D
+    0xC4DE, // 霓 U+9713
+    0xCBAA, // 霜 U+971C
+    0xCFBC, // 霞 U+971E
+    0xC2B6, // 露 U+9732
+    0xB0D4, // 霸 U+9738
+    0xC7E0, // 青 U+9752
+    0xBEB8, // 靖 U+9756
+    0xBEB2, // 静 U+9759
+    0xB5E5, // 靛 U+975B
+    0xB7C7, // 非 U+975E
+    0xBFBF, // 靠 U+9760
+    0xC3D2, // 靡 U+9761
+    0xC3E6, // 面 U+9762
+    0xB8EF, // 革 U+9769
+    0xBDF9, // 靳 U+9773
+    0xB0B0, // 鞍 U+978D
+    0xBECF, // 鞠 U+97A0
+    0xCEA4, // 韦 U+97E6
+    0xBAAB, // 韩 U+97E9
+    0xBEC2, // 韭 U+97ED
+    0xD2B3, // 页 U+9875
+    0xB6A5, // 顶 U+9876
+    0xC7EA, // 顷 U+9877
+    0xCFEE, // 项 U+9879
+    0xCBB3, // 顺 U+987A
+    0xD0EB, // 须 U+987B
+    0xB9CB, // 顾 U+987E
+    0xD4A4, // 预 U+9884
+    0xBEB1, // 颈 U+9888
+    0xD3B1, // 颖 U+9896
+    0xCCE2, // 题 U+9898
+    0xD1D5, // 颜 U+989C
+    0xB7E7, // 风 U+98CE
+    0xC6AE, // 飘 U+98D8
+    0xB7C9, // 飞 U+98DE
+    0xCAB3, // 食 U+98DF
+    0xB2CD, // 餐 U+9910
+    0xBCA2, // 饥 U+9965
+    0xD2FB, // 饮 U+996E
+    0xB1FD, // 饼 U+997C
+    0xCAD7, // 首 U+9996
+    0xCFE3, // 香 U+9999
+    0xC2ED, // 马 U+9A6C
+    0xD1B1, // 驯 U+9A6F
+    0xB3DB, // 驰 U+9A70
+    0xD7A4, // 驻 U+9A7B
+    0xCDD5, // 驼 U+9A7C
+    0xC2E6, // 骆 U+9A86
+    0xBAA7, // 骇 U+9A87
+    0xD1E9, // 验 U+9A8C
+    0xBFA5, // 骏 U+9A8F
+    0xC9A7, // 骚 U+9A9A
+    0xD6E8, // 骤 U+9AA4
+    0xB9C7, // 骨 U+9AA8
+    0xB8DF, // 高 U+9AD8
+    0xBFFD, // 魁 U+9B41
+    0xCEBA, // 魏 U+9B4F
+    0xC2B3, // 鲁 U+9C81
+    0xB1AB, // 鲍 U+9C8D
+    0xCFCA, // 鲜 U+9C9C
+    0xC4F1, // 鸟 U+9E1F
+    0xC3F9, // 鸣 U+9E23
+    0xD1BC, // 鸭 U+9E2D
+    0xBAE8, // 鸿 U+9E3F
+    0xC5F4, // 鹏 U+9E4F
+    0xBAD7, // 鹤 U+9E64
+    0xC2F3, // 麦 U+9EA6
+    0xBBC6, // 黄 U+9EC4
+    0xC0E8, // 黎 U+9ECE
+    0xBADA, // 黑 U+9ED1
+    0xC4AC, // 默 U+9ED8
+    0xB6A6, // 鼎 U+9F0E
+    0xB9C4, // 鼓 U+9F13
+    0xCAF3, // 鼠 U+9F20
+    0xB1C7, // 鼻 U+9F3B
+    0xC6EB, // 齐 U+9F50
+    0xB3DD, // 齿 U+9F7F
+    0xC1E4, // 龄 U+9F84
+    0xC1FA, // 龙 U+9F99
+    0xB9A8, // 龚 U+9F9A
 };
 
-// Binary search implementation for Unicode to GB2312 conversion
+// Convert Unicode code point to GB2312 encoding
+// Returns INVALID_GB2312 if the character is not found
 uint16_t unicode_to_gb2312(uint16_t unicode) {
-    int left = 0;
-    int right = MAP_TABLE_SIZE - 1;
-    
-    while (left <= right) {
-        int mid = (left + right) / 2;
-        
-        if (map_table[mid].unicode == unicode) {
-            return map_table[mid].gb2312;
-        }
-        
-        if (map_table[mid].unicode < unicode) {
-            left = mid + 1;
-        } else {
-            right = mid - 1;
-        }
+    uint8_t page = page_index[unicode >> 8];
+    if (page == 0xFF) {
+        return INVALID_GB2312;
+    }
+
+    uint32_t block = page * 8 + ((unicode >> 5) & 7);
+    uint32_t bit = 1u << (unicode & 31);
+    uint32_t bits = block_bits[block];
+    if (!(bits & bit)) {
+        return INVALID_GB2312;  // Character not found
     }
-    
-    return INVALID_GB2312;  // Character not found
+
+    return gb2312_codes[block_base[block] + __builtin_popcount(bits & (bit - 1))];
 }
@@ -1,3789 +1,3970 @@
 // Auto-generated code mapping table for Unicode to GB2312 conversion
 // Source file: hz3500.txt
+// Generated by gb2312_encode_gen.py, do not edit
 #include <stdint.h>
 #include "gb2312_encode.h"
 
+#define MAP_TABLE_SIZE 3752
+#define MAP_PAGE_COUNT 80
 
-typedef struct {
-    uint16_t unicode;  // Unicode code point
-    uint16_t gb2312;   // GB2312 encoding
-} code_map_t;
+// Unicode高字节 -> 页号，0xFF表示该页没有字符
+static const uint8_t page_index[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11,
+    0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21,
+    0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31,
+    0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41,
+    0x42, 0x43, 0x44, 0xFF, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0xFF, 0x4E, 0x4F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+// 每页8块，每块32个码点的位图
+static const uint32_t block_bits[MAP_PAGE_COUNT * 8] = {
+    0x3F5A6F8B, 0x6F152CB4, 0xE35DFB28, 0x400B0043, 0x0C36DB40, 0x84047BF6, 0x83FA6CE3, 0xA8C51438, // U+4Exx
+    0xC783E402, 0x15518451, 0x1A2BE048, 0x80099209, 0x28802910, 0x8020C3E9, 0x61818418, 0x0402E202, // U+4Fxx
+    0x87142000, 0x54000442, 0x14008080, 0x80C00020, 0x00002021, 0x08041108, 0x04008000, 0x08280080, // U+50xx
+    0x00040000, 0x80000002, 0x14122B7A, 0x3BFB3924, 0x1AA43321, 0x08ED9011, 0x28029A51, 0xAF49A013, // U+51xx
+    0x2F8604CB, 0x2FC14B11, 0x0053240E, 0x800486A0, 0xE8000100, 0x800E0F0B, 0x81040A88, 0xC4000010, // U+52xx
+    0x22C00161, 0x8E00040B, 0x54EEC78A, 0x81BB8897, 0x85201A74, 0x88000344, 0x0BD23F06, 0x13CDFC79, // U+53xx
+    0xE8ABF71A, 0x5B32FBC1, 0x19210541, 0x39280104, 0x0265D841, 0x210A9100, 0x808263D3, 0x14046760, // U+54xx
+    0x000102C2, 0x4002D010, 0x00000458, 0x11004472, 0x31000695, 0x08880080, 0x10080020, 0x2000000A, // U+55xx
+    0x09004200, 0x88560000, 0x00004000, 0x00401500, 0x0000C000, 0x10800008, 0x4C000400, 0x64132015, // U+56xx
+    0x80000148, 0x44092108, 0xEC83E481, 0x00808453, 0x0804081C, 0x0000484C, 0x8010480C, 0x06000001, // U+57xx
+    0x00220044, 0x00210412, 0x41121000, 0x00000800, 0xC20C0028, 0x00000300, 0x00200002, 0x02495810, // U+58xx
+    0x9460A090, 0x0792CE80, 0x00D2CB90, 0x23580025, 0x024C05D4, 0x0A004120, 0x141B0840, 0x88001120, // U+59xx
+    0x9100009A, 0x00420221, 0x04000240, 0x80500400, 0x04040000, 0x00080000, 0x00001206, 0x00000202, // U+5Axx
+    0x00000000, 0x00000000, 0xB3B10000, 0x24210658, 0x7F809BAA, 0xE2790C5F, 0xE00D10F4, 0x9F000122, // U+5Bxx
+    0x25528652, 0xF7020090, 0x4022CF27, 0x82028023, 0x08900006, 0x81082200, 0x02000000, 0x08012542, // U+5Cxx
+    0x00504080, 0x00002200, 0x00001000, 0x00000000, 0x00000000, 0x00000000, 0x60002000, 0x409E4BE6, // U+5Dxx
+    0x3D61116E, 0x210060C0, 0x00201024, 0xB95C0004, 0xD6B984D0, 0x01C020C0, 0x00480600, 0x04C00000, // U+5Exx
+    0x89A8841D, 0x060280E1, 0x202C0000, 0x1A033654, 0x01850D33, 0x20804402, 0x03803068, 0xA8220881, // U+5Fxx
+    0x30744007, 0x080085A1, 0x00252808, 0x9048BB14, 0x80102210, 0x11049149, 0x90220C20, 0x0649EBC1, // U+60xx
+    0x84008302, 0x80000090, 0x00225100, 0x00810184, 0x00004800, 0x40000100, 0x00040504, 0x00000040, // U+61xx
+    0x0547F500, 0x80984400, 0x091E6883, 0xD249FAC8, 0x0DEE0611, 0xB2221937, 0x9B5D73F4, 0xF09AB3EC, // U+62xx
+    0xEC424286, 0x20008D3B, 0xC021F264, 0x08C0408E, 0x01459385, 0x058807AD, 0x0045A200, 0x2010260A, // U+63xx
+    0x50198027, 0x24003400, 0x011005D0, 0x03000280, 0x402600A4, 0x10217210, 0x40046024, 0x00000040, // U+64xx
+    0x01040001, 0xCA408800, 0x6A429120, 0x0095104C, 0x92821880, 0x2201A2B2, 0x00808822, 0x04C233E5, // U+65xx
+    0x8018D044, 0x5000A1A1, 0x042C1808, 0x4451C150, 0x00C20084, 0x00104000, 0x22000000, 0xD21D0000, // U+66xx
+    0xA8902B01, 0x2432BD00, 0x9043C24D, 0xC001A123, 0x34A10212, 0x00C08C0C, 0x501F8010, 0x801A9021, // U+67xx
+    0x00CA89A0, 0x33800402, 0x001B116C, 0x00400328, 0x00800062, 0x0009A1C4, 0x05242A01, 0x04224001, // U+68xx
+    0x00046020, 0xA0012000, 0x44100000, 0x10800000, 0x10100044, 0x00900100, 0x08010000, 0x20000000, // U+69xx
+    0x80000400, 0x00020402, 0x02000080, 0x00020002, 0x00000011, 0x00001000, 0x00000000, 0x00000000, // U+6Axx
+    0x00000000, 0x4404008F, 0x00001280, 0x1A0004FC, 0x00400E48, 0x80B00000, 0x0AF4A822, 0x00008802, // U+6Bxx
+    0x885A8000, 0x0111C1C4, 0xE8A10287, 0x62050413, 0x8A00830E, 0xFB084CF2, 0x48201630, 0x3829052E, // U+6Cxx
+    0x48840802, 0x78060420, 0x060A4CE2, 0x01904640, 0xA8205324, 0x012487DA, 0x01421851, 0x0A8A5812, // U+6Dxx
+    0x20912420, 0x0510A21B, 0x09402008, 0xC0000000, 0x10010228, 0x04408404, 0x441A0882, 0x00100372, // U+6Exx
+    0x00188044, 0x400A0801, 0x51002000, 0x00006040, 0x10004110, 0x00080002, 0x00040001, 0x00000000, // U+6Fxx
+    0x00020000, 0x00000000, 0x00001000, 0xD161A800, 0x02344600, 0x3308F000, 0x8B00010E, 0x2280BAD0, // U+70xx
+    0x06200600, 0x00410040, 0x40005000, 0x20004090, 0x82108410, 0x00001000, 0x00204008, 0x00000020, // U+71xx
+    0x00000040, 0x23E21400, 0x8A001180, 0x06240286, 0x00000403, 0x02409000, 0x42810114, 0x11037003, // U+72xx
+    0x18404000, 0xC0104E00, 0x00000000, 0x00002000, 0x08400A90, 0x08058A00, 0x00012400, 0x00002001, // U+73xx
+    0x00010268, 0x10780004, 0xC4000000, 0x00410000, 0x00000008, 0x00000000, 0x10000000, 0x00C0405C, // U+74xx
+    0x95000010, 0x09AF2B20, 0x12109020, 0x01100460, 0x86828040, 0x7224C832, 0x493407A0, 0x02110404, // U+75xx
+    0x80000002, 0x01100E50, 0x00001000, 0x69000008, 0x004208D4, 0x80024000, 0x89D7C564, 0x5114C000, // U+76xx
+    0x80000A02, 0x14C08301, 0x08000003, 0x0200184A, 0x00044030, 0x080816A0, 0x08800000, 0xE0086A2C, // U+77xx
+    0x04543006, 0x41910080, 0x20240021, 0x10005800, 0x81827200, 0x401B0080, 0x00210C22, 0x04800100, // U+78xx
+    0x00000002, 0x54000000, 0xE0400102, 0x01802120, 0x00008012, 0x6A000000, 0x81062A4B, 0x290182D0, // U+79xx
+    0x04806801, 0xB8080001, 0x00800040, 0x84D00000, 0xB1C6201A, 0x80000020, 0xC2400800, 0x8200A029, // U+7Axx
+    0x08120840, 0x14001140, 0x08578A00, 0x42800000, 0x00B02001, 0x00022202, 0x020800C0, 0x00824002, // U+7Bxx
+    0x00000080, 0x80000080, 0x00002000, 0x28080000, 0x81A40200, 0x420A4430, 0x92600400, 0x08008001, // U+7Cxx
+    0x00000400, 0x00008885, 0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, // U+7Dxx
+    0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00000004, 0xA7EE9CD5, 0xF72EE5F8, 0xB1B926EC, // U+7Exx
+    0x25784271, 0x05104301, 0x04A30000, 0x00044604, 0x44105400, 0x22000012, 0x81101022, 0x18030001, // U+7Fxx
+    0x03A1302B, 0xA9480400, 0x05101C04, 0x00000400, 0x2D401AD8, 0xC404C637, 0x5440504B, 0x25498002, // U+80xx
+    0x044B8644, 0x41028000, 0x00330C40, 0xCE014020, 0x39008401, 0x00080100, 0x0000004D, 0x18182408, // U+81xx
+    0xD0143061, 0x02E31400, 0x01000080, 0x440D8000, 0x30042804, 0x220AB060, 0xC892A080, 0x02028860, // U+82xx
+    0x0000403E, 0x03601980, 0x04150240, 0x0080889A, 0x00004240, 0x22860800, 0x10009480, 0x00060201, // U+83xx
+    0x20007010, 0x200001B0, 0x08800000, 0x0022180A, 0x12000804, 0x01040000, 0xA0420210, 0x00001000, // U+84xx
+    0x048A0000, 0x30801802, 0x00000600, 0x40100000, 0x08000010, 0x00008400, 0x00218200, 0x08000210, // U+85xx
+    0x00020000, 0x01000000, 0x4403C000, 0x62020800, 0x10201407, 0x00000010, 0x0A100CC1, 0x42014010, // U+86xx
+    0x11A40005, 0x00000002, 0x00804280, 0x00500000, 0x80002000, 0x04000000, 0x00000000, 0x02000000, // U+87xx
+    0x00200000, 0x00000004, 0x02903021, 0x0081192A, 0x10442812, 0x00022800, 0x02300026, 0x03180010, // U+88xx
+    0x00050004, 0x00000420, 0x80000010, 0x80000000, 0x00000042, 0x00000000, 0x00040376, 0x00000048, // U+89xx
+    0x00000001, 0x00000000, 0x00000000, 0x02000000, 0x00080600, 0x00000000, 0x00000000, 0x00000000, // U+8Axx
+    0x00000000, 0x00000000, 0x00000000, 0x00001040, 0x00000000, 0xF74DEB3E, 0x6CA23773, 0x6DB6B8EE, // U+8Bxx
+    0x14896D6A, 0x0093335C, 0x00001042, 0x06000C06, 0x00001200, 0x00000000, 0x00000000, 0x00000000, // U+8Cxx
+    0xE0000000, 0xD7B3FFFE, 0x4D51DC1E, 0x00F1085F, 0x80000C22, 0x40180008, 0xA0021808, 0x04288500, // U+8Dxx
+    0x40009400, 0x00000604, 0x00000910, 0x80043040, 0x00000082, 0x04049800, 0x00000000, 0x00000000, // U+8Exx
+    0x00000000, 0x00000000, 0x00000000, 0xA811D3C0, 0xDAEB0768, 0x62030B08, 0xFB1341B6, 0x23812C04, // U+8Fxx
+    0xEC95864F, 0x59004005, 0x0088A086, 0x80206028, 0x000A0001, 0x0A22C44C, 0x20024402, 0x21102182, // U+90xx
+    0x02000004, 0x00000000, 0x64843A00, 0x81E25428, 0x0C040A80, 0x00000000, 0x1002F680, 0x00000000, // U+91xx
+    0x00000000, 0x00000000, 0x00000000, 0x00100000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, // U+92xx
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xE20C4300, 0x482A43E7, 0x3000006F, 0x4547300A, // U+94xx
+    0x06831933, 0x0A01E17A, 0x10032483, 0x80412008, 0x00000000, 0x00000000, 0x00000000, 0x2F95E500, // U+95xx
+    0x90134227, 0x887C4000, 0x082139F1, 0x00E00716, 0x13118860, 0x40400080, 0x0020B0F3, 0x42C00500, // U+96xx
+    0x50482291, 0x03040000, 0x4A440000, 0x00580207, 0x01002800, 0x00002001, 0x00000000, 0x006822C0, // U+97xx
+    0x00000000, 0x00000000, 0x00000000, 0xEEE00000, 0x31CB05F6, 0x00000091, 0xC1004000, 0x00000000, // U+98xx
+    0x00010000, 0x00000000, 0x00000000, 0x9467E020, 0x02448962, 0x00000000, 0x00000000, 0x00000000, // U+99xx
+    0x00000000, 0x00000000, 0x00000000, 0x5A5BF000, 0x048298D4, 0x01000112, 0x01080000, 0x00000000, // U+9Axx
+    0x00000008, 0x10000000, 0x00108016, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, // U+9Bxx
+    0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x10002002, 0x01000010, 0x40400008, 0x00000000, // U+9Cxx
+    0x80000000, 0xA028A06A, 0x00008428, 0x80010010, 0x00080000, 0x08000040, 0x01126010, 0x00000000, // U+9Exx
+    0x00084000, 0x08000001, 0x00010000, 0x80000000, 0x86000810, 0x00000000, 0x00000000, 0x00000000, // U+9Fxx
+};
+
+// 每块第一个字符在 gb2312_codes 中的序号
+static const uint16_t block_base[MAP_PAGE_COUNT * 8] = {
+    0, 20, 36, 55, 62, 75, 90, 108, // U+4Exx
+    120, 133, 144, 156, 164, 171, 182, 191, // U+4Fxx
+    198, 205, 211, 215, 219, 222, 227, 229, // U+50xx
+    233, 234, 236, 249, 267, 279, 290, 300, // U+51xx
+    314, 328, 342, 351, 358, 363, 374, 381, // U+52xx
+    385, 393, 401, 418, 433, 444, 450, 465, // U+53xx
+    484, 503, 521, 530, 538, 549, 556, 568, // U+54xx
+    578, 583, 589, 593, 601, 610, 614, 617, // U+55xx
+    620, 624, 630, 631, 635, 637, 640, 644, // U+56xx
+    654, 658, 665, 679, 686, 692, 697, 703, // U+57xx
+    706, 710, 715, 720, 721, 728, 730, 732, // U+58xx
+    740, 749, 761, 772, 781, 791, 796, 804, // U+59xx
+    809, 816, 821, 824, 828, 830, 831, 835, // U+5Axx
+    837, 837, 837, 846, 855, 872, 889, 901, // U+5Bxx
+    910, 922, 932, 945, 952, 957, 962, 963, // U+5Cxx
+    970, 974, 976, 977, 977, 977, 977, 980, // U+5Dxx
+    995, 1010, 1016, 1020, 1030, 1045, 1051, 1055, // U+5Exx
+    1058, 1070, 1078, 1082, 1094, 1105, 1110, 1118, // U+5Fxx
+    1126, 1136, 1143, 1149, 1161, 1166, 1175, 1182, // U+60xx
+    1196, 1202, 1205, 1210, 1215, 1217, 1219, 1223, // U+61xx
+    1224, 1236, 1242, 1254, 1270, 1283, 1297, 1317, // U+62xx
+    1335, 1347, 1357, 1369, 1377, 1388, 1400, 1406, // U+63xx
+    1413, 1423, 1428, 1435, 1439, 1446, 1454, 1460, // U+64xx
+    1461, 1464, 1471, 1481, 1489, 1497, 1507, 1512, // U+65xx
+    1525, 1533, 1541, 1548, 1558, 1563, 1565, 1567, // U+66xx
+    1575, 1585, 1596, 1608, 1617, 1626, 1633, 1642, // U+67xx
+    1650, 1659, 1666, 1676, 1681, 1685, 1693, 1701, // U+68xx
+    1706, 1710, 1714, 1717, 1719, 1723, 1726, 1728, // U+69xx
+    1729, 1731, 1734, 1736, 1738, 1740, 1741, 1741, // U+6Axx
+    1741, 1741, 1749, 1752, 1762, 1768, 1772, 1784, // U+6Bxx
+    1787, 1794, 1803, 1815, 1824, 1833, 1849, 1857, // U+6Cxx
+    1869, 1875, 1883, 1894, 1901, 1911, 1923, 1931, // U+6Dxx
+    1941, 1948, 1958, 1963, 1965, 1970, 1975, 1983, // U+6Exx
+    1990, 1995, 2000, 2004, 2007, 2011, 2013, 2015, // U+6Fxx
+    2015, 2016, 2016, 2017, 2027, 2034, 2043, 2051, // U+70xx
+    2062, 2067, 2070, 2073, 2077, 2083, 2084, 2087, // U+71xx
+    2088, 2089, 2098, 2104, 2112, 2115, 2119, 2126, // U+72xx
+    2135, 2139, 2146, 2146, 2147, 2153, 2159, 2162, // U+73xx
+    2164, 2169, 2175, 2178, 2180, 2181, 2181, 2182, // U+74xx
+    2189, 2194, 2207, 2213, 2218, 2225, 2237, 2248, // U+75xx
+    2253, 2255, 2262, 2263, 2268, 2275, 2278, 2294, // U+76xx
+    2301, 2305, 2313, 2316, 2322, 2326, 2333, 2335, // U+77xx
+    2346, 2354, 2360, 2365, 2369, 2377, 2383, 2389, // U+78xx
+    2392, 2393, 2396, 2402, 2407, 2410, 2414, 2425, // U+79xx
+    2434, 2440, 2446, 2448, 2453, 2465, 2467, 2472, // U+7Axx
+    2479, 2484, 2489, 2498, 2501, 2506, 2510, 2514, // U+7Bxx
+    2518, 2519, 2521, 2522, 2525, 2531, 2539, 2545, // U+7Cxx
+    2548, 2549, 2554, 2554, 2555, 2555, 2555, 2555, // U+7Dxx
+    2555, 2555, 2555, 2556, 2556, 2557, 2577, 2598, // U+7Exx
+    2615, 2628, 2635, 2640, 2645, 2651, 2655, 2661, // U+7Fxx
+    2666, 2677, 2684, 2691, 2692, 2704, 2717, 2727, // U+80xx
+    2735, 2745, 2749, 2756, 2764, 2771, 2773, 2777, // U+81xx
+    2784, 2794, 2802, 2804, 2810, 2816, 2825, 2834, // U+82xx
+    2840, 2846, 2854, 2860, 2867, 2870, 2876, 2881, // U+83xx
+    2885, 2890, 2895, 2897, 2903, 2907, 2909, 2915, // U+84xx
+    2916, 2920, 2926, 2928, 2930, 2932, 2934, 2938, // U+85xx
+    2941, 2942, 2943, 2949, 2954, 2961, 2962, 2970, // U+86xx
+    2975, 2982, 2983, 2987, 2989, 2991, 2992, 2992, // U+87xx
+    2993, 2994, 2995, 3002, 3010, 3017, 3020, 3026, // U+88xx
+    3031, 3034, 3036, 3038, 3039, 3041, 3041, 3049, // U+89xx
+    3051, 3052, 3052, 3052, 3053, 3056, 3056, 3056, // U+8Axx
+    3056, 3056, 3056, 3056, 3058, 3058, 3080, 3097, // U+8Bxx
+    3117, 3131, 3143, 3146, 3152, 3154, 3154, 3154, // U+8Cxx
+    3154, 3157, 3183, 3199, 3211, 3216, 3220, 3226, // U+8Dxx
+    3232, 3236, 3239, 3242, 3247, 3249, 3254, 3254, // U+8Exx
+    3254, 3254, 3254, 3254, 3266, 3283, 3292, 3309, // U+8Fxx
+    3318, 3335, 3342, 3349, 3355, 3358, 3368, 3373, // U+90xx
+    3380, 3382, 3382, 3391, 3402, 3408, 3408, 3417, // U+91xx
+    3417, 3417, 3417, 3417, 3418, 3418, 3418, 3418, // U+92xx
+    3418, 3418, 3418, 3418, 3418, 3427, 3441, 3449, // U+94xx
+    3460, 3472, 3484, 3492, 3497, 3497, 3497, 3497, // U+95xx
+    3511, 3522, 3530, 3542, 3551, 3560, 3563, 3573, // U+96xx
+    3579, 3588, 3591, 3596, 3603, 3606, 3608, 3608, // U+97xx
+    3615, 3615, 3615, 3615, 3624, 3640, 3643, 3647, // U+98xx
+    3647, 3648, 3648, 3648, 3660, 3669, 3669, 3669, // U+99xx
+    3669, 3669, 3669, 3669, 3682, 3692, 3696, 3698, // U+9Axx
+    3698, 3699, 3700, 3705, 3705, 3705, 3705, 3705, // U+9Bxx
+    3705, 3705, 3705, 3705, 3706, 3709, 3711, 3714, // U+9Cxx
+    3714, 3715, 3725, 3729, 3732, 3733, 3735, 3741, // U+9Exx
+    3741, 3743, 3745, 3746, 3747, 3752, 3752, 3752, // U+9Fxx
+};
 
-static const code_map_t map_table[] = {
-    {0x4E00, 0xD2BB}, // 一
-    {0x4E01, 0xB6A1}, // 丁
-    {0x4E03, 0xC6DF}, // 七
-    {0x4E07, 0xCDF2}, // 万
-    {0x4E08, 0xD5C9}, // 丈
-    {0x4E09, 0xC8FD}, // 三
-    {0x4E0A, 0xC9CF}, // 上
-    {0x4E0B, 0xCFC2}, // 下
-    {0x4E0D, 0xB2BB}, // 不
-    {0x4E0E, 0xD3EB}, // 与
-    {0x4E11, 0xB3F3}, // 丑
-    {0x4E13, 0xD7A8}, // 专
-    {0x4E14, 0xC7D2}, // 且
-    {0x4E16, 0xCAC0}, // 世
-    {0x4E18, 0xC7F0}, // 丘
-    {0x4E19, 0xB1FB}, // 丙
-    {0x4E1A, 0xD2B5}, // 业
-    {0x4E1B, 0xB4D4}, // 丛
-    {0x4E1C, 0xB6AB}, // 东
-    {0x4E1D, 0xCBBF}, // 丝
-    {0x4E22, 0xB6AA}, // 丢
-    {0x4E24, 0xC1BD}, // 两
-    {0x4E25, 0xD1CF}, // 严
-    {0x4E27, 0xC9A5}, // 丧
-    {0x4E2A, 0xB8F6}, // 个
-    {0x4E2B, 0xD1BE}, // 丫
-    {0x4E2D, 0xD6D0}, // 中
-    {0x4E30, 0xB7E1}, // 丰
-    {0x4E32, 0xB4AE}, // 串
-    {0x4E34, 0xC1D9}, // 临
-    {0x4E38, 0xCDE8}, // 丸
-    {0x4E39, 0xB5A4}, // 丹
-    {0x4E3A, 0xCEAA}, // 为
-    {0x4E3B, 0xD6F7}, // 主
-    {0x4E3D, 0xC0F6}, // 丽
-    {0x4E3E, 0xBED9}, // 举
-    {0x4E43, 0xC4CB}, // 乃
-    {0x4E45, 0xBEC3}, // 久
-    {0x4E48, 0xC3B4}, // 么
-    {0x4E49, 0xD2E5}, // 义
-    {0x4E4B, 0xD6AE}, // 之
-    {0x4E4C, 0xCEDA}, // 乌
-    {0x4E4D, 0xD5A7}, // 乍
-    {0x4E4E, 0xBAF5}, // 乎
-    {0x4E4F, 0xB7A6}, // 乏
-    {0x4E50, 0xC0D6}, // 乐
-    {0x4E52, 0xC6B9}, // 乒
-    {0x4E53, 0xC5D2}, // 乓
-    {0x4E54, 0xC7C7}, // 乔
-    {0x4E56, 0xB9D4}, // 乖
-    {0x4E58, 0xB3CB}, // 乘
-    {0x4E59, 0xD2D2}, // 乙
-    {0x4E5D, 0xBEC5}, // 九
-    {0x4E5E, 0xC6F2}, // 乞
-    {0x4E5F, 0xD2B2}, // 也
-    {0x4E60, 0xCFB0}, // 习
-    {0x4E61, 0xCFE7}, // 乡
-    {0x4E66, 0xCAE9}, // 书
-    {0x4E70, 0xC2F2}, // 买
-    {0x4E71, 0xC2D2}, // 乱
-    {0x4E73, 0xC8E9}, // 乳
-    {0x4E7E, 0xC7AC}, // 乾
-    {0x4E86, 0xC1CB}, // 了
-    {0x4E88, 0xD3E8}, // 予
-    {0x4E89, 0xD5F9}, // 争
-    {0x4E8B, 0xCAC2}, // 事
-    {0x4E8C, 0xB6FE}, // 二
-    {0x4E8E, 0xD3DA}, // 于
-    {0x4E8F, 0xBFF7}, // 亏
-    {0x4E91, 0xD4C6}, // 云
-    {0x4E92, 0xBBA5}, // 互
-    {0x4E94, 0xCEE5}, // 五
-    {0x4E95, 0xBEAE}, // 井
-    {0x4E9A, 0xD1C7}, // 亚
-    {0x4E9B, 0xD0A9}, // 些
-    {0x4EA1, 0xCDF6}, // 亡
-    {0x4EA2, 0xBFBA}, // 亢
-    {0x4EA4, 0xBDBB}, // 交
-    {0x4EA5, 0xBAA5}, // 亥
-    {0x4EA6, 0xD2E0}, // 亦
-    {0x4EA7, 0xB2FA}, // 产
-    {0x4EA8, 0xBAE0}, // 亨
-    {0x4EA9, 0xC4B6}, // 亩
-    {0x4EAB, 0xCFED}, // 享
-    {0x4EAC, 0xBEA9}, // 京
-    {0x4EAD, 0xCDA4}, // 亭
-    {0x4EAE, 0xC1C1}, // 亮
-    {0x4EB2, 0xC7D7}, // 亲
-    {0x4EBA, 0xC8CB}, // 人
-    {0x4EBF, 0xD2DA}, // 亿
-    {0x4EC0, 0xCAB2}, // 什
-    {0x4EC1, 0xC8CA}, // 仁
-    {0x4EC5, 0xBDF6}, // 仅
-    {0x4EC6, 0xC6CD}, // 仆
-    {0x4EC7, 0xB3F0}, // 仇
-    {0x4ECA, 0xBDF1}, // 今
-    {0x4ECB, 0xBDE9}, // 介
-    {0x4ECD, 0xC8D4}, // 仍
-    {0x4ECE, 0xB4D3}, // 从
-    {0x4ED1, 0xC2D8}, // 仑
-    {0x4ED3, 0xB2D6}, // 仓
-    {0x4ED4, 0xD7D0}, // 仔
-    {0x4ED5, 0xCACB}, // 仕
-    {0x4ED6, 0xCBFB}, // 他
-    {0x4ED7, 0xD5CC}, // 仗
-    {0x4ED8, 0xB8B6}, // 付
-    {0x4ED9, 0xCFC9}, // 仙
-    {0x4EDF, 0xC7AA}, // 仟
-    {0x4EE3, 0xB4FA}, // 代
-    {0x4EE4, 0xC1EE}, // 令
-    {0x4EE5, 0xD2D4}, // 以
-    {0x4EEA, 0xD2C7}, // 仪
-    {0x4EEC, 0xC3C7}, // 们
-    {0x4EF0, 0xD1F6}, // 仰
-    {0x4EF2, 0xD6D9}, // 仲
-    {0x4EF6, 0xBCFE}, // 件
-    {0x4EF7, 0xBCDB}, // 价
-    {0x4EFB, 0xC8CE}, // 任
-    {0x4EFD, 0xB7DD}, // 份
-    {0x4EFF, 0xB7C2}, // 仿
-    {0x4F01, 0xC6F3}, // 企
-    {0x4F0A, 0xD2C1}, // 伊
-    {0x4F0D, 0xCEE9}, // 伍
-    {0x4F0E, 0xBCBF}, // 伎
-    {0x4F0F, 0xB7FC}, // 伏
-    {0x4F10, 0xB7A5}, // 伐
-    {0x4F11, 0xD0DD}, // 休
-    {0x4F17, 0xD6DA}, // 众
-    {0x4F18, 0xD3C5}, // 优
-    {0x4F19, 0xBBEF}, // 伙
-    {0x4F1A, 0xBBE1}, // 会
-    {0x4F1E, 0xC9A1}, // 伞
-    {0x4F1F, 0xCEB0}, // 伟
-    {0x4F20, 0xB4AB}, // 传
-    {0x4F24, 0xC9CB}, // 伤
-    {0x4F26, 0xC2D7}, // 伦
-    {0x4F2A, 0xCEB1}, // 伪
-    {0x4F2F, 0xB2AE}, // 伯
-    {0x4F30, 0xB9C0}, // 估
-    {0x4F34, 0xB0E9}, // 伴
-    {0x4F36, 0xC1E6}, // 伶
-    {0x4F38, 0xC9EC}, // 伸
-    {0x4F3A, 0xCBC5}, // 伺
-    {0x4F3C, 0xCBC6}, // 似
-    {0x4F43, 0xB5E8}, // 佃
-    {0x4F46, 0xB5AB}, // 但
-    {0x4F4D, 0xCEBB}, // 位
-    {0x4F4E, 0xB5CD}, // 低
-    {0x4F4F, 0xD7A1}, // 住
-    {0x4F50, 0xD7F4}, // 佐
-    {0x4F51, 0xD3D3}, // 佑
-    {0x4F53, 0xCCE5}, // 体
-    {0x4F55, 0xBACE}, // 何
-    {0x4F59, 0xD3E0}, // 余
-    {0x4F5B, 0xB7F0}, // 佛
-    {0x4F5C, 0xD7F7}, // 作
-    {0x4F60, 0xC4E3}, // 你
-    {0x4F63, 0xD3B6}, // 佣
-    {0x4F69, 0xC5E5}, // 佩
-    {0x4F6C, 0xC0D0}, // 佬
-    {0x4F6F, 0xD1F0}, // 佯
-    {0x4F70, 0xB0DB}, // 佰
-    {0x4F73, 0xBCD1}, // 佳
-    {0x4F7F, 0xCAB9}, // 使
-    {0x4F84, 0xD6B6}, // 侄
-    {0x4F88, 0xB3DE}, // 侈
-    {0x4F8B, 0xC0FD}, // 例
-    {0x4F8D, 0xCACC}, // 侍
-    {0x4F97, 0xB6B1}, // 侗
-    {0x4F9B, 0xB9A9}, // 供
-    {0x4F9D, 0xD2C0}, // 依
-    {0x4FA0, 0xCFC0}, // 侠
-    {0x4FA3, 0xC2C2}, // 侣
-    {0x4FA5, 0xBDC4}, // 侥
-    {0x4FA6, 0xD5EC}, // 侦
-    {0x4FA7, 0xB2E0}, // 侧
-    {0x4FA8, 0xC7C8}, // 侨
-    {0x4FA9, 0xBFEB}, // 侩
-    {0x4FAE, 0xCEEA}, // 侮
-    {0x4FAF, 0xBAEE}, // 侯
-    {0x4FB5, 0xC7D6}, // 侵
-    {0x4FBF, 0xB1E3}, // 便
-    {0x4FC3, 0xB4D9}, // 促
-    {0x4FC4, 0xB6ED}, // 俄
-    {0x4FCA, 0xBFA1}, // 俊
-    {0x4FCF, 0xC7CE}, // 俏
-    {0x4FD0, 0xC0FE}, // 俐
-    {0x4FD7, 0xCBD7}, // 俗
-    {0x4FD8, 0xB7FD}, // 俘
-    {0x4FDD, 0xB1A3}, // 保
-    {0x4FDE, 0xD3E1}, // 俞
-    {0x4FE1, 0xD0C5}, // 信
-    {0x4FE9, 0xC1A9}, // 俩
-    {0x4FED, 0xBCF3}, // 俭
-    {0x4FEE, 0xD0DE}, // 修
-    {0x4FEF, 0xB8A9}, // 俯
-    {0x4FF1, 0xBEE3}, // 俱
-    {0x4FFA, 0xB0B3}, // 俺
-    {0x500D, 0xB1B6}, // 倍
-    {0x5012, 0xB5B9}, // 倒
-    {0x5014, 0xBEF3}, // 倔
-    {0x5018, 0xCCC8}, // 倘
-    {0x5019, 0xBAF2}, // 候
-    {0x501A, 0xD2D0}, // 倚
-    {0x501F, 0xBDE8}, // 借
-    {0x5021, 0xB3AB}, // 倡
-    {0x5026, 0xBEEB}, // 倦
-    {0x502A, 0xC4DF}, // 倪
-    {0x503A, 0xD5AE}, // 债
-    {0x503C, 0xD6B5}, // 值
-    {0x503E, 0xC7E3}, // 倾
-    {0x5047, 0xBCD9}, // 假
-    {0x504F, 0xC6AB}, // 偏
-    {0x505A, 0xD7F6}, // 做
-    {0x505C, 0xCDA3}, // 停
-    {0x5065, 0xBDA1}, // 健
-    {0x5076, 0xC5BC}, // 偶
-    {0x5077, 0xCDB5}, // 偷
-    {0x507F, 0xB3A5}, // 偿
-    {0x5080, 0xBFFE}, // 傀
-    {0x5085, 0xB8B5}, // 傅
-    {0x508D, 0xB0F8}, // 傍
-    {0x50A3, 0xB4F6}, // 傣
-    {0x50A8, 0xB4A2}, // 储
-    {0x50AC, 0xB4DF}, // 催
-    {0x50B2, 0xB0C1}, // 傲
-    {0x50BB, 0xC9B5}, // 傻
-    {0x50CF, 0xCFF1}, // 像
-    {0x50DA, 0xC1C5}, // 僚
-    {0x50E7, 0xC9AE}, // 僧
-    {0x50F3, 0xCBDB}, // 僳
-    {0x50F3, 0xCBDB}, // 僳
-    {0x50F5, 0xBDA9}, // 僵
-    {0x50FB, 0xC6A7}, // 僻
-    {0x5112, 0xC8E5}, // 儒
-    {0x5121, 0xC0DC}, // 儡
-    {0x513F, 0xB6F9}, // 儿
-    {0x5141, 0xD4CA}, // 允
-    {0x5143, 0xD4AA}, // 元
-    {0x5144, 0xD0D6}, // 兄
-    {0x5145, 0xB3E4}, // 充
-    {0x5146, 0xD5D7}, // 兆
-    {0x5148, 0xCFC8}, // 先
-    {0x5149, 0xB9E2}, // 光
-    {0x514B, 0xBFCB}, // 克
-    {0x514D, 0xC3E2}, // 免
-    {0x5151, 0xB6D2}, // 兑
-    {0x5154, 0xCDC3}, // 兔
-    {0x515A, 0xB5B3}, // 党
-    {0x515C, 0xB6B5}, // 兜
-    {0x5162, 0xBEA4}, // 兢
-    {0x5165, 0xC8EB}, // 入
-    {0x5168, 0xC8AB}, // 全
-    {0x516B, 0xB0CB}, // 八
-    {0x516C, 0xB9AB}, // 公
-    {0x516D, 0xC1F9}, // 六
-    {0x5170, 0xC0BC}, // 兰
-    {0x5171, 0xB9B2}, // 共
-    {0x5173, 0xB9D8}, // 关
-    {0x5174, 0xD0CB}, // 兴
-    {0x5175, 0xB1F8}, // 兵
-    {0x5176, 0xC6E4}, // 其
-    {0x5177, 0xBEDF}, // 具
-    {0x5178, 0xB5E4}, // 典
-    {0x5179, 0xD7C8}, // 兹
-    {0x517B, 0xD1F8}, // 养
-    {0x517C, 0xBCE6}, // 兼
-    {0x517D, 0xCADE}, // 兽
-    {0x5180, 0xBCBD}, // 冀
-    {0x5185, 0xC4DA}, // 内
-    {0x5188, 0xB8D4}, // 冈
-    {0x5189, 0xC8BD}, // 冉
-    {0x518C, 0xB2E1}, // 册
-    {0x518D, 0xD4D9}, // 再
-    {0x5192, 0xC3B0}, // 冒
-    {0x5195, 0xC3E1}, // 冕
-    {0x5197, 0xC8DF}, // 冗
-    {0x5199, 0xD0B4}, // 写
-    {0x519B, 0xBEFC}, // 军
-    {0x519C, 0xC5A9}, // 农
-    {0x51A0, 0xB9DA}, // 冠
-    {0x51A4, 0xD4A9}, // 冤
-    {0x51AC, 0xB6AC}, // 冬
-    {0x51AF, 0xB7EB}, // 冯
-    {0x51B0, 0xB1F9}, // 冰
-    {0x51B2, 0xB3E5}, // 冲
-    {0x51B3, 0xBEF6}, // 决
-    {0x51B5, 0xBFF6}, // 况
-    {0x51B6, 0xD2B1}, // 冶
-    {0x51B7, 0xC0E4}, // 冷
-    {0x51BB, 0xB6B3}, // 冻
-    {0x51C0, 0xBEBB}, // 净
-    {0x51C4, 0xC6E0}, // 凄
-    {0x51C6, 0xD7BC}, // 准
-    {0x51C9, 0xC1B9}, // 凉
-    {0x51CB, 0xB5F2}, // 凋
-    {0x51CC, 0xC1E8}, // 凌
-    {0x51CF, 0xBCF5}, // 减
-    {0x51D1, 0xB4D5}, // 凑
-    {0x51DB, 0xC1DD}, // 凛
-    {0x51DD, 0xC4FD}, // 凝
-    {0x51E0, 0xBCB8}, // 几
-    {0x51E1, 0xB7B2}, // 凡
-    {0x51E4, 0xB7EF}, // 凤
-    {0x51ED, 0xC6BE}, // 凭
-    {0x51EF, 0xBFAD}, // 凯
-    {0x51F0, 0xBBCB}, // 凰
-    {0x51F3, 0xB5CA}, // 凳
-    {0x51F6, 0xD0D7}, // 凶
-    {0x51F8, 0xCDB9}, // 凸
-    {0x51F9, 0xB0BC}, // 凹
-    {0x51FA, 0xB3F6}, // 出
-    {0x51FB, 0xBBF7}, // 击
-    {0x51FD, 0xBAAF}, // 函
-    {0x51FF, 0xD4E4}, // 凿
-    {0x5200, 0xB5B6}, // 刀
-    {0x5201, 0xB5F3}, // 刁
-    {0x5203, 0xC8D0}, // 刃
-    {0x5206, 0xB7D6}, // 分
-    {0x5207, 0xC7D0}, // 切
-    {0x520A, 0xBFAF}, // 刊
-    {0x5211, 0xD0CC}, // 刑
-    {0x5212, 0xBBAE}, // 划
-    {0x5217, 0xC1D0}, // 列
-    {0x5218, 0xC1F5}, // 刘
-    {0x5219, 0xD4F2}, // 则
-    {0x521A, 0xB8D5}, // 刚
-    {0x521B, 0xB4B4}, // 创
-    {0x521D, 0xB3F5}, // 初
-    {0x5220, 0xC9BE}, // 删
-    {0x5224, 0xC5D0}, // 判
-    {0x5228, 0xC5D9}, // 刨
-    {0x5229, 0xC0FB}, // 利
-    {0x522B, 0xB1F0}, // 别
-    {0x522E, 0xB9CE}, // 刮
-    {0x5230, 0xB5BD}, // 到
-    {0x5236, 0xD6C6}, // 制
-    {0x5237, 0xCBA2}, // 刷
-    {0x5238, 0xC8AF}, // 券
-    {0x5239, 0xC9B2}, // 刹
-    {0x523A, 0xB4CC}, // 刺
-    {0x523B, 0xBFCC}, // 刻
-    {0x523D, 0xB9F4}, // 刽
-    {0x5241, 0xB6E7}, // 剁
-    {0x5242, 0xBCC1}, // 剂
-    {0x5243, 0xCCEA}, // 剃
-    {0x524A, 0xCFF7}, // 削
-    {0x524D, 0xC7B0}, // 前
-    {0x5250, 0xB9D0}, // 剐
-    {0x5251, 0xBDA3}, // 剑
-    {0x5254, 0xCCDE}, // 剔
-    {0x5256, 0xC6CA}, // 剖
-    {0x5265, 0xB0FE}, // 剥
-    {0x5267, 0xBEE7}, // 剧
-    {0x5269, 0xCAA3}, // 剩
-    {0x526A, 0xBCF4}, // 剪
-    {0x526F, 0xB8B1}, // 副
-    {0x5272, 0xB8EE}, // 割
-    {0x527F, 0xBDCB}, // 剿
-    {0x5288, 0xC5FC}, // 劈
-    {0x529B, 0xC1A6}, // 力
-    {0x529D, 0xC8B0}, // 劝
-    {0x529E, 0xB0EC}, // 办
-    {0x529F, 0xB9A6}, // 功
-    {0x52A0, 0xBCD3}, // 加
-    {0x52A1, 0xCEF1}, // 务
-    {0x52A3, 0xC1D3}, // 劣
-    {0x52A8, 0xB6AF}, // 动
-    {0x52A9, 0xD6FA}, // 助
-    {0x52AA, 0xC5AC}, // 努
-    {0x52AB, 0xBDD9}, // 劫
-    {0x52B1, 0xC0F8}, // 励
-    {0x52B2, 0xBEA2}, // 劲
-    {0x52B3, 0xC0CD}, // 劳
-    {0x52BF, 0xCAC6}, // 势
-    {0x52C3, 0xB2AA}, // 勃
-    {0x52C7, 0xD3C2}, // 勇
-    {0x52C9, 0xC3E3}, // 勉
-    {0x52CB, 0xD1AB}, // 勋
-    {0x52D2, 0xC0D5}, // 勒
-    {0x52D8, 0xBFB1}, // 勘
-    {0x52DF, 0xC4BC}, // 募
-    {0x52E4, 0xC7DA}, // 勤
-    {0x52FA, 0xC9D7}, // 勺
-    {0x52FE, 0xB9B4}, // 勾
-    {0x52FF, 0xCEF0}, // 勿
-    {0x5300, 0xD4C8}, // 匀
-    {0x5305, 0xB0FC}, // 包
-    {0x5306, 0xB4D2}, // 匆
-    {0x5308, 0xD0D9}, // 匈
-    {0x5316, 0xBBAF}, // 化
-    {0x5317, 0xB1B1}, // 北
-    {0x5319, 0xB3D7}, // 匙
-    {0x531D, 0xD4D1}, // 匝
-    {0x5320, 0xBDB3}, // 匠
-    {0x5321, 0xBFEF}, // 匡
-    {0x5323, 0xCFBB}, // 匣
-    {0x532A, 0xB7CB}, // 匪
-    {0x5339, 0xC6A5}, // 匹
-    {0x533A, 0xC7F8}, // 区
-    {0x533B, 0xD2BD}, // 医
-    {0x533F, 0xC4E4}, // 匿
-    {0x5341, 0xCAAE}, // 十
-    {0x5343, 0xC7A7}, // 千
-    {0x5347, 0xC9FD}, // 升
-    {0x5348, 0xCEE7}, // 午
-    {0x5349, 0xBBDC}, // 卉
-    {0x534A, 0xB0EB}, // 半
-    {0x534E, 0xBBAA}, // 华
-    {0x534F, 0xD0AD}, // 协
-    {0x5351, 0xB1B0}, // 卑
-    {0x5352, 0xD7E4}, // 卒
-    {0x5353, 0xD7BF}, // 卓
-    {0x5355, 0xB5A5}, // 单
-    {0x5356, 0xC2F4}, // 卖
-    {0x5357, 0xC4CF}, // 南
-    {0x535A, 0xB2A9}, // 博
-    {0x535C, 0xB2B7}, // 卜
-    {0x535E, 0xB1E5}, // 卞
-    {0x5360, 0xD5BC}, // 占
-    {0x5361, 0xBFA8}, // 卡
-    {0x5362, 0xC2AC}, // 卢
-    {0x5364, 0xC2B1}, // 卤
-    {0x5367, 0xCED4}, // 卧
-    {0x536B, 0xCEC0}, // 卫
-    {0x536F, 0xC3AE}, // 卯
-    {0x5370, 0xD3A1}, // 印
-    {0x5371, 0xCEA3}, // 危
-    {0x5373, 0xBCB4}, // 即
-    {0x5374, 0xC8B4}, // 却
-    {0x5375, 0xC2D1}, // 卵
-    {0x5377, 0xBEED}, // 卷
-    {0x5378, 0xD0B6}, // 卸
-    {0x537F, 0xC7E4}, // 卿
-    {0x5382, 0xB3A7}, // 厂
-    {0x5384, 0xB6F2}, // 厄
-    {0x5385, 0xCCFC}, // 厅
-    {0x5386, 0xC0FA}, // 历
-    {0x5389, 0xC0F7}, // 厉
-    {0x538B, 0xD1B9}, // 压
-    {0x538C, 0xD1E1}, // 厌
-    {0x5395, 0xB2DE}, // 厕
-    {0x5398, 0xC0E5}, // 厘
-    {0x539A, 0xBAF1}, // 厚
-    {0x539F, 0xD4AD}, // 原
-    {0x53A2, 0xCFE1}, // 厢
-    {0x53A6, 0xCFC3}, // 厦
-    {0x53A8, 0xB3F8}, // 厨
-    {0x53A9, 0xBEC7}, // 厩
-    {0x53BB, 0xC8A5}, // 去
-    {0x53BF, 0xCFD8}, // 县
-    {0x53C1, 0xC8FE}, // 叁
-    {0x53C2, 0xB2CE}, // 参
-    {0x53C8, 0xD3D6}, // 又
-    {0x53C9, 0xB2E6}, // 叉
-    {0x53CA, 0xBCB0}, // 及
-    {0x53CB, 0xD3D1}, // 友
-    {0x53CC, 0xCBAB}, // 双
-    {0x53CD, 0xB7B4}, // 反
-    {0x53D1, 0xB7A2}, // 发
-    {0x53D4, 0xCAE5}, // 叔
-    {0x53D6, 0xC8A1}, // 取
-    {0x53D7, 0xCADC}, // 受
-    {0x53D8, 0xB1E4}, // 变
-    {0x53D9, 0xD0F0}, // 叙
-    {0x53DB, 0xC5D1}, // 叛
-    {0x53E0, 0xB5FE}, // 叠
-    {0x53E3, 0xBFDA}, // 口
-    {0x53E4, 0xB9C5}, // 古
-    {0x53E5, 0xBEE4}, // 句
-    {0x53E6, 0xC1ED}, // 另
-    {0x53EA, 0xD6BB}, // 只
-    {0x53EB, 0xBDD0}, // 叫
-    {0x53EC, 0xD5D9}, // 召
-    {0x53ED, 0xB0C8}, // 叭
-    {0x53EE, 0xB6A3}, // 叮
-    {0x53EF, 0xBFC9}, // 可
-    {0x53F0, 0xCCA8}, // 台
-    {0x53F2, 0xCAB7}, // 史
-    {0x53F3, 0xD3D2}, // 右
-    {0x53F6, 0xD2B6}, // 叶
-    {0x53F7, 0xBAC5}, // 号
-    {0x53F8, 0xCBBE}, // 司
-    {0x53F9, 0xCCBE}, // 叹
-    {0x53FC, 0xB5F0}, // 叼
-    {0x5401, 0xD3F5}, // 吁
-    {0x5403, 0xB3D4}, // 吃
-    {0x5404, 0xB8F7}, // 各
-    {0x5408, 0xBACF}, // 合
-    {0x5409, 0xBCAA}, // 吉
-    {0x540A, 0xB5F5}, // 吊
-    {0x540C, 0xCDAC}, // 同
-    {0x540D, 0xC3FB}, // 名
-    {0x540E, 0xBAF3}, // 后
-    {0x540F, 0xC0F4}, // 吏
-    {0x5410, 0xCDC2}, // 吐
-    {0x5411, 0xCFF2}, // 向
-    {0x5413, 0xCFC5}, // 吓
-    {0x5415, 0xC2C0}, // 吕
-    {0x5417, 0xC2F0}, // 吗
-    {0x541B, 0xBEFD}, // 君
-    {0x541D, 0xC1DF}, // 吝
-    {0x541E, 0xCDCC}, // 吞
-    {0x541F, 0xD2F7}, // 吟
-    {0x5420, 0xB7CD}, // 吠
-    {0x5426, 0xB7F1}, // 否
-    {0x5427, 0xB0C9}, // 吧
-    {0x5428, 0xB6D6}, // 吨
-    {0x5429, 0xB7D4}, // 吩
-    {0x542B, 0xBAAC}, // 含
-    {0x542C, 0xCCFD}, // 听
-    {0x542D, 0xBFD4}, // 吭
-    {0x542E, 0xCBB1}, // 吮
-    {0x542F, 0xC6F4}, // 启
-    {0x5431, 0xD6A8}, // 吱
-    {0x5434, 0xCEE2}, // 吴
-    {0x5435, 0xB3B3}, // 吵
-    {0x5438, 0xCEFC}, // 吸
-    {0x5439, 0xB4B5}, // 吹
-    {0x543B, 0xCEC7}, // 吻
-    {0x543C, 0xBAF0}, // 吼
-    {0x543E, 0xCEE1}, // 吾
-    {0x5440, 0xD1BD}, // 呀
-    {0x5446, 0xB4F4}, // 呆
-    {0x5448, 0xB3CA}, // 呈
-    {0x544A, 0xB8E6}, // 告
-    {0x5450, 0xC4C5}, // 呐
-    {0x5455, 0xC5BB}, // 呕
-    {0x5458, 0xD4B1}, // 员
-    {0x545B, 0xC7BA}, // 呛
-    {0x545C, 0xCED8}, // 呜
-    {0x5462, 0xC4D8}, // 呢
-    {0x5468, 0xD6DC}, // 周
-    {0x5473, 0xCEB6}, // 味
-    {0x5475, 0xBAC7}, // 呵
-    {0x5478, 0xC5DE}, // 呸
-    {0x547B, 0xC9EB}, // 呻
-    {0x547C, 0xBAF4}, // 呼
-    {0x547D, 0xC3FC}, // 命
-    {0x5480, 0xBED7}, // 咀
-    {0x5486, 0xC5D8}, // 咆
-    {0x548B, 0xD5A6}, // 咋
-    {0x548C, 0xBACD}, // 和
-    {0x548E, 0xBECC}, // 咎
-    {0x548F, 0xD3BD}, // 咏
-    {0x5490, 0xB8C0}, // 咐
-    {0x5492, 0xD6E4}, // 咒
-    {0x5495, 0xB9BE}, // 咕
-    {0x5496, 0xBFA7}, // 咖
-    {0x5499, 0xC1FC}, // 咙
-    {0x54A8, 0xD7C9}, // 咨
-    {0x54AC, 0xD2A7}, // 咬
-    {0x54AF, 0xBFA9}, // 咯
-    {0x54B1, 0xD4DB}, // 咱
-    {0x54B3, 0xBFC8}, // 咳
-    {0x54B8, 0xCFCC}, // 咸
-    {0x54BD, 0xD1CA}, // 咽
-    {0x54C0, 0xB0A7}, // 哀
-    {0x54C1, 0xC6B7}, // 品
-    {0x54C4, 0xBAE5}, // 哄
-    {0x54C6, 0xB6DF}, // 哆
-    {0x54C7, 0xCDDB}, // 哇
-    {0x54C8, 0xB9FE}, // 哈
-    {0x54C9, 0xD4D5}, // 哉
-    {0x54CD, 0xCFEC}, // 响
-    {0x54CE, 0xB0A5}, // 哎
-    {0x54D1, 0xD1C6}, // 哑
-    {0x54D7, 0xBBA9}, // 哗
-    {0x54DF, 0xD3B4}, // 哟
-    {0x54E5, 0xB8E7}, // 哥
-    {0x54E6, 0xC5B6}, // 哦
-    {0x54E8, 0xC9DA}, // 哨
-    {0x54E9, 0xC1A8}, // 哩
-    {0x54EA, 0xC4C4}, // 哪
-    {0x54ED, 0xBFDE}, // 哭
-    {0x54EE, 0xCFF8}, // 哮
-    {0x54F2, 0xD5DC}, // 哲
-    {0x54FA, 0xB2B8}, // 哺
-    {0x54FC, 0xBADF}, // 哼
-    {0x5501, 0xD1E4}, // 唁
-    {0x5506, 0xCBF4}, // 唆
-    {0x5507, 0xB4BD}, // 唇
-    {0x5509, 0xB0A6}, // 唉
-    {0x5510, 0xCCC6}, // 唐
-    {0x5524, 0xBBBD}, // 唤
-    {0x552C, 0xBBA3}, // 唬
-    {0x552E, 0xCADB}, // 售
-    {0x552F, 0xCEA8}, // 唯
-    {0x5531, 0xB3AA}, // 唱
-    {0x553E, 0xCDD9}, // 唾
-    {0x5543, 0xBFD0}, // 啃
-    {0x5544, 0xD7C4}, // 啄
-    {0x5546, 0xC9CC}, // 商
-    {0x554A, 0xB0A1}, // 啊
-    {0x5561, 0xB7C8}, // 啡
-    {0x5564, 0xC6A1}, // 啤
-    {0x5565, 0xC9B6}, // 啥
-    {0x5566, 0xC0B2}, // 啦
-    {0x556A, 0xC5BE}, // 啪
-    {0x556E, 0xC4F6}, // 啮
-    {0x5578, 0xD0A5}, // 啸
-    {0x557C, 0xCCE4}, // 啼
-    {0x5580, 0xBFA6}, // 喀
-    {0x5582, 0xCEB9}, // 喂
-    {0x5584, 0xC9C6}, // 善
-    {0x5587, 0xC0AE}, // 喇
-    {0x5589, 0xBAED}, // 喉
-    {0x558A, 0xBAB0}, // 喊
-    {0x5598, 0xB4AD}, // 喘
-    {0x559C, 0xCFB2}, // 喜
-    {0x559D, 0xBAC8}, // 喝
-    {0x55A7, 0xD0FA}, // 喧
-    {0x55B3, 0xD4FB}, // 喳
-    {0x55B7, 0xC5E7}, // 喷
-    {0x55BB, 0xD3F7}, // 喻
-    {0x55C5, 0xD0E1}, // 嗅
-    {0x55D3, 0xC9A4}, // 嗓
-    {0x55DC, 0xCAC8}, // 嗜
-    {0x55E1, 0xCECB}, // 嗡
-    {0x55E3, 0xCBC3}, // 嗣
-    {0x55FD, 0xCBD4}, // 嗽
-    {0x5609, 0xBCCE}, // 嘉
-    {0x560E, 0xB8C2}, // 嘎
-    {0x5618, 0xD0EA}, // 嘘
-    {0x561B, 0xC2EF}, // 嘛
-    {0x5631, 0xD6F6}, // 嘱
-    {0x5632, 0xB3B0}, // 嘲
-    {0x5634, 0xD7EC}, // 嘴
-    {0x5636, 0xCBBB}, // 嘶
-    {0x563B, 0xCEFB}, // 嘻
-    {0x563F, 0xBAD9}, // 嘿
-    {0x564E, 0xD2AD}, // 噎
-    {0x5668, 0xC6F7}, // 器
-    {0x566A, 0xD4EB}, // 噪
-    {0x566C, 0xCAC9}, // 噬
-    {0x5676, 0xB8C1}, // 噶
-    {0x568E, 0xBABF}, // 嚎
-    {0x568F, 0xCCE7}, // 嚏
-    {0x56A3, 0xCFF9}, // 嚣
-    {0x56B7, 0xC8C2}, // 嚷
-    {0x56BC, 0xBDC0}, // 嚼
-    {0x56CA, 0xC4D2}, // 囊
-    {0x56DA, 0xC7F4}, // 囚
-    {0x56DB, 0xCBC4}, // 四
-    {0x56DE, 0xBBD8}, // 回
-    {0x56E0, 0xD2F2}, // 因
-    {0x56E2, 0xCDC5}, // 团
-    {0x56E4, 0xB6DA}, // 囤
-    {0x56ED, 0xD4B0}, // 园
-    {0x56F0, 0xC0A7}, // 困
-    {0x56F1, 0xB4D1}, // 囱
-    {0x56F4, 0xCEA7}, // 围
-    {0x56FA, 0xB9CC}, // 固
-    {0x56FD, 0xB9FA}, // 国
-    {0x56FE, 0xCDBC}, // 图
-    {0x5703, 0xC6D4}, // 圃
-    {0x5706, 0xD4B2}, // 圆
-    {0x5708, 0xC8A6}, // 圈
-    {0x571F, 0xCDC1}, // 土
-    {0x5723, 0xCAA5}, // 圣
-    {0x5728, 0xD4DA}, // 在
-    {0x572D, 0xB9E7}, // 圭
-    {0x5730, 0xB5D8}, // 地
-    {0x5733, 0xDBDA}, // 圳
-    {0x573A, 0xB3A1}, // 场
-    {0x573E, 0xBBF8}, // 圾
-    {0x5740, 0xD6B7}, // 址
-    {0x5747, 0xBEF9}, // 均
-    {0x574A, 0xB7BB}, // 坊
-    {0x574D, 0xCCAE}, // 坍
-    {0x574E, 0xBFB2}, // 坎
-    {0x574F, 0xBBB5}, // 坏
-    {0x5750, 0xD7F8}, // 坐
-    {0x5751, 0xBFD3}, // 坑
-    {0x5757, 0xBFE9}, // 块
-    {0x575A, 0xBCE1}, // 坚
-    {0x575B, 0xCCB3}, // 坛
-    {0x575D, 0xB0D3}, // 坝
-    {0x575E, 0xCEEB}, // 坞
-    {0x575F, 0xB7D8}, // 坟
-    {0x5760, 0xD7B9}, // 坠
-    {0x5761, 0xC6C2}, // 坡
-    {0x5764, 0xC0A4}, // 坤
-    {0x5766, 0xCCB9}, // 坦
-    {0x576A, 0xC6BA}, // 坪
-    {0x576F, 0xC5F7}, // 坯
-    {0x5777, 0xBFC0}, // 坷
-    {0x5782, 0xB4B9}, // 垂
-    {0x5783, 0xC0AC}, // 垃
-    {0x5784, 0xC2A2}, // 垄
-    {0x578B, 0xD0CD}, // 型
-    {0x5792, 0xC0DD}, // 垒
-    {0x579B, 0xB6E2}, // 垛
-    {0x57A2, 0xB9B8}, // 垢
-    {0x57A3, 0xD4AB}, // 垣
-    {0x57A6, 0xBFD1}, // 垦
-    {0x57AB, 0xB5E6}, // 垫
-    {0x57AE, 0xBFE5}, // 垮
-    {0x57C2, 0xB9A1}, // 埂
-    {0x57C3, 0xB0A3}, // 埃
-    {0x57CB, 0xC2F1}, // 埋
-    {0x57CE, 0xB3C7}, // 城
-    {0x57D4, 0xC6D2}, // 埔
-    {0x57DF, 0xD3F2}, // 域
-    {0x57E0, 0xB2BA}, // 埠
-    {0x57F9, 0xC5E0}, // 培
-    {0x57FA, 0xBBF9}, // 基
-    {0x5802, 0xCCC3}, // 堂
-    {0x5806, 0xB6D1}, // 堆
-    {0x5811, 0xC7B5}, // 堑
-    {0x5815, 0xB6E9}, // 堕
-    {0x5821, 0xB1A4}, // 堡
-    {0x5824, 0xB5CC}, // 堤
-    {0x582A, 0xBFB0}, // 堪
-    {0x5830, 0xD1DF}, // 堰
-    {0x5835, 0xB6C2}, // 堵
-    {0x584C, 0xCBFA}, // 塌
-    {0x5851, 0xCBDC}, // 塑
-    {0x5854, 0xCBFE}, // 塔
-    {0x5858, 0xCCC1}, // 塘
-    {0x585E, 0xC8FB}, // 塞
-    {0x586B, 0xCCEE}, // 填
-    {0x5883, 0xBEB3}, // 境
-    {0x5885, 0xCAFB}, // 墅
-    {0x5892, 0xC9CA}, // 墒
-    {0x5893, 0xC4B9}, // 墓
-    {0x5899, 0xC7BD}, // 墙
-    {0x589E, 0xD4F6}, // 增
-    {0x589F, 0xD0E6}, // 墟
-    {0x58A8, 0xC4AB}, // 墨
-    {0x58A9, 0xB6D5}, // 墩
-    {0x58C1, 0xB1DA}, // 壁
-    {0x58D5, 0xBABE}, // 壕
-    {0x58E4, 0xC8C0}, // 壤
-    {0x58EB, 0xCABF}, // 士
-    {0x58EC, 0xC8C9}, // 壬
-    {0x58EE, 0xD7B3}, // 壮
-    {0x58F0, 0xC9F9}, // 声
-    {0x58F3, 0xBFC7}, // 壳
-    {0x58F6, 0xBAF8}, // 壶
-    {0x58F9, 0xD2BC}, // 壹
-    {0x5904, 0xB4A6}, // 处
-    {0x5907, 0xB1B8}, // 备
-    {0x590D, 0xB8B4}, // 复
-    {0x590F, 0xCFC4}, // 夏
-    {0x5915, 0xCFA6}, // 夕
-    {0x5916, 0xCDE2}, // 外
-    {0x591A, 0xB6E0}, // 多
-    {0x591C, 0xD2B9}, // 夜
-    {0x591F, 0xB9BB}, // 够
-    {0x5927, 0xB4F3}, // 大
-    {0x5929, 0xCCEC}, // 天
-    {0x592A, 0xCCAB}, // 太
-    {0x592B, 0xB7F2}, // 夫
-    {0x592E, 0xD1EB}, // 央
-    {0x592F, 0xBABB}, // 夯
-    {0x5931, 0xCAA7}, // 失
-    {0x5934, 0xCDB7}, // 头
-    {0x5937, 0xD2C4}, // 夷
-    {0x5938, 0xBFE4}, // 夸
-    {0x5939, 0xBCD0}, // 夹
-    {0x593A, 0xB6E1}, // 夺
-    {0x5944, 0xD1D9}, // 奄
-    {0x5947, 0xC6E6}, // 奇
-    {0x5948, 0xC4CE}, // 奈
-    {0x5949, 0xB7EE}, // 奉
-    {0x594B, 0xB7DC}, // 奋
-    {0x594E, 0xBFFC}, // 奎
-    {0x594F, 0xD7E0}, // 奏
-    {0x5951, 0xC6F5}, // 契
-    {0x5954, 0xB1BC}, // 奔
-    {0x5956, 0xBDB1}, // 奖
-    {0x5957, 0xCCD7}, // 套
-    {0x5960, 0xB5EC}, // 奠
-    {0x5962, 0xC9DD}, // 奢
-    {0x5965, 0xB0C2}, // 奥
-    {0x5973, 0xC5AE}, // 女
-    {0x5974, 0xC5AB}, // 奴
-    {0x5976, 0xC4CC}, // 奶
-    {0x5978, 0xBCE9}, // 奸
-    {0x5979, 0xCBFD}, // 她
-    {0x597D, 0xBAC3}, // 好
-    {0x5982, 0xC8E7}, // 如
-    {0x5984, 0xCDFD}, // 妄
-    {0x5986, 0xD7B1}, // 妆
-    {0x5987, 0xB8BE}, // 妇
-    {0x5988, 0xC2E8}, // 妈
-    {0x598A, 0xC8D1}, // 妊
-    {0x5992, 0xB6CA}, // 妒
-    {0x5993, 0xBCCB}, // 妓
-    {0x5996, 0xD1FD}, // 妖
-    {0x5999, 0xC3EE}, // 妙
-    {0x59A5, 0xCDD7}, // 妥
-    {0x59A8, 0xB7C1}, // 妨
-    {0x59AE, 0xC4DD}, // 妮
-    {0x59B9, 0xC3C3}, // 妹
-    {0x59BB, 0xC6DE}, // 妻
-    {0x59C6, 0xC4B7}, // 姆
-    {0x59CB, 0xCABC}, // 始
-    {0x59D0, 0xBDE3}, // 姐
-    {0x59D1, 0xB9C3}, // 姑
-    {0x59D3, 0xD0D5}, // 姓
-    {0x59D4, 0xCEAF}, // 委
-    {0x59DA, 0xD2A6}, // 姚
-    {0x59DC, 0xBDAA}, // 姜
-    {0x59E5, 0xC0D1}, // 姥
-    {0x59E8, 0xD2CC}, // 姨
-    {0x59EC, 0xBCA7}, // 姬
-    {0x59FB, 0xD2F6}, // 姻
-    {0x59FF, 0xD7CB}, // 姿
-    {0x5A01, 0xCDFE}, // 威
-    {0x5A03, 0xCDDE}, // 娃
-    {0x5A04, 0xC2A6}, // 娄
-    {0x5A07, 0xBDBF}, // 娇
-    {0x5A18, 0xC4EF}, // 娘
-    {0x5A1C, 0xC4C8}, // 娜
-    {0x5A1F, 0xBEEA}, // 娟
-    {0x5A20, 0xC9EF}, // 娠
-    {0x5A25, 0xB6F0}, // 娥
-    {0x5A29, 0xC3E4}, // 娩
-    {0x5A31, 0xD3E9}, // 娱
-    {0x5A36, 0xC8A2}, // 娶
-    {0x5A46, 0xC6C5}, // 婆
-    {0x5A49, 0xCDF1}, // 婉
-    {0x5A5A, 0xBBE9}, // 婚
-    {0x5A6A, 0xC0B7}, // 婪
-    {0x5A74, 0xD3A4}, // 婴
-    {0x5A76, 0xC9F4}, // 婶
-    {0x5A7F, 0xD0F6}, // 婿
-    {0x5A92, 0xC3BD}, // 媒
-    {0x5A9A, 0xC3C4}, // 媚
-    {0x5AB3, 0xCFB1}, // 媳
-    {0x5AC1, 0xBCDE}, // 嫁
-    {0x5AC2, 0xC9A9}, // 嫂
-    {0x5AC9, 0xBCB5}, // 嫉
-    {0x5ACC, 0xCFD3}, // 嫌
-    {0x5AE1, 0xB5D5}, // 嫡
-    {0x5AE9, 0xC4DB}, // 嫩
-    {0x5B50, 0xD7D3}, // 子
-    {0x5B54, 0xBFD7}, // 孔
-    {0x5B55, 0xD4D0}, // 孕
-    {0x5B57, 0xD7D6}, // 字
-    {0x5B58, 0xB4E6}, // 存
-    {0x5B59, 0xCBEF}, // 孙
-    {0x5B5C, 0xD7CE}, // 孜
-    {0x5B5D, 0xD0A2}, // 孝
-    {0x5B5F, 0xC3CF}, // 孟
-    {0x5B63, 0xBCBE}, // 季
-    {0x5B64, 0xB9C2}, // 孤
-    {0x5B66, 0xD1A7}, // 学
-    {0x5B69, 0xBAA2}, // 孩
-    {0x5B6A, 0xC2CF}, // 孪
-    {0x5B70, 0xCAEB}, // 孰
-    {0x5B75, 0xB7F5}, // 孵
-    {0x5B7A, 0xC8E6}, // 孺
-    {0x5B7D, 0xC4F5}, // 孽
-    {0x5B81, 0xC4FE}, // 宁
-    {0x5B83, 0xCBFC}, // 它
-    {0x5B85, 0xD5AC}, // 宅
-    {0x5B87, 0xD3EE}, // 宇
-    {0x5B88, 0xCAD8}, // 守
-    {0x5B89, 0xB0B2}, // 安
-    {0x5B8B, 0xCBCE}, // 宋
-    {0x5B8C, 0xCDEA}, // 完
-    {0x5B8F, 0xBAEA}, // 宏
-    {0x5B97, 0xD7DA}, // 宗
-    {0x5B98, 0xB9D9}, // 官
-    {0x5B99, 0xD6E6}, // 宙
-    {0x5B9A, 0xB6A8}, // 定
-    {0x5B9B, 0xCDF0}, // 宛
-    {0x5B9C, 0xD2CB}, // 宜
-    {0x5B9D, 0xB1A6}, // 宝
-    {0x5B9E, 0xCAB5}, // 实
-    {0x5BA0, 0xB3E8}, // 宠
-    {0x5BA1, 0xC9F3}, // 审
-    {0x5BA2, 0xBFCD}, // 客
-    {0x5BA3, 0xD0FB}, // 宣
-    {0x5BA4, 0xCAD2}, // 室
-    {0x5BA6, 0xBBC2}, // 宦
-    {0x5BAA, 0xCFDC}, // 宪
-    {0x5BAB, 0xB9AC}, // 宫
-    {0x5BB0, 0xD4D7}, // 宰
-    {0x5BB3, 0xBAA6}, // 害
-    {0x5BB4, 0xD1E7}, // 宴
-    {0x5BB5, 0xCFFC}, // 宵
-    {0x5BB6, 0xBCD2}, // 家
-    {0x5BB9, 0xC8DD}, // 容
-    {0x5BBD, 0xBFED}, // 宽
-    {0x5BBE, 0xB1F6}, // 宾
-    {0x5BBF, 0xCBDE}, // 宿
-    {0x5BC2, 0xBCC5}, // 寂
-    {0x5BC4, 0xBCC4}, // 寄
-    {0x5BC5, 0xD2FA}, // 寅
-    {0x5BC6, 0xC3DC}, // 密
-    {0x5BC7, 0xBFDC}, // 寇
-    {0x5BCC, 0xB8BB}, // 富
-    {0x5BD0, 0xC3C2}, // 寐
-    {0x5BD2, 0xBAAE}, // 寒
-    {0x5BD3, 0xD4A2}, // 寓
-    {0x5BDD, 0xC7DE}, // 寝
-    {0x5BDE, 0xC4AF}, // 寞
-    {0x5BDF, 0xB2EC}, // 察
-    {0x5BE1, 0xB9D1}, // 寡
-    {0x5BE5, 0xC1C8}, // 寥
-    {0x5BE8, 0xD5AF}, // 寨
-    {0x5BF8, 0xB4E7}, // 寸
-    {0x5BF9, 0xB6D4}, // 对
-    {0x5BFA, 0xCBC2}, // 寺
-    {0x5BFB, 0xD1B0}, // 寻
-    {0x5BFC, 0xB5BC}, // 导
-    {0x5BFF, 0xCAD9}, // 寿
-    {0x5C01, 0xB7E2}, // 封
-    {0x5C04, 0xC9E4}, // 射
-    {0x5C06, 0xBDAB}, // 将
-    {0x5C09, 0xCEBE}, // 尉
-    {0x5C0A, 0xD7F0}, // 尊
-    {0x5C0F, 0xD0A1}, // 小
-    {0x5C11, 0xC9D9}, // 少
-    {0x5C14, 0xB6FB}, // 尔
-    {0x5C16, 0xBCE2}, // 尖
-    {0x5C18, 0xB3BE}, // 尘
-    {0x5C1A, 0xC9D0}, // 尚
-    {0x5C1D, 0xB3A2}, // 尝
-    {0x5C24, 0xD3C8}, // 尤
-    {0x5C27, 0xD2A2}, // 尧
-    {0x5C31, 0xBECD}, // 就
-    {0x5C38, 0xCAAC}, // 尸
-    {0x5C39, 0xD2FC}, // 尹
-    {0x5C3A, 0xB3DF}, // 尺
-    {0x5C3C, 0xC4E1}, // 尼
-    {0x5C3D, 0xBEA1}, // 尽
-    {0x5C3E, 0xCEB2}, // 尾
-    {0x5C3F, 0xC4F2}, // 尿
-    {0x5C40, 0xBED6}, // 局
-    {0x5C41, 0xC6A8}, // 屁
-    {0x5C42, 0xB2E3}, // 层
-    {0x5C45, 0xBED3}, // 居
-    {0x5C48, 0xC7FC}, // 屈
-    {0x5C49, 0xCCEB}, // 屉
-    {0x5C4A, 0xBDEC}, // 届
-    {0x5C4B, 0xCEDD}, // 屋
-    {0x5C4E, 0xCABA}, // 屎
-    {0x5C4F, 0xC6C1}, // 屏
-    {0x5C51, 0xD0BC}, // 屑
-    {0x5C55, 0xD5B9}, // 展
-    {0x5C5E, 0xCAF4}, // 属
-    {0x5C60, 0xCDC0}, // 屠
-    {0x5C61, 0xC2C5}, // 屡
-    {0x5C65, 0xC2C4}, // 履
-    {0x5C6F, 0xCDCD}, // 屯
-    {0x5C71, 0xC9BD}, // 山
-    {0x5C79, 0xD2D9}, // 屹
-    {0x5C7F, 0xD3EC}, // 屿
-    {0x5C81, 0xCBEA}, // 岁
-    {0x5C82, 0xC6F1}, // 岂
-    {0x5C94, 0xB2ED}, // 岔
-    {0x5C97, 0xB8DA}, // 岗
-    {0x5C9B, 0xB5BA}, // 岛
-    {0x5CA9, 0xD1D2}, // 岩
-    {0x5CAD, 0xC1EB}, // 岭
-    {0x5CB3, 0xD4C0}, // 岳
-    {0x5CB8, 0xB0B6}, // 岸
-    {0x5CBF, 0xBFF9}, // 岿
-    {0x5CD9, 0xD6C5}, // 峙
-    {0x5CE1, 0xCFBF}, // 峡
-    {0x5CE6, 0xC2CD}, // 峦
-    {0x5CE8, 0xB6EB}, // 峨
-    {0x5CEA, 0xD3F8}, // 峪
-    {0x5CED, 0xC7CD}, // 峭
-    {0x5CF0, 0xB7E5}, // 峰
-    {0x5CFB, 0xBEFE}, // 峻
-    {0x5D07, 0xB3E7}, // 崇
-    {0x5D0E, 0xC6E9}, // 崎
-    {0x5D14, 0xB4DE}, // 崔
-    {0x5D16, 0xD1C2}, // 崖
-    {0x5D29, 0xB1C0}, // 崩
-    {0x5D2D, 0xD5B8}, // 崭
-    {0x5D4C, 0xC7B6}, // 嵌
-    {0x5DCD, 0xCEA1}, // 巍
-    {0x5DDD, 0xB4A8}, // 川
-    {0x5DDE, 0xD6DD}, // 州
-    {0x5DE1, 0xD1B2}, // 巡
-    {0x5DE2, 0xB3B2}, // 巢
-    {0x5DE5, 0xB9A4}, // 工
-    {0x5DE6, 0xD7F3}, // 左
-    {0x5DE7, 0xC7C9}, // 巧
-    {0x5DE8, 0xBEDE}, // 巨
-    {0x5DE9, 0xB9AE}, // 巩
-    {0x5DEB, 0xCED7}, // 巫
-    {0x5DEE, 0xB2EE}, // 差
-    {0x5DF1, 0xBCBA}, // 己
-    {0x5DF2, 0xD2D1}, // 已
-    {0x5DF3, 0xCBC8}, // 巳
-    {0x5DF4, 0xB0CD}, // 巴
-    {0x5DF7, 0xCFEF}, // 巷
-    {0x5DFE, 0xBDED}, // 巾
-    {0x5E01, 0xB1D2}, // 币
-    {0x5E02, 0xCAD0}, // 市
-    {0x5E03, 0xB2BC}, // 布
-    {0x5E05, 0xCBA7}, // 帅
-    {0x5E06, 0xB7AB}, // 帆
-    {0x5E08, 0xCAA6}, // 师
-    {0x5E0C, 0xCFA3}, // 希
-    {0x5E10, 0xD5CA}, // 帐
-    {0x5E15, 0xC5C1}, // 帕
-    {0x5E16, 0xCCFB}, // 帖
-    {0x5E18, 0xC1B1}, // 帘
-    {0x5E1A, 0xD6E3}, // 帚
-    {0x5E1B, 0xB2AF}, // 帛
-    {0x5E1C, 0xD6C4}, // 帜
-    {0x5E1D, 0xB5DB}, // 帝
-    {0x5E26, 0xB4F8}, // 带
-    {0x5E27, 0xD6A1}, // 帧
-    {0x5E2D, 0xCFAF}, // 席
-    {0x5E2E, 0xB0EF}, // 帮
-    {0x5E38, 0xB3A3}, // 常
-    {0x5E3D, 0xC3B1}, // 帽
-    {0x5E42, 0xC3DD}, // 幂
-    {0x5E45, 0xB7F9}, // 幅
-    {0x5E4C, 0xBBCF}, // 幌
-    {0x5E55, 0xC4BB}, // 幕
-    {0x5E62, 0xB4B1}, // 幢
-    {0x5E72, 0xB8C9}, // 干
-    {0x5E73, 0xC6BD}, // 平
-    {0x5E74, 0xC4EA}, // 年
-    {0x5E76, 0xB2A2}, // 并
-    {0x5E78, 0xD0D2}, // 幸
-    {0x5E7B, 0xBBC3}, // 幻
-    {0x5E7C, 0xD3D7}, // 幼
-    {0x5E7D, 0xD3C4}, // 幽
-    {0x5E7F, 0xB9E3}, // 广
-    {0x5E84, 0xD7AF}, // 庄
-    {0x5E86, 0xC7EC}, // 庆
-    {0x5E87, 0xB1D3}, // 庇
-    {0x5E8A, 0xB4B2}, // 床
-    {0x5E8F, 0xD0F2}, // 序
-    {0x5E90, 0xC2AE}, // 庐
-    {0x5E93, 0xBFE2}, // 库
-    {0x5E94, 0xD3A6}, // 应
-    {0x5E95, 0xB5D7}, // 底
-    {0x5E97, 0xB5EA}, // 店
-    {0x5E99, 0xC3ED}, // 庙
-    {0x5E9A, 0xB8FD}, // 庚
-    {0x5E9C, 0xB8AE}, // 府
-    {0x5E9E, 0xC5D3}, // 庞
-    {0x5E9F, 0xB7CF}, // 废
-    {0x5EA6, 0xB6C8}, // 度
-    {0x5EA7, 0xD7F9}, // 座
-    {0x5EAD, 0xCDA5}, // 庭
-    {0x5EB6, 0xCAFC}, // 庶
-    {0x5EB7, 0xBFB5}, // 康
-    {0x5EB8, 0xD3B9}, // 庸
-    {0x5EC9, 0xC1AE}, // 廉
-    {0x5ECA, 0xC0C8}, // 廊
-    {0x5ED3, 0xC0AA}, // 廓
-    {0x5ED6, 0xC1CE}, // 廖
-    {0x5EF6, 0xD1D3}, // 延
-    {0x5EF7, 0xCDA2}, // 廷
-    {0x5EFA, 0xBDA8}, // 建
-    {0x5F00, 0xBFAA}, // 开
-    {0x5F02, 0xD2EC}, // 异
-    {0x5F03, 0xC6FA}, // 弃
-    {0x5F04, 0xC5AA}, // 弄
-    {0x5F0A, 0xB1D7}, // 弊
-    {0x5F0F, 0xCABD}, // 式
-    {0x5F13, 0xB9AD}, // 弓
-    {0x5F15, 0xD2FD}, // 引
-    {0x5F17, 0xB8A5}, // 弗
-    {0x5F18, 0xBAEB}, // 弘
-    {0x5F1B, 0xB3DA}, // 弛
-    {0x5F1F, 0xB5DC}, // 弟
-    {0x5F20, 0xD5C5}, // 张
-    {0x5F25, 0xC3D6}, // 弥
-    {0x5F26, 0xCFD2}, // 弦
-    {0x5F27, 0xBBA1}, // 弧
-    {0x5F2F, 0xCDE4}, // 弯
-    {0x5F31, 0xC8F5}, // 弱
-    {0x5F39, 0xB5AF}, // 弹
-    {0x5F3A, 0xC7BF}, // 强
-    {0x5F52, 0xB9E9}, // 归
-    {0x5F53, 0xB5B1}, // 当
-    {0x5F55, 0xC2BC}, // 录
-    {0x5F5D, 0xD2CD}, // 彝
-    {0x5F62, 0xD0CE}, // 形
-    {0x5F64, 0xCDAE}, // 彤
-    {0x5F66, 0xD1E5}, // 彦
-    {0x5F69, 0xB2CA}, // 彩
-    {0x5F6A, 0xB1EB}, // 彪
-    {0x5F6C, 0xB1F2}, // 彬
-    {0x5F6D, 0xC5ED}, // 彭
-    {0x5F70, 0xD5C3}, // 彰
-    {0x5F71, 0xD3B0}, // 影
-    {0x5F79, 0xD2DB}, // 役
-    {0x5F7B, 0xB3B9}, // 彻
-    {0x5F7C, 0xB1CB}, // 彼
-    {0x5F80, 0xCDF9}, // 往
-    {0x5F81, 0xD5F7}, // 征
-    {0x5F84, 0xBEB6}, // 径
-    {0x5F85, 0xB4FD}, // 待
-    {0x5F88, 0xBADC}, // 很
-    {0x5F8A, 0xBBB2}, // 徊
-    {0x5F8B, 0xC2C9}, // 律
-    {0x5F90, 0xD0EC}, // 徐
-    {0x5F92, 0xCDBD}, // 徒
-    {0x5F97, 0xB5C3}, // 得
-    {0x5F98, 0xC5C7}, // 徘
-    {0x5FA1, 0xD3F9}, // 御
-    {0x5FAA, 0xD1AD}, // 循
-    {0x5FAE, 0xCEA2}, // 微
-    {0x5FB7, 0xB5C2}, // 德
-    {0x5FBD, 0xBBD5}, // 徽
-    {0x5FC3, 0xD0C4}, // 心
-    {0x5FC5, 0xB1D8}, // 必
-    {0x5FC6, 0xD2E4}, // 忆
-    {0x5FCC, 0xBCC9}, // 忌
-    {0x5FCD, 0xC8CC}, // 忍
-    {0x5FD7, 0xD6BE}, // 志
-    {0x5FD8, 0xCDFC}, // 忘
-    {0x5FD9, 0xC3A6}, // 忙
-    {0x5FE0, 0xD6D2}, // 忠
-    {0x5FE7, 0xD3C7}, // 忧
-    {0x5FEB, 0xBFEC}, // 快
-    {0x5FF1, 0xB3C0}, // 忱
-    {0x5FF5, 0xC4EE}, // 念
-    {0x5FFB, 0xD0C3}, // 忻
-    {0x5FFD, 0xBAF6}, // 忽
-    {0x5FFF, 0xB7DE}, // 忿
-    {0x6000, 0xBBB3}, // 怀
-    {0x6001, 0xCCAC}, // 态
-    {0x6002, 0xCBCB}, // 怂
-    {0x600E, 0xD4F5}, // 怎
-    {0x6012, 0xC5AD}, // 怒
-    {0x6014, 0xD5FA}, // 怔
-    {0x6015, 0xC5C2}, // 怕
-    {0x6016, 0xB2C0}, // 怖
-    {0x601C, 0xC1AF}, // 怜
-    {0x601D, 0xCBBC}, // 思
-    {0x6020, 0xB5A1}, // 怠
-    {0x6025, 0xBCB1}, // 急
-    {0x6027, 0xD0D4}, // 性
-    {0x6028, 0xD4B9}, // 怨
-    {0x602A, 0xB9D6}, // 怪
-    {0x602F, 0xC7D3}, // 怯
-    {0x603B, 0xD7DC}, // 总
-    {0x6043, 0xCAD1}, // 恃
-    {0x604B, 0xC1B5}, // 恋
-    {0x604D, 0xBBD0}, // 恍
-    {0x6050, 0xBFD6}, // 恐
-    {0x6052, 0xBAE3}, // 恒
-    {0x6055, 0xCBA1}, // 恕
-    {0x6062, 0xBBD6}, // 恢
-    {0x6064, 0xD0F4}, // 恤
-    {0x6068, 0xBADE}, // 恨
-    {0x6069, 0xB6F7}, // 恩
-    {0x606B, 0xB6B2}, // 恫
-    {0x606C, 0xCCF1}, // 恬
-    {0x606D, 0xB9A7}, // 恭
-    {0x606F, 0xCFA2}, // 息
-    {0x6073, 0xBFD2}, // 恳
-    {0x6076, 0xB6F1}, // 恶
-    {0x607C, 0xC4D5}, // 恼
-    {0x607F, 0xD3C1}, // 恿
-    {0x6084, 0xC7C4}, // 悄
-    {0x6089, 0xCFA4}, // 悉
-    {0x608D, 0xBAB7}, // 悍
-    {0x6094, 0xBBDA}, // 悔
-    {0x609F, 0xCEF2}, // 悟
-    {0x60A0, 0xD3C6}, // 悠
-    {0x60A3, 0xBBBC}, // 患
-    {0x60A6, 0xD4C3}, // 悦
-    {0x60A8, 0xC4FA}, // 您
-    {0x60AC, 0xD0FC}, // 悬
-    {0x60AF, 0xC3F5}, // 悯
-    {0x60B2, 0xB1AF}, // 悲
-    {0x60B8, 0xBCC2}, // 悸
-    {0x60BC, 0xB5BF}, // 悼
-    {0x60C5, 0xC7E9}, // 情
-    {0x60CA, 0xBEAA}, // 惊
-    {0x60CB, 0xCDEF}, // 惋
-    {0x60D1, 0xBBF3}, // 惑
-    {0x60D5, 0xCCE8}, // 惕
-    {0x60DC, 0xCFA7}, // 惜
-    {0x60DF, 0xCEA9}, // 惟
-    {0x60E0, 0xBBDD}, // 惠
-    {0x60E6, 0xB5EB}, // 惦
-    {0x60E7, 0xBEE5}, // 惧
-    {0x60E8, 0xB2D2}, // 惨
-    {0x60E9, 0xB3CD}, // 惩
-    {0x60EB, 0xB1B9}, // 惫
-    {0x60ED, 0xB2D1}, // 惭
-    {0x60EE, 0xB5AC}, // 惮
-    {0x60EF, 0xB9DF}, // 惯
-    {0x60F0, 0xB6E8}, // 惰
-    {0x60F3, 0xCFEB}, // 想
-    {0x60F6, 0xBBCC}, // 惶
-    {0x60F9, 0xC8C7}, // 惹
-    {0x60FA, 0xD0CA}, // 惺
-    {0x6101, 0xB3EE}, // 愁
-    {0x6108, 0xD3FA}, // 愈
-    {0x6109, 0xD3E4}, // 愉
-    {0x610F, 0xD2E2}, // 意
-    {0x611A, 0xD3DE}, // 愚
-    {0x611F, 0xB8D0}, // 感
-    {0x6124, 0xB7DF}, // 愤
-    {0x6127, 0xC0A2}, // 愧
-    {0x613F, 0xD4B8}, // 愿
-    {0x6148, 0xB4C8}, // 慈
-    {0x614C, 0xBBC5}, // 慌
-    {0x614E, 0xC9F7}, // 慎
-    {0x6151, 0xC9E5}, // 慑
-    {0x6155, 0xC4BD}, // 慕
-    {0x6162, 0xC2FD}, // 慢
-    {0x6167, 0xBBDB}, // 慧
-    {0x6168, 0xBFAE}, // 慨
-    {0x6170, 0xCEBF}, // 慰
-    {0x6177, 0xBFB6}, // 慷
-    {0x618B, 0xB1EF}, // 憋
-    {0x618E, 0xD4F7}, // 憎
-    {0x61A8, 0xBAA9}, // 憨
-    {0x61BE, 0xBAB6}, // 憾
-    {0x61C2, 0xB6AE}, // 懂
-    {0x61C8, 0xD0B8}, // 懈
-    {0x61CA, 0xB0C3}, // 懊
-    {0x61D2, 0xC0C1}, // 懒
-    {0x61E6, 0xC5B3}, // 懦
-    {0x6208, 0xB8EA}, // 戈
-    {0x620A, 0xCEEC}, // 戊
-    {0x620C, 0xD0E7}, // 戌
-    {0x620D, 0xCAF9}, // 戍
-    {0x620E, 0xC8D6}, // 戎
-    {0x620F, 0xCFB7}, // 戏
-    {0x6210, 0xB3C9}, // 成
-    {0x6211, 0xCED2}, // 我
-    {0x6212, 0xBDE4}, // 戒
-    {0x6216, 0xBBF2}, // 或
-    {0x6218, 0xD5BD}, // 战
-    {0x621A, 0xC6DD}, // 戚
-    {0x622A, 0xBDD8}, // 截
-    {0x622E, 0xC2BE}, // 戮
-    {0x6233, 0xB4C1}, // 戳
-    {0x6234, 0xB4F7}, // 戴
-    {0x6237, 0xBBA7}, // 户
-    {0x623F, 0xB7BF}, // 房
-    {0x6240, 0xCBF9}, // 所
-    {0x6241, 0xB1E2}, // 扁
-    {0x6247, 0xC9C8}, // 扇
-    {0x624B, 0xCAD6}, // 手
-    {0x624D, 0xB2C5}, // 才
-    {0x624E, 0xD4FA}, // 扎
-    {0x6251, 0xC6CB}, // 扑
-    {0x6252, 0xB0C7}, // 扒
-    {0x6253, 0xB4F2}, // 打
-    {0x6254, 0xC8D3}, // 扔
-    {0x6258, 0xCDD0}, // 托
-    {0x625B, 0xBFB8}, // 扛
-    {0x6263, 0xBFDB}, // 扣
-    {0x6266, 0xC7A4}, // 扦
-    {0x6267, 0xD6B4}, // 执
-    {0x6269, 0xC0A9}, // 扩
-    {0x626B, 0xC9A8}, // 扫
-    {0x626C, 0xD1EF}, // 扬
-    {0x626D, 0xC5A4}, // 扭
-    {0x626E, 0xB0E7}, // 扮
-    {0x626F, 0xB3B6}, // 扯
-    {0x6270, 0xC8C5}, // 扰
-    {0x6273, 0xB0E2}, // 扳
-    {0x6276, 0xB7F6}, // 扶
-    {0x6279, 0xC5FA}, // 批
-    {0x627C, 0xB6F3}, // 扼
-    {0x627E, 0xD5D2}, // 找
-    {0x627F, 0xB3D0}, // 承
-    {0x6280, 0xBCBC}, // 技
-    {0x6284, 0xB3AD}, // 抄
-    {0x6289, 0xBEF1}, // 抉
-    {0x628A, 0xB0D1}, // 把
-    {0x6291, 0xD2D6}, // 抑
-    {0x6292, 0xCAE3}, // 抒
-    {0x6293, 0xD7A5}, // 抓
-    {0x6295, 0xCDB6}, // 投
-    {0x6296, 0xB6B6}, // 抖
-    {0x6297, 0xBFB9}, // 抗
-    {0x6298, 0xD5DB}, // 折
-    {0x629A, 0xB8A7}, // 抚
-    {0x629B, 0xC5D7}, // 抛
-    {0x62A0, 0xBFD9}, // 抠
-    {0x62A1, 0xC2D5}, // 抡
-    {0x62A2, 0xC7C0}, // 抢
-    {0x62A4, 0xBBA4}, // 护
-    {0x62A5, 0xB1A8}, // 报
-    {0x62A8, 0xC5EA}, // 抨
-    {0x62AB, 0xC5FB}, // 披
-    {0x62AC, 0xCCA7}, // 抬
-    {0x62B1, 0xB1A7}, // 抱
-    {0x62B5, 0xB5D6}, // 抵
-    {0x62B9, 0xC4A8}, // 抹
-    {0x62BC, 0xD1BA}, // 押
-    {0x62BD, 0xB3E9}, // 抽
-    {0x62BF, 0xC3F2}, // 抿
-    {0x62C2, 0xB7F7}, // 拂
-    {0x62C4, 0xD6F4}, // 拄
-    {0x62C5, 0xB5A3}, // 担
-    {0x62C6, 0xB2F0}, // 拆
-    {0x62C7, 0xC4B4}, // 拇
-    {0x62C8, 0xC4E9}, // 拈
-    {0x62C9, 0xC0AD}, // 拉
-    {0x62CC, 0xB0E8}, // 拌
-    {0x62CD, 0xC5C4}, // 拍
-    {0x62CE, 0xC1E0}, // 拎
-    {0x62D0, 0xB9D5}, // 拐
-    {0x62D2, 0xBEDC}, // 拒
-    {0x62D3, 0xCDD8}, // 拓
-    {0x62D4, 0xB0CE}, // 拔
-    {0x62D6, 0xCDCF}, // 拖
-    {0x62D8, 0xBED0}, // 拘
-    {0x62D9, 0xD7BE}, // 拙
-    {0x62DB, 0xD5D0}, // 招
-    {0x62DC, 0xB0DD}, // 拜
-    {0x62DF, 0xC4E2}, // 拟
-    {0x62E2, 0xC2A3}, // 拢
-    {0x62E3, 0xBCF0}, // 拣
-    {0x62E5, 0xD3B5}, // 拥
-    {0x62E6, 0xC0B9}, // 拦
-    {0x62E7, 0xC5A1}, // 拧
-    {0x62E8, 0xB2A6}, // 拨
-    {0x62E9, 0xD4F1}, // 择
-    {0x62EC, 0xC0A8}, // 括
-    {0x62ED, 0xCAC3}, // 拭
-    {0x62EF, 0xD5FC}, // 拯
-    {0x62F1, 0xB9B0}, // 拱
-    {0x62F3, 0xC8AD}, // 拳
-    {0x62F4, 0xCBA9}, // 拴
-    {0x62F7, 0xBFBD}, // 拷
-    {0x62FC, 0xC6B4}, // 拼
-    {0x62FD, 0xD7A7}, // 拽
-    {0x62FE, 0xCAB0}, // 拾
-    {0x62FF, 0xC4C3}, // 拿
-    {0x6301, 0xB3D6}, // 持
-    {0x6302, 0xB9D2}, // 挂
-    {0x6307, 0xD6B8}, // 指
-    {0x6309, 0xB0B4}, // 按
-    {0x630E, 0xBFE6}, // 挎
-    {0x6311, 0xCCF4}, // 挑
-    {0x6316, 0xCDDA}, // 挖
-    {0x631A, 0xD6BF}, // 挚
-    {0x631B, 0xC2CE}, // 挛
-    {0x631D, 0xCECE}, // 挝
-    {0x631E, 0xCCA2}, // 挞
-    {0x631F, 0xD0AE}, // 挟
-    {0x6320, 0xC4D3}, // 挠
-    {0x6321, 0xB5B2}, // 挡
-    {0x6323, 0xD5F5}, // 挣
-    {0x6324, 0xBCB7}, // 挤
-    {0x6325, 0xBBD3}, // 挥
-    {0x6328, 0xB0A4}, // 挨
-    {0x632A, 0xC5B2}, // 挪
-    {0x632B, 0xB4EC}, // 挫
-    {0x632F, 0xD5F1}, // 振
-    {0x633D, 0xCDEC}, // 挽
-    {0x6342, 0xCEE6}, // 捂
-    {0x6345, 0xCDB1}, // 捅
-    {0x6346, 0xC0A6}, // 捆
-    {0x6349, 0xD7BD}, // 捉
-    {0x634C, 0xB0C6}, // 捌
-    {0x634D, 0xBAB4}, // 捍
-    {0x634E, 0xC9D3}, // 捎
-    {0x634F, 0xC4F3}, // 捏
-    {0x6350, 0xBEE8}, // 捐
-    {0x6355, 0xB2B6}, // 捕
-    {0x635E, 0xC0CC}, // 捞
-    {0x635F, 0xCBF0}, // 损
-    {0x6361, 0xBCF1}, // 捡
-    {0x6362, 0xBBBB}, // 换
-    {0x6363, 0xB5B7}, // 捣
-    {0x6367, 0xC5F5}, // 捧
-    {0x636E, 0xBEDD}, // 据
-    {0x6376, 0xB4B7}, // 捶
-    {0x6377, 0xBDDD}, // 捷
-    {0x637B, 0xC4ED}, // 捻
-    {0x6380, 0xCFC6}, // 掀
-    {0x6382, 0xB5E0}, // 掂
-    {0x6387, 0xB6DE}, // 掇
-    {0x6388, 0xCADA}, // 授
-    {0x6389, 0xB5F4}, // 掉
-    {0x638C, 0xD5C6}, // 掌
-    {0x638F, 0xCCCD}, // 掏
-    {0x6390, 0xC6FE}, // 掐
-    {0x6392, 0xC5C5}, // 排
-    {0x6396, 0xD2B4}, // 掖
-    {0x6398, 0xBEF2}, // 掘
-    {0x63A0, 0xC2D3}, // 掠
-    {0x63A2, 0xCCBD}, // 探
-    {0x63A3, 0xB3B8}, // 掣
-    {0x63A5, 0xBDD3}, // 接
-    {0x63A7, 0xBFD8}, // 控
-    {0x63A8, 0xCDC6}, // 推
-    {0x63A9, 0xD1DA}, // 掩
-    {0x63AA, 0xB4EB}, // 措
-    {0x63B3, 0xC2B0}, // 掳
-    {0x63B7, 0xD6C0}, // 掷
-    {0x63B8, 0xB5A7}, // 掸
-    {0x63BA, 0xB2F4}, // 掺
-    {0x63C9, 0xC8E0}, // 揉
-    {0x63CD, 0xD7E1}, // 揍
-    {0x63CF, 0xC3E8}, // 描
-    {0x63D0, 0xCCE1}, // 提
-    {0x63D2, 0xB2E5}, // 插
-    {0x63D6, 0xD2BE}, // 揖
-    {0x63E1, 0xCED5}, // 握
-    {0x63E3, 0xB4A7}, // 揣
-    {0x63E9, 0xBFAB}, // 揩
-    {0x63EA, 0xBEBE}, // 揪
-    {0x63ED, 0xBDD2}, // 揭
-    {0x63F4, 0xD4AE}, // 援
-    {0x63FD, 0xC0BF}, // 揽
-    {0x6400, 0xB2F3}, // 搀
-    {0x6401, 0xB8E9}, // 搁
-    {0x6402, 0xC2A7}, // 搂
-    {0x6405, 0xBDC1}, // 搅
-    {0x640F, 0xB2AB}, // 搏
-    {0x6410, 0xB4A4}, // 搐
-    {0x6413, 0xB4EA}, // 搓
-    {0x6414, 0xC9A6}, // 搔
-    {0x641C, 0xCBD1}, // 搜
-    {0x641E, 0xB8E3}, // 搞
-    {0x642A, 0xCCC2}, // 搪
-    {0x642C, 0xB0E1}, // 搬
-    {0x642D, 0xB4EE}, // 搭
-    {0x643A, 0xD0AF}, // 携
-    {0x643D, 0xB2EB}, // 搽
-    {0x6444, 0xC9E3}, // 摄
-    {0x6446, 0xB0DA}, // 摆
-    {0x6447, 0xD2A1}, // 摇
-    {0x6448, 0xB1F7}, // 摈
-    {0x644A, 0xCCAF}, // 摊
-    {0x6454, 0xCBA4}, // 摔
-    {0x6458, 0xD5AA}, // 摘
-    {0x6467, 0xB4DD}, // 摧
-    {0x6469, 0xC4A6}, // 摩
-    {0x6478, 0xC3FE}, // 摸
-    {0x6479, 0xC4A1}, // 摹
-    {0x6482, 0xC1CC}, // 撂
-    {0x6485, 0xBEEF}, // 撅
-    {0x6487, 0xC6B2}, // 撇
-    {0x6491, 0xB3C5}, // 撑
-    {0x6492, 0xC8F6}, // 撒
-    {0x6495, 0xCBBA}, // 撕
-    {0x649E, 0xD7B2}, // 撞
-    {0x64A4, 0xB3B7}, // 撤
-    {0x64A9, 0xC1C3}, // 撩
-    {0x64AC, 0xC7CB}, // 撬
-    {0x64AD, 0xB2A5}, // 播
-    {0x64AE, 0xB4E9}, // 撮
-    {0x64B0, 0xD7AB}, // 撰
-    {0x64B5, 0xC4EC}, // 撵
-    {0x64BC, 0xBAB3}, // 撼
-    {0x64C2, 0xC0DE}, // 擂
-    {0x64C5, 0xC9C3}, // 擅
-    {0x64CD, 0xB2D9}, // 操
-    {0x64CE, 0xC7E6}, // 擎
-    {0x64D2, 0xC7DC}, // 擒
-    {0x64DE, 0xCBD3}, // 擞
-    {0x64E6, 0xB2C1}, // 擦
-    {0x6500, 0xC5CA}, // 攀
-    {0x6512, 0xD4DC}, // 攒
-    {0x6518, 0xC8C1}, // 攘
-    {0x652B, 0xBEF0}, // 攫
-    {0x652F, 0xD6A7}, // 支
-    {0x6536, 0xCAD5}, // 收
-    {0x6539, 0xB8C4}, // 改
-    {0x653B, 0xB9A5}, // 攻
-    {0x653E, 0xB7C5}, // 放
-    {0x653F, 0xD5FE}, // 政
-    {0x6545, 0xB9CA}, // 故
-    {0x6548, 0xD0A7}, // 效
-    {0x654C, 0xB5D0}, // 敌
-    {0x654F, 0xC3F4}, // 敏
-    {0x6551, 0xBEC8}, // 救
-    {0x6556, 0xB0BD}, // 敖
-    {0x6559, 0xBDCC}, // 教
-    {0x655B, 0xC1B2}, // 敛
-    {0x655D, 0xB1D6}, // 敝
-    {0x655E, 0xB3A8}, // 敞
-    {0x6562, 0xB8D2}, // 敢
-    {0x6563, 0xC9A2}, // 散
-    {0x6566, 0xB6D8}, // 敦
-    {0x656C, 0xBEB4}, // 敬
-    {0x6570, 0xCAFD}, // 数
-    {0x6572, 0xC7C3}, // 敲
-    {0x6574, 0xD5FB}, // 整
-    {0x6577, 0xB7F3}, // 敷
-    {0x6587, 0xCEC4}, // 文
-    {0x658B, 0xD5AB}, // 斋
-    {0x658C, 0xB1F3}, // 斌
-    {0x6591, 0xB0DF}, // 斑
-    {0x6597, 0xB6B7}, // 斗
-    {0x6599, 0xC1CF}, // 料
-    {0x659C, 0xD0B1}, // 斜
-    {0x659F, 0xD5E5}, // 斟
-    {0x65A1, 0xCED3}, // 斡
-    {0x65A4, 0xBDEF}, // 斤
-    {0x65A5, 0xB3E2}, // 斥
-    {0x65A7, 0xB8AB}, // 斧
-    {0x65A9, 0xD5B6}, // 斩
-    {0x65AD, 0xB6CF}, // 断
-    {0x65AF, 0xCBB9}, // 斯
-    {0x65B0, 0xD0C2}, // 新
-    {0x65B9, 0xB7BD}, // 方
-    {0x65BD, 0xCAA9}, // 施
-    {0x65C1, 0xC5D4}, // 旁
-    {0x65C5, 0xC2C3}, // 旅
-    {0x65CB, 0xD0FD}, // 旋
-    {0x65CF, 0xD7E5}, // 族
-    {0x65D7, 0xC6EC}, // 旗
-    {0x65E0, 0xCEDE}, // 无
-    {0x65E2, 0xBCC8}, // 既
-    {0x65E5, 0xC8D5}, // 日
-    {0x65E6, 0xB5A9}, // 旦
-    {0x65E7, 0xBEC9}, // 旧
-    {0x65E8, 0xD6BC}, // 旨
-    {0x65E9, 0xD4E7}, // 早
-    {0x65EC, 0xD1AE}, // 旬
-    {0x65ED, 0xD0F1}, // 旭
-    {0x65F1, 0xBAB5}, // 旱
-    {0x65F6, 0xCAB1}, // 时
-    {0x65F7, 0xBFF5}, // 旷
-    {0x65FA, 0xCDFA}, // 旺
-    {0x6602, 0xB0BA}, // 昂
-    {0x6606, 0xC0A5}, // 昆
-    {0x660C, 0xB2FD}, // 昌
-    {0x660E, 0xC3F7}, // 明
-    {0x660F, 0xBBE8}, // 昏
-    {0x6613, 0xD2D7}, // 易
-    {0x6614, 0xCEF4}, // 昔
-    {0x661F, 0xD0C7}, // 星
-    {0x6620, 0xD3B3}, // 映
-    {0x6625, 0xB4BA}, // 春
-    {0x6627, 0xC3C1}, // 昧
-    {0x6628, 0xD7F2}, // 昨
-    {0x662D, 0xD5D1}, // 昭
-    {0x662F, 0xCAC7}, // 是
-    {0x663C, 0xD6E7}, // 昼
-    {0x663E, 0xCFD4}, // 显
-    {0x6643, 0xBBCE}, // 晃
-    {0x664B, 0xBDFA}, // 晋
-    {0x664C, 0xC9CE}, // 晌
-    {0x6652, 0xC9B9}, // 晒
-    {0x6653, 0xCFFE}, // 晓
-    {0x6655, 0xD4CE}, // 晕
-    {0x665A, 0xCDED}, // 晚
-    {0x6664, 0xCEEE}, // 晤
-    {0x6666, 0xBBDE}, // 晦
-    {0x6668, 0xB3BF}, // 晨
-    {0x666E, 0xC6D5}, // 普
-    {0x666F, 0xBEB0}, // 景
-    {0x6670, 0xCEFA}, // 晰
-    {0x6674, 0xC7E7}, // 晴
-    {0x6676, 0xBEA7}, // 晶
-    {0x667A, 0xD6C7}, // 智
-    {0x667E, 0xC1C0}, // 晾
-    {0x6682, 0xD4DD}, // 暂
-    {0x6687, 0xCFBE}, // 暇
-    {0x6691, 0xCAEE}, // 暑
-    {0x6696, 0xC5AF}, // 暖
-    {0x6697, 0xB0B5}, // 暗
-    {0x66AE, 0xC4BA}, // 暮
-    {0x66B4, 0xB1A9}, // 暴
-    {0x66D9, 0xCAEF}, // 曙
-    {0x66DD, 0xC6D8}, // 曝
-    {0x66F0, 0xD4BB}, // 曰
-    {0x66F2, 0xC7FA}, // 曲
-    {0x66F3, 0xD2B7}, // 曳
-    {0x66F4, 0xB8FC}, // 更
-    {0x66F9, 0xB2DC}, // 曹
-    {0x66FC, 0xC2FC}, // 曼
-    {0x66FE, 0xD4F8}, // 曾
-    {0x66FF, 0xCCE6}, // 替
-    {0x6700, 0xD7EE}, // 最
-    {0x6708, 0xD4C2}, // 月
-    {0x6709, 0xD3D0}, // 有
-    {0x670B, 0xC5F3}, // 朋
-    {0x670D, 0xB7FE}, // 服
-    {0x6714, 0xCBB7}, // 朔
-    {0x6717, 0xC0CA}, // 朗
-    {0x671B, 0xCDFB}, // 望
-    {0x671D, 0xB3AF}, // 朝
-    {0x671F, 0xC6DA}, // 期
-    {0x6728, 0xC4BE}, // 木
-    {0x672A, 0xCEB4}, // 未
-    {0x672B, 0xC4A9}, // 末
-    {0x672C, 0xB1BE}, // 本
-    {0x672D, 0xD4FD}, // 札
-    {0x672F, 0xCAF5}, // 术
-    {0x6731, 0xD6EC}, // 朱
-    {0x6734, 0xC6D3}, // 朴
-    {0x6735, 0xB6E4}, // 朵
-    {0x673A, 0xBBFA}, // 机
-    {0x673D, 0xD0E0}, // 朽
-    {0x6740, 0xC9B1}, // 杀
-    {0x6742, 0xD4D3}, // 杂
-    {0x6743, 0xC8A8}, // 权
-    {0x6746, 0xB8CB}, // 杆
-    {0x6749, 0xC9BC}, // 杉
-    {0x674E, 0xC0EE}, // 李
-    {0x674F, 0xD0D3}, // 杏
-    {0x6750, 0xB2C4}, // 材
-    {0x6751, 0xB4E5}, // 村
-    {0x6756, 0xD5C8}, // 杖
-    {0x675C, 0xB6C5}, // 杜
-    {0x675F, 0xCAF8}, // 束
-    {0x6760, 0xB8DC}, // 杠
-    {0x6761, 0xCCF5}, // 条
-    {0x6765, 0xC0B4}, // 来
-    {0x6768, 0xD1EE}, // 杨
-    {0x676D, 0xBABC}, // 杭
-    {0x676F, 0xB1AD}, // 杯
-    {0x6770, 0xBDDC}, // 杰
-    {0x677E, 0xCBC9}, // 松
-    {0x677F, 0xB0E5}, // 板
-    {0x6781, 0xBCAB}, // 极
-    {0x6784, 0xB9B9}, // 构
-    {0x6789, 0xCDF7}, // 枉
-    {0x6790, 0xCEF6}, // 析
-    {0x6795, 0xD5ED}, // 枕
-    {0x6797, 0xC1D6}, // 林
-    {0x679A, 0xC3B6}, // 枚
-    {0x679C, 0xB9FB}, // 果
-    {0x679D, 0xD6A6}, // 枝
-    {0x67A2, 0xCAE0}, // 枢
-    {0x67A3, 0xD4E6}, // 枣
-    {0x67AA, 0xC7B9}, // 枪
-    {0x67AB, 0xB7E3}, // 枫
-    {0x67AF, 0xBFDD}, // 枯
-    {0x67B6, 0xBCDC}, // 架
-    {0x67B7, 0xBCCF}, // 枷
-    {0x67C4, 0xB1FA}, // 柄
-    {0x67CF, 0xB0D8}, // 柏
-    {0x67D0, 0xC4B3}, // 某
-    {0x67D1, 0xB8CC}, // 柑
-    {0x67D2, 0xC6E2}, // 柒
-    {0x67D3, 0xC8BE}, // 染
-    {0x67D4, 0xC8E1}, // 柔
-    {0x67DC, 0xB9F1}, // 柜
-    {0x67DE, 0xD7F5}, // 柞
-    {0x67E0, 0xC4FB}, // 柠
-    {0x67E5, 0xB2E9}, // 查
-    {0x67EC, 0xBCED}, // 柬
-    {0x67EF, 0xBFC2}, // 柯
-    {0x67F1, 0xD6F9}, // 柱
-    {0x67F3, 0xC1F8}, // 柳
-    {0x67F4, 0xB2F1}, // 柴
-    {0x67FF, 0xCAC1}, // 柿
-    {0x6805, 0xD5A4}, // 栅
-    {0x6807, 0xB1EA}, // 标
-    {0x6808, 0xD5BB}, // 栈
-    {0x680B, 0xB6B0}, // 栋
-    {0x680F, 0xC0B8}, // 栏
-    {0x6811, 0xCAF7}, // 树
-    {0x6813, 0xCBA8}, // 栓
-    {0x6816, 0xC6DC}, // 栖
-    {0x6817, 0xC0F5}, // 栗
-    {0x6821, 0xD0A3}, // 校
-    {0x682A, 0xD6EA}, // 株
-    {0x6837, 0xD1F9}, // 样
-    {0x6838, 0xBACB}, // 核
-    {0x6839, 0xB8F9}, // 根
-    {0x683C, 0xB8F1}, // 格
-    {0x683D, 0xD4D4}, // 栽
-    {0x6842, 0xB9F0}, // 桂
-    {0x6843, 0xCCD2}, // 桃
-    {0x6845, 0xCEA6}, // 桅
-    {0x6846, 0xBFF2}, // 框
-    {0x6848, 0xB0B8}, // 案
-    {0x684C, 0xD7C0}, // 桌
-    {0x6850, 0xCDA9}, // 桐
-    {0x6851, 0xC9A3}, // 桑
-    {0x6853, 0xBBB8}, // 桓
-    {0x6854, 0xBDDB}, // 桔
-    {0x6863, 0xB5B5}, // 档
-    {0x6865, 0xC7C5}, // 桥
-    {0x6868, 0xBDB0}, // 桨
-    {0x6869, 0xD7AE}, // 桩
-    {0x6876, 0xCDB0}, // 桶
-    {0x6881, 0xC1BA}, // 梁
-    {0x6885, 0xC3B7}, // 梅
-    {0x6886, 0xB0F0}, // 梆
-    {0x6897, 0xB9A3}, // 梗
-    {0x68A2, 0xC9D2}, // 梢
-    {0x68A6, 0xC3CE}, // 梦
-    {0x68A7, 0xCEE0}, // 梧
-    {0x68A8, 0xC0E6}, // 梨
-    {0x68AD, 0xCBF3}, // 梭
-    {0x68AF, 0xCCDD}, // 梯
-    {0x68B0, 0xD0B5}, // 械
-    {0x68B3, 0xCAE1}, // 梳
-    {0x68C0, 0xBCEC}, // 检
-    {0x68C9, 0xC3DE}, // 棉
-    {0x68CB, 0xC6E5}, // 棋
-    {0x68CD, 0xB9F7}, // 棍
-    {0x68D2, 0xB0F4}, // 棒
-    {0x68D5, 0xD7D8}, // 棕
-    {0x68D8, 0xBCAC}, // 棘
-    {0x68DA, 0xC5EF}, // 棚
-    {0x68E0, 0xCCC4}, // 棠
-    {0x68EE, 0xC9AD}, // 森
-    {0x68F1, 0xC0E2}, // 棱
-    {0x68F5, 0xBFC3}, // 棵
-    {0x68FA, 0xB9D7}, // 棺
-    {0x6905, 0xD2CE}, // 椅
-    {0x690D, 0xD6B2}, // 植
-    {0x690E, 0xD7B5}, // 椎
-    {0x6912, 0xBDB7}, // 椒
-    {0x692D, 0xCDD6}, // 椭
-    {0x6930, 0xD2AC}, // 椰
-    {0x693D, 0xB4AA}, // 椽
-    {0x693F, 0xB4BB}, // 椿
-    {0x6954, 0xD0A8}, // 楔
-    {0x695A, 0xB3FE}, // 楚
-    {0x695E, 0xC0E3}, // 楞
-    {0x6977, 0xBFAC}, // 楷
-    {0x697C, 0xC2A5}, // 楼
-    {0x6982, 0xB8C5}, // 概
-    {0x6986, 0xD3DC}, // 榆
-    {0x6994, 0xC0C6}, // 榔
-    {0x699C, 0xB0F1}, // 榜
-    {0x69A8, 0xD5A5}, // 榨
-    {0x69B4, 0xC1F1}, // 榴
-    {0x69B7, 0xC8B6}, // 榷
-    {0x69D0, 0xBBB1}, // 槐
-    {0x69DB, 0xBCF7}, // 槛
-    {0x69FD, 0xB2DB}, // 槽
-    {0x6A0A, 0xB7AE}, // 樊
-    {0x6A1F, 0xD5C1}, // 樟
-    {0x6A21, 0xC4A3}, // 模
-    {0x6A2A, 0xBAE1}, // 横
-    {0x6A31, 0xD3A3}, // 樱
-    {0x6A47, 0xC7C1}, // 橇
-    {0x6A59, 0xB3C8}, // 橙
-    {0x6A61, 0xCFF0}, // 橡
-    {0x6A71, 0xB3F7}, // 橱
-    {0x6A80, 0xCCB4}, // 檀
-    {0x6A84, 0xCFAD}, // 檄
-    {0x6AAC, 0xC3CA}, // 檬
-    {0x6B20, 0xC7B7}, // 欠
-    {0x6B21, 0xB4CE}, // 次
-    {0x6B22, 0xBBB6}, // 欢
-    {0x6B23, 0xD0C0}, // 欣
-    {0x6B27, 0xC5B7}, // 欧
-    {0x6B32, 0xD3FB}, // 欲
-    {0x6B3A, 0xC6DB}, // 欺
-    {0x6B3E, 0xBFEE}, // 款
-    {0x6B47, 0xD0AA}, // 歇
-    {0x6B49, 0xC7B8}, // 歉
-    {0x6B4C, 0xB8E8}, // 歌
-    {0x6B62, 0xD6B9}, // 止
-    {0x6B63, 0xD5FD}, // 正
-    {0x6B64, 0xB4CB}, // 此
-    {0x6B65, 0xB2BD}, // 步
-    {0x6B66, 0xCEE4}, // 武
-    {0x6B67, 0xC6E7}, // 歧
-    {0x6B6A, 0xCDE1}, // 歪
-    {0x6B79, 0xB4F5}, // 歹
-    {0x6B7B, 0xCBC0}, // 死
-    {0x6B7C, 0xBCDF}, // 歼
-    {0x6B83, 0xD1EA}, // 殃
-    {0x6B86, 0xB4F9}, // 殆
-    {0x6B89, 0xD1B3}, // 殉
-    {0x6B8A, 0xCAE2}, // 殊
-    {0x6B8B, 0xB2D0}, // 残
-    {0x6B96, 0xD6B3}, // 殖
-    {0x6BB4, 0xC5B9}, // 殴
-    {0x6BB5, 0xB6CE}, // 段
-    {0x6BB7, 0xD2F3}, // 殷
-    {0x6BBF, 0xB5EE}, // 殿
-    {0x6BC1, 0xBBD9}, // 毁
-    {0x6BC5, 0xD2E3}, // 毅
-    {0x6BCB, 0xCEE3}, // 毋
-    {0x6BCD, 0xC4B8}, // 母
-    {0x6BCF, 0xC3BF}, // 每
-    {0x6BD2, 0xB6BE}, // 毒
-    {0x6BD4, 0xB1C8}, // 比
-    {0x6BD5, 0xB1CF}, // 毕
-    {0x6BD6, 0xB1D1}, // 毖
-    {0x6BD7, 0xC5FE}, // 毗
-    {0x6BD9, 0xB1D0}, // 毙
-    {0x6BDB, 0xC3AB}, // 毛
-    {0x6BE1, 0xD5B1}, // 毡
-    {0x6BEB, 0xBAC1}, // 毫
-    {0x6BEF, 0xCCBA}, // 毯
-    {0x6C0F, 0xCACF}, // 氏
-    {0x6C11, 0xC3F1}, // 民
-    {0x6C13, 0xC3A5}, // 氓
-    {0x6C14, 0xC6F8}, // 气
-    {0x6C16, 0xC4CA}, // 氖
-    {0x6C1B, 0xB7D5}, // 氛
-    {0x6C1F, 0xB7FA}, // 氟
-    {0x6C22, 0xC7E2}, // 氢
-    {0x6C26, 0xBAA4}, // 氦
-    {0x6C27, 0xD1F5}, // 氧
-    {0x6C28, 0xB0B1}, // 氨
-    {0x6C2E, 0xB5AA}, // 氮
-    {0x6C2F, 0xC2C8}, // 氯
-    {0x6C30, 0xC7E8}, // 氰
-    {0x6C34, 0xCBAE}, // 水
-    {0x6C38, 0xD3C0}, // 永
-    {0x6C40, 0xCDA1}, // 汀
-    {0x6C41, 0xD6AD}, // 汁
-    {0x6C42, 0xC7F3}, // 求
-    {0x6C47, 0xBBE3}, // 汇
-    {0x6C49, 0xBABA}, // 汉
-    {0x6C50, 0xCFAB}, // 汐
-    {0x6C55, 0xC9C7}, // 汕
-    {0x6C57, 0xBAB9}, // 汗
-    {0x6C5B, 0xD1B4}, // 汛
-    {0x6C5D, 0xC8EA}, // 汝
-    {0x6C5E, 0xB9AF}, // 汞
-    {0x6C5F, 0xBDAD}, // 江
-    {0x6C60, 0xB3D8}, // 池
-    {0x6C61, 0xCEDB}, // 污
-    {0x6C64, 0xCCC0}, // 汤
-    {0x6C6A, 0xCDF4}, // 汪
-    {0x6C70, 0xCCAD}, // 汰
-    {0x6C72, 0xBCB3}, // 汲
-    {0x6C79, 0xD0DA}, // 汹
-    {0x6C7D, 0xC6FB}, // 汽
-    {0x6C7E, 0xB7DA}, // 汾
-    {0x6C81, 0xC7DF}, // 沁
-    {0x6C82, 0xD2CA}, // 沂
-    {0x6C83, 0xCED6}, // 沃
-    {0x6C88, 0xC9F2}, // 沈
-    {0x6C89, 0xB3C1}, // 沉
-    {0x6C8F, 0xC6E3}, // 沏
-    {0x6C99, 0xC9B3}, // 沙
-    {0x6C9B, 0xC5E6}, // 沛
-    {0x6C9F, 0xB9B5}, // 沟
-    {0x6CA1, 0xC3BB}, // 没
-    {0x6CA4, 0xC5BD}, // 沤
-    {0x6CA5, 0xC1A4}, // 沥
-    {0x6CA6, 0xC2D9}, // 沦
-    {0x6CA7, 0xB2D7}, // 沧
-    {0x6CAA, 0xBBA6}, // 沪
-    {0x6CAB, 0xC4AD}, // 沫
-    {0x6CAE, 0xBEDA}, // 沮
-    {0x6CB3, 0xBAD3}, // 河
-    {0x6CB8, 0xB7D0}, // 沸
-    {0x6CB9, 0xD3CD}, // 油
-    {0x6CBB, 0xD6CE}, // 治
-    {0x6CBC, 0xD5D3}, // 沼
-    {0x6CBD, 0xB9C1}, // 沽
-    {0x6CBE, 0xD5B4}, // 沾
-    {0x6CBF, 0xD1D8}, // 沿
-    {0x6CC4, 0xD0B9}, // 泄
-    {0x6CC5, 0xC7F6}, // 泅
-    {0x6CC9, 0xC8AA}, // 泉
-    {0x6CCA, 0xB2B4}, // 泊
-    {0x6CCC, 0xC3DA}, // 泌
-    {0x6CD5, 0xB7A8}, // 法
-    {0x6CDB, 0xB7BA}, // 泛
-    {0x6CDE, 0xC5A2}, // 泞
-    {0x6CE1, 0xC5DD}, // 泡
-    {0x6CE2, 0xB2A8}, // 波
-    {0x6CE3, 0xC6FC}, // 泣
-    {0x6CE5, 0xC4E0}, // 泥
-    {0x6CE8, 0xD7A2}, // 注
-    {0x6CEA, 0xC0E1}, // 泪
-    {0x6CF0, 0xCCA9}, // 泰
-    {0x6CF3, 0xD3BE}, // 泳
-    {0x6CF5, 0xB1C3}, // 泵
-    {0x6CFB, 0xD0BA}, // 泻
-    {0x6CFC, 0xC6C3}, // 泼
-    {0x6CFD, 0xD4F3}, // 泽
-    {0x6D01, 0xBDE0}, // 洁
-    {0x6D0B, 0xD1F3}, // 洋
-    {0x6D12, 0xC8F7}, // 洒
-    {0x6D17, 0xCFB4}, // 洗
-    {0x6D1B, 0xC2E5}, // 洛
-    {0x6D1E, 0xB6B4}, // 洞
-    {0x6D25, 0xBDF2}, // 津
-    {0x6D2A, 0xBAE9}, // 洪
-    {0x6D31, 0xB6FD}, // 洱
-    {0x6D32, 0xD6DE}, // 洲
-    {0x6D3B, 0xBBEE}, // 活
-    {0x6D3C, 0xCDDD}, // 洼
-    {0x6D3D, 0xC7A2}, // 洽
-    {0x6D3E, 0xC5C9}, // 派
-    {0x6D41, 0xC1F7}, // 流
-    {0x6D45, 0xC7B3}, // 浅
-    {0x6D46, 0xBDAC}, // 浆
-    {0x6D47, 0xBDBD}, // 浇
-    {0x6D4A, 0xD7C7}, // 浊
-    {0x6D4B, 0xB2E2}, // 测
-    {0x6D4E, 0xBCC3}, // 济
-    {0x6D51, 0xBBEB}, // 浑
-    {0x6D53, 0xC5A8}, // 浓
-    {0x6D59, 0xD5E3}, // 浙
-    {0x6D5A, 0xBFA3}, // 浚
-    {0x6D66, 0xC6D6}, // 浦
-    {0x6D69, 0xBAC6}, // 浩
-    {0x6D6A, 0xC0CB}, // 浪
-    {0x6D6E, 0xB8A1}, // 浮
-    {0x6D74, 0xD4A1}, // 浴
-    {0x6D77, 0xBAA3}, // 海
-    {0x6D78, 0xBDFE}, // 浸
-    {0x6D82, 0xCDBF}, // 涂
-    {0x6D85, 0xC4F9}, // 涅
-    {0x6D88, 0xCFFB}, // 消
-    {0x6D89, 0xC9E6}, // 涉
-    {0x6D8C, 0xD3BF}, // 涌
-    {0x6D8E, 0xCFD1}, // 涎
-    {0x6D95, 0xCCE9}, // 涕
-    {0x6D9B, 0xCCCE}, // 涛
-    {0x6D9D, 0xC0D4}, // 涝
-    {0x6D9F, 0xC1B0}, // 涟
-    {0x6DA1, 0xCED0}, // 涡
-    {0x6DA3, 0xBBC1}, // 涣
-    {0x6DA4, 0xB5D3}, // 涤
-    {0x6DA6, 0xC8F3}, // 润
-    {0x6DA7, 0xBDA7}, // 涧
-    {0x6DA8, 0xD5C7}, // 涨
-    {0x6DA9, 0xC9AC}, // 涩
-    {0x6DAA, 0xB8A2}, // 涪
-    {0x6DAF, 0xD1C4}, // 涯
-    {0x6DB2, 0xD2BA}, // 液
-    {0x6DB5, 0xBAAD}, // 涵
-    {0x6DB8, 0xBAD4}, // 涸
-    {0x6DC0, 0xB5ED}, // 淀
-    {0x6DC4, 0xD7CD}, // 淄
-    {0x6DC6, 0xCFFD}, // 淆
-    {0x6DCB, 0xC1DC}, // 淋
-    {0x6DCC, 0xCCCA}, // 淌
-    {0x6DD1, 0xCAE7}, // 淑
-    {0x6DD6, 0xC4D7}, // 淖
-    {0x6DD8, 0xCCD4}, // 淘
-    {0x6DE1, 0xB5AD}, // 淡
-    {0x6DE4, 0xD3D9}, // 淤
-    {0x6DEB, 0xD2F9}, // 淫
-    {0x6DEC, 0xB4E3}, // 淬
-    {0x6DEE, 0xBBB4}, // 淮
-    {0x6DF1, 0xC9EE}, // 深
-    {0x6DF3, 0xB4BE}, // 淳
-    {0x6DF7, 0xBBEC}, // 混
-    {0x6DF9, 0xD1CD}, // 淹
-    {0x6DFB, 0xCCED}, // 添
-    {0x6E05, 0xC7E5}, // 清
-    {0x6E0A, 0xD4A8}, // 渊
-    {0x6E0D, 0xD7D5}, // 渍
-    {0x6E10, 0xBDA5}, // 渐
-    {0x6E14, 0xD3E6}, // 渔
-    {0x6E17, 0xC9F8}, // 渗
-    {0x6E1D, 0xD3E5}, // 渝
-    {0x6E20, 0xC7FE}, // 渠
-    {0x6E21, 0xB6C9}, // 渡
-    {0x6E23, 0xD4FC}, // 渣
-    {0x6E24, 0xB2B3}, // 渤
-    {0x6E29, 0xCEC2}, // 温
-    {0x6E2D, 0xCEBC}, // 渭
-    {0x6E2F, 0xB8DB}, // 港
-    {0x6E34, 0xBFCA}, // 渴
-    {0x6E38, 0xD3CE}, // 游
-    {0x6E3A, 0xC3EC}, // 渺
-    {0x6E43, 0xC5C8}, // 湃
-    {0x6E4D, 0xCDC4}, // 湍
-    {0x6E56, 0xBAFE}, // 湖
-    {0x6E58, 0xCFE6}, // 湘
-    {0x6E5B, 0xD5BF}, // 湛
-    {0x6E7E, 0xCDE5}, // 湾
-    {0x6E7F, 0xCAAA}, // 湿
-    {0x6E83, 0xC0A3}, // 溃
-    {0x6E85, 0xBDA6}, // 溅
-    {0x6E89, 0xB8C8}, // 溉
-    {0x6E90, 0xD4B4}, // 源
-    {0x6E9C, 0xC1EF}, // 溜
-    {0x6EA2, 0xD2E7}, // 溢
-    {0x6EAA, 0xCFAA}, // 溪
-    {0x6EAF, 0xCBDD}, // 溯
-    {0x6EB6, 0xC8DC}, // 溶
-    {0x6EBA, 0xC4E7}, // 溺
-    {0x6EC1, 0xB3FC}, // 滁
-    {0x6EC7, 0xB5E1}, // 滇
-    {0x6ECB, 0xD7CC}, // 滋
-    {0x6ED1, 0xBBAC}, // 滑
-    {0x6ED3, 0xD7D2}, // 滓
-    {0x6ED4, 0xCCCF}, // 滔
-    {0x6EDA, 0xB9F6}, // 滚
-    {0x6EDE, 0xD6CD}, // 滞
-    {0x6EE1, 0xC2FA}, // 满
-    {0x6EE4, 0xC2CB}, // 滤
-    {0x6EE5, 0xC0C4}, // 滥
-    {0x6EE6, 0xC2D0}, // 滦
-    {0x6EE8, 0xB1F5}, // 滨
-    {0x6EE9, 0xCCB2}, // 滩
-    {0x6EF4, 0xB5CE}, // 滴
-    {0x6F02, 0xC6AF}, // 漂
-    {0x6F06, 0xC6E1}, // 漆
-    {0x6F0F, 0xC2A9}, // 漏
-    {0x6F13, 0xC0EC}, // 漓
-    {0x6F14, 0xD1DD}, // 演
-    {0x6F20, 0xC4AE}, // 漠
-    {0x6F2B, 0xC2FE}, // 漫
-    {0x6F31, 0xCAFE}, // 漱
-    {0x6F33, 0xD5C4}, // 漳
-    {0x6F3E, 0xD1FA}, // 漾
-    {0x6F4D, 0xCEAB}, // 潍
-    {0x6F58, 0xC5CB}, // 潘
-    {0x6F5C, 0xC7B1}, // 潜
-    {0x6F5E, 0xC2BA}, // 潞
-    {0x6F66, 0xC1CA}, // 潦
-    {0x6F6D, 0xCCB6}, // 潭
-    {0x6F6E, 0xB3B1}, // 潮
-    {0x6F84, 0xB3CE}, // 澄
-    {0x6F88, 0xB3BA}, // 澈
-    {0x6F8E, 0xC5EC}, // 澎
-    {0x6F9C, 0xC0BD}, // 澜
-    {0x6FA1, 0xD4E8}, // 澡
-    {0x6FB3, 0xB0C4}, // 澳
-    {0x6FC0, 0xBCA4}, // 激
-    {0x6FD2, 0xB1F4}, // 濒
-    {0x7011, 0xC6D9}, // 瀑
-    {0x704C, 0xB9E0}, // 灌
-    {0x706B, 0xBBF0}, // 火
-    {0x706D, 0xC3F0}, // 灭
-    {0x706F, 0xB5C6}, // 灯
-    {0x7070, 0xBBD2}, // 灰
-    {0x7075, 0xC1E9}, // 灵
-    {0x7076, 0xD4EE}, // 灶
-    {0x7078, 0xBEC4}, // 灸
-    {0x707C, 0xD7C6}, // 灼
-    {0x707E, 0xD4D6}, // 灾
-    {0x707F, 0xB2D3}, // 灿
-    {0x7089, 0xC2AF}, // 炉
-    {0x708A, 0xB4B6}, // 炊
-    {0x708E, 0xD1D7}, // 炎
-    {0x7092, 0xB3B4}, // 炒
-    {0x7094, 0xC8B2}, // 炔
-    {0x7095, 0xBFBB}, // 炕
-    {0x7099, 0xD6CB}, // 炙
-    {0x70AC, 0xBEE6}, // 炬
-    {0x70AD, 0xCCBF}, // 炭
-    {0x70AE, 0xC5DA}, // 炮
-    {0x70AF, 0xBEBC}, // 炯
-    {0x70B3, 0xB1FE}, // 炳
-    {0x70B8, 0xD5A8}, // 炸
-    {0x70B9, 0xB5E3}, // 点
-    {0x70BC, 0xC1B6}, // 炼
-    {0x70BD, 0xB3E3}, // 炽
-    {0x70C1, 0xCBB8}, // 烁
-    {0x70C2, 0xC0C3}, // 烂
-    {0x70C3, 0xCCFE}, // 烃
-    {0x70C8, 0xC1D2}, // 烈
-    {0x70D8, 0xBAE6}, // 烘
-    {0x70D9, 0xC0D3}, // 烙
-    {0x70DB, 0xD6F2}, // 烛
-    {0x70DF, 0xD1CC}, // 烟
-    {0x70E4, 0xBFBE}, // 烤
-    {0x70E6, 0xB7B3}, // 烦
-    {0x70E7, 0xC9D5}, // 烧
-    {0x70E9, 0xBBE2}, // 烩
-    {0x70EB, 0xCCCC}, // 烫
-    {0x70EC, 0xBDFD}, // 烬
-    {0x70ED, 0xC8C8}, // 热
-    {0x70EF, 0xCFA9}, // 烯
-    {0x70F7, 0xCDE9}, // 烷
-    {0x70F9, 0xC5EB}, // 烹
-    {0x70FD, 0xB7E9}, // 烽
-    {0x7109, 0xD1C9}, // 焉
-    {0x710A, 0xBAB8}, // 焊
-    {0x7115, 0xBBC0}, // 焕
-    {0x7119, 0xB1BA}, // 焙
-    {0x711A, 0xB7D9}, // 焚
-    {0x7126, 0xBDB9}, // 焦
-    {0x7130, 0xD1E6}, // 焰
-    {0x7136, 0xC8BB}, // 然
-    {0x714C, 0xBBCD}, // 煌
-    {0x714E, 0xBCE5}, // 煎
-    {0x715E, 0xC9B7}, // 煞
-    {0x7164, 0xC3BA}, // 煤
-    {0x7167, 0xD5D5}, // 照
-    {0x716E, 0xD6F3}, // 煮
-    {0x717D, 0xC9BF}, // 煽
-    {0x7184, 0xCFA8}, // 熄
-    {0x718A, 0xD0DC}, // 熊
-    {0x718F, 0xD1AC}, // 熏
-    {0x7194, 0xC8DB}, // 熔
-    {0x7199, 0xCEF5}, // 熙
-    {0x719F, 0xCAEC}, // 熟
-    {0x71AC, 0xB0BE}, // 熬
-    {0x71C3, 0xC8BC}, // 燃
-    {0x71CE, 0xC1C7}, // 燎
-    {0x71D5, 0xD1E0}, // 燕
-    {0x71E5, 0xD4EF}, // 燥
-    {0x7206, 0xB1AC}, // 爆
-    {0x722A, 0xD7A6}, // 爪
-    {0x722C, 0xC5C0}, // 爬
-    {0x7231, 0xB0AE}, // 爱
-    {0x7235, 0xBEF4}, // 爵
-    {0x7236, 0xB8B8}, // 父
-    {0x7237, 0xD2AF}, // 爷
-    {0x7238, 0xB0D6}, // 爸
-    {0x7239, 0xB5F9}, // 爹
-    {0x723D, 0xCBAC}, // 爽
-    {0x7247, 0xC6AC}, // 片
-    {0x7248, 0xB0E6}, // 版
-    {0x724C, 0xC5C6}, // 牌
-    {0x7259, 0xD1C0}, // 牙
-    {0x725B, 0xC5A3}, // 牛
-    {0x725F, 0xC4B2}, // 牟
-    {0x7261, 0xC4B5}, // 牡
-    {0x7262, 0xC0CE}, // 牢
-    {0x7267, 0xC4C1}, // 牧
-    {0x7269, 0xCEEF}, // 物
-    {0x7272, 0xC9FC}, // 牲
-    {0x7275, 0xC7A3}, // 牵
-    {0x7279, 0xCCD8}, // 特
-    {0x727A, 0xCEFE}, // 牺
-    {0x7280, 0xCFAC}, // 犀
-    {0x7281, 0xC0E7}, // 犁
-    {0x728A, 0xB6BF}, // 犊
-    {0x72AC, 0xC8AE}, // 犬
-    {0x72AF, 0xB7B8}, // 犯
-    {0x72B6, 0xD7B4}, // 状
-    {0x72B9, 0xD3CC}, // 犹
-    {0x72C2, 0xBFF1}, // 狂
-    {0x72C4, 0xB5D2}, // 狄
-    {0x72C8, 0xB1B7}, // 狈
-    {0x72D0, 0xBAFC}, // 狐
-    {0x72D7, 0xB9B7}, // 狗
-    {0x72D9, 0xBED1}, // 狙
-    {0x72DE, 0xC4FC}, // 狞
-    {0x72E0, 0xBADD}, // 狠
-    {0x72E1, 0xBDC6}, // 狡
-    {0x72EC, 0xB6C0}, // 独
-    {0x72ED, 0xCFC1}, // 狭
-    {0x72EE, 0xCAA8}, // 狮
-    {0x72F0, 0xD5F8}, // 狰
-    {0x72F1, 0xD3FC}, // 狱
-    {0x72F8, 0xC0EA}, // 狸
-    {0x72FC, 0xC0C7}, // 狼
-    {0x730E, 0xC1D4}, // 猎
-    {0x7316, 0xB2FE}, // 猖
-    {0x731B, 0xC3CD}, // 猛
-    {0x731C, 0xB2C2}, // 猜
-    {0x7329, 0xD0C9}, // 猩
-    {0x732A, 0xD6ED}, // 猪
-    {0x732B, 0xC3A8}, // 猫
-    {0x732E, 0xCFD7}, // 献
-    {0x7334, 0xBAEF}, // 猴
-    {0x733E, 0xBBAB}, // 猾
-    {0x733F, 0xD4B3}, // 猿
-    {0x736D, 0xCCA1}, // 獭
-    {0x7384, 0xD0FE}, // 玄
-    {0x7387, 0xC2CA}, // 率
-    {0x7389, 0xD3F1}, // 玉
-    {0x738B, 0xCDF5}, // 王
-    {0x7396, 0xBEC1}, // 玖
-    {0x739B, 0xC2EA}, // 玛
-    {0x73A9, 0xCDE6}, // 玩
-    {0x73AB, 0xC3B5}, // 玫
-    {0x73AF, 0xBBB7}, // 环
-    {0x73B0, 0xCFD6}, // 现
-    {0x73B2, 0xC1E1}, // 玲
-    {0x73BB, 0xB2A3}, // 玻
-    {0x73CA, 0xC9BA}, // 珊
-    {0x73CD, 0xD5E4}, // 珍
-    {0x73D0, 0xB7A9}, // 珐
-    {0x73E0, 0xD6E9}, // 珠
-    {0x73ED, 0xB0E0}, // 班
-    {0x7403, 0xC7F2}, // 球
-    {0x7405, 0xC0C5}, // 琅
-    {0x7406, 0xC0ED}, // 理
-    {0x7409, 0xC1F0}, // 琉
-    {0x7410, 0xCBF6}, // 琐
-    {0x7422, 0xD7C1}, // 琢
-    {0x7433, 0xC1D5}, // 琳
-    {0x7434, 0xC7D9}, // 琴
-    {0x7435, 0xC5FD}, // 琵
-    {0x7436, 0xC5C3}, // 琶
-    {0x743C, 0xC7ED}, // 琼
-    {0x745A, 0xBAF7}, // 瑚
-    {0x745E, 0xC8F0}, // 瑞
-    {0x745F, 0xC9AA}, // 瑟
-    {0x7470, 0xB9E5}, // 瑰
-    {0x7476, 0xD1FE}, // 瑶
-    {0x7483, 0xC1A7}, // 璃
-    {0x74DC, 0xB9CF}, // 瓜
-    {0x74E2, 0xC6B0}, // 瓢
-    {0x74E3, 0xB0EA}, // 瓣
-    {0x74E4, 0xC8BF}, // 瓤
-    {0x74E6, 0xCDDF}, // 瓦
-    {0x74EE, 0xCECD}, // 瓮
-    {0x74F6, 0xC6BF}, // 瓶
-    {0x74F7, 0xB4C9}, // 瓷
-    {0x7504, 0xD5E7}, // 甄
-    {0x7518, 0xB8CA}, // 甘
-    {0x751A, 0xC9F5}, // 甚
-    {0x751C, 0xCCF0}, // 甜
-    {0x751F, 0xC9FA}, // 生
-    {0x7525, 0xC9FB}, // 甥
-    {0x7528, 0xD3C3}, // 用
-    {0x7529, 0xCBA6}, // 甩
-    {0x752B, 0xB8A6}, // 甫
-    {0x752D, 0xB1C2}, // 甭
-    {0x7530, 0xCCEF}, // 田
-    {0x7531, 0xD3C9}, // 由
-    {0x7532, 0xBCD7}, // 甲
-    {0x7533, 0xC9EA}, // 申
-    {0x7535, 0xB5E7}, // 电
-    {0x7537, 0xC4D0}, // 男
-    {0x7538, 0xB5E9}, // 甸
-    {0x753B, 0xBBAD}, // 画
-    {0x7545, 0xB3A9}, // 畅
-    {0x754C, 0xBDE7}, // 界
-    {0x754F, 0xCEB7}, // 畏
-    {0x7554, 0xC5CF}, // 畔
-    {0x7559, 0xC1F4}, // 留
-    {0x755C, 0xD0F3}, // 畜
-    {0x7565, 0xC2D4}, // 略
-    {0x7566, 0xC6E8}, // 畦
-    {0x756A, 0xB7AC}, // 番
-    {0x7574, 0xB3EB}, // 畴
-    {0x7578, 0xBBFB}, // 畸
-    {0x7586, 0xBDAE}, // 疆
-    {0x758F, 0xCAE8}, // 疏
-    {0x7591, 0xD2C9}, // 疑
-    {0x7597, 0xC1C6}, // 疗
-    {0x7599, 0xB8ED}, // 疙
-    {0x759A, 0xBECE}, // 疚
-    {0x759F, 0xC5B1}, // 疟
-    {0x75A1, 0xD1F1}, // 疡
-    {0x75A4, 0xB0CC}, // 疤
-    {0x75A5, 0xBDEA}, // 疥
-    {0x75AB, 0xD2DF}, // 疫
-    {0x75AE, 0xB4AF}, // 疮
-    {0x75AF, 0xB7E8}, // 疯
-    {0x75B2, 0xC6A3}, // 疲
-    {0x75B5, 0xB4C3}, // 疵
-    {0x75B9, 0xD5EE}, // 疹
-    {0x75BC, 0xCCDB}, // 疼
-    {0x75BD, 0xBED2}, // 疽
-    {0x75BE, 0xBCB2}, // 疾
-    {0x75C5, 0xB2A1}, // 病
-    {0x75C7, 0xD6A2}, // 症
-    {0x75C8, 0xD3B8}, // 痈
-    {0x75C9, 0xBEB7}, // 痉
-    {0x75CA, 0xC8AC}, // 痊
-    {0x75D2, 0xD1F7}, // 痒
-    {0x75D4, 0xD6CC}, // 痔
-    {0x75D5, 0xBADB}, // 痕
-    {0x75D8, 0xB6BB}, // 痘
-    {0x75DB, 0xCDB4}, // 痛
-    {0x75DE, 0xC6A6}, // 痞
-    {0x75E2, 0xC1A1}, // 痢
-    {0x75EA, 0xBBBE}, // 痪
-    {0x75F0, 0xCCB5}, // 痰
-    {0x75F4, 0xB3D5}, // 痴
-    {0x75F9, 0xB1D4}, // 痹
-    {0x7601, 0xB4E1}, // 瘁
-    {0x761F, 0xCEC1}, // 瘟
-    {0x7624, 0xC1F6}, // 瘤
-    {0x7626, 0xCADD}, // 瘦
-    {0x7629, 0xB4F1}, // 瘩
-    {0x762A, 0xB1F1}, // 瘪
-    {0x762B, 0xCCB1}, // 瘫
-    {0x7634, 0xD5CE}, // 瘴
-    {0x7638, 0xC8B3}, // 瘸
-    {0x764C, 0xB0A9}, // 癌
-    {0x7663, 0xD1A2}, // 癣
-    {0x7678, 0xB9EF}, // 癸
-    {0x767B, 0xB5C7}, // 登
-    {0x767D, 0xB0D7}, // 白
-    {0x767E, 0xB0D9}, // 百
-    {0x7682, 0xD4ED}, // 皂
-    {0x7684, 0xB5C4}, // 的
-    {0x7686, 0xBDD4}, // 皆
-    {0x7687, 0xBBCA}, // 皇
-    {0x768B, 0xB8DE}, // 皋
-    {0x7691, 0xB0A8}, // 皑
-    {0x7696, 0xCDEE}, // 皖
-    {0x76AE, 0xC6A4}, // 皮
-    {0x76B1, 0xD6E5}, // 皱
-    {0x76BF, 0xC3F3}, // 皿
-    {0x76C2, 0xD3DB}, // 盂
-    {0x76C5, 0xD6D1}, // 盅
-    {0x76C6, 0xC5E8}, // 盆
-    {0x76C8, 0xD3AF}, // 盈
-    {0x76CA, 0xD2E6}, // 益
-    {0x76CE, 0xB0BB}, // 盎
-    {0x76CF, 0xD5B5}, // 盏
-    {0x76D0, 0xD1CE}, // 盐
-    {0x76D1, 0xBCE0}, // 监
-    {0x76D2, 0xBAD0}, // 盒
-    {0x76D4, 0xBFF8}, // 盔
-    {0x76D6, 0xB8C7}, // 盖
-    {0x76D7, 0xB5C1}, // 盗
-    {0x76D8, 0xC5CC}, // 盘
-    {0x76DB, 0xCAA2}, // 盛
-    {0x76DF, 0xC3CB}, // 盟
-    {0x76EE, 0xC4BF}, // 目
-    {0x76EF, 0xB6A2}, // 盯
-    {0x76F2, 0xC3A4}, // 盲
-    {0x76F4, 0xD6B1}, // 直
-    {0x76F8, 0xCFE0}, // 相
-    {0x76FC, 0xC5CE}, // 盼
-    {0x76FE, 0xB6DC}, // 盾
-    {0x7701, 0xCAA1}, // 省
-    {0x7709, 0xC3BC}, // 眉
-    {0x770B, 0xBFB4}, // 看
-    {0x771F, 0xD5E6}, // 真
-    {0x7720, 0xC3DF}, // 眠
-    {0x7728, 0xD5A3}, // 眨
-    {0x7729, 0xD1A3}, // 眩
-    {0x772F, 0xC3D0}, // 眯
-    {0x7736, 0xBFF4}, // 眶
-    {0x7737, 0xBEEC}, // 眷
-    {0x773A, 0xCCF7}, // 眺
-    {0x773C, 0xD1DB}, // 眼
-    {0x7740, 0xD7C5}, // 着
-    {0x7741, 0xD5F6}, // 睁
-    {0x775B, 0xBEA6}, // 睛
-    {0x7761, 0xCBAF}, // 睡
-    {0x7763, 0xB6BD}, // 督
-    {0x7766, 0xC4C0}, // 睦
-    {0x776B, 0xBDDE}, // 睫
-    {0x776C, 0xB2C7}, // 睬
-    {0x7779, 0xB6C3}, // 睹
-    {0x7784, 0xC3E9}, // 瞄
-    {0x7785, 0xB3F2}, // 瞅
-    {0x778E, 0xCFB9}, // 瞎
-    {0x7792, 0xC2F7}, // 瞒
-    {0x77A5, 0xC6B3}, // 瞥
-    {0x77A7, 0xC7C6}, // 瞧
-    {0x77A9, 0xD6F5}, // 瞩
-    {0x77AA, 0xB5C9}, // 瞪
-    {0x77AC, 0xCBB2}, // 瞬
-    {0x77B3, 0xCDAB}, // 瞳
-    {0x77BB, 0xD5B0}, // 瞻
-    {0x77D7, 0xB4A3}, // 矗
-    {0x77DB, 0xC3AC}, // 矛
-    {0x77E2, 0xCAB8}, // 矢
-    {0x77E3, 0xD2D3}, // 矣
-    {0x77E5, 0xD6AA}, // 知
-    {0x77E9, 0xBED8}, // 矩
-    {0x77EB, 0xBDC3}, // 矫
-    {0x77ED, 0xB6CC}, // 短
-    {0x77EE, 0xB0AB}, // 矮
-    {0x77F3, 0xCAAF}, // 石
-    {0x77FD, 0xCEF9}, // 矽
-    {0x77FE, 0xB7AF}, // 矾
-    {0x77FF, 0xBFF3}, // 矿
-    {0x7801, 0xC2EB}, // 码
-    {0x7802, 0xC9B0}, // 砂
-    {0x780C, 0xC6F6}, // 砌
-    {0x780D, 0xBFB3}, // 砍
-    {0x7812, 0xC5F8}, // 砒
-    {0x7814, 0xD1D0}, // 研
-    {0x7816, 0xD7A9}, // 砖
-    {0x781A, 0xD1E2}, // 砚
-    {0x7827, 0xD5E8}, // 砧
-    {0x7830, 0xC5E9}, // 砰
-    {0x7834, 0xC6C6}, // 破
-    {0x7837, 0xC9E9}, // 砷
-    {0x7838, 0xD4D2}, // 砸
-    {0x783E, 0xC0F9}, // 砾
-    {0x7840, 0xB4A1}, // 础
-    {0x7845, 0xB9E8}, // 硅
-    {0x7852, 0xCEF8}, // 硒
-    {0x7855, 0xCBB6}, // 硕
-    {0x785D, 0xCFF5}, // 硝
-    {0x786B, 0xC1F2}, // 硫
-    {0x786C, 0xD3B2}, // 硬
-    {0x786E, 0xC8B7}, // 确
-    {0x787C, 0xC5F0}, // 硼
-    {0x7889, 0xB5EF}, // 碉
-    {0x788C, 0xC2B5}, // 碌
-    {0x788D, 0xB0AD}, // 碍
-    {0x788E, 0xCBE9}, // 碎
-    {0x7891, 0xB1AE}, // 碑
-    {0x7897, 0xCDEB}, // 碗
-    {0x7898, 0xB5E2}, // 碘
-    {0x789F, 0xB5FA}, // 碟
-    {0x78A7, 0xB1CC}, // 碧
-    {0x78B0, 0xC5F6}, // 碰
-    {0x78B1, 0xBCEE}, // 碱
-    {0x78B1, 0xBCEE}, // 碱
-    {0x78B3, 0xCCBC}, // 碳
-    {0x78B4, 0xB2EA}, // 碴
-    {0x78BE, 0xC4EB}, // 碾
-    {0x78C1, 0xB4C5}, // 磁
-    {0x78C5, 0xB0F5}, // 磅
-    {0x78CA, 0xC0DA}, // 磊
-    {0x78CB, 0xB4E8}, // 磋
-    {0x78D0, 0xC5CD}, // 磐
-    {0x78D5, 0xBFC4}, // 磕
-    {0x78E8, 0xC4A5}, // 磨
-    {0x78F7, 0xC1D7}, // 磷
-    {0x78FA, 0xBBC7}, // 磺
-    {0x7901, 0xBDB8}, // 礁
-    {0x793A, 0xCABE}, // 示
-    {0x793C, 0xC0F1}, // 礼
-    {0x793E, 0xC9E7}, // 社
-    {0x7941, 0xC6EE}, // 祁
-    {0x7948, 0xC6ED}, // 祈
-    {0x7956, 0xD7E6}, // 祖
-    {0x795D, 0xD7A3}, // 祝
-    {0x795E, 0xC9F1}, // 神
-    {0x795F, 0xCBEE}, // 祟
-    {0x7965, 0xCFE9}, // 祥
-    {0x7968, 0xC6B1}, // 票
-    {0x796D, 0xBCC0}, // 祭
-    {0x7977, 0xB5BB}, // 祷
-    {0x7978, 0xBBF6}, // 祸
-    {0x7981, 0xBDFB}, // 禁
-    {0x7984, 0xC2BB}, // 禄
-    {0x798F, 0xB8A3}, // 福
-    {0x79B9, 0xD3ED}, // 禹
-    {0x79BB, 0xC0EB}, // 离
-    {0x79BD, 0xC7DD}, // 禽
-    {0x79BE, 0xBACC}, // 禾
-    {0x79C0, 0xD0E3}, // 秀
-    {0x79C1, 0xCBBD}, // 私
-    {0x79C3, 0xCDBA}, // 秃
-    {0x79C6, 0xB8D1}, // 秆
-    {0x79C9, 0xB1FC}, // 秉
-    {0x79CB, 0xC7EF}, // 秋
-    {0x79CD, 0xD6D6}, // 种
-    {0x79D1, 0xBFC6}, // 科
-    {0x79D2, 0xC3EB}, // 秒
-    {0x79D8, 0xC3D8}, // 秘
-    {0x79DF, 0xD7E2}, // 租
-    {0x79E4, 0xB3D3}, // 秤
-    {0x79E6, 0xC7D8}, // 秦
-    {0x79E7, 0xD1ED}, // 秧
-    {0x79E9, 0xD6C8}, // 秩
-    {0x79EF, 0xBBFD}, // 积
-    {0x79F0, 0xB3C6}, // 称
-    {0x79F8, 0xBDD5}, // 秸
-    {0x79FB, 0xD2C6}, // 移
-    {0x79FD, 0xBBE0}, // 秽
-    {0x7A00, 0xCFA1}, // 稀
-    {0x7A0B, 0xB3CC}, // 程
-    {0x7A0D, 0xC9D4}, // 稍
-    {0x7A0E, 0xCBB0}, // 税
-    {0x7A17, 0xB0DE}, // 稗
-    {0x7A1A, 0xD6C9}, // 稚
-    {0x7A20, 0xB3ED}, // 稠
-    {0x7A33, 0xCEC8}, // 稳
-    {0x7A3B, 0xB5BE}, // 稻
-    {0x7A3C, 0xBCDA}, // 稼
-    {0x7A3D, 0xBBFC}, // 稽
-    {0x7A3F, 0xB8E5}, // 稿
-    {0x7A46, 0xC4C2}, // 穆
-    {0x7A57, 0xCBEB}, // 穗
-    {0x7A74, 0xD1A8}, // 穴
-    {0x7A76, 0xBEBF}, // 究
-    {0x7A77, 0xC7EE}, // 穷
-    {0x7A7A, 0xBFD5}, // 空
-    {0x7A7F, 0xB4A9}, // 穿
-    {0x7A81, 0xCDBB}, // 突
-    {0x7A83, 0xC7D4}, // 窃
-    {0x7A84, 0xD5AD}, // 窄
-    {0x7A8D, 0xC7CF}, // 窍
-    {0x7A91, 0xD2A4}, // 窑
-    {0x7A92, 0xD6CF}, // 窒
-    {0x7A96, 0xBDD1}, // 窖
-    {0x7A97, 0xB4B0}, // 窗
-    {0x7A98, 0xBEBD}, // 窘
-    {0x7A9C, 0xB4DC}, // 窜
-    {0x7A9D, 0xCED1}, // 窝
-    {0x7A9F, 0xBFDF}, // 窟
-    {0x7AA5, 0xBFFA}, // 窥
-    {0x7ABF, 0xC1FE}, // 窿
-    {0x7ACB, 0xC1A2}, // 立
-    {0x7AD6, 0xCAFA}, // 竖
-    {0x7AD9, 0xD5BE}, // 站
-    {0x7ADE, 0xBEBA}, // 竞
-    {0x7ADF, 0xBEB9}, // 竟
-    {0x7AE0, 0xD5C2}, // 章
-    {0x7AE3, 0xBFA2}, // 竣
-    {0x7AE5, 0xCDAF}, // 童
-    {0x7AED, 0xBDDF}, // 竭
-    {0x7AEF, 0xB6CB}, // 端
-    {0x7AF9, 0xD6F1}, // 竹
-    {0x7AFF, 0xB8CD}, // 竿
-    {0x7B06, 0xB0CA}, // 笆
-    {0x7B0B, 0xCBF1}, // 笋
-    {0x7B11, 0xD0A6}, // 笑
-    {0x7B14, 0xB1CA}, // 笔
-    {0x7B1B, 0xB5D1}, // 笛
-    {0x7B26, 0xB7FB}, // 符
-    {0x7B28, 0xB1BF}, // 笨
-    {0x7B2C, 0xB5DA}, // 第
-    {0x7B3A, 0xBCE3}, // 笺
-    {0x7B3C, 0xC1FD}, // 笼
-    {0x7B49, 0xB5C8}, // 等
-    {0x7B4B, 0xBDEE}, // 筋
-    {0x7B4F, 0xB7A4}, // 筏
-    {0x7B50, 0xBFF0}, // 筐
-    {0x7B51, 0xD6FE}, // 筑
-    {0x7B52, 0xCDB2}, // 筒
-    {0x7B54, 0xB4F0}, // 答
-    {0x7B56, 0xB2DF}, // 策
-    {0x7B5B, 0xC9B8}, // 筛
-    {0x7B77, 0xBFEA}, // 筷
-    {0x7B79, 0xB3EF}, // 筹
-    {0x7B7E, 0xC7A9}, // 签
-    {0x7B80, 0xBCF2}, // 简
-    {0x7B8D, 0xB9BF}, // 箍
-    {0x7B94, 0xB2AD}, // 箔
-    {0x7B95, 0xBBFE}, // 箕
-    {0x7B97, 0xCBE3}, // 算
-    {0x7BA1, 0xB9DC}, // 管
-    {0x7BA9, 0xC2E1}, // 箩
-    {0x7BAD, 0xBCFD}, // 箭
-    {0x7BB1, 0xCFE4}, // 箱
-    {0x7BC6, 0xD7AD}, // 篆
-    {0x7BC7, 0xC6AA}, // 篇
-    {0x7BD3, 0xC2A8}, // 篓
-    {0x7BD9, 0xB8DD}, // 篙
-    {0x7BE1, 0xB4DB}, // 篡
-    {0x7BEE, 0xC0BA}, // 篮
-    {0x7BF1, 0xC0E9}, // 篱
-    {0x7BF7, 0xC5F1}, // 篷
-    {0x7C07, 0xB4D8}, // 簇
-    {0x7C27, 0xBBC9}, // 簧
-    {0x7C3F, 0xB2BE}, // 簿
-    {0x7C4D, 0xBCAE}, // 籍
-    {0x7C73, 0xC3D7}, // 米
-    {0x7C7B, 0xC0E0}, // 类
-    {0x7C7D, 0xD7D1}, // 籽
-    {0x7C89, 0xB7DB}, // 粉
-    {0x7C92, 0xC1A3}, // 粒
-    {0x7C95, 0xC6C9}, // 粕
-    {0x7C97, 0xB4D6}, // 粗
-    {0x7C98, 0xD5B3}, // 粘
-    {0x7C9F, 0xCBDA}, // 粟
-    {0x7CA4, 0xD4C1}, // 粤
-    {0x7CA5, 0xD6E0}, // 粥
-    {0x7CAA, 0xB7E0}, // 粪
-    {0x7CAE, 0xC1B8}, // 粮
-    {0x7CB1, 0xC1BB}, // 粱
-    {0x7CB3, 0xBEAC}, // 粳
-    {0x7CB9, 0xB4E2}, // 粹
-    {0x7CBE, 0xBEAB}, // 精
-    {0x7CCA, 0xBAFD}, // 糊
-    {0x7CD5, 0xB8E2}, // 糕
-    {0x7CD6, 0xCCC7}, // 糖
-    {0x7CD9, 0xB2DA}, // 糙
-    {0x7CDC, 0xC3D3}, // 糜
-    {0x7CDF, 0xD4E3}, // 糟
-    {0x7CE0, 0xBFB7}, // 糠
-    {0x7CEF, 0xC5B4}, // 糯
-    {0x7CFB, 0xCFB5}, // 系
-    {0x7D0A, 0xCEC9}, // 紊
-    {0x7D20, 0xCBD8}, // 素
-    {0x7D22, 0xCBF7}, // 索
-    {0x7D27, 0xBDF4}, // 紧
-    {0x7D2B, 0xD7CF}, // 紫
-    {0x7D2F, 0xC0DB}, // 累
-    {0x7D6E, 0xD0F5}, // 絮
-    {0x7E41, 0xB7B1}, // 繁
-    {0x7E82, 0xD7EB}, // 纂
-    {0x7EA0, 0xBEC0}, // 纠
-    {0x7EA2, 0xBAEC}, // 红
-    {0x7EA4, 0xCFCB}, // 纤
-    {0x7EA6, 0xD4BC}, // 约
-    {0x7EA7, 0xBCB6}, // 级
-    {0x7EAA, 0xBCCD}, // 纪
-    {0x7EAB, 0xC8D2}, // 纫
-    {0x7EAC, 0xCEB3}, // 纬
-    {0x7EAF, 0xB4BF}, // 纯
-    {0x7EB1, 0xC9B4}, // 纱
-    {0x7EB2, 0xB8D9}, // 纲
-    {0x7EB3, 0xC4C9}, // 纳
-    {0x7EB5, 0xD7DD}, // 纵
-    {0x7EB6, 0xC2DA}, // 纶
-    {0x7EB7, 0xB7D7}, // 纷
-    {0x7EB8, 0xD6BD}, // 纸
-    {0x7EB9, 0xCEC6}, // 纹
-    {0x7EBA, 0xB7C4}, // 纺
-    {0x7EBD, 0xC5A6}, // 纽
-    {0x7EBF, 0xCFDF}, // 线
-    {0x7EC3, 0xC1B7}, // 练
-    {0x7EC4, 0xD7E9}, // 组
-    {0x7EC5, 0xC9F0}, // 绅
-    {0x7EC6, 0xCFB8}, // 细
-    {0x7EC7, 0xD6AF}, // 织
-    {0x7EC8, 0xD6D5}, // 终
-    {0x7ECA, 0xB0ED}, // 绊
-    {0x7ECD, 0xC9DC}, // 绍
-    {0x7ECE, 0xD2EF}, // 绎
-    {0x7ECF, 0xBEAD}, // 经
-    {0x7ED1, 0xB0F3}, // 绑
-    {0x7ED2, 0xC8DE}, // 绒
-    {0x7ED3, 0xBDE1}, // 结
-    {0x7ED5, 0xC8C6}, // 绕
-    {0x7ED8, 0xBBE6}, // 绘
-    {0x7ED9, 0xB8F8}, // 给
-    {0x7EDA, 0xD1A4}, // 绚
-    {0x7EDC, 0xC2E7}, // 络
-    {0x7EDD, 0xBEF8}, // 绝
-    {0x7EDE, 0xBDCA}, // 绞
-    {0x7EDF, 0xCDB3}, // 统
-    {0x7EE2, 0xBEEE}, // 绢
-    {0x7EE3, 0xD0E5}, // 绣
-    {0x7EE5, 0xCBE7}, // 绥
-    {0x7EE6, 0xCCD0}, // 绦
-    {0x7EE7, 0xBCCC}, // 继
-    {0x7EE9, 0xBCA8}, // 绩
-    {0x7EEA, 0xD0F7}, // 绪
-    {0x7EED, 0xD0F8}, // 续
-    {0x7EF0, 0xB4C2}, // 绰
-    {0x7EF3, 0xC9FE}, // 绳
-    {0x7EF4, 0xCEAC}, // 维
-    {0x7EF5, 0xC3E0}, // 绵
-    {0x7EF7, 0xB1C1}, // 绷
-    {0x7EF8, 0xB3F1}, // 绸
-    {0x7EFC, 0xD7DB}, // 综
-    {0x7EFD, 0xD5C0}, // 绽
-    {0x7EFF, 0xC2CC}, // 绿
-    {0x7F00, 0xD7BA}, // 缀
-    {0x7F04, 0xBCEA}, // 缄
-    {0x7F05, 0xC3E5}, // 缅
-    {0x7F06, 0xC0C2}, // 缆
-    {0x7F09, 0xBCA9}, // 缉
-    {0x7F0E, 0xB6D0}, // 缎
-    {0x7F13, 0xBBBA}, // 缓
-    {0x7F14, 0xB5DE}, // 缔
-    {0x7F15, 0xC2C6}, // 缕
-    {0x7F16, 0xB1E0}, // 编
-    {0x7F18, 0xD4B5}, // 缘
-    {0x7F1A, 0xB8BF}, // 缚
-    {0x7F1D, 0xB7EC}, // 缝
-    {0x7F20, 0xB2F8}, // 缠
-    {0x7F28, 0xD3A7}, // 缨
-    {0x7F29, 0xCBF5}, // 缩
-    {0x7F2E, 0xC9C9}, // 缮
-    {0x7F34, 0xBDC9}, // 缴
-    {0x7F38, 0xB8D7}, // 缸
-    {0x7F3A, 0xC8B1}, // 缺
-    {0x7F50, 0xB9DE}, // 罐
-    {0x7F51, 0xCDF8}, // 网
-    {0x7F55, 0xBAB1}, // 罕
-    {0x7F57, 0xC2DE}, // 罗
-    {0x7F5A, 0xB7A3}, // 罚
-    {0x7F62, 0xB0D5}, // 罢
-    {0x7F69, 0xD5D6}, // 罩
-    {0x7F6A, 0xD7EF}, // 罪
-    {0x7F6E, 0xD6C3}, // 置
-    {0x7F72, 0xCAF0}, // 署
-    {0x7F8A, 0xD1F2}, // 羊
-    {0x7F8C, 0xC7BC}, // 羌
-    {0x7F8E, 0xC3C0}, // 美
-    {0x7F94, 0xB8E1}, // 羔
-    {0x7F9A, 0xC1E7}, // 羚
-    {0x7F9E, 0xD0DF}, // 羞
-    {0x7FA1, 0xCFDB}, // 羡
-    {0x7FA4, 0xC8BA}, // 群
-    {0x7FB9, 0xB8FE}, // 羹
-    {0x7FBD, 0xD3F0}, // 羽
-    {0x7FC1, 0xCECC}, // 翁
-    {0x7FC5, 0xB3E1}, // 翅
-    {0x7FCC, 0xD2EE}, // 翌
-    {0x7FD4, 0xCFE8}, // 翔
-    {0x7FD8, 0xC7CC}, // 翘
-    {0x7FDF, 0xB5D4}, // 翟
-    {0x7FE0, 0xB4E4}, // 翠
-    {0x7FF0, 0xBAB2}, // 翰
-    {0x7FF1, 0xB0BF}, // 翱
-    {0x7FFB, 0xB7AD}, // 翻
-    {0x7FFC, 0xD2ED}, // 翼
-    {0x8000, 0xD2AB}, // 耀
-    {0x8001, 0xC0CF}, // 老
-    {0x8003, 0xBFBC}, // 考
-    {0x8005, 0xD5DF}, // 者
-    {0x800C, 0xB6F8}, // 而
-    {0x800D, 0xCBA3}, // 耍
-    {0x8010, 0xC4CD}, // 耐
-    {0x8015, 0xB8FB}, // 耕
-    {0x8017, 0xBAC4}, // 耗
-    {0x8018, 0xD4C5}, // 耘
-    {0x8019, 0xB0D2}, // 耙
-    {0x802A, 0xC5D5}, // 耪
-    {0x8033, 0xB6FA}, // 耳
-    {0x8036, 0xD2AE}, // 耶
-    {0x8038, 0xCBCA}, // 耸
-    {0x803B, 0xB3DC}, // 耻
-    {0x803D, 0xB5A2}, // 耽
-    {0x803F, 0xB9A2}, // 耿
-    {0x8042, 0xC4F4}, // 聂
-    {0x804A, 0xC1C4}, // 聊
-    {0x804B, 0xC1FB}, // 聋
-    {0x804C, 0xD6B0}, // 职
-    {0x8054, 0xC1AA}, // 联
-    {0x8058, 0xC6B8}, // 聘
-    {0x805A, 0xBEDB}, // 聚
-    {0x806A, 0xB4CF}, // 聪
-    {0x8083, 0xCBE0}, // 肃
-    {0x8084, 0xD2DE}, // 肄
-    {0x8086, 0xCBC1}, // 肆
-    {0x8087, 0xD5D8}, // 肇
-    {0x8089, 0xC8E2}, // 肉
-    {0x808B, 0xC0DF}, // 肋
-    {0x808C, 0xBCA1}, // 肌
-    {0x8096, 0xD0A4}, // 肖
-    {0x8098, 0xD6E2}, // 肘
-    {0x809A, 0xB6C7}, // 肚
-    {0x809B, 0xB8D8}, // 肛
-    {0x809D, 0xB8CE}, // 肝
-    {0x80A0, 0xB3A6}, // 肠
-    {0x80A1, 0xB9C9}, // 股
-    {0x80A2, 0xD6AB}, // 肢
-    {0x80A4, 0xB7F4}, // 肤
-    {0x80A5, 0xB7CA}, // 肥
-    {0x80A9, 0xBCE7}, // 肩
-    {0x80AA, 0xB7BE}, // 肪
-    {0x80AE, 0xB0B9}, // 肮
-    {0x80AF, 0xBFCF}, // 肯
-    {0x80B2, 0xD3FD}, // 育
-    {0x80BA, 0xB7CE}, // 肺
-    {0x80BE, 0xC9F6}, // 肾
-    {0x80BF, 0xD6D7}, // 肿
-    {0x80C0, 0xD5CD}, // 胀
-    {0x80C1, 0xD0B2}, // 胁
-    {0x80C3, 0xCEB8}, // 胃
-    {0x80C6, 0xB5A8}, // 胆
-    {0x80CC, 0xB1B3}, // 背
-    {0x80CE, 0xCCA5}, // 胎
-    {0x80D6, 0xC5D6}, // 胖
-    {0x80DA, 0xC5DF}, // 胚
-    {0x80DC, 0xCAA4}, // 胜
-    {0x80DE, 0xB0FB}, // 胞
-    {0x80E1, 0xBAFA}, // 胡
-    {0x80EF, 0xBFE8}, // 胯
-    {0x80F0, 0xD2C8}, // 胰
-    {0x80F3, 0xB8EC}, // 胳
-    {0x80F6, 0xBDBA}, // 胶
-    {0x80F8, 0xD0D8}, // 胸
-    {0x80FA, 0xB0B7}, // 胺
-    {0x80FD, 0xC4DC}, // 能
-    {0x8102, 0xD6AC}, // 脂
-    {0x8106, 0xB4E0}, // 脆
-    {0x8109, 0xC2F6}, // 脉
-    {0x810A, 0xBCB9}, // 脊
-    {0x810F, 0xD4E0}, // 脏
-    {0x8110, 0xC6EA}, // 脐
-    {0x8111, 0xC4D4}, // 脑
-    {0x8113, 0xC5A7}, // 脓
-    {0x8116, 0xB2B1}, // 脖
-    {0x811A, 0xBDC5}, // 脚
-    {0x812F, 0xB8AC}, // 脯
-    {0x8131, 0xCDD1}, // 脱
-    {0x8138, 0xC1B3}, // 脸
-    {0x813E, 0xC6A2}, // 脾
-    {0x8146, 0xCCF3}, // 腆
-    {0x814A, 0xC0B0}, // 腊
-    {0x814B, 0xD2B8}, // 腋
-    {0x8150, 0xB8AF}, // 腐
-    {0x8151, 0xB8AD}, // 腑
-    {0x8154, 0xC7BB}, // 腔
-    {0x8155, 0xCDF3}, // 腕
-    {0x8165, 0xD0C8}, // 腥
-    {0x816E, 0xC8F9}, // 腮
-    {0x8170, 0xD1FC}, // 腰
-    {0x8179, 0xB8B9}, // 腹
-    {0x817A, 0xCFD9}, // 腺
-    {0x817B, 0xC4E5}, // 腻
-    {0x817E, 0xCCDA}, // 腾
-    {0x817F, 0xCDC8}, // 腿
-    {0x8180, 0xB0F2}, // 膀
-    {0x818A, 0xB2B2}, // 膊
-    {0x818F, 0xB8E0}, // 膏
-    {0x8198, 0xB1EC}, // 膘
-    {0x819B, 0xCCC5}, // 膛
-    {0x819C, 0xC4A4}, // 膜
-    {0x819D, 0xCFA5}, // 膝
-    {0x81A8, 0xC5F2}, // 膨
-    {0x81B3, 0xC9C5}, // 膳
-    {0x81C0, 0xCDCE}, // 臀
-    {0x81C2, 0xB1DB}, // 臂
-    {0x81C3, 0xD3B7}, // 臃
-    {0x81C6, 0xD2DC}, // 臆
-    {0x81E3, 0xB3BC}, // 臣
-    {0x81EA, 0xD7D4}, // 自
-    {0x81ED, 0xB3F4}, // 臭
-    {0x81F3, 0xD6C1}, // 至
-    {0x81F4, 0xD6C2}, // 致
-    {0x81FB, 0xD5E9}, // 臻
-    {0x81FC, 0xBECA}, // 臼
-    {0x8200, 0xD2A8}, // 舀
-    {0x8205, 0xBECB}, // 舅
-    {0x8206, 0xD3DF}, // 舆
-    {0x820C, 0xC9E0}, // 舌
-    {0x820D, 0xC9E1}, // 舍
-    {0x8212, 0xCAE6}, // 舒
-    {0x8214, 0xCCF2}, // 舔
-    {0x821C, 0xCBB4}, // 舜
-    {0x821E, 0xCEE8}, // 舞
-    {0x821F, 0xD6DB}, // 舟
-    {0x822A, 0xBABD}, // 航
-    {0x822C, 0xB0E3}, // 般
-    {0x8230, 0xBDA2}, // 舰
-    {0x8231, 0xB2D5}, // 舱
-    {0x8235, 0xB6E6}, // 舵
-    {0x8236, 0xB2B0}, // 舶
-    {0x8237, 0xCFCF}, // 舷
-    {0x8239, 0xB4AC}, // 船
-    {0x8247, 0xCDA7}, // 艇
-    {0x8258, 0xCBD2}, // 艘
-    {0x826F, 0xC1BC}, // 良
-    {0x8270, 0xBCE8}, // 艰
-    {0x8272, 0xC9AB}, // 色
-    {0x8273, 0xD1DE}, // 艳
-    {0x827A, 0xD2D5}, // 艺
-    {0x827E, 0xB0AC}, // 艾
-    {0x8282, 0xBDDA}, // 节
-    {0x828B, 0xD3F3}, // 芋
-    {0x828D, 0xC9D6}, // 芍
-    {0x8292, 0xC3A2}, // 芒
-    {0x829C, 0xCEDF}, // 芜
-    {0x829D, 0xD6A5}, // 芝
-    {0x82A5, 0xBDE6}, // 芥
-    {0x82A6, 0xC2AB}, // 芦
-    {0x82AC, 0xB7D2}, // 芬
-    {0x82AD, 0xB0C5}, // 芭
-    {0x82AF, 0xD0BE}, // 芯
-    {0x82B1, 0xBBA8}, // 花
-    {0x82B3, 0xB7BC}, // 芳
-    {0x82B9, 0xC7DB}, // 芹
-    {0x82BD, 0xD1BF}, // 芽
-    {0x82C7, 0xCEAD}, // 苇
-    {0x82CD, 0xB2D4}, // 苍
-    {0x82CF, 0xCBD5}, // 苏
-    {0x82D1, 0xD4B7}, // 苑
-    {0x82D4, 0xCCA6}, // 苔
-    {0x82D7, 0xC3E7}, // 苗
-    {0x82DB, 0xBFC1}, // 苛
-    {0x82DE, 0xB0FA}, // 苞
-    {0x82DF, 0xB9B6}, // 苟
-    {0x82E5, 0xC8F4}, // 若
-    {0x82E6, 0xBFE0}, // 苦
-    {0x82EB, 0xC9BB}, // 苫
-    {0x82EF, 0xB1BD}, // 苯
-    {0x82F1, 0xD3A2}, // 英
-    {0x82F9, 0xC6BB}, // 苹
-    {0x8301, 0xD7C2}, // 茁
-    {0x8302, 0xC3AF}, // 茂
-    {0x8303, 0xB7B6}, // 范
-    {0x8304, 0xC7D1}, // 茄
-    {0x8305, 0xC3A9}, // 茅
-    {0x830E, 0xBEA5}, // 茎
-    {0x8327, 0xBCEB}, // 茧
-    {0x8328, 0xB4C4}, // 茨
-    {0x832B, 0xC3A3}, // 茫
-    {0x832C, 0xB2E7}, // 茬
-    {0x8335, 0xD2F0}, // 茵
-    {0x8336, 0xB2E8}, // 茶
-    {0x8338, 0xC8D7}, // 茸
-    {0x8339, 0xC8E3}, // 茹
-    {0x8346, 0xBEA3}, // 荆
-    {0x8349, 0xB2DD}, // 草
-    {0x8350, 0xBCF6}, // 荐
-    {0x8352, 0xBBC4}, // 荒
-    {0x8354, 0xC0F3}, // 荔
-    {0x835A, 0xBCD4}, // 荚
-    {0x8361, 0xB5B4}, // 荡
-    {0x8363, 0xC8D9}, // 荣
-    {0x8364, 0xBBE7}, // 荤
-    {0x8367, 0xD3AB}, // 荧
-    {0x836B, 0xD2F1}, // 荫
-    {0x836F, 0xD2A9}, // 药
-    {0x8377, 0xBAC9}, // 荷
-    {0x8386, 0xC6CE}, // 莆
-    {0x8389, 0xC0F2}, // 莉
-    {0x838E, 0xC9AF}, // 莎
-    {0x83AB, 0xC4AA}, // 莫
-    {0x83B1, 0xC0B3}, // 莱
-    {0x83B2, 0xC1AB}, // 莲
-    {0x83B7, 0xBBF1}, // 获
-    {0x83B9, 0xD3A8}, // 莹
-    {0x83BD, 0xC3A7}, // 莽
-    {0x83C7, 0xB9BD}, // 菇
-    {0x83CA, 0xBED5}, // 菊
-    {0x83CC, 0xBEFA}, // 菌
-    {0x83CF, 0xBACA}, // 菏
-    {0x83DC, 0xB2CB}, // 菜
-    {0x83E0, 0xB2A4}, // 菠
-    {0x83E9, 0xC6D0}, // 菩
-    {0x83F1, 0xC1E2}, // 菱
-    {0x83F2, 0xB7C6}, // 菲
-    {0x8404, 0xCCD1}, // 萄
-    {0x840C, 0xC3C8}, // 萌
-    {0x840D, 0xC6BC}, // 萍
-    {0x840E, 0xCEAE}, // 萎
-    {0x841D, 0xC2DC}, // 萝
-    {0x8424, 0xD3A9}, // 萤
-    {0x8425, 0xD3AA}, // 营
-    {0x8427, 0xCFF4}, // 萧
-    {0x8428, 0xC8F8}, // 萨
-    {0x843D, 0xC2E4}, // 落
-    {0x8457, 0xD6F8}, // 著
-    {0x845B, 0xB8F0}, // 葛
-    {0x8461, 0xC6CF}, // 葡
-    {0x8463, 0xB6AD}, // 董
-    {0x846B, 0xBAF9}, // 葫
-    {0x846C, 0xD4E1}, // 葬
-    {0x8471, 0xB4D0}, // 葱
-    {0x8475, 0xBFFB}, // 葵
-    {0x8482, 0xB5D9}, // 蒂
-    {0x848B, 0xBDAF}, // 蒋
-    {0x8499, 0xC3C9}, // 蒙
-    {0x849C, 0xCBE2}, // 蒜
-    {0x84B2, 0xC6D1}, // 蒲
-    {0x84B8, 0xD5F4}, // 蒸
-    {0x84C4, 0xD0EE}, // 蓄
-    {0x84C9, 0xC8D8}, // 蓉
-    {0x84D1, 0xCBF2}, // 蓑
-    {0x84D6, 0xB1CD}, // 蓖
-    {0x84DD, 0xC0B6}, // 蓝
-    {0x84DF, 0xBCBB}, // 蓟
-    {0x84EC, 0xC5EE}, // 蓬
-    {0x8511, 0xC3EF}, // 蔑
-    {0x8513, 0xC2FB}, // 蔓
-    {0x8517, 0xD5E1}, // 蔗
-    {0x851A, 0xCEB5}, // 蔚
-    {0x8521, 0xB2CC}, // 蔡
-    {0x852B, 0xC4E8}, // 蔫
-    {0x852C, 0xCADF}, // 蔬
-    {0x8537, 0xC7BE}, // 蔷
-    {0x853C, 0xB0AA}, // 蔼
-    {0x853D, 0xB1CE}, // 蔽
-    {0x8549, 0xBDB6}, // 蕉
-    {0x854A, 0xC8EF}, // 蕊
-    {0x8574, 0xD4CC}, // 蕴
-    {0x857E, 0xC0D9}, // 蕾
-    {0x8584, 0xB1A1}, // 薄
-    {0x859B, 0xD1A6}, // 薛
-    {0x85AA, 0xD0BD}, // 薪
-    {0x85AF, 0xCAED}, // 薯
-    {0x85C9, 0xBDE5}, // 藉
-    {0x85CF, 0xB2D8}, // 藏
-    {0x85D0, 0xC3EA}, // 藐
-    {0x85D5, 0xC5BA}, // 藕
-    {0x85E4, 0xCCD9}, // 藤
-    {0x85E9, 0xB7AA}, // 藩
-    {0x85FB, 0xD4E5}, // 藻
-    {0x8611, 0xC4A2}, // 蘑
-    {0x8638, 0xD5BA}, // 蘸
-    {0x864E, 0xBBA2}, // 虎
-    {0x864F, 0xC2B2}, // 虏
-    {0x8650, 0xC5B0}, // 虐
-    {0x8651, 0xC2C7}, // 虑
-    {0x865A, 0xD0E9}, // 虚
-    {0x865E, 0xD3DD}, // 虞
-    {0x866B, 0xB3E6}, // 虫
-    {0x8671, 0xCAAD}, // 虱
-    {0x8679, 0xBAE7}, // 虹
-    {0x867D, 0xCBE4}, // 虽
-    {0x867E, 0xCFBA}, // 虾
-    {0x8680, 0xCAB4}, // 蚀
-    {0x8681, 0xD2CF}, // 蚁
-    {0x8682, 0xC2EC}, // 蚂
-    {0x868A, 0xCEC3}, // 蚊
-    {0x868C, 0xB0F6}, // 蚌
-    {0x8695, 0xB2CF}, // 蚕
-    {0x869C, 0xD1C1}, // 蚜
-    {0x86A4, 0xD4E9}, // 蚤
-    {0x86C0, 0xD6FB}, // 蛀
-    {0x86C6, 0xC7F9}, // 蛆
-    {0x86C7, 0xC9DF}, // 蛇
-    {0x86CA, 0xB9C6}, // 蛊
-    {0x86CB, 0xB5B0}, // 蛋
-    {0x86D4, 0xBBD7}, // 蛔
-    {0x86D9, 0xCDDC}, // 蛙
-    {0x86DB, 0xD6EB}, // 蛛
-    {0x86E4, 0xB8F2}, // 蛤
-    {0x86EE, 0xC2F9}, // 蛮
-    {0x86F0, 0xD5DD}, // 蛰
-    {0x86F9, 0xD3BC}, // 蛹
-    {0x86FE, 0xB6EA}, // 蛾
-    {0x8700, 0xCAF1}, // 蜀
-    {0x8702, 0xB7E4}, // 蜂
-    {0x8712, 0xD1D1}, // 蜒
-    {0x8715, 0xCDC9}, // 蜕
-    {0x8717, 0xCECF}, // 蜗
-    {0x8718, 0xD6A9}, // 蜘
-    {0x871C, 0xC3DB}, // 蜜
-    {0x8721, 0xC0AF}, // 蜡
-    {0x8747, 0xD3AC}, // 蝇
-    {0x8749, 0xB2F5}, // 蝉
-    {0x874E, 0xD0AB}, // 蝎
-    {0x8757, 0xBBC8}, // 蝗
-    {0x8774, 0xBAFB}, // 蝴
-    {0x8776, 0xB5FB}, // 蝶
-    {0x878D, 0xC8DA}, // 融
-    {0x879F, 0xC3F8}, // 螟
-    {0x87BA, 0xC2DD}, // 螺
-    {0x87F9, 0xD0B7}, // 蟹
-    {0x8815, 0xC8E4}, // 蠕
-    {0x8822, 0xB4C0}, // 蠢
-    {0x8840, 0xD1AA}, // 血
-    {0x8845, 0xD0C6}, // 衅
-    {0x884C, 0xD0D0}, // 行
-    {0x884D, 0xD1DC}, // 衍
-    {0x8854, 0xCFCE}, // 衔
-    {0x8857, 0xBDD6}, // 街
-    {0x8859, 0xD1C3}, // 衙
-    {0x8861, 0xBAE2}, // 衡
-    {0x8863, 0xD2C2}, // 衣
-    {0x8865, 0xB2B9}, // 补
-    {0x8868, 0xB1ED}, // 表
-    {0x886B, 0xC9C0}, // 衫
-    {0x886C, 0xB3C4}, // 衬
-    {0x8870, 0xCBA5}, // 衰
-    {0x8877, 0xD6D4}, // 衷
-    {0x8881, 0xD4AC}, // 袁
-    {0x8884, 0xB0C0}, // 袄
-    {0x888B, 0xB4FC}, // 袋
-    {0x888D, 0xC5DB}, // 袍
-    {0x8892, 0xCCBB}, // 袒
-    {0x8896, 0xD0E4}, // 袖
-    {0x889C, 0xCDE0}, // 袜
-    {0x88AB, 0xB1BB}, // 被
-    {0x88AD, 0xCFAE}, // 袭
-    {0x88B1, 0xB8A4}, // 袱
-    {0x88C1, 0xB2C3}, // 裁
-    {0x88C2, 0xC1D1}, // 裂
-    {0x88C5, 0xD7B0}, // 装
-    {0x88D4, 0xD2E1}, // 裔
-    {0x88D5, 0xD4A3}, // 裕
-    {0x88D9, 0xC8B9}, // 裙
-    {0x88E4, 0xBFE3}, // 裤
-    {0x88F3, 0xC9D1}, // 裳
-    {0x88F4, 0xC5E1}, // 裴
-    {0x88F8, 0xC2E3}, // 裸
-    {0x88F9, 0xB9FC}, // 裹
-    {0x8902, 0xB9D3}, // 褂
-    {0x8910, 0xBAD6}, // 褐
-    {0x8912, 0xB0FD}, // 褒
-    {0x8925, 0xC8EC}, // 褥
-    {0x892A, 0xCDCA}, // 褪
-    {0x8944, 0xCFE5}, // 襄
-    {0x895F, 0xBDF3}, // 襟
-    {0x897F, 0xCEF7}, // 西
-    {0x8981, 0xD2AA}, // 要
-    {0x8986, 0xB8B2}, // 覆
-    {0x89C1, 0xBCFB}, // 见
-    {0x89C2, 0xB9DB}, // 观
-    {0x89C4, 0xB9E6}, // 规
-    {0x89C5, 0xC3D9}, // 觅
-    {0x89C6, 0xCAD3}, // 视
-    {0x89C8, 0xC0C0}, // 览
-    {0x89C9, 0xBEF5}, // 觉
-    {0x89D2, 0xBDC7}, // 角
-    {0x89E3, 0xBDE2}, // 解
-    {0x89E6, 0xB4A5}, // 触
-    {0x8A00, 0xD1D4}, // 言
-    {0x8A79, 0xD5B2}, // 詹
-    {0x8A89, 0xD3FE}, // 誉
-    {0x8A8A, 0xCCDC}, // 誊
-    {0x8A93, 0xCAC4}, // 誓
-    {0x8B66, 0xBEAF}, // 警
-    {0x8B6C, 0xC6A9}, // 譬
-    {0x8BA1, 0xBCC6}, // 计
-    {0x8BA2, 0xB6A9}, // 订
-    {0x8BA3, 0xB8BC}, // 讣
-    {0x8BA4, 0xC8CF}, // 认
-    {0x8BA5, 0xBCA5}, // 讥
-    {0x8BA8, 0xCCD6}, // 讨
-    {0x8BA9, 0xC8C3}, // 让
-    {0x8BAB, 0xC6FD}, // 讫
-    {0x8BAD, 0xD1B5}, // 训
-    {0x8BAE, 0xD2E9}, // 议
-    {0x8BAF, 0xD1B6}, // 讯
-    {0x8BB0, 0xBCC7}, // 记
-    {0x8BB2, 0xBDB2}, // 讲
-    {0x8BB3, 0xBBE4}, // 讳
-    {0x8BB6, 0xD1C8}, // 讶
-    {0x8BB8, 0xD0ED}, // 许
-    {0x8BB9, 0xB6EF}, // 讹
-    {0x8BBA, 0xC2DB}, // 论
-    {0x8BBC, 0xCBCF}, // 讼
-    {0x8BBD, 0xB7ED}, // 讽
-    {0x8BBE, 0xC9E8}, // 设
-    {0x8BBF, 0xB7C3}, // 访
-    {0x8BC0, 0xBEF7}, // 诀
-    {0x8BC1, 0xD6A4}, // 证
-    {0x8BC4, 0xC6C0}, // 评
-    {0x8BC5, 0xD7E7}, // 诅
-    {0x8BC6, 0xCAB6}, // 识
-    {0x8BC8, 0xD5A9}, // 诈
-    {0x8BC9, 0xCBDF}, // 诉
-    {0x8BCA, 0xD5EF}, // 诊
-    {0x8BCC, 0xD6DF}, // 诌
-    {0x8BCD, 0xB4CA}, // 词
-    {0x8BD1, 0xD2EB}, // 译
-    {0x8BD5, 0xCAD4}, // 试
-    {0x8BD7, 0xCAAB}, // 诗
-    {0x8BDA, 0xB3CF}, // 诚
-    {0x8BDB, 0xD6EF}, // 诛
-    {0x8BDD, 0xBBB0}, // 话
-    {0x8BDE, 0xB5AE}, // 诞
-    {0x8BE1, 0xB9EE}, // 诡
-    {0x8BE2, 0xD1AF}, // 询
-    {0x8BE3, 0xD2E8}, // 诣
-    {0x8BE5, 0xB8C3}, // 该
-    {0x8BE6, 0xCFEA}, // 详
-    {0x8BE7, 0xB2EF}, // 诧
-    {0x8BEB, 0xBDEB}, // 诫
-    {0x8BEC, 0xCEDC}, // 诬
-    {0x8BED, 0xD3EF}, // 语
-    {0x8BEF, 0xCEF3}, // 误
-    {0x8BF1, 0xD3D5}, // 诱
-    {0x8BF2, 0xBBE5}, // 诲
-    {0x8BF4, 0xCBB5}, // 说
-    {0x8BF5, 0xCBD0}, // 诵
-    {0x8BF7, 0xC7EB}, // 请
-    {0x8BF8, 0xD6EE}, // 诸
-    {0x8BFA, 0xC5B5}, // 诺
-    {0x8BFB, 0xB6C1}, // 读
-    {0x8BFD, 0xB7CC}, // 诽
-    {0x8BFE, 0xBFCE}, // 课
-    {0x8C01, 0xCBAD}, // 谁
-    {0x8C03, 0xB5F7}, // 调
-    {0x8C05, 0xC1C2}, // 谅
-    {0x8C06, 0xD7BB}, // 谆
-    {0x8C08, 0xCCB8}, // 谈
-    {0x8C0A, 0xD2EA}, // 谊
-    {0x8C0B, 0xC4B1}, // 谋
-    {0x8C0D, 0xB5FD}, // 谍
-    {0x8C0E, 0xBBD1}, // 谎
-    {0x8C10, 0xD0B3}, // 谐
-    {0x8C13, 0xCEBD}, // 谓
-    {0x8C17, 0xB2F7}, // 谗
-    {0x8C1A, 0xD1E8}, // 谚
-    {0x8C1C, 0xC3D5}, // 谜
-    {0x8C22, 0xD0BB}, // 谢
-    {0x8C23, 0xD2A5}, // 谣
-    {0x8C24, 0xB0F9}, // 谤
-    {0x8C26, 0xC7AB}, // 谦
-    {0x8C28, 0xBDF7}, // 谨
-    {0x8C29, 0xC3A1}, // 谩
-    {0x8C2C, 0xC3FD}, // 谬
-    {0x8C2D, 0xCCB7}, // 谭
-    {0x8C30, 0xC0BE}, // 谰
-    {0x8C31, 0xC6D7}, // 谱
-    {0x8C34, 0xC7B4}, // 谴
-    {0x8C37, 0xB9C8}, // 谷
-    {0x8C41, 0xBBED}, // 豁
-    {0x8C46, 0xB6B9}, // 豆
-    {0x8C4C, 0xCDE3}, // 豌
-    {0x8C61, 0xCFF3}, // 象
-    {0x8C62, 0xBBBF}, // 豢
-    {0x8C6A, 0xBAC0}, // 豪
-    {0x8C6B, 0xD4A5}, // 豫
-    {0x8C79, 0xB1AA}, // 豹
-    {0x8C7A, 0xB2F2}, // 豺
-    {0x8C89, 0xBAD1}, // 貉
-    {0x8C8C, 0xC3B2}, // 貌
-    {0x8D1D, 0xB1B4}, // 贝
-    {0x8D1E, 0xD5EA}, // 贞
-    {0x8D1F, 0xB8BA}, // 负
-    {0x8D21, 0xB9B1}, // 贡
-    {0x8D22, 0xB2C6}, // 财
-    {0x8D23, 0xD4F0}, // 责
-    {0x8D24, 0xCFCD}, // 贤
-    {0x8D25, 0xB0DC}, // 败
-    {0x8D26, 0xD5CB}, // 账
-    {0x8D27, 0xBBF5}, // 货
-    {0x8D28, 0xD6CA}, // 质
-    {0x8D29, 0xB7B7}, // 贩
-    {0x8D2A, 0xCCB0}, // 贪
-    {0x8D2B, 0xC6B6}, // 贫
-    {0x8D2C, 0xB1E1}, // 贬
-    {0x8D2D, 0xB9BA}, // 购
-    {0x8D2E, 0xD6FC}, // 贮
-    {0x8D2F, 0xB9E1}, // 贯
-    {0x8D30, 0xB7A1}, // 贰
-    {0x8D31, 0xBCFA}, // 贱
-    {0x8D34, 0xCCF9}, // 贴
-    {0x8D35, 0xB9F3}, // 贵
-    {0x8D37, 0xB4FB}, // 贷
-    {0x8D38, 0xC3B3}, // 贸
-    {0x8D39, 0xB7D1}, // 费
-    {0x8D3A, 0xBAD8}, // 贺
-    {0x8D3C, 0xD4F4}, // 贼
-    {0x8D3E, 0xBCD6}, // 贾
-    {0x8D3F, 0xBBDF}, // 贿
-    {0x8D41, 0xC1DE}, // 赁
-    {0x8D42, 0xC2B8}, // 赂
-    {0x8D43, 0xD4DF}, // 赃
-    {0x8D44, 0xD7CA}, // 资
-    {0x8D4A, 0xC9DE}, // 赊
-    {0x8D4B, 0xB8B3}, // 赋
-    {0x8D4C, 0xB6C4}, // 赌
-    {0x8D4E, 0xCAEA}, // 赎
-    {0x8D4F, 0xC9CD}, // 赏
-    {0x8D50, 0xB4CD}, // 赐
-    {0x8D54, 0xC5E2}, // 赔
-    {0x8D56, 0xC0B5}, // 赖
-    {0x8D58, 0xD7B8}, // 赘
-    {0x8D5A, 0xD7AC}, // 赚
-    {0x8D5B, 0xC8FC}, // 赛
-    {0x8D5E, 0xD4DE}, // 赞
-    {0x8D60, 0xD4F9}, // 赠
-    {0x8D61, 0xC9C4}, // 赡
-    {0x8D62, 0xD3AE}, // 赢
-    {0x8D63, 0xB8D3}, // 赣
-    {0x8D64, 0xB3E0}, // 赤
-    {0x8D66, 0xC9E2}, // 赦
-    {0x8D6B, 0xBAD5}, // 赫
-    {0x8D70, 0xD7DF}, // 走
-    {0x8D74, 0xB8B0}, // 赴
-    {0x8D75, 0xD5D4}, // 赵
-    {0x8D76, 0xB8CF}, // 赶
-    {0x8D77, 0xC6F0}, // 起
-    {0x8D81, 0xB3C3}, // 趁
-    {0x8D85, 0xB3AC}, // 超
-    {0x8D8A, 0xD4BD}, // 越
-    {0x8D8B, 0xC7F7}, // 趋
-    {0x8D9F, 0xCCCB}, // 趟
-    {0x8DA3, 0xC8A4}, // 趣
-    {0x8DB3, 0xD7E3}, // 足
-    {0x8DB4, 0xC5BF}, // 趴
-    {0x8DBE, 0xD6BA}, // 趾
-    {0x8DC3, 0xD4BE}, // 跃
-    {0x8DCB, 0xB0CF}, // 跋
-    {0x8DCC, 0xB5F8}, // 跌
-    {0x8DD1, 0xC5DC}, // 跑
-    {0x8DDD, 0xBEE0}, // 距
-    {0x8DDF, 0xB8FA}, // 跟
-    {0x8DE8, 0xBFE7}, // 跨
-    {0x8DEA, 0xB9F2}, // 跪
-    {0x8DEF, 0xC2B7}, // 路
-    {0x8DF3, 0xCCF8}, // 跳
-    {0x8DF5, 0xBCF9}, // 践
-    {0x8DFA, 0xB6E5}, // 跺
-    {0x8E0A, 0xD3BB}, // 踊
-    {0x8E0C, 0xB3EC}, // 踌
-    {0x8E0F, 0xCCA4}, // 踏
-    {0x8E1E, 0xBEE1}, // 踞
-    {0x8E22, 0xCCDF}, // 踢
-    {0x8E29, 0xB2C8}, // 踩
-    {0x8E2A, 0xD7D9}, // 踪
-    {0x8E44, 0xCCE3}, // 蹄
-    {0x8E48, 0xB5B8}, // 蹈
-    {0x8E4B, 0xCCA3}, // 蹋
-    {0x8E66, 0xB1C4}, // 蹦
-    {0x8E6C, 0xB5C5}, // 蹬
-    {0x8E6D, 0xB2E4}, // 蹭
-    {0x8E72, 0xB6D7}, // 蹲
-    {0x8E7F, 0xB4DA}, // 蹿
-    {0x8E81, 0xD4EA}, // 躁
-    {0x8E87, 0xB3F9}, // 躇
-    {0x8EAB, 0xC9ED}, // 身
-    {0x8EAC, 0xB9AA}, // 躬
-    {0x8EAF, 0xC7FB}, // 躯
-    {0x8EB2, 0xB6E3}, // 躲
-    {0x8EBA, 0xCCC9}, // 躺
-    {0x8F66, 0xB3B5}, // 车
-    {0x8F67, 0xD4FE}, // 轧
-    {0x8F68, 0xB9EC}, // 轨
-    {0x8F69, 0xD0F9}, // 轩
-    {0x8F6C, 0xD7AA}, // 转
-    {0x8F6E, 0xC2D6}, // 轮
-    {0x8F6F, 0xC8ED}, // 软
-    {0x8F70, 0xBAE4}, // 轰
-    {0x8F74, 0xD6E1}, // 轴
-    {0x8F7B, 0xC7E1}, // 轻
-    {0x8F7D, 0xD4D8}, // 载
-    {0x8F7F, 0xBDCE}, // 轿
-    {0x8F83, 0xBDCF}, // 较
-    {0x8F85, 0xB8A8}, // 辅
-    {0x8F86, 0xC1BE}, // 辆
-    {0x8F88, 0xB1B2}, // 辈
-    {0x8F89, 0xBBD4}, // 辉
-    {0x8F8A, 0xB9F5}, // 辊
-    {0x8F90, 0xB7F8}, // 辐
-    {0x8F91, 0xBCAD}, // 辑
-    {0x8F93, 0xCAE4}, // 输
-    {0x8F95, 0xD4AF}, // 辕
-    {0x8F96, 0xCFBD}, // 辖
-    {0x8F97, 0xD5B7}, // 辗
-    {0x8F99, 0xD5DE}, // 辙
-    {0x8F9B, 0xD0C1}, // 辛
-    {0x8F9C, 0xB9BC}, // 辜
-    {0x8F9E, 0xB4C7}, // 辞
-    {0x8F9F, 0xB1D9}, // 辟
-    {0x8FA3, 0xC0B1}, // 辣
-    {0x8FA8, 0xB1E6}, // 辨
-    {0x8FA9, 0xB1E7}, // 辩
-    {0x8FAB, 0xB1E8}, // 辫
-    {0x8FB0, 0xB3BD}, // 辰
-    {0x8FB1, 0xC8E8}, // 辱
-    {0x8FB9, 0xB1DF}, // 边
-    {0x8FBD, 0xC1C9}, // 辽
-    {0x8FBE, 0xB4EF}, // 达
-    {0x8FC1, 0xC7A8}, // 迁
-    {0x8FC2, 0xD3D8}, // 迂
-    {0x8FC4, 0xC6F9}, // 迄
-    {0x8FC5, 0xD1B8}, // 迅
-    {0x8FC7, 0xB9FD}, // 过
-    {0x8FC8, 0xC2F5}, // 迈
-    {0x8FCE, 0xD3AD}, // 迎
-    {0x8FD0, 0xD4CB}, // 运
-    {0x8FD1, 0xBDFC}, // 近
-    {0x8FD4, 0xB7B5}, // 返
-    {0x8FD8, 0xBBB9}, // 还
-    {0x8FD9, 0xD5E2}, // 这
-    {0x8FDB, 0xBDF8}, // 进
-    {0x8FDC, 0xD4B6}, // 远
-    {0x8FDD, 0xCEA5}, // 违
-    {0x8FDE, 0xC1AC}, // 连
-    {0x8FDF, 0xB3D9}, // 迟
-    {0x8FE2, 0xCCF6}, // 迢
-    {0x8FEA, 0xB5CF}, // 迪
-    {0x8FEB, 0xC6C8}, // 迫
-    {0x8FED, 0xB5FC}, // 迭
-    {0x8FF0, 0xCAF6}, // 述
-    {0x8FF7, 0xC3D4}, // 迷
-    {0x8FF8, 0xB1C5}, // 迸
-    {0x8FF9, 0xBCA3}, // 迹
-    {0x8FFD, 0xD7B7}, // 追
-    {0x9000, 0xCDCB}, // 退
-    {0x9001, 0xCBCD}, // 送
-    {0x9002, 0xCACA}, // 适
-    {0x9003, 0xCCD3}, // 逃
-    {0x9006, 0xC4E6}, // 逆
-    {0x9009, 0xD1A1}, // 选
-    {0x900A, 0xD1B7}, // 逊
-    {0x900F, 0xCDB8}, // 透
-    {0x9010, 0xD6F0}, // 逐
-    {0x9012, 0xB5DD}, // 递
-    {0x9014, 0xCDBE}, // 途
-    {0x9017, 0xB6BA}, // 逗
-    {0x901A, 0xCDA8}, // 通
-    {0x901B, 0xB9E4}, // 逛
-    {0x901D, 0xCAC5}, // 逝
-    {0x901E, 0xB3D1}, // 逞
-    {0x901F, 0xCBD9}, // 速
-    {0x9020, 0xD4EC}, // 造
-    {0x9022, 0xB7EA}, // 逢
-    {0x902E, 0xB4FE}, // 逮
-    {0x9038, 0xD2DD}, // 逸
-    {0x903B, 0xC2DF}, // 逻
-    {0x903C, 0xB1C6}, // 逼
-    {0x903E, 0xD3E2}, // 逾
-    {0x9041, 0xB6DD}, // 遁
-    {0x9042, 0xCBEC}, // 遂
-    {0x9047, 0xD3F6}, // 遇
-    {0x904D, 0xB1E9}, // 遍
-    {0x904F, 0xB6F4}, // 遏
-    {0x9053, 0xB5C0}, // 道
-    {0x9057, 0xD2C5}, // 遗
-    {0x9063, 0xC7B2}, // 遣
-    {0x9065, 0xD2A3}, // 遥
-    {0x906D, 0xD4E2}, // 遭
-    {0x906E, 0xD5DA}, // 遮
-    {0x9075, 0xD7F1}, // 遵
-    {0x907F, 0xB1DC}, // 避
-    {0x9080, 0xD1FB}, // 邀
-    {0x9091, 0xD2D8}, // 邑
-    {0x9093, 0xB5CB}, // 邓
-    {0x90A2, 0xD0CF}, // 邢
-    {0x90A3, 0xC4C7}, // 那
-    {0x90A6, 0xB0EE}, // 邦
-    {0x90AA, 0xD0B0}, // 邪
-    {0x90AE, 0xD3CA}, // 邮
-    {0x90AF, 0xBAAA}, // 邯
-    {0x90B1, 0xC7F1}, // 邱
-    {0x90B5, 0xC9DB}, // 邵
-    {0x90B9, 0xD7DE}, // 邹
-    {0x90BB, 0xC1DA}, // 邻
-    {0x90C1, 0xD3F4}, // 郁
-    {0x90CA, 0xBDBC}, // 郊
-    {0x90CE, 0xC0C9}, // 郎
-    {0x90D1, 0xD6A3}, // 郑
-    {0x90DD, 0xBAC2}, // 郝
-    {0x90E1, 0xBFA4}, // 郡
-    {0x90E7, 0xD4C7}, // 郧
-    {0x90E8, 0xB2BF}, // 部
-    {0x90ED, 0xB9F9}, // 郭
-    {0x90F4, 0xB3BB}, // 郴
-    {0x90F8, 0xB5A6}, // 郸
-    {0x90FD, 0xB6BC}, // 都
-    {0x9102, 0xB6F5}, // 鄂
-    {0x9119, 0xB1C9}, // 鄙
-    {0x9149, 0xD3CF}, // 酉
-    {0x914B, 0xC7F5}, // 酋
-    {0x914C, 0xD7C3}, // 酌
-    {0x914D, 0xC5E4}, // 配
-    {0x9152, 0xBEC6}, // 酒
-    {0x9157, 0xD0EF}, // 酗
-    {0x915A, 0xB7D3}, // 酚
-    {0x915D, 0xD4CD}, // 酝
-    {0x915E, 0xCCAA}, // 酞
-    {0x9163, 0xBAA8}, // 酣
-    {0x9165, 0xCBD6}, // 酥
-    {0x916A, 0xC0D2}, // 酪
-    {0x916C, 0xB3EA}, // 酬
-    {0x916E, 0xCDAA}, // 酮
-    {0x9171, 0xBDB4}, // 酱
-    {0x9175, 0xBDCD}, // 酵
-    {0x9176, 0xC3B8}, // 酶
-    {0x9177, 0xBFE1}, // 酷
-    {0x9178, 0xCBE1}, // 酸
-    {0x917F, 0xC4F0}, // 酿
-    {0x9187, 0xB4BC}, // 醇
-    {0x9189, 0xD7ED}, // 醉
-    {0x918B, 0xB4D7}, // 醋
-    {0x9192, 0xD0D1}, // 醒
-    {0x919A, 0xC3D1}, // 醚
-    {0x919B, 0xC8A9}, // 醛
-    {0x91C7, 0xB2C9}, // 采
-    {0x91C9, 0xD3D4}, // 釉
-    {0x91CA, 0xCACD}, // 释
-    {0x91CC, 0xC0EF}, // 里
-    {0x91CD, 0xD6D8}, // 重
-    {0x91CE, 0xD2B0}, // 野
-    {0x91CF, 0xC1BF}, // 量
-    {0x91D1, 0xBDF0}, // 金
-    {0x91DC, 0xB8AA}, // 釜
-    {0x9274, 0xBCF8}, // 鉴
-    {0x9488, 0xD5EB}, // 针
-    {0x9489, 0xB6A4}, // 钉
-    {0x948E, 0xC7A5}, // 钎
-    {0x9492, 0xB7B0}, // 钒
-    {0x9493, 0xB5F6}, // 钓
-    {0x9499, 0xB8C6}, // 钙
-    {0x949D, 0xB6DB}, // 钝
-    {0x949E, 0xB3AE}, // 钞
-    {0x949F, 0xD6D3}, // 钟
-    {0x94A0, 0xC4C6}, // 钠
-    {0x94A1, 0xB1B5}, // 钡
-    {0x94A2, 0xB8D6}, // 钢
-    {0x94A5, 0xD4BF}, // 钥
-    {0x94A6, 0xC7D5}, // 钦
-    {0x94A7, 0xBEFB}, // 钧
-    {0x94A8, 0xCED9}, // 钨
-    {0x94A9, 0xB9B3}, // 钩
-    {0x94AE, 0xC5A5}, // 钮
-    {0x94B1, 0xC7AE}, // 钱
-    {0x94B3, 0xC7AF}, // 钳
-    {0x94B5, 0xB2A7}, // 钵
-    {0x94BB, 0xD7EA}, // 钻
-    {0x94BE, 0xBCD8}, // 钾
-    {0x94C0, 0xD3CB}, // 铀
-    {0x94C1, 0xCCFA}, // 铁
-    {0x94C2, 0xB2AC}, // 铂
-    {0x94C3, 0xC1E5}, // 铃
-    {0x94C5, 0xC7A6}, // 铅
-    {0x94C6, 0xC3AD}, // 铆
-    {0x94DC, 0xCDAD}, // 铜
-    {0x94DD, 0xC2C1}, // 铝
-    {0x94E1, 0xD5A1}, // 铡
-    {0x94E3, 0xCFB3}, // 铣
-    {0x94EC, 0xB8F5}, // 铬
-    {0x94ED, 0xC3FA}, // 铭
-    {0x94F0, 0xBDC2}, // 铰
-    {0x94F1, 0xD2BF}, // 铱
-    {0x94F2, 0xB2F9}, // 铲
-    {0x94F6, 0xD2F8}, // 银
-    {0x94F8, 0xD6FD}, // 铸
-    {0x94FA, 0xC6CC}, // 铺
-    {0x94FE, 0xC1B4}, // 链
-    {0x9500, 0xCFFA}, // 销
-    {0x9501, 0xCBF8}, // 锁
-    {0x9504, 0xB3FA}, // 锄
-    {0x9505, 0xB9F8}, // 锅
-    {0x9508, 0xD0E2}, // 锈
-    {0x950B, 0xB7E6}, // 锋
-    {0x950C, 0xD0BF}, // 锌
-    {0x9510, 0xC8F1}, // 锐
-    {0x9511, 0xCCE0}, // 锑
-    {0x9517, 0xD5E0}, // 锗
-    {0x9519, 0xB4ED}, // 错
-    {0x951A, 0xC3AA}, // 锚
-    {0x9521, 0xCEFD}, // 锡
-    {0x9523, 0xC2E0}, // 锣
-    {0x9524, 0xB4B8}, // 锤
-    {0x9525, 0xD7B6}, // 锥
-    {0x9526, 0xBDF5}, // 锦
-    {0x9528, 0xCFC7}, // 锨
-    {0x952D, 0xB6A7}, // 锭
-    {0x952E, 0xBCFC}, // 键
-    {0x952F, 0xBEE2}, // 锯
-    {0x9530, 0xC3CC}, // 锰
-    {0x9539, 0xC7C2}, // 锹
-    {0x953B, 0xB6CD}, // 锻
-    {0x9540, 0xB6C6}, // 镀
-    {0x9541, 0xC3BE}, // 镁
-    {0x9547, 0xD5F2}, // 镇
-    {0x954A, 0xC4F7}, // 镊
-    {0x954D, 0xC4F8}, // 镍
-    {0x9550, 0xB8E4}, // 镐
-    {0x9551, 0xB0F7}, // 镑
-    {0x955C, 0xBEB5}, // 镜
-    {0x9563, 0xC1CD}, // 镣
-    {0x956D, 0xC0D8}, // 镭
-    {0x9570, 0xC1AD}, // 镰
-    {0x9576, 0xCFE2}, // 镶
-    {0x957F, 0xB3A4}, // 长
-    {0x95E8, 0xC3C5}, // 门
-    {0x95EA, 0xC9C1}, // 闪
-    {0x95ED, 0xB1D5}, // 闭
-    {0x95EE, 0xCECA}, // 问
-    {0x95EF, 0xB4B3}, // 闯
-    {0x95F0, 0xC8F2}, // 闰
-    {0x95F2, 0xCFD0}, // 闲
-    {0x95F4, 0xBCE4}, // 间
-    {0x95F7, 0xC3C6}, // 闷
-    {0x95F8, 0xD5A2}, // 闸
-    {0x95F9, 0xC4D6}, // 闹
-    {0x95FA, 0xB9EB}, // 闺
-    {0x95FB, 0xCEC5}, // 闻
-    {0x95FD, 0xC3F6}, // 闽
-    {0x9600, 0xB7A7}, // 阀
-    {0x9601, 0xB8F3}, // 阁
-    {0x9602, 0xBAD2}, // 阂
-    {0x9605, 0xD4C4}, // 阅
-    {0x9609, 0xD1CB}, // 阉
-    {0x960E, 0xD1D6}, // 阎
-    {0x9610, 0xB2FB}, // 阐
-    {0x9611, 0xC0BB}, // 阑
-    {0x9614, 0xC0AB}, // 阔
-    {0x961C, 0xB8B7}, // 阜
-    {0x961F, 0xB6D3}, // 队
-    {0x962E, 0xC8EE}, // 阮
-    {0x9632, 0xB7C0}, // 防
-    {0x9633, 0xD1F4}, // 阳
-    {0x9634, 0xD2F5}, // 阴
-    {0x9635, 0xD5F3}, // 阵
-    {0x9636, 0xBDD7}, // 阶
-    {0x963B, 0xD7E8}, // 阻
-    {0x963F, 0xB0A2}, // 阿
-    {0x9640, 0xCDD3}, // 陀
-    {0x9644, 0xB8BD}, // 附
-    {0x9645, 0xBCCA}, // 际
-    {0x9646, 0xC2BD}, // 陆
-    {0x9647, 0xC2A4}, // 陇
-    {0x9648, 0xB3C2}, // 陈
-    {0x964B, 0xC2AA}, // 陋
-    {0x964C, 0xC4B0}, // 陌
-    {0x964D, 0xBDB5}, // 降
-    {0x9650, 0xCFDE}, // 限
-    {0x9655, 0xC9C2}, // 陕
-    {0x965B, 0xB1DD}, // 陛
-    {0x9661, 0xB6B8}, // 陡
-    {0x9662, 0xD4BA}, // 院
-    {0x9664, 0xB3FD}, // 除
-    {0x9668, 0xD4C9}, // 陨
-    {0x9669, 0xCFD5}, // 险
-    {0x966A, 0xC5E3}, // 陪
-    {0x9675, 0xC1EA}, // 陵
-    {0x9676, 0xCCD5}, // 陶
-    {0x9677, 0xCFDD}, // 陷
-    {0x9685, 0xD3E7}, // 隅
-    {0x9686, 0xC2A1}, // 隆
-    {0x968B, 0xCBE5}, // 隋
-    {0x968F, 0xCBE6}, // 随
-    {0x9690, 0xD2FE}, // 隐
-    {0x9694, 0xB8F4}, // 隔
-    {0x9698, 0xB0AF}, // 隘
-    {0x9699, 0xCFB6}, // 隙
-    {0x969C, 0xD5CF}, // 障
-    {0x96A7, 0xCBED}, // 隧
-    {0x96B6, 0xC1A5}, // 隶
-    {0x96BE, 0xC4D1}, // 难
-    {0x96C0, 0xC8B8}, // 雀
-    {0x96C1, 0xD1E3}, // 雁
-    {0x96C4, 0xD0DB}, // 雄
-    {0x96C5, 0xD1C5}, // 雅
-    {0x96C6, 0xBCAF}, // 集
-    {0x96C7, 0xB9CD}, // 雇
-    {0x96CC, 0xB4C6}, // 雌
-    {0x96CD, 0xD3BA}, // 雍
-    {0x96CF, 0xB3FB}, // 雏
-    {0x96D5, 0xB5F1}, // 雕
-    {0x96E8, 0xD3EA}, // 雨
-    {0x96EA, 0xD1A9}, // 雪
-    {0x96F6, 0xC1E3}, // 零
-    {0x96F7, 0xC0D7}, // 雷
-    {0x96F9, 0xB1A2}, // 雹
-    {0x96FE, 0xCEED}, // 雾
-    {0x9700, 0xD0E8}, // 需
-    {0x9704, 0xCFF6}, // 霄
-    {0x9707, 0xD5F0}, // 震
-    {0x9709, 0xC3B9}, // 霉
-    {0x970D, 0xBBF4}, // 霍
-    {0x9713, 0xC4DE}, // 霓
-    {0x9716, 0xC1D8}, // 霖
-    {0x971C, 0xCBAA}, // 霜
-    {0x971E, 0xCFBC}, // 霞
-    {0x9732, 0xC2B6}, // 露
-    {0x9738, 0xB0D4}, // 霸
-    {0x9739, 0xC5F9}, // 霹
-    {0x9752, 0xC7E0}, // 青
-    {0x9756, 0xBEB8}, // 靖
-    {0x9759, 0xBEB2}, // 静
-    {0x975B, 0xB5E5}, // 靛
-    {0x975E, 0xB7C7}, // 非
-    {0x9760, 0xBFBF}, // 靠
-    {0x9761, 0xC3D2}, // 靡
-    {0x9762, 0xC3E6}, // 面
-    {0x9769, 0xB8EF}, // 革
-    {0x9773, 0xBDF9}, // 靳
-    {0x9774, 0xD1A5}, // 靴
-    {0x9776, 0xB0D0}, // 靶
-    {0x978B, 0xD0AC}, // 鞋
-    {0x978D, 0xB0B0}, // 鞍
-    {0x9798, 0xC7CA}, // 鞘
-    {0x97A0, 0xBECF}, // 鞠
-    {0x97AD, 0xB1DE}, // 鞭
-    {0x97E6, 0xCEA4}, // 韦
-    {0x97E7, 0xC8CD}, // 韧
-    {0x97E9, 0xBAAB}, // 韩
-    {0x97ED, 0xBEC2}, // 韭
-    {0x97F3, 0xD2F4}, // 音
-    {0x97F5, 0xD4CF}, // 韵
-    {0x97F6, 0xC9D8}, // 韶
-    {0x9875, 0xD2B3}, // 页
-    {0x9876, 0xB6A5}, // 顶
-    {0x9877, 0xC7EA}, // 顷
-    {0x9879, 0xCFEE}, // 项
-    {0x987A, 0xCBB3}, // 顺
-    {0x987B, 0xD0EB}, // 须
-    {0x987D, 0xCDE7}, // 顽
-    {0x987E, 0xB9CB}, // 顾
-    {0x987F, 0xB6D9}, // 顿
-    {0x9881, 0xB0E4}, // 颁
-    {0x9882, 0xCBCC}, // 颂
-    {0x9884, 0xD4A4}, // 预
-    {0x9885, 0xC2AD}, // 颅
-    {0x9886, 0xC1EC}, // 领
-    {0x9887, 0xC6C4}, // 颇
-    {0x9888, 0xBEB1}, // 颈
-    {0x988A, 0xBCD5}, // 颊
-    {0x9890, 0xD2C3}, // 颐
-    {0x9891, 0xC6B5}, // 频
-    {0x9893, 0xCDC7}, // 颓
-    {0x9896, 0xD3B1}, // 颖
-    {0x9897, 0xBFC5}, // 颗
-    {0x9898, 0xCCE2}, // 题
-    {0x989C, 0xD1D5}, // 颜
-    {0x989D, 0xB6EE}, // 额
-    {0x98A0, 0xB5DF}, // 颠
-    {0x98A4, 0xB2FC}, // 颤
-    {0x98A7, 0xC8A7}, // 颧
-    {0x98CE, 0xB7E7}, // 风
-    {0x98D8, 0xC6AE}, // 飘
-    {0x98DE, 0xB7C9}, // 飞
-    {0x98DF, 0xCAB3}, // 食
-    {0x9910, 0xB2CD}, // 餐
-    {0x9965, 0xBCA2}, // 饥
-    {0x996D, 0xB7B9}, // 饭
-    {0x996E, 0xD2FB}, // 饮
-    {0x996F, 0xBDA4}, // 饯
-    {0x9970, 0xCACE}, // 饰
-    {0x9971, 0xB1A5}, // 饱
-    {0x9972, 0xCBC7}, // 饲
-    {0x9975, 0xB6FC}, // 饵
-    {0x9976, 0xC8C4}, // 饶
-    {0x997A, 0xBDC8}, // 饺
-    {0x997C, 0xB1FD}, // 饼
-    {0x997F, 0xB6F6}, // 饿
-    {0x9981, 0xC4D9}, // 馁
-    {0x9985, 0xCFDA}, // 馅
-    {0x9986, 0xB9DD}, // 馆
-    {0x9988, 0xC0A1}, // 馈
-    {0x998B, 0xB2F6}, // 馋
-    {0x998F, 0xC1F3}, // 馏
-    {0x9992, 0xC2F8}, // 馒
-    {0x9996, 0xCAD7}, // 首
-    {0x9999, 0xCFE3}, // 香
-    {0x9A6C, 0xC2ED}, // 马
-    {0x9A6D, 0xD4A6}, // 驭
-    {0x9A6E, 0xCDD4}, // 驮
-    {0x9A6F, 0xD1B1}, // 驯
-    {0x9A70, 0xB3DB}, // 驰
-    {0x9A71, 0xC7FD}, // 驱
-    {0x9A73, 0xB2B5}, // 驳
-    {0x9A74, 0xC2BF}, // 驴
-    {0x9A76, 0xCABB}, // 驶
-    {0x9A79, 0xBED4}, // 驹
-    {0x9A7B, 0xD7A4}, // 驻
-    {0x9A7C, 0xCDD5}, // 驼
-    {0x9A7E, 0xBCDD}, // 驾
-    {0x9A82, 0xC2EE}, // 骂
-    {0x9A84, 0xBDBE}, // 骄
-    {0x9A86, 0xC2E6}, // 骆
-    {0x9A87, 0xBAA7}, // 骇
-    {0x9A8B, 0xB3D2}, // 骋
-    {0x9A8C, 0xD1E9}, // 验
-    {0x9A8F, 0xBFA5}, // 骏
-    {0x9A91, 0xC6EF}, // 骑
-    {0x9A97, 0xC6AD}, // 骗
-    {0x9A9A, 0xC9A7}, // 骚
-    {0x9AA1, 0xC2E2}, // 骡
-    {0x9AA4, 0xD6E8}, // 骤
-    {0x9AA8, 0xB9C7}, // 骨
-    {0x9AB8, 0xBAA1}, // 骸
-    {0x9AD3, 0xCBE8}, // 髓
-    {0x9AD8, 0xB8DF}, // 高
-    {0x9B03, 0xD7D7}, // 鬃
-    {0x9B3C, 0xB9ED}, // 鬼
-    {0x9B41, 0xBFFD}, // 魁
-    {0x9B42, 0xBBEA}, // 魂
-    {0x9B44, 0xC6C7}, // 魄
-    {0x9B4F, 0xCEBA}, // 魏
-    {0x9B54, 0xC4A7}, // 魔
-    {0x9C7C, 0xD3E3}, // 鱼
-    {0x9C81, 0xC2B3}, // 鲁
-    {0x9C8D, 0xB1AB}, // 鲍
-    {0x9C9C, 0xCFCA}, // 鲜
-    {0x9CA4, 0xC0F0}, // 鲤
-    {0x9CB8, 0xBEA8}, // 鲸
-    {0x9CC3, 0xC8FA}, // 鳃
-    {0x9CD6, 0xB1EE}, // 鳖
-    {0x9CDE, 0xC1DB}, // 鳞
-    {0x9E1F, 0xC4F1}, // 鸟
-    {0x9E21, 0xBCA6}, // 鸡
-    {0x9E23, 0xC3F9}, // 鸣
-    {0x9E25, 0xC5B8}, // 鸥
-    {0x9E26, 0xD1BB}, // 鸦
-    {0x9E2D, 0xD1BC}, // 鸭
-    {0x9E2F, 0xD1EC}, // 鸯
-    {0x9E33, 0xD4A7}, // 鸳
-    {0x9E35, 0xCDD2}, // 鸵
-    {0x9E3D, 0xB8EB}, // 鸽
-    {0x9E3F, 0xBAE8}, // 鸿
-    {0x9E43, 0xBEE9}, // 鹃
-    {0x9E45, 0xB6EC}, // 鹅
-    {0x9E4A, 0xC8B5}, // 鹊
-    {0x9E4F, 0xC5F4}, // 鹏
-    {0x9E64, 0xBAD7}, // 鹤
-    {0x9E70, 0xD3A5}, // 鹰
-    {0x9E7F, 0xC2B9}, // 鹿
-    {0x9E93, 0xC2B4}, // 麓
-    {0x9EA6, 0xC2F3}, // 麦
-    {0x9EBB, 0xC2E9}, // 麻
-    {0x9EC4, 0xBBC6}, // 黄
-    {0x9ECD, 0xCAF2}, // 黍
-    {0x9ECE, 0xC0E8}, // 黎
-    {0x9ED1, 0xBADA}, // 黑
-    {0x9ED4, 0xC7AD}, // 黔
-    {0x9ED8, 0xC4AC}, // 默
-    {0x9F0E, 0xB6A6}, // 鼎
-    {0x9F13, 0xB9C4}, // 鼓
-    {0x9F20, 0xCAF3}, // 鼠
-    {0x9F3B, 0xB1C7}, // 鼻
-    {0x9F50, 0xC6EB}, // 齐
-    {0x9F7F, 0xB3DD}, // 齿
-    {0x9F84, 0xC1E4}, // 龄
-    {0x9F8B, 0xC8A3}, // 龋
-    {0x9F99, 0xC1FA}, // 龙
-    {0x9F9A, 0xB9A8}, // 龚
-    {0x9F9F, 0xB9EA}, // 龟
+// 按Unicode排序的GB2312编码
+static const uint16_t gb2312_codes[MAP_TABLE_SIZE] = {
+    0xD2BB, // 一 U+4E00
+    0xB6A1, // 丁 U+4E01
+    0xC6DF, // 七 U+4E03
+    0xCDF2, // 万 U+4E07
+    0xD5C9, // 丈 U+4E08
+    0xC8FD, // 三 U+4E09
+    0xC9CF, // 上 U+4E0A
+    0xCFC2, // 下 U+4E0B
+    0xB2BB, // 不 U+4E0D
+    0xD3EB, // 与 U+4E0E
+    0xB3F3, // 丑 U+4E11
+    0xD7A8, // 专 U+4E13
+    0xC7D2, // 且 U+4E14
+    0xCAC0, // 世 U+4E16
+    0xC7F0, // 丘 U+4E18
+    0xB1FB, // 丙 U+4E19
+    0xD2B5, // 业 U+4E1A
+    0xB4D4, // 丛 U+4E1B
+    0xB6AB, // 东 U+4E1C
+    0xCBBF, // 丝 U+4E1D
+    0xB6AA, // 丢 U+4E22
+    0xC1BD, // 两 U+4E24
+    0xD1CF, // 严 U+4E25
+    0xC9A5, // 丧 U+4E27
+    0xB8F6, // 个 U+4E2A
+    0xD1BE, // 丫 U+4E2B
+    0xD6D0, // 中 U+4E2D
+    0xB7E1, // 丰 U+4E30
+    0xB4AE, // 串 U+4E32
+    0xC1D9, // 临 U+4E34
+    0xCDE8, // 丸 U+4E38
+    0xB5A4, // 丹 U+4E39
+    0xCEAA, // 为 U+4E3A
+    0xD6F7, // 主 U+4E3B
+    0xC0F6, // 丽 U+4E3D
+    0xBED9, // 举 U+4E3E
+    0xC4CB, // 乃 U+4E43
+    0xBEC3, // 久 U+4E45
+    0xC3B4, // 么 U+4E48
+    0xD2E5, // 义 U+4E49
+    0xD6AE, // 之 U+4E4B
+    0xCEDA, // 乌 U+4E4C
+    0xD5A7, // 乍 U+4E4D
+    0xBAF5, // 乎 U+4E4E
+    0xB7A6, // 乏 U+4E4F
+    0xC0D6, // 乐 U+4E50
+    0xC6B9, // 乒 U+4E52
+    0xC5D2, // 乓 U+4E53
+    0xC7C7, // 乔 U+4E54
+    0xB9D4, // 乖 U+4E56
+    0xB3CB, // 乘 U+4E58
+    0xD2D2, // 乙 U+4E59
+    0xBEC5, // 九 U+4E5D
+    0xC6F2, // 乞 U+4E5E
+    0xD2B2, // 也 U+4E5F
+    0xCFB0, // 习 U+4E60
+    0xCFE7, // 乡 U+4E61
+    0xCAE9, // 书 U+4E66
+    0xC2F2, // 买 U+4E70
+    0xC2D2, // 乱 U+4E71
+    0xC8E9, // 乳 U+4E73
+    0xC7AC, // 乾 U+4E7E
+    0xC1CB, // 了 U+4E86
+    0xD3E8, // 予 U+4E88
+    0xD5F9, // 争 U+4E89
+    0xCAC2, // 事 U+4E8B
+    0xB6FE, // 二 U+4E8C
+    0xD3DA, // 于 U+4E8E
+    0xBFF7, // 亏 U+4E8F
+    0xD4C6, // 云 U+4E91
+    0xBBA5, // 互 U+4E92
+    0xCEE5, // 五 U+4E94
+    0xBEAE, // 井 U+4E95
+    0xD1C7, // 亚 U+4E9A
+    0xD0A9, // 些 U+4E9B
+    0xCDF6, // 亡 U+4EA1
+    0xBFBA, // 亢 U+4EA2
+    0xBDBB, // 交 U+4EA4
+    0xBAA5, // 亥 U+4EA5
+    0xD2E0, // 亦 U+4EA6
+    0xB2FA, // 产 U+4EA7
+    0xBAE0, // 亨 U+4EA8
+    0xC4B6, // 亩 U+4EA9
+    0xCFED, // 享 U+4EAB
+    0xBEA9, // 京 U+4EAC
+    0xCDA4, // 亭 U+4EAD
+    0xC1C1, // 亮 U+4EAE
+    0xC7D7, // 亲 U+4EB2
+    0xC8CB, // 人 U+4EBA
+    0xD2DA, // 亿 U+4EBF
+    0xCAB2, // 什 U+4EC0
+    0xC8CA, // 仁 U+4EC1
+    0xBDF6, // 仅 U+4EC5
+    0xC6CD, // 仆 U+4EC6
+    0xB3F0, // 仇 U+4EC7
+    0xBDF1, // 今 U+4ECA
+    0xBDE9, // 介 U+4ECB
+    0xC8D4, // 仍 U+4ECD
+    0xB4D3, // 从 U+4ECE
+    0xC2D8, // 仑 U+4ED1
+    0xB2D6, // 仓 U+4ED3
+    0xD7D0, // 仔 U+4ED4
+    0xCACB, // 仕 U+4ED5
+    0xCBFB, // 他 U+4ED6
+    0xD5CC, // 仗 U+4ED7
+    0xB8B6, // 付 U+4ED8
+    0xCFC9, // 仙 U+4ED9
+    0xC7AA, // 仟 U+4EDF
+    0xB4FA, // 代 U+4EE3
+    0xC1EE, // 令 U+4EE4
+    0xD2D4, // 以 U+4EE5
+    0xD2C7, // 仪 U+4EEA
+    0xC3C7, // 们 U+4EEC
+    0xD1F6, // 仰 U+4EF0
+    0xD6D9, // 仲 U+4EF2
+    0xBCFE, // 件 U+4EF6
+    0xBCDB, // 价 U+4EF7
+    0xC8CE, // 任 U+4EFB
+    0xB7DD, // 份 U+4EFD
+    0xB7C2, // 仿 U+4EFF
+    0xC6F3, // 企 U+4F01
+    0xD2C1, // 伊 U+4F0A
+    0xCEE9, // 伍 U+4F0D
+    0xBCBF, // 伎 U+4F0E
+    0xB7FC, // 伏 U+4F0F
+    0xB7A5, // 伐 U+4F10
+    0xD0DD, // 休 U+4F11
+    0xD6DA, // 众 U+4F17
+    0xD3C5, // 优 U+4F18
+    0xBBEF, // 伙 U+4F19
+    0xBBE1, // 会 U+4F1A
+    0xC9A1, // 伞 U+4F1E
+    0xCEB0, // 伟 U+4F1F
+    0xB4AB, // 传 U+4F20
+    0xC9CB, // 伤 U+4F24
+    0xC2D7, // 伦 U+4F26
+    0xCEB1, // 伪 U+4F2A
+    0xB2AE, // 伯 U+4F2F
+    0xB9C0, // 估 U+4F30
+    0xB0E9, // 伴 U+4F34
+    0xC1E6, // 伶 U+4F36
+    0xC9EC, // 伸 U+4F38
+    0xCBC5, // 伺 U+4F3A
+    0xCBC6, // 似 U+4F3C
+    0xB5E8, // 佃 U+4F43
+    0xB5AB, // 但 U+4F46
+    0xCEBB, // 位 U+4F4D
+    0xB5CD, // 低 U+4F4E
+    0xD7A1, // 住 U+4F4F
+    0xD7F4, // 佐 U+4F50
+    0xD3D3, // 佑 U+4F51
+    0xCCE5, // 体 U+4F53
+    0xBACE, // 何 U+4F55
+    0xD3E0, // 余 U+4F59
+    0xB7F0, // 佛 U+4F5B
+    0xD7F7, // 作 U+4F5C
+    0xC4E3, // 你 U+4F60
+    0xD3B6, // 佣 U+4F63
+    0xC5E5, // 佩 U+4F69
+    0xC0D0, // 佬 U+4F6C
+    0xD1F0, // 佯 U+4F6F
+    0xB0DB, // 佰 U+4F70
+    0xBCD1, // 佳 U+4F73
+    0xCAB9, // 使 U+4F7F
+    0xD6B6, // 侄 U+4F84
+    0xB3DE, // 侈 U+4F88
+    0xC0FD, // 例 U+4F8B
+    0xCACC, // 侍 U+4F8D
+    0xB6B1, // 侗 U+4F97
+    0xB9A9, // 供 U+4F9B
+    0xD2C0, // 依 U+4F9D
+    0xCFC0, // 侠 U+4FA0
+    0xC2C2, // 侣 U+4FA3
+    0xBDC4, // 侥 U+4FA5
+    0xD5EC, // 侦 U+4FA6
+    0xB2E0, // 侧 U+4FA7
+    0xC7C8, // 侨 U+4FA8
+    0xBFEB, // 侩 U+4FA9
+    0xCEEA, // 侮 U+4FAE
+    0xBAEE, // 侯 U+4FAF
+    0xC7D6, // 侵 U+4FB5
+    0xB1E3, // 便 U+4FBF
+    0xB4D9, // 促 U+4FC3
+    0xB6ED, // 俄 U+4FC4
+    0xBFA1, // 俊 U+4FCA
+    0xC7CE, // 俏 U+4FCF
+    0xC0FE, // 俐 U+4FD0
+    0xCBD7, // 俗 U+4FD7
+    0xB7FD, // 俘 U+4FD8
+    0xB1A3, // 保 U+4FDD
+    0xD3E1, // 俞 U+4FDE
+    0xD0C5, // 信 U+4FE1
+    0xC1A9, // 俩 U+4FE9
+    0xBCF3, // 俭 U+4FED
+    0xD0DE, // 修 U+4FEE
+    0xB8A9, // 俯 U+4FEF
+    0xBEE3, // 俱 U+4FF1
+    0xB0B3, // 俺 U+4FFA
+    0xB1B6, // 倍 U+500D
+    0xB5B9, // 倒 U+5012
+    0xBEF3, // 倔 U+5014
+    0xCCC8, // 倘 U+5018
+    0xBAF2, // 候 U+5019
+    0xD2D0, // 倚 U+501A
+    0xBDE8, // 借 U+501F
+    0xB3AB, // 倡 U+5021
+    0xBEEB, // 倦 U+5026
+    0xC4DF, // 倪 U+502A
+    0xD5AE, // 债 U+503A
+    0xD6B5, // 值 U+503C
+    0xC7E3, // 倾 U+503E
+    0xBCD9, // 假 U+5047
+    0xC6AB, // 偏 U+504F
+    0xD7F6, // 做 U+505A
+    0xCDA3, // 停 U+505C
+    0xBDA1, // 健 U+5065
+    0xC5BC, // 偶 U+5076
+    0xCDB5, // 偷 U+5077
+    0xB3A5, // 偿 U+507F
+    0xBFFE, // 傀 U+5080
+    0xB8B5, // 傅 U+5085
+    0xB0F8, // 傍 U+508D
+    0xB4F6, // 傣 U+50A3
+    0xB4A2, // 储 U+50A8
+    0xB4DF, // 催 U+50AC
+    0xB0C1, // 傲 U+50B2
+    0xC9B5, // 傻 U+50BB
+    0xCFF1, // 像 U+50CF
+    0xC1C5, // 僚 U+50DA
+    0xC9AE, // 僧 U+50E7
+    0xCBDB, // 僳 U+50F3
+    0xBDA9, // 僵 U+50F5
+    0xC6A7, // 僻 U+50FB
+    0xC8E5, // 儒 U+5112
+    0xC0DC, // 儡 U+5121
+    0xB6F9, // 儿 U+513F
+    0xD4CA, // 允 U+5141
+    0xD4AA, // 元 U+5143
+    0xD0D6, // 兄 U+5144
+    0xB3E4, // 充 U+5145
+    0xD5D7, // 兆 U+5146
+    0xCFC8, // 先 U+5148
+    0xB9E2, // 光 U+5149
+    0xBFCB, // 克 U+514B
+    0xC3E2, // 免 U+514D
+    0xB6D2, // 兑 U+5151
+    0xCDC3, // 兔 U+5154
+    0xB5B3, // 党 U+515A
+    0xB6B5, // 兜 U+515C
+    0xBEA4, // 兢 U+5162
+    0xC8EB, // 入 U+5165
+    0xC8AB, // 全 U+5168
+    0xB0CB, // 八 U+516B
+    0xB9AB, // 公 U+516C
+    0xC1F9, // 六 U+516D
+    0xC0BC, // 兰 U+5170
+    0xB9B2, // 共 U+5171
+    0xB9D8, // 关 U+5173
+    0xD0CB, // 兴 U+5174
+    0xB1F8, // 兵 U+5175
+    0xC6E4, // 其 U+5176
+    0xBEDF, // 具 U+5177
+    0xB5E4, // 典 U+5178
+    0xD7C8, // 兹 U+5179
+    0xD1F8, // 养 U+517B
+    0xBCE6, // 兼 U+517C
+    0xCADE, // 兽 U+517D
+    0xBCBD, // 冀 U+5180
+    0xC4DA, // 内 U+5185
+    0xB8D4, // 冈 U+5188
+    0xC8BD, // 冉 U+5189
+    0xB2E1, // 册 U+518C
+    0xD4D9, // 再 U+518D
+    0xC3B0, // 冒 U+5192
+    0xC3E1, // 冕 U+5195
+    0xC8DF, // 冗 U+5197
+    0xD0B4, // 写 U+5199
+    0xBEFC, // 军 U+519B
+    0xC5A9, // 农 U+519C
+    0xB9DA, // 冠 U+51A0
+    0xD4A9, // 冤 U+51A4
+    0xB6AC, // 冬 U+51AC
+    0xB7EB, // 冯 U+51AF
+    0xB1F9, // 冰 U+51B0
+    0xB3E5, // 冲 U+51B2
+    0xBEF6, // 决 U+51B3
+    0xBFF6, // 况 U+51B5
+    0xD2B1, // 冶 U+51B6
+    0xC0E4, // 冷 U+51B7
+    0xB6B3, // 冻 U+51BB
+    0xBEBB, // 净 U+51C0
+    0xC6E0, // 凄 U+51C4
+    0xD7BC, // 准 U+51C6
+    0xC1B9, // 凉 U+51C9
+    0xB5F2, // 凋 U+51CB
+    0xC1E8, // 凌 U+51CC
+    0xBCF5, // 减 U+51CF
+    0xB4D5, // 凑 U+51D1
+    0xC1DD, // 凛 U+51DB
+    0xC4FD, // 凝 U+51DD
+    0xBCB8, // 几 U+51E0
+    0xB7B2, // 凡 U+51E1
+    0xB7EF, // 凤 U+51E4
+    0xC6BE, // 凭 U+51ED
+    0xBFAD, // 凯 U+51EF
+    0xBBCB, // 凰 U+51F0
+    0xB5CA, // 凳 U+51F3
+    0xD0D7, // 凶 U+51F6
+    0xCDB9, // 凸 U+51F8
+    0xB0BC, // 凹 U+51F9
+    0xB3F6, // 出 U+51FA
+    0xBBF7, // 击 U+51FB
+    0xBAAF, // 函 U+51FD
+    0xD4E4, // 凿 U+51FF
+    0xB5B6, // 刀 U+5200
+    0xB5F3, // 刁 U+5201
+    0xC8D0, // 刃 U+5203
+    0xB7D6, // 分 U+5206
+    0xC7D0, // 切 U+5207
+    0xBFAF, // 刊 U+520A
+    0xD0CC, // 刑 U+5211
+    0xBBAE, // 划 U+5212
+    0xC1D0, // 列 U+5217
+    0xC1F5, // 刘 U+5218
+    0xD4F2, // 则 U+5219
+    0xB8D5, // 刚 U+521A
+    0xB4B4, // 创 U+521B
+    0xB3F5, // 初 U+521D
+    0xC9BE, // 删 U+5220
+    0xC5D0, // 判 U+5224
+    0xC5D9, // 刨 U+5228
+    0xC0FB, // 利 U+5229
+    0xB1F0, // 别 U+522B
+    0xB9CE, // 刮 U+522E
+    0xB5BD, // 到 U+5230
+    0xD6C6, // 制 U+5236
+    0xCBA2, // 刷 U+5237
+    0xC8AF, // 券 U+5238
+    0xC9B2, // 刹 U+5239
+    0xB4CC, // 刺 U+523A
+    0xBFCC, // 刻 U+523B
+    0xB9F4, // 刽 U+523D
+    0xB6E7, // 剁 U+5241
+    0xBCC1, // 剂 U+5242
+    0xCCEA, // 剃 U+5243
+    0xCFF7, // 削 U+524A
+    0xC7B0, // 前 U+524D
+    0xB9D0, // 剐 U+5250
+    0xBDA3, // 剑 U+5251
+    0xCCDE, // 剔 U+5254
+    0xC6CA, // 剖 U+5256
+    0xB0FE, // 剥 U+5265
+    0xBEE7, // 剧 U+5267
+    0xCAA3, // 剩 U+5269
+    0xBCF4, // 剪 U+526A
+    0xB8B1, // 副 U+526F
+    0xB8EE, // 割 U+5272
+    0xBDCB, // 剿 U+527F
+    0xC5FC, // 劈 U+5288
+    0xC1A6, // 力 U+529B
+    0xC8B0, // 劝 U+529D
+    0xB0EC, // 办 U+529E
+    0xB9A6, // 功 U+529F
+    0xBCD3, // 加 U+52A0
+    0xCEF1, // 务 U+52A1
+    0xC1D3, // 劣 U+52A3
+    0xB6AF, // 动 U+52A8
+    0xD6FA, // 助 U+52A9
+    0xC5AC, // 努 U+52AA
+    0xBDD9, // 劫 U+52AB
+    0xC0F8, // 励 U+52B1
+    0xBEA2, // 劲 U+52B2
+    0xC0CD, // 劳 U+52B3
+    0xCAC6, // 势 U+52BF
+    0xB2AA, // 勃 U+52C3
+    0xD3C2, // 勇 U+52C7
+    0xC3E3, // 勉 U+52C9
+    0xD1AB, // 勋 U+52CB
+    0xC0D5, // 勒 U+52D2
+    0xBFB1, // 勘 U+52D8
+    0xC4BC, // 募 U+52DF
+    0xC7DA, // 勤 U+52E4
+    0xC9D7, // 勺 U+52FA
+    0xB9B4, // 勾 U+52FE
+    0xCEF0, // 勿 U+52FF
+    0xD4C8, // 匀 U+5300
+    0xB0FC, // 包 U+5305
+    0xB4D2, // 匆 U+5306
+    0xD0D9, // 匈 U+5308
+    0xBBAF, // 化 U+5316
+    0xB1B1, // 北 U+5317
+    0xB3D7, // 匙 U+5319
+    0xD4D1, // 匝 U+531D
+    0xBDB3, // 匠 U+5320
+    0xBFEF, // 匡 U+5321
+    0xCFBB, // 匣 U+5323
+    0xB7CB, // 匪 U+532A
+    0xC6A5, // 匹 U+5339
+    0xC7F8, // 区 U+533A
+    0xD2BD, // 医 U+533B
+    0xC4E4, // 匿 U+533F
+    0xCAAE, // 十 U+5341
+    0xC7A7, // 千 U+5343
+    0xC9FD, // 升 U+5347
+    0xCEE7, // 午 U+5348
+    0xBBDC, // 卉 U+5349
+    0xB0EB, // 半 U+534A
+    0xBBAA, // 华 U+534E
+    0xD0AD, // 协 U+534F
+    0xB1B0, // 卑 U+5351
+    0xD7E4, // 卒 U+5352
+    0xD7BF, // 卓 U+5353
+    0xB5A5, // 单 U+5355
+    0xC2F4, // 卖 U+5356
+    0xC4CF, // 南 U+5357
+    0xB2A9, // 博 U+535A
+    0xB2B7, // 卜 U+535C
+    0xB1E5, // 卞 U+535E
+    0xD5BC, // 占 U+5360
+    0xBFA8, // 卡 U+5361
+    0xC2AC, // 卢 U+5362
+    0xC2B1, // 卤 U+5364
+    0xCED4, // 卧 U+5367
+    0xCEC0, // 卫 U+536B
+    0xC3AE, // 卯 U+536F
+    0xD3A1, // 印 U+5370
+    0xCEA3, // 危 U+5371
+    0xBCB4, // 即 U+5373
+    0xC8B4, // 却 U+5374
+    0xC2D1, // 卵 U+5375
+    0xBEED, // 卷 U+5377
+    0xD0B6, // 卸 U+5378
+    0xC7E4, // 卿 U+537F
+    0xB3A7, // 厂 U+5382
+    0xB6F2, // 厄 U+5384
+    0xCCFC, // 厅 U+5385
+    0xC0FA, // 历 U+5386
+    0xC0F7, // 厉 U+5389
+    0xD1B9, // 压 U+538B
+    0xD1E1, // 厌 U+538C
+    0xB2DE, // 厕 U+5395
+    0xC0E5, // 厘 U+5398
+    0xBAF1, // 厚 U+539A
+    0xD4AD, // 原 U+539F
+    0xCFE1, // 厢 U+53A2
+    0xCFC3, // 厦 U+53A6
+    0xB3F8, // 厨 U+53A8
+    0xBEC7, // 厩 U+53A9
+    0xC8A5, // 去 U+53BB
+    0xCFD8, // 县 U+53BF
+    0xC8FE, // 叁 U+53C1
+    0xB2CE, // 参 U+53C2
+    0xD3D6, // 又 U+53C8
+    0xB2E6, // 叉 U+53C9
+    0xBCB0, // 及 U+53CA
+    0xD3D1, // 友 U+53CB
+    0xCBAB, // 双 U+53CC
+    0xB7B4, // 反 U+53CD
+    0xB7A2, // 发 U+53D1
+    0xCAE5, // 叔 U+53D4
+    0xC8A1, // 取 U+53D6
+    0xCADC, // 受 U+53D7
+    0xB1E4, // 变 U+53D8
+    0xD0F0, // 叙 U+53D9
+    0xC5D1, // 叛 U+53DB
+    0xB5FE, // 叠 U+53E0
+    0xBFDA, // 口 U+53E3
+    0xB9C5, // 古 U+53E4
+    0xBEE4, // 句 U+53E5
+    0xC1ED, // 另 U+53E6
+    0xD6BB, // 只 U+53EA
+    0xBDD0, // 叫 U+53EB
+    0xD5D9, // 召 U+53EC
+    0xB0C8, // 叭 U+53ED
+    0xB6A3, // 叮 U+53EE
+    0xBFC9, // 可 U+53EF
+    0xCCA8, // 台 U+53F0
+    0xCAB7, // 史 U+53F2
+    0xD3D2, // 右 U+53F3
+    0xD2B6, // 叶 U+53F6
+    0xBAC5, // 号 U+53F7
+    0xCBBE, // 司 U+53F8
+    0xCCBE, // 叹 U+53F9
+    0xB5F0, // 叼 U+53FC
+    0xD3F5, // 吁 U+5401
+    0xB3D4, // 吃 U+5403
+    0xB8F7, // 各 U+5404
+    0xBACF, // 合 U+5408
+    0xBCAA, // 吉 U+5409
+    0xB5F5, // 吊 U+540A
+    0xCDAC, // 同 U+540C
+    0xC3FB, // 名 U+540D
+    0xBAF3, // 后 U+540E
+    0xC0F4, // 吏 U+540F
+    0xCDC2, // 吐 U+5410
+    0xCFF2, // 向 U+5411
+    0xCFC5, // 吓 U+5413
+    0xC2C0, // 吕 U+5415
+    0xC2F0, // 吗 U+5417
+    0xBEFD, // 君 U+541B
+    0xC1DF, // 吝 U+541D
+    0xCDCC, // 吞 U+541E
+    0xD2F7, // 吟 U+541F
+    0xB7CD, // 吠 U+5420
+    0xB7F1, // 否 U+5426
+    0xB0C9, // 吧 U+5427
+    0xB6D6, // 吨 U+5428
+    0xB7D4, // 吩 U+5429
+    0xBAAC, // 含 U+542B
+    0xCCFD, // 听 U+542C
+    0xBFD4, // 吭 U+542D
+    0xCBB1, // 吮 U+542E
+    0xC6F4, // 启 U+542F
+    0xD6A8, // 吱 U+5431
+    0xCEE2, // 吴 U+5434
+    0xB3B3, // 吵 U+5435
+    0xCEFC, // 吸 U+5438
+    0xB4B5, // 吹 U+5439
+    0xCEC7, // 吻 U+543B
+    0xBAF0, // 吼 U+543C
+    0xCEE1, // 吾 U+543E
+    0xD1BD, // 呀 U+5440
+    0xB4F4, // 呆 U+5446
+    0xB3CA, // 呈 U+5448
+    0xB8E6, // 告 U+544A
+    0xC4C5, // 呐 U+5450
+    0xC5BB, // 呕 U+5455
+    0xD4B1, // 员 U+5458
+    0xC7BA, // 呛 U+545B
+    0xCED8, // 呜 U+545C
+    0xC4D8, // 呢 U+5462
+    0xD6DC, // 周 U+5468
+    0xCEB6, // 味 U+5473
+    0xBAC7, // 呵 U+5475
+    0xC5DE, // 呸 U+5478
+    0xC9EB, // 呻 U+547B
+    0xBAF4, // 呼 U+547C
+    0xC3FC, // 命 U+547D
+    0xBED7, // 咀 U+5480
+    0xC5D8, // 咆 U+5486
+    0xD5A6, // 咋 U+548B
+    0xBACD, // 和 U+548C
+    0xBECC, // 咎 U+548E
+    0xD3BD, // 咏 U+548F
+    0xB8C0, // 咐 U+5490
+    0xD6E4, // 咒 U+5492
+    0xB9BE, // 咕 U+5495
+    0xBFA7, // 咖 U+5496
+    0xC1FC, // 咙 U+5499
+    0xD7C9, // 咨 U+54A8
+    0xD2A7, // 咬 U+54AC
+    0xBFA9, // 咯 U+54AF
+    0xD4DB, // 咱 U+54B1
+    0xBFC8, // 咳 U+54B3
+    0xCFCC, // 咸 U+54B8
+    0xD1CA, // 咽 U+54BD
+    0xB0A7, // 哀 U+54C0
+    0xC6B7, // 品 U+54C1
+    0xBAE5, // 哄 U+54C4
+    0xB6DF, // 哆 U+54C6
+    0xCDDB, // 哇 U+54C7
+    0xB9FE, // 哈 U+54C8
+    0xD4D5, // 哉 U+54C9
+    0xCFEC, // 响 U+54CD
+    0xB0A5, // 哎 U+54CE
+    0xD1C6, // 哑 U+54D1
+    0xBBA9, // 哗 U+54D7
+    0xD3B4, // 哟 U+54DF
+    0xB8E7, // 哥 U+54E5
+    0xC5B6, // 哦 U+54E6
+    0xC9DA, // 哨 U+54E8
+    0xC1A8, // 哩 U+54E9
+    0xC4C4, // 哪 U+54EA
+    0xBFDE, // 哭 U+54ED
+    0xCFF8, // 哮 U+54EE
+    0xD5DC, // 哲 U+54F2
+    0xB2B8, // 哺 U+54FA
+    0xBADF, // 哼 U+54FC
+    0xD1E4, // 唁 U+5501
+    0xCBF4, // 唆 U+5506
+    0xB4BD, // 唇 U+5507
+    0xB0A6, // 唉 U+5509
+    0xCCC6, // 唐 U+5510
+    0xBBBD, // 唤 U+5524
+    0xBBA3, // 唬 U+552C
+    0xCADB, // 售 U+552E
+    0xCEA8, // 唯 U+552F
+    0xB3AA, // 唱 U+5531
+    0xCDD9, // 唾 U+553E
+    0xBFD0, // 啃 U+5543
+    0xD7C4, // 啄 U+5544
+    0xC9CC, // 商 U+5546
+    0xB0A1, // 啊 U+554A
+    0xB7C8, // 啡 U+5561
+    0xC6A1, // 啤 U+5564
+    0xC9B6, // 啥 U+5565
+    0xC0B2, // 啦 U+5566
+    0xC5BE, // 啪 U+556A
+    0xC4F6, // 啮 U+556E
+    0xD0A5, // 啸 U+5578
+    0xCCE4, // 啼 U+557C
+    0xBFA6, // 喀 U+5580
+    0xCEB9, // 喂 U+5582
+    0xC9C6, // 善 U+5584
+    0xC0AE, // 喇 U+5587
+    0xBAED, // 喉 U+5589
+    0xBAB0, // 喊 U+558A
+    0xB4AD, // 喘 U+5598
+    0xCFB2, // 喜 U+559C
+    0xBAC8, // 喝 U+559D
+    0xD0FA, // 喧 U+55A7
+    0xD4FB, // 喳 U+55B3
+    0xC5E7, // 喷 U+55B7
+    0xD3F7, // 喻 U+55BB
+    0xD0E1, // 嗅 U+55C5
+    0xC9A4, // 嗓 U+55D3
+    0xCAC8, // 嗜 U+55DC
+    0xCECB, // 嗡 U+55E1
+    0xCBC3, // 嗣 U+55E3
+    0xCBD4, // 嗽 U+55FD
+    0xBCCE, // 嘉 U+5609
+    0xB8C2, // 嘎 U+560E
+    0xD0EA, // 嘘 U+5618
+    0xC2EF, // 嘛 U+561B
+    0xD6F6, // 嘱 U+5631
+    0xB3B0, // 嘲 U+5632
+    0xD7EC, // 嘴 U+5634
+    0xCBBB, // 嘶 U+5636
+    0xCEFB, // 嘻 U+563B
+    0xBAD9, // 嘿 U+563F
+    0xD2AD, // 噎 U+564E
+    0xC6F7, // 器 U+5668
+    0xD4EB, // 噪 U+566A
+    0xCAC9, // 噬 U+566C
+    0xB8C1, // 噶 U+5676
+    0xBABF, // 嚎 U+568E
+    0xCCE7, // 嚏 U+568F
+    0xCFF9, // 嚣 U+56A3
+    0xC8C2, // 嚷 U+56B7
+    0xBDC0, // 嚼 U+56BC
+    0xC4D2, // 囊 U+56CA
+    0xC7F4, // 囚 U+56DA
+    0xCBC4, // 四 U+56DB
+    0xBBD8, // 回 U+56DE
+    0xD2F2, // 因 U+56E0
+    0xCDC5, // 团 U+56E2
+    0xB6DA, // 囤 U+56E4
+    0xD4B0, // 园 U+56ED
+    0xC0A7, // 困 U+56F0
+    0xB4D1, // 囱 U+56F1
+    0xCEA7, // 围 U+56F4
+    0xB9CC, // 固 U+56FA
+    0xB9FA, // 国 U+56FD
+    0xCDBC, // 图 U+56FE
+    0xC6D4, // 圃 U+5703
+    0xD4B2, // 圆 U+5706
+    0xC8A6, // 圈 U+5708
+    0xCDC1, // 土 U+571F
+    0xCAA5, // 圣 U+5723
+    0xD4DA, // 在 U+5728
+    0xB9E7, // 圭 U+572D
+    0xB5D8, // 地 U+5730
+    0xDBDA, // 圳 U+5733
+    0xB3A1, // 场 U+573A
+    0xBBF8, // 圾 U+573E
+    0xD6B7, // 址 U+5740
+    0xBEF9, // 均 U+5747
+    0xB7BB, // 坊 U+574A
+    0xCCAE, // 坍 U+574D
+    0xBFB2, // 坎 U+574E
+    0xBBB5, // 坏 U+574F
+    0xD7F8, // 坐 U+5750
+    0xBFD3, // 坑 U+5751
+    0xBFE9, // 块 U+5757
+    0xBCE1, // 坚 U+575A
+    0xCCB3, // 坛 U+575B
+    0xB0D3, // 坝 U+575D
+    0xCEEB, // 坞 U+575E
+    0xB7D8, // 坟 U+575F
+    0xD7B9, // 坠 U+5760
+    0xC6C2, // 坡 U+5761
+    0xC0A4, // 坤 U+5764
+    0xCCB9, // 坦 U+5766
+    0xC6BA, // 坪 U+576A
+    0xC5F7, // 坯 U+576F
+    0xBFC0, // 坷 U+5777
+    0xB4B9, // 垂 U+5782
+    0xC0AC, // 垃 U+5783
+    0xC2A2, // 垄 U+5784
+    0xD0CD, // 型 U+578B
+    0xC0DD, // 垒 U+5792
+    0xB6E2, // 垛 U+579B
+    0xB9B8, // 垢 U+57A2
+    0xD4AB, // 垣 U+57A3
+    0xBFD1, // 垦 U+57A6
+    0xB5E6, // 垫 U+57AB
+    0xBFE5, // 垮 U+57AE
+    0xB9A1, // 埂 U+57C2
+    0xB0A3, // 埃 U+57C3
+    0xC2F1, // 埋 U+57CB
+    0xB3C7, // 城 U+57CE
+    0xC6D2, // 埔 U+57D4
+    0xD3F2, // 域 U+57DF
+    0xB2BA, // 埠 U+57E0
+    0xC5E0, // 培 U+57F9
+    0xBBF9, // 基 U+57FA
+    0xCCC3, // 堂 U+5802
+    0xB6D1, // 堆 U+5806
+    0xC7B5, // 堑 U+5811
+    0xB6E9, // 堕 U+5815
+    0xB1A4, // 堡 U+5821
+    0xB5CC, // 堤 U+5824
+    0xBFB0, // 堪 U+582A
+    0xD1DF, // 堰 U+5830
+    0xB6C2, // 堵 U+5835
+    0xCBFA, // 塌 U+584C
+    0xCBDC, // 塑 U+5851
+    0xCBFE, // 塔 U+5854
+    0xCCC1, // 塘 U+5858
+    0xC8FB, // 塞 U+585E
+    0xCCEE, // 填 U+586B
+    0xBEB3, // 境 U+5883
+    0xCAFB, // 墅 U+5885
+    0xC9CA, // 墒 U+5892
+    0xC4B9, // 墓 U+5893
+    0xC7BD, // 墙 U+5899
+    0xD4F6, // 增 U+589E
+    0xD0E6, // 墟 U+589F
+    0xC4AB, // 墨 U+58A8
+    0xB6D5, // 墩 U+58A9
+    0xB1DA, // 壁 U+58C1
+    0xBABE, // 壕 U+58D5
+    0xC8C0, // 壤 U+58E4
+    0xCABF, // 士 U+58EB
+    0xC8C9, // 壬 U+58EC
+    0xD7B3, // 壮 U+58EE
+    0xC9F9, // 声 U+58F0
+    0xBFC7, // 壳 U+58F3
+    0xBAF8, // 壶 U+58F6
+    0xD2BC, // 壹 U+58F9
+    0xB4A6, // 处 U+5904
+    0xB1B8, // 备 U+5907
+    0xB8B4, // 复 U+590D
+    0xCFC4, // 夏 U+590F
+    0xCFA6, // 夕 U+5915
+    0xCDE2, // 外 U+5916
+    0xB6E0, // 多 U+591A
+    0xD2B9, // 夜 U+591C
+    0xB9BB, // 够 U+591F
+    0xB4F3, // 大 U+5927
+    0xCCEC, // 天 U+5929
+    0xCCAB, // 太 U+592A
+    0xB7F2, // 夫 U+592B
+    0xD1EB, // 央 U+592E
+    0xBABB, // 夯 U+592F
+    0xCAA7, // 失 U+5931
+    0xCDB7, // 头 U+5934
+    0xD2C4, // 夷 U+5937
+    0xBFE4, // 夸 U+5938
+    0xBCD0, // 夹 U+5939
+    0xB6E1, // 夺 U+593A
+    0xD1D9, // 奄 U+5944
+    0xC6E6, // 奇 U+5947
+    0xC4CE, // 奈 U+5948
+    0xB7EE, // 奉 U+5949
+    0xB7DC, // 奋 U+594B
+    0xBFFC, // 奎 U+594E
+    0xD7E0, // 奏 U+594F
+    0xC6F5, // 契 U+5951
+    0xB1BC, // 奔 U+5954
+    0xBDB1, // 奖 U+5956
+    0xCCD7, // 套 U+5957
+    0xB5EC, // 奠 U+5960
+    0xC9DD, // 奢 U+5962
+    0xB0C2, // 奥 U+5965
+    0xC5AE, // 女 U+5973
+    0xC5AB, // 奴 U+5974
+    0xC4CC, // 奶 U+5976
+    0xBCE9, // 奸 U+5978
+    0xCBFD, // 她 U+5979
+    0xBAC3, // 好 U+597D
+    0xC8E7, // 如 U+5982
+    0xCDFD, // 妄 U+5984
+    0xD7B1, // 妆 U+5986
+    0xB8BE, // 妇 U+5987
+    0xC2E8, // 妈 U+5988
+    0xC8D1, // 妊 U+598A
+    0xB6CA, // 妒 U+5992
+    0xBCCB, // 妓 U+5993
+    0xD1FD, // 妖 U+5996
+    0xC3EE, // 妙 U+5999
+    0xCDD7, // 妥 U+59A5
+    0xB7C1, // 妨 U+59A8
+    0xC4DD, // 妮 U+59AE
+    0xC3C3, // 妹 U+59B9
+    0xC6DE, // 妻 U+59BB
+    0xC4B7, // 姆 U+59C6
+    0xCABC, // 始 U+59CB
+    0xBDE3, // 姐 U+59D0
+    0xB9C3, // 姑 U+59D1
+    0xD0D5, // 姓 U+59D3
+    0xCEAF, // 委 U+59D4
+    0xD2A6, // 姚 U+59DA
+    0xBDAA, // 姜 U+59DC
+    0xC0D1, // 姥 U+59E5
+    0xD2CC, // 姨 U+59E8
+    0xBCA7, // 姬 U+59EC
+    0xD2F6, // 姻 U+59FB
+    0xD7CB, // 姿 U+59FF
+    0xCDFE, // 威 U+5A01
+    0xCDDE, // 娃 U+5A03
+    0xC2A6, // 娄 U+5A04
+    0xBDBF, // 娇 U+5A07
+    0xC4EF, // 娘 U+5A18
+    0xC4C8, // 娜 U+5A1C
+    0xBEEA, // 娟 U+5A1F
+    0xC9EF, // 娠 U+5A20
+    0xB6F0, // 娥 U+5A25
+    0xC3E4, // 娩 U+5A29
+    0xD3E9, // 娱 U+5A31
+    0xC8A2, // 娶 U+5A36
+    0xC6C5, // 婆 U+5A46
+    0xCDF1, // 婉 U+5A49
+    0xBBE9, // 婚 U+5A5A
+    0xC0B7, // 婪 U+5A6A
+    0xD3A4, // 婴 U+5A74
+    0xC9F4, // 婶 U+5A76
+    0xD0F6, // 婿 U+5A7F
+    0xC3BD, // 媒 U+5A92
+    0xC3C4, // 媚 U+5A9A
+    0xCFB1, // 媳 U+5AB3
+    0xBCDE, // 嫁 U+5AC1
+    0xC9A9, // 嫂 U+5AC2
+    0xBCB5, // 嫉 U+5AC9
+    0xCFD3, // 嫌 U+5ACC
+    0xB5D5, // 嫡 U+5AE1
+    0xC4DB, // 嫩 U+5AE9
+    0xD7D3, // 子 U+5B50
+    0xBFD7, // 孔 U+5B54
+    0xD4D0, // 孕 U+5B55
+    0xD7D6, // 字 U+5B57
+    0xB4E6, // 存 U+5B58
+    0xCBEF, // 孙 U+5B59
+    0xD7CE, // 孜 U+5B5C
+    0xD0A2, // 孝 U+5B5D
+    0xC3CF, // 孟 U+5B5F
+    0xBCBE, // 季 U+5B63
+    0xB9C2, // 孤 U+5B64
+    0xD1A7, // 学 U+5B66
+    0xBAA2, // 孩 U+5B69
+    0xC2CF, // 孪 U+5B6A
+    0xCAEB, // 孰 U+5B70
+    0xB7F5, // 孵 U+5B75
+    0xC8E6, // 孺 U+5B7A
+    0xC4F5, // 孽 U+5B7D
+    0xC4FE, // 宁 U+5B81
+    0xCBFC, // 它 U+5B83
+    0xD5AC, // 宅 U+5B85
+    0xD3EE, // 宇 U+5B87
+    0xCAD8, // 守 U+5B88
+    0xB0B2, // 安 U+5B89
+    0xCBCE, // 宋 U+5B8B
+    0xCDEA, // 完 U+5B8C
+    0xBAEA, // 宏 U+5B8F
+    0xD7DA, // 宗 U+5B97
+    0xB9D9, // 官 U+5B98
+    0xD6E6, // 宙 U+5B99
+    0xB6A8, // 定 U+5B9A
+    0xCDF0, // 宛 U+5B9B
+    0xD2CB, // 宜 U+5B9C
+    0xB1A6, // 宝 U+5B9D
+    0xCAB5, // 实 U+5B9E
+    0xB3E8, // 宠 U+5BA0
+    0xC9F3, // 审 U+5BA1
+    0xBFCD, // 客 U+5BA2
+    0xD0FB, // 宣 U+5BA3
+    0xCAD2, // 室 U+5BA4
+    0xBBC2, // 宦 U+5BA6
+    0xCFDC, // 宪 U+5BAA
+    0xB9AC, // 宫 U+5BAB
+    0xD4D7, // 宰 U+5BB0
+    0xBAA6, // 害 U+5BB3
+    0xD1E7, // 宴 U+5BB4
+    0xCFFC, // 宵 U+5BB5
+    0xBCD2, // 家 U+5BB6
+    0xC8DD, // 容 U+5BB9
+    0xBFED, // 宽 U+5BBD
+    0xB1F6, // 宾 U+5BBE
+    0xCBDE, // 宿 U+5BBF
+    0xBCC5, // 寂 U+5BC2
+    0xBCC4, // 寄 U+5BC4
+    0xD2FA, // 寅 U+5BC5
+    0xC3DC, // 密 U+5BC6
+    0xBFDC, // 寇 U+5BC7
+    0xB8BB, // 富 U+5BCC
+    0xC3C2, // 寐 U+5BD0
+    0xBAAE, // 寒 U+5BD2
+    0xD4A2, // 寓 U+5BD3
+    0xC7DE, // 寝 U+5BDD
+    0xC4AF, // 寞 U+5BDE
+    0xB2EC, // 察 U+5BDF
+    0xB9D1, // 寡 U+5BE1
+    0xC1C8, // 寥 U+5BE5
+    0xD5AF, // 寨 U+5BE8
+    0xB4E7, // 寸 U+5BF8
+    0xB6D4, // 对 U+5BF9
+    0xCBC2, // 寺 U+5BFA
+    0xD1B0, // 寻 U+5BFB
+    0xB5BC, // 导 U+5BFC
+    0xCAD9, // 寿 U+5BFF
+    0xB7E2, // 封 U+5C01
+    0xC9E4, // 射 U+5C04
+    0xBDAB, // 将 U+5C06
+    0xCEBE, // 尉 U+5C09
+    0xD7F0, // 尊 U+5C0A
+    0xD0A1, // 小 U+5C0F
+    0xC9D9, // 少 U+5C11
+    0xB6FB, // 尔 U+5C14
+    0xBCE2, // 尖 U+5C16
+    0xB3BE, // 尘 U+5C18
+    0xC9D0, // 尚 U+5C1A
+    0xB3A2, // 尝 U+5C1D
+    0xD3C8, // 尤 U+5C24
+    0xD2A2, // 尧 U+5C27
+    0xBECD, // 就 U+5C31
+    0xCAAC, // 尸 U+5C38
+    0xD2FC, // 尹 U+5C39
+    0xB3DF, // 尺 U+5C3A
+    0xC4E1, // 尼 U+5C3C
+    0xBEA1, // 尽 U+5C3D
+    0xCEB2, // 尾 U+5C3E
+    0xC4F2, // 尿 U+5C3F
+    0xBED6, // 局 U+5C40
+    0xC6A8, // 屁 U+5C41
+    0xB2E3, // 层 U+5C42
+    0xBED3, // 居 U+5C45
+    0xC7FC, // 屈 U+5C48
+    0xCCEB, // 屉 U+5C49
+    0xBDEC, // 届 U+5C4A
+    0xCEDD, // 屋 U+5C4B
+    0xCABA, // 屎 U+5C4E
+    0xC6C1, // 屏 U+5C4F
+    0xD0BC, // 屑 U+5C51
+    0xD5B9, // 展 U+5C55
+    0xCAF4, // 属 U+5C5E
+    0xCDC0, // 屠 U+5C60
+    0xC2C5, // 屡 U+5C61
+    0xC2C4, // 履 U+5C65
+    0xCDCD, // 屯 U+5C6F
+    0xC9BD, // 山 U+5C71
+    0xD2D9, // 屹 U+5C79
+    0xD3EC, // 屿 U+5C7F
+    0xCBEA, // 岁 U+5C81
+    0xC6F1, // 岂 U+5C82
+    0xB2ED, // 岔 U+5C94
+    0xB8DA, // 岗 U+5C97
+    0xB5BA, // 岛 U+5C9B
+    0xD1D2, // 岩 U+5CA9
+    0xC1EB, // 岭 U+5CAD
+    0xD4C0, // 岳 U+5CB3
+    0xB0B6, // 岸 U+5CB8
+    0xBFF9, // 岿 U+5CBF
+    0xD6C5, // 峙 U+5CD9
+    0xCFBF, // 峡 U+5CE1
+    0xC2CD, // 峦 U+5CE6
+    0xB6EB, // 峨 U+5CE8
+    0xD3F8, // 峪 U+5CEA
+    0xC7CD, // 峭 U+5CED
+    0xB7E5, // 峰 U+5CF0
+    0xBEFE, // 峻 U+5CFB
+    0xB3E7, // 崇 U+5D07
+    0xC6E9, // 崎 U+5D0E
+    0xB4DE, // 崔 U+5D14
+    0xD1C2, // 崖 U+5D16
+    0xB1C0, // 崩 U+5D29
+    0xD5B8, // 崭 U+5D2D
+    0xC7B6, // 嵌 U+5D4C
+    0xCEA1, // 巍 U+5DCD
+    0xB4A8, // 川 U+5DDD
+    0xD6DD, // 州 U+5DDE
+    0xD1B2, // 巡 U+5DE1
+    0xB3B2, // 巢 U+5DE2
+    0xB9A4, // 工 U+5DE5
+    0xD7F3, // 左 U+5DE6
+    0xC7C9, // 巧 U+5DE7
+    0xBEDE, // 巨 U+5DE8
+    0xB9AE, // 巩 U+5DE9
+    0xCED7, // 巫 U+5DEB
+    0xB2EE, // 差 U+5DEE
+    0xBCBA, // 己 U+5DF1
+    0xD2D1, // 已 U+5DF2
+    0xCBC8, // 巳 U+5DF3
+    0xB0CD, // 巴 U+5DF4
+    0xCFEF, // 巷 U+5DF7
+    0xBDED, // 巾 U+5DFE
+    0xB1D2, // 币 U+5E01
+    0xCAD0, // 市 U+5E02
+    0xB2BC, // 布 U+5E03
+    0xCBA7, // 帅 U+5E05
+    0xB7AB, // 帆 U+5E06
+    0xCAA6, // 师 U+5E08
+    0xCFA3, // 希 U+5E0C
+    0xD5CA, // 帐 U+5E10
+    0xC5C1, // 帕 U+5E15
+    0xCCFB, // 帖 U+5E16
+    0xC1B1, // 帘 U+5E18
+    0xD6E3, // 帚 U+5E1A
+    0xB2AF, // 帛 U+5E1B
+    0xD6C4, // 帜 U+5E1C
+    0xB5DB, // 帝 U+5E1D
+    0xB4F8, // 带 U+5E26
+    0xD6A1, // 帧 U+5E27
+    0xCFAF, // 席 U+5E2D
+    0xB0EF, // 帮 U+5E2E
+    0xB3A3, // 常 U+5E38
+    0xC3B1, // 帽 U+5E3D
+    0xC3DD, // 幂 U+5E42
+    0xB7F9, // 幅 U+5E45
+    0xBBCF, // 幌 U+5E4C
+    0xC4BB, // 幕 U+5E55
+    0xB4B1, // 幢 U+5E62
+    0xB8C9, // 干 U+5E72
+    0xC6BD, // 平 U+5E73
+    0xC4EA, // 年 U+5E74
+    0xB2A2, // 并 U+5E76
+    0xD0D2, // 幸 U+5E78
+    0xBBC3, // 幻 U+5E7B
+    0xD3D7, // 幼 U+5E7C
+    0xD3C4, // 幽 U+5E7D
+    0xB9E3, // 广 U+5E7F
+    0xD7AF, // 庄 U+5E84
+    0xC7EC, // 庆 U+5E86
+    0xB1D3, // 庇 U+5E87
+    0xB4B2, // 床 U+5E8A
+    0xD0F2, // 序 U+5E8F
+    0xC2AE, // 庐 U+5E90
+    0xBFE2, // 库 U+5E93
+    0xD3A6, // 应 U+5E94
+    0xB5D7, // 底 U+5E95
+    0xB5EA, // 店 U+5E97
+    0xC3ED, // 庙 U+5E99
+    0xB8FD, // 庚 U+5E9A
+    0xB8AE, // 府 U+5E9C
+    0xC5D3, // 庞 U+5E9E
+    0xB7CF, // 废 U+5E9F
+    0xB6C8, // 度 U+5EA6
+    0xD7F9, // 座 U+5EA7
+    0xCDA5, // 庭 U+5EAD
+    0xCAFC, // 庶 U+5EB6
+    0xBFB5, // 康 U+5EB7
+    0xD3B9, // 庸 U+5EB8
+    0xC1AE, // 廉 U+5EC9
+    0xC0C8, // 廊 U+5ECA
+    0xC0AA, // 廓 U+5ED3
+    0xC1CE, // 廖 U+5ED6
+    0xD1D3, // 延 U+5EF6
+    0xCDA2, // 廷 U+5EF7
+    0xBDA8, // 建 U+5EFA
+    0xBFAA, // 开 U+5F00
+    0xD2EC, // 异 U+5F02
+    0xC6FA, // 弃 U+5F03
+    0xC5AA, // 弄 U+5F04
+    0xB1D7, // 弊 U+5F0A
+    0xCABD, // 式 U+5F0F
+    0xB9AD, // 弓 U+5F13
+    0xD2FD, // 引 U+5F15
+    0xB8A5, // 弗 U+5F17
+    0xBAEB, // 弘 U+5F18
+    0xB3DA, // 弛 U+5F1B
+    0xB5DC, // 弟 U+5F1F
+    0xD5C5, // 张 U+5F20
+    0xC3D6, // 弥 U+5F25
+    0xCFD2, // 弦 U+5F26
+    0xBBA1, // 弧 U+5F27
+    0xCDE4, // 弯 U+5F2F
+    0xC8F5, // 弱 U+5F31
+    0xB5AF, // 弹 U+5F39
+    0xC7BF, // 强 U+5F3A
+    0xB9E9, // 归 U+5F52
+    0xB5B1, // 当 U+5F53
+    0xC2BC, // 录 U+5F55
+    0xD2CD, // 彝 U+5F5D
+    0xD0CE, // 形 U+5F62
+    0xCDAE, // 彤 U+5F64
+    0xD1E5, // 彦 U+5F66
+    0xB2CA, // 彩 U+5F69
+    0xB1EB, // 彪 U+5F6A
+    0xB1F2, // 彬 U+5F6C
+    0xC5ED, // 彭 U+5F6D
+    0xD5C3, // 彰 U+5F70
+    0xD3B0, // 影 U+5F71
+    0xD2DB, // 役 U+5F79
+    0xB3B9, // 彻 U+5F7B
+    0xB1CB, // 彼 U+5F7C
+    0xCDF9, // 往 U+5F80
+    0xD5F7, // 征 U+5F81
+    0xBEB6, // 径 U+5F84
+    0xB4FD, // 待 U+5F85
+    0xBADC, // 很 U+5F88
+    0xBBB2, // 徊 U+5F8A
+    0xC2C9, // 律 U+5F8B
+    0xD0EC, // 徐 U+5F90
+    0xCDBD, // 徒 U+5F92
+    0xB5C3, // 得 U+5F97
+    0xC5C7, // 徘 U+5F98
+    0xD3F9, // 御 U+5FA1
+    0xD1AD, // 循 U+5FAA
+    0xCEA2, // 微 U+5FAE
+    0xB5C2, // 德 U+5FB7
+    0xBBD5, // 徽 U+5FBD
+    0xD0C4, // 心 U+5FC3
+    0xB1D8, // 必 U+5FC5
+    0xD2E4, // 忆 U+5FC6
+    0xBCC9, // 忌 U+5FCC
+    0xC8CC, // 忍 U+5FCD
+    0xD6BE, // 志 U+5FD7
+    0xCDFC, // 忘 U+5FD8
+    0xC3A6, // 忙 U+5FD9
+    0xD6D2, // 忠 U+5FE0
+    0xD3C7, // 忧 U+5FE7
+    0xBFEC, // 快 U+5FEB
+    0xB3C0, // 忱 U+5FF1
+    0xC4EE, // 念 U+5FF5
+    0xD0C3, // 忻 U+5FFB
+    0xBAF6, // 忽 U+5FFD
+    0xB7DE, // 忿 U+5FFF
+    0xBBB3, // 怀 U+6000
+    0xCCAC, // 态 U+6001
+    0xCBCB, // 怂 U+6002
+    0xD4F5, // 怎 U+600E
+    0xC5AD, // 怒 U+6012
+    0xD5FA, // 怔 U+6014
+    0xC5C2, // 怕 U+6015
+    0xB2C0, // 怖 U+6016
+    0xC1AF, // 怜 U+601C
+    0xCBBC, // 思 U+601D
+    0xB5A1, // 怠 U+6020
+    0xBCB1, // 急 U+6025
+    0xD0D4, // 性 U+6027
+    0xD4B9, // 怨 U+6028
+    0xB9D6, // 怪 U+602A
+    0xC7D3, // 怯 U+602F
+    0xD7DC, // 总 U+603B
+    0xCAD1, // 恃 U+6043
+    0xC1B5, // 恋 U+604B
+    0xBBD0, // 恍 U+604D
+    0xBFD6, // 恐 U+6050
+    0xBAE3, // 恒 U+6052
+    0xCBA1, // 恕 U+6055
+    0xBBD6, // 恢 U+6062
+    0xD0F4, // 恤 U+6064
+    0xBADE, // 恨 U+6068
+    0xB6F7, // 恩 U+6069
+    0xB6B2, // 恫 U+606B
+    0xCCF1, // 恬 U+606C
+    0xB9A7, // 恭 U+606D
+    0xCFA2, // 息 U+606F
+    0xBFD2, // 恳 U+6073
+    0xB6F1, // 恶 U+6076
+    0xC4D5, // 恼 U+607C
+    0xD3C1, // 恿 U+607F
+    0xC7C4, // 悄 U+6084
+    0xCFA4, // 悉 U+6089
+    0xBAB7, // 悍 U+608D
+    0xBBDA, // 悔 U+6094
+    0xCEF2, // 悟 U+609F
+    0xD3C6, // 悠 U+60A0
+    0xBBBC, // 患 U+60A3
+    0xD4C3, // 悦 U+60A6
+    0xC4FA, // 您 U+60A8
+    0xD0FC, // 悬 U+60AC
+    0xC3F5, // 悯 U+60AF
+    0xB1AF, // 悲 U+60B2
+    0xBCC2, // 悸 U+60B8
+    0xB5BF, // 悼 U+60BC
+    0xC7E9, // 情 U+60C5
+    0xBEAA, // 惊 U+60CA
+    0xCDEF, // 惋 U+60CB
+    0xBBF3, // 惑 U+60D1
+    0xCCE8, // 惕 U+60D5
+    0xCFA7, // 惜 U+60DC
+    0xCEA9, // 惟 U+60DF
+    0xBBDD, // 惠 U+60E0
+    0xB5EB, // 惦 U+60E6
+    0xBEE5, // 惧 U+60E7
+    0xB2D2, // 惨 U+60E8
+    0xB3CD, // 惩 U+60E9
+    0xB1B9, // 惫 U+60EB
+    0xB2D1, // 惭 U+60ED
+    0xB5AC, // 惮 U+60EE
+    0xB9DF, // 惯 U+60EF
+    0xB6E8, // 惰 U+60F0
+    0xCFEB, // 想 U+60F3
+    0xBBCC, // 惶 U+60F6
+    0xC8C7, // 惹 U+60F9
+    0xD0CA, // 惺 U+60FA
+    0xB3EE, // 愁 U+6101
+    0xD3FA, // 愈 U+6108
+    0xD3E4, // 愉 U+6109
+    0xD2E2, // 意 U+610F
+    0xD3DE, // 愚 U+611A
+    0xB8D0, // 感 U+611F
+    0xB7DF, // 愤 U+6124
+    0xC0A2, // 愧 U+6127
+    0xD4B8, // 愿 U+613F
+    0xB4C8, // 慈 U+6148
+    0xBBC5, // 慌 U+614C
+    0xC9F7, // 慎 U+614E
+    0xC9E5, // 慑 U+6151
+    0xC4BD, // 慕 U+6155
+    0xC2FD, // 慢 U+6162
+    0xBBDB, // 慧 U+6167
+    0xBFAE, // 慨 U+6168
+    0xCEBF, // 慰 U+6170
+    0xBFB6, // 慷 U+6177
+    0xB1EF, // 憋 U+618B
+    0xD4F7, // 憎 U+618E
+    0xBAA9, // 憨 U+61A8
+    0xBAB6, // 憾 U+61BE
+    0xB6AE, // 懂 U+61C2
+    0xD0B8, // 懈 U+61C8
+    0xB0C3, // 懊 U+61CA
+    0xC0C1, // 懒 U+61D2
+    0xC5B3, // 懦 U+61E6
+    0xB8EA, // 戈 U+6208
+    0xCEEC, // 戊 U+620A
+    0xD0E7, // 戌 U+620C
+    0xCAF9, // 戍 U+620D
+    0xC8D6, // 戎 U+620E
+    0xCFB7, // 戏 U+620F
+    0xB3C9, // 成 U+6210
+    0xCED2, // 我 U+6211
+    0xBDE4, // 戒 U+6212
+    0xBBF2, // 或 U+6216
+    0xD5BD, // 战 U+6218
+    0xC6DD, // 戚 U+621A
+    0xBDD8, // 截 U+622A
+    0xC2BE, // 戮 U+622E
+    0xB4C1, // 戳 U+6233
+    0xB4F7, // 戴 U+6234
+    0xBBA7, // 户 U+6237
+    0xB7BF, // 房 U+623F
+    0xCBF9, // 所 U+6240
+    0xB1E2, // 扁 U+6241
+    0xC9C8, // 扇 U+6247
+    0xCAD6, // 手 U+624B
+    0xB2C5, // 才 U+624D
+    0xD4FA, // 扎 U+624E
+    0xC6CB, // 扑 U+6251
+    0xB0C7, // 扒 U+6252
+    0xB4F2, // 打 U+6253
+    0xC8D3, // 扔 U+6254
+    0xCDD0, // 托 U+6258
+    0xBFB8, // 扛 U+625B
+    0xBFDB, // 扣 U+6263
+    0xC7A4, // 扦 U+6266
+    0xD6B4, // 执 U+6267
+    0xC0A9, // 扩 U+6269
+    0xC9A8, // 扫 U+626B
+    0xD1EF, // 扬 U+626C
+    0xC5A4, // 扭 U+626D
+    0xB0E7, // 扮 U+626E
+    0xB3B6, // 扯 U+626F
+    0xC8C5, // 扰 U+6270
+    0xB0E2, // 扳 U+6273
+    0xB7F6, // 扶 U+6276
+    0xC5FA, // 批 U+6279
+    0xB6F3, // 扼 U+627C
+    0xD5D2, // 找 U+627E
+    0xB3D0, // 承 U+627F
+    0xBCBC, // 技 U+6280
+    0xB3AD, // 抄 U+6284
+    0xBEF1, // 抉 U+6289
+    0xB0D1, // 把 U+628A
+    0xD2D6, // 抑 U+6291
+    0xCAE3, // 抒 U+6292
+    0xD7A5, // 抓 U+6293
+    0xCDB6, // 投 U+6295
+    0xB6B6, // 抖 U+6296
+    0xBFB9, // 抗 U+6297
+    0xD5DB, // 折 U+6298
+    0xB8A7, // 抚 U+629A
+    0xC5D7, // 抛 U+629B
+    0xBFD9, // 抠 U+62A0
+    0xC2D5, // 抡 U+62A1
+    0xC7C0, // 抢 U+62A2
+    0xBBA4, // 护 U+62A4
+    0xB1A8, // 报 U+62A5
+    0xC5EA, // 抨 U+62A8
+    0xC5FB, // 披 U+62AB
+    0xCCA7, // 抬 U+62AC
+    0xB1A7, // 抱 U+62B1
+    0xB5D6, // 抵 U+62B5
+    0xC4A8, // 抹 U+62B9
+    0xD1BA, // 押 U+62BC
+    0xB3E9, // 抽 U+62BD
+    0xC3F2, // 抿 U+62BF
+    0xB7F7, // 拂 U+62C2
+    0xD6F4, // 拄 U+62C4
+    0xB5A3, // 担 U+62C5
+    0xB2F0, // 拆 U+62C6
+    0xC4B4, // 拇 U+62C7
+    0xC4E9, // 拈 U+62C8
+    0xC0AD, // 拉 U+62C9
+    0xB0E8, // 拌 U+62CC
+    0xC5C4, // 拍 U+62CD
+    0xC1E0, // 拎 U+62CE
+    0xB9D5, // 拐 U+62D0
+    0xBEDC, // 拒 U+62D2
+    0xCDD8, // 拓 U+62D3
+    0xB0CE, // 拔 U+62D4
+    0xCDCF, // 拖 U+62D6
+    0xBED0, // 拘 U+62D8
+    0xD7BE, // 拙 U+62D9
+    0xD5D0, // 招 U+62DB
+    0xB0DD, // 拜 U+62DC
+    0xC4E2, // 拟 U+62DF
+    0xC2A3, // 拢 U+62E2
+    0xBCF0, // 拣 U+62E3
+    0xD3B5, // 拥 U+62E5
+    0xC0B9, // 拦 U+62E6
+    0xC5A1, // 拧 U+62E7
+    0xB2A6, // 拨 U+62E8
+    0xD4F1, // 择 U+62E9
+    0xC0A8, // 括 U+62EC
+    0xCAC3, // 拭 U+62ED
+    0xD5FC, // 拯 U+62EF
+    0xB9B0, // 拱 U+62F1
+    0xC8AD, // 拳 U+62F3
+    0xCBA9, // 拴 U+62F4
+    0xBFBD, // 拷 U+62F7
+    0xC6B4, // 拼 U+62FC
+    0xD7A7, // 拽 U+62FD
+    0xCAB0, // 拾 U+62FE
+    0xC4C3, // 拿 U+62FF
+    0xB3D6, // 持 U+6301
+    0xB9D2, // 挂 U+6302
+    0xD6B8, // 指 U+6307
+    0xB0B4, // 按 U+6309
+    0xBFE6, // 挎 U+630E
+    0xCCF4, // 挑 U+6311
+    0xCDDA, // 挖 U+6316
+    0xD6BF, // 挚 U+631A
+    0xC2CE, // 挛 U+631B
+    0xCECE, // 挝 U+631D
+    0xCCA2, // 挞 U+631E
+    0xD0AE, // 挟 U+631F
+    0xC4D3, // 挠 U+6320
+    0xB5B2, // 挡 U+6321
+    0xD5F5, // 挣 U+6323
+    0xBCB7, // 挤 U+6324
+    0xBBD3, // 挥 U+6325
+    0xB0A4, // 挨 U+6328
+    0xC5B2, // 挪 U+632A
+    0xB4EC, // 挫 U+632B
+    0xD5F1, // 振 U+632F
+    0xCDEC, // 挽 U+633D
+    0xCEE6, // 捂 U+6342
+    0xCDB1, // 捅 U+6345
+    0xC0A6, // 捆 U+6346
+    0xD7BD, // 捉 U+6349
+    0xB0C6, // 捌 U+634C
+    0xBAB4, // 捍 U+634D
+    0xC9D3, // 捎 U+634E
+    0xC4F3, // 捏 U+634F
+    0xBEE8, // 捐 U+6350
+    0xB2B6, // 捕 U+6355
+    0xC0CC, // 捞 U+635E
+    0xCBF0, // 损 U+635F
+    0xBCF1, // 捡 U+6361
+    0xBBBB, // 换 U+6362
+    0xB5B7, // 捣 U+6363
+    0xC5F5, // 捧 U+6367
+    0xBEDD, // 据 U+636E
+    0xB4B7, // 捶 U+6376
+    0xBDDD, // 捷 U+6377
+    0xC4ED, // 捻 U+637B
+    0xCFC6, // 掀 U+6380
+    0xB5E0, // 掂 U+6382
+    0xB6DE, // 掇 U+6387
+    0xCADA, // 授 U+6388
+    0xB5F4, // 掉 U+6389
+    0xD5C6, // 掌 U+638C
+    0xCCCD, // 掏 U+638F
+    0xC6FE, // 掐 U+6390
+    0xC5C5, // 排 U+6392
+    0xD2B4, // 掖 U+6396
+    0xBEF2, // 掘 U+6398
+    0xC2D3, // 掠 U+63A0
+    0xCCBD, // 探 U+63A2
+    0xB3B8, // 掣 U+63A3
+    0xBDD3, // 接 U+63A5
+    0xBFD8, // 控 U+63A7
+    0xCDC6, // 推 U+63A8
+    0xD1DA, // 掩 U+63A9
+    0xB4EB, // 措 U+63AA
+    0xC2B0, // 掳 U+63B3
+    0xD6C0, // 掷 U+63B7
+    0xB5A7, // 掸 U+63B8
+    0xB2F4, // 掺 U+63BA
+    0xC8E0, // 揉 U+63C9
+    0xD7E1, // 揍 U+63CD
+    0xC3E8, // 描 U+63CF
+    0xCCE1, // 提 U+63D0
+    0xB2E5, // 插 U+63D2
+    0xD2BE, // 揖 U+63D6
+    0xCED5, // 握 U+63E1
+    0xB4A7, // 揣 U+63E3
+    0xBFAB, // 揩 U+63E9
+    0xBEBE, // 揪 U+63EA
+    0xBDD2, // 揭 U+63ED
+    0xD4AE, // 援 U+63F4
+    0xC0BF, // 揽 U+63FD
+    0xB2F3, // 搀 U+6400
+    0xB8E9, // 搁 U+6401
+    0xC2A7, // 搂 U+6402
+    0xBDC1, // 搅 U+6405
+    0xB2AB, // 搏 U+640F
+    0xB4A4, // 搐 U+6410
+    0xB4EA, // 搓 U+6413
+    0xC9A6, // 搔 U+6414
+    0xCBD1, // 搜 U+641C
+    0xB8E3, // 搞 U+641E
+    0xCCC2, // 搪 U+642A
+    0xB0E1, // 搬 U+642C
+    0xB4EE, // 搭 U+642D
+    0xD0AF, // 携 U+643A
+    0xB2EB, // 搽 U+643D
+    0xC9E3, // 摄 U+6444
+    0xB0DA, // 摆 U+6446
+    0xD2A1, // 摇 U+6447
+    0xB1F7, // 摈 U+6448
+    0xCCAF, // 摊 U+644A
+    0xCBA4, // 摔 U+6454
+    0xD5AA, // 摘 U+6458
+    0xB4DD, // 摧 U+6467
+    0xC4A6, // 摩 U+6469
+    0xC3FE, // 摸 U+6478
+    0xC4A1, // 摹 U+6479
+    0xC1CC, // 撂 U+6482
+    0xBEEF, // 撅 U+6485
+    0xC6B2, // 撇 U+6487
+    0xB3C5, // 撑 U+6491
+    0xC8F6, // 撒 U+6492
+    0xCBBA, // 撕 U+6495
+    0xD7B2, // 撞 U+649E
+    0xB3B7, // 撤 U+64A4
+    0xC1C3, // 撩 U+64A9
+    0xC7CB, // 撬 U+64AC
+    0xB2A5, // 播 U+64AD
+    0xB4E9, // 撮 U+64AE
+    0xD7AB, // 撰 U+64B0
+    0xC4EC, // 撵 U+64B5
+    0xBAB3, // 撼 U+64BC
+    0xC0DE, // 擂 U+64C2
+    0xC9C3, // 擅 U+64C5
+    0xB2D9, // 操 U+64CD
+    0xC7E6, // 擎 U+64CE
+    0xC7DC, // 擒 U+64D2
+    0xCBD3, // 擞 U+64DE
+    0xB2C1, // 擦 U+64E6
+    0xC5CA, // 攀 U+6500
+    0xD4DC, // 攒 U+6512
+    0xC8C1, // 攘 U+6518
+    0xBEF0, // 攫 U+652B
+    0xD6A7, // 支 U+652F
+    0xCAD5, // 收 U+6536
+    0xB8C4, // 改 U+6539
+    0xB9A5, // 攻 U+653B
+    0xB7C5, // 放 U+653E
+    0xD5FE, // 政 U+653F
+    0xB9CA, // 故 U+6545
+    0xD0A7, // 效 U+6548
+    0xB5D0, // 敌 U+654C
+    0xC3F4, // 敏 U+654F
+    0xBEC8, // 救 U+6551
+    0xB0BD, // 敖 U+6556
+    0xBDCC, // 教 U+6559
+    0xC1B2, // 敛 U+655B
+    0xB1D6, // 敝 U+655D
+    0xB3A8, // 敞 U+655E
+    0xB8D2, // 敢 U+6562
+    0xC9A2, // 散 U+6563
+    0xB6D8, // 敦 U+6566
+    0xBEB4, // 敬 U+656C
+    0xCAFD, // 数 U+6570
+    0xC7C3, // 敲 U+6572
+    0xD5FB, // 整 U+6574
+    0xB7F3, // 敷 U+6577
+    0xCEC4, // 文 U+6587
+    0xD5AB, // 斋 U+658B
+    0xB1F3, // 斌 U+658C
+    0xB0DF, // 斑 U+6591
+    0xB6B7, // 斗 U+6597
+    0xC1CF, // 料 U+6599
+    0xD0B1, // 斜 U+659C
+    0xD5E5, // 斟 U+659F
+    0xCED3, // 斡 U+65A1
+    0xBDEF, // 斤 U+65A4
+    0xB3E2, // 斥 U+65A5
+    0xB8AB, // 斧 U+65A7
+    0xD5B6, // 斩 U+65A9
+    0xB6CF, // 断 U+65AD
+    0xCBB9, // 斯 U+65AF
+    0xD0C2, // 新 U+65B0
+    0xB7BD, // 方 U+65B9
+    0xCAA9, // 施 U+65BD
+    0xC5D4, // 旁 U+65C1
+    0xC2C3, // 旅 U+65C5
+    0xD0FD, // 旋 U+65CB
+    0xD7E5, // 族 U+65CF
+    0xC6EC, // 旗 U+65D7
+    0xCEDE, // 无 U+65E0
+    0xBCC8, // 既 U+65E2
+    0xC8D5, // 日 U+65E5
+    0xB5A9, // 旦 U+65E6
+    0xBEC9, // 旧 U+65E7
+    0xD6BC, // 旨 U+65E8
+    0xD4E7, // 早 U+65E9
+    0xD1AE, // 旬 U+65EC
+    0xD0F1, // 旭 U+65ED
+    0xBAB5, // 旱 U+65F1
+    0xCAB1, // 时 U+65F6
+    0xBFF5, // 旷 U+65F7
+    0xCDFA, // 旺 U+65FA
+    0xB0BA, // 昂 U+6602
+    0xC0A5, // 昆 U+6606
+    0xB2FD, // 昌 U+660C
+    0xC3F7, // 明 U+660E
+    0xBBE8, // 昏 U+660F
+    0xD2D7, // 易 U+6613
+    0xCEF4, // 昔 U+6614
+    0xD0C7, // 星 U+661F
+    0xD3B3, // 映 U+6620
+    0xB4BA, // 春 U+6625
+    0xC3C1, // 昧 U+6627
+    0xD7F2, // 昨 U+6628
+    0xD5D1, // 昭 U+662D
+    0xCAC7, // 是 U+662F
+    0xD6E7, // 昼 U+663C
+    0xCFD4, // 显 U+663E
+    0xBBCE, // 晃 U+6643
+    0xBDFA, // 晋 U+664B
+    0xC9CE, // 晌 U+664C
+    0xC9B9, // 晒 U+6652
+    0xCFFE, // 晓 U+6653
+    0xD4CE, // 晕 U+6655
+    0xCDED, // 晚 U+665A
+    0xCEEE, // 晤 U+6664
+    0xBBDE, // 晦 U+6666
+    0xB3BF, // 晨 U+6668
+    0xC6D5, // 普 U+666E
+    0xBEB0, // 景 U+666F
+    0xCEFA, // 晰 U+6670
+    0xC7E7, // 晴 U+6674
+    0xBEA7, // 晶 U+6676
+    0xD6C7, // 智 U+667A
+    0xC1C0, // 晾 U+667E
+    0xD4DD, // 暂 U+6682
+    0xCFBE, // 暇 U+6687
+    0xCAEE, // 暑 U+6691
+    0xC5AF, // 暖 U+6696
+    0xB0B5, // 暗 U+6697
+    0xC4BA, // 暮 U+66AE
+    0xB1A9, // 暴 U+66B4
+    0xCAEF, // 曙 U+66D9
+    0xC6D8, // 曝 U+66DD
+    0xD4BB, // 曰 U+66F0
+    0xC7FA, // 曲 U+66F2
+    0xD2B7, // 曳 U+66F3
+    0xB8FC, // 更 U+66F4
+    0xB2DC, // 曹 U+66F9
+    0xC2FC, // 曼 U+66FC
+    0xD4F8, // 曾 U+66FE
+    0xCCE6, // 替 U+66FF
+    0xD7EE, // 最 U+6700
+    0xD4C2, // 月 U+6708
+    0xD3D0, // 有 U+6709
+    0xC5F3, // 朋 U+670B
+    0xB7FE, // 服 U+670D
+    0xCBB7, // 朔 U+6714
+    0xC0CA, // 朗 U+6717
+    0xCDFB, // 望 U+671B
+    0xB3AF, // 朝 U+671D
+    0xC6DA, // 期 U+671F
+    0xC4BE, // 木 U+6728
+    0xCEB4, // 未 U+672A
+    0xC4A9, // 末 U+672B
+    0xB1BE, // 本 U+672C
+    0xD4FD, // 札 U+672D
+    0xCAF5, // 术 U+672F
+    0xD6EC, // 朱 U+6731
+    0xC6D3, // 朴 U+6734
+    0xB6E4, // 朵 U+6735
+    0xBBFA, // 机 U+673A
+    0xD0E0, // 朽 U+673D
+    0xC9B1, // 杀 U+6740
+    0xD4D3, // 杂 U+6742
+    0xC8A8, // 权 U+6743
+    0xB8CB, // 杆 U+6746
+    0xC9BC, // 杉 U+6749
+    0xC0EE, // 李 U+674E
+    0xD0D3, // 杏 U+674F
+    0xB2C4, // 材 U+6750
+    0xB4E5, // 村 U+6751
+    0xD5C8, // 杖 U+6756
+    0xB6C5, // 杜 U+675C
+    0xCAF8, // 束 U+675F
+    0xB8DC, // 杠 U+6760
+    0xCCF5, // 条 U+6761
+    0xC0B4, // 来 U+6765
+    0xD1EE, // 杨 U+6768
+    0xBABC, // 杭 U+676D
+    0xB1AD, // 杯 U+676F
+    0xBDDC, // 杰 U+6770
+    0xCBC9, // 松 U+677E
+    0xB0E5, // 板 U+677F
+    0xBCAB, // 极 U+6781
+    0xB9B9, // 构 U+6784
+    0xCDF7, // 枉 U+6789
+    0xCEF6, // 析 U+6790
+    0xD5ED, // 枕 U+6795
+    0xC1D6, // 林 U+6797
+    0xC3B6, // 枚 U+679A
+    0xB9FB, // 果 U+679C
+    0xD6A6, // 枝 U+679D
+    0xCAE0, // 枢 U+67A2
+    0xD4E6, // 枣 U+67A3
+    0xC7B9, // 枪 U+67AA
+    0xB7E3, // 枫 U+67AB
+    0xBFDD, // 枯 U+67AF
+    0xBCDC, // 架 U+67B6
+    0xBCCF, // 枷 U+67B7
+    0xB1FA, // 柄 U+67C4
+    0xB0D8, // 柏 U+67CF
+    0xC4B3, // 某 U+67D0
+    0xB8CC, // 柑 U+67D1
+    0xC6E2, // 柒 U+67D2
+    0xC8BE, // 染 U+67D3
+    0xC8E1, // 柔 U+67D4
+    0xB9F1, // 柜 U+67DC
+    0xD7F5, // 柞 U+67DE
+    0xC4FB, // 柠 U+67E0
+    0xB2E9, // 查 U+67E5
+    0xBCED, // 柬 U+67EC
+    0xBFC2, // 柯 U+67EF
+    0xD6F9, // 柱 U+67F1
+    0xC1F8, // 柳 U+67F3
+    0xB2F1, // 柴 U+67F4
+    0xCAC1, // 柿 U+67FF
+    0xD5A4, // 栅 U+6805
+    0xB1EA, // 标 U+6807
+    0xD5BB, // 栈 U+6808
+    0xB6B0, // 栋 U+680B
+    0xC0B8, // 栏 U+680F
+    0xCAF7, // 树 U+6811
+    0xCBA8, // 栓 U+6813
+    0xC6DC, // 栖 U+6816
+    0xC0F5, // 栗 U+6817
+    0xD0A3, // 校 U+6821
+    0xD6EA, // 株 U+682A
+    0xD1F9, // 样 U+6837
+    0xBACB, // 核 U+6838
+    0xB8F9, // 根 U+6839
+    0xB8F1, // 格 U+683C
+    0xD4D4, // 栽 U+683D
+    0xB9F0, // 桂 U+6842
+    0xCCD2, // 桃 U+6843
+    0xCEA6, // 桅 U+6845
+    0xBFF2, // 框 U+6846
+    0xB0B8, // 案 U+6848
+    0xD7C0, // 桌 U+684C
+    0xCDA9, // 桐 U+6850
+    0xC9A3, // 桑 U+6851
+    0xBBB8, // 桓 U+6853
+    0xBDDB, // 桔 U+6854
+    0xB5B5, // 档 U+6863
+    0xC7C5, // 桥 U+6865
+    0xBDB0, // 桨 U+6868
+    0xD7AE, // 桩 U+6869
+    0xCDB0, // 桶 U+6876
+    0xC1BA, // 梁 U+6881
+    0xC3B7, // 梅 U+6885
+    0xB0F0, // 梆 U+6886
+    0xB9A3, // 梗 U+6897
+    0xC9D2, // 梢 U+68A2
+    0xC3CE, // 梦 U+68A6
+    0xCEE0, // 梧 U+68A7
+    0xC0E6, // 梨 U+68A8
+    0xCBF3, // 梭 U+68AD
+    0xCCDD, // 梯 U+68AF
+    0xD0B5, // 械 U+68B0
+    0xCAE1, // 梳 U+68B3
+    0xBCEC, // 检 U+68C0
+    0xC3DE, // 棉 U+68C9
+    0xC6E5, // 棋 U+68CB
+    0xB9F7, // 棍 U+68CD
+    0xB0F4, // 棒 U+68D2
+    0xD7D8, // 棕 U+68D5
+    0xBCAC, // 棘 U+68D8
+    0xC5EF, // 棚 U+68DA
+    0xCCC4, // 棠 U+68E0
+    0xC9AD, // 森 U+68EE
+    0xC0E2, // 棱 U+68F1
+    0xBFC3, // 棵 U+68F5
+    0xB9D7, // 棺 U+68FA
+    0xD2CE, // 椅 U+6905
+    0xD6B2, // 植 U+690D
+    0xD7B5, // 椎 U+690E
+    0xBDB7, // 椒 U+6912
+    0xCDD6, // 椭 U+692D
+    0xD2AC, // 椰 U+6930
+    0xB4AA, // 椽 U+693D
+    0xB4BB, // 椿 U+693F
+    0xD0A8, // 楔 U+6954
+    0xB3FE, // 楚 U+695A
+    0xC0E3, // 楞 U+695E
+    0xBFAC, // 楷 U+6977
+    0xC2A5, // 楼 U+697C
+    0xB8C5, // 概 U+6982
+    0xD3DC, // 榆 U+6986
+    0xC0C6, // 榔 U+6994
+    0xB0F1, // 榜 U+699C
+    0xD5A5, // 榨 U+69A8
+    0xC1F1, // 榴 U+69B4
+    0xC8B6, // 榷 U+69B7
+    0xBBB1, // 槐 U+69D0
+    0xBCF7, // 槛 U+69DB
+    0xB2DB, // 槽 U+69FD
+    0xB7AE, // 樊 U+6A0A
+    0xD5C1, // 樟 U+6A1F
+    0xC4A3, // 模 U+6A21
+    0xBAE1, // 横 U+6A2A
+    0xD3A3, // 樱 U+6A31
+    0xC7C1, // 橇 U+6A47
+    0xB3C8, // 橙 U+6A59
+    0xCFF0, // 橡 U+6A61
+    0xB3F7, // 橱 U+6A71
+    0xCCB4, // 檀 U+6A80
+    0xCFAD, // 檄 U+6A84
+    0xC3CA, // 檬 U+6AAC
+    0xC7B7, // 欠 U+6B20
+    0xB4CE, // 次 U+6B21
+    0xBBB6, // 欢 U+6B22
+    0xD0C0, // 欣 U+6B23
+    0xC5B7, // 欧 U+6B27
+    0xD3FB, // 欲 U+6B32
+    0xC6DB, // 欺 U+6B3A
+    0xBFEE, // 款 U+6B3E
+    0xD0AA, // 歇 U+6B47
+    0xC7B8, // 歉 U+6B49
+    0xB8E8, // 歌 U+6B4C
+    0xD6B9, // 止 U+6B62
+    0xD5FD, // 正 U+6B63
+    0xB4CB, // 此 U+6B64
+    0xB2BD, // 步 U+6B65
+    0xCEE4, // 武 U+6B66
+    0xC6E7, // 歧 U+6B67
+    0xCDE1, // 歪 U+6B6A
+    0xB4F5, // 歹 U+6B79
+    0xCBC0, // 死 U+6B7B
+    0xBCDF, // 歼 U+6B7C
+    0xD1EA, // 殃 U+6B83
+    0xB4F9, // 殆 U+6B86
+    0xD1B3, // 殉 U+6B89
+    0xCAE2, // 殊 U+6B8A
+    0xB2D0, // 残 U+6B8B
+    0xD6B3, // 殖 U+6B96
+    0xC5B9, // 殴 U+6BB4
+    0xB6CE, // 段 U+6BB5
+    0xD2F3, // 殷 U+6BB7
+    0xB5EE, // 殿 U+6BBF
+    0xBBD9, // 毁 U+6BC1
+    0xD2E3, // 毅 U+6BC5
+    0xCEE3, // 毋 U+6BCB
+    0xC4B8, // 母 U+6BCD
+    0xC3BF, // 每 U+6BCF
+    0xB6BE, // 毒 U+6BD2
+    0xB1C8, // 比 U+6BD4
+    0xB1CF, // 毕 U+6BD5
+    0xB1D1, // 毖 U+6BD6
+    0xC5FE, // 毗 U+6BD7
+    0xB1D0, // 毙 U+6BD9
+    0xC3AB, // 毛 U+6BDB
+    0xD5B1, // 毡 U+6BE1
+    0xBAC1, // 毫 U+6BEB
+    0xCCBA, // 毯 U+6BEF
+    0xCACF, // 氏 U+6C0F
+    0xC3F1, // 民 U+6C11
+    0xC3A5, // 氓 U+6C13
+    0xC6F8, // 气 U+6C14
+    0xC4CA, // 氖 U+6C16
+    0xB7D5, // 氛 U+6C1B
+    0xB7FA, // 氟 U+6C1F
+    0xC7E2, // 氢 U+6C22
+    0xBAA4, // 氦 U+6C26
+    0xD1F5, // 氧 U+6C27
+    0xB0B1, // 氨 U+6C28
+    0xB5AA, // 氮 U+6C2E
+    0xC2C8, // 氯 U+6C2F
+    0xC7E8, // 氰 U+6C30
+    0xCBAE, // 水 U+6C34
+    0xD3C0, // 永 U+6C38
+    0xCDA1, // 汀 U+6C40
+    0xD6AD, // 汁 U+6C41
+    0xC7F3, // 求 U+6C42
+    0xBBE3, // 汇 U+6C47
+    0xBABA, // 汉 U+6C49
+    0xCFAB, // 汐 U+6C50
+    0xC9C7, // 汕 U+6C55
+    0xBAB9, // 汗 U+6C57
+    0xD1B4, // 汛 U+6C5B
+    0xC8EA, // 汝 U+6C5D
+    0xB9AF, // 汞 U+6C5E
+    0xBDAD, // 江 U+6C5F
+    0xB3D8, // 池 U+6C60
+    0xCEDB, // 污 U+6C61
+    0xCCC0, // 汤 U+6C64
+    0xCDF4, // 汪 U+6C6A
+    0xCCAD, // 汰 U+6C70
+    0xBCB3, // 汲 U+6C72
+    0xD0DA, // 汹 U+6C79
+    0xC6FB, // 汽 U+6C7D
+    0xB7DA, // 汾 U+6C7E
+    0xC7DF, // 沁 U+6C81
+    0xD2CA, // 沂 U+6C82
+    0xCED6, // 沃 U+6C83
+    0xC9F2, // 沈 U+6C88
+    0xB3C1, // 沉 U+6C89
+    0xC6E3, // 沏 U+6C8F
+    0xC9B3, // 沙 U+6C99
+    0xC5E6, // 沛 U+6C9B
+    0xB9B5, // 沟 U+6C9F
+    0xC3BB, // 没 U+6CA1
+    0xC5BD, // 沤 U+6CA4
+    0xC1A4, // 沥 U+6CA5
+    0xC2D9, // 沦 U+6CA6
+    0xB2D7, // 沧 U+6CA7
+    0xBBA6, // 沪 U+6CAA
+    0xC4AD, // 沫 U+6CAB
+    0xBEDA, // 沮 U+6CAE
+    0xBAD3, // 河 U+6CB3
+    0xB7D0, // 沸 U+6CB8
+    0xD3CD, // 油 U+6CB9
+    0xD6CE, // 治 U+6CBB
+    0xD5D3, // 沼 U+6CBC
+    0xB9C1, // 沽 U+6CBD
+    0xD5B4, // 沾 U+6CBE
+    0xD1D8, // 沿 U+6CBF
+    0xD0B9, // 泄 U+6CC4
+    0xC7F6, // 泅 U+6CC5
+    0xC8AA, // 泉 U+6CC9
+    0xB2B4, // 泊 U+6CCA
+    0xC3DA, // 泌 U+6CCC
+    0xB7A8, // 法 U+6CD5
+    0xB7BA, // 泛 U+6CDB
+    0xC5A2, // 泞 U+6CDE
+    0xC5DD, // 泡 U+6CE1
+    0xB2A8, // 波 U+6CE2
+    0xC6FC, // 泣 U+6CE3
+    0xC4E0, // 泥 U+6CE5
+    0xD7A2, // 注 U+6CE8
+    0xC0E1, // 泪 U+6CEA
+    0xCCA9, // 泰 U+6CF0
+    0xD3BE, // 泳 U+6CF3
+    0xB1C3, // 泵 U+6CF5
+    0xD0BA, // 泻 U+6CFB
+    0xC6C3, // 泼 U+6CFC
+    0xD4F3, // 泽 U+6CFD
+    0xBDE0, // 洁 U+6D01
+    0xD1F3, // 洋 U+6D0B
+    0xC8F7, // 洒 U+6D12
+    0xCFB4, // 洗 U+6D17
+    0xC2E5, // 洛 U+6D1B
+    0xB6B4, // 洞 U+6D1E
+    0xBDF2, // 津 U+6D25
+    0xBAE9, // 洪 U+6D2A
+    0xB6FD, // 洱 U+6D31
+    0xD6DE, // 洲 U+6D32
+    0xBBEE, // 活 U+6D3B
+    0xCDDD, // 洼 U+6D3C
+    0xC7A2, // 洽 U+6D3D
+    0xC5C9, // 派 U+6D3E
+    0xC1F7, // 流 U+6D41
+    0xC7B3, // 浅 U+6D45
+    0xBDAC, // 浆 U+6D46
+    0xBDBD, // 浇 U+6D47
+    0xD7C7, // 浊 U+6D4A
+    0xB2E2, // 测 U+6D4B
+    0xBCC3, // 济 U+6D4E
+    0xBBEB, // 浑 U+6D51
+    0xC5A8, // 浓 U+6D53
+    0xD5E3, // 浙 U+6D59
+    0xBFA3, // 浚 U+6D5A
+    0xC6D6, // 浦 U+6D66
+    0xBAC6, // 浩 U+6D69
+    0xC0CB, // 浪 U+6D6A
+    0xB8A1, // 浮 U+6D6E
+    0xD4A1, // 浴 U+6D74
+    0xBAA3, // 海 U+6D77
+    0xBDFE, // 浸 U+6D78
+    0xCDBF, // 涂 U+6D82
+    0xC4F9, // 涅 U+6D85
+    0xCFFB, // 消 U+6D88
+    0xC9E6, // 涉 U+6D89
+    0xD3BF, // 涌 U+6D8C
+    0xCFD1, // 涎 U+6D8E
+    0xCCE9, // 涕 U+6D95
+    0xCCCE, // 涛 U+6D9B
+    0xC0D4, // 涝 U+6D9D
+    0xC1B0, // 涟 U+6D9F
+    0xCED0, // 涡 U+6DA1
+    0xBBC1, // 涣 U+6DA3
+    0xB5D3, // 涤 U+6DA4
+    0xC8F3, // 润 U+6DA6
+    0xBDA7, // 涧 U+6DA7
+    0xD5C7, // 涨 U+6DA8
+    0xC9AC, // 涩 U+6DA9
+    0xB8A2, // 涪 U+6DAA
+    0xD1C4, // 涯 U+6DAF
+    0xD2BA, // 液 U+6DB2
+    0xBAAD, // 涵 U+6DB5
+    0xBAD4, // 涸 U+6DB8
+    0xB5ED, // 淀 U+6DC0
+    0xD7CD, // 淄 U+6DC4
+    0xCFFD, // 淆 U+6DC6
+    0xC1DC, // 淋 U+6DCB
+    0xCCCA, // 淌 U+6DCC
+    0xCAE7, // 淑 U+6DD1
+    0xC4D7, // 淖 U+6DD6
+    0xCCD4, // 淘 U+6DD8
+    0xB5AD, // 淡 U+6DE1
+    0xD3D9, // 淤 U+6DE4
+    0xD2F9, // 淫 U+6DEB
+    0xB4E3, // 淬 U+6DEC
+    0xBBB4, // 淮 U+6DEE
+    0xC9EE, // 深 U+6DF1
+    0xB4BE, // 淳 U+6DF3
+    0xBBEC, // 混 U+6DF7
+    0xD1CD, // 淹 U+6DF9
+    0xCCED, // 添 U+6DFB
+    0xC7E5, // 清 U+6E05
+    0xD4A8, // 渊 U+6E0A
+    0xD7D5, // 渍 U+6E0D
+    0xBDA5, // 渐 U+6E10
+    0xD3E6, // 渔 U+6E14
+    0xC9F8, // 渗 U+6E17
+    0xD3E5, // 渝 U+6E1D
+    0xC7FE, // 渠 U+6E20
+    0xB6C9, // 渡 U+6E21
+    0xD4FC, // 渣 U+6E23
+    0xB2B3, // 渤 U+6E24
+    0xCEC2, // 温 U+6E29
+    0xCEBC, // 渭 U+6E2D
+    0xB8DB, // 港 U+6E2F
+    0xBFCA, // 渴 U+6E34
+    0xD3CE, // 游 U+6E38
+    0xC3EC, // 渺 U+6E3A
+    0xC5C8, // 湃 U+6E43
+    0xCDC4, // 湍 U+6E4D
+    0xBAFE, // 湖 U+6E56
+    0xCFE6, // 湘 U+6E58
+    0xD5BF, // 湛 U+6E5B
+    0xCDE5, // 湾 U+6E7E
+    0xCAAA, // 湿 U+6E7F
+    0xC0A3, // 溃 U+6E83
+    0xBDA6, // 溅 U+6E85
+    0xB8C8, // 溉 U+6E89
+    0xD4B4, // 源 U+6E90
+    0xC1EF, // 溜 U+6E9C
+    0xD2E7, // 溢 U+6EA2
+    0xCFAA, // 溪 U+6EAA
+    0xCBDD, // 溯 U+6EAF
+    0xC8DC, // 溶 U+6EB6
+    0xC4E7, // 溺 U+6EBA
+    0xB3FC, // 滁 U+6EC1
+    0xB5E1, // 滇 U+6EC7
+    0xD7CC, // 滋 U+6ECB
+    0xBBAC, // 滑 U+6ED1
+    0xD7D2, // 滓 U+6ED3
+    0xCCCF, // 滔 U+6ED4
+    0xB9F6, // 滚 U+6EDA
+    0xD6CD, // 滞 U+6EDE
+    0xC2FA, // 满 U+6EE1
+    0xC2CB, // 滤 U+6EE4
+    0xC0C4, // 滥 U+6EE5
+    0xC2D0, // 滦 U+6EE6
+    0xB1F5, // 滨 U+6EE8
+    0xCCB2, // 滩 U+6EE9
+    0xB5CE, // 滴 U+6EF4
+    0xC6AF, // 漂 U+6F02
+    0xC6E1, // 漆 U+6F06
+    0xC2A9, // 漏 U+6F0F
+    0xC0EC, // 漓 U+6F13
+    0xD1DD, // 演 U+6F14
+    0xC4AE, // 漠 U+6F20
+    0xC2FE, // 漫 U+6F2B
+    0xCAFE, // 漱 U+6F31
+    0xD5C4, // 漳 U+6F33
+    0xD1FA, // 漾 U+6F3E
+    0xCEAB, // 潍 U+6F4D
+    0xC5CB, // 潘 U+6F58
+    0xC7B1, // 潜 U+6F5C
+    0xC2BA, // 潞 U+6F5E
+    0xC1CA, // 潦 U+6F66
+    0xCCB6, // 潭 U+6F6D
+    0xB3B1, // 潮 U+6F6E
+    0xB3CE, // 澄 U+6F84
+    0xB3BA, // 澈 U+6F88
+    0xC5EC, // 澎 U+6F8E
+    0xC0BD, // 澜 U+6F9C
+    0xD4E8, // 澡 U+6FA1
+    0xB0C4, // 澳 U+6FB3
+    0xBCA4, // 激 U+6FC0
+    0xB1F4, // 濒 U+6FD2
+    0xC6D9, // 瀑 U+7011
+    0xB9E0, // 灌 U+704C
+    0xBBF0, // 火 U+706B
+    0xC3F0, // 灭 U+706D
+    0xB5C6, // 灯 U+706F
+    0xBBD2, // 灰 U+7070
+    0xC1E9, // 灵 U+7075
+    0xD4EE, // 灶 U+7076
+    0xBEC4, // 灸 U+7078
+    0xD7C6, // 灼 U+707C
+    0xD4D6, // 灾 U+707E
+    0xB2D3, // 灿 U+707F
+    0xC2AF, // 炉 U+7089
+    0xB4B6, // 炊 U+708A
+    0xD1D7, // 炎 U+708E
+    0xB3B4, // 炒 U+7092
+    0xC8B2, // 炔 U+7094
+    0xBFBB, // 炕 U+7095
+    0xD6CB, // 炙 U+7099
+    0xBEE6, // 炬 U+70AC
+    0xCCBF, // 炭 U+70AD
+    0xC5DA, // 炮 U+70AE
+    0xBEBC, // 炯 U+70AF
+    0xB1FE, // 炳 U+70B3
+    0xD5A8, // 炸 U+70B8
+    0xB5E3, // 点 U+70B9
+    0xC1B6, // 炼 U+70BC
+    0xB3E3, // 炽 U+70BD
+    0xCBB8, // 烁 U+70C1
+    0xC0C3, // 烂 U+70C2
+    0xCCFE, // 烃 U+70C3
+    0xC1D2, // 烈 U+70C8
+    0xBAE6, // 烘 U+70D8
+    0xC0D3, // 烙 U+70D9
+    0xD6F2, // 烛 U+70DB
+    0xD1CC, // 烟 U+70DF
+    0xBFBE, // 烤 U+70E4
+    0xB7B3, // 烦 U+70E6
+    0xC9D5, // 烧 U+70E7
+    0xBBE2, // 烩 U+70E9
+    0xCCCC, // 烫 U+70EB
+    0xBDFD, // 烬 U+70EC
+    0xC8C8, // 热 U+70ED
+    0xCFA9, // 烯 U+70EF
+    0xCDE9, // 烷 U+70F7
+    0xC5EB, // 烹 U+70F9
+    0xB7E9, // 烽 U+70FD
+    0xD1C9, // 焉 U+7109
+    0xBAB8, // 焊 U+710A
+    0xBBC0, // 焕 U+7115
+    0xB1BA, // 焙 U+7119
+    0xB7D9, // 焚 U+711A
+    0xBDB9, // 焦 U+7126
+    0xD1E6, // 焰 U+7130
+    0xC8BB, // 然 U+7136
+    0xBBCD, // 煌 U+714C
+    0xBCE5, // 煎 U+714E
+    0xC9B7, // 煞 U+715E
+    0xC3BA, // 煤 U+7164
+    0xD5D5, // 照 U+7167
+    0xD6F3, // 煮 U+716E
+    0xC9BF, // 煽 U+717D
+    0xCFA8, // 熄 U+7184
+    0xD0DC, // 熊 U+718A
+    0xD1AC, // 熏 U+718F
+    0xC8DB, // 熔 U+7194
+    0xCEF5, // 熙 U+7199
+    0xCAEC, // 熟 U+719F
+    0xB0BE, // 熬 U+71AC
+    0xC8BC, // 燃 U+71C3
+    0xC1C7, // 燎 U+71CE
+    0xD1E0, // 燕 U+71D5
+    0xD4EF, // 燥 U+71E5
+    0xB1AC, // 爆 U+7206
+    0xD7A6, // 爪 U+722A
+    0xC5C0, // 爬 U+722C
+    0xB0AE, // 爱 U+7231
+    0xBEF4, // 爵 U+7235
+    0xB8B8, // 父 U+7236
+    0xD2AF, // 爷 U+7237
+    0xB0D6, // 爸 U+7238
+    0xB5F9, // 爹 U+7239
+    0xCBAC, // 爽 U+723D
+    0xC6AC, // 片 U+7247
+    0xB0E6, // 版 U+7248
+    0xC5C6, // 牌 U+724C
+    0xD1C0, // 牙 U+7259
+    0xC5A3, // 牛 U+725B
+    0xC4B2, // 牟 U+725F
+    0xC4B5, // 牡 U+7261
+    0xC0CE, // 牢 U+7262
+    0xC4C1, // 牧 U+7267
+    0xCEEF, // 物 U+7269
+    0xC9FC, // 牲 U+7272
+    0xC7A3, // 牵 U+7275
+    0xCCD8, // 特 U+7279
+    0xCEFE, // 牺 U+727A
+    0xCFAC, // 犀 U+7280
+    0xC0E7, // 犁 U+7281
+    0xB6BF, // 犊 U+728A
+    0xC8AE, // 犬 U+72AC
+    0xB7B8, // 犯 U+72AF
+    0xD7B4, // 状 U+72B6
+    0xD3CC, // 犹 U+72B9
+    0xBFF1, // 狂 U+72C2
+    0xB5D2, // 狄 U+72C4
+    0xB1B7, // 狈 U+72C8
+    0xBAFC, // 狐 U+72D0
+    0xB9B7, // 狗 U+72D7
+    0xBED1, // 狙 U+72D9
+    0xC4FC, // 狞 U+72DE
+    0xBADD, // 狠 U+72E0
+    0xBDC6, // 狡 U+72E1
+    0xB6C0, // 独 U+72EC
+    0xCFC1, // 狭 U+72ED
+    0xCAA8, // 狮 U+72EE
+    0xD5F8, // 狰 U+72F0
+    0xD3FC, // 狱 U+72F1
+    0xC0EA, // 狸 U+72F8
+    0xC0C7, // 狼 U+72FC
+    0xC1D4, // 猎 U+730E
+    0xB2FE, // 猖 U+7316
+    0xC3CD, // 猛 U+731B
+    0xB2C2, // 猜 U+731C
+    0xD0C9, // 猩 U+7329
+    0xD6ED, // 猪 U+732A
+    0xC3A8, // 猫 U+732B
+    0xCFD7, // 献 U+732E
+    0xBAEF, // 猴 U+7334
+    0xBBAB, // 猾 U+733E
+    0xD4B3, // 猿 U+733F
+    0xCCA1, // 獭 U+736D
+    0xD0FE, // 玄 U+7384
+    0xC2CA, // 率 U+7387
+    0xD3F1, // 玉 U+7389
+    0xCDF5, // 王 U+738B
+    0xBEC1, // 玖 U+7396
+    0xC2EA, // 玛 U+739B
+    0xCDE6, // 玩 U+73A9
+    0xC3B5, // 玫 U+73AB
+    0xBBB7, // 环 U+73AF
+    0xCFD6, // 现 U+73B0
+    0xC1E1, // 玲 U+73B2
+    0xB2A3, // 玻 U+73BB
+    0xC9BA, // 珊 U+73CA
+    0xD5E4, // 珍 U+73CD
+    0xB7A9, // 珐 U+73D0
+    0xD6E9, // 珠 U+73E0
+    0xB0E0, // 班 U+73ED
+    0xC7F2, // 球 U+7403
+    0xC0C5, // 琅 U+7405
+    0xC0ED, // 理 U+7406
+    0xC1F0, // 琉 U+7409
+    0xCBF6, // 琐 U+7410
+    0xD7C1, // 琢 U+7422
+    0xC1D5, // 琳 U+7433
+    0xC7D9, // 琴 U+7434
+    0xC5FD, // 琵 U+7435
+    0xC5C3, // 琶 U+7436
+    0xC7ED, // 琼 U+743C
+    0xBAF7, // 瑚 U+745A
+    0xC8F0, // 瑞 U+745E
+    0xC9AA, // 瑟 U+745F
+    0xB9E5, // 瑰 U+7470
+    0xD1FE, // 瑶 U+7476
+    0xC1A7, // 璃 U+7483
+    0xB9CF, // 瓜 U+74DC
+    0xC6B0, // 瓢 U+74E2
+    0xB0EA, // 瓣 U+74E3
+    0xC8BF, // 瓤 U+74E4
+    0xCDDF, // 瓦 U+74E6
+    0xCECD, // 瓮 U+74EE
+    0xC6BF, // 瓶 U+74F6
+    0xB4C9, // 瓷 U+74F7
+    0xD5E7, // 甄 U+7504
+    0xB8CA, // 甘 U+7518
+    0xC9F5, // 甚 U+751A
+    0xCCF0, // 甜 U+751C
+    0xC9FA, // 生 U+751F
+    0xC9FB, // 甥 U+7525
+    0xD3C3, // 用 U+7528
+    0xCBA6, // 甩 U+7529
+    0xB8A6, // 甫 U+752B
+    0xB1C2, // 甭 U+752D
+    0xCCEF, // 田 U+7530
+    0xD3C9, // 由 U+7531
+    0xBCD7, // 甲 U+7532
+    0xC9EA, // 申 U+7533
+    0xB5E7, // 电 U+7535
+    0xC4D0, // 男 U+7537
+    0xB5E9, // 甸 U+7538
+    0xBBAD, // 画 U+753B
+    0xB3A9, // 畅 U+7545
+    0xBDE7, // 界 U+754C
+    0xCEB7, // 畏 U+754F
+    0xC5CF, // 畔 U+7554
+    0xC1F4, // 留 U+7559
+    0xD0F3, // 畜 U+755C
+    0xC2D4, // 略 U+7565
+    0xC6E8, // 畦 U+7566
+    0xB7AC, // 番 U+756A
+    0xB3EB, // 畴 U+7574
+    0xBBFB, // 畸 U+7578
+    0xBDAE, // 疆 U+7586
+    0xCAE8, // 疏 U+758F
+    0xD2C9, // 疑 U+7591
+    0xC1C6, // 疗 U+7597
+    0xB8ED, // 疙 U+7599
+    0xBECE, // 疚 U+759A
+    0xC5B1, // 疟 U+759F
+    0xD1F1, // 疡 U+75A1
+    0xB0CC, // 疤 U+75A4
+    0xBDEA, // 疥 U+75A5
+    0xD2DF, // 疫 U+75AB
+    0xB4AF, // 疮 U+75AE
+    0xB7E8, // 疯 U+75AF
+    0xC6A3, // 疲 U+75B2
+    0xB4C3, // 疵 U+75B5
+    0xD5EE, // 疹 U+75B9
+    0xCCDB, // 疼 U+75BC
+    0xBED2, // 疽 U+75BD
+    0xBCB2, // 疾 U+75BE
+    0xB2A1, // 病 U+75C5
+    0xD6A2, // 症 U+75C7
+    0xD3B8, // 痈 U+75C8
+    0xBEB7, // 痉 U+75C9
+    0xC8AC, // 痊 U+75CA
+    0xD1F7, // 痒 U+75D2
+    0xD6CC, // 痔 U+75D4
+    0xBADB, // 痕 U+75D5
+    0xB6BB, // 痘 U+75D8
+    0xCDB4, // 痛 U+75DB
+    0xC6A6, // 痞 U+75DE
+    0xC1A1, // 痢 U+75E2
+    0xBBBE, // 痪 U+75EA
+    0xCCB5, // 痰 U+75F0
+    0xB3D5, // 痴 U+75F4
+    0xB1D4, // 痹 U+75F9
+    0xB4E1, // 瘁 U+7601
+    0xCEC1, // 瘟 U+761F
+    0xC1F6, // 瘤 U+7624
+    0xCADD, // 瘦 U+7626
+    0xB4F1, // 瘩 U+7629
+    0xB1F1, // 瘪 U+762A
+    0xCCB1, // 瘫 U+762B
+    0xD5CE, // 瘴 U+7634
+    0xC8B3, // 瘸 U+7638
+    0xB0A9, // 癌 U+764C
+    0xD1A2, // 癣 U+7663
+    0xB9EF, // 癸 U+7678
+    0xB5C7, // 登 U+767B
+    0xB0D7, // 白 U+767D
+    0xB0D9, // 百 U+767E
+    0xD4ED, // 皂 U+7682
+    0xB5C4, // 的 U+7684
+    0xBDD4, // 皆 U+7686
+    0xBBCA, // 皇 U+7687
+    0xB8DE, // 皋 U+768B
+    0xB0A8, // 皑 U+7691
+    0xCDEE, // 皖 U+7696
+    0xC6A4, // 皮 U+76AE
+    0xD6E5, // 皱 U+76B1
+    0xC3F3, // 皿 U+76BF
+    0xD3DB, // 盂 U+76C2
+    0xD6D1, // 盅 U+76C5
+    0xC5E8, // 盆 U+76C6
+    0xD3AF, // 盈 U+76C8
+    0xD2E6, // 益 U+76CA
+    0xB0BB, // 盎 U+76CE
+    0xD5B5, // 盏 U+76CF
+    0xD1CE, // 盐 U+76D0
+    0xBCE0, // 监 U+76D1
+    0xBAD0, // 盒 U+76D2
+    0xBFF8, // 盔 U+76D4
+    0xB8C7, // 盖 U+76D6
+    0xB5C1, // 盗 U+76D7
+    0xC5CC, // 盘 U+76D8
+    0xCAA2, // 盛 U+76DB
+    0xC3CB, // 盟 U+76DF
+    0xC4BF, // 目 U+76EE
+    0xB6A2, // 盯 U+76EF
+    0xC3A4, // 盲 U+76F2
+    0xD6B1, // 直 U+76F4
+    0xCFE0, // 相 U+76F8
+    0xC5CE, // 盼 U+76FC
+    0xB6DC, // 盾 U+76FE
+    0xCAA1, // 省 U+7701
+    0xC3BC, // 眉 U+7709
+    0xBFB4, // 看 U+770B
+    0xD5E6, // 真 U+771F
+    0xC3DF, // 眠 U+7720
+    0xD5A3, // 眨 U+7728
+    0xD1A3, // 眩 U+7729
+    0xC3D0, // 眯 U+772F
+    0xBFF4, // 眶 U+7736
+    0xBEEC, // 眷 U+7737
+    0xCCF7, // 眺 U+773A
+    0xD1DB, // 眼 U+773C
+    0xD7C5, // 着 U+7740
+    0xD5F6, // 睁 U+7741
+    0xBEA6, // 睛 U+775B
+    0xCBAF, // 睡 U+7761
+    0xB6BD, // 督 U+7763
+    0xC4C0, // 睦 U+7766
+    0xBDDE, // 睫 U+776B
+    0xB2C7, // 睬 U+776C
+    0xB6C3, // 睹 U+7779
+    0xC3E9, // 瞄 U+7784
+    0xB3F2, // 瞅 U+7785
+    0xCFB9, // 瞎 U+778E
+    0xC2F7, // 瞒 U+7792
+    0xC6B3, // 瞥 U+77A5
+    0xC7C6, // 瞧 U+77A7
+    0xD6F5, // 瞩 U+77A9
+    0xB5C9, // 瞪 U+77AA
+    0xCBB2, // 瞬 U+77AC
+    0xCDAB, // 瞳 U+77B3
+    0xD5B0, // 瞻 U+77BB
+    0xB4A3, // 矗 U+77D7
+    0xC3AC, // 矛 U+77DB
+    0xCAB8, // 矢 U+77E2
+    0xD2D3, // 矣 U+77E3
+    0xD6AA, // 知 U+77E5
+    0xBED8, // 矩 U+77E9
+    0xBDC3, // 矫 U+77EB
+    0xB6CC, // 短 U+77ED
+    0xB0AB, // 矮 U+77EE
+    0xCAAF, // 石 U+77F3
+    0xCEF9, // 矽 U+77FD
+    0xB7AF, // 矾 U+77FE
+    0xBFF3, // 矿 U+77FF
+    0xC2EB, // 码 U+7801
+    0xC9B0, // 砂 U+7802
+    0xC6F6, // 砌 U+780C
+    0xBFB3, // 砍 U+780D
+    0xC5F8, // 砒 U+7812
+    0xD1D0, // 研 U+7814
+    0xD7A9, // 砖 U+7816
+    0xD1E2, // 砚 U+781A
+    0xD5E8, // 砧 U+7827
+    0xC5E9, // 砰 U+7830
+    0xC6C6, // 破 U+7834
+    0xC9E9, // 砷 U+7837
+    0xD4D2, // 砸 U+7838
+    0xC0F9, // 砾 U+783E
+    0xB4A1, // 础 U+7840
+    0xB9E8, // 硅 U+7845
+    0xCEF8, // 硒 U+7852
+    0xCBB6, // 硕 U+7855
+    0xCFF5, // 硝 U+785D
+    0xC1F2, // 硫 U+786B
+    0xD3B2, // 硬 U+786C
+    0xC8B7, // 确 U+786E
+    0xC5F0, // 硼 U+787C
+    0xB5EF, // 碉 U+7889
+    0xC2B5, // 碌 U+788C
+    0xB0AD, // 碍 U+788D
+    0xCBE9, // 碎 U+788E
+    0xB1AE, // 碑 U+7891
+    0xCDEB, // 碗 U+7897
+    0xB5E2, // 碘 U+7898
+    0xB5FA, // 碟 U+789F
+    0xB1CC, // 碧 U+78A7
+    0xC5F6, // 碰 U+78B0
+    0xBCEE, // 碱 U+78B1
+    0xCCBC, // 碳 U+78B3
+    0xB2EA, // 碴 U+78B4
+    0xC4EB, // 碾 U+78BE
+    0xB4C5, // 磁 U+78C1
+    0xB0F5, // 磅 U+78C5
+    0xC0DA, // 磊 U+78CA
+    0xB4E8, // 磋 U+78CB
+    0xC5CD, // 磐 U+78D0
+    0xBFC4, // 磕 U+78D5
+    0xC4A5, // 磨 U+78E8
+    0xC1D7, // 磷 U+78F7
+    0xBBC7, // 磺 U+78FA
+    0xBDB8, // 礁 U+7901
+    0xCABE, // 示 U+793A
+    0xC0F1, // 礼 U+793C
+    0xC9E7, // 社 U+793E
+    0xC6EE, // 祁 U+7941
+    0xC6ED, // 祈 U+7948
+    0xD7E6, // 祖 U+7956
+    0xD7A3, // 祝 U+795D
+    0xC9F1, // 神 U+795E
+    0xCBEE, // 祟 U+795F
+    0xCFE9, // 祥 U+7965
+    0xC6B1, // 票 U+7968
+    0xBCC0, // 祭 U+796D
+    0xB5BB, // 祷 U+7977
+    0xBBF6, // 祸 U+7978
+    0xBDFB, // 禁 U+7981
+    0xC2BB, // 禄 U+7984
+    0xB8A3, // 福 U+798F
+    0xD3ED, // 禹 U+79B9
+    0xC0EB, // 离 U+79BB
+    0xC7DD, // 禽 U+79BD
+    0xBACC, // 禾 U+79BE
+    0xD0E3, // 秀 U+79C0
+    0xCBBD, // 私 U+79C1
+    0xCDBA, // 秃 U+79C3
+    0xB8D1, // 秆 U+79C6
+    0xB1FC, // 秉 U+79C9
+    0xC7EF, // 秋 U+79CB
+    0xD6D6, // 种 U+79CD
+    0xBFC6, // 科 U+79D1
+    0xC3EB, // 秒 U+79D2
+    0xC3D8, // 秘 U+79D8
+    0xD7E2, // 租 U+79DF
+    0xB3D3, // 秤 U+79E4
+    0xC7D8, // 秦 U+79E6
+    0xD1ED, // 秧 U+79E7
+    0xD6C8, // 秩 U+79E9
+    0xBBFD, // 积 U+79EF
+    0xB3C6, // 称 U+79F0
+    0xBDD5, // 秸 U+79F8
+    0xD2C6, // 移 U+79FB
+    0xBBE0, // 秽 U+79FD
+    0xCFA1, // 稀 U+7A00
+    0xB3CC, // 程 U+7A0B
+    0xC9D4, // 稍 U+7A0D
+    0xCBB0, // 税 U+7A0E
+    0xB0DE, // 稗 U+7A17
+    0xD6C9, // 稚 U+7A1A
+    0xB3ED, // 稠 U+7A20
+    0xCEC8, // 稳 U+7A33
+    0xB5BE, // 稻 U+7A3B
+    0xBCDA, // 稼 U+7A3C
+    0xBBFC, // 稽 U+7A3D
+    0xB8E5, // 稿 U+7A3F
+    0xC4C2, // 穆 U+7A46
+    0xCBEB, // 穗 U+7A57
+    0xD1A8, // 穴 U+7A74
+    0xBEBF, // 究 U+7A76
+    0xC7EE, // 穷 U+7A77
+    0xBFD5, // 空 U+7A7A
+    0xB4A9, // 穿 U+7A7F
+    0xCDBB, // 突 U+7A81
+    0xC7D4, // 窃 U+7A83
+    0xD5AD, // 窄 U+7A84
+    0xC7CF, // 窍 U+7A8D
+    0xD2A4, // 窑 U+7A91
+    0xD6CF, // 窒 U+7A92
+    0xBDD1, // 窖 U+7A96
+    0xB4B0, // 窗 U+7A97
+    0xBEBD, // 窘 U+7A98
+    0xB4DC, // 窜 U+7A9C
+    0xCED1, // 窝 U+7A9D
+    0xBFDF, // 窟 U+7A9F
+    0xBFFA, // 窥 U+7AA5
+    0xC1FE, // 窿 U+7ABF
+    0xC1A2, // 立 U+7ACB
+    0xCAFA, // 竖 U+7AD6
+    0xD5BE, // 站 U+7AD9
+    0xBEBA, // 竞 U+7ADE
+    0xBEB9, // 竟 U+7ADF
+    0xD5C2, // 章 U+7AE0
+    0xBFA2, // 竣 U+7AE3
+    0xCDAF, // 童 U+7AE5
+    0xBDDF, // 竭 U+7AED
+    0xB6CB, // 端 U+7AEF
+    0xD6F1, // 竹 U+7AF9
+    0xB8CD, // 竿 U+7AFF
+    0xB0CA, // 笆 U+7B06
+    0xCBF1, // 笋 U+7B0B
+    0xD0A6, // 笑 U+7B11
+    0xB1CA, // 笔 U+7B14
+    0xB5D1, // 笛 U+7B1B
+    0xB7FB, // 符 U+7B26
+    0xB1BF, // 笨 U+7B28
+    0xB5DA, // 第 U+7B2C
+    0xBCE3, // 笺 U+7B3A
+    0xC1FD, // 笼 U+7B3C
+    0xB5C8, // 等 U+7B49
+    0xBDEE, // 筋 U+7B4B
+    0xB7A4, // 筏 U+7B4F
+    0xBFF0, // 筐 U+7B50
+    0xD6FE, // 筑 U+7B51
+    0xCDB2, // 筒 U+7B52
+    0xB4F0, // 答 U+7B54
+    0xB2DF, // 策 U+7B56
+    0xC9B8, // 筛 U+7B5B
+    0xBFEA, // 筷 U+7B77
+    0xB3EF, // 筹 U+7B79
+    0xC7A9, // 签 U+7B7E
+    0xBCF2, // 简 U+7B80
+    0xB9BF, // 箍 U+7B8D
+    0xB2AD, // 箔 U+7B94
+    0xBBFE, // 箕 U+7B95
+    0xCBE3, // 算 U+7B97
+    0xB9DC, // 管 U+7BA1
+    0xC2E1, // 箩 U+7BA9
+    0xBCFD, // 箭 U+7BAD
+    0xCFE4, // 箱 U+7BB1
+    0xD7AD, // 篆 U+7BC6
+    0xC6AA, // 篇 U+7BC7
+    0xC2A8, // 篓 U+7BD3
+    0xB8DD, // 篙 U+7BD9
+    0xB4DB, // 篡 U+7BE1
+    0xC0BA, // 篮 U+7BEE
+    0xC0E9, // 篱 U+7BF1
+    0xC5F1, // 篷 U+7BF7
+    0xB4D8, // 簇 U+7C07
+    0xBBC9, // 簧 U+7C27
+    0xB2BE, // 簿 U+7C3F
+    0xBCAE, // 籍 U+7C4D
+    0xC3D7, // 米 U+7C73
+    0xC0E0, // 类 U+7C7B
+    0xD7D1, // 籽 U+7C7D
+    0xB7DB, // 粉 U+7C89
+    0xC1A3, // 粒 U+7C92
+    0xC6C9, // 粕 U+7C95
+    0xB4D6, // 粗 U+7C97
+    0xD5B3, // 粘 U+7C98
+    0xCBDA, // 粟 U+7C9F
+    0xD4C1, // 粤 U+7CA4
+    0xD6E0, // 粥 U+7CA5
+    0xB7E0, // 粪 U+7CAA
+    0xC1B8, // 粮 U+7CAE
+    0xC1BB, // 粱 U+7CB1
+    0xBEAC, // 粳 U+7CB3
+    0xB4E2, // 粹 U+7CB9
+    0xBEAB, // 精 U+7CBE
+    0xBAFD, // 糊 U+7CCA
+    0xB8E2, // 糕 U+7CD5
+    0xCCC7, // 糖 U+7CD6
+    0xB2DA, // 糙 U+7CD9
+    0xC3D3, // 糜 U+7CDC
+    0xD4E3, // 糟 U+7CDF
+    0xBFB7, // 糠 U+7CE0
+    0xC5B4, // 糯 U+7CEF
+    0xCFB5, // 系 U+7CFB
+    0xCEC9, // 紊 U+7D0A
+    0xCBD8, // 素 U+7D20
+    0xCBF7, // 索 U+7D22
+    0xBDF4, // 紧 U+7D27
+    0xD7CF, // 紫 U+7D2B
+    0xC0DB, // 累 U+7D2F
+    0xD0F5, // 絮 U+7D6E
+    0xB7B1, // 繁 U+7E41
+    0xD7EB, // 纂 U+7E82
+    0xBEC0, // 纠 U+7EA0
+    0xBAEC, // 红 U+7EA2
+    0xCFCB, // 纤 U+7EA4
+    0xD4BC, // 约 U+7EA6
+    0xBCB6, // 级 U+7EA7
+    0xBCCD, // 纪 U+7EAA
+    0xC8D2, // 纫 U+7EAB
+    0xCEB3, // 纬 U+7EAC
+    0xB4BF, // 纯 U+7EAF
+    0xC9B4, // 纱 U+7EB1
+    0xB8D9, // 纲 U+7EB2
+    0xC4C9, // 纳 U+7EB3
+    0xD7DD, // 纵 U+7EB5
+    0xC2DA, // 纶 U+7EB6
+    0xB7D7, // 纷 U+7EB7
+    0xD6BD, // 纸 U+7EB8
+    0xCEC6, // 纹 U+7EB9
+    0xB7C4, // 纺 U+7EBA
+    0xC5A6, // 纽 U+7EBD
+    0xCFDF, // 线 U+7EBF
+    0xC1B7, // 练 U+7EC3
+    0xD7E9, // 组 U+7EC4
+    0xC9F0, // 绅 U+7EC5
+    0xCFB8, // 细 U+7EC6
+    0xD6AF, // 织 U+7EC7
+    0xD6D5, // 终 U+7EC8
+    0xB0ED, // 绊 U+7ECA
+    0xC9DC, // 绍 U+7ECD
+    0xD2EF, // 绎 U+7ECE
+    0xBEAD, // 经 U+7ECF
+    0xB0F3, // 绑 U+7ED1
+    0xC8DE, // 绒 U+7ED2
+    0xBDE1, // 结 U+7ED3
+    0xC8C6, // 绕 U+7ED5
+    0xBBE6, // 绘 U+7ED8
+    0xB8F8, // 给 U+7ED9
+    0xD1A4, // 绚 U+7EDA
+    0xC2E7, // 络 U+7EDC
+    0xBEF8, // 绝 U+7EDD
+    0xBDCA, // 绞 U+7EDE
+    0xCDB3, // 统 U+7EDF
+    0xBEEE, // 绢 U+7EE2
+    0xD0E5, // 绣 U+7EE3
+    0xCBE7, // 绥 U+7EE5
+    0xCCD0, // 绦 U+7EE6
+    0xBCCC, // 继 U+7EE7
+    0xBCA8, // 绩 U+7EE9
+    0xD0F7, // 绪 U+7EEA
+    0xD0F8, // 续 U+7EED
+    0xB4C2, // 绰 U+7EF0
+    0xC9FE, // 绳 U+7EF3
+    0xCEAC, // 维 U+7EF4
+    0xC3E0, // 绵 U+7EF5
+    0xB1C1, // 绷 U+7EF7
+    0xB3F1, // 绸 U+7EF8
+    0xD7DB, // 综 U+7EFC
+    0xD5C0, // 绽 U+7EFD
+    0xC2CC, // 绿 U+7EFF
+    0xD7BA, // 缀 U+7F00
+    0xBCEA, // 缄 U+7F04
+    0xC3E5, // 缅 U+7F05
+    0xC0C2, // 缆 U+7F06
+    0xBCA9, // 缉 U+7F09
+    0xB6D0, // 缎 U+7F0E
+    0xBBBA, // 缓 U+7F13
+    0xB5DE, // 缔 U+7F14
+    0xC2C6, // 缕 U+7F15
+    0xB1E0, // 编 U+7F16
+    0xD4B5, // 缘 U+7F18
+    0xB8BF, // 缚 U+7F1A
+    0xB7EC, // 缝 U+7F1D
+    0xB2F8, // 缠 U+7F20
+    0xD3A7, // 缨 U+7F28
+    0xCBF5, // 缩 U+7F29
+    0xC9C9, // 缮 U+7F2E
+    0xBDC9, // 缴 U+7F34
+    0xB8D7, // 缸 U+7F38
+    0xC8B1, // 缺 U+7F3A
+    0xB9DE, // 罐 U+7F50
+    0xCDF8, // 网 U+7F51
+    0xBAB1, // 罕 U+7F55
+    0xC2DE, // 罗 U+7F57
+    0xB7A3, // 罚 U+7F5A
+    0xB0D5, // 罢 U+7F62
+    0xD5D6, // 罩 U+7F69
+    0xD7EF, // 罪 U+7F6A
+    0xD6C3, // 置 U+7F6E
+    0xCAF0, // 署 U+7F72
+    0xD1F2, // 羊 U+7F8A
+    0xC7BC, // 羌 U+7F8C
+    0xC3C0, // 美 U+7F8E
+    0xB8E1, // 羔 U+7F94
+    0xC1E7, // 羚 U+7F9A
+    0xD0DF, // 羞 U+7F9E
+    0xCFDB, // 羡 U+7FA1
+    0xC8BA, // 群 U+7FA4
+    0xB8FE, // 羹 U+7FB9
+    0xD3F0, // 羽 U+7FBD
+    0xCECC, // 翁 U+7FC1
+    0xB3E1, // 翅 U+7FC5
+    0xD2EE, // 翌 U+7FCC
+    0xCFE8, // 翔 U+7FD4
+    0xC7CC, // 翘 U+7FD8
+    0xB5D4, // 翟 U+7FDF
+    0xB4E4, // 翠 U+7FE0
+    0xBAB2, // 翰 U+7FF0
+    0xB0BF, // 翱 U+7FF1
+    0xB7AD, // 翻 U+7FFB
+    0xD2ED, // 翼 U+7FFC
+    0xD2AB, // 耀 U+8000
+    0xC0CF, // 老 U+8001
+    0xBFBC, // 考 U+8003
+    0xD5DF, // 者 U+8005
+    0xB6F8, // 而 U+800C
+    0xCBA3, // 耍 U+800D
+    0xC4CD, // 耐 U+8010
+    0xB8FB, // 耕 U+8015
+    0xBAC4, // 耗 U+8017
+    0xD4C5, // 耘 U+8018
+    0xB0D2, // 耙 U+8019
+    0xC5D5, // 耪 U+802A
+    0xB6FA, // 耳 U+8033
+    0xD2AE, // 耶 U+8036
+    0xCBCA, // 耸 U+8038
+    0xB3DC, // 耻 U+803B
+    0xB5A2, // 耽 U+803D
+    0xB9A2, // 耿 U+803F
+    0xC4F4, // 聂 U+8042
+    0xC1C4, // 聊 U+804A
+    0xC1FB, // 聋 U+804B
+    0xD6B0, // 职 U+804C
+    0xC1AA, // 联 U+8054
+    0xC6B8, // 聘 U+8058
+    0xBEDB, // 聚 U+805A
+    0xB4CF, // 聪 U+806A
+    0xCBE0, // 肃 U+8083
+    0xD2DE, // 肄 U+8084
+    0xCBC1, // 肆 U+8086
+    0xD5D8, // 肇 U+8087
+    0xC8E2, // 肉 U+8089
+    0xC0DF, // 肋 U+808B
+    0xBCA1, // 肌 U+808C
+    0xD0A4, // 肖 U+8096
+    0xD6E2, // 肘 U+8098
+    0xB6C7, // 肚 U+809A
+    0xB8D8, // 肛 U+809B
+    0xB8CE, // 肝 U+809D
+    0xB3A6, // 肠 U+80A0
+    0xB9C9, // 股 U+80A1
+    0xD6AB, // 肢 U+80A2
+    0xB7F4, // 肤 U+80A4
+    0xB7CA, // 肥 U+80A5
+    0xBCE7, // 肩 U+80A9
+    0xB7BE, // 肪 U+80AA
+    0xB0B9, // 肮 U+80AE
+    0xBFCF, // 肯 U+80AF
+    0xD3FD, // 育 U+80B2
+    0xB7CE, // 肺 U+80BA
+    0xC9F6, // 肾 U+80BE
+    0xD6D7, // 肿 U+80BF
+    0xD5CD, // 胀 U+80C0
+    0xD0B2, // 胁 U+80C1
+    0xCEB8, // 胃 U+80C3
+    0xB5A8, // 胆 U+80C6
+    0xB1B3, // 背 U+80CC
+    0xCCA5, // 胎 U+80CE
+    0xC5D6, // 胖 U+80D6
+    0xC5DF, // 胚 U+80DA
+    0xCAA4, // 胜 U+80DC
+    0xB0FB, // 胞 U+80DE
+    0xBAFA, // 胡 U+80E1
+    0xBFE8, // 胯 U+80EF
+    0xD2C8, // 胰 U+80F0
+    0xB8EC, // 胳 U+80F3
+    0xBDBA, // 胶 U+80F6
+    0xD0D8, // 胸 U+80F8
+    0xB0B7, // 胺 U+80FA
+    0xC4DC, // 能 U+80FD
+    0xD6AC, // 脂 U+8102
+    0xB4E0, // 脆 U+8106
+    0xC2F6, // 脉 U+8109
+    0xBCB9, // 脊 U+810A
+    0xD4E0, // 脏 U+810F
+    0xC6EA, // 脐 U+8110
+    0xC4D4, // 脑 U+8111
+    0xC5A7, // 脓 U+8113
+    0xB2B1, // 脖 U+8116
+    0xBDC5, // 脚 U+811A
+    0xB8AC, // 脯 U+812F
+    0xCDD1, // 脱 U+8131
+    0xC1B3, // 脸 U+8138
+    0xC6A2, // 脾 U+813E
+    0xCCF3, // 腆 U+8146
+    0xC0B0, // 腊 U+814A
+    0xD2B8, // 腋 U+814B
+    0xB8AF, // 腐 U+8150
+    0xB8AD, // 腑 U+8151
+    0xC7BB, // 腔 U+8154
+    0xCDF3, // 腕 U+8155
+    0xD0C8, // 腥 U+8165
+    0xC8F9, // 腮 U+816E
+    0xD1FC, // 腰 U+8170
+    0xB8B9, // 腹 U+8179
+    0xCFD9, // 腺 U+817A
+    0xC4E5, // 腻 U+817B
+    0xCCDA, // 腾 U+817E
+    0xCDC8, // 腿 U+817F
+    0xB0F2, // 膀 U+8180
+    0xB2B2, // 膊 U+818A
+    0xB8E0, // 膏 U+818F
+    0xB1EC, // 膘 U+8198
+    0xCCC5, // 膛 U+819B
+    0xC4A4, // 膜 U+819C
+    0xCFA5, // 膝 U+819D
+    0xC5F2, // 膨 U+81A8
+    0xC9C5, // 膳 U+81B3
+    0xCDCE, // 臀 U+81C0
+    0xB1DB, // 臂 U+81C2
+    0xD3B7, // 臃 U+81C3
+    0xD2DC, // 臆 U+81C6
+    0xB3BC, // 臣 U+81E3
+    0xD7D4, // 自 U+81EA
+    0xB3F4, // 臭 U+81ED
+    0xD6C1, // 至 U+81F3
+    0xD6C2, // 致 U+81F4
+    0xD5E9, // 臻 U+81FB
+    0xBECA, // 臼 U+81FC
+    0xD2A8, // 舀 U+8200
+    0xBECB, // 舅 U+8205
+    0xD3DF, // 舆 U+8206
+    0xC9E0, // 舌 U+820C
+    0xC9E1, // 舍 U+820D
+    0xCAE6, // 舒 U+8212
+    0xCCF2, // 舔 U+8214
+    0xCBB4, // 舜 U+821C
+    0xCEE8, // 舞 U+821E
+    0xD6DB, // 舟 U+821F
+    0xBABD, // 航 U+822A
+    0xB0E3, // 般 U+822C
+    0xBDA2, // 舰 U+8230
+    0xB2D5, // 舱 U+8231
+    0xB6E6, // 舵 U+8235
+    0xB2B0, // 舶 U+8236
+    0xCFCF, // 舷 U+8237
+    0xB4AC, // 船 U+8239
+    0xCDA7, // 艇 U+8247
+    0xCBD2, // 艘 U+8258
+    0xC1BC, // 良 U+826F
+    0xBCE8, // 艰 U+8270
+    0xC9AB, // 色 U+8272
+    0xD1DE, // 艳 U+8273
+    0xD2D5, // 艺 U+827A
+    0xB0AC, // 艾 U+827E
+    0xBDDA, // 节 U+8282
+    0xD3F3, // 芋 U+828B
+    0xC9D6, // 芍 U+828D
+    0xC3A2, // 芒 U+8292
+    0xCEDF, // 芜 U+829C
+    0xD6A5, // 芝 U+829D
+    0xBDE6, // 芥 U+82A5
+    0xC2AB, // 芦 U+82A6
+    0xB7D2, // 芬 U+82AC
+    0xB0C5, // 芭 U+82AD
+    0xD0BE, // 芯 U+82AF
+    0xBBA8, // 花 U+82B1
+    0xB7BC, // 芳 U+82B3
+    0xC7DB, // 芹 U+82B9
+    0xD1BF, // 芽 U+82BD
+    0xCEAD, // 苇 U+82C7
+    0xB2D4, // 苍 U+82CD
+    0xCBD5, // 苏 U+82CF
+    0xD4B7, // 苑 U+82D1
+    0xCCA6, // 苔 U+82D4
+    0xC3E7, // 苗 U+82D7
+    0xBFC1, // 苛 U+82DB
+    0xB0FA, // 苞 U+82DE
+    0xB9B6, // 苟 U+82DF
+    0xC8F4, // 若 U+82E5
+    0xBFE0, // 苦 U+82E6
+    0xC9BB, // 苫 U+82EB
+    0xB1BD, // 苯 U+82EF
+    0xD3A2, // 英 U+82F1
+    0xC6BB, // 苹 U+82F9
+    0xD7C2, // 茁 U+8301
+    0xC3AF, // 茂 U+8302
+    0xB7B6, // 范 U+8303
+    0xC7D1, // 茄 U+8304
+    0xC3A9, // 茅 U+8305
+    0xBEA5, // 茎 U+830E
+    0xBCEB, // 茧 U+8327
+    0xB4C4, // 茨 U+8328
+    0xC3A3, // 茫 U+832B
+    0xB2E7, // 茬 U+832C
+    0xD2F0, // 茵 U+8335
+    0xB2E8, // 茶 U+8336
+    0xC8D7, // 茸 U+8338
+    0xC8E3, // 茹 U+8339
+    0xBEA3, // 荆 U+8346
+    0xB2DD, // 草 U+8349
+    0xBCF6, // 荐 U+8350
+    0xBBC4, // 荒 U+8352
+    0xC0F3, // 荔 U+8354
+    0xBCD4, // 荚 U+835A
+    0xB5B4, // 荡 U+8361
+    0xC8D9, // 荣 U+8363
+    0xBBE7, // 荤 U+8364
+    0xD3AB, // 荧 U+8367
+    0xD2F1, // 荫 U+836B
+    0xD2A9, // 药 U+836F
+    0xBAC9, // 荷 U+8377
+    0xC6CE, // 莆 U+8386
+    0xC0F2, // 莉 U+8389
+    0xC9AF, // 莎 U+838E
+    0xC4AA, // 莫 U+83AB
+    0xC0B3, // 莱 U+83B1
+    0xC1AB, // 莲 U+83B2
+    0xBBF1, // 获 U+83B7
+    0xD3A8, // 莹 U+83B9
+    0xC3A7, // 莽 U+83BD
+    0xB9BD, // 菇 U+83C7
+    0xBED5, // 菊 U+83CA
+    0xBEFA, // 菌 U+83CC
+    0xBACA, // 菏 U+83CF
+    0xB2CB, // 菜 U+83DC
+    0xB2A4, // 菠 U+83E0
+    0xC6D0, // 菩 U+83E9
+    0xC1E2, // 菱 U+83F1
+    0xB7C6, // 菲 U+83F2
+    0xCCD1, // 萄 U+8404
+    0xC3C8, // 萌 U+840C
+    0xC6BC, // 萍 U+840D
+    0xCEAE, // 萎 U+840E
+    0xC2DC, // 萝 U+841D
+    0xD3A9, // 萤 U+8424
+    0xD3AA, // 营 U+8425
+    0xCFF4, // 萧 U+8427
+    0xC8F8, // 萨 U+8428
+    0xC2E4, // 落 U+843D
+    0xD6F8, // 著 U+8457
+    0xB8F0, // 葛 U+845B
+    0xC6CF, // 葡 U+8461
+    0xB6AD, // 董 U+8463
+    0xBAF9, // 葫 U+846B
+    0xD4E1, // 葬 U+846C
+    0xB4D0, // 葱 U+8471
+    0xBFFB, // 葵 U+8475
+    0xB5D9, // 蒂 U+8482
+    0xBDAF, // 蒋 U+848B
+    0xC3C9, // 蒙 U+8499
+    0xCBE2, // 蒜 U+849C
+    0xC6D1, // 蒲 U+84B2
+    0xD5F4, // 蒸 U+84B8
+    0xD0EE, // 蓄 U+84C4
+    0xC8D8, // 蓉 U+84C9
+    0xCBF2, // 蓑 U+84D1
+    0xB1CD, // 蓖 U+84D6
+    0xC0B6, // 蓝 U+84DD
+    0xBCBB, // 蓟 U+84DF
+    0xC5EE, // 蓬 U+84EC
+    0xC3EF, // 蔑 U+8511
+    0xC2FB, // 蔓 U+8513
+    0xD5E1, // 蔗 U+8517
+    0xCEB5, // 蔚 U+851A
+    0xB2CC, // 蔡 U+8521
+    0xC4E8, // 蔫 U+852B
+    0xCADF, // 蔬 U+852C
+    0xC7BE, // 蔷 U+8537
+    0xB0AA, // 蔼 U+853C
+    0xB1CE, // 蔽 U+853D
+    0xBDB6, // 蕉 U+8549
+    0xC8EF, // 蕊 U+854A
+    0xD4CC, // 蕴 U+8574
+    0xC0D9, // 蕾 U+857E
+    0xB1A1, // 薄 U+8584
+    0xD1A6, // 薛 U+859B
+    0xD0BD, // 薪 U+85AA
+    0xCAED, // 薯 U+85AF
+    0xBDE5, // 藉 U+85C9
+    0xB2D8, // 藏 U+85CF
+    0xC3EA, // 藐 U+85D0
+    0xC5BA, // 藕 U+85D5
+    0xCCD9, // 藤 U+85E4
+    0xB7AA, // 藩 U+85E9
+    0xD4E5, // 藻 U+85FB
+    0xC4A2, // 蘑 U+8611
+    0xD5BA, // 蘸 U+8638
+    0xBBA2, // 虎 U+864E
+    0xC2B2, // 虏 U+864F
+    0xC5B0, // 虐 U+8650
+    0xC2C7, // 虑 U+8651
+    0xD0E9, // 虚 U+865A
+    0xD3DD, // 虞 U+865E
+    0xB3E6, // 虫 U+866B
+    0xCAAD, // 虱 U+8671
+    0xBAE7, // 虹 U+8679
+    0xCBE4, // 虽 U+867D
+    0xCFBA, // 虾 U+867E
+    0xCAB4, // 蚀 U+8680
+    0xD2CF, // 蚁 U+8681
+    0xC2EC, // 蚂 U+8682
+    0xCEC3, // 蚊 U+868A
+    0xB0F6, // 蚌 U+868C
+    0xB2CF, // 蚕 U+8695
+    0xD1C1, // 蚜 U+869C
+    0xD4E9, // 蚤 U+86A4
+    0xD6FB, // 蛀 U+86C0
+    0xC7F9, // 蛆 U+86C6
+    0xC9DF, // 蛇 U+86C7
+    0xB9C6, // 蛊 U+86CA
+    0xB5B0, // 蛋 U+86CB
+    0xBBD7, // 蛔 U+86D4
+    0xCDDC, // 蛙 U+86D9
+    0xD6EB, // 蛛 U+86DB
+    0xB8F2, // 蛤 U+86E4
+    0xC2F9, // 蛮 U+86EE
+    0xD5DD, // 蛰 U+86F0
+    0xD3BC, // 蛹 U+86F9
+    0xB6EA, // 蛾 U+86FE
+    0xCAF1, // 蜀 U+8700
+    0xB7E4, // 蜂 U+8702
+    0xD1D1, // 蜒 U+8712
+    0xCDC9, // 蜕 U+8715
+    0xCECF, // 蜗 U+8717
+    0xD6A9, // 蜘 U+8718
+    0xC3DB, // 蜜 U+871C
+    0xC0AF, // 蜡 U+8721
+    0xD3AC, // 蝇 U+8747
+    0xB2F5, // 蝉 U+8749
+    0xD0AB, // 蝎 U+874E
+    0xBBC8, // 蝗 U+8757
+    0xBAFB, // 蝴 U+8774
+    0xB5FB, // 蝶 U+8776
+    0xC8DA, // 融 U+878D
+    0xC3F8, // 螟 U+879F
+    0xC2DD, // 螺 U+87BA
+    0xD0B7, // 蟹 U+87F9
+    0xC8E4, // 蠕 U+8815
+    0xB4C0, // 蠢 U+8822
+    0xD1AA, // 血 U+8840
+    0xD0C6, // 衅 U+8845
+    0xD0D0, // 行 U+884C
+    0xD1DC, // 衍 U+884D
+    0xCFCE, // 衔 U+8854
+    0xBDD6, // 街 U+8857
+    0xD1C3, // 衙 U+8859
+    0xBAE2, // 衡 U+8861
+    0xD2C2, // 衣 U+8863
+    0xB2B9, // 补 U+8865
+    0xB1ED, // 表 U+8868
+    0xC9C0, // 衫 U+886B
+    0xB3C4, // 衬 U+886C
+    0xCBA5, // 衰 U+8870
+    0xD6D4, // 衷 U+8877
+    0xD4AC, // 袁 U+8881
+    0xB0C0, // 袄 U+8884
+    0xB4FC, // 袋 U+888B
+    0xC5DB, // 袍 U+888D
+    0xCCBB, // 袒 U+8892
+    0xD0E4, // 袖 U+8896
+    0xCDE0, // 袜 U+889C
+    0xB1BB, // 被 U+88AB
+    0xCFAE, // 袭 U+88AD
+    0xB8A4, // 袱 U+88B1
+    0xB2C3, // 裁 U+88C1
+    0xC1D1, // 裂 U+88C2
+    0xD7B0, // 装 U+88C5
+    0xD2E1, // 裔 U+88D4
+    0xD4A3, // 裕 U+88D5
+    0xC8B9, // 裙 U+88D9
+    0xBFE3, // 裤 U+88E4
+    0xC9D1, // 裳 U+88F3
+    0xC5E1, // 裴 U+88F4
+    0xC2E3, // 裸 U+88F8
+    0xB9FC, // 裹 U+88F9
+    0xB9D3, // 褂 U+8902
+    0xBAD6, // 褐 U+8910
+    0xB0FD, // 褒 U+8912
+    0xC8EC, // 褥 U+8925
+    0xCDCA, // 褪 U+892A
+    0xCFE5, // 襄 U+8944
+    0xBDF3, // 襟 U+895F
+    0xCEF7, // 西 U+897F
+    0xD2AA, // 要 U+8981
+    0xB8B2, // 覆 U+8986
+    0xBCFB, // 见 U+89C1
+    0xB9DB, // 观 U+89C2
+    0xB9E6, // 规 U+89C4
+    0xC3D9, // 觅 U+89C5
+    0xCAD3, // 视 U+89C6
+    0xC0C0, // 览 U+89C8
+    0xBEF5, // 觉 U+89C9
+    0xBDC7, // 角 U+89D2
+    0xBDE2, // 解 U+89E3
+    0xB4A5, // 触 U+89E6
+    0xD1D4, // 言 U+8A00
+    0xD5B2, // 詹 U+8A79
+    0xD3FE, // 誉 U+8A89
+    0xCCDC, // 誊 U+8A8A
+    0xCAC4, // 誓 U+8A93
+    0xBEAF, // 警 U+8B66
+    0xC6A9, // 譬 U+8B6C
+    0xBCC6, // 计 U+8BA1
+    0xB6A9, // 订 U+8BA2
+    0xB8BC, // 讣 U+8BA3
+    0xC8CF, // 认 U+8BA4
+    0xBCA5, // 讥 U+8BA5
+    0xCCD6, // 讨 U+8BA8
+    0xC8C3, // 让 U+8BA9
+    0xC6FD, // 讫 U+8BAB
+    0xD1B5, // 训 U+8BAD
+    0xD2E9, // 议 U+8BAE
+    0xD1B6, // 讯 U+8BAF
+    0xBCC7, // 记 U+8BB0
+    0xBDB2, // 讲 U+8BB2
+    0xBBE4, // 讳 U+8BB3
+    0xD1C8, // 讶 U+8BB6
+    0xD0ED, // 许 U+8BB8
+    0xB6EF, // 讹 U+8BB9
+    0xC2DB, // 论 U+8BBA
+    0xCBCF, // 讼 U+8BBC
+    0xB7ED, // 讽 U+8BBD
+    0xC9E8, // 设 U+8BBE
+    0xB7C3, // 访 U+8BBF
+    0xBEF7, // 诀 U+8BC0
+    0xD6A4, // 证 U+8BC1
+    0xC6C0, // 评 U+8BC4
+    0xD7E7, // 诅 U+8BC5
+    0xCAB6, // 识 U+8BC6
+    0xD5A9, // 诈 U+8BC8
+    0xCBDF, // 诉 U+8BC9
+    0xD5EF, // 诊 U+8BCA
+    0xD6DF, // 诌 U+8BCC
+    0xB4CA, // 词 U+8BCD
+    0xD2EB, // 译 U+8BD1
+    0xCAD4, // 试 U+8BD5
+    0xCAAB, // 诗 U+8BD7
+    0xB3CF, // 诚 U+8BDA
+    0xD6EF, // 诛 U+8BDB
+    0xBBB0, // 话 U+8BDD
+    0xB5AE, // 诞 U+8BDE
+    0xB9EE, // 诡 U+8BE1
+    0xD1AF, // 询 U+8BE2
+    0xD2E8, // 诣 U+8BE3
+    0xB8C3, // 该 U+8BE5
+    0xCFEA, // 详 U+8BE6
+    0xB2EF, // 诧 U+8BE7
+    0xBDEB, // 诫 U+8BEB
+    0xCEDC, // 诬 U+8BEC
+    0xD3EF, // 语 U+8BED
+    0xCEF3, // 误 U+8BEF
+    0xD3D5, // 诱 U+8BF1
+    0xBBE5, // 诲 U+8BF2
+    0xCBB5, // 说 U+8BF4
+    0xCBD0, // 诵 U+8BF5
+    0xC7EB, // 请 U+8BF7
+    0xD6EE, // 诸 U+8BF8
+    0xC5B5, // 诺 U+8BFA
+    0xB6C1, // 读 U+8BFB
+    0xB7CC, // 诽 U+8BFD
+    0xBFCE, // 课 U+8BFE
+    0xCBAD, // 谁 U+8C01
+    0xB5F7, // 调 U+8C03
+    0xC1C2, // 谅 U+8C05
+    0xD7BB, // 谆 U+8C06
+    0xCCB8, // 谈 U+8C08
+    0xD2EA, // 谊 U+8C0A
+    0xC4B1, // 谋 U+8C0B
+    0xB5FD, // 谍 U+8C0D
+    0xBBD1, // 谎 U+8C0E
+    0xD0B3, // 谐 U+8C10
+    0xCEBD, // 谓 U+8C13
+    0xB2F7, // 谗 U+8C17
+    0xD1E8, // 谚 U+8C1A
+    0xC3D5, // 谜 U+8C1C
+    0xD0BB, // 谢 U+8C22
+    0xD2A5, // 谣 U+8C23
+    0xB0F9, // 谤 U+8C24
+    0xC7AB, // 谦 U+8C26
+    0xBDF7, // 谨 U+8C28
+    0xC3A1, // 谩 U+8C29
+    0xC3FD, // 谬 U+8C2C
+    0xCCB7, // 谭 U+8C2D
+    0xC0BE, // 谰 U+8C30
+    0xC6D7, // 谱 U+8C31
+    0xC7B4, // 谴 U+8C34
+    0xB9C8, // 谷 U+8C37
+    0xBBED, // 豁 U+8C41
+    0xB6B9, // 豆 U+8C46
+    0xCDE3, // 豌 U+8C4C
+    0xCFF3, // 象 U+8C61
+    0xBBBF, // 豢 U+8C62
+    0xBAC0, // 豪 U+8C6A
+    0xD4A5, // 豫 U+8C6B
+    0xB1AA, // 豹 U+8C79
+    0xB2F2, // 豺 U+8C7A
+    0xBAD1, // 貉 U+8C89
+    0xC3B2, // 貌 U+8C8C
+    0xB1B4, // 贝 U+8D1D
+    0xD5EA, // 贞 U+8D1E
+    0xB8BA, // 负 U+8D1F
+    0xB9B1, // 贡 U+8D21
+    0xB2C6, // 财 U+8D22
+    0xD4F0, // 责 U+8D23
+    0xCFCD, // 贤 U+8D24
+    0xB0DC, // 败 U+8D25
+    0xD5CB, // 账 U+8D26
+    0xBBF5, // 货 U+8D27
+    0xD6CA, // 质 U+8D28
+    0xB7B7, // 贩 U+8D29
+    0xCCB0, // 贪 U+8D2A
+    0xC6B6, // 贫 U+8D2B
+    0xB1E1, // 贬 U+8D2C
+    0xB9BA, // 购 U+8D2D
+    0xD6FC, // 贮 U+8D2E
+    0xB9E1, // 贯 U+8D2F
+    0xB7A1, // 贰 U+8D30
+    0xBCFA, // 贱 U+8D31
+    0xCCF9, // 贴 U+8D34
+    0xB9F3, // 贵 U+8D35
+    0xB4FB, // 贷 U+8D37
+    0xC3B3, // 贸 U+8D38
+    0xB7D1, // 费 U+8D39
+    0xBAD8, // 贺 U+8D3A
+    0xD4F4, // 贼 U+8D3C
+    0xBCD6, // 贾 U+8D3E
+    0xBBDF, // 贿 U+8D3F
+    0xC1DE, // 赁 U+8D41
+    0xC2B8, // 赂 U+8D42
+    0xD4DF, // 赃 U+8D43
+    0xD7CA, // 资 U+8D44
+    0xC9DE, // 赊 U+8D4A
+    0xB8B3, // 赋 U+8D4B
+    0xB6C4, // 赌 U+8D4C
+    0xCAEA, // 赎 U+8D4E
+    0xC9CD, // 赏 U+8D4F
+    0xB4CD, // 赐 U+8D50
+    0xC5E2, // 赔 U+8D54
+    0xC0B5, // 赖 U+8D56
+    0xD7B8, // 赘 U+8D58
+    0xD7AC, // 赚 U+8D5A
+    0xC8FC, // 赛 U+8D5B
+    0xD4DE, // 赞 U+8D5E
+    0xD4F9, // 赠 U+8D60
+    0xC9C4, // 赡 U+8D61
+    0xD3AE, // 赢 U+8D62
+    0xB8D3, // 赣 U+8D63
+    0xB3E0, // 赤 U+8D64
+    0xC9E2, // 赦 U+8D66
+    0xBAD5, // 赫 U+8D6B
+    0xD7DF, // 走 U+8D70
+    0xB8B0, // 赴 U+8D74
+    0xD5D4, // 赵 U+8D75
+    0xB8CF, // 赶 U+8D76
+    0xC6F0, // 起 U+8D77
+    0xB3C3, // 趁 U+8D81
+    0xB3AC, // 超 U+8D85
+    0xD4BD, // 越 U+8D8A
+    0xC7F7, // 趋 U+8D8B
+    0xCCCB, // 趟 U+8D9F
+    0xC8A4, // 趣 U+8DA3
+    0xD7E3, // 足 U+8DB3
+    0xC5BF, // 趴 U+8DB4
+    0xD6BA, // 趾 U+8DBE
+    0xD4BE, // 跃 U+8DC3
+    0xB0CF, // 跋 U+8DCB
+    0xB5F8, // 跌 U+8DCC
+    0xC5DC, // 跑 U+8DD1
+    0xBEE0, // 距 U+8DDD
+    0xB8FA, // 跟 U+8DDF
+    0xBFE7, // 跨 U+8DE8
+    0xB9F2, // 跪 U+8DEA
+    0xC2B7, // 路 U+8DEF
+    0xCCF8, // 跳 U+8DF3
+    0xBCF9, // 践 U+8DF5
+    0xB6E5, // 跺 U+8DFA
+    0xD3BB, // 踊 U+8E0A
+    0xB3EC, // 踌 U+8E0C
+    0xCCA4, // 踏 U+8E0F
+    0xBEE1, // 踞 U+8E1E
+    0xCCDF, // 踢 U+8E22
+    0xB2C8, // 踩 U+8E29
+    0xD7D9, // 踪 U+8E2A
+    0xCCE3, // 蹄 U+8E44
+    0xB5B8, // 蹈 U+8E48
+    0xCCA3, // 蹋 U+8E4B
+    0xB1C4, // 蹦 U+8E66
+    0xB5C5, // 蹬 U+8E6C
+    0xB2E4, // 蹭 U+8E6D
+    0xB6D7, // 蹲 U+8E72
+    0xB4DA, // 蹿 U+8E7F
+    0xD4EA, // 躁 U+8E81
+    0xB3F9, // 躇 U+8E87
+    0xC9ED, // 身 U+8EAB
+    0xB9AA, // 躬 U+8EAC
+    0xC7FB, // 躯 U+8EAF
+    0xB6E3, // 躲 U+8EB2
+    0xCCC9, // 躺 U+8EBA
+    0xB3B5, // 车 U+8F66
+    0xD4FE, // 轧 U+8F67
+    0xB9EC, // 轨 U+8F68
+    0xD0F9, // 轩 U+8F69
+    0xD7AA, // 转 U+8F6C
+    0xC2D6, // 轮 U+8F6E
+    0xC8ED, // 软 U+8F6F
+    0xBAE4, // 轰 U+8F70
+    0xD6E1, // 轴 U+8F74
+    0xC7E1, // 轻 U+8F7B
+    0xD4D8, // 载 U+8F7D
+    0xBDCE, // 轿 U+8F7F
+    0xBDCF, // 较 U+8F83
+    0xB8A8, // 辅 U+8F85
+    0xC1BE, // 辆 U+8F86
+    0xB1B2, // 辈 U+8F88
+    0xBBD4, // 辉 U+8F89
+    0xB9F5, // 辊 U+8F8A
+    0xB7F8, // 辐 U+8F90
+    0xBCAD, // 辑 U+8F91
+    0xCAE4, // 输 U+8F93
+    0xD4AF, // 辕 U+8F95
+    0xCFBD, // 辖 U+8F96
+    0xD5B7, // 辗 U+8F97
+    0xD5DE, // 辙 U+8F99
+    0xD0C1, // 辛 U+8F9B
+    0xB9BC, // 辜 U+8F9C
+    0xB4C7, // 辞 U+8F9E
+    0xB1D9, // 辟 U+8F9F
+    0xC0B1, // 辣 U+8FA3
+    0xB1E6, // 辨 U+8FA8
+    0xB1E7, // 辩 U+8FA9
+    0xB1E8, // 辫 U+8FAB
+    0xB3BD, // 辰 U+8FB0
+    0xC8E8, // 辱 U+8FB1
+    0xB1DF, // 边 U+8FB9
+    0xC1C9, // 辽 U+8FBD
+    0xB4EF, // 达 U+8FBE
+    0xC7A8, // 迁 U+8FC1
+    0xD3D8, // 迂 U+8FC2
+    0xC6F9, // 迄 U+8FC4
+    0xD1B8, // 迅 U+8FC5
+    0xB9FD, // 过 U+8FC7
+    0xC2F5, // 迈 U+8FC8
+    0xD3AD, // 迎 U+8FCE
+    0xD4CB, // 运 U+8FD0
+    0xBDFC, // 近 U+8FD1
+    0xB7B5, // 返 U+8FD4
+    0xBBB9, // 还 U+8FD8
+    0xD5E2, // 这 U+8FD9
+    0xBDF8, // 进 U+8FDB
+    0xD4B6, // 远 U+8FDC
+    0xCEA5, // 违 U+8FDD
+    0xC1AC, // 连 U+8FDE
+    0xB3D9, // 迟 U+8FDF
+    0xCCF6, // 迢 U+8FE2
+    0xB5CF, // 迪 U+8FEA
+    0xC6C8, // 迫 U+8FEB
+    0xB5FC, // 迭 U+8FED
+    0xCAF6, // 述 U+8FF0
+    0xC3D4, // 迷 U+8FF7
+    0xB1C5, // 迸 U+8FF8
+    0xBCA3, // 迹 U+8FF9
+    0xD7B7, // 追 U+8FFD
+    0xCDCB, // 退 U+9000
+    0xCBCD, // 送 U+9001
+    0xCACA, // 适 U+9002
+    0xCCD3, // 逃 U+9003
+    0xC4E6, // 逆 U+9006
+    0xD1A1, // 选 U+9009
+    0xD1B7, // 逊 U+900A
+    0xCDB8, // 透 U+900F
+    0xD6F0, // 逐 U+9010
+    0xB5DD, // 递 U+9012
+    0xCDBE, // 途 U+9014
+    0xB6BA, // 逗 U+9017
+    0xCDA8, // 通 U+901A
+    0xB9E4, // 逛 U+901B
+    0xCAC5, // 逝 U+901D
+    0xB3D1, // 逞 U+901E
+    0xCBD9, // 速 U+901F
+    0xD4EC, // 造 U+9020
+    0xB7EA, // 逢 U+9022
+    0xB4FE, // 逮 U+902E
+    0xD2DD, // 逸 U+9038
+    0xC2DF, // 逻 U+903B
+    0xB1C6, // 逼 U+903C
+    0xD3E2, // 逾 U+903E
+    0xB6DD, // 遁 U+9041
+    0xCBEC, // 遂 U+9042
+    0xD3F6, // 遇 U+9047
+    0xB1E9, // 遍 U+904D
+    0xB6F4, // 遏 U+904F
+    0xB5C0, // 道 U+9053
+    0xD2C5, // 遗 U+9057
+    0xC7B2, // 遣 U+9063
+    0xD2A3, // 遥 U+9065
+    0xD4E2, // 遭 U+906D
+    0xD5DA, // 遮 U+906E
+    0xD7F1, // 遵 U+9075
+    0xB1DC, // 避 U+907F
+    0xD1FB, // 邀 U+9080
+    0xD2D8, // 邑 U+9091
+    0xB5CB, // 邓 U+9093
+    0xD0CF, // 邢 U+90A2
+    0xC4C7, // 那 U+90A3
+    0xB0EE, // 邦 U+90A6
+    0xD0B0, // 邪 U+90AA
+    0xD3CA, // 邮 U+90AE
+    0xBAAA, // 邯 U+90AF
+    0xC7F1, // 邱 U+90B1
+    0xC9DB, // 邵 U+90B5
+    0xD7DE, // 邹 U+90B9
+    0xC1DA, // 邻 U+90BB
+    0xD3F4, // 郁 U+90C1
+    0xBDBC, // 郊 U+90CA
+    0xC0C9, // 郎 U+90CE
+    0xD6A3, // 郑 U+90D1
+    0xBAC2, // 郝 U+90DD
+    0xBFA4, // 郡 U+90E1
+    0xD4C7, // 郧 U+90E7
+    0xB2BF, // 部 U+90E8
+    0xB9F9, // 郭 U+90ED
+    0xB3BB, // 郴 U+90F4
+    0xB5A6, // 郸 U+90F8
+    0xB6BC, // 都 U+90FD
+    0xB6F5, // 鄂 U+9102
+    0xB1C9, // 鄙 U+9119
+    0xD3CF, // 酉 U+9149
+    0xC7F5, // 酋 U+914B
+    0xD7C3, // 酌 U+914C
+    0xC5E4, // 配 U+914D
+    0xBEC6, // 酒 U+9152
+    0xD0EF, // 酗 U+9157
+    0xB7D3, // 酚 U+915A
+    0xD4CD, // 酝 U+915D
+    0xCCAA, // 酞 U+915E
+    0xBAA8, // 酣 U+9163
+    0xCBD6, // 酥 U+9165
+    0xC0D2, // 酪 U+916A
+    0xB3EA, // 酬 U+916C
+    0xCDAA, // 酮 U+916E
+    0xBDB4, // 酱 U+9171
+    0xBDCD, // 酵 U+9175
+    0xC3B8, // 酶 U+9176
+    0xBFE1, // 酷 U+9177
+    0xCBE1, // 酸 U+9178
+    0xC4F0, // 酿 U+917F
+    0xB4BC, // 醇 U+9187
+    0xD7ED, // 醉 U+9189
+    0xB4D7, // 醋 U+918B
+    0xD0D1, // 醒 U+9192
+    0xC3D1, // 醚 U+919A
+    0xC8A9, // 醛 U+919B
+    0xB2C9, // 采 U+91C7
+    0xD3D4, // 釉 U+91C9
+    0xCACD, // 释 U+91CA
+    0xC0EF, // 里 U+91CC
+    0xD6D8, // 重 U+91CD
+    0xD2B0, // 野 U+91CE
+    0xC1BF, // 量 U+91CF
+    0xBDF0, // 金 U+91D1
+    0xB8AA, // 釜 U+91DC
+    0xBCF8, // 鉴 U+9274
+    0xD5EB, // 针 U+9488
+    0xB6A4, // 钉 U+9489
+    0xC7A5, // 钎 U+948E
+    0xB7B0, // 钒 U+9492
+    0xB5F6, // 钓 U+9493
+    0xB8C6, // 钙 U+9499
+    0xB6DB, // 钝 U+949D
+    0xB3AE, // 钞 U+949E
+    0xD6D3, // 钟 U+949F
+    0xC4C6, // 钠 U+94A0
+    0xB1B5, // 钡 U+94A1
+    0xB8D6, // 钢 U+94A2
+    0xD4BF, // 钥 U+94A5
+    0xC7D5, // 钦 U+94A6
+    0xBEFB, // 钧 U+94A7
+    0xCED9, // 钨 U+94A8
+    0xB9B3, // 钩 U+94A9
+    0xC5A5, // 钮 U+94AE
+    0xC7AE, // 钱 U+94B1
+    0xC7AF, // 钳 U+94B3
+    0xB2A7, // 钵 U+94B5
+    0xD7EA, // 钻 U+94BB
+    0xBCD8, // 钾 U+94BE
+    0xD3CB, // 铀 U+94C0
+    0xCCFA, // 铁 U+94C1
+    0xB2AC, // 铂 U+94C2
+    0xC1E5, // 铃 U+94C3
+    0xC7A6, // 铅 U+94C5
+    0xC3AD, // 铆 U+94C6
+    0xCDAD, // 铜 U+94DC
+    0xC2C1, // 铝 U+94DD
+    0xD5A1, // 铡 U+94E1
+    0xCFB3, // 铣 U+94E3
+    0xB8F5, // 铬 U+94EC
+    0xC3FA, // 铭 U+94ED
+    0xBDC2, // 铰 U+94F0
+    0xD2BF, // 铱 U+94F1
+    0xB2F9, // 铲 U+94F2
+    0xD2F8, // 银 U+94F6
+    0xD6FD, // 铸 U+94F8
+    0xC6CC, // 铺 U+94FA
+    0xC1B4, // 链 U+94FE
+    0xCFFA, // 销 U+9500
+    0xCBF8, // 锁 U+9501
+    0xB3FA, // 锄 U+9504
+    0xB9F8, // 锅 U+9505
+    0xD0E2, // 锈 U+9508
+    0xB7E6, // 锋 U+950B
+    0xD0BF, // 锌 U+950C
+    0xC8F1, // 锐 U+9510
+    0xCCE0, // 锑 U+9511
+    0xD5E0, // 锗 U+9517
+    0xB4ED, // 错 U+9519
+    0xC3AA, // 锚 U+951A
+    0xCEFD, // 锡 U+9521
+    0xC2E0, // 锣 U+9523
+    0xB4B8, // 锤 U+9524
+    0xD7B6, // 锥 U+9525
+    0xBDF5, // 锦 U+9526
+    0xCFC7, // 锨 U+9528
+    0xB6A7, // 锭 U+952D
+    0xBCFC, // 键 U+952E
+    0xBEE2, // 锯 U+952F
+    0xC3CC, // 锰 U+9530
+    0xC7C2, // 锹 U+9539
+    0xB6CD, // 锻 U+953B
+    0xB6C6, // 镀 U+9540
+    0xC3BE, // 镁 U+9541
+    0xD5F2, // 镇 U+9547
+    0xC4F7, // 镊 U+954A
+    0xC4F8, // 镍 U+954D
+    0xB8E4, // 镐 U+9550
+    0xB0F7, // 镑 U+9551
+    0xBEB5, // 镜 U+955C
+    0xC1CD, // 镣 U+9563
+    0xC0D8, // 镭 U+956D
+    0xC1AD, // 镰 U+9570
+    0xCFE2, // 镶 U+9576
+    0xB3A4, // 长 U+957F
+    0xC3C5, // 门 U+95E8
+    0xC9C1, // 闪 U+95EA
+    0xB1D5, // 闭 U+95ED
+    0xCECA, // 问 U+95EE
+    0xB4B3, // 闯 U+95EF
+    0xC8F2, // 闰 U+95F0
+    0xCFD0, // 闲 U+95F2
+    0xBCE4, // 间 U+95F4
+    0xC3C6, // 闷 U+95F7
+    0xD5A2, // 闸 U+95F8
+    0xC4D6, // 闹 U+95F9
+    0xB9EB, // 闺 U+95FA
+    0xCEC5, // 闻 U+95FB
+    0xC3F6, // 闽 U+95FD
+    0xB7A7, // 阀 U+9600
+    0xB8F3, // 阁 U+9601
+    0xBAD2, // 阂 U+9602
+    0xD4C4, // 阅 U+9605
+    0xD1CB, // 阉 U+9609
+    0xD1D6, // 阎 U+960E
+    0xB2FB, // 阐 U+9610
+    0xC0BB, // 阑 U+9611
+    0xC0AB, // 阔 U+9614
+    0xB8B7, // 阜 U+961C
+    0xB6D3, // 队 U+961F
+    0xC8EE, // 阮 U+962E
+    0xB7C0, // 防 U+9632
+    0xD1F4, // 阳 U+9633
+    0xD2F5, // 阴 U+9634
+    0xD5F3, // 阵 U+9635
+    0xBDD7, // 阶 U+9636
+    0xD7E8, // 阻 U+963B
+    0xB0A2, // 阿 U+963F
+    0xCDD3, // 陀 U+9640
+    0xB8BD, // 附 U+9644
+    0xBCCA, // 际 U+9645
+    0xC2BD, // 陆 U+9646
+    0xC2A4, // 陇 U+9647
+    0xB3C2, // 陈 U+9648
+    0xC2AA, // 陋 U+964B
+    0xC4B0, // 陌 U+964C
+    0xBDB5, // 降 U+964D
+    0xCFDE, // 限 U+9650
+    0xC9C2, // 陕 U+9655
+    0xB1DD, // 陛 U+965B
+    0xB6B8, // 陡 U+9661
+    0xD4BA, // 院 U+9662
+    0xB3FD, // 除 U+9664
+    0xD4C9, // 陨 U+9668
+    0xCFD5, // 险 U+9669
+    0xC5E3, // 陪 U+966A
+    0xC1EA, // 陵 U+9675
+    0xCCD5, // 陶 U+9676
+    0xCFDD, // 陷 U+9677
+    0xD3E7, // 隅 U+9685
+    0xC2A1, // 隆 U+9686
+    0xCBE5, // 隋 U+968B
+    0xCBE6, // 随 U+968F
+    0xD2FE, // 隐 U+9690
+    0xB8F4, // 隔 U+9694
+    0xB0AF, // 隘 U+9698
+    0xCFB6, // 隙 U+9699
+    0xD5CF, // 障 U+969C
+    0xCBED, // 隧 U+96A7
+    0xC1A5, // 隶 U+96B6
+    0xC4D1, // 难 U+96BE
+    0xC8B8, // 雀 U+96C0
+    0xD1E3, // 雁 U+96C1
+    0xD0DB, // 雄 U+96C4
+    0xD1C5, // 雅 U+96C5
+    0xBCAF, // 集 U+96C6
+    0xB9CD, // 雇 U+96C7
+    0xB4C6, // 雌 U+96CC
+    0xD3BA, // 雍 U+96CD
+    0xB3FB, // 雏 U+96CF
+    0xB5F1, // 雕 U+96D5
+    0xD3EA, // 雨 U+96E8
+    0xD1A9, // 雪 U+96EA
+    0xC1E3, // 零 U+96F6
+    0xC0D7, // 雷 U+96F7
+    0xB1A2, // 雹 U+96F9
+    0xCEED, // 雾 U+96FE
+    0xD0E8, // 需 U+9700
+    0xCFF6, // 霄 U+9704
+    0xD5F0, // 震 U+9707
+    0xC3B9, // 霉 U+9709
+    0xBBF4, // 霍 U+970D
+    0xC4DE, // 霓 U+9713
+    0xC1D8, // 霖 U+9716
+    0xCBAA, // 霜 U+971C
+    0xCFBC, // 霞 U+971E
+    0xC2B6, // 露 U+9732
+    0xB0D4, // 霸 U+9738
+    0xC5F9, // 霹 U+9739
+    0xC7E0, // 青 U+9752
+    0xBEB8, // 靖 U+9756
+    0xBEB2, // 静 U+9759
+    0xB5E5, // 靛 U+975B
+    0xB7C7, // 非 U+975E
+    0xBFBF, // 靠 U+9760
+    0xC3D2, // 靡 U+9761
+    0xC3E6, // 面 U+9762
+    0xB8EF, // 革 U+9769
+    0xBDF9, // 靳 U+9773
+    0xD1A5, // 靴 U+9774
+    0xB0D0, // 靶 U+9776
+    0xD0AC, // 鞋 U+978B
+    0xB0B0, // 鞍 U+978D
+    0xC7CA, // 鞘 U+9798
+    0xBECF, // 鞠 U+97A0
+    0xB1DE, // 鞭 U+97AD
+    0xCEA4, // 韦 U+97E6
+    0xC8CD, // 韧 U+97E7
+    0xBAAB, // 韩 U+97E9
+    0xBEC2, // 韭 U+97ED
+    0xD2F4, // 音 U+97F3
+    0xD4CF, // 韵 U+97F5
+    0xC9D8, // 韶 U+97F6
+    0xD2B3, // 页 U+9875
+    0xB6A5, // 顶 U+9876
+    0xC7EA, // 顷 U+9877
+    0xCFEE, // 项 U+9879
+    0xCBB3, // 顺 U+987A
+    0xD0EB, // 须 U+987B
+    0xCDE7, // 顽 U+987D
+    0xB9CB, // 顾 U+987E
+    0xB6D9, // 顿 U+987F
+    0xB0E4, // 颁 U+9881
+    0xCBCC, // 颂 U+9882
+    0xD4A4, // 预 U+9884
+    0xC2AD, // 颅 U+9885
+    0xC1EC, // 领 U+9886
+    0xC6C4, // 颇 U+9887
+    0xBEB1, // 颈 U+9888
+    0xBCD5, // 颊 U+988A
+    0xD2C3, // 颐 U+9890
+    0xC6B5, // 频 U+9891
+    0xCDC7, // 颓 U+9893
+    0xD3B1, // 颖 U+9896
+    0xBFC5, // 颗 U+9897
+    0xCCE2, // 题 U+9898
+    0xD1D5, // 颜 U+989C
+    0xB6EE, // 额 U+989D
+    0xB5DF, // 颠 U+98A0
+    0xB2FC, // 颤 U+98A4
+    0xC8A7, // 颧 U+98A7
+    0xB7E7, // 风 U+98CE
+    0xC6AE, // 飘 U+98D8
+    0xB7C9, // 飞 U+98DE
+    0xCAB3, // 食 U+98DF
+    0xB2CD, // 餐 U+9910
+    0xBCA2, // 饥 U+9965
+    0xB7B9, // 饭 U+996D
+    0xD2FB, // 饮 U+996E
+    0xBDA4, // 饯 U+996F
+    0xCACE, // 饰 U+9970
+    0xB1A5, // 饱 U+9971
+    0xCBC7, // 饲 U+9972
+    0xB6FC, // 饵 U+9975
+    0xC8C4, // 饶 U+9976
+    0xBDC8, // 饺 U+997A
+    0xB1FD, // 饼 U+997C
+    0xB6F6, // 饿 U+997F
+    0xC4D9, // 馁 U+9981
+    0xCFDA, // 馅 U+9985
+    0xB9DD, // 馆 U+9986
+    0xC0A1, // 馈 U+9988
+    0xB2F6, // 馋 U+998B
+    0xC1F3, // 馏 U+998F
+    0xC2F8, // 馒 U+9992
+    0xCAD7, // 首 U+9996
+    0xCFE3, // 香 U+9999
+    0xC2ED, // 马 U+9A6C
+    0xD4A6, // 驭 U+9A6D
+    0xCDD4, // 驮 U+9A6E
+    0xD1B1, // 驯 U+9A6F
+    0xB3DB, // 驰 U+9A70
+    0xC7FD, // 驱 U+9A71
+    0xB2B5, // 驳 U+9A73
+    0xC2BF, // 驴 U+9A74
+    0xCABB, // 驶 U+9A76
+    0xBED4, // 驹 U+9A79
+    0xD7A4, // 驻 U+9A7B
+    0xCDD5, // 驼 U+9A7C
+    0xBCDD, // 驾 U+9A7E
+    0xC2EE, // 骂 U+9A82
+    0xBDBE, // 骄 U+9A84
+    0xC2E6, // 骆 U+9A86
+    0xBAA7, // 骇 U+9A87
+    0xB3D2, // 骋 U+9A8B
+    0xD1E9, // 验 U+9A8C
+    0xBFA5, // 骏 U+9A8F
+    0xC6EF, // 骑 U+9A91
+    0xC6AD, // 骗 U+9A97
+    0xC9A7, // 骚 U+9A9A
+    0xC2E2, // 骡 U+9AA1
+    0xD6E8, // 骤 U+9AA4
+    0xB9C7, // 骨 U+9AA8
+    0xBAA1, // 骸 U+9AB8
+    0xCBE8, // 髓 U+9AD3
+    0xB8DF, // 高 U+9AD8
+    0xD7D7, // 鬃 U+9B03
+    0xB9ED, // 鬼 U+9B3C
+    0xBFFD, // 魁 U+9B41
+    0xBBEA, // 魂 U+9B42
+    0xC6C7, // 魄 U+9B44
+    0xCEBA, // 魏 U+9B4F
+    0xC4A7, // 魔 U+9B54
+    0xD3E3, // 鱼 U+9C7C
+    0xC2B3, // 鲁 U+9C81
+    0xB1AB, // 鲍 U+9C8D
+    0xCFCA, // 鲜 U+9C9C
+    0xC0F0, // 鲤 U+9CA4
+    0xBEA8, // 鲸 U+9CB8
+    0xC8FA, // 鳃 U+9CC3
+    0xB1EE, // 鳖 U+9CD6
+    0xC1DB, // 鳞 U+9CDE
+    0xC4F1, // 鸟 U+9E1F
+    0xBCA6, // 鸡 U+9E21
+    0xC3F9, // 鸣 U+9E23
+    0xC5B8, // 鸥 U+9E25
+    0xD1BB, // 鸦 U+9E26
+    0xD1BC, // 鸭 U+9E2D
+    0xD1EC, // 鸯 U+9E2F
+    0xD4A7, // 鸳 U+9E33
+    0xCDD2, // 鸵 U+9E35
+    0xB8EB, // 鸽 U+9E3D
+    0xBAE8, // 鸿 U+9E3F
+    0xBEE9, // 鹃 U+9E43
+    0xB6EC, // 鹅 U+9E45
+    0xC8B5, // 鹊 U+9E4A
+    0xC5F4, // 鹏 U+9E4F
+    0xBAD7, // 鹤 U+9E64
+    0xD3A5, // 鹰 U+9E70
+    0xC2B9, // 鹿 U+9E7F
+    0xC2B4, // 麓 U+9E93
+    0xC2F3, // 麦 U+9EA6
+    0xC2E9, // 麻 U+9EBB
+    0xBBC6, // 黄 U+9EC4
+    0xCAF2, // 黍 U+9ECD
+    0xC0E8, // 黎 U+9ECE
+    0xBADA, // 黑 U+9ED1
+    0xC7AD, // 黔 U+9ED4
+    0xC4AC, // 默 U+9ED8
+    0xB6A6, // 鼎 U+9F0E
+    0xB9C4, // 鼓 U+9F13
+    0xCAF3, // 鼠 U+9F20
+    0xB1C7, // 鼻 U+9F3B
+    0xC6EB, // 齐 U+9F50
+    0xB3DD, // 齿 U+9F7F
+    0xC1E4, // 龄 U+9F84
+    0xC8A3, // 龋 U+9F8B
+    0xC1FA, // 龙 U+9F99
+    0xB9A8, // 龚 U+9F9A
+    0xB9EA, // 龟 U+9F9F
 };
 
-// Binary search implementation for Unicode to GB2312 conversion
+// Convert Unicode code point to GB2312 encoding
+// Returns INVALID_GB2312 if the character is not found
 uint16_t unicode_to_gb2312(uint16_t unicode) {
-    int left = 0;
-    int right = (sizeof(map_table) / sizeof(map_table[0])) - 1;
-    
-    while (left <= right) {
-        int mid = (left + right) / 2;
-        
-        if (map_table[mid].unicode == unicode) {
-            return map_table[mid].gb2312;
-        }
-        
-        if (map_table[mid].unicode < unicode) {
-            left = mid + 1;
-        } else {
-            right = mid - 1;
-        }
+    uint8_t page = page_index[unicode >> 8];
+    if (page == 0xFF) {
+        return INVALID_GB2312;
+    }
+
+    uint32_t block = page * 8 + ((unicode >> 5) & 7);
+    uint32_t bit = 1u << (unicode & 31);
+    uint32_t bits = block_bits[block];
+    if (!(bits & bit)) {
+        return INVALID_GB2312;  // Character not found
     }
-    
-    return INVALID_GB2312;  // Character not found
+
+    return gb2312_codes[block_base[block] + __builtin_popcount(bits & (bit - 1))];
 }
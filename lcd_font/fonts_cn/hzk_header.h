@@ -15,20 +15,39 @@ extern "C" {
 
 #include "esp_types.h"
 
+/// HZK1：按GB2312的94x94编码区排列，需要先把Unicode转换为GB2312
+#define HZK_MAGIC_V1 0x314B5A48
+/// HZK2：只保存编码表中的字符，按Unicode排序，带Unicode索引
+#define HZK_MAGIC_V2 0x324B5A48
+
+/// HZK2索引每页的块数，每块32个码点
+#define HZK_INDEX_BLOCKS_PER_PAGE 8
+
 /**
  * @brief 汉字库头信息, 共64字节对齐
  * 
+ * HZK2的索引在 index_offset 处，依次为：
+ * - uint8_t page_index[256]，Unicode高字节 -> 页号，0xFF表示该页没有字符
+ * - uint32_t block_bits[page_count * 8]，每块32个码点的位图
+ * - uint16_t block_base[page_count * 8]，每块第一个字符的序号
+ * 字符的序号为 block_base + 位图中低于该码点的位数，数据在 font_data_offset + 序号 * font_code_size
  */
 typedef struct 
 {
-    uint32_t magic;// HZK1, 
+    uint32_t magic;// HZK1 或 HZK2
     uint32_t font_width;
     uint32_t font_height;
     uint32_t font_code_size;
     uint32_t font_data_offset;
     uint32_t font_data_size;
     uint32_t font_data_checksum;// CRC32
-    uint32_t reserved[8];
+    // 以下字段只用于HZK2，HZK1中为0
+    uint32_t char_count;     // 字符数量
+    uint32_t page_count;     // 索引的页数
+    uint32_t index_offset;   // 索引偏移量
+    uint32_t index_size;     // 索引大小
+    uint32_t index_checksum; // 索引CRC32
+    uint32_t reserved[3];
     uint32_t header_checksum; // CRC32
 }hzk_header_t;
 
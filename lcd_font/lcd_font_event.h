@@ -0,0 +1,43 @@
+/**
+ * @file lcd_font_event.h
+ * @author Liu Chuansen (179712066@qq.com)
+ * @brief 字体事件定义，通过 app_event_loop 发送
+ * @version 0.1
+ * @date 2025-10-19
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "esp_event.h"
+#include "lcd_fonts.h"
+
+// 声明字体事件基础
+ESP_EVENT_DECLARE_BASE(LCD_FONT_EVENTS);
+
+// 定义事件类型
+typedef enum {
+    LCD_FONT_EVENT_NONE = 0,
+    LCD_FONT_EVENT_HZK_VERIFIED,        // 汉字库数据校验通过
+    LCD_FONT_EVENT_HZK_VERIFY_FAILED,   // 汉字库数据CRC32不匹配或无法读取
+} lcd_font_event_t;
+
+// 汉字库校验事件数据
+typedef struct {
+    const char *font_name;              // 字体名称，如 "hzk16"
+    lcd_font_hzk_verify_state_t state;  // 校验结果
+    uint32_t expected;                  // 头部中的CRC32
+    uint32_t calculated;                // 计算得到的CRC32
+} lcd_font_hzk_verify_event_data_t;
+
+
+#ifdef __cplusplus
+}
+#endif
@@ -30,6 +30,27 @@ extern "C" {
 #define CONFIG_LCD_FONT_EXTENDED_ASCII 0
 #endif
 
+/**
+ * @brief 比例字体中单个字形的信息
+ * 
+ * @note 字形位图只保存边界框内的像素，每行 (width + 7) / 8 个字节，高位在左
+ */
+typedef struct
+{
+    /// 位图在字体数据中的偏移
+    uint16_t offset;
+    /// 边界框宽度，为0时是空白字符，没有位图
+    uint8_t width;
+    /// 边界框高度
+    uint8_t height;
+    /// 边界框相对于字符单元左上角的偏移
+    int8_t x_offset;
+    int8_t y_offset;
+    /// 步进宽度，下一个字符的起始位置
+    uint8_t advance;
+    uint8_t reserved;
+}lcd_font_glyph_t;
+
 /**
  * @brief 定义一个字体
  * 
@@ -50,9 +71,133 @@ typedef struct
     const uint8_t *data;
     /// 获取数据编码数据的起始地址
     const uint8_t * (*get_code_data)(const void *self, uint32_t ch);
+    /// 获取字形信息，为NULL时是等宽字体；不为NULL时get_code_data返回边界框内的位图
+    const lcd_font_glyph_t * (*get_glyph)(const void *self, uint32_t ch);
+    /// 预取一组字符的数据，合并读取后放入字体的缓存，为NULL时不需要预取
+    void (*prefetch)(const void *self, const uint32_t *chars, int count);
+    /// 可重入地获取编码数据：数据地址一直有效时直接返回，否则复制或解码到调用者的buf（至少code_size字节）后返回buf，
+    /// 为NULL时get_code_data返回的地址一直有效，可以在多个任务中同时使用
+    const uint8_t * (*get_code_data_r)(const void *self, uint32_t ch, uint8_t *buf);
 }lcd_font_t;
 
+/**
+ * @brief 比例字体，按字形边界框裁剪保存位图，每个字符有自己的步进宽度
+ * 
+ * @note font.width 为最大步进宽度，font.height 为行高，字符编码连续，从first_char开始
+ */
+typedef struct
+{
+    /// 基础字体，必须是第一个成员
+    lcd_font_t font;
+    /// 第一个字符编码
+    uint32_t first_char;
+    /// 字形数量
+    uint32_t glyph_count;
+    /// 字形信息表
+    const lcd_font_glyph_t *glyphs;
+}lcd_prop_font_t;
+
+
+
+/**
+ * @brief 压缩字体每个字体的解码缓存槽数量
+ * 
+ * @note 每个槽 code_size 字节，按字符编码直接映射
+ */
+#ifndef CONFIG_LCD_FONT_RLE_CACHE_SLOTS
+#define CONFIG_LCD_FONT_RLE_CACHE_SLOTS 4
+#endif
+
+/// 压缩字体偏移表中表示按行异或后编码的标志位
+#define LCD_FONT_RLE_XOR_ROWS 0x8000
+
+/**
+ * @brief 压缩字体的解码缓存
+ * 
+ */
+typedef struct
+{
+    /// 每个槽中的字符编码 + 1，0表示空
+    uint32_t tags[CONFIG_LCD_FONT_RLE_CACHE_SLOTS];
+    /// 缓存数据，CONFIG_LCD_FONT_RLE_CACHE_SLOTS * code_size 字节
+    uint8_t *data;
+    /// 命中次数
+    uint32_t hits;
+    /// 解码次数
+    uint32_t misses;
+}lcd_font_cache_t;
+
+/**
+ * @brief 压缩字体，字形用游程编码保存，通过 get_code_data 解码到缓存中
+ * 
+ * @note 游程编码格式与 LCD_MONO_RLE_IMG_DEFINE 相同，每个字形单独编码：
+ *   offsets[i] 的低15位为字形在data中的偏移，最高位 LCD_FONT_RLE_XOR_ROWS 表示编码前每行与上一行异或；
+ *   字形数据长度等于 code_size 时为原始数据，不压缩。
+ *   get_code_data 返回的数据在该缓存槽被其他字符使用前有效，不能在多个任务中同时使用同一个字体；
+ *   get_code_data_r 直接解码到调用者的缓冲区，可以在多个任务中同时使用。
+ */
+typedef struct
+{
+    /// 基础字体，必须是第一个成员，data为压缩后的数据
+    lcd_font_t font;
+    /// 第一个字符编码
+    uint32_t first_char;
+    /// 字形数量
+    uint32_t glyph_count;
+    /// 每个字形的数据偏移
+    const uint16_t *offsets;
+    /// 解码缓存
+    lcd_font_cache_t *cache;
+}lcd_rle_font_t;
+
+/**
+ * @brief 子集字体，只包含用到的字符，由 lcd_font_packer.py --subset 生成
+ * 
+ * @note 字形按字符编码升序连续存放，每个 code_size 字节，codes[i] 为第i个字形的字符编码
+ */
+typedef struct
+{
+    /// 基础字体，必须是第一个成员
+    lcd_font_t font;
+    /// 字形数量
+    uint32_t glyph_count;
+    /// 按升序排列的字符编码
+    const uint16_t *codes;
+}lcd_subset_font_t;
+
+/**
+ * @brief 放大字体的倍数
+ * 
+ */
+typedef enum
+{
+    /// 2倍，每个像素放大为2x2
+    LCD_FONT_SCALE_2X = 0,
+    /// 1.5倍，每2x2个像素放大为3x3，中间列为左右两列的或（竖笔画加粗），中间行为上下两行的与（横笔画保持单像素）
+    LCD_FONT_SCALE_1_5X,
+}lcd_font_scale_t;
+
+/// 放大字体中基础字体的最大编码大小
+#define LCD_FONT_SCALED_BASE_MAX_CODE_SIZE 128
 
+/**
+ * @brief 放大字体，显示时用查找表把基础字体的字形放大，不需要单独的大字库
+ * 
+ * @note 基础字体必须是等宽字体，2倍时宽度为8的整数倍，1.5倍时宽度为16的整数倍、高度为偶数，
+ *   编码大小不超过 LCD_FONT_SCALED_BASE_MAX_CODE_SIZE。
+ *   get_code_data 放大到字体自己的缓冲区，不能在多个任务中同时使用；get_code_data_r 放大到调用者的缓冲区。
+ */
+typedef struct
+{
+    /// 基础字体，必须是第一个成员，data为NULL
+    lcd_font_t font;
+    /// 被放大的字体
+    const lcd_font_t *base;
+    /// 放大倍数，lcd_font_scale_t
+    uint8_t scale;
+    /// get_code_data 的输出缓冲区，code_size 字节
+    uint8_t *buf;
+}lcd_scaled_font_t;
 
 /**
  * @brief 一般获取ASCII字库数据的方法
@@ -82,6 +227,80 @@ const uint8_t *lcd_font_get_ascii_code(const void *self, uint32_t ch);
  */
 const uint8_t *lcd_font_get_ascii_number_code(const void *self, uint32_t ch);
 
+/**
+ * @brief 获取比例字体的字形位图
+ * 
+ * @param self 字体对象，lcd_prop_font_t
+ * @param ch 字符编码
+ * @return const uint8_t * 返回边界框内的位图，空白字符或没有该字符时返回NULL
+ */
+const uint8_t *lcd_font_get_prop_code(const void *self, uint32_t ch);
+
+/**
+ * @brief 获取压缩字体的字形数据，解码到缓存中
+ * 
+ * @param self 字体对象，lcd_rle_font_t
+ * @param ch 字符编码
+ * @return const uint8_t * 返回解码后的数据，code_size 字节，没有该字符或数据错误时返回NULL
+ */
+const uint8_t *lcd_font_get_rle_code(const void *self, uint32_t ch);
+
+/**
+ * @brief 获取压缩字体的字形数据，直接解码到调用者的缓冲区，不使用字体的解码缓存
+ * 
+ * @param self 字体对象，lcd_rle_font_t
+ * @param ch 字符编码
+ * @param buf 调用者的缓冲区，至少 code_size 字节
+ * @return const uint8_t * 返回buf，没有该字符或数据错误时返回NULL
+ */
+const uint8_t *lcd_font_get_rle_code_r(const void *self, uint32_t ch, uint8_t *buf);
+
+/**
+ * @brief 获取放大字体的字形数据，放大到字体的缓冲区中
+ * 
+ * @param self 字体对象，lcd_scaled_font_t
+ * @param ch 字符编码
+ * @return const uint8_t * 返回放大后的数据，code_size 字节，基础字体中没有该字符时返回NULL
+ */
+const uint8_t *lcd_font_get_scaled_code(const void *self, uint32_t ch);
+
+/**
+ * @brief 获取放大字体的字形数据，放大到调用者的缓冲区
+ * 
+ * @param self 字体对象，lcd_scaled_font_t
+ * @param ch 字符编码
+ * @param buf 调用者的缓冲区，至少 code_size 字节
+ * @return const uint8_t * 返回buf，基础字体中没有该字符时返回NULL
+ */
+const uint8_t *lcd_font_get_scaled_code_r(const void *self, uint32_t ch, uint8_t *buf);
+
+/**
+ * @brief 预取放大字体的一组字符，转给基础字体
+ * 
+ * @param self 字体对象，lcd_scaled_font_t
+ * @param chars 字符编码数组
+ * @param count 字符数量
+ */
+void lcd_font_prefetch_scaled(const void *self, const uint32_t *chars, int count);
+
+/**
+ * @brief 获取子集字体的字形数据，二分查找字符编码
+ * 
+ * @param self 字体对象，lcd_subset_font_t
+ * @param ch 字符编码
+ * @return const uint8_t * 返回编码地址，code_size 字节，子集中没有该字符时返回NULL
+ */
+const uint8_t *lcd_font_get_subset_code(const void *self, uint32_t ch);
+
+/**
+ * @brief 获取比例字体的字形信息
+ * 
+ * @param self 字体对象，lcd_prop_font_t
+ * @param ch 字符编码
+ * @return const lcd_font_glyph_t * 字形信息，没有该字符时返回NULL
+ */
+const lcd_font_glyph_t *lcd_font_get_prop_glyph(const void *self, uint32_t ch);
+
 
 
 
@@ -120,6 +339,194 @@ const lcd_font_t g_lcd_font_##_name = { \
     .get_code_data = _func, \
 }
 
+/**
+ * @brief 定义一个没有内置数据、支持预取和可重入获取的字体，如从分区加载的汉字库
+ * 
+ */
+#define LCD_FONT_DEFINE_NO_DATA_WITH_PREFETCH(_name, _width, _height, _func, _func_r, _prefetch) \
+const lcd_font_t g_lcd_font_##_name = { \
+    .name = #_name,  \
+    .width = _width, .height = _height, \
+    .code_size = ((((_width) >> 3) + (((_width) & 0x7) ? 1 : 0)) * (_height)), \
+    .data_size = 0, \
+    .data = NULL,  \
+    .get_code_data = _func, \
+    .prefetch = _prefetch, \
+    .get_code_data_r = _func_r, \
+}
+
+/**
+ * @brief 定义比例字体的字形信息表
+ * 
+ */
+#define LCD_FONT_GLYPHS_DEFINE(_name) \
+static const lcd_font_glyph_t s_lcd_font_glyphs_##_name[] = 
+
+/**
+ * @brief 定义一个比例字体，需要先定义字体数据和字形信息表
+ * 
+ * @param _width 最大步进宽度
+ * @param _height 行高
+ * @param _first 第一个字符编码
+ */
+#define LCD_PROP_FONT_DEFINE(_name, _width, _height, _first) \
+const lcd_prop_font_t g_lcd_prop_font_##_name = { \
+    .font = { \
+        .name = #_name,  \
+        .width = _width, .height = _height, \
+        .code_size = 0, \
+        .data_size = sizeof(s_lcd_font_data_##_name), \
+        .data = s_lcd_font_data_##_name,  \
+        .get_code_data = lcd_font_get_prop_code, \
+        .get_glyph = lcd_font_get_prop_glyph, \
+    }, \
+    .first_char = _first, \
+    .glyph_count = sizeof(s_lcd_font_glyphs_##_name) / sizeof(lcd_font_glyph_t), \
+    .glyphs = s_lcd_font_glyphs_##_name, \
+}
+
+/**
+ * @brief 定义压缩字体的偏移表
+ * 
+ */
+#define LCD_FONT_OFFSETS_DEFINE(_name) \
+static const uint16_t s_lcd_font_offsets_##_name[] = 
+
+/**
+ * @brief 定义一个压缩字体，需要先定义字体数据和偏移表
+ * 
+ * @param _first 第一个字符编码
+ */
+#define LCD_RLE_FONT_DEFINE(_name, _width, _height, _first) \
+static uint8_t s_lcd_font_cache_data_##_name[CONFIG_LCD_FONT_RLE_CACHE_SLOTS * \
+    ((((_width) >> 3) + (((_width) & 0x7) ? 1 : 0)) * (_height))]; \
+static lcd_font_cache_t s_lcd_font_cache_##_name = { \
+    .data = s_lcd_font_cache_data_##_name, \
+}; \
+const lcd_rle_font_t g_lcd_rle_font_##_name = { \
+    .font = { \
+        .name = #_name,  \
+        .width = _width, .height = _height, \
+        .code_size = ((((_width) >> 3) + (((_width) & 0x7) ? 1 : 0)) * (_height)), \
+        .data_size = sizeof(s_lcd_font_data_##_name), \
+        .data = s_lcd_font_data_##_name,  \
+        .get_code_data = lcd_font_get_rle_code, \
+        .get_code_data_r = lcd_font_get_rle_code_r, \
+    }, \
+    .first_char = _first, \
+    .glyph_count = sizeof(s_lcd_font_offsets_##_name) / sizeof(uint16_t), \
+    .offsets = s_lcd_font_offsets_##_name, \
+    .cache = &s_lcd_font_cache_##_name, \
+}
+
+/**
+ * @brief 声明一个压缩字体
+ * 
+ */
+#define LCD_RLE_FONT_DECLARE(_name) \
+extern const lcd_rle_font_t g_lcd_rle_font_##_name 
+
+/**
+ * @brief 引用一个压缩字体，得到 lcd_font_t 指针
+ * 
+ */
+#define LCD_RLE_FONT(_name) (&g_lcd_rle_font_##_name.font)
+
+/**
+ * @brief 定义子集字体的字符编码表
+ * 
+ */
+#define LCD_FONT_CODES_DEFINE(_name) \
+static const uint16_t s_lcd_font_codes_##_name[] = 
+
+/**
+ * @brief 定义一个子集字体，需要先定义字体数据和字符编码表
+ * 
+ */
+#define LCD_SUBSET_FONT_DEFINE(_name, _width, _height) \
+const lcd_subset_font_t g_lcd_subset_font_##_name = { \
+    .font = { \
+        .name = #_name,  \
+        .width = _width, .height = _height, \
+        .code_size = ((((_width) >> 3) + (((_width) & 0x7) ? 1 : 0)) * (_height)), \
+        .data_size = sizeof(s_lcd_font_data_##_name), \
+        .data = s_lcd_font_data_##_name,  \
+        .get_code_data = lcd_font_get_subset_code, \
+    }, \
+    .glyph_count = sizeof(s_lcd_font_codes_##_name) / sizeof(uint16_t), \
+    .codes = s_lcd_font_codes_##_name, \
+}
+
+/**
+ * @brief 声明一个子集字体
+ * 
+ */
+#define LCD_SUBSET_FONT_DECLARE(_name) \
+extern const lcd_subset_font_t g_lcd_subset_font_##_name 
+
+/**
+ * @brief 引用一个子集字体，得到 lcd_font_t 指针
+ * 
+ */
+#define LCD_SUBSET_FONT(_name) (&g_lcd_subset_font_##_name.font)
+
+/// 放大后的尺寸
+#define LCD_FONT_SCALED_SIZE(_size, _scale) (((_scale) == LCD_FONT_SCALE_2X) ? (_size) * 2 : (_size) * 3 / 2)
+
+/**
+ * @brief 定义一个放大字体
+ * 
+ * @param _base 基础字体，如 LCD_FONT(hzk16)
+ * @param _base_width 基础字体的宽度
+ * @param _base_height 基础字体的高度
+ * @param _scale 放大倍数，lcd_font_scale_t
+ */
+#define LCD_SCALED_FONT_DEFINE(_name, _base, _base_width, _base_height, _scale) \
+static uint8_t s_lcd_font_scaled_buf_##_name[(LCD_FONT_SCALED_SIZE(_base_width, _scale) + 7) / 8 * \
+    LCD_FONT_SCALED_SIZE(_base_height, _scale)]; \
+const lcd_scaled_font_t g_lcd_scaled_font_##_name = { \
+    .font = { \
+        .name = #_name,  \
+        .width = LCD_FONT_SCALED_SIZE(_base_width, _scale), \
+        .height = LCD_FONT_SCALED_SIZE(_base_height, _scale), \
+        .code_size = sizeof(s_lcd_font_scaled_buf_##_name), \
+        .data_size = 0, \
+        .data = NULL,  \
+        .get_code_data = lcd_font_get_scaled_code, \
+        .prefetch = lcd_font_prefetch_scaled, \
+        .get_code_data_r = lcd_font_get_scaled_code_r, \
+    }, \
+    .base = _base, \
+    .scale = _scale, \
+    .buf = s_lcd_font_scaled_buf_##_name, \
+}
+
+/**
+ * @brief 声明一个放大字体
+ * 
+ */
+#define LCD_SCALED_FONT_DECLARE(_name) \
+extern const lcd_scaled_font_t g_lcd_scaled_font_##_name 
+
+/**
+ * @brief 引用一个放大字体，得到 lcd_font_t 指针
+ * 
+ */
+#define LCD_SCALED_FONT(_name) (&g_lcd_scaled_font_##_name.font)
+
+/**
+ * @brief 声明一个比例字体
+ * 
+ */
+#define LCD_PROP_FONT_DECLARE(_name) \
+extern const lcd_prop_font_t g_lcd_prop_font_##_name 
+
+/**
+ * @brief 引用一个比例字体，得到 lcd_font_t 指针
+ * 
+ */
+#define LCD_PROP_FONT(_name) (&g_lcd_prop_font_##_name.font)
+
 /**
  * @brief 声明一个字体
  * 
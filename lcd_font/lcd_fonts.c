@@ -10,6 +10,11 @@
  */
 
 #include "lcd_fonts.h"
+#include "lcd_font_event.h"
+#include <string.h>
+
+// 定义事件基础
+ESP_EVENT_DEFINE_BASE(LCD_FONT_EVENTS);
 
 /**
  * @brief 一般获取ASCII字库数据的方法
@@ -91,6 +96,436 @@ const uint8_t *lcd_font_get_ascii_number_code(const void *self, uint32_t ch)
 }
 
 
+/**
+ * @brief 设置缓存中从位偏移offs开始的连续count个位
+ * 
+ * @param buf 缓存，高位在左
+ * @param offs 起始位偏移
+ * @param count 位数
+ */
+static inline void set_bits(uint8_t *buf, uint32_t offs, uint32_t count)
+{
+    while (count > 0)
+    {
+        uint32_t head = offs & 0x07;
+        uint32_t bits = 8 - head;
+        if (bits > count)
+        {
+            bits = count;
+        }
+        buf[offs >> 3] |= (uint8_t)((0xFF >> head) & (0xFF << (8 - head - bits)));
+        offs += bits;
+        count -= bits;
+    }
+}
+
+/**
+ * @brief 解码一个游程编码的字形
+ * 
+ * @param src 编码数据
+ * @param size 编码数据长度
+ * @param width 字形宽度
+ * @param height 字形高度
+ * @param dst 输出，每行 (width + 7) / 8 字节，调用者已清0
+ * @return bool 数据是否完整
+ */
+static bool rle_decode_glyph(const uint8_t *src, uint32_t size, int width, int height, uint8_t *dst)
+{
+    uint32_t row_bytes = (width + 7) / 8;
+    uint32_t total = (uint32_t)width * height;
+    uint32_t px = 0;
+    uint32_t run = 0;
+    bool color = false;
+
+    // 4位码，高4位在前；15表示游程加15后继续，0-14表示游程结束，颜色从0开始交替
+    for (uint32_t pos = 0; pos < size * 2 && px < total; pos++)
+    {
+        uint8_t code = (pos & 0x01) ? (src[pos >> 1] & 0x0F) : (src[pos >> 1] >> 4);
+        run += code;
+        if (code == 15)
+        {
+            continue;
+        }
+
+        if (run > total - px)
+        {
+            return false;
+        }
+
+        // 游程可以跨行，行尾的填充位不在编码中
+        while (color && run > 0)
+        {
+            uint32_t x = px % width;
+            uint32_t seg = ((uint32_t)width - x < run) ? (uint32_t)width - x : run;
+            set_bits(dst, (px / width) * row_bytes * 8 + x, seg);
+            px += seg;
+            run -= seg;
+        }
+        px += run;
+        run = 0;
+        color = !color;
+    }
+
+    return px == total;
+}
+
+/**
+ * @brief 解码压缩字体的一个字形
+ * 
+ * @param f 压缩字体
+ * @param index 字形序号
+ * @param code 输出解码后的数据，code_size 字节
+ * @return bool 数据错误时返回false
+ */
+static bool decode_rle_font_glyph(const lcd_rle_font_t *f, uint32_t index, uint8_t *code)
+{
+    // 字形数据的长度由下一个偏移得到，最后一个字形到数据结尾
+    uint32_t start = f->offsets[index] & ~LCD_FONT_RLE_XOR_ROWS;
+    uint32_t end = (index + 1 < f->glyph_count) ? (f->offsets[index + 1] & ~LCD_FONT_RLE_XOR_ROWS) : f->font.data_size;
+    if (start > end || end > f->font.data_size)
+    {
+        return false;
+    }
+
+    if (end - start == f->font.code_size)
+    {
+        memcpy(code, &f->font.data[start], f->font.code_size);
+        return true;
+    }
+
+    memset(code, 0, f->font.code_size);
+    if (!rle_decode_glyph(&f->font.data[start], end - start, f->font.width, f->font.height, code))
+    {
+        return false;
+    }
+
+    // 编码前每行与上一行异或过，从上往下恢复
+    if (f->offsets[index] & LCD_FONT_RLE_XOR_ROWS)
+    {
+        uint32_t row_bytes = (f->font.width + 7) / 8;
+        for (uint32_t i = row_bytes; i < f->font.code_size; i++)
+        {
+            code[i] ^= code[i - row_bytes];
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief 获取压缩字体的字形数据，解码到缓存中
+ * 
+ * @param self 字体对象，lcd_rle_font_t
+ * @param ch 字符编码
+ * @return const uint8_t * 返回解码后的数据，code_size 字节，没有该字符或数据错误时返回NULL
+ */
+const uint8_t *lcd_font_get_rle_code(const void *self, uint32_t ch)
+{
+    const lcd_rle_font_t *f = (const lcd_rle_font_t *)self;
+    lcd_font_cache_t *cache = f->cache;
+
+    if (ch < f->first_char || ch - f->first_char >= f->glyph_count)
+    {
+        return NULL;
+    }
+
+    // 按字符编码直接映射到缓存槽
+    uint32_t index = ch - f->first_char;
+    uint32_t slot = index % CONFIG_LCD_FONT_RLE_CACHE_SLOTS;
+    uint8_t *code = &cache->data[slot * f->font.code_size];
+
+    if (cache->tags[slot] == ch + 1)
+    {
+        cache->hits++;
+        return code;
+    }
+
+    cache->misses++;
+    cache->tags[slot] = 0;
+
+    if (!decode_rle_font_glyph(f, index, code))
+    {
+        return NULL;
+    }
+
+    cache->tags[slot] = ch + 1;
+    return code;
+}
+
+/**
+ * @brief 获取压缩字体的字形数据，直接解码到调用者的缓冲区，不使用字体的解码缓存
+ * 
+ * @param self 字体对象，lcd_rle_font_t
+ * @param ch 字符编码
+ * @param buf 调用者的缓冲区，至少 code_size 字节
+ * @return const uint8_t * 返回buf，没有该字符或数据错误时返回NULL
+ * @note 可以在多个任务中同时调用
+ */
+const uint8_t *lcd_font_get_rle_code_r(const void *self, uint32_t ch, uint8_t *buf)
+{
+    const lcd_rle_font_t *f = (const lcd_rle_font_t *)self;
+
+    if (ch < f->first_char || ch - f->first_char >= f->glyph_count)
+    {
+        return NULL;
+    }
+
+    return decode_rle_font_glyph(f, ch - f->first_char, buf) ? buf : NULL;
+}
+
+// 2倍放大查找表：1个字节的8个像素 -> 16个像素
+#define SCALE_2X_BITS(b) \
+    ((((b) & 0x80) ? 0xC000 : 0) | (((b) & 0x40) ? 0x3000 : 0) | (((b) & 0x20) ? 0x0C00 : 0) | (((b) & 0x10) ? 0x0300 : 0) | \
+     (((b) & 0x08) ? 0x00C0 : 0) | (((b) & 0x04) ? 0x0030 : 0) | (((b) & 0x02) ? 0x000C : 0) | (((b) & 0x01) ? 0x0003 : 0))
+
+// 1.5倍放大查找表：1个字节的8个像素 -> 12个像素，每2个像素 (a, b) 放大为 (a, a|b, b)
+#define SCALE_1_5X_BITS(b) \
+    ((((b) & 0x80) ? 0x800 : 0) | (((b) & 0xC0) ? 0x400 : 0) | (((b) & 0x40) ? 0x200 : 0) | \
+     (((b) & 0x20) ? 0x100 : 0) | (((b) & 0x30) ? 0x080 : 0) | (((b) & 0x10) ? 0x040 : 0) | \
+     (((b) & 0x08) ? 0x020 : 0) | (((b) & 0x0C) ? 0x010 : 0) | (((b) & 0x04) ? 0x008 : 0) | \
+     (((b) & 0x02) ? 0x004 : 0) | (((b) & 0x03) ? 0x002 : 0) | (((b) & 0x01) ? 0x001 : 0))
+
+#define SCALE_LUT_ROW(_m, _n) \
+    _m(_n), _m(_n + 1), _m(_n + 2), _m(_n + 3), _m(_n + 4), _m(_n + 5), _m(_n + 6), _m(_n + 7), \
+    _m(_n + 8), _m(_n + 9), _m(_n + 10), _m(_n + 11), _m(_n + 12), _m(_n + 13), _m(_n + 14), _m(_n + 15)
+
+#define SCALE_LUT(_m) \
+    SCALE_LUT_ROW(_m, 0x00), SCALE_LUT_ROW(_m, 0x10), SCALE_LUT_ROW(_m, 0x20), SCALE_LUT_ROW(_m, 0x30), \
+    SCALE_LUT_ROW(_m, 0x40), SCALE_LUT_ROW(_m, 0x50), SCALE_LUT_ROW(_m, 0x60), SCALE_LUT_ROW(_m, 0x70), \
+    SCALE_LUT_ROW(_m, 0x80), SCALE_LUT_ROW(_m, 0x90), SCALE_LUT_ROW(_m, 0xA0), SCALE_LUT_ROW(_m, 0xB0), \
+    SCALE_LUT_ROW(_m, 0xC0), SCALE_LUT_ROW(_m, 0xD0), SCALE_LUT_ROW(_m, 0xE0), SCALE_LUT_ROW(_m, 0xF0)
+
+static const uint16_t s_scale_2x_lut[256] = { SCALE_LUT(SCALE_2X_BITS) };
+static const uint16_t s_scale_1_5x_lut[256] = { SCALE_LUT(SCALE_1_5X_BITS) };
+
+/**
+ * @brief 2倍放大字形，每行放大后写两次
+ * 
+ * @param src 基础字体的字形
+ * @param dst 输出，宽高都是基础字体的2倍
+ * @param width 基础字体宽度，8的整数倍
+ * @param height 基础字体高度
+ */
+static void scale_glyph_2x(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height)
+{
+    uint32_t src_row_bytes = width / 8;
+    uint32_t dst_row_bytes = src_row_bytes * 2;
+
+    for (uint32_t y = 0; y < height; y++)
+    {
+        for (uint32_t i = 0; i < src_row_bytes; i++)
+        {
+            uint16_t bits = s_scale_2x_lut[src[i]];
+            dst[i * 2] = bits >> 8;
+            dst[i * 2 + 1] = bits & 0xFF;
+        }
+        memcpy(dst + dst_row_bytes, dst, dst_row_bytes);
+
+        src += src_row_bytes;
+        dst += dst_row_bytes * 2;
+    }
+}
+
+/**
+ * @brief 1.5倍放大字形，每2行放大为3行，中间行为上下两行的与
+ * 
+ * @param src 基础字体的字形
+ * @param dst 输出，宽高都是基础字体的1.5倍
+ * @param width 基础字体宽度，16的整数倍
+ * @param height 基础字体高度，偶数
+ */
+static void scale_glyph_1_5x(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height)
+{
+    uint32_t src_row_bytes = width / 8;
+    uint32_t dst_row_bytes = src_row_bytes * 3 / 2;
+
+    for (uint32_t y = 0; y < height; y += 2)
+    {
+        const uint8_t *row0 = src;
+        const uint8_t *row1 = src + src_row_bytes;
+
+        // 每16个像素放大为24个像素，3个字节
+        for (uint32_t i = 0, j = 0; i < src_row_bytes; i += 2, j += 3)
+        {
+            uint32_t top = ((uint32_t)s_scale_1_5x_lut[row0[i]] << 12) | s_scale_1_5x_lut[row0[i + 1]];
+            uint32_t bottom = ((uint32_t)s_scale_1_5x_lut[row1[i]] << 12) | s_scale_1_5x_lut[row1[i + 1]];
+            uint32_t middle = top & bottom;
+
+            dst[j] = top >> 16;
+            dst[j + 1] = top >> 8;
+            dst[j + 2] = top;
+            dst[dst_row_bytes + j] = middle >> 16;
+            dst[dst_row_bytes + j + 1] = middle >> 8;
+            dst[dst_row_bytes + j + 2] = middle;
+            dst[dst_row_bytes * 2 + j] = bottom >> 16;
+            dst[dst_row_bytes * 2 + j + 1] = bottom >> 8;
+            dst[dst_row_bytes * 2 + j + 2] = bottom;
+        }
+
+        src += src_row_bytes * 2;
+        dst += dst_row_bytes * 3;
+    }
+}
+
+/**
+ * @brief 获取放大字体的字形数据，放大到调用者的缓冲区
+ * 
+ * @param self 字体对象，lcd_scaled_font_t
+ * @param ch 字符编码
+ * @param buf 调用者的缓冲区，至少 code_size 字节
+ * @return const uint8_t * 返回buf，基础字体中没有该字符时返回NULL
+ */
+const uint8_t *lcd_font_get_scaled_code_r(const void *self, uint32_t ch, uint8_t *buf)
+{
+    const lcd_scaled_font_t *f = (const lcd_scaled_font_t *)self;
+    const lcd_font_t *base = f->base;
+    uint8_t base_buf[LCD_FONT_SCALED_BASE_MAX_CODE_SIZE];
+
+    if (base->get_glyph || base->code_size > sizeof(base_buf))
+    {
+        return NULL;
+    }
+
+    const uint8_t *src = base->get_code_data_r ? base->get_code_data_r(base, ch, base_buf) : base->get_code_data(base, ch);
+    if (src == NULL)
+    {
+        return NULL;
+    }
+
+    if (f->scale == LCD_FONT_SCALE_2X)
+    {
+        if (base->width % 8 != 0)
+        {
+            return NULL;
+        }
+        scale_glyph_2x(src, buf, base->width, base->height);
+    }
+    else
+    {
+        if (base->width % 16 != 0 || base->height % 2 != 0)
+        {
+            return NULL;
+        }
+        scale_glyph_1_5x(src, buf, base->width, base->height);
+    }
+
+    return buf;
+}
+
+/**
+ * @brief 获取放大字体的字形数据，放大到字体的缓冲区中
+ * 
+ * @param self 字体对象，lcd_scaled_font_t
+ * @param ch 字符编码
+ * @return const uint8_t * 返回放大后的数据，code_size 字节，基础字体中没有该字符时返回NULL
+ */
+const uint8_t *lcd_font_get_scaled_code(const void *self, uint32_t ch)
+{
+    const lcd_scaled_font_t *f = (const lcd_scaled_font_t *)self;
+    return lcd_font_get_scaled_code_r(self, ch, f->buf);
+}
+
+/**
+ * @brief 预取放大字体的一组字符，转给基础字体
+ * 
+ * @param self 字体对象，lcd_scaled_font_t
+ * @param chars 字符编码数组
+ * @param count 字符数量
+ */
+void lcd_font_prefetch_scaled(const void *self, const uint32_t *chars, int count)
+{
+    const lcd_scaled_font_t *f = (const lcd_scaled_font_t *)self;
+    if (f->base->prefetch)
+    {
+        f->base->prefetch(f->base, chars, count);
+    }
+}
+
+/**
+ * @brief 获取子集字体的字形数据，二分查找字符编码
+ * 
+ * @param self 字体对象，lcd_subset_font_t
+ * @param ch 字符编码
+ * @return const uint8_t * 返回编码地址，code_size 字节，子集中没有该字符时返回NULL
+ */
+const uint8_t *lcd_font_get_subset_code(const void *self, uint32_t ch)
+{
+    const lcd_subset_font_t *f = (const lcd_subset_font_t *)self;
+    int left = 0;
+    int right = (int)f->glyph_count - 1;
+
+    while (left <= right)
+    {
+        int mid = (left + right) / 2;
+        if (f->codes[mid] == ch)
+        {
+            // 看看结束数据是否还在数据内
+            if ((uint32_t)(mid + 1) * f->font.code_size > f->font.data_size)
+            {
+                return NULL;
+            }
+            return &f->font.data[mid * f->font.code_size];
+        }
+
+        if (f->codes[mid] < ch)
+        {
+            left = mid + 1;
+        }
+        else
+        {
+            right = mid - 1;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief 获取比例字体的字形信息
+ * 
+ * @param self 字体对象，lcd_prop_font_t
+ * @param ch 字符编码
+ * @return const lcd_font_glyph_t * 字形信息，没有该字符时返回NULL
+ */
+const lcd_font_glyph_t *lcd_font_get_prop_glyph(const void *self, uint32_t ch)
+{
+    const lcd_prop_font_t *f = (const lcd_prop_font_t *)self;
+
+    if (ch < f->first_char || ch - f->first_char >= f->glyph_count)
+    {
+        return NULL;
+    }
+
+    return &f->glyphs[ch - f->first_char];
+}
+
+/**
+ * @brief 获取比例字体的字形位图
+ * 
+ * @param self 字体对象，lcd_prop_font_t
+ * @param ch 字符编码
+ * @return const uint8_t * 返回边界框内的位图，每行 (width + 7) / 8 字节，空白字符或没有该字符时返回NULL
+ */
+const uint8_t *lcd_font_get_prop_code(const void *self, uint32_t ch)
+{
+    const lcd_prop_font_t *f = (const lcd_prop_font_t *)self;
+    const lcd_font_glyph_t *glyph = lcd_font_get_prop_glyph(self, ch);
+
+    if (glyph == NULL || glyph->width == 0)
+    {
+        return NULL;
+    }
+
+    // 看看结束数据是否还在数据内
+    if (glyph->offset + (uint32_t)((glyph->width + 7) / 8) * glyph->height > f->font.data_size)
+    {
+        return NULL;
+    }
+
+    return &f->font.data[glyph->offset];
+}
+
+
 #if CONFIG_LCD_FONT_ASCII_8X8
 #include "fonts/font_8x8.c"
 #endif // CONFIG_LCD_FONT_ASCII_8X8
@@ -128,12 +563,70 @@ const uint8_t *lcd_font_get_ascii_number_code(const void *self, uint32_t ch)
 #endif // CONFIG_LCD_FONT_SEGMENT_NUMBER_24X32  
 
 
+#if CONFIG_LCD_FONT_8X16_RLE
+#include "fonts/font_8x16_rle.c"
+#endif // CONFIG_LCD_FONT_8X16_RLE
+
+#if CONFIG_LCD_FONT_10X18_RLE
+#include "fonts/font_10x18_rle.c"
+#endif // CONFIG_LCD_FONT_10X18_RLE
+
+#if CONFIG_LCD_FONT_SUN_12X22_RLE
+#include "fonts/font_sun_12x22_rle.c"
+#endif // CONFIG_LCD_FONT_SUN_12X22_RLE
+
+#if CONFIG_LCD_FONT_TER_16X32_RLE
+#include "fonts/font_ter_16x32_rle.c"
+#endif // CONFIG_LCD_FONT_TER_16X32_RLE
+
+#if CONFIG_LCD_FONT_CONSOLE_NUMBER_32X48_RLE
+#include "fonts/font_console_number_32x48_rle.c"
+#endif // CONFIG_LCD_FONT_CONSOLE_NUMBER_32X48_RLE
+
+#if CONFIG_LCD_FONT_SEGMENT_NUMBER_32X48_RLE
+#include "fonts/font_segment_number_32x48_rle.c"
+#endif // CONFIG_LCD_FONT_SEGMENT_NUMBER_32X48_RLE
+
+#if CONFIG_LCD_FONT_SEGMENT_NUMBER_24X32_RLE
+#include "fonts/font_segment_number_24x32_rle.c"
+#endif // CONFIG_LCD_FONT_SEGMENT_NUMBER_24X32_RLE
+
+#if CONFIG_LCD_FONT_SUN_ASCII_12X22_PROP
+#include "fonts/font_sun_12x22_prop.c"
+#endif // CONFIG_LCD_FONT_SUN_ASCII_12X22_PROP
+
+#if CONFIG_LCD_FONT_TER_ASCII_16X32_PROP
+#include "fonts/font_ter_16x32_prop.c"
+#endif // CONFIG_LCD_FONT_TER_ASCII_16X32_PROP
+
 #if CONFIG_LCD_FONT_HZK_16 || CONFIG_LCD_FONT_HZK_24
 #include "fonts_cn/font_hzk.c"
 #else 
 #define lcd_font_hzk_init() do { } while (0)
+
+int lcd_font_hzk_get_cache_stats(const lcd_font_t *font, lcd_font_hzk_cache_stats_t *stats)
+{
+    return -1;
+}
+
+int lcd_font_hzk_get_verify_status(const lcd_font_t *font, lcd_font_hzk_verify_status_t *status)
+{
+    return -1;
+}
 #endif // CONFIG_LCD_FONT_HZK_16 || CONFIG_LCD_FONT_HZK_24
 
+#if (CONFIG_LCD_FONT_HZK_16_X2 || CONFIG_LCD_FONT_HZK_16_X15) && !CONFIG_LCD_FONT_HZK_16
+#error "CONFIG_LCD_FONT_HZK_16_X2 and CONFIG_LCD_FONT_HZK_16_X15 require CONFIG_LCD_FONT_HZK_16"
+#endif
+
+#if CONFIG_LCD_FONT_HZK_16_X2
+LCD_SCALED_FONT_DEFINE(hzk16_x2, LCD_FONT(hzk16), 16, 16, LCD_FONT_SCALE_2X);
+#endif // CONFIG_LCD_FONT_HZK_16_X2
+
+#if CONFIG_LCD_FONT_HZK_16_X15
+LCD_SCALED_FONT_DEFINE(hzk16_x15, LCD_FONT(hzk16), 16, 16, LCD_FONT_SCALE_1_5X);
+#endif // CONFIG_LCD_FONT_HZK_16_X15
+
 
 /**
  * @brief 初始化字体
@@ -58,6 +58,51 @@ extern "C" {
 #define CONFIG_LCD_FONT_SEGMENT_NUMBER_24X32 0
 #endif
 
+/// 默认不启用ascii_8x16的压缩版本
+#ifndef CONFIG_LCD_FONT_8X16_RLE
+#define CONFIG_LCD_FONT_8X16_RLE 0
+#endif
+
+/// 默认不启用ascii_10x18的压缩版本
+#ifndef CONFIG_LCD_FONT_10X18_RLE
+#define CONFIG_LCD_FONT_10X18_RLE 0
+#endif
+
+/// 默认不启用sun_ascii_12x22的压缩版本
+#ifndef CONFIG_LCD_FONT_SUN_12X22_RLE
+#define CONFIG_LCD_FONT_SUN_12X22_RLE 0
+#endif
+
+/// 默认不启用ter_ascii_16x32的压缩版本
+#ifndef CONFIG_LCD_FONT_TER_16X32_RLE
+#define CONFIG_LCD_FONT_TER_16X32_RLE 0
+#endif
+
+/// 默认不启用console_number_32x48的压缩版本
+#ifndef CONFIG_LCD_FONT_CONSOLE_NUMBER_32X48_RLE
+#define CONFIG_LCD_FONT_CONSOLE_NUMBER_32X48_RLE 0
+#endif
+
+/// 默认不启用segment_number_32x48的压缩版本
+#ifndef CONFIG_LCD_FONT_SEGMENT_NUMBER_32X48_RLE
+#define CONFIG_LCD_FONT_SEGMENT_NUMBER_32X48_RLE 0
+#endif
+
+/// 默认不启用segment_number_24x32的压缩版本
+#ifndef CONFIG_LCD_FONT_SEGMENT_NUMBER_24X32_RLE
+#define CONFIG_LCD_FONT_SEGMENT_NUMBER_24X32_RLE 0
+#endif
+
+/// 默认不启用sun_ascii_12x22的比例字体版本
+#ifndef CONFIG_LCD_FONT_SUN_ASCII_12X22_PROP
+#define CONFIG_LCD_FONT_SUN_ASCII_12X22_PROP 0
+#endif
+
+/// 默认不启用ter_ascii_16x32的比例字体版本
+#ifndef CONFIG_LCD_FONT_TER_ASCII_16X32_PROP
+#define CONFIG_LCD_FONT_TER_ASCII_16X32_PROP 0
+#endif
+
 /// 默认不启用HZK字体16
 #ifndef CONFIG_LCD_FONT_HZK_16
 #define CONFIG_LCD_FONT_HZK_16 0
@@ -68,6 +113,66 @@ extern "C" {
 #define CONFIG_LCD_FONT_HZK_24 0
 #endif
 
+/// 默认不启用由hzk16放大2倍得到的32*32汉字字体，需要启用 CONFIG_LCD_FONT_HZK_16
+#ifndef CONFIG_LCD_FONT_HZK_16_X2
+#define CONFIG_LCD_FONT_HZK_16_X2 0
+#endif
+
+/// 默认不启用由hzk16放大1.5倍得到的24*24汉字字体，可以代替hzk24，需要启用 CONFIG_LCD_FONT_HZK_16
+#ifndef CONFIG_LCD_FONT_HZK_16_X15
+#define CONFIG_LCD_FONT_HZK_16_X15 0
+#endif
+
+/// 默认通过 esp_partition_mmap 映射汉字库，字形直接从Flash地址读取，映射失败时使用分区读取和字形缓存
+#ifndef CONFIG_LCD_FONT_HZK_USE_MMAP
+#define CONFIG_LCD_FONT_HZK_USE_MMAP 1
+#endif
+
+/// 每个汉字库的LRU字形缓存项数，没有映射时使用，hzk16每项32字节，hzk24每项72字节
+#ifndef CONFIG_LCD_FONT_HZK_CACHE_SIZE
+#define CONFIG_LCD_FONT_HZK_CACHE_SIZE 32
+#endif
+
+/// 预取时合并读取的缓冲区大小，没有映射时使用
+#ifndef CONFIG_LCD_FONT_HZK_PREFETCH_BUF_SIZE
+#define CONFIG_LCD_FONT_HZK_PREFETCH_BUF_SIZE 1024
+#endif
+
+/// 预取时两个字符数据之间的间隔不超过该字节数时合并为一次读取
+#ifndef CONFIG_LCD_FONT_HZK_PREFETCH_GAP
+#define CONFIG_LCD_FONT_HZK_PREFETCH_GAP 256
+#endif
+
+/// 预取时每批排序合并的字符数，在调用者的栈上，字符较多时分批读取
+#ifndef CONFIG_LCD_FONT_HZK_PREFETCH_BATCH
+#define CONFIG_LCD_FONT_HZK_PREFETCH_BATCH 16
+#endif
+
+/// 加载汉字库后在低优先级任务中分块校验字体数据的CRC32，校验期间字体可以正常使用
+#ifndef CONFIG_LCD_FONT_HZK_VERIFY
+#define CONFIG_LCD_FONT_HZK_VERIFY 1
+#endif
+
+/// 后台校验每次计算的字节数
+#ifndef CONFIG_LCD_FONT_HZK_VERIFY_CHUNK_SIZE
+#define CONFIG_LCD_FONT_HZK_VERIFY_CHUNK_SIZE 4096
+#endif
+
+/// 后台校验每块之间的间隔（毫秒），让出CPU和Flash给其他任务
+#ifndef CONFIG_LCD_FONT_HZK_VERIFY_INTERVAL_MS
+#define CONFIG_LCD_FONT_HZK_VERIFY_INTERVAL_MS 10
+#endif
+
+/// 后台校验任务的优先级
+#ifndef CONFIG_LCD_FONT_HZK_VERIFY_TASK_PRIORITY
+#define CONFIG_LCD_FONT_HZK_VERIFY_TASK_PRIORITY 1
+#endif
+
+/// 后台校验任务的栈大小
+#ifndef CONFIG_LCD_FONT_HZK_VERIFY_TASK_STACK_SIZE
+#define CONFIG_LCD_FONT_HZK_VERIFY_TASK_STACK_SIZE 3072
+#endif
+
 
 /// ASCII字符 8*8
 LCD_FONT_DECLARE(ascii_8x8);
@@ -96,12 +201,45 @@ LCD_FONT_DECLARE(segment_number_32x48);
 /// 大号的数字 24*32 
 LCD_FONT_DECLARE(segment_number_24x32); 
 
+/// 压缩字体，ASCII字符 8*16，使用 LCD_RLE_FONT(ascii_8x16_rle) 引用
+LCD_RLE_FONT_DECLARE(ascii_8x16_rle);
+
+/// 压缩字体，ASCII字符 10*18，使用 LCD_RLE_FONT(ascii_10x18_rle) 引用
+LCD_RLE_FONT_DECLARE(ascii_10x18_rle);
+
+/// 压缩字体，ASCII字符 12*22，使用 LCD_RLE_FONT(sun_ascii_12x22_rle) 引用
+LCD_RLE_FONT_DECLARE(sun_ascii_12x22_rle);
+
+/// 压缩字体，ASCII字符 16*32，使用 LCD_RLE_FONT(ter_ascii_16x32_rle) 引用
+LCD_RLE_FONT_DECLARE(ter_ascii_16x32_rle);
+
+/// 压缩字体，大号的数字 32*48，使用 LCD_RLE_FONT(console_number_32x48_rle) 引用
+LCD_RLE_FONT_DECLARE(console_number_32x48_rle);
+
+/// 压缩字体，大号的数字 32*48，使用 LCD_RLE_FONT(segment_number_32x48_rle) 引用
+LCD_RLE_FONT_DECLARE(segment_number_32x48_rle);
+
+/// 压缩字体，大号的数字 24*32，使用 LCD_RLE_FONT(segment_number_24x32_rle) 引用
+LCD_RLE_FONT_DECLARE(segment_number_24x32_rle);
+
+/// 比例字体，sun_ascii_12x22 裁剪空白，使用 LCD_PROP_FONT(sun_ascii_12x22_prop) 引用
+LCD_PROP_FONT_DECLARE(sun_ascii_12x22_prop);
+
+/// 比例字体，ter_ascii_16x32 裁剪空白，使用 LCD_PROP_FONT(ter_ascii_16x32_prop) 引用
+LCD_PROP_FONT_DECLARE(ter_ascii_16x32_prop);
+
 /// HZK字体16*16
 LCD_FONT_DECLARE(hzk16);
 
 /// HZK字体24*24
 LCD_FONT_DECLARE(hzk24);
 
+/// 由hzk16放大2倍的32*32汉字字体，使用 LCD_SCALED_FONT(hzk16_x2) 引用
+LCD_SCALED_FONT_DECLARE(hzk16_x2);
+
+/// 由hzk16放大1.5倍的24*24汉字字体，使用 LCD_SCALED_FONT(hzk16_x15) 引用
+LCD_SCALED_FONT_DECLARE(hzk16_x15);
+
 /**
  * @brief 初始化汉字库
  * 
@@ -109,6 +247,59 @@ LCD_FONT_DECLARE(hzk24);
  */
 void lcd_font_init(void);
 
+/**
+ * @brief 汉字库字形缓存的统计信息
+ */
+typedef struct {
+    uint32_t hits;      ///< 命中次数
+    uint32_t misses;    ///< 未命中次数（需要读Flash）
+    uint16_t capacity;  ///< 缓存项数
+    uint16_t used;      ///< 已使用的缓存项数
+    bool mapped;        ///< 字体数据已映射，不使用字形缓存
+    uint32_t flash_reads; ///< 读取分区的次数
+} lcd_font_hzk_cache_stats_t;
+
+/**
+ * @brief 获取汉字库字形缓存的统计信息
+ * 
+ * @param font 汉字库字体，LCD_FONT(hzk16) 或 LCD_FONT(hzk24)
+ * @param stats 输出统计信息
+ * @return int 成功返回0，字体不是汉字库或未加载返回-1
+ */
+int lcd_font_hzk_get_cache_stats(const lcd_font_t *font, lcd_font_hzk_cache_stats_t *stats);
+
+/**
+ * @brief 汉字库字体数据的校验状态
+ */
+typedef enum {
+    LCD_FONT_HZK_VERIFY_NONE = 0,   ///< 未开始校验
+    LCD_FONT_HZK_VERIFY_RUNNING,    ///< 正在后台校验
+    LCD_FONT_HZK_VERIFY_OK,         ///< 校验通过
+    LCD_FONT_HZK_VERIFY_MISMATCH,   ///< CRC32不匹配，字库数据损坏
+    LCD_FONT_HZK_VERIFY_ERROR,      ///< 读取分区或分配内存失败，未完成校验
+} lcd_font_hzk_verify_state_t;
+
+/**
+ * @brief 汉字库字体数据的校验进度
+ */
+typedef struct {
+    lcd_font_hzk_verify_state_t state;
+    uint32_t verified;      ///< 已校验的字节数
+    uint32_t total;         ///< 字体数据的字节数
+    uint32_t expected;      ///< 头部中的CRC32
+    uint32_t calculated;    ///< 计算得到的CRC32，校验完成后有效
+} lcd_font_hzk_verify_status_t;
+
+/**
+ * @brief 获取汉字库字体数据的校验状态
+ * 
+ * @param font 汉字库字体，LCD_FONT(hzk16) 或 LCD_FONT(hzk24)
+ * @param status 输出校验状态
+ * @return int 成功返回0，字体不是汉字库或未加载返回-1
+ * @note 校验完成或失败时还会发送 LCD_FONT_EVENTS 事件，见 lcd_font_event.h
+ */
+int lcd_font_hzk_get_verify_status(const lcd_font_t *font, lcd_font_hzk_verify_status_t *status);
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,591 @@
+#!/usr/bin/env python3
+"""
+点阵字体转换工具
+1. 将 lcd_font/fonts 中的等宽字体按字形边界框裁剪，生成比例字体（lcd_prop_font_t）
+2. 将 lcd_font/fonts 中的等宽字体用游程编码压缩，生成压缩字体（lcd_rle_font_t）
+3. 从等宽字体或HZK汉字库中提取用到的字符，生成子集字体（lcd_subset_font_t）
+"""
+
+import os
+import re
+import sys
+import struct
+import argparse
+from typing import List, Optional, Tuple
+
+from lcd_img_packer import MonoImage, rle_encode, rle_decode
+
+# 匹配字体数据定义: LCD_FONT_DATA_DEFINE(name) { ... };
+DATA_DEFINE_PATTERN = re.compile(r'LCD_FONT_DATA_DEFINE\(\s*(\w+)\s*\)\s*\{(.*?)\};', re.S)
+
+# 匹配字体定义: LCD_ASCII_FONT_DEFINE(name, width, height);
+FONT_DEFINE_PATTERN = re.compile(
+    r'LCD_(ASCII|ASCII_NUMBER)_FONT_DEFINE\(\s*(\w+)\s*,\s*(\d+)\s*,\s*(\d+)\s*\)')
+
+COMMENT_PATTERN = re.compile(r'/\*.*?\*/|//[^\n]*', re.S)
+HEX_PATTERN = re.compile(r'0[xX][0-9a-fA-F]+')
+
+# lcd_font_glyph_t.offset 为 uint16_t
+MAX_DATA_SIZE = 0x10000
+
+# 压缩字体偏移表的最高位为 LCD_FONT_RLE_XOR_ROWS
+RLE_XOR_ROWS = 0x8000
+MAX_RLE_DATA_SIZE = 0x8000
+
+# hzk_header.h 中的 hzk_header_t
+HZK_MAGIC = 0x314B5A48
+HZK_MAGIC_V2 = 0x324B5A48
+HZK_HEADER_SIZE = 64
+
+# 扩展ASCII部分的条件编译
+EXTENDED_BEGIN = '#if CONFIG_LCD_FONT_EXTENDED_ASCII'
+EXTENDED_END = '#endif // CONFIG_LCD_FONT_EXTENDED_ASCII'
+
+# 扩展ASCII部分(0x80 - 0xFF)按代码页437排列, Unicode -> 字符编码
+CP437_CODES = {ord(bytes([i]).decode('cp437')): i for i in range(0x80, 0x100)}
+
+
+class BitmapFont:
+    """等宽点阵字体, 每个字符 code_size 字节, 每行 (width + 7) // 8 字节, 高位在左"""
+
+    def __init__(self, name: str, width: int, height: int, first_char: int, data: bytes):
+        self.name = name
+        self.width = width
+        self.height = height
+        self.first_char = first_char
+        self.row_bytes = (width + 7) // 8
+        self.code_size = self.row_bytes * height
+        self.count = len(data) // self.code_size
+        self.data = data
+
+    def glyph(self, ch: int) -> Optional[bytes]:
+        index = ch - self.first_char
+        if index < 0 or index >= self.count:
+            return None
+        return self.data[index * self.code_size:(index + 1) * self.code_size]
+
+    def glyph_by_unicode(self, ch: int) -> Optional[bytes]:
+        """按Unicode查找, 0x80以上的字符先转换为代码页437的编码, 不在代码页437中时返回None"""
+        if ch >= 0x80:
+            ch = CP437_CODES.get(ch)
+            if ch is None:
+                return None
+        return self.glyph(ch)
+
+    def pixel(self, bitmap: bytes, x: int, y: int) -> int:
+        return (bitmap[y * self.row_bytes + (x >> 3)] >> (7 - (x & 7))) & 1
+
+
+class Glyph:
+    """比例字体中的一个字形, bitmap 只包含边界框内的像素"""
+
+    def __init__(self, ch: int, width: int, height: int, x_offset: int, y_offset: int, advance: int, bitmap: bytes):
+        self.ch = ch
+        self.width = width
+        self.height = height
+        self.x_offset = x_offset
+        self.y_offset = y_offset
+        self.advance = advance
+        self.bitmap = bitmap
+
+
+def parse_font_file(path: str, include_extended: bool = False) -> BitmapFont:
+    """解析 lcd_font/fonts 中的字体源文件"""
+    with open(path, 'r', encoding='utf-8') as f:
+        text = f.read()
+
+    m = FONT_DEFINE_PATTERN.search(text)
+    d = DATA_DEFINE_PATTERN.search(text)
+    if not m or not d:
+        raise ValueError(f"No font definition found in '{path}'")
+
+    body = d.group(2)
+    if not include_extended:
+        # 扩展ASCII部分在 #ifdef CONFIG_LCD_FONT_EXTENDED_ASCII 中
+        body = re.split(r'#\s*if(?:def)?\s+CONFIG_LCD_FONT_EXTENDED_ASCII', body)[0]
+    body = re.sub(r'#[^\n]*', '', COMMENT_PATTERN.sub('', body))
+    data = bytes(int(v, 16) for v in HEX_PATTERN.findall(body))
+
+    first_char = ord('0') if m.group(1) == 'ASCII_NUMBER' else 0
+    return BitmapFont(m.group(2), int(m.group(3)), int(m.group(4)), first_char, data)
+
+
+def char_comment(ch: int) -> str:
+    if 0x20 < ch < 0x7F and chr(ch) not in '\\\'*/':
+        return f"'{chr(ch)}'"
+    return f"0x{ch:02X}"
+
+
+def trim_glyph(font: BitmapFont, ch: int, spacing: int, monospace: bool) -> Glyph:
+    """
+    按边界框裁剪一个字形
+
+    Args:
+        font: 源字体
+        ch: 字符编码
+        spacing: 比例字体中字符之间的间距
+        monospace: 保持原来的字符单元宽度和水平位置
+    """
+    bitmap = font.glyph(ch)
+    xs = [x for x in range(font.width) for y in range(font.height) if font.pixel(bitmap, x, y)]
+    ys = [y for y in range(font.height) for x in range(font.width) if font.pixel(bitmap, x, y)]
+
+    if not xs:
+        # 空白字符，只有步进宽度
+        advance = font.width if monospace else max(font.width // 2, 1)
+        return Glyph(ch, 0, 0, 0, 0, advance, b'')
+
+    x0, x1 = min(xs), max(xs) + 1
+    y0, y1 = min(ys), max(ys) + 1
+    w, h = x1 - x0, y1 - y0
+
+    row_bytes = (w + 7) // 8
+    out = bytearray(row_bytes * h)
+    for y in range(h):
+        for x in range(w):
+            if font.pixel(bitmap, x0 + x, y0 + y):
+                out[y * row_bytes + (x >> 3)] |= 0x80 >> (x & 7)
+
+    if monospace:
+        return Glyph(ch, w, h, x0, y0, font.width, bytes(out))
+
+    # 比例字体左边留出一半间距
+    return Glyph(ch, w, h, spacing // 2, y0, w + spacing, bytes(out))
+
+
+def format_bytes(data: bytes, indent: str = '\t', per_line: int = 16) -> List[str]:
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ', '.join(f'0x{b:02x}' for b in data[i:i + per_line]) + ',')
+    return lines
+
+
+def write_prop_font(path: str, name: str, source: BitmapFont, glyphs: List[Glyph], first_char: int) -> int:
+    """生成比例字体源文件, 返回字体数据大小"""
+    data = bytearray()
+    offsets = []
+    for g in glyphs:
+        offsets.append(len(data) if g.bitmap else 0)
+        data += g.bitmap
+
+    if len(data) > MAX_DATA_SIZE:
+        raise ValueError(f"Font data too large: {len(data)} > {MAX_DATA_SIZE}")
+
+    width = max(g.advance for g in glyphs)
+    lines = [
+        '',
+        '#include "lcd_font_type.h"',
+        '',
+        '/**',
+        f' * @brief 字体名称 {name}',
+        f' * 由 lcd_font_packer.py --trim 从 {source.name} 生成，请勿手工修改',
+        ' * ',
+        ' */',
+        f'LCD_FONT_DATA_DEFINE({name})',
+        '{',
+    ]
+    for g, offset in zip(glyphs, offsets):
+        if g.bitmap:
+            body = format_bytes(g.bitmap)
+            body[-1] += f'\t/* {char_comment(g.ch)} */'
+            lines += body
+    lines += [
+        '};',
+        '',
+        '/// offset, width, height, x_offset, y_offset, advance, reserved',
+        f'LCD_FONT_GLYPHS_DEFINE({name})',
+        '{',
+    ]
+    for g, offset in zip(glyphs, offsets):
+        lines.append(f'\t{{{offset}, {g.width}, {g.height}, {g.x_offset}, {g.y_offset}, {g.advance}, 0}},'
+                     f'\t/* {char_comment(g.ch)} */')
+    lines += [
+        '};',
+        '',
+        '',
+        f'LCD_PROP_FONT_DEFINE({name}, {width}, {source.height}, 0x{first_char:02X});',
+        '',
+    ]
+
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write('\n'.join(lines))
+
+    return len(data)
+
+
+def trim_font(input_file: str, output_file: str, name: Optional[str], first_char: int, last_char: int,
+              spacing: Optional[int], monospace: bool) -> bool:
+    """裁剪字体并生成比例字体源文件"""
+    try:
+        font = parse_font_file(input_file, include_extended=last_char > 0x7F)
+    except (OSError, ValueError) as e:
+        print(f"Error: {e}")
+        return False
+
+    first_char = max(first_char, font.first_char)
+    last_char = min(last_char, font.first_char + font.count - 1)
+    if first_char > last_char:
+        print(f"Error: No glyphs in range of font '{font.name}'")
+        return False
+
+    if spacing is None:
+        spacing = max(font.width // 8, 1)
+
+    glyphs = [trim_glyph(font, ch, spacing, monospace) for ch in range(first_char, last_char + 1)]
+    name = name or f'{font.name}_prop'
+
+    try:
+        data_size = write_prop_font(output_file, name, font, glyphs, first_char)
+    except (OSError, ValueError) as e:
+        print(f"Error: {e}")
+        return False
+
+    # 字形信息每个8字节
+    count = len(glyphs)
+    raw_size = count * font.code_size
+    prop_size = data_size + count * 8
+    raw_pixels = count * font.width * font.height
+    prop_pixels = sum(g.width * g.height for g in glyphs)
+
+    print(f"Font '{font.name}' {font.width}x{font.height} -> '{name}' ({os.path.basename(output_file)})")
+    print(f"  Glyphs:       {count} (0x{first_char:02X} - 0x{last_char:02X})")
+    print(f"  Flash:        {raw_size} -> {prop_size} bytes ({prop_size * 100 / raw_size:.1f}%)")
+    print(f"  Pixels:       {raw_pixels} -> {prop_pixels} ({prop_pixels * 100 / raw_pixels:.1f}%)")
+    return True
+
+
+def xor_rows(bitmap: bytes, row_bytes: int) -> bytes:
+    """每行与上一行异或, 竖直的笔画变成0, 游程更长"""
+    out = bytearray(bitmap)
+    for i in range(len(out) - 1, row_bytes - 1, -1):
+        out[i] ^= bitmap[i - row_bytes]
+    return bytes(out)
+
+
+def encode_glyph(font: BitmapFont, bitmap: bytes) -> Tuple[int, bytes]:
+    """
+    压缩一个字形, 在原始数据、游程编码、按行异或后游程编码中选最短的
+
+    Returns:
+        (标志, 数据), 数据长度等于 code_size 时为原始数据
+    """
+    candidates = [(0, bitmap)]
+    for flag, src in ((0, bitmap), (RLE_XOR_ROWS, xor_rows(bitmap, font.row_bytes))):
+        data = rle_encode(MonoImage('glyph', font.width, font.height, src))
+        # 与原始数据等长时无法区分, 只在更短时使用
+        if len(data) < font.code_size:
+            candidates.append((flag, data))
+
+    flag, data = min(candidates, key=lambda c: len(c[1]))
+
+    # 校验, 填充位在编码中丢失, 与去掉填充位的原始数据比较
+    if len(data) != font.code_size:
+        decoded = bytearray(rle_decode(data, font.width, font.height))
+        if flag & RLE_XOR_ROWS:
+            for i in range(font.row_bytes, len(decoded)):
+                decoded[i] ^= decoded[i - font.row_bytes]
+        mask = (0xFF << ((8 - font.width % 8) % 8)) & 0xFF
+        expected = bytes(b & mask if (i % font.row_bytes) == font.row_bytes - 1 else b
+                         for i, b in enumerate(bitmap))
+        if bytes(decoded) != expected:
+            raise ValueError("RLE verification failed")
+
+    return flag, data
+
+
+def write_rle_font(path: str, name: str, source: BitmapFont, base_count: int, encoded: List[Tuple[int, bytes]]) -> int:
+    """生成压缩字体源文件, 返回字体数据大小"""
+    data_size = sum(len(d) for _, d in encoded)
+    if data_size > MAX_RLE_DATA_SIZE:
+        raise ValueError(f"Font data too large: {data_size} > {MAX_RLE_DATA_SIZE}")
+
+    lines = [
+        '',
+        '#include "lcd_font_type.h"',
+        '',
+        '/**',
+        f' * @brief 字体名称 {name}',
+        f' * 由 lcd_font_packer.py --rle 从 {source.name} 生成，请勿手工修改',
+        ' * ',
+        ' */',
+        f'LCD_FONT_DATA_DEFINE({name})',
+        '{',
+    ]
+    for i, (flag, data) in enumerate(encoded):
+        if i == base_count:
+            lines.append(EXTENDED_BEGIN)
+        body = format_bytes(data)
+        body[-1] += f'\t/* {source.first_char + i} */'
+        lines += body
+    if len(encoded) > base_count:
+        lines.append(EXTENDED_END)
+    lines += [
+        '};',
+        '',
+        '/// 低15位为偏移，最高位为1表示按行异或后编码',
+        f'LCD_FONT_OFFSETS_DEFINE({name})',
+        '{',
+    ]
+
+    offset = 0
+    for i, (flag, data) in enumerate(encoded):
+        if i == base_count:
+            lines.append(EXTENDED_BEGIN)
+        lines.append(f'\t0x{offset | flag:04x},\t/* {source.first_char + i} */')
+        offset += len(data)
+    if len(encoded) > base_count:
+        lines.append(EXTENDED_END)
+    lines += [
+        '};',
+        '',
+        '',
+        f'LCD_RLE_FONT_DEFINE({name}, {source.width}, {source.height}, {source.first_char});',
+        '',
+    ]
+
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write('\n'.join(lines))
+
+    return data_size
+
+
+def compress_font(input_file: str, output_file: Optional[str], name: Optional[str]) -> bool:
+    """压缩字体, output_file 为空时只输出统计"""
+    try:
+        font = parse_font_file(input_file, include_extended=True)
+        base_count = parse_font_file(input_file).count
+        encoded = [encode_glyph(font, font.glyph(font.first_char + i)) for i in range(font.count)]
+    except (OSError, ValueError) as e:
+        print(f"Error: {input_file}: {e}")
+        return False
+
+    name = name or f'{font.name}_rle'
+    if output_file:
+        try:
+            write_rle_font(output_file, name, font, base_count, encoded)
+        except (OSError, ValueError) as e:
+            print(f"Error: {e}")
+            return False
+
+    # 分别统计基本部分和全部，偏移表每个2字节
+    for count in sorted({base_count, font.count}):
+        raw_size = count * font.code_size
+        rle_size = sum(len(d) for _, d in encoded[:count]) + count * 2
+        modes = [0, 0, 0]
+        for flag, data in encoded[:count]:
+            modes[0 if len(data) == font.code_size else (2 if flag else 1)] += 1
+        print(f"{font.name:24} {font.width:2}x{font.height:<2} glyphs {count:3}: "
+              f"{raw_size:6} -> {rle_size:6} bytes ({rle_size * 100 / raw_size:5.1f}%)  "
+              f"raw/rle/xor {modes[0]}/{modes[1]}/{modes[2]}")
+    return True
+
+
+class HzkFont:
+    """GB2312顺序的HZK汉字库, 可以带 hzk_header_t; 也支持按Unicode排序的HZK2"""
+
+    def __init__(self, path: str, width: int = 16, height: int = 16):
+        with open(path, 'rb') as f:
+            data = f.read()
+
+        offset = 0
+        self.index = None
+        magic = struct.unpack_from('<I', data)[0] if len(data) >= HZK_HEADER_SIZE else 0
+        if magic in (HZK_MAGIC, HZK_MAGIC_V2):
+            _, width, height, code_size, offset, size = struct.unpack_from('<6I', data)
+            if magic == HZK_MAGIC_V2:
+                # 与 hzk_header.h 中的索引结构相同
+                _, page_count, index_offset, _, _ = struct.unpack_from('<5I', data, 28)
+                blocks = page_count * 8
+                page_index = data[index_offset:index_offset + 256]
+                bits = struct.unpack_from(f'<{blocks}I', data, index_offset + 256)
+                base = struct.unpack_from(f'<{blocks}H', data, index_offset + 256 + blocks * 4)
+                self.index = (page_index, bits, base)
+            data = data[:offset + size]
+
+        self.name = os.path.splitext(os.path.basename(path))[0]
+        self.width = width
+        self.height = height
+        self.row_bytes = (width + 7) // 8
+        self.code_size = self.row_bytes * height
+        self.data = data[offset:]
+        self.count = len(self.data) // self.code_size
+
+    def glyph(self, ch: int) -> Optional[bytes]:
+        if self.index:
+            return self.glyph_by_unicode(ch)
+
+        try:
+            gb = chr(ch).encode('gb2312')
+        except UnicodeEncodeError:
+            return None
+        if len(gb) != 2 or gb[0] < 0xA1 or gb[1] < 0xA1:
+            return None
+
+        # 与 font_hzk.c 中的计算相同
+        index = (gb[0] - 0xA1) * 94 + (gb[1] - 0xA1)
+        if index >= self.count:
+            return None
+        return self.data[index * self.code_size:(index + 1) * self.code_size]
+
+    def glyph_by_unicode(self, ch: int) -> Optional[bytes]:
+        """HZK2按Unicode索引查找, 与 font_hzk.c 中的计算相同"""
+        page_index, bits, base = self.index
+        if ch > 0xFFFF or page_index[ch >> 8] == 0xFF:
+            return None
+        block = page_index[ch >> 8] * 8 + ((ch >> 5) & 7)
+        bit = 1 << (ch & 31)
+        if not bits[block] & bit:
+            return None
+
+        index = base[block] + bin(bits[block] & (bit - 1)).count('1')
+        if index >= self.count:
+            return None
+        return self.data[index * self.code_size:(index + 1) * self.code_size]
+
+
+def parse_codepoints(text: str) -> List[int]:
+    """解析字符编码列表, 如 "0x30-0x39,U+4E2D,65" """
+    codes = []
+    for item in filter(None, (v.strip() for v in text.split(','))):
+        bounds = [int(v[2:], 16) if v[:2].upper() == 'U+' else int(v, 0) for v in item.split('-', 1)]
+        codes += range(bounds[0], bounds[-1] + 1)
+    return codes
+
+
+def collect_chars(texts: List[str], files: List[str], codepoints: List[str]) -> List[int]:
+    """收集用到的字符, 去掉控制字符, 升序排列"""
+    chars = set()
+    for text in texts:
+        chars.update(ord(c) for c in text)
+    for path in files:
+        with open(path, 'r', encoding='utf-8') as f:
+            chars.update(ord(c) for c in f.read())
+    for text in codepoints:
+        chars.update(parse_codepoints(text))
+    return sorted(c for c in chars if c >= 0x20 and c != 0x7F)
+
+
+def subset_font(input_file: str, output_file: str, name: Optional[str], chars: List[int]) -> bool:
+    """提取字体中用到的字符, 生成子集字体源文件"""
+    try:
+        if input_file.endswith('.c'):
+            font = parse_font_file(input_file, include_extended=True)
+            lookup = font.glyph_by_unicode
+        else:
+            font = HzkFont(input_file)
+            lookup = font.glyph
+    except (OSError, ValueError) as e:
+        print(f"Error: {e}")
+        return False
+
+    glyphs = []
+    missing = []
+    for ch in chars:
+        bitmap = lookup(ch) if ch <= 0xFFFF else None
+        if bitmap is None:
+            missing.append(ch)
+        else:
+            glyphs.append((ch, bitmap))
+
+    if not glyphs:
+        print(f"Error: None of the {len(chars)} chars is in font '{font.name}'")
+        return False
+
+    name = name or f'{font.name}_subset'
+    lines = [
+        '',
+        '#include "lcd_font_type.h"',
+        '',
+        '/**',
+        f' * @brief 字体名称 {name}',
+        f' * 由 lcd_font_packer.py --subset 从 {font.name} 生成，请勿手工修改',
+        ' * ',
+        ' */',
+        f'LCD_FONT_DATA_DEFINE({name})',
+        '{',
+    ]
+    for ch, bitmap in glyphs:
+        body = format_bytes(bitmap)
+        body[-1] += f'\t/* U+{ch:04X} {chr(ch) if chr(ch) not in "*/" else ""} */'
+        lines += body
+    lines += [
+        '};',
+        '',
+        f'LCD_FONT_CODES_DEFINE({name})',
+        '{',
+    ]
+    for i in range(0, len(glyphs), 8):
+        lines.append('\t' + ', '.join(f'0x{ch:04X}' for ch, _ in glyphs[i:i + 8]) + ',')
+    lines += [
+        '};',
+        '',
+        '',
+        f'LCD_SUBSET_FONT_DEFINE({name}, {font.width}, {font.height});',
+        '',
+    ]
+
+    try:
+        with open(output_file, 'w', encoding='utf-8') as f:
+            f.write('\n'.join(lines))
+    except OSError as e:
+        print(f"Error: {e}")
+        return False
+
+    # 子集大小包括字符编码表
+    subset_size = len(glyphs) * (font.code_size + 2)
+    print(f"Font '{font.name}' {font.width}x{font.height} -> '{name}' ({os.path.basename(output_file)})")
+    print(f"  Glyphs:       {len(glyphs)} of {font.count}")
+    print(f"  Flash:        {font.count * font.code_size} -> {subset_size} bytes")
+    if missing:
+        shown = ' '.join(f'U+{ch:04X}' for ch in missing[:16])
+        print(f"  Not in font:  {len(missing)} chars ({shown}{' ...' if len(missing) > 16 else ''})")
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description='LCD Font Packer')
+    parser.add_argument('--trim', '-t', action='store_true', help='Trim glyphs to bounding boxes, generate a proportional font')
+    parser.add_argument('--rle', '-r', action='store_true', help='Compress glyphs with RLE, generate a compressed font')
+    parser.add_argument('--report', action='store_true', help='Print compression ratio of input fonts, no output')
+    parser.add_argument('--subset', '-s', action='store_true', help='Keep only used chars, generate a subset font')
+    parser.add_argument('--input', '-i', required=True, nargs='+', help='Input font source file(s), e.g. lcd_font/fonts/font_ter_16x32.c, or HZK file for --subset')
+    parser.add_argument('--output', '-o', help='Output font source file')
+    parser.add_argument('--name', '-n', help='Font name, default <source name>_prop, _rle or _subset')
+    parser.add_argument('--first', type=lambda v: int(v, 0), default=0x20, help='First char code, default 0x20')
+    parser.add_argument('--last', type=lambda v: int(v, 0), default=0x7E, help='Last char code, default 0x7E')
+    parser.add_argument('--spacing', type=int, help='Gap between glyphs of proportional font, default width/8')
+    parser.add_argument('--monospace', action='store_true', help='Keep cell width, only trim storage')
+    parser.add_argument('--text', action='append', default=[], help='Chars used, for --subset, can be repeated')
+    parser.add_argument('--text-file', action='append', default=[], help='UTF-8 text file of used chars, for --subset')
+    parser.add_argument('--codepoints', action='append', default=[], help='Used char codes for --subset, e.g. "0x30-0x39,U+4E2D"')
+
+    args = parser.parse_args()
+
+    if sum([args.trim, args.rle, args.subset, args.report]) != 1:
+        print("Error: Must specify one of --trim, --rle, --subset or --report")
+        sys.exit(1)
+
+    if args.report:
+        success = all([compress_font(f, None, None) for f in args.input])
+        sys.exit(0 if success else 1)
+
+    if len(args.input) != 1 or not args.output:
+        print("Error: One input file and --output are required")
+        sys.exit(1)
+
+    if args.subset:
+        try:
+            chars = collect_chars(args.text, args.text_file, args.codepoints)
+        except (OSError, ValueError) as e:
+            print(f"Error: {e}")
+            sys.exit(1)
+        success = subset_font(args.input[0], args.output, args.name, chars)
+    elif args.trim:
+        success = trim_font(args.input[0], args.output, args.name, args.first, args.last, args.spacing, args.monospace)
+    else:
+        success = compress_font(args.input[0], args.output, args.name)
+    sys.exit(0 if success else 1)
+
+
+if __name__ == '__main__':
+    main()
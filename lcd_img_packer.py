@@ -0,0 +1,580 @@
+#!/usr/bin/env python3
+"""
+单色图片编码工具
+1. 将 C 头文件中 LCD_MONO_IMG_DEFINE 定义的原始位图转换为 LCD_MONO_RLE_IMG_DEFINE 游程编码格式
+2. 将 C 头文件中的图片打包为资源包（lcd_asset.h），烧录到数据分区中使用
+3. 将 C 头文件中的多帧图片转换为差值动画（lcd_anim.h 中的 LCD_MONO_DELTA_ANIM_DEFINE）
+"""
+
+import re
+import sys
+import struct
+import zlib
+import argparse
+from typing import List, Tuple
+
+# 匹配一个图片定义: LCD_MONO_IMG_DEFINE(name, width, height, data...);
+IMG_DEFINE_PATTERN = re.compile(
+    r'LCD_MONO_IMG_DEFINE\(\s*(\w+)\s*,\s*(\d+)\s*,\s*(\d+)\s*,(.*?)\);', re.S)
+
+RLE_DEFINE_PATTERN = re.compile(
+    r'LCD_MONO_RLE_IMG_DEFINE\(\s*(\w+)\s*,\s*(\d+)\s*,\s*(\d+)\s*,(.*?)\);', re.S)
+
+HEX_PATTERN = re.compile(r'0[xX][0-9a-fA-F]+|\d+')
+
+# 与 lcd_img.h 中 lcd_img_format_t 一致
+IMG_FORMAT_RAW = 0
+IMG_FORMAT_RLE = 1
+
+
+class MonoImage:
+    """单色位图, 按行存储, 每行 (width + 7) // 8 字节, 高位在左"""
+
+    def __init__(self, name: str, width: int, height: int, data: bytes):
+        self.name = name
+        self.width = width
+        self.height = height
+        self.data = data
+
+        row_bytes = (width + 7) // 8
+        if len(data) < row_bytes * height:
+            raise ValueError(f"Image '{name}' data too short: {len(data)} < {row_bytes * height}")
+
+    def pixels(self) -> List[int]:
+        """按行展开为像素序列, 去掉行尾填充位"""
+        row_bytes = (self.width + 7) // 8
+        result = []
+        for y in range(self.height):
+            row = self.data[y * row_bytes:(y + 1) * row_bytes]
+            for x in range(self.width):
+                result.append((row[x >> 3] >> (7 - (x & 7))) & 1)
+        return result
+
+
+def rle_encode(img: MonoImage) -> bytes:
+    """
+    像素游程编码, 与 lcd_img.h 中 LCD_MONO_RLE_IMG_DEFINE 的说明一致:
+    游程从0开始交替, 每个游程用若干4位码表示, 15表示加15继续, 0-14表示结束
+    """
+    runs = []
+    color = 0
+    count = 0
+    for p in img.pixels():
+        if p == color:
+            count += 1
+        else:
+            runs.append(count)
+            color = p
+            count = 1
+    runs.append(count)
+
+    nibbles = []
+    for run in runs:
+        while run >= 15:
+            nibbles.append(15)
+            run -= 15
+        nibbles.append(run)
+
+    if len(nibbles) & 1:
+        nibbles.append(0)
+
+    return bytes((nibbles[i] << 4) | nibbles[i + 1] for i in range(0, len(nibbles), 2))
+
+
+def rle_decode(data: bytes, width: int, height: int) -> bytes:
+    """解码为原始位图格式, 用于校验"""
+    row_bytes = (width + 7) // 8
+    out = bytearray(row_bytes * height)
+    total = width * height
+    pos = 0
+    color = 0
+    run = 0
+    for i in range(len(data) * 2):
+        code = (data[i >> 1] >> 4) if (i & 1) == 0 else (data[i >> 1] & 0x0F)
+        run += code
+        if code < 15:
+            if color:
+                for p in range(pos, min(pos + run, total)):
+                    y, x = divmod(p, width)
+                    out[y * row_bytes + (x >> 3)] |= 0x80 >> (x & 7)
+            pos += run
+            run = 0
+            color ^= 1
+            if pos >= total:
+                break
+    if pos < total:
+        raise ValueError("RLE data truncated")
+    return bytes(out)
+
+
+def parse_images(text: str, pattern=IMG_DEFINE_PATTERN) -> List[Tuple[re.Match, str, int, int, bytes]]:
+    """从C源码中解析所有图片定义, 返回 (匹配对象, 名称, 宽, 高, 数据)"""
+    result = []
+    for m in pattern.finditer(text):
+        data = bytes(int(v, 0) for v in HEX_PATTERN.findall(m.group(4)))
+        result.append((m, m.group(1), int(m.group(2)), int(m.group(3)), data))
+    return result
+
+
+def format_define(macro: str, name: str, width: int, height: int, data: bytes) -> str:
+    """生成图片定义代码, 每行8个字节"""
+    lines = []
+    for i in range(0, len(data), 8):
+        lines.append(', '.join(f'0x{b:02x}' for b in data[i:i + 8]))
+    return f'{macro}({name}, {width}, {height}, \n' + ',\n'.join(lines) + '\n);'
+
+
+def convert_header(input_file: str, output_file: str) -> bool:
+    """将头文件中所有原始位图替换为游程编码格式, 其余内容保持不变"""
+    with open(input_file, 'r', encoding='utf-8') as f:
+        text = f.read()
+
+    images = parse_images(text)
+    if not images:
+        print(f"Error: No LCD_MONO_IMG_DEFINE found in '{input_file}'")
+        return False
+
+    raw_total = 0
+    rle_total = 0
+    pieces = []
+    last = 0
+    for m, name, width, height, data in images:
+        img = MonoImage(name, width, height, data)
+        rle = rle_encode(img)
+        # 编码后立即校验
+        row_bytes = (img.width + 7) // 8
+        if rle_decode(rle, img.width, img.height) != _mask_padding(img):
+            print(f"Error: RLE verify failed for '{img.name}'")
+            return False
+
+        raw_size = row_bytes * img.height
+        raw_total += raw_size
+        if len(rle) >= raw_size:
+            # 编码后反而变大, 保留原始格式
+            print(f"  {img.name}: {raw_size} -> {len(rle)} bytes, keep raw")
+            rle_total += raw_size
+            pieces.append(text[last:m.end()])
+        else:
+            rle_total += len(rle)
+            pieces.append(text[last:m.start()])
+            pieces.append(format_define('LCD_MONO_RLE_IMG_DEFINE', img.name, img.width, img.height, rle))
+        last = m.end()
+    pieces.append(text[last:])
+
+    with open(output_file, 'w', encoding='utf-8') as f:
+        f.write(''.join(pieces))
+
+    print(f"Converted {len(images)} images: {raw_total} -> {rle_total} bytes "
+          f"({rle_total * 100 / raw_total:.1f}%)")
+    return True
+
+
+def _mask_padding(img: MonoImage) -> bytes:
+    """清除行尾填充位, 便于和解码结果比较"""
+    row_bytes = (img.width + 7) // 8
+    data = bytearray(img.data[:row_bytes * img.height])
+    if img.width & 7:
+        mask = (0xFF << (8 - (img.width & 7))) & 0xFF
+        for y in range(img.height):
+            data[y * row_bytes + row_bytes - 1] &= mask
+    return bytes(data)
+
+
+def dump_header(input_file: str) -> bool:
+    """统计头文件中图片的数据大小"""
+    with open(input_file, 'r', encoding='utf-8') as f:
+        text = f.read()
+
+    raw_images = parse_images(text)
+    rle_images = parse_images(text, RLE_DEFINE_PATTERN)
+    if not raw_images and not rle_images:
+        print(f"Error: No image found in '{input_file}'")
+        return False
+
+    raw_total = 0
+    stored_total = 0
+    for _, name, width, height, data in raw_images:
+        size = ((width + 7) // 8) * height
+        raw_total += size
+        stored_total += size
+        print(f"  {name:<24} {width}x{height} RAW {size} bytes")
+
+    for _, name, width, height, data in rle_images:
+        size = ((width + 7) // 8) * height
+        raw_total += size
+        stored_total += len(data)
+        rle_decode(data, width, height)
+        print(f"  {name:<24} {width}x{height} RLE {len(data)} bytes ({len(data) * 100 / size:.1f}%)")
+
+    print(f"Total: {len(raw_images) + len(rle_images)} images, raw {raw_total} bytes, "
+          f"stored {stored_total} bytes ({stored_total * 100 / raw_total:.1f}%)")
+    return True
+
+
+def _image_bits(img: MonoImage) -> List[List[int]]:
+    """按行展开为像素二维数组"""
+    pixels = img.pixels()
+    return [pixels[y * img.width:(y + 1) * img.width] for y in range(img.height)]
+
+
+def _pack_rows(rows: List[List[int]]) -> bytes:
+    """像素二维数组打包为原始位图格式"""
+    width = len(rows[0]) if rows else 0
+    row_bytes = (width + 7) // 8
+    data = bytearray(row_bytes * len(rows))
+    for y, row in enumerate(rows):
+        for x, p in enumerate(row):
+            if p:
+                data[y * row_bytes + (x >> 3)] |= 0x80 >> (x & 7)
+    return bytes(data)
+
+
+def _smaller_format(name: str, width: int, height: int, raw: bytes) -> Tuple[int, bytes]:
+    """返回原始格式和RLE格式中较小的一种"""
+    rle = rle_encode(MonoImage(name, width, height, raw))
+    if rle_decode(rle, width, height) != raw:
+        raise ValueError(f"RLE verify failed for '{name}'")
+    if len(rle) < len(raw):
+        return IMG_FORMAT_RLE, rle
+    return IMG_FORMAT_RAW, raw
+
+
+def convert_anim_delta(input_file: str, output_file: str, name: str, period: int, loop: str) -> bool:
+    """
+    将头文件中按顺序定义的多帧图片转换为差值动画: 首帧为关键帧, 之后每帧保存与前一帧异或差值的边界框
+    """
+    with open(input_file, 'r', encoding='utf-8') as f:
+        text = f.read()
+
+    frames = []
+    for m, img_name, width, height, data in parse_images(text):
+        frames.append((m.start(), MonoImage(img_name, width, height, data)))
+    for m, img_name, width, height, data in parse_images(text, RLE_DEFINE_PATTERN):
+        frames.append((m.start(), MonoImage(img_name, width, height, rle_decode(data, width, height))))
+    frames = [img for _, img in sorted(frames, key=lambda f: f[0])]
+
+    if len(frames) < 2:
+        print(f"Error: At least 2 frames are required in '{input_file}'")
+        return False
+
+    width, height = frames[0].width, frames[0].height
+    for img in frames:
+        if img.width != width or img.height != height:
+            print(f"Error: Frame '{img.name}' size {img.width}x{img.height} != {width}x{height}")
+            return False
+
+    guard = f'{name.upper()}_ANIM_H'
+    out = [f'#ifndef {guard}', f'#define {guard}', '',
+           f'// 由 lcd_img_packer.py --anim-delta 从 {input_file} 生成', '',
+           '#include "lcd_anim.h"', '']
+
+    # 关键帧
+    key_raw = _mask_padding(frames[0])
+    fmt, payload = _smaller_format(f'{name}_0', width, height, key_raw)
+    macro = 'LCD_MONO_RLE_IMG_DEFINE' if fmt == IMG_FORMAT_RLE else 'LCD_MONO_IMG_DEFINE'
+    out.append(format_define(macro, f'{name}_0', width, height, payload))
+    entries = [f'    LCD_ANIM_FRAME(LCD_IMG({name}_0), 0)']
+
+    raw_total = len(key_raw) * len(frames)
+    total = len(payload)
+
+    prev = _image_bits(frames[0])
+    for i, img in enumerate(frames[1:], 1):
+        cur = _image_bits(img)
+        diff = [[a ^ b for a, b in zip(r0, r1)] for r0, r1 in zip(prev, cur)]
+        xs = [x for row in diff for x, p in enumerate(row) if p]
+        ys = [y for y, row in enumerate(diff) if any(row)]
+        delta_name = f'{name}_{i}'
+
+        if not ys:
+            # 与前一帧相同
+            out.append(f'LCD_ANIM_DELTA_DEFINE({delta_name}, 0, 0, 0, 0, LCD_IMG_FORMAT_RAW, 0x00);')
+            total += 1
+        else:
+            x0, x1, y0, y1 = min(xs), max(xs) + 1, ys[0], ys[-1] + 1
+            box = _pack_rows([row[x0:x1] for row in diff[y0:y1]])
+            fmt, payload = _smaller_format(delta_name, x1 - x0, y1 - y0, box)
+            fmt_name = 'LCD_IMG_FORMAT_RLE' if fmt == IMG_FORMAT_RLE else 'LCD_IMG_FORMAT_RAW'
+            define = format_define('LCD_ANIM_DELTA_DEFINE', delta_name, x0, y0, payload)
+            # format_define 生成 (name, x, y, ...), 补上宽高和格式
+            define = define.replace(f'({delta_name}, {x0}, {y0}, ',
+                                    f'({delta_name}, {x0}, {y0}, {x1 - x0}, {y1 - y0}, {fmt_name}, ', 1)
+            out.append(define)
+            total += len(payload)
+            print(f"  {img.name}: box ({x0},{y0} {x1 - x0}x{y1 - y0}) {len(payload)} bytes")
+
+        entries.append(f'    LCD_ANIM_DELTA_FRAME({delta_name}, 0)')
+        prev = cur
+
+    out.append('')
+    out.append(f'LCD_MONO_DELTA_ANIM_DEFINE({name}, {width}, {height}, {period}, LCD_ANIM_LOOP_{loop.upper()},')
+    out.append(',\n'.join(entries) + ');')
+    out += ['', f'#endif // {guard}', '']
+
+    with open(output_file, 'w', encoding='utf-8') as f:
+        f.write('\n'.join(out))
+
+    print(f"Converted {len(frames)} frames into '{output_file}': {raw_total} -> {total} bytes "
+          f"({total * 100 / raw_total:.1f}%)")
+    return True
+
+
+class AssetHeader:
+    """资源包头信息, 与 lcd_asset_header_t 一致, 共64字节"""
+
+    MAGIC = 0x31545341  # "AST1" in little-endian
+    SIZE = 64
+    RECORD_SIZE = 20
+
+    def __init__(self):
+        self.magic = self.MAGIC
+        self.image_count = 0
+        self.index_offset = 0
+        self.name_index_offset = 0
+        self.string_offset = 0
+        self.string_size = 0
+        self.data_offset = 0
+        self.data_size = 0
+        self.index_checksum = 0
+        self.data_checksum = 0
+        self.reserved = [0] * 5
+        self.header_checksum = 0
+
+    def _fields(self) -> bytes:
+        return struct.pack('<10I5I', self.magic, self.image_count, self.index_offset,
+                           self.name_index_offset, self.string_offset, self.string_size,
+                           self.data_offset, self.data_size, self.index_checksum,
+                           self.data_checksum, *self.reserved)
+
+    def calculate_header_checksum(self) -> int:
+        """计算头部的CRC32校验和"""
+        return zlib.crc32(self._fields()) & 0xFFFFFFFF
+
+    def serialize(self) -> bytes:
+        self.header_checksum = self.calculate_header_checksum()
+        return self._fields() + struct.pack('<I', self.header_checksum)
+
+    @classmethod
+    def deserialize(cls, data: bytes) -> 'AssetHeader':
+        if len(data) < cls.SIZE:
+            raise ValueError("Header data too short")
+        header = cls()
+        values = struct.unpack('<16I', data[:cls.SIZE])
+        (header.magic, header.image_count, header.index_offset, header.name_index_offset,
+         header.string_offset, header.string_size, header.data_offset, header.data_size,
+         header.index_checksum, header.data_checksum) = values[:10]
+        header.reserved = list(values[10:15])
+        header.header_checksum = values[15]
+        if header.magic != cls.MAGIC:
+            raise ValueError(f"Invalid magic number: 0x{header.magic:08X}")
+        return header
+
+
+def _align(value: int, align: int) -> int:
+    return (value + align - 1) & ~(align - 1)
+
+
+def pack_assets(input_files: List[str], output_file: str, id_pattern: str, use_rle: bool) -> bool:
+    """
+    将多个头文件中的图片打包为资源包
+
+    Args:
+        input_files: 输入头文件列表, 支持 LCD_MONO_IMG_DEFINE 和 LCD_MONO_RLE_IMG_DEFINE
+        output_file: 输出资源包文件
+        id_pattern: 从图片名称中提取ID的正则表达式, 第一个分组为数字, 为空时按顺序编号
+        use_rle: 是否将原始位图编码为RLE格式（变大时保留原始格式）
+    """
+    assets = []  # (id, name, width, height, format, data)
+    for input_file in input_files:
+        with open(input_file, 'r', encoding='utf-8') as f:
+            text = f.read()
+        for _, name, width, height, data in parse_images(text):
+            img = MonoImage(name, width, height, data)
+            raw = _mask_padding(img)
+            fmt, payload = IMG_FORMAT_RAW, raw
+            if use_rle:
+                rle = rle_encode(img)
+                if len(rle) < len(raw):
+                    fmt, payload = IMG_FORMAT_RLE, rle
+            assets.append([None, name, width, height, fmt, payload])
+        for _, name, width, height, data in parse_images(text, RLE_DEFINE_PATTERN):
+            rle_decode(data, width, height)
+            assets.append([None, name, width, height, IMG_FORMAT_RLE, data])
+
+    if not assets:
+        print("Error: No image found in input files")
+        return False
+
+    # 分配ID
+    for i, asset in enumerate(assets):
+        if id_pattern:
+            m = re.search(id_pattern, asset[1])
+            if not m:
+                print(f"Error: Unable to get id from name '{asset[1]}' with pattern '{id_pattern}'")
+                return False
+            asset[0] = int(m.group(1), 0)
+        else:
+            asset[0] = i
+
+    ids = [a[0] for a in assets]
+    names = [a[1] for a in assets]
+    if len(set(ids)) != len(ids) or len(set(names)) != len(names):
+        print("Error: Duplicate image id or name")
+        return False
+
+    for a in assets:
+        if len(a[5]) > 0xFFFF:
+            print(f"Error: Image '{a[1]}' data too large ({len(a[5])} bytes)")
+            return False
+
+    assets.sort(key=lambda a: a[0])
+    count = len(assets)
+
+    # 名称字符串表
+    strings = bytearray()
+    name_offsets = []
+    for a in assets:
+        name_offsets.append(len(strings))
+        strings += a[1].encode('utf-8') + b'\0'
+
+    # 图片数据，4字节对齐
+    data = bytearray()
+    data_offsets = []
+    for a in assets:
+        data_offsets.append(len(data))
+        data += a[5]
+        data += bytes(_align(len(data), 4) - len(data))
+
+    name_order = sorted(range(count), key=lambda i: assets[i][1].encode('utf-8'))
+
+    header = AssetHeader()
+    header.image_count = count
+    header.index_offset = AssetHeader.SIZE
+    header.name_index_offset = header.index_offset + count * AssetHeader.RECORD_SIZE
+    header.string_offset = header.name_index_offset + count * 2
+    header.string_size = len(strings)
+    header.data_offset = _align(header.string_offset + header.string_size, 4)
+    header.data_size = len(data)
+
+    index = bytearray()
+    for i, a in enumerate(assets):
+        index += struct.pack('<IIHHBBHI', a[0], name_offsets[i], a[2], a[3], a[4], 0, len(a[5]), data_offsets[i])
+    for i in name_order:
+        index += struct.pack('<H', i)
+    index += strings
+    index += bytes(header.data_offset - header.index_offset - len(index))
+
+    header.index_checksum = zlib.crc32(index) & 0xFFFFFFFF
+    header.data_checksum = zlib.crc32(data) & 0xFFFFFFFF
+
+    with open(output_file, 'wb') as f:
+        f.write(header.serialize())
+        f.write(index)
+        f.write(data)
+
+    raw_total = sum(((a[2] + 7) // 8) * a[3] for a in assets)
+    total = header.data_offset + header.data_size
+    print(f"Packed {count} images into '{output_file}': {total} bytes "
+          f"(image data {len(data)} bytes, raw {raw_total} bytes)")
+    return True
+
+
+def dump_assets(input_file: str) -> bool:
+    """解析资源包并校验"""
+    try:
+        with open(input_file, 'rb') as f:
+            file_data = f.read()
+
+        header = AssetHeader.deserialize(file_data)
+        ok = True
+
+        if header.calculate_header_checksum() != header.header_checksum:
+            print("✗ Header checksum mismatch!")
+            ok = False
+
+        total = header.data_offset + header.data_size
+        if len(file_data) < total:
+            print(f"✗ File truncated! Expected {total} bytes, got {len(file_data)}")
+            return False
+
+        index = file_data[header.index_offset:header.data_offset]
+        if zlib.crc32(index) & 0xFFFFFFFF != header.index_checksum:
+            print("✗ Index checksum mismatch!")
+            ok = False
+
+        data = file_data[header.data_offset:total]
+        if zlib.crc32(data) & 0xFFFFFFFF != header.data_checksum:
+            print("✗ Data checksum mismatch!")
+            ok = False
+
+        strings = file_data[header.string_offset:header.string_offset + header.string_size]
+        print(f"=== Asset Pack: {input_file} ({len(file_data)} bytes, {header.image_count} images) ===")
+        last_id = -1
+        for i in range(header.image_count):
+            offs = header.index_offset + i * AssetHeader.RECORD_SIZE
+            img_id, name_offset, width, height, fmt, _, size, data_offset = \
+                struct.unpack('<IIHHBBHI', file_data[offs:offs + AssetHeader.RECORD_SIZE])
+            name = strings[name_offset:strings.index(b'\0', name_offset)].decode('utf-8')
+            if img_id <= last_id:
+                print("✗ Index not sorted by id!")
+                ok = False
+            last_id = img_id
+            if fmt == IMG_FORMAT_RLE:
+                rle_decode(data[data_offset:data_offset + size], width, height)
+            print(f"  {img_id:>6} {name:<24} {width}x{height} {'RLE' if fmt == IMG_FORMAT_RLE else 'RAW'} {size} bytes")
+
+        print(f"=== Overall Status: {'✓ VALID' if ok else '✗ INVALID'} ===")
+        return ok
+
+    except Exception as e:
+        print(f"Error analyzing asset pack: {e}")
+        return False
+
+
+def main():
+    parser = argparse.ArgumentParser(description='LCD Mono Image Packer')
+    parser.add_argument('--rle', '-r', action='store_true', help='Convert LCD_MONO_IMG_DEFINE to LCD_MONO_RLE_IMG_DEFINE')
+    parser.add_argument('--dump', '-d', action='store_true', help='Dump image sizes of a header file')
+    parser.add_argument('--pack-assets', '-p', action='store_true', help='Pack images of header files into an asset pack')
+    parser.add_argument('--dump-assets', '-D', action='store_true', help='Analyze an asset pack and verify checksums')
+    parser.add_argument('--anim-delta', '-a', metavar='NAME', help='Convert frames of a header file into a delta animation named NAME')
+    parser.add_argument('--input', '-i', required=True, nargs='+', help='Input file path(s)')
+    parser.add_argument('--output', '-o', help='Output file path, default overwrite input')
+    parser.add_argument('--id-pattern', help='Regex to get image id from name, e.g. "icon_(\\d+)_32", default sequential')
+    parser.add_argument('--no-rle', action='store_true', help='Keep raw format when packing assets')
+    parser.add_argument('--period', type=int, default=100, help='Default frame period (ms) of the delta animation')
+    parser.add_argument('--loop', choices=['repeat', 'once', 'pingpong'], default='repeat', help='Loop mode of the delta animation')
+
+    args = parser.parse_args()
+
+    modes = [args.rle, args.dump, args.pack_assets, args.dump_assets, bool(args.anim_delta)]
+    if sum(modes) != 1:
+        print("Error: Must specify one of --rle, --dump, --pack-assets, --dump-assets or --anim-delta")
+        sys.exit(1)
+
+    if not args.pack_assets and len(args.input) != 1:
+        print("Error: Only one input file is allowed in this mode")
+        sys.exit(1)
+
+    if args.rle:
+        success = convert_header(args.input[0], args.output or args.input[0])
+    elif args.dump:
+        success = dump_header(args.input[0])
+    elif args.pack_assets:
+        if not args.output:
+            print("Error: --output is required for pack mode")
+            sys.exit(1)
+        success = pack_assets(args.input, args.output, args.id_pattern, not args.no_rle)
+    elif args.anim_delta:
+        if not args.output:
+            print("Error: --output is required for anim delta mode")
+            sys.exit(1)
+        success = convert_anim_delta(args.input[0], args.output, args.anim_delta, args.period, args.loop)
+    else:
+        success = dump_assets(args.input[0])
+
+    sys.exit(0 if success else 1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,145 @@
+#ifndef LCD_MIRROR_H
+#define LCD_MIRROR_H
+
+/**
+ * @file lcd_mirror.h
+ * @author LiuChuansen (179712066@qq.com)
+ * @brief 通过TCP把显存镜像给远程查看端，用于远程支持和监控
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @note 显存按固定字节数分块，每次只发送变化的块。块的内容为与上一次发送内容的异或差值，
+ *   再用PackBits游程编码（差值中大部分为0，压缩率很高）。新连接的查看端先收到一个关键帧。
+ *   发送受最小间隔和每秒字节数限制，超出时跳过本次，变化累积到下一次发送，不会占满WiFi带宽；
+ *   socket为非阻塞，发送不完整的查看端直接断开，不会阻塞显示任务。
+ *
+ *   每帧的格式（小端）：
+ *   [lcd_mirror_frame_header_t]
+ *   重复 tile_count 次：[uint16_t 块序号][uint16_t 编码长度][PackBits编码的异或差值]
+ *   查看端的实现见 lcd_mirror_viewer.py
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "lcd_display.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// 帧头魔数 "LM"
+#define LCD_MIRROR_MAGIC 0x4D4C
+
+/// 协议版本
+#define LCD_MIRROR_VERSION 1
+
+/// 每块最大的字节数，编码时块的差值在栈上计算
+#define LCD_MIRROR_MAX_TILE_BYTES 256
+
+/// 最大查看端数量，发送失败的查看端在栈上记录
+#ifndef CONFIG_LCD_MIRROR_MAX_VIEWERS
+#define CONFIG_LCD_MIRROR_MAX_VIEWERS 4
+#endif
+
+/// 关键帧，异或的基准为全0，包含所有块
+#define LCD_MIRROR_FRAME_KEY 0
+/// 差值帧，异或的基准为上一次发送的内容，只包含变化的块
+#define LCD_MIRROR_FRAME_DELTA 1
+
+/**
+ * @brief 帧头, 共20字节
+ */
+typedef struct __attribute__((packed)) {
+    uint16_t magic;          // LCD_MIRROR_MAGIC
+    uint8_t version;         // LCD_MIRROR_VERSION
+    uint8_t type;            // LCD_MIRROR_FRAME_KEY / LCD_MIRROR_FRAME_DELTA
+    uint16_t width;          // 显示宽度
+    uint16_t height;         // 显示高度
+    uint32_t seq;            // 帧序号
+    uint16_t tile_bytes;     // 每块的字节数，最后一块可能不足
+    uint16_t tile_count;     // 本帧包含的块数
+    uint32_t payload_size;   // 帧头之后的数据长度
+} lcd_mirror_frame_header_t;
+
+/**
+ * @brief 镜像句柄
+ */
+typedef struct lcd_mirror_s *lcd_mirror_handle_t;
+
+/**
+ * @brief 镜像配置
+ */
+typedef struct {
+    lcd_handle_t disp;                  // 要镜像的显示
+    uint16_t port;                      // 监听端口
+    uint32_t max_viewers;               // 最大查看端数量，默认2，最多 CONFIG_LCD_MIRROR_MAX_VIEWERS
+    uint16_t tile_bytes;                // 每块的字节数，默认为一行的字节数，最大 LCD_MIRROR_MAX_TILE_BYTES
+    uint32_t min_interval_ms;           // 两次发送的最小间隔，默认200ms
+    uint32_t max_bytes_per_sec;         // 每秒最多发送的字节数（所有查看端合计），0为不限制
+    uint32_t stack_size;                // TCP服务器任务栈大小，默认4096
+    uint32_t task_priority;             // TCP服务器任务优先级，默认低于显示任务，为2
+} lcd_mirror_config_t;
+
+/**
+ * @brief 镜像统计
+ */
+typedef struct {
+    uint32_t frames;                    // 发送的差值帧数
+    uint32_t keyframes;                 // 发送的关键帧数
+    uint32_t tiles;                     // 发送的块数
+    uint32_t bytes;                     // 发送的总字节数
+    uint32_t skipped;                   // 因为限速跳过的次数
+    uint32_t dropped_viewers;           // 因为发送不完整断开的查看端数量
+} lcd_mirror_stats_t;
+
+/**
+ * @brief 创建镜像并启动TCP服务器
+ *
+ * @param config 镜像配置
+ * @param err 错误码
+ * @return lcd_mirror_handle_t 镜像句柄，失败返回NULL
+ */
+lcd_mirror_handle_t lcd_mirror_create(const lcd_mirror_config_t *config, esp_err_t *err);
+
+/**
+ * @brief 停止TCP服务器并销毁镜像
+ *
+ * @param mirror 镜像句柄
+ * @return esp_err_t 错误码
+ */
+esp_err_t lcd_mirror_destroy(lcd_mirror_handle_t mirror);
+
+/**
+ * @brief 把显存的变化发送给查看端，在显示任务中 lcd_refresh 之后调用
+ *
+ * @param mirror 镜像句柄
+ * @return esp_err_t ESP_OK 发送成功、没有变化、没有查看端或被限速跳过
+ *
+ * @note 没有查看端或未到发送间隔时立即返回；被限速跳过时变化保留到下一次发送
+ */
+esp_err_t lcd_mirror_update(lcd_mirror_handle_t mirror);
+
+/**
+ * @brief 要求下一次给所有查看端发送关键帧
+ *
+ * @param mirror 镜像句柄
+ */
+void lcd_mirror_request_keyframe(lcd_mirror_handle_t mirror);
+
+/**
+ * @brief 获取统计信息
+ *
+ * @param mirror 镜像句柄
+ * @param stats 输出统计信息
+ * @return esp_err_t 错误码
+ */
+esp_err_t lcd_mirror_get_stats(lcd_mirror_handle_t mirror, lcd_mirror_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LCD_MIRROR_H
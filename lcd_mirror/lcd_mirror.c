@@ -0,0 +1,545 @@
+/**
+ * @file lcd_mirror.c
+ * @author LiuChuansen (179712066@qq.com)
+ * @brief 显存远程镜像实现
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "lcd_mirror.h"
+#include "tcp_server.h"
+#include "uptime.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "lcd_mirror";
+
+/**
+ * @brief 查看端
+ */
+typedef struct {
+    tcp_client_t *client;       // 为NULL时是空闲的
+    uint32_t client_id;         // 连接序号，释放锁之后按序号断开，不会断开复用同一槽位的新连接
+    bool need_keyframe;         // 下一次发送关键帧
+    bool failed;                // 发送失败，需要断开
+} lcd_mirror_viewer_t;
+
+/**
+ * @brief 镜像内部结构体
+ */
+struct lcd_mirror_s {
+    lcd_handle_t disp;
+    const uint8_t *fb;                  // 显存
+    uint32_t fb_size;
+    uint16_t width, height;
+
+    tcp_server_handle_t server;
+    SemaphoreHandle_t mutex;            // 保护查看端列表
+    lcd_mirror_viewer_t *viewers;
+    uint32_t max_viewers;
+    uint32_t viewer_count;
+
+    uint16_t tile_bytes;
+    uint16_t tile_count;
+    uint8_t *shadow;                    // 查看端当前的内容，即上一次发送的内容
+    uint8_t *changed;                   // 每块是否有变化
+    uint8_t *msg;                       // 帧缓存
+    uint32_t msg_size;
+
+    uint32_t min_interval_ms;
+    uint32_t max_bytes_per_sec;
+    sys_tick_t last_send;
+    sys_tick_t last_refill;
+    int32_t tokens;                     // 可发送的字节数，发送后可以为负，补满之前不再发送
+
+    uint32_t seq;
+    lcd_mirror_stats_t stats;
+};
+
+/**
+ * @brief PackBits编码：控制字节n为0~127时后面跟n+1个原样字节，为-1~-127时下一个字节重复1-n次
+ *
+ * @param src 数据
+ * @param len 数据长度
+ * @param dst 输出，至少 len + (len + 127) / 128 字节
+ * @return uint32_t 编码后的长度
+ */
+static uint32_t packbits_encode(const uint8_t *src, uint32_t len, uint8_t *dst)
+{
+    uint32_t i = 0, out = 0;
+
+    while (i < len)
+    {
+        // 统计重复的字节
+        uint32_t run = 1;
+        while (i + run < len && run < 128 && src[i + run] == src[i])
+        {
+            run++;
+        }
+
+        if (run >= 2)
+        {
+            dst[out++] = (uint8_t)(1 - (int)run);
+            dst[out++] = src[i];
+            i += run;
+            continue;
+        }
+
+        // 原样字节，遇到至少2个重复字节时结束
+        uint32_t start = i;
+        while (i < len && i - start < 128)
+        {
+            if (i + 1 < len && src[i] == src[i + 1])
+            {
+                break;
+            }
+            i++;
+        }
+        dst[out++] = (uint8_t)(i - start - 1);
+        memcpy(&dst[out], &src[start], i - start);
+        out += i - start;
+    }
+
+    return out;
+}
+
+/**
+ * @brief 编码一块，写入块序号、长度和 PackBits(cur ^ base)
+ *
+ * @param mirror
+ * @param index 块序号
+ * @param cur 当前内容
+ * @param base 异或的基准，为NULL时为全0
+ * @param out 输出
+ * @return uint32_t 写入的长度
+ */
+static uint32_t encode_tile(const lcd_mirror_handle_t mirror, uint16_t index, const uint8_t *cur, const uint8_t *base, uint8_t *out)
+{
+    uint32_t offset = (uint32_t)index * mirror->tile_bytes;
+    uint32_t size = mirror->fb_size - offset;
+    if (size > mirror->tile_bytes)
+    {
+        size = mirror->tile_bytes;
+    }
+
+    uint8_t delta[LCD_MIRROR_MAX_TILE_BYTES];
+    for (uint32_t i = 0; i < size; i++)
+    {
+        delta[i] = base ? cur[offset + i] ^ base[offset + i] : cur[offset + i];
+    }
+
+    uint16_t encoded = packbits_encode(delta, size, &out[4]);
+    memcpy(&out[0], &index, sizeof(index));
+    memcpy(&out[2], &encoded, sizeof(encoded));
+
+    return 4 + encoded;
+}
+
+/**
+ * @brief 编码一帧
+ *
+ * @param mirror
+ * @param type 帧类型
+ * @return uint32_t 帧的总长度
+ */
+static uint32_t encode_frame(lcd_mirror_handle_t mirror, uint8_t type)
+{
+    uint32_t pos = sizeof(lcd_mirror_frame_header_t);
+    uint16_t count = 0;
+
+    for (uint16_t t = 0; t < mirror->tile_count; t++)
+    {
+        if (type == LCD_MIRROR_FRAME_KEY)
+        {
+            pos += encode_tile(mirror, t, mirror->shadow, NULL, &mirror->msg[pos]);
+            count++;
+        }
+        else if (mirror->changed[t])
+        {
+            pos += encode_tile(mirror, t, mirror->fb, mirror->shadow, &mirror->msg[pos]);
+            count++;
+        }
+    }
+
+    lcd_mirror_frame_header_t header = {
+        .magic = LCD_MIRROR_MAGIC,
+        .version = LCD_MIRROR_VERSION,
+        .type = type,
+        .width = mirror->width,
+        .height = mirror->height,
+        .seq = mirror->seq,
+        .tile_bytes = mirror->tile_bytes,
+        .tile_count = count,
+        .payload_size = pos - sizeof(lcd_mirror_frame_header_t),
+    };
+    memcpy(mirror->msg, &header, sizeof(header));
+
+    return pos;
+}
+
+/**
+ * @brief 发送帧给需要该类型的查看端，调用时持有mutex
+ *
+ * @param mirror
+ * @param len 帧长度
+ * @param keyframe 是否为关键帧
+ */
+static void send_frame(lcd_mirror_handle_t mirror, uint32_t len, bool keyframe)
+{
+    for (uint32_t i = 0; i < mirror->max_viewers; i++)
+    {
+        lcd_mirror_viewer_t *viewer = &mirror->viewers[i];
+        if (!viewer->client || viewer->failed || viewer->need_keyframe != keyframe)
+        {
+            continue;
+        }
+
+        // 非阻塞发送，发送不完整时查看端的数据已经错位，只能断开
+        if (tcp_server_send_to_client(mirror->server, viewer->client, mirror->msg, len) != ESP_OK)
+        {
+            viewer->failed = true;
+            continue;
+        }
+
+        viewer->need_keyframe = false;
+        mirror->stats.bytes += len;
+        if (mirror->max_bytes_per_sec)
+        {
+            mirror->tokens -= len;
+        }
+    }
+}
+
+/**
+ * @brief 查看端连接，在TCP服务器任务中调用
+ */
+static void on_viewer_connected(tcp_client_t *client, void *user_ctx)
+{
+    lcd_mirror_handle_t mirror = (lcd_mirror_handle_t)user_ctx;
+
+    xSemaphoreTake(mirror->mutex, portMAX_DELAY);
+    for (uint32_t i = 0; i < mirror->max_viewers; i++)
+    {
+        if (mirror->viewers[i].client == NULL)
+        {
+            mirror->viewers[i].client = client;
+            mirror->viewers[i].client_id = client->id;
+            mirror->viewers[i].need_keyframe = true;
+            mirror->viewers[i].failed = false;
+            mirror->viewer_count++;
+            break;
+        }
+    }
+    xSemaphoreGive(mirror->mutex);
+}
+
+/**
+ * @brief 查看端断开，在TCP服务器任务或 lcd_mirror_update 中调用
+ */
+static void on_viewer_disconnected(tcp_client_t *client, void *user_ctx)
+{
+    lcd_mirror_handle_t mirror = (lcd_mirror_handle_t)user_ctx;
+
+    xSemaphoreTake(mirror->mutex, portMAX_DELAY);
+    for (uint32_t i = 0; i < mirror->max_viewers; i++)
+    {
+        if (mirror->viewers[i].client == client)
+        {
+            memset(&mirror->viewers[i], 0, sizeof(lcd_mirror_viewer_t));
+            mirror->viewer_count--;
+            break;
+        }
+    }
+    xSemaphoreGive(mirror->mutex);
+}
+
+/**
+ * @brief 查看端发来的数据，'K' 请求关键帧，其他忽略
+ */
+static void on_viewer_data(tcp_client_t *client, const uint8_t *data, size_t len, void *user_ctx)
+{
+    lcd_mirror_handle_t mirror = (lcd_mirror_handle_t)user_ctx;
+
+    if (memchr(data, 'K', len) == NULL)
+    {
+        return;
+    }
+
+    xSemaphoreTake(mirror->mutex, portMAX_DELAY);
+    for (uint32_t i = 0; i < mirror->max_viewers; i++)
+    {
+        if (mirror->viewers[i].client == client)
+        {
+            mirror->viewers[i].need_keyframe = true;
+        }
+    }
+    xSemaphoreGive(mirror->mutex);
+}
+
+/**
+ * @brief 释放资源
+ */
+static void mirror_free(lcd_mirror_handle_t mirror)
+{
+    if (mirror->server)
+    {
+        tcp_server_destroy(mirror->server);
+    }
+    if (mirror->mutex)
+    {
+        vSemaphoreDelete(mirror->mutex);
+    }
+    free(mirror->viewers);
+    free(mirror->shadow);
+    free(mirror->changed);
+    free(mirror->msg);
+    free(mirror);
+}
+
+lcd_mirror_handle_t lcd_mirror_create(const lcd_mirror_config_t *config, esp_err_t *err)
+{
+    if (config == NULL || err == NULL || config->disp == NULL || config->port == 0
+        || config->tile_bytes > LCD_MIRROR_MAX_TILE_BYTES || config->max_viewers > CONFIG_LCD_MIRROR_MAX_VIEWERS)
+    {
+        if (err)
+        {
+            *err = ESP_ERR_INVALID_ARG;
+        }
+        return NULL;
+    }
+
+    lcd_mirror_handle_t mirror = calloc(1, sizeof(struct lcd_mirror_s));
+    if (mirror == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to allocate mirror memory");
+        *err = ESP_ERR_NO_MEM;
+        return NULL;
+    }
+
+    mirror->disp = config->disp;
+    mirror->fb = lcd_get_framebuffer(config->disp, &mirror->width, &mirror->height, &mirror->fb_size);
+    mirror->max_viewers = config->max_viewers > 0 ? config->max_viewers : 2;
+    mirror->tile_bytes = config->tile_bytes > 0 ? config->tile_bytes : (mirror->width + 7) / 8;
+    if (mirror->tile_bytes > LCD_MIRROR_MAX_TILE_BYTES)
+    {
+        mirror->tile_bytes = LCD_MIRROR_MAX_TILE_BYTES;
+    }
+    mirror->tile_count = (mirror->fb_size + mirror->tile_bytes - 1) / mirror->tile_bytes;
+    mirror->min_interval_ms = config->min_interval_ms > 0 ? config->min_interval_ms : 200;
+    mirror->max_bytes_per_sec = config->max_bytes_per_sec;
+
+    // 最坏情况下每块PackBits多出 (tile_bytes + 127) / 128 字节，再加上块序号和长度
+    uint32_t tile_max = 4 + mirror->tile_bytes + (mirror->tile_bytes + 127) / 128;
+    mirror->msg_size = sizeof(lcd_mirror_frame_header_t) + tile_max * mirror->tile_count;
+
+    mirror->viewers = calloc(mirror->max_viewers, sizeof(lcd_mirror_viewer_t));
+    mirror->shadow = calloc(1, mirror->fb_size);
+    mirror->changed = calloc(1, mirror->tile_count);
+    mirror->msg = malloc(mirror->msg_size);
+    mirror->mutex = xSemaphoreCreateMutex();
+    if (!mirror->viewers || !mirror->shadow || !mirror->changed || !mirror->msg || !mirror->mutex)
+    {
+        ESP_LOGE(TAG, "Failed to allocate mirror buffers");
+        mirror_free(mirror);
+        *err = ESP_ERR_NO_MEM;
+        return NULL;
+    }
+
+    tcp_server_config_t server_config = {
+        .port = config->port,
+        .max_clients = mirror->max_viewers,
+        .recv_callback = on_viewer_data,
+        .connect_callback = on_viewer_connected,
+        .disconnect_callback = on_viewer_disconnected,
+        .user_ctx = mirror,
+        .stack_size = config->stack_size,
+        .task_priority = config->task_priority > 0 ? config->task_priority : 2,
+    };
+
+    mirror->server = tcp_server_create(&server_config, err);
+    if (mirror->server == NULL)
+    {
+        mirror_free(mirror);
+        return NULL;
+    }
+
+    *err = tcp_server_start(mirror->server);
+    if (*err != ESP_OK)
+    {
+        mirror_free(mirror);
+        return NULL;
+    }
+
+    mirror->last_send = mirror->last_refill = uptime();
+    mirror->tokens = mirror->max_bytes_per_sec;
+
+    ESP_LOGI(TAG, "LCD mirror started on port %d, %dx%d, %d tiles of %d bytes",
+             config->port, mirror->width, mirror->height, mirror->tile_count, mirror->tile_bytes);
+
+    return mirror;
+}
+
+esp_err_t lcd_mirror_destroy(lcd_mirror_handle_t mirror)
+{
+    if (mirror == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    mirror_free(mirror);
+    return ESP_OK;
+}
+
+void lcd_mirror_request_keyframe(lcd_mirror_handle_t mirror)
+{
+    if (mirror == NULL)
+    {
+        return;
+    }
+
+    xSemaphoreTake(mirror->mutex, portMAX_DELAY);
+    for (uint32_t i = 0; i < mirror->max_viewers; i++)
+    {
+        if (mirror->viewers[i].client)
+        {
+            mirror->viewers[i].need_keyframe = true;
+        }
+    }
+    xSemaphoreGive(mirror->mutex);
+}
+
+esp_err_t lcd_mirror_get_stats(lcd_mirror_handle_t mirror, lcd_mirror_stats_t *stats)
+{
+    if (mirror == NULL || stats == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    xSemaphoreTake(mirror->mutex, portMAX_DELAY);
+    *stats = mirror->stats;
+    xSemaphoreGive(mirror->mutex);
+
+    return ESP_OK;
+}
+
+esp_err_t lcd_mirror_update(lcd_mirror_handle_t mirror)
+{
+    if (mirror == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    xSemaphoreTake(mirror->mutex, portMAX_DELAY);
+    uint32_t viewer_count = mirror->viewer_count;
+    xSemaphoreGive(mirror->mutex);
+
+    // 没有查看端或未到间隔时不做任何事
+    sys_tick_t now = uptime();
+    if (viewer_count == 0 || !uptime_after(now, mirror->last_send + mirror->min_interval_ms - 1))
+    {
+        return ESP_OK;
+    }
+
+    // 按经过的时间补充可发送的字节数，最多补满一秒的量
+    if (mirror->max_bytes_per_sec)
+    {
+        uint64_t refill = (uint64_t)(now - mirror->last_refill) * mirror->max_bytes_per_sec / 1000;
+        if (refill > 0)
+        {
+            int64_t tokens = mirror->tokens + (int64_t)refill;
+            mirror->tokens = (tokens > mirror->max_bytes_per_sec) ? (int32_t)mirror->max_bytes_per_sec : (int32_t)tokens;
+            mirror->last_refill = now;
+        }
+
+        if (mirror->tokens <= 0)
+        {
+            xSemaphoreTake(mirror->mutex, portMAX_DELAY);
+            mirror->stats.skipped++;
+            xSemaphoreGive(mirror->mutex);
+            return ESP_OK;
+        }
+    }
+
+    mirror->last_send = now;
+
+    xSemaphoreTake(mirror->mutex, portMAX_DELAY);
+
+    bool need_delta = false, need_key = false;
+    for (uint32_t i = 0; i < mirror->max_viewers; i++)
+    {
+        if (mirror->viewers[i].client)
+        {
+            need_key |= mirror->viewers[i].need_keyframe;
+            need_delta |= !mirror->viewers[i].need_keyframe;
+        }
+    }
+
+    // 找出变化的块
+    uint16_t changed = 0;
+    for (uint16_t t = 0; t < mirror->tile_count; t++)
+    {
+        uint32_t offset = (uint32_t)t * mirror->tile_bytes;
+        uint32_t size = (mirror->fb_size - offset > mirror->tile_bytes) ? mirror->tile_bytes : mirror->fb_size - offset;
+        mirror->changed[t] = memcmp(&mirror->fb[offset], &mirror->shadow[offset], size) != 0;
+        changed += mirror->changed[t];
+    }
+
+    if (need_delta && changed > 0)
+    {
+        mirror->seq++;
+        send_frame(mirror, encode_frame(mirror, LCD_MIRROR_FRAME_DELTA), false);
+        mirror->stats.frames++;
+        mirror->stats.tiles += changed;
+    }
+
+    // 更新为查看端当前的内容，关键帧也从这里编码
+    for (uint16_t t = 0; t < mirror->tile_count && changed > 0; t++)
+    {
+        if (mirror->changed[t])
+        {
+            uint32_t offset = (uint32_t)t * mirror->tile_bytes;
+            uint32_t size = (mirror->fb_size - offset > mirror->tile_bytes) ? mirror->tile_bytes : mirror->fb_size - offset;
+            memcpy(&mirror->shadow[offset], &mirror->fb[offset], size);
+        }
+    }
+
+    if (need_key)
+    {
+        mirror->seq++;
+        send_frame(mirror, encode_frame(mirror, LCD_MIRROR_FRAME_KEY), true);
+        mirror->stats.keyframes++;
+        mirror->stats.tiles += mirror->tile_count;
+    }
+
+    // 记下发送失败的查看端的连接序号，释放锁之后再断开：TCP服务器持有它的锁调用断开回调，
+    // 回调里再获取mirror->mutex，持有mirror->mutex断开会死锁
+    uint32_t failed_ids[CONFIG_LCD_MIRROR_MAX_VIEWERS];
+    uint32_t failed_count = 0;
+    for (uint32_t i = 0; i < mirror->max_viewers; i++)
+    {
+        if (mirror->viewers[i].client && mirror->viewers[i].failed)
+        {
+            failed_ids[failed_count++] = mirror->viewers[i].client_id;
+        }
+    }
+
+    mirror->stats.dropped_viewers += failed_count;
+    xSemaphoreGive(mirror->mutex);
+
+    for (uint32_t i = 0; i < failed_count; i++)
+    {
+        // 按序号断开，期间已经断开、槽位被新连接复用时返回 ESP_ERR_NOT_FOUND
+        if (tcp_server_disconnect_client_by_id(mirror->server, failed_ids[i]) == ESP_OK)
+        {
+            ESP_LOGW(TAG, "Viewer too slow, disconnected");
+        }
+    }
+
+    return ESP_OK;
+}
@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+"""
+LCD远程镜像查看工具
+连接 lcd_mirror 组件的TCP端口，解码关键帧和差值帧，在终端中显示或保存为PBM图片
+帧格式见 lcd_mirror/include/lcd_mirror.h
+"""
+
+import sys
+import socket
+import struct
+import argparse
+from typing import Optional, Tuple
+
+# 与 lcd_mirror.h 一致
+MIRROR_MAGIC = 0x4D4C
+MIRROR_VERSION = 1
+FRAME_KEY = 0
+FRAME_DELTA = 1
+
+# magic, version, type, width, height, seq, tile_bytes, tile_count, payload_size
+HEADER_FORMAT = '<HBBHHIHHI'
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+
+
+def packbits_decode(data: bytes, size: int) -> bytes:
+    """PackBits解码, 控制字节0~127后跟n+1个原样字节, -1~-127表示下一个字节重复1-n次"""
+    out = bytearray()
+    i = 0
+    while i < len(data) and len(out) < size:
+        n = data[i]
+        i += 1
+        if n < 128:
+            out += data[i:i + n + 1]
+            i += n + 1
+        elif n > 128:
+            out += bytes([data[i]]) * (257 - n)
+            i += 1
+    if len(out) != size:
+        raise ValueError(f"PackBits size mismatch: {len(out)} != {size}")
+    return bytes(out)
+
+
+class MirrorFrame:
+    """镜像端的显存, 与设备的显存格式一致: 按位连续存储, 高位在左"""
+
+    def __init__(self):
+        self.width = 0
+        self.height = 0
+        self.fb = bytearray()
+        self.seq = 0
+        self.synced = False
+
+    def apply(self, header: Tuple, payload: bytes):
+        """把一帧的异或差值应用到显存"""
+        magic, version, frame_type, width, height, seq, tile_bytes, tile_count, _ = header
+
+        if magic != MIRROR_MAGIC or version != MIRROR_VERSION:
+            raise ValueError(f"Bad frame header: magic={magic:#x} version={version}")
+
+        if frame_type == FRAME_KEY:
+            # 关键帧的异或基准为全0
+            self.width, self.height = width, height
+            self.fb = bytearray((width * height + 7) // 8)
+            self.synced = True
+        elif not self.synced:
+            # 还没收到关键帧，差值帧没有基准
+            return
+
+        pos = 0
+        for _ in range(tile_count):
+            index, length = struct.unpack_from('<HH', payload, pos)
+            pos += 4
+            offset = index * tile_bytes
+            size = min(tile_bytes, len(self.fb) - offset)
+            delta = packbits_decode(payload[pos:pos + length], size)
+            pos += length
+            for i in range(size):
+                self.fb[offset + i] ^= delta[i]
+
+        self.seq = seq
+
+    def pixel(self, x: int, y: int) -> int:
+        offs = y * self.width + x
+        return (self.fb[offs >> 3] >> (7 - (offs & 7))) & 1
+
+    def render(self) -> str:
+        """用上下半块字符显示, 每个字符两行像素"""
+        blocks = {(0, 0): ' ', (1, 0): '▀', (0, 1): '▄', (1, 1): '█'}
+        lines = []
+        for y in range(0, self.height, 2):
+            line = []
+            for x in range(self.width):
+                top = self.pixel(x, y)
+                bottom = self.pixel(x, y + 1) if y + 1 < self.height else 0
+                line.append(blocks[(top, bottom)])
+            lines.append(''.join(line))
+        return '\n'.join(lines)
+
+    def save_pbm(self, path: str):
+        """保存为PBM图片, 每行按字节对齐"""
+        row_bytes = (self.width + 7) // 8
+        data = bytearray(row_bytes * self.height)
+        for y in range(self.height):
+            for x in range(self.width):
+                if self.pixel(x, y):
+                    data[y * row_bytes + (x >> 3)] |= 0x80 >> (x & 7)
+        with open(path, 'wb') as f:
+            f.write(f"P4\n{self.width} {self.height}\n".encode())
+            f.write(data)
+
+
+def recv_exact(sock: socket.socket, size: int) -> Optional[bytes]:
+    data = bytearray()
+    while len(data) < size:
+        chunk = sock.recv(size - len(data))
+        if not chunk:
+            return None
+        data += chunk
+    return bytes(data)
+
+
+def read_frame(sock: socket.socket) -> Optional[Tuple[Tuple, bytes]]:
+    raw = recv_exact(sock, HEADER_SIZE)
+    if raw is None:
+        return None
+    header = struct.unpack(HEADER_FORMAT, raw)
+    payload = recv_exact(sock, header[8])
+    if payload is None:
+        return None
+    return header, payload
+
+
+def main():
+    parser = argparse.ArgumentParser(description='LCD remote mirror viewer')
+    parser.add_argument('host', help='Device IP address')
+    parser.add_argument('port', type=int, help='lcd_mirror port')
+    parser.add_argument('--pbm', help='Save each frame to this PBM file instead of drawing in terminal')
+    parser.add_argument('--count', type=int, default=0, help='Exit after this many frames (0 = forever)')
+    parser.add_argument('--keyframe', action='store_true', help='Request a keyframe after connecting')
+    args = parser.parse_args()
+
+    frame = MirrorFrame()
+    with socket.create_connection((args.host, args.port)) as sock:
+        if args.keyframe:
+            sock.sendall(b'K')
+
+        received = 0
+        while args.count == 0 or received < args.count:
+            result = read_frame(sock)
+            if result is None:
+                print("Connection closed", file=sys.stderr)
+                break
+
+            header, payload = result
+            frame.apply(header, payload)
+            if not frame.synced:
+                continue
+            received += 1
+
+            if args.pbm:
+                frame.save_pbm(args.pbm)
+            else:
+                kind = 'key' if header[2] == FRAME_KEY else 'delta'
+                sys.stdout.write('\x1b[H\x1b[2J')
+                sys.stdout.write(frame.render())
+                sys.stdout.write(f"\nseq {header[5]} {kind} {header[7]} tiles {len(payload)} bytes\n")
+                sys.stdout.flush()
+
+
+if __name__ == '__main__':
+    main()
@@ -7,517 +7,366 @@
 extern "C" {
 #endif
 
-LCD_MONO_IMG_DEFINE(icon_100_32, 32, 32, 
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00,
-0x04, 0x01, 0x80, 0x20, 0x0e, 0x00, 0x00, 0x70,
-0x07, 0x00, 0x00, 0xe0, 0x03, 0x07, 0xe0, 0xc0,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x38, 0x1c, 0x00,
-0x00, 0x70, 0x0e, 0x00, 0x00, 0xe0, 0x07, 0x00,
-0x00, 0xc0, 0x03, 0x00, 0x01, 0x80, 0x01, 0x80,
-0x01, 0x80, 0x01, 0x80, 0xf9, 0x80, 0x01, 0x9f,
-0xf9, 0x80, 0x01, 0x9f, 0x01, 0x80, 0x01, 0x80,
-0x01, 0x80, 0x01, 0x80, 0x00, 0xc0, 0x03, 0x00,
-0x00, 0xe0, 0x07, 0x00, 0x00, 0x70, 0x0e, 0x00,
-0x00, 0x38, 0x1c, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x03, 0x07, 0xe1, 0xc0, 0x07, 0x00, 0x00, 0xe0,
-0x0e, 0x00, 0x00, 0x70, 0x04, 0x01, 0x80, 0x20,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_101_32, 32, 32, 
-0x00, 0x20, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
-0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x30, 0x00,
-0x00, 0x00, 0x60, 0x00, 0x30, 0x0c, 0x00, 0x00,
-0x3c, 0x7f, 0x80, 0x00, 0x1c, 0xff, 0xc0, 0x00,
-0x01, 0xc0, 0xe0, 0x00, 0x01, 0x80, 0x63, 0x80,
-0x03, 0x00, 0x37, 0x80, 0x03, 0x00, 0x30, 0x00,
-0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-0x7b, 0x03, 0xf0, 0x00, 0x70, 0x0f, 0xfc, 0x00,
-0x00, 0x3c, 0x0e, 0x00, 0x00, 0x70, 0x03, 0x00,
-0x01, 0xe0, 0x01, 0xa0, 0x0f, 0xc0, 0x01, 0xfc,
-0x1c, 0x00, 0x00, 0x8e, 0x18, 0x00, 0x00, 0x06,
-0x30, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x03,
-0x30, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x03,
-0x18, 0x00, 0x00, 0x06, 0x1f, 0xe0, 0x01, 0xfe,
-0x07, 0xf0, 0x03, 0xf8, 0x00, 0x3c, 0x0e, 0x00,
-0x00, 0x0f, 0xfc, 0x00, 0x00, 0x03, 0xf0, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_102_32, 32, 32, 
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00,
-0x04, 0x01, 0x80, 0x20, 0x0e, 0x00, 0x00, 0x70,
-0x07, 0x00, 0x00, 0xe0, 0x03, 0x07, 0xe0, 0xc0,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x38, 0x1c, 0x00,
-0x00, 0x70, 0x0e, 0x00, 0x00, 0xe0, 0x07, 0x00,
-0x00, 0xc0, 0x03, 0x00, 0x01, 0x80, 0x01, 0x80,
-0x01, 0x80, 0x01, 0x80, 0xf9, 0x80, 0x01, 0x9f,
-0xf9, 0x80, 0x01, 0x9f, 0x01, 0x80, 0x01, 0x80,
-0x01, 0x80, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00,
-0x00, 0xe0, 0x0f, 0x00, 0x00, 0x70, 0x3f, 0xc0,
-0x00, 0x30, 0x60, 0x60, 0x00, 0x07, 0xc0, 0x3c,
-0x03, 0x06, 0x00, 0x06, 0x07, 0x0c, 0x00, 0x03,
-0x0e, 0x0c, 0x00, 0x03, 0x04, 0x0c, 0x00, 0x03,
-0x00, 0x04, 0x00, 0x02, 0x00, 0x07, 0xe0, 0x7e,
-0x00, 0x01, 0xbf, 0xd8, 0x00, 0x00, 0x0f, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_103_32, 32, 32, 
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00,
-0x04, 0x01, 0x80, 0x00, 0x0e, 0x00, 0x00, 0x70,
-0x07, 0x00, 0x00, 0xe0, 0x03, 0x07, 0xe0, 0xc0,
-0x00, 0x1f, 0xf8, 0x80, 0x00, 0x38, 0x1c, 0x00,
-0x00, 0x70, 0x06, 0x00, 0x00, 0x60, 0x03, 0x00,
-0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x01, 0x80,
-0x00, 0xc0, 0x01, 0x80, 0xf9, 0x80, 0x01, 0x9f,
-0xf8, 0x80, 0x01, 0x9f, 0x00, 0xc0, 0x01, 0x80,
-0x00, 0xc0, 0x01, 0x80, 0x00, 0xe0, 0x00, 0x00,
-0x00, 0x60, 0x7e, 0x00, 0x00, 0x01, 0xff, 0x80,
-0x00, 0x0f, 0xc1, 0xf8, 0x00, 0x3f, 0x00, 0xfc,
-0x00, 0xf0, 0x00, 0x06, 0x07, 0xc0, 0x00, 0x03,
-0x0f, 0x80, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x03,
-0x0e, 0x00, 0x00, 0x07, 0x07, 0xe1, 0x81, 0xfe,
-0x03, 0xff, 0xff, 0xfc, 0x00, 0x1e, 0x7e, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_104_32, 32, 32, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00,
-0x00, 0x03, 0xfc, 0x00, 0x00, 0x0f, 0x0f, 0x00,
-0x00, 0x3c, 0x03, 0xc0, 0x00, 0xf8, 0x01, 0xf0,
-0x01, 0xc0, 0x00, 0x38, 0x03, 0x80, 0x00, 0x1c,
-0x03, 0x07, 0xe0, 0x0c, 0x02, 0x1f, 0xf8, 0x0c,
-0x00, 0x78, 0x1c, 0x0c, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_150_32, 32, 32, 
-0x00, 0x60, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00,
-0x03, 0xe0, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00,
-0x0e, 0x60, 0x00, 0x00, 0x1c, 0xc0, 0x00, 0x00,
-0x38, 0xc0, 0x00, 0x00, 0x30, 0xc0, 0x00, 0x00,
-0x70, 0xc0, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00,
-0x60, 0x60, 0x00, 0x00, 0xc0, 0x60, 0x00, 0x00,
-0xc0, 0x60, 0x00, 0x00, 0xc0, 0x70, 0x00, 0x00,
-0xc0, 0x30, 0x00, 0x00, 0xc0, 0x38, 0x00, 0x00,
-0xc0, 0x1c, 0x00, 0x00, 0xc0, 0x0e, 0x00, 0x00,
-0xc0, 0x07, 0x00, 0x00, 0x60, 0x03, 0x80, 0x00,
-0x60, 0x01, 0xe0, 0x00, 0x60, 0x00, 0x7c, 0x00,
-0x30, 0x00, 0x1f, 0xff, 0x38, 0x00, 0x03, 0xff,
-0x18, 0x00, 0x00, 0x06, 0x0c, 0x00, 0x00, 0x0e,
-0x0e, 0x00, 0x00, 0x1c, 0x07, 0x80, 0x00, 0x78,
-0x01, 0xc0, 0x00, 0xe0, 0x00, 0xf8, 0x07, 0xc0,
-0x00, 0x3f, 0xff, 0x00, 0x00, 0x07, 0xf8, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_151_32, 32, 32, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x70, 0x00,
-0x00, 0x00, 0xf0, 0x00, 0x00, 0x01, 0xf0, 0x00,
-0x00, 0x01, 0xb0, 0x00, 0x00, 0x03, 0x18, 0x00,
-0x00, 0x03, 0x18, 0x00, 0x00, 0x03, 0x1c, 0x00,
-0x00, 0x03, 0x0c, 0x00, 0x00, 0x03, 0x0e, 0x00,
-0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x01, 0xf3,
-0x00, 0x0f, 0xc0, 0xff, 0x00, 0x3f, 0xf0, 0x0e,
-0x00, 0xf0, 0x38, 0x0e, 0x01, 0xc0, 0x0c, 0x0c,
-0x03, 0x80, 0x06, 0x00, 0x3f, 0x00, 0x07, 0xf0,
-0x70, 0x00, 0x02, 0x38, 0x60, 0x00, 0x00, 0x18,
-0xc0, 0x00, 0x00, 0x0c, 0xc0, 0x00, 0x00, 0x0c,
-0xc0, 0x00, 0x00, 0x0c, 0xc0, 0x00, 0x00, 0x0c,
-0x60, 0x00, 0x00, 0x18, 0x7f, 0x80, 0x07, 0xf8,
-0x1f, 0xc0, 0x0f, 0xe0, 0x00, 0xf0, 0x38, 0x00,
-0x00, 0x3f, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_152_32, 32, 32, 
-0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-0x00, 0x0f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00,
-0x00, 0x3b, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00,
-0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00,
-0x00, 0xc3, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00,
-0x00, 0xc1, 0x80, 0x00, 0x00, 0xc1, 0xc0, 0x00,
-0x00, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0x60, 0x00,
-0x00, 0xc0, 0x78, 0x00, 0x00, 0x60, 0x1e, 0x00,
-0x00, 0x60, 0x0f, 0xe2, 0x00, 0x30, 0x03, 0xff,
-0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0e,
-0x00, 0xf0, 0x00, 0x3c, 0x03, 0xfc, 0x00, 0xf0,
-0x06, 0x06, 0x07, 0xe0, 0x7c, 0x03, 0xc3, 0x00,
-0x60, 0x00, 0x60, 0x00, 0xc0, 0x00, 0x30, 0x00,
-0xc0, 0x00, 0x30, 0x00, 0xc0, 0x00, 0x30, 0x00,
-0x40, 0x00, 0x20, 0x00, 0x7e, 0x07, 0xe0, 0x00,
-0x1b, 0xfd, 0x80, 0x00, 0x00, 0xf0, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_153_32, 32, 32, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-0x00, 0x07, 0x80, 0x00, 0x00, 0x0f, 0x00, 0x00,
-0x00, 0x1f, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00,
-0x00, 0x33, 0x00, 0x00, 0x00, 0x61, 0x80, 0x00,
-0x00, 0x61, 0x80, 0x00, 0x00, 0xc1, 0x80, 0x00,
-0x00, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xe0, 0x00,
-0x00, 0xc0, 0x60, 0x00, 0x00, 0xc0, 0x30, 0x00,
-0x00, 0xc0, 0x1c, 0x00, 0x00, 0xc0, 0x0f, 0x02,
-0x00, 0x60, 0x03, 0xff, 0x00, 0x60, 0x00, 0xff,
-0x00, 0x70, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0e,
-0x00, 0x07, 0xe0, 0x1c, 0x00, 0x1f, 0xf8, 0x18,
-0x00, 0xfc, 0x1f, 0x80, 0x03, 0xf0, 0x0f, 0xc0,
-0x0f, 0x00, 0x00, 0x60, 0x7c, 0x00, 0x00, 0x30,
-0xf8, 0x00, 0x00, 0x30, 0xc0, 0x00, 0x00, 0x30,
-0xe0, 0x00, 0x00, 0x70, 0x7e, 0x18, 0x1f, 0xe0,
-0x3f, 0xff, 0xff, 0xc0, 0x01, 0xe7, 0xe0, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_300_32, 32, 32, 
-0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
-0x00, 0x60, 0x00, 0x00, 0x18, 0x61, 0x80, 0x00,
-0x1c, 0x03, 0x80, 0x00, 0x0c, 0xfb, 0x00, 0x00,
-0x03, 0xf8, 0x00, 0x00, 0x07, 0x03, 0xf0, 0x00,
-0x06, 0x0f, 0xfc, 0x00, 0xf6, 0x3c, 0x0e, 0x00,
-0xf0, 0x70, 0x03, 0x00, 0x00, 0xe0, 0x01, 0x80,
-0x0f, 0xc0, 0x01, 0xfc, 0x1c, 0x00, 0x00, 0x8e,
-0x18, 0x00, 0x00, 0x06, 0x30, 0x00, 0x00, 0x03,
-0x30, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x03,
-0x30, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x06,
-0x1f, 0xe0, 0x01, 0xfe, 0x07, 0xf0, 0x03, 0xf8,
-0x00, 0x3c, 0x0e, 0x00, 0x00, 0x0f, 0xfc, 0x00,
-0x00, 0x03, 0xf0, 0x00, 0x00, 0x30, 0x03, 0x00,
-0x00, 0x78, 0x07, 0x80, 0x00, 0x78, 0x07, 0x80,
-0x00, 0x78, 0x07, 0x80, 0x00, 0x30, 0x03, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_301_32, 32, 32, 
-0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
-0x00, 0x60, 0x00, 0x00, 0x18, 0x61, 0x80, 0x00,
-0x1c, 0x03, 0x80, 0x00, 0x0c, 0xfb, 0x00, 0x00,
-0x03, 0xf8, 0x00, 0x00, 0x07, 0x03, 0xf0, 0x00,
-0x06, 0x0f, 0xfc, 0x00, 0xf6, 0x3c, 0x0e, 0x00,
-0xf0, 0x70, 0x03, 0x00, 0x00, 0xe0, 0x01, 0x80,
-0x0f, 0xc0, 0x01, 0xfc, 0x1c, 0x00, 0x00, 0x8e,
-0x18, 0x00, 0x00, 0x06, 0x30, 0x00, 0x00, 0x03,
-0x30, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x03,
-0x30, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x06,
-0x1f, 0xe0, 0x01, 0xfe, 0x07, 0xf0, 0x03, 0xf8,
-0x00, 0x3c, 0x0e, 0x00, 0x00, 0x0f, 0xfc, 0x00,
-0x00, 0x03, 0xf0, 0x00, 0x00, 0x60, 0x01, 0x80,
-0x00, 0xf0, 0x03, 0xc0, 0x00, 0xf0, 0xc3, 0xc0,
-0x00, 0xf1, 0xe3, 0xc0, 0x00, 0x61, 0xe1, 0x80,
-0x00, 0x01, 0xe0, 0x00, 0x00, 0x00, 0xc0, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_302_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x01, 0xc0, 0x00, 0x01, 0x83, 0xc1, 0x80,
-0x03, 0xc3, 0x83, 0xc0, 0x03, 0xc7, 0xf3, 0xc0,
-0x03, 0xc7, 0xe3, 0xc0, 0x01, 0x8f, 0xc1, 0x80,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_303_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x60, 0x00, 0x00, 0x06, 0xf0, 0x00, 0x00, 0x0f,
-0xf0, 0x01, 0xc0, 0x0f, 0xf1, 0x83, 0xc1, 0x8f,
-0x63, 0xc3, 0x83, 0xc6, 0x03, 0xc7, 0xf3, 0xc0,
-0x03, 0xc7, 0xe3, 0xc0, 0x01, 0x8f, 0xc1, 0x80,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_304_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x01, 0xc0, 0x00, 0x01, 0x83, 0xc1, 0x80,
-0x03, 0xc3, 0x83, 0xc0, 0x03, 0xc7, 0xf3, 0xc0,
-0x03, 0xc7, 0xe1, 0x80, 0x01, 0x8f, 0xc0, 0x00,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_305_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x06, 0x00,
-0x00, 0xf0, 0x0f, 0x00, 0x00, 0xf0, 0x0f, 0x00,
-0x00, 0xf0, 0x0f, 0x00, 0x00, 0x60, 0x06, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_306_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x60,
-0x0f, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xf0,
-0x0f, 0x00, 0x00, 0xf0, 0x06, 0x01, 0x80, 0x60,
-0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00,
-0x00, 0x03, 0xc0, 0x00, 0x00, 0x01, 0x80, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_307_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x18, 0x00, 0x00, 0x18, 0x3c, 0x00, 0x00, 0x3c,
-0x3c, 0x00, 0x00, 0x3c, 0x3c, 0x00, 0x00, 0x3c,
-0x18, 0x00, 0x00, 0x18, 0x00, 0x18, 0x18, 0x00,
-0x00, 0x3c, 0x3c, 0x00, 0x00, 0x3c, 0x3c, 0x00,
-0x00, 0x3c, 0x3c, 0x00, 0x00, 0x18, 0x18, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_308_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc6, 0x00, 0x00, 0x63,
-0xcf, 0x30, 0x0c, 0xf3, 0xcf, 0x30, 0x0c, 0xf3,
-0x0f, 0x30, 0x0c, 0xf0, 0x06, 0x31, 0x8c, 0x60,
-0x00, 0x33, 0xcc, 0x00, 0x00, 0x33, 0xcc, 0x00,
-0x00, 0x03, 0xc0, 0x00, 0x00, 0x01, 0x80, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_309_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xc0, 0x00,
-0x01, 0x00, 0x80, 0x40, 0x03, 0x01, 0x00, 0xc0,
-0x02, 0x01, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_310_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x18, 0x00, 0x00, 0x18, 0x3c, 0x00, 0x00, 0x3c,
-0x3c, 0x00, 0x00, 0x3c, 0x3c, 0x60, 0x06, 0x3c,
-0x18, 0xf0, 0x0f, 0x18, 0x00, 0xf0, 0x0f, 0x00,
-0x00, 0xf0, 0x0f, 0x00, 0x00, 0x61, 0x86, 0x00,
-0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00,
-0x00, 0x03, 0xc0, 0x00, 0x00, 0x01, 0x80, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_311_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xc0, 0x00, 0x0c, 0x30, 0xc3, 0x0c,
-0x0c, 0x31, 0x83, 0x0c, 0x18, 0x61, 0x86, 0x18,
-0x18, 0x63, 0x06, 0x18, 0x30, 0xc3, 0x0c, 0x30,
-0x30, 0xc6, 0x08, 0x30, 0x00, 0x06, 0x00, 0x00,
-0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_312_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x30, 0x82, 0x18, 0x43, 0x30, 0x86, 0x18, 0xc3,
-0x61, 0x84, 0x30, 0xc6, 0x63, 0x0c, 0x21, 0x86,
-0xc3, 0x18, 0x61, 0x0c, 0x82, 0x18, 0x41, 0x08,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_313_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x60, 0x07, 0xe0, 0x06,
-0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f,
-0x60, 0x00, 0x00, 0x06, 0x00, 0xc0, 0x03, 0x00,
-0x01, 0xe0, 0x07, 0x80, 0x01, 0xe0, 0x07, 0x80,
-0x00, 0xc0, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00,
-0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_314_32, 32, 32, 
-0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0xc0, 0x00,
-0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xff, 0x00,
-0x03, 0xee, 0x77, 0xc0, 0x0f, 0x0c, 0x30, 0xf0,
-0x1c, 0x1c, 0x38, 0x38, 0x38, 0x18, 0x18, 0x1c,
-0x30, 0x18, 0x18, 0x0c, 0x60, 0x30, 0x0c, 0x06,
-0x60, 0x30, 0x0c, 0x06, 0xcf, 0x33, 0xcc, 0xf3,
-0xff, 0xff, 0xff, 0xff, 0xf0, 0xfd, 0xbf, 0x0f,
-0xc0, 0x31, 0x8c, 0x03, 0x00, 0x01, 0x80, 0x00,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x98, 0x18,
-0x00, 0x01, 0xbc, 0x3c, 0x18, 0x61, 0xbc, 0x3c,
-0x3c, 0xf1, 0xbc, 0x3c, 0x3c, 0xf1, 0x98, 0x18,
-0x3c, 0xf1, 0x80, 0x00, 0x18, 0x61, 0x81, 0x80,
-0x00, 0x01, 0x83, 0xc0, 0x00, 0x01, 0x83, 0xc0,
-0x00, 0x01, 0x83, 0xc0, 0x00, 0x01, 0x81, 0x80,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_315_32, 32, 32, 
-0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0xc0, 0x00,
-0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xff, 0x00,
-0x03, 0xee, 0x77, 0xc0, 0x0f, 0x0c, 0x30, 0xf0,
-0x1c, 0x1c, 0x38, 0x38, 0x38, 0x18, 0x18, 0x1c,
-0x30, 0x18, 0x18, 0x0c, 0x60, 0x30, 0x0c, 0x06,
-0x60, 0x30, 0x0c, 0x06, 0xcf, 0x33, 0xcc, 0xf3,
-0xff, 0xff, 0xff, 0xff, 0xf0, 0xfd, 0xbf, 0x0f,
-0xc0, 0x31, 0x8c, 0x03, 0x00, 0x01, 0x80, 0x00,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00,
-0x00, 0x01, 0x86, 0x18, 0x18, 0x19, 0x8f, 0x3c,
-0x3c, 0x3d, 0x8f, 0x3c, 0x3c, 0x3d, 0x8f, 0x3c,
-0x3c, 0x3d, 0x86, 0x18, 0x18, 0x19, 0x80, 0x00,
-0x00, 0x01, 0x80, 0x00, 0x01, 0x81, 0x80, 0x00,
-0x03, 0xc1, 0x86, 0x18, 0x03, 0xc1, 0x8f, 0x3c,
-0x03, 0xc1, 0x8f, 0x3c, 0x01, 0x81, 0x8f, 0x3c,
-0x00, 0x01, 0x86, 0x18, 0x00, 0x01, 0x80, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_316_32, 32, 32, 
-0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0xc0, 0x00,
-0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xff, 0x00,
-0x03, 0xee, 0x77, 0xc0, 0x0f, 0x0c, 0x30, 0xf0,
-0x1c, 0x1c, 0x38, 0x38, 0x38, 0x18, 0x18, 0x1c,
-0x30, 0x18, 0x18, 0x0c, 0x60, 0x30, 0x0c, 0x06,
-0x60, 0x30, 0x0c, 0x06, 0xcf, 0x33, 0xcc, 0xf3,
-0xff, 0xff, 0xff, 0xff, 0xf0, 0xfd, 0xbf, 0x0f,
-0xc0, 0x31, 0x8c, 0x03, 0x00, 0x01, 0x80, 0x00,
-0x00, 0x01, 0x80, 0x00, 0x18, 0x61, 0x98, 0xc6,
-0x3c, 0xf1, 0xbd, 0xef, 0x3c, 0xf1, 0xbd, 0xef,
-0x3c, 0xf1, 0xbd, 0xef, 0x18, 0x61, 0x98, 0xc6,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00,
-0x00, 0x01, 0x80, 0x00, 0x18, 0x61, 0x86, 0x18,
-0x3c, 0xf1, 0x8f, 0x3c, 0x3c, 0xf1, 0x8f, 0x3c,
-0x3c, 0xf1, 0x8f, 0x3c, 0x18, 0x61, 0x86, 0x18,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_317_32, 32, 32, 
-0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0xc0, 0x00,
-0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xff, 0x00,
-0x03, 0xee, 0x77, 0xc0, 0x0f, 0x0c, 0x30, 0xf0,
-0x1c, 0x1c, 0x38, 0x38, 0x38, 0x18, 0x18, 0x1c,
-0x30, 0x18, 0x18, 0x0c, 0x60, 0x30, 0x0c, 0x06,
-0x60, 0x30, 0x0c, 0x06, 0xcf, 0x33, 0xcc, 0xf3,
-0xff, 0xff, 0xff, 0xff, 0xf0, 0xfd, 0xbf, 0x0f,
-0xc0, 0x31, 0x8c, 0x03, 0x00, 0x01, 0x80, 0x00,
-0x0c, 0x31, 0x8c, 0xcc, 0x0c, 0x31, 0x8c, 0xcc,
-0x0c, 0x31, 0x8c, 0xcc, 0x0c, 0x31, 0x8c, 0xcc,
-0x0c, 0x31, 0x8c, 0xcc, 0x0c, 0x31, 0x8c, 0xcc,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00,
-0x0c, 0x31, 0x83, 0x30, 0x0c, 0x31, 0x83, 0x30,
-0x0c, 0x31, 0x83, 0x30, 0x0c, 0x31, 0x83, 0x30,
-0x0c, 0x31, 0x83, 0x30, 0x0c, 0x31, 0x83, 0x30,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00
+LCD_MONO_RLE_IMG_DEFINE(icon_100_32, 32, 32, 
+0xf0, 0x2f, 0xf0, 0x2f, 0xf0, 0x2f, 0xf0, 0x2f,
+0x51, 0x92, 0x91, 0x93, 0xf3, 0x39, 0x3f, 0x13,
+0xb2, 0x56, 0x52, 0xf2, 0xaf, 0x63, 0x63, 0xf4,
+0x38, 0x3f, 0x23, 0xa3, 0xf1, 0x2c, 0x2f, 0x02,
+0xe2, 0xe2, 0xe2, 0x75, 0x22, 0xe2, 0x2a, 0x22,
+0xe2, 0x25, 0x72, 0xe2, 0xe2, 0xe2, 0xf0, 0x2c,
+0x2f, 0x13, 0xa3, 0xf2, 0x38, 0x3f, 0x43, 0x63,
+0xf6, 0xaf, 0x22, 0x56, 0x43, 0xb3, 0xf1, 0x39,
+0x3f, 0x33, 0x91, 0x92, 0x91, 0xf5, 0x2f, 0xf0,
+0x2f, 0xf0, 0x2f, 0xf0, 0x2f, 0x00
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_101_32, 32, 32, 
+0xa1, 0xff, 0x12, 0xff, 0x02, 0x62, 0xf7, 0x26,
+0x2f, 0xe2, 0xf0, 0x28, 0x2f, 0x54, 0x38, 0xf3,
+0x32, 0xaf, 0x63, 0x63, 0xf5, 0x28, 0x23, 0x3d,
+0x2a, 0x21, 0x4d, 0x2a, 0x2f, 0x32, 0xff, 0x02,
+0xfa, 0x41, 0x26, 0x6d, 0x38, 0xaf, 0x54, 0x63,
+0xf3, 0x3a, 0x2f, 0x04, 0xc2, 0x11, 0x96, 0xd7,
+0x53, 0xf3, 0x13, 0x34, 0x2f, 0x92, 0x32, 0xfb,
+0x22, 0x2f, 0xb2, 0x22, 0xfb, 0x22, 0x2f, 0xb2,
+0x32, 0xf9, 0x24, 0x8c, 0x86, 0x7a, 0x7d, 0x46,
+0x3f, 0x6a, 0xf9, 0x6c
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_102_32, 32, 32, 
+0xf0, 0x2f, 0xf0, 0x2f, 0xf0, 0x2f, 0xf0, 0x2f,
+0x51, 0x92, 0x91, 0x93, 0xf3, 0x39, 0x3f, 0x13,
+0xb2, 0x56, 0x52, 0xf2, 0xaf, 0x63, 0x63, 0xf4,
+0x38, 0x3f, 0x23, 0xa3, 0xf1, 0x2c, 0x2f, 0x02,
+0xe2, 0xe2, 0xe2, 0x75, 0x22, 0xe2, 0x2a, 0x22,
+0xe2, 0x25, 0x72, 0xe2, 0xe2, 0xff, 0x12, 0xff,
+0x03, 0x94, 0xf2, 0x36, 0x8f, 0x12, 0x52, 0x62,
+0xf3, 0x58, 0x48, 0x25, 0x2e, 0x26, 0x34, 0x2f,
+0x12, 0x43, 0x52, 0xf1, 0x25, 0x16, 0x2f, 0x12,
+0xd1, 0xf1, 0x1e, 0x66, 0x6f, 0x12, 0x18, 0x12,
+0xf8, 0x48
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_103_32, 32, 32, 
+0xf0, 0x2f, 0xf0, 0x2f, 0xf0, 0x2f, 0xf0, 0x2f,
+0x51, 0x92, 0xf4, 0x3f, 0x33, 0x93, 0xf1, 0x3b,
+0x25, 0x65, 0x2f, 0x2a, 0x31, 0xf2, 0x36, 0x3f,
+0x43, 0x92, 0xf3, 0x2b, 0x2f, 0x12, 0xc2, 0xf1,
+0x2d, 0x2f, 0x02, 0xd2, 0x75, 0x22, 0xe2, 0x2a,
+0x31, 0xe2, 0x25, 0x82, 0xd2, 0xf0, 0x2d, 0x2f,
+0x03, 0xff, 0x02, 0x66, 0xf9, 0xaf, 0x46, 0x56,
+0xd6, 0x86, 0xa4, 0xf2, 0x26, 0x5f, 0x52, 0x45,
+0xf6, 0x24, 0x2f, 0x92, 0x43, 0xf7, 0x35, 0x64,
+0x26, 0x87, 0xf9, 0xd4, 0x26, 0x90
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_104_32, 32, 32, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x6f, 0xa8,
+0xf7, 0x44, 0x4f, 0x34, 0x84, 0xe5, 0xa5, 0xb3,
+0xf1, 0x39, 0x3f, 0x33, 0x82, 0x56, 0x92, 0x81,
+0x4a, 0x72, 0xb4, 0x63, 0x62, 0xa3, 0x93, 0xf1,
+0x3c, 0x2c, 0x5d, 0x66, 0x7e, 0x73, 0x3f, 0x93,
+0x22, 0xfb, 0x21, 0x2f, 0xd4, 0xfd, 0x4f, 0xd4,
+0xfd, 0x21, 0x2f, 0xb2, 0x23, 0x41, 0xd2, 0x43,
+0x38, 0xc8, 0x67, 0x98, 0xd4, 0x63, 0xf6, 0xaf,
+0x96, 0xd0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_150_32, 32, 32, 
+0x92, 0xfd, 0x4f, 0xc5, 0xfb, 0x31, 0x2f, 0xa3,
+0x22, 0xf9, 0x32, 0x2f, 0x93, 0x32, 0xf9, 0x24,
+0x2f, 0x83, 0x42, 0xf8, 0x26, 0x2f, 0x72, 0x62,
+0xf6, 0x27, 0x2f, 0x62, 0x72, 0xf6, 0x27, 0x3f,
+0x52, 0x82, 0xf5, 0x28, 0x3f, 0x42, 0x93, 0xf3,
+0x2a, 0x3f, 0x22, 0xb3, 0xf2, 0x2b, 0x3f, 0x12,
+0xc4, 0xe2, 0xe5, 0xc2, 0xf0, 0xd2, 0x3f, 0x2a,
+0x32, 0xf9, 0x25, 0x2f, 0x73, 0x53, 0xf5, 0x37,
+0x4f, 0x14, 0xa3, 0xe3, 0xd5, 0x85, 0xf1, 0xef,
+0x68, 0xb0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_151_32, 32, 32, 
+0xff, 0xff, 0xf7, 0x2f, 0xe3, 0xfd, 0x4f, 0xc5,
+0xfc, 0x21, 0x2f, 0xb2, 0x32, 0xfa, 0x23, 0x2f,
+0xa2, 0x33, 0xf9, 0x24, 0x2f, 0x92, 0x43, 0xff,
+0x04, 0xff, 0x05, 0x22, 0xc6, 0x68, 0xaa, 0x83,
+0x94, 0x63, 0x73, 0x83, 0xa2, 0x62, 0x83, 0xc2,
+0xb6, 0xd7, 0x53, 0xf3, 0x13, 0x34, 0x2f, 0x92,
+0x32, 0xfb, 0x22, 0x2f, 0xb2, 0x22, 0xfb, 0x22,
+0x2f, 0xb2, 0x32, 0xf9, 0x24, 0x8c, 0x86, 0x7a,
+0x7d, 0x46, 0x3f, 0x6a, 0xf9, 0x6e
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_152_32, 32, 32, 
+0xe2, 0xfe, 0x3f, 0xd4, 0xfc, 0x5f, 0xb3, 0x12,
+0xfa, 0x32, 0x2f, 0xa2, 0x32, 0xfa, 0x23, 0x2f,
+0x92, 0x42, 0xf9, 0x24, 0x2f, 0x92, 0x52, 0xf8,
+0x25, 0x3f, 0x72, 0x62, 0xf7, 0x27, 0x2f, 0x62,
+0x74, 0xf5, 0x28, 0x4f, 0x32, 0x97, 0x31, 0xb2,
+0xaa, 0xfc, 0x4f, 0xe3, 0x94, 0xe4, 0x88, 0xa4,
+0x92, 0x62, 0x66, 0x65, 0x84, 0x42, 0x92, 0xe2,
+0xd2, 0xf1, 0x2c, 0x2f, 0x12, 0xc2, 0xf1, 0x2d,
+0x1f, 0x11, 0xe6, 0x66, 0xf1, 0x21, 0x81, 0x2f,
+0x84, 0xf5
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_153_32, 32, 32, 
+0xff, 0xf2, 0x1f, 0xe4, 0xfc, 0x4f, 0xc5, 0xfb,
+0x31, 0x2f, 0xb2, 0x22, 0xfa, 0x24, 0x2f, 0x92,
+0x42, 0xf8, 0x25, 0x2f, 0x82, 0x62, 0xf7, 0x26,
+0x3f, 0x62, 0x72, 0xf6, 0x28, 0x2f, 0x52, 0x93,
+0xf3, 0x2a, 0x46, 0x1a, 0x2b, 0xa9, 0x2d, 0x89,
+0x3f, 0x22, 0xfe, 0x3e, 0x68, 0x3d, 0xa6, 0x2b,
+0x65, 0x6d, 0x68, 0x6a, 0x4f, 0x22, 0x65, 0xf5,
+0x24, 0x5f, 0x62, 0x42, 0xf9, 0x24, 0x3f, 0x73,
+0x56, 0x42, 0x68, 0x7f, 0x9d, 0x42, 0x6d
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_300_32, 32, 32, 
+0x92, 0xff, 0x02, 0xff, 0x02, 0xf9, 0x24, 0x24,
+0x2f, 0x33, 0x83, 0xf4, 0x22, 0x51, 0x2f, 0x77,
+0xf9, 0x36, 0x6f, 0x22, 0x5a, 0xa4, 0x12, 0x34,
+0x63, 0x94, 0x53, 0xa2, 0xf1, 0x3c, 0x2b, 0x6d,
+0x75, 0x3f, 0x31, 0x33, 0x42, 0xf9, 0x23, 0x2f,
+0xb2, 0x22, 0xfb, 0x22, 0x2f, 0xb2, 0x22, 0xfb,
+0x23, 0x2f, 0x92, 0x48, 0xc8, 0x67, 0xa7, 0xd4,
+0x63, 0xf6, 0xaf, 0x96, 0xf7, 0x2a, 0x2f, 0x24,
+0x84, 0xf1, 0x48, 0x4f, 0x14, 0x84, 0xf2, 0x2a,
+0x2f, 0xff, 0xfc
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_301_32, 32, 32, 
+0x92, 0xff, 0x02, 0xff, 0x02, 0xf9, 0x24, 0x24,
+0x2f, 0x33, 0x83, 0xf4, 0x22, 0x51, 0x2f, 0x77,
+0xf9, 0x36, 0x6f, 0x22, 0x5a, 0xa4, 0x12, 0x34,
+0x63, 0x94, 0x53, 0xa2, 0xf1, 0x3c, 0x2b, 0x6d,
+0x75, 0x3f, 0x31, 0x33, 0x42, 0xf9, 0x23, 0x2f,
+0xb2, 0x22, 0xfb, 0x22, 0x2f, 0xb2, 0x22, 0xfb,
+0x23, 0x2f, 0x92, 0x48, 0xc8, 0x67, 0xa7, 0xd4,
+0x63, 0xf6, 0xaf, 0x96, 0xf6, 0x2c, 0x2f, 0x04,
+0xa4, 0xe4, 0x42, 0x44, 0xe4, 0x34, 0x34, 0xf0,
+0x24, 0x44, 0x2f, 0x74, 0xfe, 0x2e
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_302_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6f, 0xff, 0xff, 0xf2, 0x3f, 0x62, 0x54,
+0x52, 0xd4, 0x43, 0x54, 0xc4, 0x37, 0x24, 0xc4,
+0x36, 0x34, 0xd2, 0x36, 0x52, 0xf7, 0x2f, 0xf0,
+0x1f, 0xf0, 0x1f, 0xff, 0x40
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_303_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6e, 0x2f, 0xb2, 0x14, 0xf9, 0x8b, 0x3a,
+0x83, 0x25, 0x45, 0x23, 0x41, 0x23, 0x44, 0x35,
+0x43, 0x27, 0x43, 0x72, 0x4c, 0x43, 0x63, 0x4d,
+0x23, 0x65, 0x2f, 0x72, 0xff, 0x01, 0xff, 0x01,
+0xff, 0xf4
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_304_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6f, 0xff, 0xff, 0xf2, 0x3f, 0x62, 0x54,
+0x52, 0xd4, 0x43, 0x54, 0xc4, 0x37, 0x24, 0xc4,
+0x36, 0x42, 0xe2, 0x36, 0xfe, 0x2f, 0xf0, 0x1f,
+0xf0, 0x1f, 0xff, 0x40
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_305_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+0x2a, 0x2f, 0x24, 0x84, 0xf1, 0x48, 0x4f, 0x14,
+0x84, 0xf2, 0x2a, 0x2f, 0xff, 0xfd
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_306_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6f, 0xff, 0xff, 0xff, 0x92, 0xf3, 0x29,
+0x4f, 0x14, 0x84, 0xf1, 0x48, 0x4f, 0x14, 0x92,
+0x82, 0x82, 0xf4, 0x4f, 0xd4, 0xfd, 0x4f, 0xe2,
+0xf0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_307_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6f, 0xff, 0xff, 0x52, 0xf7, 0x25, 0x4f,
+0x54, 0x44, 0xf5, 0x44, 0x4f, 0x54, 0x52, 0xf7,
+0x2e, 0x26, 0x2f, 0x64, 0x44, 0xf5, 0x44, 0x4f,
+0x54, 0x44, 0xf6, 0x26, 0x2b
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_308_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6d, 0x2f, 0xd4, 0xfd, 0x4f, 0xd4, 0x32,
+0xf3, 0x23, 0x42, 0x42, 0x28, 0x22, 0x42, 0x42,
+0x42, 0x28, 0x22, 0x42, 0x24, 0x42, 0x28, 0x22,
+0x49, 0x23, 0x23, 0x23, 0x23, 0x2f, 0x02, 0x24,
+0x22, 0xf5, 0x22, 0x42, 0x2f, 0x94, 0xfe, 0x2f,
+0x00
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_309_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f,
+0xf0, 0x2f, 0x61, 0x81, 0x81, 0xc2, 0x71, 0x82,
+0xc1, 0x81, 0x81, 0xf6, 0x1f, 0xf1, 0x1f, 0xff,
+0x40
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_310_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6f, 0x12, 0xf7, 0x25, 0x4f, 0x54, 0x44,
+0xf5, 0x44, 0x43, 0x2a, 0x23, 0x45, 0x23, 0x48,
+0x43, 0x2b, 0x48, 0x4f, 0x14, 0x84, 0xf2, 0x24,
+0x24, 0x2f, 0x84, 0xfd, 0x4f, 0xd4, 0xfe, 0x2f,
+0x00
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_311_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6f, 0xff, 0xff, 0xf3, 0x2f, 0x32, 0x42,
+0x42, 0x42, 0x42, 0x62, 0x42, 0x32, 0x52, 0x42,
+0x52, 0x42, 0x42, 0x42, 0x42, 0x62, 0x42, 0x32,
+0x52, 0x42, 0x52, 0x42, 0x42, 0x42, 0x42, 0x62,
+0x42, 0x32, 0x51, 0x52, 0xf2, 0x2f, 0xe2, 0xff,
+0x02, 0xf3
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_312_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6f, 0xff, 0xff, 0xff, 0xff, 0x82, 0x41,
+0x51, 0x42, 0x41, 0x42, 0x22, 0x41, 0x42, 0x42,
+0x32, 0x42, 0x12, 0x42, 0x41, 0x42, 0x42, 0x32,
+0x22, 0x32, 0x42, 0x41, 0x42, 0x42, 0x12, 0x42,
+0x32, 0x42, 0x41, 0x42, 0x21, 0x51, 0x42, 0x41,
+0x51, 0x41, 0xff, 0xff, 0x70
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_313_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xc2, 0xa6, 0xa2, 0x14, 0xf9, 0x8f, 0x94, 0x12,
+0xfb, 0x29, 0x2c, 0x2f, 0x04, 0xa4, 0xe4, 0xa4,
+0xf0, 0x2c, 0x2f, 0x82, 0xfe, 0x4f, 0xd4, 0xfe,
+0x2f, 0xff, 0x20
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_314_32, 32, 32, 
+0xf0, 0x2f, 0xe4, 0xf9, 0xcf, 0x3f, 0x1e, 0x51,
+0x32, 0x31, 0x5a, 0x44, 0x24, 0x24, 0x47, 0x35,
+0x34, 0x35, 0x35, 0x36, 0x26, 0x26, 0x34, 0x27,
+0x26, 0x27, 0x23, 0x27, 0x28, 0x27, 0x22, 0x27,
+0x28, 0x27, 0x21, 0x22, 0x42, 0x22, 0x42, 0x22,
+0x42, 0xff, 0x84, 0x61, 0x21, 0x64, 0x68, 0x23,
+0x23, 0x28, 0x2f, 0x02, 0xff, 0x02, 0xff, 0x02,
+0xff, 0x02, 0xff, 0x02, 0x22, 0x62, 0xf3, 0x21,
+0x44, 0x45, 0x24, 0x24, 0x21, 0x44, 0x44, 0x42,
+0x43, 0x21, 0x44, 0x44, 0x42, 0x43, 0x22, 0x26,
+0x25, 0x42, 0x43, 0x2f, 0x32, 0x42, 0x42, 0x62,
+0xf7, 0x25, 0x4f, 0x62, 0x54, 0xf6, 0x25, 0x4f,
+0x62, 0x62, 0xf7, 0x2f, 0xf0, 0x2f, 0x00
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_315_32, 32, 32, 
+0xf0, 0x2f, 0xe4, 0xf9, 0xcf, 0x3f, 0x1e, 0x51,
+0x32, 0x31, 0x5a, 0x44, 0x24, 0x24, 0x47, 0x35,
+0x34, 0x35, 0x35, 0x36, 0x26, 0x26, 0x34, 0x27,
+0x26, 0x27, 0x23, 0x27, 0x28, 0x27, 0x22, 0x27,
+0x28, 0x27, 0x21, 0x22, 0x42, 0x22, 0x42, 0x22,
+0x42, 0xff, 0x84, 0x61, 0x21, 0x64, 0x68, 0x23,
+0x23, 0x28, 0x2f, 0x02, 0xff, 0x02, 0xff, 0x02,
+0xff, 0x02, 0x42, 0x42, 0x62, 0x62, 0x22, 0x34,
+0x24, 0x44, 0x44, 0x12, 0x34, 0x24, 0x44, 0x44,
+0x12, 0x34, 0x24, 0x44, 0x44, 0x12, 0x42, 0x42,
+0x62, 0x62, 0x22, 0xff, 0x02, 0xf7, 0x26, 0x2f,
+0x64, 0x52, 0x42, 0x42, 0x94, 0x52, 0x34, 0x24,
+0x84, 0x52, 0x34, 0x24, 0x92, 0x62, 0x34, 0x24,
+0xf2, 0x24, 0x24, 0x2f, 0x32, 0xf0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_316_32, 32, 32, 
+0xf0, 0x2f, 0xe4, 0xf9, 0xcf, 0x3f, 0x1e, 0x51,
+0x32, 0x31, 0x5a, 0x44, 0x24, 0x24, 0x47, 0x35,
+0x34, 0x35, 0x35, 0x36, 0x26, 0x26, 0x34, 0x27,
+0x26, 0x27, 0x23, 0x27, 0x28, 0x27, 0x22, 0x27,
+0x28, 0x27, 0x21, 0x22, 0x42, 0x22, 0x42, 0x22,
+0x42, 0xff, 0x84, 0x61, 0x21, 0x64, 0x68, 0x23,
+0x23, 0x28, 0x2f, 0x02, 0xff, 0x02, 0xf3, 0x24,
+0x24, 0x22, 0x23, 0x23, 0x23, 0x42, 0x43, 0x21,
+0x41, 0x41, 0x42, 0x42, 0x43, 0x21, 0x41, 0x41,
+0x42, 0x42, 0x43, 0x21, 0x41, 0x41, 0x43, 0x24,
+0x24, 0x22, 0x23, 0x23, 0x2f, 0x12, 0xff, 0x02,
+0xff, 0x02, 0xf3, 0x24, 0x24, 0x24, 0x24, 0x25,
+0x42, 0x43, 0x23, 0x42, 0x44, 0x42, 0x43, 0x23,
+0x42, 0x44, 0x42, 0x43, 0x23, 0x42, 0x45, 0x24,
+0x24, 0x24, 0x24, 0x2f, 0x32, 0xff, 0x02, 0xf0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_317_32, 32, 32, 
+0xf0, 0x2f, 0xe4, 0xf9, 0xcf, 0x3f, 0x1e, 0x51,
+0x32, 0x31, 0x5a, 0x44, 0x24, 0x24, 0x47, 0x35,
+0x34, 0x35, 0x35, 0x36, 0x26, 0x26, 0x34, 0x27,
+0x26, 0x27, 0x23, 0x27, 0x28, 0x27, 0x22, 0x27,
+0x28, 0x27, 0x21, 0x22, 0x42, 0x22, 0x42, 0x22,
+0x42, 0xff, 0x84, 0x61, 0x21, 0x64, 0x68, 0x23,
+0x23, 0x28, 0x2f, 0x02, 0xf4, 0x24, 0x23, 0x23,
+0x22, 0x22, 0x26, 0x24, 0x23, 0x23, 0x22, 0x22,
+0x26, 0x24, 0x23, 0x23, 0x22, 0x22, 0x26, 0x24,
+0x23, 0x23, 0x22, 0x22, 0x26, 0x24, 0x23, 0x23,
+0x22, 0x22, 0x26, 0x24, 0x23, 0x23, 0x22, 0x22,
+0x2f, 0x22, 0xff, 0x02, 0xf4, 0x24, 0x23, 0x25,
+0x22, 0x28, 0x24, 0x23, 0x25, 0x22, 0x28, 0x24,
+0x23, 0x25, 0x22, 0x28, 0x24, 0x23, 0x25, 0x22,
+0x28, 0x24, 0x23, 0x25, 0x22, 0x28, 0x24, 0x23,
+0x25, 0x22, 0x2f, 0x42, 0xff, 0x02, 0xf0
 );
 
 LCD_MONO_IMG_DEFINE(icon_318_32, 32, 32, 
@@ -539,802 +388,533 @@ LCD_MONO_IMG_DEFINE(icon_318_32, 32, 32,
 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00
 );
 
-LCD_MONO_IMG_DEFINE(icon_350_32, 32, 32, 
-0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0e, 0x00,
-0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00,
-0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x37, 0x00,
-0x00, 0x00, 0x13, 0x00, 0x00, 0x0f, 0xc1, 0xc0,
-0x00, 0x3f, 0xf0, 0xf0, 0x00, 0xf0, 0x38, 0x7e,
-0x01, 0xc0, 0x0c, 0x1e, 0x03, 0x80, 0x06, 0x0c,
-0x3f, 0x00, 0x07, 0xf0, 0x70, 0x00, 0x02, 0x38,
-0x60, 0x00, 0x00, 0x18, 0xc0, 0x00, 0x00, 0x0c,
-0xc0, 0x00, 0x00, 0x0c, 0xc0, 0x00, 0x00, 0x0c,
-0xc0, 0x00, 0x00, 0x0c, 0x60, 0x00, 0x00, 0x18,
-0x7f, 0x80, 0x07, 0xf8, 0x1f, 0xc0, 0x0f, 0xe0,
-0x00, 0xf0, 0x38, 0x00, 0x00, 0x3f, 0xf0, 0x00,
-0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0c, 0x00,
-0x01, 0xe0, 0x1e, 0x00, 0x01, 0xe0, 0x1e, 0x00,
-0x01, 0xe0, 0x1e, 0x00, 0x00, 0xc0, 0x0c, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_351_32, 32, 32, 
-0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0e, 0x00,
-0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00,
-0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x37, 0x00,
-0x00, 0x00, 0x13, 0x00, 0x00, 0x0f, 0xc1, 0xc0,
-0x00, 0x3f, 0xf0, 0xf0, 0x00, 0xf0, 0x38, 0x7e,
-0x01, 0xc0, 0x0c, 0x1e, 0x03, 0x80, 0x06, 0x0c,
-0x3f, 0x00, 0x07, 0xf0, 0x70, 0x00, 0x02, 0x38,
-0x60, 0x00, 0x00, 0x18, 0xc0, 0x00, 0x00, 0x0c,
-0xc0, 0x00, 0x00, 0x0c, 0xc0, 0x00, 0x00, 0x0c,
-0xc0, 0x00, 0x00, 0x0c, 0x60, 0x00, 0x00, 0x18,
-0x7f, 0x80, 0x07, 0xf8, 0x1f, 0xc0, 0x0f, 0xe0,
-0x00, 0xf0, 0x38, 0x00, 0x00, 0x3f, 0xf0, 0x00,
-0x00, 0x0f, 0xc0, 0x00, 0x01, 0x80, 0x06, 0x00,
-0x03, 0xc0, 0x0f, 0x00, 0x03, 0xc3, 0x0f, 0x00,
-0x03, 0xc7, 0x8f, 0x00, 0x01, 0x87, 0x86, 0x00,
-0x00, 0x07, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_399_32, 32, 32, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-0x00, 0x00, 0x00, 0xf0, 0x00, 0x60, 0x01, 0x98,
-0x00, 0xf0, 0x01, 0x98, 0x00, 0xf0, 0x03, 0x0c,
-0x01, 0x98, 0x06, 0x06, 0x03, 0x9c, 0x06, 0x06,
-0x03, 0x0c, 0x0c, 0x02, 0x06, 0x06, 0x0c, 0x03,
-0x0e, 0x07, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03,
-0x1c, 0x03, 0x8c, 0x03, 0x18, 0x01, 0x86, 0x06,
-0x30, 0x00, 0xc3, 0xfc, 0x30, 0x00, 0xc1, 0xf8,
-0x70, 0x00, 0xe0, 0x00, 0x60, 0x00, 0x60, 0x00,
-0x60, 0x00, 0x60, 0x00, 0xc0, 0x00, 0x30, 0x00,
-0xc0, 0x00, 0x30, 0x00, 0xc0, 0x00, 0x30, 0x00,
-0xc0, 0x00, 0x30, 0x00, 0xc0, 0x00, 0x30, 0x00,
-0xc0, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60, 0x00,
-0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0xc0, 0x00,
-0x38, 0x01, 0xc0, 0x00, 0x1e, 0x07, 0x80, 0x00,
-0x07, 0xfe, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_400_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x30, 0x0c, 0x00, 0x00, 0xf8, 0x3e, 0x00,
-0x00, 0x78, 0x1e, 0x00, 0x00, 0x78, 0x1e, 0x00,
-0x00, 0x78, 0x1e, 0x00, 0x00, 0x30, 0x0c, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_401_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x03, 0x00, 0x00, 0xc0, 0x0f, 0x80, 0x03, 0xe0,
-0x07, 0x80, 0x01, 0xe0, 0x07, 0x80, 0x01, 0xe0,
-0x07, 0x81, 0x81, 0xe0, 0x03, 0x07, 0xc0, 0xc0,
-0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00,
-0x00, 0x03, 0xc0, 0x00, 0x00, 0x01, 0x80, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_402_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x30, 0x00, 0x00, 0x0c, 0xf8, 0x00, 0x00, 0x3e,
-0x78, 0x00, 0x00, 0x1e, 0x78, 0x00, 0x00, 0x1e,
-0x78, 0x30, 0x0c, 0x1e, 0x30, 0xf8, 0x3e, 0x0c,
-0x00, 0x78, 0x1e, 0x00, 0x00, 0x78, 0x1e, 0x00,
-0x00, 0x78, 0x1e, 0x00, 0x00, 0x30, 0x0c, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_403_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x30, 0x00, 0x00, 0x0c, 0xf8, 0x00, 0x00, 0x3e,
-0x78, 0x00, 0x00, 0x1e, 0x78, 0x00, 0x00, 0x1e,
-0x78, 0xc0, 0x03, 0x1e, 0x33, 0xe0, 0x0f, 0x8c,
-0x01, 0xe1, 0x87, 0x80, 0x01, 0xe7, 0xc7, 0x80,
-0x01, 0xe3, 0xc7, 0x80, 0x00, 0xc3, 0xc3, 0x00,
-0x00, 0x03, 0xc0, 0x00, 0x00, 0x01, 0x80, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_404_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
-0x3c, 0x00, 0x00, 0x3c, 0x3c, 0x00, 0x00, 0x3c,
-0x3c, 0x30, 0x0c, 0x3c, 0x18, 0xf8, 0x3e, 0x18,
-0x00, 0x78, 0x1e, 0x00, 0x00, 0x78, 0x1e, 0x00,
-0x00, 0x78, 0x1e, 0x00, 0x00, 0x30, 0x0c, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_405_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x30, 0x0c, 0x60, 0x60, 0xf8, 0x3e,
-0xf0, 0xf0, 0x78, 0x1e, 0xf0, 0xf0, 0x78, 0x1e,
-0xf0, 0xf0, 0x78, 0x1e, 0x60, 0x60, 0x30, 0x0c,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_406_32, 32, 32, 
-0x00, 0x20, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
-0x00, 0x60, 0x00, 0x00, 0x18, 0x21, 0xc0, 0x00,
-0x1c, 0x01, 0x80, 0x00, 0x0c, 0xf9, 0x00, 0x00,
-0x01, 0xf8, 0x00, 0x00, 0x03, 0x83, 0xf0, 0x00,
-0x07, 0x0f, 0xfc, 0x00, 0x76, 0x3c, 0x0e, 0x00,
-0x70, 0x70, 0x03, 0x00, 0x00, 0xe0, 0x01, 0x80,
-0x0f, 0xc0, 0x01, 0xfc, 0x1c, 0x00, 0x00, 0x8e,
-0x18, 0x00, 0x00, 0x06, 0x30, 0x00, 0x00, 0x03,
-0x30, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x03,
-0x30, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x06,
-0x1f, 0xe0, 0x01, 0xfe, 0x07, 0xf0, 0x03, 0xf8,
-0x00, 0x3c, 0x0e, 0x00, 0x00, 0x0f, 0xfc, 0x00,
-0x00, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x02, 0x00, 0x00, 0x30, 0x0f, 0x80,
-0x00, 0x38, 0x0f, 0x00, 0x00, 0x78, 0x0f, 0x00,
-0x00, 0x78, 0x0f, 0x80, 0x00, 0x30, 0x02, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_407_32, 32, 32, 
-0x00, 0x20, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
-0x00, 0x60, 0x00, 0x00, 0x18, 0x21, 0xc0, 0x00,
-0x1c, 0x01, 0x80, 0x00, 0x0c, 0xf9, 0x00, 0x00,
-0x01, 0xf8, 0x00, 0x00, 0x03, 0x83, 0xf0, 0x00,
-0x07, 0x0f, 0xfc, 0x00, 0x76, 0x3c, 0x0e, 0x00,
-0x70, 0x70, 0x03, 0x00, 0x00, 0xe0, 0x01, 0x80,
-0x0f, 0xc0, 0x01, 0xfc, 0x1c, 0x00, 0x00, 0x8e,
-0x18, 0x00, 0x00, 0x06, 0x30, 0x00, 0x00, 0x03,
-0x30, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x03,
-0x30, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x06,
-0x1f, 0xe0, 0x01, 0xfe, 0x07, 0xf0, 0x03, 0xf8,
-0x00, 0x3c, 0x0e, 0x00, 0x00, 0x0f, 0xfc, 0x00,
-0x00, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x18, 0x06, 0x00, 0x00, 0x7c, 0x0f, 0x00,
-0x00, 0x3c, 0x0f, 0x00, 0x00, 0x3c, 0x0f, 0x00,
-0x00, 0x7c, 0x1f, 0x00, 0x00, 0x18, 0x06, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_408_32, 32, 32, 
-0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0xc0, 0x00,
-0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xff, 0x00,
-0x03, 0xee, 0x77, 0xc0, 0x0f, 0x0c, 0x30, 0xf0,
-0x1c, 0x1c, 0x38, 0x38, 0x38, 0x18, 0x18, 0x1c,
-0x30, 0x18, 0x18, 0x0c, 0x60, 0x30, 0x0c, 0x06,
-0x60, 0x30, 0x0c, 0x06, 0xcf, 0x33, 0xcc, 0xf3,
-0xff, 0xff, 0xff, 0xff, 0xf0, 0xfd, 0xbf, 0x0f,
-0xc0, 0x31, 0x8c, 0x03, 0x00, 0x01, 0x80, 0x00,
-0x00, 0x01, 0x80, 0xc0, 0x00, 0x01, 0x83, 0xe0,
-0x00, 0x01, 0x81, 0xe0, 0x00, 0x01, 0x81, 0xe0,
-0x03, 0x01, 0x81, 0xe0, 0x0f, 0x81, 0x80, 0xc0,
-0x07, 0x81, 0x80, 0x00, 0x07, 0x81, 0x80, 0x00,
-0x07, 0x81, 0x80, 0xc0, 0x03, 0x01, 0x83, 0xe0,
-0x00, 0x01, 0x81, 0xe0, 0x00, 0x01, 0x81, 0xe0,
-0x00, 0x01, 0x81, 0xe0, 0x00, 0x01, 0x80, 0xc0,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_409_32, 32, 32, 
-0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0xc0, 0x00,
-0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xff, 0x00,
-0x03, 0xee, 0x77, 0xc0, 0x0f, 0x0c, 0x30, 0xf0,
-0x1c, 0x1c, 0x38, 0x38, 0x38, 0x18, 0x18, 0x1c,
-0x30, 0x18, 0x18, 0x0c, 0x60, 0x30, 0x0c, 0x06,
-0x60, 0x30, 0x0c, 0x06, 0xcf, 0x33, 0xcc, 0xf3,
-0xff, 0xff, 0xff, 0xff, 0xf0, 0xfd, 0xbf, 0x0f,
-0xc0, 0x31, 0x8c, 0x03, 0x00, 0x01, 0x80, 0x00,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00,
-0x30, 0x31, 0x8c, 0x0c, 0xf8, 0xf9, 0x9e, 0x3e,
-0x78, 0x79, 0x9e, 0x1e, 0x78, 0x79, 0x9e, 0x1e,
-0x78, 0x79, 0x9e, 0x1e, 0x30, 0x31, 0x8c, 0x0c,
-0x00, 0x01, 0x80, 0xc0, 0x00, 0x01, 0x83, 0xe0,
-0x00, 0x01, 0x81, 0xe0, 0x00, 0x01, 0x81, 0xe0,
-0x00, 0x01, 0x81, 0xe0, 0x00, 0x01, 0x80, 0xc0,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_410_32, 32, 32, 
-0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0xc0, 0x00,
-0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xff, 0x00,
-0x03, 0xee, 0x77, 0xc0, 0x0f, 0x0c, 0x30, 0xf0,
-0x1c, 0x1c, 0x38, 0x38, 0x38, 0x18, 0x18, 0x1c,
-0x30, 0x18, 0x18, 0x0c, 0x60, 0x30, 0x0c, 0x06,
-0x60, 0x30, 0x0c, 0x06, 0xcf, 0x33, 0xcc, 0xf3,
-0xff, 0xff, 0xff, 0xff, 0xf0, 0xfd, 0xbf, 0x0f,
-0xc0, 0x31, 0x8c, 0x03, 0x00, 0x01, 0x80, 0x00,
-0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x8c, 0x0c,
-0x30, 0x31, 0x9e, 0x3e, 0xf8, 0xf9, 0x9e, 0x1e,
-0x78, 0x79, 0x9e, 0x1e, 0x78, 0x79, 0x9e, 0x1e,
-0x78, 0x79, 0x8c, 0x0c, 0x30, 0x31, 0x80, 0x00,
-0x03, 0x01, 0x80, 0x00, 0x0f, 0x81, 0x8c, 0x0c,
-0x07, 0x81, 0xbe, 0x3e, 0x07, 0x81, 0x9e, 0x1e,
-0x07, 0x81, 0x9e, 0x1e, 0x03, 0x01, 0x9e, 0x1e,
-0x00, 0x01, 0x8c, 0x0c, 0x00, 0x01, 0x80, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_456_32, 32, 32, 
-0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0e, 0x00,
-0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00,
-0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x37, 0x00,
-0x00, 0x00, 0x13, 0x00, 0x00, 0x0f, 0xc1, 0xc0,
-0x00, 0x3f, 0xf0, 0xf0, 0x00, 0xf0, 0x38, 0x7e,
-0x01, 0xc0, 0x0c, 0x1e, 0x03, 0x80, 0x06, 0x0c,
-0x3f, 0x00, 0x07, 0xf0, 0x70, 0x00, 0x02, 0x38,
-0x60, 0x00, 0x00, 0x18, 0xc0, 0x00, 0x00, 0x0c,
-0xc0, 0x00, 0x00, 0x0c, 0xc0, 0x00, 0x00, 0x0c,
-0xc0, 0x00, 0x00, 0x0c, 0x60, 0x00, 0x00, 0x18,
-0x7f, 0x80, 0x07, 0xf8, 0x1f, 0xc0, 0x0f, 0xe0,
-0x00, 0xf0, 0x38, 0x00, 0x00, 0x3f, 0xf0, 0x00,
-0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x08, 0x00, 0x00, 0xc0, 0x3e, 0x00,
-0x00, 0xe0, 0x3c, 0x00, 0x01, 0xe0, 0x3c, 0x00,
-0x01, 0xe0, 0x3e, 0x00, 0x00, 0xc0, 0x08, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_457_32, 32, 32, 
-0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0e, 0x00,
-0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00,
-0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x37, 0x00,
-0x00, 0x00, 0x13, 0x00, 0x00, 0x0f, 0xc1, 0xc0,
-0x00, 0x3f, 0xf0, 0xf0, 0x00, 0xf0, 0x38, 0x7e,
-0x01, 0xc0, 0x0c, 0x1e, 0x03, 0x80, 0x06, 0x0c,
-0x3f, 0x00, 0x07, 0xf0, 0x70, 0x00, 0x02, 0x38,
-0x60, 0x00, 0x00, 0x18, 0xc0, 0x00, 0x00, 0x0c,
-0xc0, 0x00, 0x00, 0x0c, 0xc0, 0x00, 0x00, 0x0c,
-0xc0, 0x00, 0x00, 0x0c, 0x60, 0x00, 0x00, 0x18,
-0x7f, 0x80, 0x07, 0xf8, 0x1f, 0xc0, 0x0f, 0xe0,
-0x00, 0xf0, 0x38, 0x00, 0x00, 0x3f, 0xf0, 0x00,
-0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x60, 0x18, 0x00, 0x01, 0xf0, 0x7c, 0x00,
-0x00, 0xf0, 0x3c, 0x00, 0x00, 0xf0, 0x3c, 0x00,
-0x01, 0xf0, 0x7c, 0x00, 0x00, 0x60, 0x18, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_499_32, 32, 32, 
-0x00, 0x01, 0x80, 0x00, 0x00, 0x11, 0x90, 0x00,
-0x00, 0x3d, 0xb8, 0x00, 0x00, 0x1f, 0xf0, 0x00,
-0x00, 0x0f, 0xe0, 0x40, 0x06, 0x07, 0xc0, 0xe0,
-0x06, 0x03, 0x80, 0xe0, 0x07, 0x01, 0x80, 0xc8,
-0x3f, 0x01, 0x80, 0xfc, 0x3f, 0x03, 0x81, 0xf8,
-0x0f, 0x8f, 0xf1, 0xf0, 0x1f, 0xdf, 0xff, 0xfe,
-0x7f, 0xfc, 0x3f, 0x3e, 0x70, 0x70, 0x1c, 0x00,
-0x00, 0x30, 0x0c, 0x00, 0x00, 0x70, 0x0e, 0x00,
-0x00, 0x70, 0x0e, 0x00, 0x00, 0x30, 0x0c, 0x00,
-0x00, 0x38, 0x1e, 0x0e, 0x7c, 0xfc, 0x3f, 0xfe,
-0x3f, 0xff, 0xfb, 0xf8, 0x0f, 0x8f, 0xe1, 0xf0,
-0x1f, 0x81, 0xc0, 0xfc, 0x3f, 0x01, 0x80, 0xfc,
-0x13, 0x01, 0x80, 0xe0, 0x07, 0x01, 0xc0, 0x60,
-0x07, 0x03, 0xe0, 0x60, 0x02, 0x07, 0xf0, 0x00,
-0x00, 0x0f, 0xf8, 0x00, 0x00, 0x1d, 0xb8, 0x00,
-0x00, 0x19, 0x88, 0x00, 0x00, 0x01, 0x80, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_500_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_501_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x03, 0xfc, 0xff, 0xff, 0x03, 0xfc, 0xff, 0xff,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xf0
-);
-
-LCD_MONO_IMG_DEFINE(icon_502_32, 32, 32, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x01, 0xf0,
-0x1f, 0xe0, 0x07, 0xf8, 0x38, 0x78, 0x1e, 0x1c,
-0x60, 0x1c, 0x38, 0x06, 0xe0, 0x0e, 0x70, 0x06,
-0xc0, 0x07, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
-0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x07, 0xe0, 0x03,
-0xe0, 0x0e, 0x70, 0x06, 0x70, 0x3c, 0x38, 0x0e,
-0x38, 0x78, 0x1e, 0x1c, 0x1f, 0xe0, 0x07, 0xf8,
-0x07, 0x80, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_503_32, 32, 32, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x03, 0x83, 0x83, 0x80, 0x03, 0x83, 0x83, 0xe0,
-0x03, 0x83, 0x80, 0x78, 0x00, 0x00, 0x00, 0x1c,
-0x00, 0x38, 0x00, 0x0e, 0x00, 0x38, 0x00, 0x07,
-0x00, 0x38, 0x38, 0x07, 0x00, 0x00, 0x38, 0x03,
-0x0e, 0x00, 0x38, 0x03, 0x0e, 0x00, 0x00, 0x07,
-0x0e, 0x38, 0x00, 0x0e, 0x00, 0x38, 0x00, 0x1e,
-0x00, 0x38, 0x00, 0x7e, 0x00, 0x00, 0x07, 0xe6,
-0x00, 0x01, 0xff, 0x86, 0xff, 0xff, 0xf8, 0x0e,
-0x0f, 0xf0, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3c,
-0x38, 0x30, 0x00, 0x7c, 0x38, 0x30, 0x03, 0xec,
-0x38, 0x00, 0x3f, 0x8c, 0x03, 0xff, 0xfc, 0x1c,
-0x03, 0xff, 0xc0, 0x38, 0x00, 0x00, 0x00, 0x70,
-0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x07, 0xc0,
-0x0e, 0x3f, 0xff, 0x00, 0x0e, 0x3f, 0xf8, 0x00,
-0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_504_32, 32, 32, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00,
-0x18, 0x00, 0x01, 0xc0, 0x3c, 0x00, 0x00, 0xf0,
-0x3c, 0x00, 0x60, 0xf8, 0x18, 0x00, 0xf0, 0xdc,
-0x00, 0x00, 0xf0, 0xce, 0x00, 0x00, 0x60, 0xc6,
-0x00, 0x60, 0x00, 0xc3, 0x00, 0xf0, 0x01, 0xc3,
-0x00, 0xf0, 0x01, 0x83, 0x00, 0x60, 0x03, 0x03,
-0x00, 0x03, 0x07, 0x03, 0x00, 0x03, 0x06, 0x06,
-0x0c, 0x00, 0x0c, 0x0e, 0x0c, 0x00, 0x18, 0x1c,
-0x00, 0x00, 0x70, 0x38, 0x00, 0x00, 0xe0, 0xf0,
-0x00, 0x03, 0xc3, 0xe0, 0x20, 0x3f, 0xbf, 0x80,
-0x0f, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xc0, 0x00,
-0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38,
-0x00, 0x00, 0x1c, 0x38, 0x00, 0x00, 0x3e, 0x00,
-0x00, 0x0e, 0x3e, 0x00, 0x00, 0x0e, 0x3e, 0x00,
-0x00, 0x0e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_507_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xfc, 0x00,
-0x00, 0x3f, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0x00,
-0x00, 0xf8, 0x1f, 0x80, 0x00, 0xf0, 0x0f, 0x80,
-0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x00, 0x00,
-0x00, 0xf0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00,
-0x00, 0xfc, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00,
-0x00, 0x3f, 0x00, 0x08, 0x7f, 0xff, 0xff, 0xfc,
-0xff, 0xff, 0xff, 0xfe, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xfe,
-0x7f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x1f, 0x88,
-0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x07, 0xc0,
-0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x03, 0xc0,
-0x01, 0x80, 0x03, 0xc0, 0x03, 0xc0, 0x07, 0xc0,
-0x03, 0xe0, 0x07, 0x80, 0x01, 0xf0, 0x1f, 0x80,
-0x00, 0xff, 0xff, 0x00, 0x00, 0x7f, 0xfe, 0x00,
-0x00, 0x3f, 0xfc, 0x00, 0x00, 0x07, 0xe0, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_508_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xfc, 0x00,
-0x00, 0x3f, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0x00,
-0x00, 0xf8, 0x1f, 0x80, 0x00, 0xf0, 0x0f, 0x80,
-0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x00, 0x08,
-0x7f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfc,
-0x00, 0x0f, 0xe0, 0x08, 0x00, 0x03, 0xf8, 0x00,
-0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x7e, 0x08,
-0x7f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfc,
-0x01, 0x80, 0x03, 0xc8, 0x03, 0xc0, 0x07, 0xc0,
-0x03, 0xe0, 0x07, 0x80, 0x01, 0xf0, 0x1f, 0x80,
-0x00, 0xff, 0xff, 0x00, 0x00, 0x7f, 0xfe, 0x00,
-0x00, 0x3f, 0xfc, 0x00, 0x00, 0x07, 0xe0, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_509_32, 32, 32, 
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc0, 0x03, 0x00, 0x0f, 0x80, 0x03, 0xf0,
-0x3f, 0x80, 0x01, 0xfc, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0xff, 0xff,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x3f, 0xff, 0xcf, 0xf0, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0
-);
-
-LCD_MONO_IMG_DEFINE(icon_510_32, 32, 32, 
-0x00, 0x07, 0xc0, 0x00, 0x00, 0x1f, 0xc0, 0x00,
-0x00, 0x78, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00,
-0x01, 0xc0, 0x00, 0x00, 0x0f, 0x80, 0x0f, 0xff,
-0x3f, 0x80, 0x00, 0x00, 0x70, 0x00, 0xff, 0xf0,
-0x60, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x0f, 0xff,
-0xc0, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0xff, 0xff,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x3f, 0xff, 0xcf, 0xf0, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0
-);
-
-LCD_MONO_IMG_DEFINE(icon_511_32, 32, 32, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x60,
-0x0f, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xf0,
-0x06, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x01, 0xf0,
-0x1f, 0xe0, 0x07, 0xf8, 0x38, 0x78, 0x1e, 0x1c,
-0x60, 0x1c, 0x38, 0x06, 0xe0, 0x0e, 0x70, 0x06,
-0xc0, 0x07, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
-0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x07, 0xe0, 0x03,
-0xe0, 0x0e, 0x70, 0x06, 0x70, 0x3c, 0x38, 0x0e,
-0x38, 0x78, 0x1e, 0x1c, 0x1f, 0xe0, 0x07, 0xf8,
-0x07, 0x80, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x60,
-0x0f, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xf0,
-0x06, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_512_32, 32, 32, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x60,
-0x0f, 0x01, 0x80, 0xf0, 0x0f, 0x03, 0xc0, 0xf0,
-0x06, 0x03, 0xc0, 0x60, 0x00, 0x01, 0x80, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x01, 0xf0,
-0x1f, 0xe0, 0x07, 0xf8, 0x38, 0x78, 0x1e, 0x1c,
-0x60, 0x1c, 0x38, 0x06, 0xe0, 0x0e, 0x70, 0x06,
-0xc0, 0x07, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
-0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x07, 0xe0, 0x03,
-0xe0, 0x0e, 0x70, 0x06, 0x70, 0x3c, 0x38, 0x0e,
-0x38, 0x78, 0x1e, 0x1c, 0x1f, 0xe0, 0x07, 0xf8,
-0x07, 0x80, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x01, 0x80, 0x00, 0x06, 0x03, 0xc0, 0x60,
-0x0f, 0x03, 0xc0, 0xf0, 0x0f, 0x01, 0x80, 0xf0,
-0x06, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_513_32, 32, 32, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
-0x3c, 0x18, 0x1c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-0x18, 0x3c, 0x3c, 0x18, 0x00, 0x18, 0x18, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x01, 0xf0,
-0x1f, 0xe0, 0x07, 0xf8, 0x38, 0x78, 0x1e, 0x1c,
-0x60, 0x1c, 0x38, 0x06, 0xe0, 0x0e, 0x70, 0x06,
-0xc0, 0x07, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
-0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x07, 0xe0, 0x03,
-0xe0, 0x0e, 0x70, 0x06, 0x70, 0x3c, 0x38, 0x0e,
-0x38, 0x78, 0x1e, 0x1c, 0x1f, 0xe0, 0x07, 0xf8,
-0x07, 0x80, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x18, 0x18, 0x00, 0x18, 0x3c, 0x3c, 0x18,
-0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x18, 0x18, 0x3c,
-0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_514_32, 32, 32, 
-0x00, 0x07, 0xc0, 0x00, 0x00, 0x1f, 0xc0, 0x00,
-0x00, 0x78, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00,
-0x01, 0xc3, 0xff, 0xc0, 0x0f, 0x83, 0xff, 0xc0,
-0x3f, 0x80, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-0x60, 0x00, 0x0f, 0xff, 0xc0, 0x00, 0x0f, 0xff,
-0xc0, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x03, 0xfc, 0xff, 0xff, 0x03, 0xfc, 0xff, 0xff,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xf0
-);
-
-LCD_MONO_IMG_DEFINE(icon_515_32, 32, 32, 
-0x00, 0x07, 0xc0, 0x00, 0x00, 0x1f, 0xc0, 0x00,
-0x00, 0x78, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00,
-0x01, 0xc0, 0x00, 0x00, 0x0f, 0x80, 0x0f, 0xff,
-0x3f, 0x80, 0x00, 0x00, 0x70, 0x00, 0xff, 0xf0,
-0x60, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x0f, 0xff,
-0xc0, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x80, 0x03, 0x0e, 0x3f, 0xc0, 0x03, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xff, 0xf3, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0xff, 0xff,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x3f, 0xff, 0xcf, 0xf0, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xff, 0x3f, 0xcf, 0xff
-);
-
-LCD_MONO_IMG_DEFINE(icon_800_32, 32, 32, 
-0x00, 0x0f, 0xf0, 0x00, 0x00, 0x7f, 0xfe, 0x00,
-0x01, 0xff, 0xff, 0x80, 0x03, 0xff, 0xff, 0xc0,
-0x07, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xf0,
-0x1f, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xfc,
-0x3f, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xfe,
-0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfe,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+LCD_MONO_RLE_IMG_DEFINE(icon_350_32, 32, 32, 
+0xf6, 0x2f, 0xe3, 0xfd, 0x4f, 0xd4, 0xfc, 0x21,
+0x2f, 0xc2, 0x13, 0xfc, 0x12, 0x2f, 0x56, 0x53,
+0xf1, 0xa4, 0x4c, 0x46, 0x34, 0x68, 0x3a, 0x25,
+0x47, 0x3c, 0x25, 0x24, 0x6d, 0x75, 0x3f, 0x31,
+0x33, 0x42, 0xf9, 0x23, 0x2f, 0xb2, 0x22, 0xfb,
+0x22, 0x2f, 0xb2, 0x22, 0xfb, 0x23, 0x2f, 0x92,
+0x48, 0xc8, 0x67, 0xa7, 0xd4, 0x63, 0xf6, 0xaf,
+0x96, 0xff, 0xff, 0xfb, 0x2a, 0x2f, 0x24, 0x84,
+0xf1, 0x48, 0x4f, 0x14, 0x84, 0xf2, 0x2a, 0x2a
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_351_32, 32, 32, 
+0xf6, 0x2f, 0xe3, 0xfd, 0x4f, 0xd4, 0xfc, 0x21,
+0x2f, 0xc2, 0x13, 0xfc, 0x12, 0x2f, 0x56, 0x53,
+0xf1, 0xa4, 0x4c, 0x46, 0x34, 0x68, 0x3a, 0x25,
+0x47, 0x3c, 0x25, 0x24, 0x6d, 0x75, 0x3f, 0x31,
+0x33, 0x42, 0xf9, 0x23, 0x2f, 0xb2, 0x22, 0xfb,
+0x22, 0x2f, 0xb2, 0x22, 0xfb, 0x23, 0x2f, 0x92,
+0x48, 0xc8, 0x67, 0xa7, 0xd4, 0x63, 0xf6, 0xaf,
+0x96, 0xf6, 0x2c, 0x2f, 0x04, 0xa4, 0xe4, 0x42,
+0x44, 0xe4, 0x34, 0x34, 0xf0, 0x24, 0x44, 0x2f,
+0x74, 0xfe, 0x2f, 0x10
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_399_32, 32, 32, 
+0xff, 0xfc, 0x2f, 0xe4, 0xd2, 0xc2, 0x22, 0xb4,
+0xb2, 0x22, 0xb4, 0xa2, 0x42, 0x92, 0x22, 0x82,
+0x62, 0x73, 0x23, 0x72, 0x62, 0x72, 0x42, 0x62,
+0x81, 0x62, 0x62, 0x52, 0x82, 0x43, 0x63, 0x42,
+0x82, 0x42, 0x82, 0x42, 0x82, 0x33, 0x83, 0x32,
+0x82, 0x32, 0xa2, 0x42, 0x62, 0x32, 0xc2, 0x48,
+0x42, 0xc2, 0x56, 0x43, 0xc3, 0xe2, 0xe2, 0xe2,
+0xe2, 0xd2, 0xf1, 0x2c, 0x2f, 0x12, 0xc2, 0xf1,
+0x2c, 0x2f, 0x12, 0xc2, 0xf1, 0x2c, 0x2f, 0x12,
+0xd2, 0xe2, 0xe2, 0xe2, 0xf0, 0x2c, 0x2f, 0x13,
+0xa3, 0xf2, 0x46, 0x4f, 0x5a, 0xf9, 0x6f, 0x40
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_400_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x28,
+0x2f, 0x35, 0x55, 0xf3, 0x46, 0x4f, 0x34, 0x64,
+0xf3, 0x46, 0x4f, 0x42, 0x82, 0xff, 0xff, 0xe0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_401_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6f, 0xff, 0xff, 0x82, 0xf1, 0x2a, 0x5d,
+0x5a, 0x4e, 0x4a, 0x4e, 0x4a, 0x46, 0x26, 0x4b,
+0x25, 0x56, 0x2f, 0x54, 0xfd, 0x4f, 0xd4, 0xfe,
+0x2f, 0x00
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_402_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6f, 0x02, 0xf9, 0x22, 0x5f, 0x65, 0x24,
+0xf7, 0x42, 0x4f, 0x74, 0x24, 0x52, 0x82, 0x54,
+0x32, 0x45, 0x55, 0x52, 0xb4, 0x64, 0xf3, 0x46,
+0x4f, 0x34, 0x64, 0xf4, 0x28, 0x2f, 0xff, 0xfe
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_403_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6f, 0x02, 0xf9, 0x22, 0x5f, 0x65, 0x24,
+0xf7, 0x42, 0x4f, 0x74, 0x24, 0x32, 0xc2, 0x34,
+0x32, 0x25, 0x95, 0x32, 0x94, 0x42, 0x44, 0xe4,
+0x25, 0x34, 0xe4, 0x34, 0x34, 0xf0, 0x24, 0x44,
+0x2f, 0x74, 0xfe, 0x2f, 0x00
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_404_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6f, 0xff, 0xff, 0xff, 0x72, 0xf7, 0x25,
+0x4f, 0x54, 0x44, 0xf5, 0x44, 0x44, 0x28, 0x24,
+0x45, 0x23, 0x55, 0x54, 0x2c, 0x46, 0x4f, 0x34,
+0x64, 0xf3, 0x46, 0x4f, 0x42, 0x82, 0xa0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_405_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x28,
+0x23, 0x26, 0x25, 0x55, 0x51, 0x44, 0x45, 0x46,
+0x41, 0x44, 0x45, 0x46, 0x41, 0x44, 0x45, 0x46,
+0x42, 0x26, 0x27, 0x28, 0x2f, 0xff, 0xf6
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_406_32, 32, 32, 
+0xa1, 0xff, 0x02, 0xff, 0x02, 0xf9, 0x25, 0x14,
+0x3f, 0x23, 0x92, 0xf4, 0x22, 0x52, 0x1f, 0x86,
+0xfa, 0x35, 0x6f, 0x23, 0x4a, 0xb3, 0x12, 0x34,
+0x63, 0xa3, 0x53, 0xa2, 0xf1, 0x3c, 0x2b, 0x6d,
+0x75, 0x3f, 0x31, 0x33, 0x42, 0xf9, 0x23, 0x2f,
+0xb2, 0x22, 0xfb, 0x22, 0x2f, 0xb2, 0x22, 0xfb,
+0x23, 0x2f, 0x92, 0x48, 0xc8, 0x67, 0xa7, 0xd4,
+0x63, 0xf6, 0xaf, 0x96, 0xff, 0xff, 0x61, 0xf4,
+0x28, 0x5f, 0x23, 0x74, 0xf2, 0x47, 0x4f, 0x24,
+0x75, 0xf2, 0x2a, 0x19
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_407_32, 32, 32, 
+0xa1, 0xff, 0x02, 0xff, 0x02, 0xf9, 0x25, 0x14,
+0x3f, 0x23, 0x92, 0xf4, 0x22, 0x52, 0x1f, 0x86,
+0xfa, 0x35, 0x6f, 0x23, 0x4a, 0xb3, 0x12, 0x34,
+0x63, 0xa3, 0x53, 0xa2, 0xf1, 0x3c, 0x2b, 0x6d,
+0x75, 0x3f, 0x31, 0x33, 0x42, 0xf9, 0x23, 0x2f,
+0xb2, 0x22, 0xfb, 0x22, 0x2f, 0xb2, 0x22, 0xfb,
+0x23, 0x2f, 0x92, 0x48, 0xc8, 0x67, 0xa7, 0xd4,
+0x63, 0xf6, 0xaf, 0x96, 0xff, 0xfa, 0x28, 0x2f,
+0x35, 0x64, 0xf3, 0x46, 0x4f, 0x34, 0x64, 0xf2,
+0x55, 0x5f, 0x42, 0x82, 0x90
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_408_32, 32, 32, 
+0xf0, 0x2f, 0xe4, 0xf9, 0xcf, 0x3f, 0x1e, 0x51,
+0x32, 0x31, 0x5a, 0x44, 0x24, 0x24, 0x47, 0x35,
+0x34, 0x35, 0x35, 0x36, 0x26, 0x26, 0x34, 0x27,
+0x26, 0x27, 0x23, 0x27, 0x28, 0x27, 0x22, 0x27,
+0x28, 0x27, 0x21, 0x22, 0x42, 0x22, 0x42, 0x22,
+0x42, 0xff, 0x84, 0x61, 0x21, 0x64, 0x68, 0x23,
+0x23, 0x28, 0x2f, 0x02, 0xff, 0x02, 0x72, 0xf6,
+0x25, 0x5f, 0x52, 0x64, 0xf5, 0x26, 0x4b, 0x27,
+0x26, 0x49, 0x56, 0x27, 0x2b, 0x46, 0x2f, 0x54,
+0x62, 0xf5, 0x46, 0x27, 0x2c, 0x27, 0x25, 0x5f,
+0x52, 0x64, 0xf5, 0x26, 0x4f, 0x52, 0x64, 0xf5,
+0x27, 0x2f, 0x62, 0xff, 0x02, 0xf0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_409_32, 32, 32, 
+0xf0, 0x2f, 0xe4, 0xf9, 0xcf, 0x3f, 0x1e, 0x51,
+0x32, 0x31, 0x5a, 0x44, 0x24, 0x24, 0x47, 0x35,
+0x34, 0x35, 0x35, 0x36, 0x26, 0x26, 0x34, 0x27,
+0x26, 0x27, 0x23, 0x27, 0x28, 0x27, 0x22, 0x27,
+0x28, 0x27, 0x21, 0x22, 0x42, 0x22, 0x42, 0x22,
+0x42, 0xff, 0x84, 0x61, 0x21, 0x64, 0x68, 0x23,
+0x23, 0x28, 0x2f, 0x02, 0xff, 0x02, 0xff, 0x02,
+0xf2, 0x26, 0x23, 0x23, 0x26, 0x22, 0x53, 0x52,
+0x22, 0x43, 0x52, 0x44, 0x42, 0x22, 0x44, 0x42,
+0x44, 0x42, 0x22, 0x44, 0x42, 0x44, 0x42, 0x22,
+0x44, 0x43, 0x26, 0x23, 0x23, 0x26, 0x2f, 0x22,
+0x72, 0xf6, 0x25, 0x5f, 0x52, 0x64, 0xf5, 0x26,
+0x4f, 0x52, 0x64, 0xf5, 0x27, 0x2f, 0x62, 0xff,
+0x02, 0xf0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_410_32, 32, 32, 
+0xf0, 0x2f, 0xe4, 0xf9, 0xcf, 0x3f, 0x1e, 0x51,
+0x32, 0x31, 0x5a, 0x44, 0x24, 0x24, 0x47, 0x35,
+0x34, 0x35, 0x35, 0x36, 0x26, 0x26, 0x34, 0x27,
+0x26, 0x27, 0x23, 0x27, 0x28, 0x27, 0x22, 0x27,
+0x28, 0x27, 0x21, 0x22, 0x42, 0x22, 0x42, 0x22,
+0x42, 0xff, 0x84, 0x61, 0x21, 0x64, 0x68, 0x23,
+0x23, 0x28, 0x2f, 0x02, 0xff, 0x02, 0xff, 0x02,
+0x32, 0x62, 0x42, 0x62, 0x32, 0x24, 0x35, 0x15,
+0x35, 0x22, 0x24, 0x44, 0x24, 0x44, 0x22, 0x24,
+0x44, 0x24, 0x44, 0x22, 0x24, 0x44, 0x24, 0x44,
+0x22, 0x32, 0x62, 0x42, 0x62, 0x32, 0xf6, 0x27,
+0x2f, 0x45, 0x62, 0x32, 0x62, 0x74, 0x62, 0x15,
+0x35, 0x64, 0x62, 0x24, 0x44, 0x64, 0x62, 0x24,
+0x44, 0x72, 0x72, 0x24, 0x44, 0xf1, 0x23, 0x26,
+0x2f, 0x22, 0xf0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_456_32, 32, 32, 
+0xf6, 0x2f, 0xe3, 0xfd, 0x4f, 0xd4, 0xfc, 0x21,
+0x2f, 0xc2, 0x13, 0xfc, 0x12, 0x2f, 0x56, 0x53,
+0xf1, 0xa4, 0x4c, 0x46, 0x34, 0x68, 0x3a, 0x25,
+0x47, 0x3c, 0x25, 0x24, 0x6d, 0x75, 0x3f, 0x31,
+0x33, 0x42, 0xf9, 0x23, 0x2f, 0xb2, 0x22, 0xfb,
+0x22, 0x2f, 0xb2, 0x22, 0xfb, 0x23, 0x2f, 0x92,
+0x48, 0xc8, 0x67, 0xa7, 0xd4, 0x63, 0xf6, 0xaf,
+0x96, 0xff, 0xff, 0x61, 0xf4, 0x28, 0x5f, 0x23,
+0x74, 0xf2, 0x47, 0x4f, 0x24, 0x75, 0xf2, 0x2a,
+0x1b
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_457_32, 32, 32, 
+0xf6, 0x2f, 0xe3, 0xfd, 0x4f, 0xd4, 0xfc, 0x21,
+0x2f, 0xc2, 0x13, 0xfc, 0x12, 0x2f, 0x56, 0x53,
+0xf1, 0xa4, 0x4c, 0x46, 0x34, 0x68, 0x3a, 0x25,
+0x47, 0x3c, 0x25, 0x24, 0x6d, 0x75, 0x3f, 0x31,
+0x33, 0x42, 0xf9, 0x23, 0x2f, 0xb2, 0x22, 0xfb,
+0x22, 0x2f, 0xb2, 0x22, 0xfb, 0x23, 0x2f, 0x92,
+0x48, 0xc8, 0x67, 0xa7, 0xd4, 0x63, 0xf6, 0xaf,
+0x96, 0xff, 0xfa, 0x28, 0x2f, 0x35, 0x55, 0xf3,
+0x46, 0x4f, 0x34, 0x64, 0xf2, 0x55, 0x5f, 0x42,
+0x82, 0xb0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_499_32, 32, 32, 
+0xf0, 0x2f, 0xb1, 0x32, 0x21, 0xf7, 0x41, 0x21,
+0x3f, 0x79, 0xf9, 0x76, 0x1b, 0x26, 0x56, 0x3a,
+0x27, 0x37, 0x3a, 0x37, 0x27, 0x22, 0x15, 0x67,
+0x27, 0x64, 0x66, 0x36, 0x67, 0x53, 0x83, 0x57,
+0x71, 0xf5, 0x2d, 0x46, 0x25, 0x23, 0x53, 0x73,
+0xf5, 0x28, 0x2f, 0x43, 0x83, 0xf3, 0x38, 0x3f,
+0x42, 0x82, 0xf5, 0x36, 0x45, 0x32, 0x52, 0x64,
+0xd3, 0xf4, 0x17, 0x75, 0x37, 0x45, 0x76, 0x63,
+0x66, 0x46, 0x72, 0x76, 0x51, 0x22, 0x72, 0x73,
+0xa3, 0x73, 0x72, 0xa3, 0x65, 0x62, 0xb1, 0x67,
+0xf9, 0x9f, 0x73, 0x12, 0x13, 0xf7, 0x22, 0x23,
+0x1f, 0xb2, 0xf0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_500_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xef, 0x98,
+0xf9, 0xff, 0xff, 0x4f, 0x98, 0xf9, 0xff, 0xff,
+0xc0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_501_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6f, 0xff, 0xff, 0x2f, 0x5c, 0xf5, 0xff,
+0xff, 0xf7, 0x82, 0xf1, 0x68, 0x2f, 0x1f, 0xff,
+0xfc, 0xf5, 0xcf, 0x54
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_502_32, 32, 32, 
 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfe,
-0x7f, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfc,
-0x3f, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xf8,
-0x0f, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xe0,
-0x03, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0x80,
-0x00, 0x7f, 0xfe, 0x00, 0x00, 0x0f, 0xf0, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_801_32, 32, 32, 
-0x00, 0x0f, 0xf0, 0x00, 0x00, 0x78, 0x0e, 0x00,
-0x01, 0xfc, 0x01, 0x80, 0x03, 0xff, 0x00, 0xc0,
-0x07, 0xff, 0x80, 0x20, 0x0f, 0xff, 0x80, 0x10,
-0x1f, 0xff, 0xc0, 0x08, 0x3f, 0xff, 0xe0, 0x0c,
-0x3f, 0xff, 0xe0, 0x04, 0x7f, 0xff, 0xf0, 0x02,
-0x7f, 0xff, 0xf0, 0x02, 0x7f, 0xff, 0xf0, 0x02,
-0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xf8, 0x01,
-0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xf8, 0x01,
-0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xf8, 0x01,
-0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xf8, 0x01,
-0x7f, 0xff, 0xf0, 0x02, 0x7f, 0xff, 0xf0, 0x02,
-0x7f, 0xff, 0xf0, 0x02, 0x3f, 0xff, 0xe0, 0x04,
-0x3f, 0xff, 0xe0, 0x0c, 0x1f, 0xff, 0xc0, 0x08,
-0x0f, 0xff, 0x80, 0x10, 0x07, 0xff, 0x00, 0x20,
-0x03, 0xfe, 0x00, 0xc0, 0x01, 0xfc, 0x01, 0x80,
-0x00, 0x78, 0x0e, 0x00, 0x00, 0x0f, 0xf0, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_802_32, 32, 32, 
-0x00, 0x0f, 0xf0, 0x00, 0x00, 0x7e, 0x0e, 0x00,
-0x01, 0xff, 0x01, 0x80, 0x03, 0xff, 0x00, 0xc0,
-0x07, 0xff, 0x00, 0x20, 0x0f, 0xff, 0x00, 0x10,
-0x1f, 0xff, 0x00, 0x08, 0x3f, 0xff, 0x80, 0x0c,
-0x3f, 0xff, 0x80, 0x04, 0x7f, 0xff, 0x80, 0x02,
-0x7f, 0xff, 0x80, 0x02, 0x7f, 0xff, 0x80, 0x02,
-0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0x80, 0x01,
-0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0x80, 0x01,
-0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0x80, 0x01,
-0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0x80, 0x01,
-0x7f, 0xff, 0x80, 0x02, 0x7f, 0xff, 0x80, 0x02,
-0x7f, 0xff, 0x80, 0x02, 0x3f, 0xff, 0x00, 0x04,
-0x3f, 0xff, 0x00, 0x0c, 0x1f, 0xff, 0x00, 0x08,
-0x0f, 0xff, 0x00, 0x10, 0x07, 0xff, 0x00, 0x20,
-0x03, 0xfe, 0x00, 0xc0, 0x01, 0xfe, 0x01, 0x80,
-0x00, 0x7e, 0x0e, 0x00, 0x00, 0x0f, 0xf0, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_803_32, 32, 32, 
-0x00, 0x0f, 0xf0, 0x00, 0x00, 0x7f, 0xfe, 0x00,
-0x01, 0xf8, 0x0f, 0x80, 0x03, 0xf0, 0x03, 0xc0,
-0x07, 0xf0, 0x00, 0xe0, 0x0f, 0xe0, 0x00, 0x70,
-0x1f, 0xc0, 0x00, 0x38, 0x3f, 0xc0, 0x00, 0x1c,
-0x3f, 0x80, 0x00, 0x0c, 0x7f, 0x80, 0x00, 0x0e,
-0x7f, 0x80, 0x00, 0x06, 0x7f, 0x00, 0x00, 0x06,
-0xff, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x03,
-0xff, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x03,
-0xff, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x03,
-0xff, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x03,
-0x7f, 0x00, 0x00, 0x06, 0x7f, 0x80, 0x00, 0x06,
-0x7f, 0x80, 0x00, 0x0e, 0x3f, 0x80, 0x00, 0x0c,
-0x3f, 0xc0, 0x00, 0x1c, 0x1f, 0xc0, 0x00, 0x38,
-0x0f, 0xe0, 0x00, 0x70, 0x07, 0xf0, 0x00, 0xe0,
-0x03, 0xf0, 0x03, 0xc0, 0x01, 0xfc, 0x0f, 0x80,
-0x00, 0x7f, 0xfe, 0x00, 0x00, 0x0f, 0xf0, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_804_32, 32, 32, 
-0x00, 0x0f, 0xf0, 0x00, 0x00, 0x7f, 0xfe, 0x00,
-0x01, 0xf0, 0x0f, 0x80, 0x03, 0xc0, 0x03, 0xc0,
-0x07, 0x00, 0x00, 0xe0, 0x0e, 0x00, 0x00, 0x70,
-0x1c, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00, 0x1c,
-0x30, 0x00, 0x00, 0x0c, 0x70, 0x00, 0x00, 0x0e,
-0x60, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x06,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-0x60, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x00, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x0c,
-0x38, 0x00, 0x00, 0x1c, 0x1c, 0x00, 0x00, 0x38,
-0x0e, 0x00, 0x00, 0x70, 0x07, 0x00, 0x00, 0xe0,
-0x03, 0xc0, 0x03, 0xc0, 0x01, 0xf0, 0x0f, 0x80,
-0x00, 0x7f, 0xfe, 0x00, 0x00, 0x0f, 0xf0, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_805_32, 32, 32, 
-0x00, 0x0f, 0xf0, 0x00, 0x00, 0x7f, 0xfe, 0x00,
-0x01, 0xf0, 0x3f, 0x80, 0x03, 0xc0, 0x0f, 0xc0,
-0x07, 0x00, 0x0f, 0xe0, 0x0e, 0x00, 0x07, 0xf0,
-0x1c, 0x00, 0x03, 0xf8, 0x38, 0x00, 0x03, 0xfc,
-0x30, 0x00, 0x01, 0xfc, 0x70, 0x00, 0x01, 0xfe,
-0x60, 0x00, 0x01, 0xfe, 0x60, 0x00, 0x00, 0xfe,
-0xc0, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0xff,
-0xc0, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0xff,
-0xc0, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0xff,
-0xc0, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0xff,
-0x60, 0x00, 0x00, 0xfe, 0x60, 0x00, 0x01, 0xfe,
-0x70, 0x00, 0x01, 0xfe, 0x30, 0x00, 0x01, 0xfc,
-0x38, 0x00, 0x03, 0xfc, 0x1c, 0x00, 0x03, 0xf8,
-0x0e, 0x00, 0x07, 0xf0, 0x07, 0x00, 0x0f, 0xe0,
-0x03, 0xc0, 0x1f, 0xc0, 0x01, 0xf0, 0x3f, 0x80,
-0x00, 0x7f, 0xfe, 0x00, 0x00, 0x0f, 0xf0, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_806_32, 32, 32, 
-0x00, 0x0f, 0xf0, 0x00, 0x00, 0x7f, 0xfe, 0x00,
-0x01, 0xf3, 0xff, 0x80, 0x03, 0xc1, 0xff, 0xc0,
-0x07, 0x01, 0xff, 0xe0, 0x0e, 0x01, 0xff, 0xf0,
-0x1c, 0x01, 0xff, 0xf8, 0x38, 0x01, 0xff, 0xfc,
-0x30, 0x00, 0xff, 0xfc, 0x70, 0x00, 0xff, 0xfe,
-0x60, 0x00, 0xff, 0xfe, 0x60, 0x00, 0xff, 0xfe,
-0xc0, 0x00, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff,
-0xc0, 0x00, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff,
-0xc0, 0x00, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff,
-0xc0, 0x00, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff,
-0x60, 0x00, 0xff, 0xfe, 0x60, 0x00, 0xff, 0xfe,
-0x70, 0x00, 0xff, 0xfe, 0x30, 0x01, 0xff, 0xfc,
-0x38, 0x01, 0xff, 0xfc, 0x1c, 0x01, 0xff, 0xf8,
-0x0e, 0x01, 0xff, 0xf0, 0x07, 0x01, 0xff, 0xe0,
-0x03, 0xc3, 0xff, 0xc0, 0x01, 0xf3, 0xff, 0x80,
-0x00, 0x7f, 0xfe, 0x00, 0x00, 0x0f, 0xf0, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_807_32, 32, 32, 
-0x00, 0x0f, 0xf0, 0x00, 0x00, 0x70, 0x1e, 0x00,
-0x01, 0x80, 0x3f, 0x80, 0x03, 0x00, 0xff, 0xc0,
-0x04, 0x01, 0xff, 0xe0, 0x08, 0x01, 0xff, 0xf0,
-0x10, 0x03, 0xff, 0xf8, 0x30, 0x07, 0xff, 0xfc,
-0x20, 0x07, 0xff, 0xfc, 0x40, 0x0f, 0xff, 0xfe,
-0x40, 0x0f, 0xff, 0xfe, 0x40, 0x0f, 0xff, 0xfe,
-0x80, 0x1f, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff,
-0x80, 0x1f, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff,
-0x80, 0x1f, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff,
-0x80, 0x1f, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff,
-0x40, 0x0f, 0xff, 0xfe, 0x40, 0x0f, 0xff, 0xfe,
-0x40, 0x0f, 0xff, 0xfe, 0x20, 0x07, 0xff, 0xfc,
-0x30, 0x07, 0xff, 0xfc, 0x10, 0x03, 0xff, 0xf8,
-0x08, 0x01, 0xff, 0xf0, 0x04, 0x01, 0xff, 0xe0,
-0x03, 0x00, 0xff, 0xc0, 0x01, 0x80, 0x3f, 0x80,
-0x00, 0x70, 0x1e, 0x00, 0x00, 0x0f, 0xf0, 0x00
-);
-
-LCD_MONO_IMG_DEFINE(icon_900_32, 32, 32, 
-0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x1f, 0xe0,
-0x04, 0x00, 0x1c, 0xe0, 0x0c, 0x00, 0x38, 0x70,
-0x0c, 0x00, 0x30, 0x30, 0x1c, 0x40, 0x30, 0x30,
-0x1e, 0xc0, 0x33, 0x30, 0x5f, 0xc0, 0x33, 0x30,
-0xdf, 0xe0, 0x33, 0x30, 0xff, 0xe0, 0x33, 0x30,
-0xff, 0xe0, 0x33, 0x30, 0xff, 0xe0, 0x33, 0x30,
-0xff, 0xe0, 0x33, 0x30, 0x7f, 0xc0, 0x33, 0x30,
-0x3f, 0x80, 0x33, 0x30, 0x1f, 0x00, 0x33, 0x30,
-0x00, 0x00, 0x73, 0x38, 0x00, 0x00, 0xe3, 0x1c,
-0x00, 0x01, 0xc3, 0x0e, 0x00, 0x01, 0x87, 0x86,
-0x00, 0x03, 0x8f, 0xc7, 0x00, 0x03, 0x9f, 0xe7,
-0x00, 0x03, 0x1f, 0xe3, 0x00, 0x03, 0x1f, 0xe3,
-0x00, 0x03, 0x9f, 0xe7, 0x00, 0x03, 0x8f, 0xc7,
-0x00, 0x01, 0x87, 0x86, 0x00, 0x01, 0xc0, 0x0e,
-0x00, 0x00, 0xe0, 0x1c, 0x00, 0x00, 0x7c, 0xf8,
-0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x0f, 0xc0
-);
-
-LCD_MONO_IMG_DEFINE(icon_901_32, 32, 32, 
-0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x1f, 0xe0,
-0x06, 0x00, 0x1c, 0xe0, 0x06, 0x00, 0x38, 0x70,
-0x66, 0x60, 0x30, 0x30, 0x7f, 0xe0, 0x30, 0x30,
-0x7f, 0xe0, 0x30, 0x30, 0x3f, 0xc0, 0x30, 0x30,
-0x3f, 0xc0, 0x30, 0x30, 0x7f, 0xe0, 0x30, 0x30,
-0x7f, 0xe0, 0x30, 0x30, 0x66, 0x60, 0x30, 0x30,
-0x06, 0x00, 0x30, 0x30, 0x06, 0x00, 0x30, 0x30,
-0x00, 0x00, 0x33, 0x30, 0x00, 0x00, 0x33, 0x30,
-0x00, 0x00, 0x73, 0x38, 0x00, 0x00, 0xe3, 0x1c,
-0x00, 0x01, 0xc3, 0x0e, 0x00, 0x01, 0x87, 0x86,
-0x00, 0x03, 0x8f, 0xc7, 0x00, 0x03, 0x9f, 0xe7,
-0x00, 0x03, 0x1f, 0xe3, 0x00, 0x03, 0x1f, 0xe3,
-0x00, 0x03, 0x9f, 0xe7, 0x00, 0x03, 0x8f, 0xc7,
-0x00, 0x01, 0x87, 0x86, 0x00, 0x01, 0xc0, 0x0e,
-0x00, 0x00, 0xe0, 0x1c, 0x00, 0x00, 0x7c, 0xf8,
-0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x0f, 0xc0
-);
-
-LCD_MONO_IMG_DEFINE(icon_999_32, 32, 32, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x07, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-0x00, 0x78, 0x1c, 0x00, 0x00, 0xe0, 0x0e, 0x00,
-0x01, 0xc3, 0xc3, 0x00, 0x0f, 0x87, 0xe3, 0xf0,
-0x3f, 0x8e, 0x71, 0xfc, 0x70, 0x0c, 0x30, 0x0e,
-0x60, 0x00, 0x70, 0x06, 0xc0, 0x00, 0xe0, 0x03,
-0xc0, 0x01, 0xc0, 0x03, 0xc0, 0x01, 0x80, 0x03,
-0xc0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06,
-0x70, 0x81, 0x83, 0x0e, 0x3f, 0xc1, 0x83, 0xfc,
-0x0f, 0xe0, 0x0f, 0xf0, 0x00, 0x78, 0x1c, 0x00,
-0x00, 0x1f, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+0xff, 0xf7, 0x5e, 0x57, 0x8a, 0x85, 0x34, 0x46,
+0x44, 0x33, 0x28, 0x34, 0x38, 0x21, 0x39, 0x32,
+0x39, 0x21, 0x2b, 0x6b, 0x4c, 0x4c, 0x4c, 0x4c,
+0x4b, 0x6b, 0x59, 0x32, 0x39, 0x22, 0x36, 0x44,
+0x37, 0x33, 0x34, 0x46, 0x44, 0x35, 0x8a, 0x88,
+0x4e, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0x80
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_503_32, 32, 32, 
+0xff, 0xff, 0xa3, 0x53, 0x53, 0xd3, 0x53, 0x55,
+0xb3, 0x53, 0x84, 0xff, 0x03, 0xc3, 0xf0, 0x3b,
+0x3f, 0x13, 0xa3, 0x53, 0x83, 0xf3, 0x39, 0x24,
+0x3b, 0x39, 0x24, 0x3f, 0x73, 0x43, 0x33, 0xf0,
+0x3b, 0x3e, 0x4b, 0x3c, 0x6f, 0x76, 0x22, 0xf1,
+0xa4, 0x21, 0xf6, 0x73, 0x58, 0xf0, 0x3f, 0xd4,
+0x43, 0x52, 0xd5, 0x43, 0x52, 0xa5, 0x12, 0x43,
+0xd7, 0x32, 0x8f, 0x15, 0x38, 0xc8, 0x3f, 0xd3,
+0xfd, 0x3f, 0xb5, 0xa3, 0x3e, 0xc3, 0x3b, 0xf0,
+0x3f, 0xff, 0xc0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_504_32, 32, 32, 
+0xff, 0xff, 0xf1, 0x2f, 0xf0, 0x28, 0x2b, 0x2f,
+0x33, 0x84, 0xf3, 0x46, 0x4b, 0x25, 0x56, 0x2b,
+0x44, 0x21, 0x3f, 0x34, 0x42, 0x23, 0xf3, 0x25,
+0x23, 0x2a, 0x2d, 0x24, 0x28, 0x4b, 0x34, 0x28,
+0x4b, 0x25, 0x29, 0x2b, 0x26, 0x2e, 0x25, 0x36,
+0x2e, 0x25, 0x26, 0x25, 0x2e, 0x26, 0x35, 0x2d,
+0x26, 0x3f, 0x43, 0x63, 0xf4, 0x35, 0x4f, 0x34,
+0x45, 0x71, 0x77, 0x17, 0xbf, 0x3f, 0x2b, 0xff,
+0xa3, 0xfe, 0x3f, 0x73, 0x43, 0xf6, 0x5f, 0x63,
+0x35, 0xf6, 0x33, 0x5f, 0x63, 0x43, 0xff, 0xc0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_507_32, 32, 32, 
+0xd6, 0xf9, 0xbf, 0x5d, 0xf3, 0xf0, 0xf1, 0x56,
+0x6f, 0x04, 0x85, 0xf0, 0x4a, 0x2f, 0x14, 0xfd,
+0x4f, 0xd5, 0xfc, 0x6f, 0xc6, 0xfc, 0x6c, 0x14,
+0xfe, 0x2f, 0xf1, 0x12, 0xfd, 0x4f, 0xdf, 0xf3,
+0x2f, 0xef, 0x66, 0x31, 0xf8, 0x5f, 0xd5, 0xfc,
+0x5f, 0xd4, 0xd2, 0xd4, 0xc4, 0xb5, 0xc5, 0xa4,
+0xe5, 0x76, 0xf0, 0xf1, 0xf2, 0xef, 0x4c, 0xf8,
+0x6d
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_508_32, 32, 32, 
+0xd6, 0xf9, 0xbf, 0x5d, 0xf3, 0xf0, 0xf1, 0x56,
+0x6f, 0x04, 0x85, 0xf0, 0x4a, 0x2f, 0x14, 0xf1,
+0x14, 0xfe, 0x2f, 0xf1, 0x12, 0xfd, 0x4f, 0xdf,
+0xf3, 0x2f, 0xee, 0x79, 0x1f, 0x27, 0xfb, 0x7f,
+0xc6, 0x51, 0x4f, 0xe2, 0xff, 0x11, 0x2f, 0xd4,
+0xfd, 0xff, 0x32, 0xfe, 0x92, 0xd4, 0x21, 0x94,
+0xb5, 0xc5, 0xa4, 0xe5, 0x76, 0xf0, 0xf1, 0xf2,
+0xef, 0x4c, 0xf8, 0x6d
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_509_32, 32, 32, 
+0xd6, 0xf9, 0xaf, 0x54, 0x63, 0xf3, 0x39, 0x3f,
+0x13, 0xc2, 0xc5, 0xd6, 0x67, 0xe7, 0x33, 0xf9,
+0x32, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd2, 0x12, 0xfb, 0x22, 0x34, 0x1d, 0x24,
+0x33, 0x8c, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6f, 0xff, 0xff, 0x2f, 0x5f, 0xff, 0xff,
+0x78, 0x2f, 0x1f, 0xff, 0xf6, 0xf1, 0x28, 0xff,
+0xff, 0xef, 0x56
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_510_32, 32, 32, 
+0xd5, 0xfa, 0x7f, 0x84, 0xfc, 0x3f, 0xd3, 0xfb,
+0x5b, 0xc2, 0x7f, 0x93, 0xcc, 0x52, 0xfe, 0x2f,
+0x3e, 0xff, 0x02, 0xff, 0x02, 0xfd, 0x21, 0x2f,
+0xb2, 0x23, 0x41, 0xd2, 0x43, 0x38, 0xc8, 0x67,
+0x98, 0xd4, 0x63, 0xf6, 0xaf, 0x96, 0xff, 0xff,
+0xf2, 0xf5, 0xff, 0xff, 0xf7, 0x82, 0xf1, 0xff,
+0xff, 0x6f, 0x12, 0x8f, 0xff, 0xfe, 0xf5, 0x60
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_511_32, 32, 32, 
+0xff, 0xff, 0xff, 0xb2, 0xf3, 0x29, 0x4f, 0x14,
+0x84, 0xf1, 0x49, 0x2f, 0x32, 0xff, 0xff, 0xd5,
+0xe5, 0x78, 0xa8, 0x53, 0x44, 0x64, 0x43, 0x32,
+0x83, 0x43, 0x82, 0x13, 0x93, 0x23, 0x92, 0x12,
+0xb6, 0xb4, 0xc4, 0xc4, 0xc4, 0xc4, 0xb6, 0xb5,
+0x93, 0x23, 0x92, 0x23, 0x64, 0x43, 0x73, 0x33,
+0x44, 0x64, 0x43, 0x58, 0xa8, 0x84, 0xe4, 0xff,
+0xff, 0xe2, 0xf3, 0x29, 0x4f, 0x14, 0x84, 0xf1,
+0x49, 0x2f, 0x32, 0xff, 0xff, 0xff, 0xb0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_512_32, 32, 32, 
+0xff, 0xff, 0xff, 0xb2, 0xf3, 0x29, 0x47, 0x27,
+0x48, 0x46, 0x46, 0x49, 0x27, 0x47, 0x2f, 0x52,
+0xff, 0xf6, 0x5e, 0x57, 0x8a, 0x85, 0x34, 0x46,
+0x44, 0x33, 0x28, 0x34, 0x38, 0x21, 0x39, 0x32,
+0x39, 0x21, 0x2b, 0x6b, 0x4c, 0x4c, 0x4c, 0x4c,
+0x4b, 0x6b, 0x59, 0x32, 0x39, 0x22, 0x36, 0x44,
+0x37, 0x33, 0x34, 0x46, 0x44, 0x35, 0x8a, 0x88,
+0x4e, 0x4f, 0xff, 0x72, 0xf5, 0x27, 0x47, 0x29,
+0x46, 0x46, 0x48, 0x47, 0x27, 0x49, 0x2f, 0x32,
+0xff, 0xff, 0xff, 0xb0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_513_32, 32, 32, 
+0xff, 0xff, 0xff, 0x92, 0xf7, 0x25, 0x45, 0x26,
+0x34, 0x44, 0x44, 0x44, 0x44, 0x45, 0x25, 0x44,
+0x45, 0x2e, 0x26, 0x2f, 0xff, 0x25, 0xe5, 0x78,
+0xa8, 0x53, 0x44, 0x64, 0x43, 0x32, 0x83, 0x43,
+0x82, 0x13, 0x93, 0x23, 0x92, 0x12, 0xb6, 0xb4,
+0xc4, 0xc4, 0xc4, 0xc4, 0xb6, 0xb5, 0x93, 0x23,
+0x92, 0x23, 0x64, 0x43, 0x73, 0x33, 0x44, 0x64,
+0x43, 0x58, 0xa8, 0x84, 0xe4, 0xff, 0xf3, 0x26,
+0x2e, 0x25, 0x44, 0x45, 0x25, 0x44, 0x44, 0x44,
+0x44, 0x45, 0x26, 0x25, 0x45, 0x2f, 0x72, 0xff,
+0xff, 0xff, 0x90
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_514_32, 32, 32, 
+0xd5, 0xfa, 0x7f, 0x84, 0xfc, 0x3f, 0xd3, 0x4c,
+0xa5, 0x5c, 0x87, 0xf9, 0x3f, 0xe2, 0xf2, 0xef,
+0x3e, 0xff, 0x02, 0xff, 0x02, 0xfd, 0x21, 0x2f,
+0xb2, 0x23, 0x41, 0xd2, 0x43, 0x38, 0xc8, 0x67,
+0x98, 0xd4, 0x63, 0xf6, 0xaf, 0x96, 0xff, 0xff,
+0xf2, 0xf5, 0xcf, 0x5f, 0xff, 0xff, 0x78, 0x2f,
+0x16, 0x82, 0xf1, 0xff, 0xff, 0xcf, 0x5c, 0xf5,
+0x40
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_515_32, 32, 32, 
+0xd5, 0xfa, 0x7f, 0x84, 0xfc, 0x3f, 0xd3, 0xfb,
+0x5b, 0xc2, 0x7f, 0x93, 0xcc, 0x52, 0xfe, 0x2f,
+0x3e, 0xff, 0x02, 0xff, 0x02, 0xfd, 0x21, 0x2f,
+0xb2, 0x23, 0x41, 0xd2, 0x43, 0x38, 0xc8, 0x67,
+0x98, 0xd4, 0x63, 0xf6, 0xaf, 0x96, 0xff, 0xff,
+0xf2, 0xc2, 0x82, 0x8f, 0xff, 0xfa, 0x82, 0xf1,
+0xff, 0xff, 0x6f, 0x12, 0x8f, 0xff, 0xf8, 0x82,
+0x82, 0xc0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_800_32, 32, 32, 
+0xc8, 0xf6, 0xef, 0x1f, 0x3d, 0xf5, 0xbf, 0x79,
+0xf9, 0x7f, 0xb5, 0xfd, 0x4f, 0xd3, 0xff, 0x02,
+0xff, 0x02, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xf1, 0x1f, 0xf0, 0x2f,
+0xf0, 0x2f, 0xf0, 0x3f, 0xd4, 0xfd, 0x5f, 0xb7,
+0xf9, 0x9f, 0x7b, 0xf5, 0xdf, 0x3f, 0x1e, 0xf6,
+0x8c
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_801_32, 32, 32, 
+0xc8, 0xf6, 0x47, 0x3f, 0x17, 0x92, 0xda, 0x82,
+0xbc, 0x91, 0x9d, 0xa1, 0x7f, 0x0a, 0x15, 0xf2,
+0x92, 0x4f, 0x2a, 0x13, 0xf4, 0xa1, 0x2f, 0x4a,
+0x12, 0xf4, 0xa1, 0x1f, 0x6a, 0xf7, 0xaf, 0x7a,
+0xf7, 0xaf, 0x7a, 0xf7, 0xaf, 0x7a, 0xf7, 0xa1,
+0x1f, 0x4a, 0x12, 0xf4, 0xa1, 0x2f, 0x4a, 0x13,
+0xf2, 0xa1, 0x4f, 0x29, 0x25, 0xf0, 0xa1, 0x7d,
+0xa1, 0x9b, 0xa1, 0xb9, 0x92, 0xd7, 0x92, 0xf1,
+0x47, 0x3f, 0x68, 0xc0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_802_32, 32, 32, 
+0xc8, 0xf6, 0x65, 0x3f, 0x19, 0x72, 0xda, 0x82,
+0xbb, 0xa1, 0x9c, 0xb1, 0x7d, 0xc1, 0x5f, 0x0b,
+0x24, 0xf0, 0xc1, 0x3f, 0x1d, 0x12, 0xf1, 0xd1,
+0x2f, 0x1d, 0x11, 0xf2, 0xef, 0x3e, 0xf3, 0xef,
+0x3e, 0xf3, 0xef, 0x3e, 0xf3, 0xef, 0x3e, 0x11,
+0xf1, 0xd1, 0x2f, 0x1d, 0x12, 0xf1, 0xd1, 0x3e,
+0xd1, 0x4e, 0xc2, 0x5d, 0xc1, 0x7c, 0xb1, 0x9b,
+0xa1, 0xb9, 0x92, 0xd8, 0x82, 0xf1, 0x65, 0x3f,
+0x68, 0xc0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_803_32, 32, 32, 
+0xc8, 0xf6, 0xef, 0x16, 0x75, 0xd6, 0xa4, 0xb7,
+0xc3, 0x97, 0xe3, 0x77, 0xf1, 0x35, 0x8f, 0x23,
+0x47, 0xf4, 0x23, 0x8f, 0x43, 0x28, 0xf5, 0x22,
+0x7f, 0x62, 0x18, 0xf7, 0xaf, 0x7a, 0xf7, 0xaf,
+0x7a, 0xf7, 0xaf, 0x7a, 0xf7, 0xaf, 0x72, 0x17,
+0xf6, 0x22, 0x8f, 0x52, 0x28, 0xf4, 0x33, 0x7f,
+0x42, 0x48, 0xf2, 0x35, 0x7f, 0x13, 0x77, 0xe3,
+0x97, 0xc3, 0xb6, 0xa4, 0xd7, 0x65, 0xf1, 0xef,
+0x68, 0xc0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_804_32, 32, 32, 
+0xc8, 0xf6, 0xef, 0x15, 0x85, 0xd4, 0xc4, 0xb3,
+0xf1, 0x39, 0x3f, 0x33, 0x73, 0xf5, 0x35, 0x3f,
+0x73, 0x42, 0xf9, 0x23, 0x3f, 0x93, 0x22, 0xfb,
+0x22, 0x2f, 0xb2, 0x12, 0xfd, 0x4f, 0xd4, 0xfd,
+0x4f, 0xd4, 0xfd, 0x4f, 0xd4, 0xfd, 0x4f, 0xd2,
+0x12, 0xfb, 0x22, 0x2f, 0xb2, 0x23, 0xf9, 0x33,
+0x2f, 0x92, 0x43, 0xf7, 0x35, 0x3f, 0x53, 0x73,
+0xf3, 0x39, 0x3f, 0x13, 0xb4, 0xc4, 0xd5, 0x85,
+0xf1, 0xef, 0x68, 0xc0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_805_32, 32, 32, 
+0xc8, 0xf6, 0xef, 0x15, 0x67, 0xd4, 0xa6, 0xb3,
+0xc7, 0x93, 0xe7, 0x73, 0xf1, 0x75, 0x3f, 0x28,
+0x42, 0xf4, 0x73, 0x3f, 0x48, 0x22, 0xf5, 0x82,
+0x2f, 0x67, 0x12, 0xf7, 0xaf, 0x7a, 0xf7, 0xaf,
+0x7a, 0xf7, 0xaf, 0x7a, 0xf7, 0xaf, 0x78, 0x12,
+0xf6, 0x72, 0x2f, 0x58, 0x23, 0xf4, 0x83, 0x2f,
+0x47, 0x43, 0xf2, 0x85, 0x3f, 0x17, 0x73, 0xe7,
+0x93, 0xc7, 0xb4, 0x97, 0xd5, 0x67, 0xf1, 0xef,
+0x68, 0xc0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_806_32, 32, 32, 
+0xc8, 0xf6, 0xef, 0x15, 0x2b, 0xd4, 0x5b, 0xb3,
+0x7c, 0x93, 0x8d, 0x73, 0x9e, 0x53, 0xaf, 0x04,
+0x2c, 0xe3, 0x3c, 0xf0, 0x22, 0xdf, 0x02, 0x2d,
+0xf0, 0x12, 0xef, 0x3e, 0xf3, 0xef, 0x3e, 0xf3,
+0xef, 0x3e, 0xf3, 0xef, 0x3e, 0xf1, 0x12, 0xdf,
+0x02, 0x2d, 0xf0, 0x23, 0xcf, 0x03, 0x2b, 0xf0,
+0x43, 0xaf, 0x05, 0x39, 0xe7, 0x38, 0xd9, 0x37,
+0xcb, 0x44, 0xcd, 0x52, 0xbf, 0x1e, 0xf6, 0x8c
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_807_32, 32, 32, 
+0xc8, 0xf6, 0x37, 0x4f, 0x12, 0x97, 0xd2, 0x8a,
+0xb1, 0x9c, 0x91, 0xad, 0x71, 0xaf, 0x05, 0x29,
+0xf2, 0x41, 0xaf, 0x23, 0x1a, 0xf4, 0x21, 0xaf,
+0x42, 0x1a, 0xf4, 0x11, 0xaf, 0x7a, 0xf7, 0xaf,
+0x7a, 0xf7, 0xaf, 0x7a, 0xf7, 0xaf, 0x7a, 0xf6,
+0x11, 0xaf, 0x42, 0x1a, 0xf4, 0x21, 0xaf, 0x43,
+0x1a, 0xf2, 0x42, 0x9f, 0x25, 0x1a, 0xf0, 0x71,
+0xad, 0x91, 0x9c, 0xb2, 0x8a, 0xd2, 0x97, 0xf1,
+0x37, 0x4f, 0x68, 0xc0
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_900_32, 32, 32, 
+0xf6, 0x4f, 0xb8, 0xa1, 0xd3, 0x23, 0x92, 0xc3,
+0x43, 0x82, 0xc2, 0x62, 0x73, 0x31, 0x82, 0x62,
+0x74, 0x12, 0x82, 0x22, 0x22, 0x51, 0x17, 0x82,
+0x22, 0x22, 0x42, 0x18, 0x72, 0x22, 0x22, 0x4b,
+0x72, 0x22, 0x22, 0x4b, 0x72, 0x22, 0x22, 0x4b,
+0x72, 0x22, 0x22, 0x4b, 0x72, 0x22, 0x22, 0x59,
+0x82, 0x22, 0x22, 0x67, 0x92, 0x22, 0x22, 0x75,
+0xa2, 0x22, 0x22, 0xf6, 0x32, 0x22, 0x3f, 0x43,
+0x32, 0x33, 0xf2, 0x34, 0x24, 0x3f, 0x12, 0x44,
+0x42, 0xf0, 0x33, 0x63, 0x3e, 0x32, 0x82, 0x3e,
+0x23, 0x83, 0x2e, 0x23, 0x83, 0x2e, 0x32, 0x82,
+0x3e, 0x33, 0x63, 0x3f, 0x02, 0x44, 0x42, 0xf1,
+0x3a, 0x3f, 0x23, 0x83, 0xf4, 0x52, 0x5f, 0x6a,
+0xf9, 0x66
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_901_32, 32, 32, 
+0xf6, 0x4f, 0xb8, 0xa2, 0xc3, 0x23, 0xa2, 0xb3,
+0x43, 0x52, 0x22, 0x22, 0x72, 0x62, 0x5a, 0x72,
+0x62, 0x5a, 0x72, 0x62, 0x68, 0x82, 0x62, 0x68,
+0x82, 0x62, 0x5a, 0x72, 0x62, 0x5a, 0x72, 0x62,
+0x52, 0x22, 0x22, 0x72, 0x62, 0x92, 0xb2, 0x62,
+0x92, 0xb2, 0x62, 0xf7, 0x22, 0x22, 0x2f, 0x72,
+0x22, 0x22, 0xf6, 0x32, 0x22, 0x3f, 0x43, 0x32,
+0x33, 0xf2, 0x34, 0x24, 0x3f, 0x12, 0x44, 0x42,
+0xf0, 0x33, 0x63, 0x3e, 0x32, 0x82, 0x3e, 0x23,
+0x83, 0x2e, 0x23, 0x83, 0x2e, 0x32, 0x82, 0x3e,
+0x33, 0x63, 0x3f, 0x02, 0x44, 0x42, 0xf1, 0x3a,
+0x3f, 0x23, 0x83, 0xf4, 0x52, 0x5f, 0x6a, 0xf9,
+0x66
+);
+
+LCD_MONO_RLE_IMG_DEFINE(icon_999_32, 32, 32, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x6f,
+0x9a, 0xf5, 0x46, 0x3f, 0x33, 0x93, 0xf1, 0x34,
+0x44, 0x2c, 0x54, 0x63, 0x66, 0x73, 0x32, 0x33,
+0x73, 0x38, 0x24, 0x28, 0x32, 0x2e, 0x39, 0x21,
+0x2e, 0x3b, 0x4d, 0x3c, 0x4d, 0x2d, 0x4f, 0xd2,
+0x12, 0xfb, 0x22, 0x34, 0x16, 0x25, 0x24, 0x33,
+0x85, 0x25, 0x86, 0x79, 0x8d, 0x46, 0x3f, 0x6a,
+0xf9, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xa0
 );
 
 
@@ -18,6 +18,7 @@ typedef struct {
     ip_addr_t ip_addr;       // 客户端IP地址
     uint16_t port;           // 客户端端口号
     void *user_data;         // 用户自定义数据
+    uint32_t id;             // 连接序号，每个新连接递增，槽位复用后也不相同
 } tcp_client_t;
 
 /**
@@ -138,6 +139,18 @@ int tcp_server_get_client_count(tcp_server_handle_t server_handle);
  */
 esp_err_t tcp_server_disconnect_client(tcp_server_handle_t server_handle, tcp_client_t *client);
 
+/**
+ * @brief 按连接序号断开客户端连接
+ * 
+ * @note 在锁内查找连接，客户端已经断开、槽位被新连接复用时不会断开新连接，
+ *   适合在回调之外保存连接、之后再断开的情况
+ * 
+ * @param server_handle TCP服务器句柄
+ * @param id 连接序号，tcp_client_t::id
+ * @return esp_err_t 错误码，连接已经不存在时返回 ESP_ERR_NOT_FOUND
+ */
+esp_err_t tcp_server_disconnect_client_by_id(tcp_server_handle_t server_handle, uint32_t id);
+
 /**
  * @brief 设置TCP服务器日志级别
  * 
@@ -25,6 +25,7 @@ struct tcp_server_s {
     uint32_t max_clients;                   // 最大客户端数
     tcp_client_t *clients;                  // 客户端数组
     uint32_t client_count;                  // 当前客户端数量
+    uint32_t next_client_id;                // 上一个连接的序号
     bool running;                           // 服务器运行状态
     TaskHandle_t server_task;               // 服务器任务句柄
     SemaphoreHandle_t clients_mutex;        // 客户端列表互斥锁
@@ -159,6 +160,12 @@ static esp_err_t handle_new_connection(tcp_server_handle_t server) {
     ip_addr_set_ip4_u32(&client->ip_addr, client_addr.sin_addr.s_addr);
     client->user_data = NULL;
     
+    // 连接序号从1开始，回绕时跳过0
+    if (++server->next_client_id == 0) {
+        server->next_client_id = 1;
+    }
+    client->id = server->next_client_id;
+    
     server->client_count++;
     
     ESP_LOGI(TAG, "New client(%s:%d) connected (slot: %d, total: %d)", 
@@ -578,6 +585,30 @@ esp_err_t tcp_server_disconnect_client(tcp_server_handle_t server_handle, tcp_cl
     return ESP_OK;
 } 
 
+esp_err_t tcp_server_disconnect_client_by_id(tcp_server_handle_t server_handle, uint32_t id) {
+    if (server_handle == NULL || id == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    tcp_server_handle_t server = server_handle;
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    
+    if (xSemaphoreTake(server->clients_mutex, pdMS_TO_TICKS(1000)) == pdTRUE) {
+        for (int i = 0; i < server->max_clients; i++) {
+            if (server->clients[i].socket_fd != -1 && server->clients[i].id == id) {
+                remove_client(server, &server->clients[i]);
+                ret = ESP_OK;
+                break;
+            }
+        }
+        xSemaphoreGive(server->clients_mutex);
+    } else {
+        return ESP_ERR_TIMEOUT;
+    }
+    
+    return ret;
+}
+
 void tcp_server_set_verbose(tcp_server_handle_t server_handle, bool tx_verbose, bool rx_verbose) {
     if (server_handle == NULL) {
         return;